@@ -0,0 +1,424 @@
+// ball_hotpath.m.cpp                                                 -*-C++-*-
+
+// This program measures the cost of the stages of the `ball` logging hot
+// path: the check of a disabled category in the `BALL_LOG_*` macros, the
+// retrieval of a record from the record pool of a logger, the collection of
+// attributes, the formatting of a record, and the publication of a record to
+// an observer.  Each stage is run concurrently by 1, 2, 4, ... threads (up to
+// a maximum given on the command line), and the average time per record (as
+// seen by each thread) and the average number of allocations per record are
+// reported.
+//
+// Usage:
+// ```
+//  ball_hotpath [numRecordsPerThread [maxNumThreads]]
+// ```
+// where `numRecordsPerThread` defaults to 1000000 and `maxNumThreads` to 8.
+//
+// The stages are cumulative: each stage logs through the full `ball` path
+// and differs from the previous one by one additional step, so that the cost
+// of a step is the difference between the figures of consecutive stages:
+//
+//: `disabled`:   `BALL_LOG_TRACE` for a category whose thresholds disable it
+//:
+//: `getRecord`:  `ball::Logger::getRecord` followed by `logMessage` for a
+//:               disabled severity (i.e., the record is only returned to the
+//:               pool)
+//:
+//: `publish`:    `BALL_LOG_INFO` published to an observer doing nothing
+//:
+//: `attributes`: as `publish`, having four attribute collectors registered
+//:
+//: `format`:     as `publish`, the observer formatting each record with a
+//:               `ball::RecordStringFormatter` into a discarding stream
+//:
+//: `stream`:     as `publish`, the observer being a `ball::StreamObserver`
+//:               writing to a discarding stream
+//
+// Allocations are counted by an allocator installed as both the default and
+// the global allocator, and therefore include the allocations of the logger
+// manager and of the observers.
+
+#include <ball_attribute.h>
+#include <ball_context.h>
+#include <ball_log.h>
+#include <ball_loggermanager.h>
+#include <ball_loggermanagerconfiguration.h>
+#include <ball_observer.h>
+#include <ball_record.h>
+#include <ball_recordstringformatter.h>
+#include <ball_severity.h>
+#include <ball_streamobserver.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_newdeleteallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_memory.h>
+#include <bsl_ostream.h>
+#include <bsl_streambuf.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+const char k_CATEGORY[] = "BENCHMARK.HOTPATH";
+
+                          // =======================
+                          // class CountingAllocator
+                          // =======================
+
+/// This class implements the `bslma::Allocator` protocol, forwarding to the
+/// `bslma::NewDeleteAllocator` singleton and counting the allocations.
+class CountingAllocator : public bslma::Allocator {
+
+    // DATA
+    bsls::AtomicInt64  d_numAllocations;
+    bslma::Allocator  *d_allocator_p;
+
+  public:
+    // CREATORS
+
+    /// Create a counting allocator.
+    CountingAllocator()
+    : d_numAllocations(0)
+    , d_allocator_p(&bslma::NewDeleteAllocator::singleton())
+    {
+    }
+
+    // MANIPULATORS
+    void *allocate(size_type size) BSLS_KEYWORD_OVERRIDE
+    {
+        d_numAllocations.addRelaxed(1);
+        return d_allocator_p->allocate(size);
+    }
+
+    void deallocate(void *address) BSLS_KEYWORD_OVERRIDE
+    {
+        d_allocator_p->deallocate(address);
+    }
+
+    // ACCESSORS
+
+    /// Return the number of allocations made by this allocator.
+    bsls::Types::Int64 numAllocations() const
+    {
+        return d_numAllocations.loadRelaxed();
+    }
+};
+
+                             // =================
+                             // class NullBuffer
+                             // =================
+
+/// This class provides a stream buffer discarding the characters written to
+/// it.
+class NullBuffer : public bsl::streambuf {
+
+  protected:
+    // MANIPULATORS
+    int_type overflow(int_type c) BSLS_KEYWORD_OVERRIDE
+    {
+        return traits_type::not_eof(c);
+    }
+
+    bsl::streamsize xsputn(const char_type *,
+                           bsl::streamsize  count) BSLS_KEYWORD_OVERRIDE
+    {
+        return count;
+    }
+};
+
+                            // ==================
+                            // class NullObserver
+                            // ==================
+
+/// This class implements the `ball::Observer` protocol, discarding the
+/// records it receives.
+class NullObserver : public ball::Observer {
+
+  public:
+    // MANIPULATORS
+    using Observer::publish;
+
+    void publish(const bsl::shared_ptr<const ball::Record>&,
+                 const ball::Context&) BSLS_KEYWORD_OVERRIDE
+    {
+    }
+};
+
+                           // ====================
+                           // class FormatObserver
+                           // ====================
+
+/// This class implements the `ball::Observer` protocol, formatting the
+/// records it receives into a discarding stream.
+class FormatObserver : public ball::Observer {
+
+    // DATA
+    ball::RecordStringFormatter d_formatter;
+
+  public:
+    // CREATORS
+
+    /// Create an observer formatting records using the default format of
+    /// `ball::StreamObserver`.
+    FormatObserver()
+    : d_formatter("\n%d %p:%t %s %f:%l %c %m %u\n")
+    {
+    }
+
+    // MANIPULATORS
+    using Observer::publish;
+
+    void publish(const bsl::shared_ptr<const ball::Record>& record,
+                 const ball::Context&) BSLS_KEYWORD_OVERRIDE
+    {
+        NullBuffer   buffer;
+        bsl::ostream stream(&buffer);
+
+        d_formatter(stream, *record);
+    }
+};
+
+                                // ===========
+                                // enum Stage
+                                // ===========
+
+enum Stage {
+    e_DISABLED,
+    e_GET_RECORD,
+    e_PUBLISH,
+    e_ATTRIBUTES,
+    e_FORMAT,
+    e_STREAM
+};
+
+const char *const k_STAGE_NAMES[] = {
+    "disabled",
+    "getRecord",
+    "publish",
+    "attributes",
+    "format",
+    "stream"
+};
+
+const int k_NUM_STAGES = sizeof k_STAGE_NAMES / sizeof *k_STAGE_NAMES;
+
+const char *const k_ATTRIBUTE_NAMES[] = {
+    "benchmark.a",
+    "benchmark.b",
+    "benchmark.c",
+    "benchmark.d"
+};
+
+const int k_NUM_ATTRIBUTES = sizeof  k_ATTRIBUTE_NAMES
+                           / sizeof *k_ATTRIBUTE_NAMES;
+
+/// Visit, with the specified `visitor`, the attribute having the specified
+/// `name` and `value`.
+void collectAttribute(const char                                  *name,
+                      int                                          value,
+                      const ball::LoggerManager::AttributeVisitor& visitor)
+{
+    visitor(ball::Attribute(name, value));
+}
+
+/// Log the specified `numRecords` records as specified by the specified
+/// `stage`, after waiting twice on the specified `barrier` (once to signal
+/// that this thread is ready, and once to start), and wait on `barrier`
+/// again when done.
+void runStage(Stage stage, int numRecords, bslmt::Barrier *barrier)
+{
+    BALL_LOG_SET_CATEGORY(k_CATEGORY);
+
+    ball::Logger& logger = ball::LoggerManager::singleton().getLogger();
+
+    barrier->wait();
+    barrier->wait();
+
+    switch (stage) {
+      case e_DISABLED: {
+        for (int i = 0; i < numRecords; ++i) {
+            BALL_LOG_TRACE << "record " << i;
+        }
+      } break;
+      case e_GET_RECORD: {
+        const ball::Category *category = BALL_LOG_CATEGORY;
+
+        for (int i = 0; i < numRecords; ++i) {
+            logger.logMessage(*category,
+                              ball::Severity::e_TRACE,
+                              logger.getRecord(__FILE__, __LINE__));
+        }
+      } break;
+      default: {
+        for (int i = 0; i < numRecords; ++i) {
+            BALL_LOG_INFO << "record " << i;
+        }
+      } break;
+    }
+
+    barrier->wait();
+}
+
+/// Configure the logger manager singleton for the specified `stage`,
+/// undoing the configuration of the preceding stage.
+void configureStage(Stage stage)
+{
+    ball::LoggerManager& manager = ball::LoggerManager::singleton();
+
+    switch (stage) {
+      case e_DISABLED: {
+        manager.registerObserver(bsl::make_shared<NullObserver>(), "null");
+      } break;
+      case e_GET_RECORD:
+      case e_PUBLISH: {
+      } break;
+      case e_ATTRIBUTES: {
+        for (int i = 0; i < k_NUM_ATTRIBUTES; ++i) {
+            manager.registerAttributeCollector(
+                             bdlf::BindUtil::bind(&collectAttribute,
+                                                  k_ATTRIBUTE_NAMES[i],
+                                                  i,
+                                                  bdlf::PlaceHolders::_1),
+                             k_ATTRIBUTE_NAMES[i]);
+        }
+      } break;
+      case e_FORMAT: {
+        for (int i = 0; i < k_NUM_ATTRIBUTES; ++i) {
+            manager.deregisterAttributeCollector(k_ATTRIBUTE_NAMES[i]);
+        }
+        manager.deregisterObserver("null");
+        manager.registerObserver(bsl::make_shared<FormatObserver>(),
+                                 "format");
+      } break;
+      case e_STREAM: {
+        static NullBuffer   buffer;
+        static bsl::ostream stream(&buffer);
+
+        manager.deregisterObserver("format");
+        manager.registerObserver(
+                              bsl::make_shared<ball::StreamObserver>(&stream),
+                              "stream");
+      } break;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int numRecords    = argc > 1 && bsl::atoi(argv[1]) > 0
+                            ? bsl::atoi(argv[1])
+                            : 1000000;
+    const int maxNumThreads = argc > 2 && bsl::atoi(argv[2]) > 0
+                            ? bsl::atoi(argv[2])
+                            : 8;
+
+    static CountingAllocator allocator;
+
+    bslma::Default::setDefaultAllocatorRaw(&allocator);
+    bslma::Default::setGlobalAllocator(&allocator);
+
+    ball::LoggerManagerConfiguration configuration;
+    configuration.setDefaultThresholdLevelsIfValid(ball::Severity::e_OFF,
+                                                   ball::Severity::e_INFO,
+                                                   ball::Severity::e_OFF,
+                                                   ball::Severity::e_OFF);
+
+    ball::LoggerManagerScopedGuard guard(configuration);
+
+    bsl::printf("%-12s %8s %12s %14s\n",
+                "stage", "threads", "ns/record", "allocs/record");
+
+    for (int stage = 0; stage < k_NUM_STAGES; ++stage) {
+        configureStage(static_cast<Stage>(stage));
+
+        for (int numThreads = 1;
+             numThreads <= maxNumThreads;
+             numThreads *= 2) {
+            bslmt::Barrier                          barrier(numThreads + 1);
+            bsl::vector<bslmt::ThreadUtil::Handle>  handles(numThreads);
+
+            for (int i = 0; i < numThreads; ++i) {
+                int rc = bslmt::ThreadUtil::createWithAllocator(
+                               &handles[i],
+                               bdlf::BindUtil::bind(&runStage,
+                                                    static_cast<Stage>(stage),
+                                                    numRecords,
+                                                    &barrier),
+                               &bslma::NewDeleteAllocator::singleton());
+                if (0 != rc) {
+                    bsl::fprintf(stderr, "Failed to create a thread.\n");
+                    return 1;                                         // RETURN
+                }
+            }
+
+            // Exclude the creation of the threads from the measurement, and
+            // take the initial allocation count before any thread starts.
+
+            barrier.wait();
+
+            const bsls::Types::Int64 numAllocations =
+                                                   allocator.numAllocations();
+            bsls::Stopwatch          timer;
+            timer.start();
+
+            barrier.wait();
+            barrier.wait();
+
+            timer.stop();
+
+            const double numTotal = static_cast<double>(numRecords) *
+                                                                   numThreads;
+
+            bsl::printf("%-12s %8d %12.2f %14.3f\n",
+                        k_STAGE_NAMES[stage],
+                        numThreads,
+                        timer.elapsedTime() * 1e9 / numRecords,
+                        static_cast<double>(allocator.numAllocations() -
+                                            numAllocations) / numTotal);
+
+            for (int i = 0; i < numThreads; ++i) {
+                bslmt::ThreadUtil::join(handles[i]);
+            }
+        }
+    }
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
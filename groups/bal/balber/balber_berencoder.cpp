@@ -35,6 +35,9 @@ BerEncoder::BerEncoder(const BerEncoderOptions *options,
 , d_streamBuf          (0)
 , d_currentDepth       (0)
 , d_useArrayLengthHint (true)
+, d_lengthMode         (e_INDEFINITE_LENGTH)
+, d_lengths            (d_allocator)
+, d_nextLength         (0)
 {
 }
 
@@ -176,6 +179,58 @@ int BerEncoder::encodeAny(bsl::ostream& stream, const bdlar::AnyConstRef& any)
     return encode(stream, any);
 }
 
+                    // --------------------------------------
+                    // private class BerEncoder_LengthCounter
+                    // --------------------------------------
+
+// PROTECTED MANIPULATORS
+BerEncoder_LengthCounter::int_type
+BerEncoder_LengthCounter::overflow(int_type c)
+{
+    d_numDiscarded += pptr() - pbase();
+    setp(d_buffer, d_buffer + k_BUFFER_SIZE);
+
+    if (traits_type::eq_int_type(c, traits_type::eof())) {
+        return traits_type::not_eof(c);                               // RETURN
+    }
+
+    *pptr() = traits_type::to_char_type(c);
+    pbump(1);
+    return c;
+}
+
+BerEncoder_LengthCounter::pos_type
+BerEncoder_LengthCounter::seekoff(off_type                offset,
+                                  bsl::ios_base::seekdir  way,
+                                  bsl::ios_base::openmode which)
+{
+    if (0 != offset
+     || bsl::ios_base::cur != way
+     || bsl::ios_base::out != which) {
+        return pos_type(-1);                                          // RETURN
+    }
+
+    return pos_type(length());
+}
+
+bsl::streamsize BerEncoder_LengthCounter::xsputn(const char_type *,
+                                                 bsl::streamsize  numChars)
+{
+    d_numDiscarded += numChars;
+    return numChars;
+}
+
+// CREATORS
+BerEncoder_LengthCounter::BerEncoder_LengthCounter()
+: d_numDiscarded(0)
+{
+    setp(d_buffer, d_buffer + k_BUFFER_SIZE);
+}
+
+BerEncoder_LengthCounter::~BerEncoder_LengthCounter()
+{
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
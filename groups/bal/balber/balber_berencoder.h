@@ -25,6 +25,30 @@ BSLS_IDENT("$Id: $")
 // Note that encoding top-level `array` objects (a.k.a. `sequence-of` types, in
 // the X.680-X.693 specs) is not allowed.
 //
+///Definite-Length Encoding
+///------------------------
+// The `encode` methods write each constructed element (sequence, choice,
+// array, or nillable value) in the indefinite-length form: its contents are
+// followed by end-of-contents octets rather than preceded by their length, so
+// that the encoding can be written in a single pass to any stream.  The
+// `encodeDefiniteLength` methods instead write each constructed element in
+// the definite-length form, and write the encoding into a `bsl::vector<char>`
+// or `bdlbb::Blob` that is sized to it exactly beforehand.
+//
+// `encodeDefiniteLength` makes two passes over the value being encoded.  The
+// first pass encodes the value to a stream that discards the encoding,
+// recording the length of the contents of each constructed element and the
+// total length.  The output is then grown once, by the total length, and the
+// second pass writes the encoding directly into it, taking the length of each
+// constructed element from those recorded.  No part of the encoding is
+// buffered, copied, or written more than once, and the output is never
+// reallocated while it is written.  Note that the first pass encodes every
+// primitive value, and so roughly doubles the work of encoding the value: the
+// definite-length methods are of benefit when the output, rather than the
+// encoding, dominates the cost (e.g., for large encodings, or when the
+// encoding is to be sent in a blob), or when the definite-length form is
+// required by the recipient.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -180,6 +204,10 @@ BSLS_IDENT("$Id: $")
 #include <bdlat_typecategory.h>
 #include <bdlat_typename.h>
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobstreambuf.h>
+
+#include <bdlsb_fixedmemoutstreambuf.h>
 #include <bdlsb_memoutstreambuf.h>
 
 #include <bslma_allocator.h>
@@ -188,7 +216,11 @@ BSLS_IDENT("$Id: $")
 #include <bsls_keyword.h>
 #include <bsls_objectbuffer.h>
 
+#include <bsl_climits.h>
+#include <bsl_cstddef.h>
+#include <bsl_ios.h>
 #include <bsl_ostream.h>
+#include <bsl_streambuf.h>
 #include <bsl_string.h>
 #include <bsl_vector.h>
 #include <bsl_typeinfo.h>
@@ -266,6 +298,14 @@ class BerEncoder {
         int length() const;
     };
 
+    /// This enumeration defines how the lengths of constructed elements are
+    /// handled by an encoding pass.
+    enum LengthMode {
+        e_INDEFINITE_LENGTH,  // write the indefinite-length form
+        e_MEASURE_LENGTHS,    // record the lengths of the contents
+        e_DEFINITE_LENGTH     // write the recorded lengths
+    };
+
   public:
     // PUBLIC TYPES
     enum ErrorSeverity {
@@ -299,6 +339,22 @@ class BerEncoder {
                                                         // encode the array
                                                         // length hint
 
+    LengthMode                        d_lengthMode;     // handling of the
+                                                        // lengths of
+                                                        // constructed
+                                                        // elements
+
+    bsl::vector<int>                  d_lengths;        // lengths of the
+                                                        // contents of the
+                                                        // constructed
+                                                        // elements, in
+                                                        // preorder
+
+    bsl::size_t                       d_nextLength;     // index in
+                                                        // `d_lengths` of the
+                                                        // next length to
+                                                        // write
+
   private:
     // NOT IMPLEMENTED
     BerEncoder(const BerEncoder&);             // = delete;
@@ -324,6 +380,35 @@ class BerEncoder {
     /// created yet, it will be created during this call.
     bsl::ostream& logStream();
 
+    /// Write the length octets of a constructed element whose identifier
+    /// octets have just been written, as determined by the current length
+    /// mode, and load into the specified `lengthIndex` the value to be
+    /// supplied to `endConstructedContents` once the contents of the element
+    /// have been written.  Return 0 on success, and a non-zero value
+    /// otherwise.
+    int beginConstructedContents(bsl::size_t *lengthIndex);
+
+    /// Complete the constructed element whose contents have just been
+    /// written, and whose `beginConstructedContents` call loaded the
+    /// specified `lengthIndex`, by writing its end-of-contents octets or
+    /// recording its length, as determined by the current length mode.
+    /// Return 0 on success, and a non-zero value otherwise.
+    int endConstructedContents(bsl::size_t lengthIndex);
+
+    /// Encode the specified `value` to a stream that discards the encoding,
+    /// recording the lengths of the contents of its constructed elements,
+    /// and load the length of the encoding into the specified `length`.
+    /// Return 0 on success, and a non-zero value otherwise.
+    template <typename TYPE>
+    int measure(int *length, const TYPE& value);
+
+    /// Encode the specified `value` to the specified `streamBuf` in the
+    /// definite-length form, using the lengths recorded by the most recent
+    /// call to `measure` for `value`.  Return 0 on success, and a non-zero
+    /// value otherwise.
+    template <typename TYPE>
+    int encodeMeasured(bsl::streambuf *streamBuf, const TYPE& value);
+
     int encodeImpl(const bsl::vector<char>&  value,
                    BerConstants::TagClass    tagClass,
                    int                       tagNumber,
@@ -438,6 +523,24 @@ class BerEncoder {
     int encodeAny(bsl::ostream& stream, const TYPE& value);
     int encodeAny(bsl::ostream& stream, const bdlar::AnyConstRef& any);
 
+    /// Encode the specified non-modifiable `value` in the definite-length
+    /// form, appending the encoding to the specified `blob`.  Return 0 on
+    /// success, and a non-zero value, with no effect on the length of
+    /// `blob`, otherwise.  The buffers for the encoding are obtained from
+    /// the blob buffer factory of `blob` before any of it is written; see
+    /// {Definite-Length Encoding}.
+    template <typename TYPE>
+    int encodeDefiniteLength(bdlbb::Blob *blob, const TYPE& value);
+
+    /// Encode the specified non-modifiable `value` in the definite-length
+    /// form, appending the encoding to the specified `buffer`.  Return 0 on
+    /// success, and a non-zero value, with no effect on the size of
+    /// `buffer`, otherwise.  `buffer` is resized once, to the exact size of
+    /// the encoding, before any of it is written; see
+    /// {Definite-Length Encoding}.
+    template <typename TYPE>
+    int encodeDefiniteLength(bsl::vector<char> *buffer, const TYPE& value);
+
     // ACCESSORS
 
     /// Return address of the options.
@@ -501,6 +604,66 @@ class BerEncoder_UseArrayLengthHintGuard {
     ~BerEncoder_UseArrayLengthHintGuard();
 };
 
+                    // ======================================
+                    // private class BerEncoder_LengthCounter
+                    // ======================================
+
+/// This class provides a `bsl::streambuf` that discards the characters
+/// written to it, keeping only their count.  `seekoff` reports the count as
+/// the current put position, so that the encoder can measure the length of
+/// the contents of each constructed element.
+class BerEncoder_LengthCounter : public bsl::streambuf {
+
+    // PRIVATE TYPES
+    enum { k_BUFFER_SIZE = 256 };
+
+    // DATA
+    char            d_buffer[k_BUFFER_SIZE];  // put area, discarded when full
+    bsl::streamsize d_numDiscarded;           // characters discarded from
+                                              // the put area
+
+  private:
+    // NOT IMPLEMENTED
+    BerEncoder_LengthCounter(const BerEncoder_LengthCounter&);  // = delete;
+    BerEncoder_LengthCounter& operator=(const BerEncoder_LengthCounter&);
+                                                                // = delete;
+
+  protected:
+    // PROTECTED MANIPULATORS
+
+    /// Discard the contents of the put area and then count the specified
+    /// `c`, unless it is EOF.  Return `c`, or a value other than EOF if `c`
+    /// is EOF.
+    int_type overflow(int_type c) BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the number of characters written to this stream buffer if
+    /// the specified `offset` is 0, the specified `way` is
+    /// `bsl::ios_base::cur`, and the specified `which` is
+    /// `bsl::ios_base::out`, and `pos_type(-1)` otherwise.
+    pos_type seekoff(off_type                offset,
+                     bsl::ios_base::seekdir  way,
+                     bsl::ios_base::openmode which) BSLS_KEYWORD_OVERRIDE;
+
+    /// Count, without copying, the specified `numChars` characters at the
+    /// specified `source`, and return `numChars`.
+    bsl::streamsize xsputn(const char_type *source,
+                           bsl::streamsize  numChars) BSLS_KEYWORD_OVERRIDE;
+
+  public:
+    // CREATORS
+
+    /// Create a stream buffer to which no characters have been written.
+    BerEncoder_LengthCounter();
+
+    /// Destroy this object.
+    ~BerEncoder_LengthCounter() BSLS_KEYWORD_OVERRIDE;
+
+    // ACCESSORS
+
+    /// Return the number of characters written to this stream buffer.
+    bsl::streamsize length() const;
+};
+
                       // ================================
                       // private class BerEncoder_Visitor
                       // ================================
@@ -672,6 +835,17 @@ BerEncoder_UseArrayLengthHintGuard::~BerEncoder_UseArrayLengthHintGuard()
     d_encoder->d_useArrayLengthHint = d_previous;
 }
 
+                    // --------------------------------------
+                    // private class BerEncoder_LengthCounter
+                    // --------------------------------------
+
+// ACCESSORS
+inline
+bsl::streamsize BerEncoder_LengthCounter::length() const
+{
+    return d_numDiscarded + (pptr() - pbase());
+}
+
                        // -----------------------------
                        // struct BerEncoder_encodeProxy
                        // -----------------------------
@@ -742,6 +916,95 @@ bsl::ostream& BerEncoder::logStream()
     return *d_logStream;
 }
 
+inline
+int BerEncoder::beginConstructedContents(bsl::size_t *lengthIndex)
+{
+    switch (d_lengthMode) {
+      case e_MEASURE_LENGTHS: {
+        *lengthIndex = d_lengths.size();
+        d_lengths.push_back(static_cast<int>(d_streamBuf->pubseekoff(
+                                                       0,
+                                                       bsl::ios_base::cur,
+                                                       bsl::ios_base::out)));
+        return 0;                                                     // RETURN
+      }
+      case e_DEFINITE_LENGTH: {
+        BSLS_ASSERT(d_nextLength < d_lengths.size());
+
+        *lengthIndex = d_nextLength;
+        return BerUtil::putLength(d_streamBuf, d_lengths[d_nextLength++]);
+                                                                      // RETURN
+      }
+      default: {
+        *lengthIndex = 0;
+        return BerUtil::putIndefiniteLengthOctet(d_streamBuf);        // RETURN
+      }
+    }
+}
+
+inline
+int BerEncoder::endConstructedContents(bsl::size_t lengthIndex)
+{
+    switch (d_lengthMode) {
+      case e_MEASURE_LENGTHS: {
+        const bsl::streamoff end = d_streamBuf->pubseekoff(
+                                                          0,
+                                                          bsl::ios_base::cur,
+                                                          bsl::ios_base::out);
+        if (INT_MAX < end) {
+            return -1;                                                // RETURN
+        }
+
+        int& length = d_lengths[lengthIndex];
+        length      = static_cast<int>(end) - length;
+
+        // The length octets are written only to be counted, after the
+        // contents they precede in the encoding.
+
+        return BerUtil::putLength(d_streamBuf, length);               // RETURN
+      }
+      case e_DEFINITE_LENGTH: {
+        return 0;                                                     // RETURN
+      }
+      default: {
+        return BerUtil::putEndOfContentOctets(d_streamBuf);           // RETURN
+      }
+    }
+}
+
+template <typename TYPE>
+int BerEncoder::measure(int *length, const TYPE& value)
+{
+    BerEncoder_LengthCounter counter;
+
+    d_lengths.clear();
+    d_lengthMode = e_MEASURE_LENGTHS;
+
+    const int rc = encode(&counter, value);
+
+    d_lengthMode = e_INDEFINITE_LENGTH;
+
+    if (0 != rc || INT_MAX < counter.length()) {
+        return -1;                                                    // RETURN
+    }
+
+    *length = static_cast<int>(counter.length());
+    return 0;
+}
+
+template <typename TYPE>
+int BerEncoder::encodeMeasured(bsl::streambuf *streamBuf, const TYPE& value)
+{
+    d_nextLength = 0;
+    d_lengthMode = e_DEFINITE_LENGTH;
+
+    const int rc = encode(streamBuf, value);
+
+    d_lengthMode = e_INDEFINITE_LENGTH;
+
+    return rc;
+}
+
 template <typename TYPE>
 int BerEncoder::encode(bsl::streambuf *streamBuf, const TYPE& value)
 {
@@ -810,6 +1073,72 @@ int BerEncoder::encodeAny(bsl::ostream& stream, const TYPE& value)
     return encodeAny(stream, bdlar::RefUtil::makeAnyConstRef(value));
 }
 
+template <typename TYPE>
+int BerEncoder::encodeDefiniteLength(bdlbb::Blob *blob, const TYPE& value)
+{
+    BSLS_ASSERT(blob);
+
+    int length;
+    if (0 != measure(&length, value)) {
+        return -1;                                                    // RETURN
+    }
+
+    const int initialLength = blob->length();
+
+    if (INT_MAX - initialLength < length) {
+        return -1;                                                    // RETURN
+    }
+
+    // Obtain all buffers for the encoding at once; the stream buffer then
+    // writes into them without growing `blob`.
+
+    blob->setLength(initialLength + length);
+    blob->setLength(initialLength);
+
+    int rc;
+    {
+        bdlbb::OutBlobStreamBuf streamBuf(blob);
+
+        rc = encodeMeasured(&streamBuf, value);
+    }
+
+    if (0 != rc || initialLength + length != blob->length()) {
+        blob->setLength(initialLength);
+        return -1;                                                    // RETURN
+    }
+
+    return 0;
+}
+
+template <typename TYPE>
+int BerEncoder::encodeDefiniteLength(bsl::vector<char> *buffer,
+                                     const TYPE&        value)
+{
+    BSLS_ASSERT(buffer);
+
+    int length;
+    if (0 != measure(&length, value)) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsl::size_t initialSize = buffer->size();
+
+    buffer->resize(initialSize + length);
+
+    bdlsb::FixedMemOutStreamBuf streamBuf(buffer->data() + initialSize,
+                                          length);
+
+    const int rc = encodeMeasured(&streamBuf, value);
+
+    if (0 != rc
+     || static_cast<bsl::streamsize>(length) != streamBuf.length()) {
+        buffer->resize(initialSize);
+        return -1;                                                    // RETURN
+    }
+
+    return 0;
+}
+
 // PRIVATE MANIPULATORS
 template <typename TYPE>
 int BerEncoder::encodeImpl(const TYPE&                value,
@@ -824,11 +1153,14 @@ int BerEncoder::encodeImpl(const TYPE&                value,
 
     const BerConstants::TagType tagType = BerConstants::e_CONSTRUCTED;
 
+    bsl::size_t outerLengthIndex;
+    bsl::size_t innerLengthIndex = 0;
+
     int rc = BerUtil::putIdentifierOctets(d_streamBuf,
                                           tagClass,
                                           tagType,
                                           tagNumber);
-    if (rc | BerUtil::putIndefiniteLengthOctet(d_streamBuf)) {
+    if (rc | beginConstructedContents(&outerLengthIndex)) {
         return k_FAILURE;                                             // RETURN
     }
 
@@ -843,7 +1175,7 @@ int BerEncoder::encodeImpl(const TYPE&                value,
                                           BerConstants::e_CONTEXT_SPECIFIC,
                                           tagType,
                                           0);
-        if (rc | BerUtil::putIndefiniteLengthOctet(d_streamBuf)) {
+        if (rc | beginConstructedContents(&innerLengthIndex)) {
             return k_FAILURE;
         }
     }
@@ -877,10 +1209,10 @@ int BerEncoder::encodeImpl(const TYPE&                value,
         // Don't waste time checking the result of this call -- the only thing
         // that can go wrong is eof, which will happen again when we call it
         // again below.
-        BerUtil::putEndOfContentOctets(d_streamBuf);
+        endConstructedContents(innerLengthIndex);
     }
 
-    return BerUtil::putEndOfContentOctets(d_streamBuf);
+    return endConstructedContents(outerLengthIndex);
 }
 
 template <typename TYPE>
@@ -900,11 +1232,13 @@ int BerEncoder::encodeImpl(const TYPE&                       value,
 
         // nillable is encoded in BER as a sequence with one optional element
 
+        bsl::size_t lengthIndex;
+
         int rc = BerUtil::putIdentifierOctets(d_streamBuf,
                                               tagClass,
                                               BerConstants::e_CONSTRUCTED,
                                               tagNumber);
-        if (rc | BerUtil::putIndefiniteLengthOctet(d_streamBuf)) {
+        if (rc | beginConstructedContents(&lengthIndex)) {
             return k_FAILURE;
         }
 
@@ -922,7 +1256,7 @@ int BerEncoder::encodeImpl(const TYPE&                       value,
             }
         } // end of bdlat_NullableValueFunctions::isNull(...)
 
-        return BerUtil::putEndOfContentOctets(d_streamBuf);
+        return endConstructedContents(lengthIndex);
     } // end of isNillable
 
     if (!bdlat_NullableValueFunctions::isNull(value)) {
@@ -994,17 +1328,19 @@ int BerEncoder::encodeImpl(const TYPE&                  value,
 
     BerEncoder_Visitor visitor(this);
 
+    bsl::size_t lengthIndex;
+
     int rc = BerUtil::putIdentifierOctets(d_streamBuf,
                                           tagClass,
                                           BerConstants::e_CONSTRUCTED,
                                           tagNumber);
-    rc |= BerUtil::putIndefiniteLengthOctet(d_streamBuf);
+    rc |= beginConstructedContents(&lengthIndex);
     if (rc) {
         return rc;
     }
 
     rc = bdlat_SequenceFunctions::accessAttributes(value, visitor);
-    rc |= BerUtil::putEndOfContentOctets(d_streamBuf);
+    rc |= endConstructedContents(lengthIndex);
 
     return rc;
 }
@@ -1075,11 +1411,13 @@ BerEncoder::encodeArrayImpl(const TYPE&             value,
 
     const BerConstants::TagType tagType = BerConstants::e_CONSTRUCTED;
 
+    bsl::size_t lengthIndex;
+
     rc |= BerUtil::putIdentifierOctets(d_streamBuf,
                                        tagClass,
                                        tagType,
                                        tagNumber);
-    rc |= BerUtil::putIndefiniteLengthOctet(d_streamBuf);
+    rc |= beginConstructedContents(&lengthIndex);
     if (rc) {
         return k_FAILURE;                                             // RETURN
     }
@@ -1098,7 +1436,7 @@ BerEncoder::encodeArrayImpl(const TYPE&             value,
         }
     }
 
-    return BerUtil::putEndOfContentOctets(d_streamBuf);
+    return endConstructedContents(lengthIndex);
 }
 
 template <typename TYPE>
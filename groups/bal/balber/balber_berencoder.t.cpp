@@ -2,12 +2,14 @@
 #include <balber_berencoder.h>
 
 #include <balber_berconstants.h>
+#include <balber_berdecoder.h>
 #include <balber_berutil.h>
 
 #include <s_baltst_address.h>
 #include <s_baltst_basicrecord.h>
 #include <s_baltst_bigrecord.h>
 #include <s_baltst_customizedstring.h>
+#include <s_baltst_depthtestmessageutil.h>
 #include <s_baltst_employee.h>
 #include <s_baltst_mychoice.h>
 #include <s_baltst_myenumeration.h>
@@ -19,6 +21,13 @@
 #include <s_baltst_sqrt.h>
 #include <s_baltst_timingrequest.h>
 
+#include <balb_testmessages.h>          // for testing only
+
+#include <balxml_decoder.h>             // for testing only
+#include <balxml_decoderoptions.h>      // for testing only
+#include <balxml_errorinfo.h>           // for testing only
+#include <balxml_minireader.h>          // for testing only
+
 #include <bdlat_attributeinfo.h>
 #include <bdlat_enumeratorinfo.h>
 #include <bdlat_formattingmode.h>
@@ -31,6 +40,10 @@
 #include <bdlb_print.h>
 #include <bdlb_printmethods.h>
 #include <bdlb_string.h>
+#include <bdlbb_blob.h>
+#include <bdlbb_blobstreambuf.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
 #include <bdlsb_fixedmeminstreambuf.h>
 #include <bdlsb_memoutstreambuf.h>
 #include <bdlt_date.h>
@@ -56,6 +69,7 @@
 #include <bsl_iosfwd.h>
 #include <bsl_iostream.h>
 #include <bsl_ostream.h>
+#include <bsl_sstream.h>
 #include <bsl_string.h>
 #include <bsl_vector.h>
 
@@ -91,9 +105,11 @@ using bsl::flush;
 // [12] ARRAYS WITH `encodeEmptyArrays` OPTION {DRQS 29114951 <GO>}
 // [13] ARRAYS WITH `encodeArrayLengthHints` OPTION
 // [14] DATE/TIME COMPONENTS
-// [15] USAGE EXAMPLE
+// [15] DEFINITE-LENGTH ENCODING
+// [16] USAGE EXAMPLE
 //
 // [-1] PERFORMANCE TEST
+// [-2] PERFORMANCE TEST: DEFINITE-LENGTH ENCODING
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -253,6 +269,73 @@ void printDiagnostic(balber::BerEncoder & encoder)
     }
 }
 
+/// Return `true` if the specified `length` octets at the specified `data`
+/// are a sequence of complete BER elements, none of which, at any depth, is
+/// encoded in the indefinite-length form, and `false` otherwise.
+bool isDefiniteLengthEncoding(const char *data, int length)
+{
+    int offset = 0;
+    while (offset < length) {
+        bdlsb::FixedMemInStreamBuf isb(data + offset, length - offset);
+
+        balber::BerConstants::TagClass tagClass;
+        balber::BerConstants::TagType  tagType;
+        int                            tagNumber;
+        int                            contentsLength;
+        int                            headerLength = 0;
+
+        if (0 != balber::BerUtil::getIdentifierOctets(&isb,
+                                                      &tagClass,
+                                                      &tagType,
+                                                      &tagNumber,
+                                                      &headerLength)
+         || 0 != balber::BerUtil::getLength(&isb,
+                                            &contentsLength,
+                                            &headerLength)) {
+            return false;                                             // RETURN
+        }
+
+        if (balber::BerUtil::k_INDEFINITE_LENGTH == contentsLength
+         || length - offset - headerLength < contentsLength) {
+            return false;                                             // RETURN
+        }
+
+        if (balber::BerConstants::e_CONSTRUCTED == tagType
+         && !isDefiniteLengthEncoding(data + offset + headerLength,
+                                      contentsLength)) {
+            return false;                                             // RETURN
+        }
+
+        offset += headerLength + contentsLength;
+    }
+
+    return true;
+}
+
+/// Load into the specified `messages` the `balb::FeatureTestMessage` objects
+/// described by the XML test messages of `s_baltst::DepthTestMessageUtil`.
+void loadFeatureTestMessages(bsl::vector<balb::FeatureTestMessage> *messages)
+{
+    typedef s_baltst::DepthTestMessageUtil DTMU;
+
+    balxml::MiniReader     reader;
+    balxml::ErrorInfo      errorInfo;
+    balxml::DecoderOptions options;
+    options.setSkipUnknownElements(true);
+
+    for (int i = 0; i < DTMU::k_NUM_MESSAGES; ++i) {
+        balxml::Decoder    decoder(&options, &reader, &errorInfo);
+        bsl::istringstream ss(DTMU::s_TEST_MESSAGES[i].d_XML_text_p);
+
+        balb::FeatureTestMessage message;
+
+        const int rc = decoder.decode(ss.rdbuf(), &message);
+        ASSERTV(i, decoder.loggedMessages(), 0 == rc);
+
+        messages->push_back(message);
+    }
+}
+
 // ============================================================================
 //                     GLOBAL HELPER CLASSES FOR TESTING
 // ----------------------------------------------------------------------------
@@ -835,7 +918,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 16: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -857,6 +940,142 @@ int main(int argc, char *argv[])
                              "\n=============\n";
         usageExample();
       } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // DEFINITE-LENGTH ENCODING
+        //
+        // Concerns:
+        // 1. `encodeDefiniteLength` produces an encoding in which no element
+        //    is encoded in the indefinite-length form, and that
+        //    `balber::BerDecoder` decodes to the original value.
+        //
+        // 2. Sequences, choices (tagged and untagged), nullable and nillable
+        //    values, and arrays (with and without length hints) are encoded
+        //    correctly.
+        //
+        // 3. The encodings appended to a `bsl::vector<char>` and to a
+        //    `bdlbb::Blob` are identical whatever the size of the blob
+        //    buffers, and the existing contents of either are preserved.
+        //
+        // 4. If encoding fails, the size of the output is unchanged.
+        //
+        // Plan:
+        // 1. For each `balb::FeatureTestMessage` described by
+        //    `s_baltst::DepthTestMessageUtil` (which together exercise every
+        //    `bdlat` category), and for default options and options enabling
+        //    array length hints, encode the message with
+        //    `encodeDefiniteLength` to a `bsl::vector<char>`, and to blobs
+        //    having buffers of several sizes, each initially holding a
+        //    prefix.  Verify that the prefix is preserved, that the encodings
+        //    are identical and in the definite-length form, and that decoding
+        //    yields the original message.  (C-1..3)
+        //
+        // 2. Attempt to encode a top-level array, which `BerEncoder` does not
+        //    support, and verify that the sizes of the outputs are unchanged.
+        //    (C-4)
+        //
+        // Testing:
+        //   int encodeDefiniteLength(bdlbb::Blob *, const TYPE&);
+        //   int encodeDefiniteLength(bsl::vector<char> *, const TYPE&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nDEFINITE-LENGTH ENCODING"
+                             "\n========================\n";
+
+        bsl::vector<balb::FeatureTestMessage> messages;
+        loadFeatureTestMessages(&messages);
+
+        static const char PREFIX[]    = "prefix";
+        const int         PREFIX_SIZE = sizeof PREFIX - 1;
+
+        const int BUFFER_SIZES[]   = { 1, 7, 256 };
+        const int NUM_BUFFER_SIZES = sizeof BUFFER_SIZES /
+                                                         sizeof *BUFFER_SIZES;
+
+        for (int hints = 0; hints < 2; ++hints) {
+            balber::BerEncoderOptions options;
+            options.setEncodeArrayLengthHints(1 == hints);
+
+            for (bsl::size_t i = 0; i < messages.size(); ++i) {
+                const balb::FeatureTestMessage& MESSAGE = messages[i];
+
+                if (veryVerbose) { T_ P_(hints) P(i) }
+
+                balber::BerEncoder mX(&options);
+
+                bsl::vector<char> buffer(PREFIX, PREFIX + PREFIX_SIZE);
+
+                ASSERTV(hints, i, mX.loggedMessages(),
+                        0 == mX.encodeDefiniteLength(&buffer, MESSAGE));
+                ASSERTV(hints, i,
+                        0 == bsl::memcmp(buffer.data(), PREFIX, PREFIX_SIZE));
+
+                const char *ENCODING = buffer.data() + PREFIX_SIZE;
+                const int   LENGTH   = static_cast<int>(buffer.size()) -
+                                                                   PREFIX_SIZE;
+
+                ASSERTV(hints, i, isDefiniteLengthEncoding(ENCODING, LENGTH));
+
+                bdlsb::MemOutStreamBuf indefinite;
+                ASSERTV(hints, i, 0 == mX.encode(&indefinite, MESSAGE));
+
+                const int INDEFINITE_LENGTH =
+                                        static_cast<int>(indefinite.length());
+                ASSERTV(hints, i,
+                        !isDefiniteLengthEncoding(indefinite.data(),
+                                                  INDEFINITE_LENGTH));
+
+                balber::BerDecoder         decoder;
+                bdlsb::FixedMemInStreamBuf isb(ENCODING, LENGTH);
+                balb::FeatureTestMessage   decoded;
+
+                ASSERTV(hints, i, decoder.loggedMessages(),
+                        0 == decoder.decode(&isb, &decoded));
+                ASSERTV(hints, i, 0 == isb.length());
+                ASSERTV(hints, i, MESSAGE == decoded);
+
+                for (int j = 0; j < NUM_BUFFER_SIZES; ++j) {
+                    const int BUFFER_SIZE = BUFFER_SIZES[j];
+
+                    bdlbb::PooledBlobBufferFactory factory(BUFFER_SIZE);
+                    bdlbb::Blob                    blob(&factory);
+
+                    bdlbb::BlobUtil::append(&blob, PREFIX, PREFIX_SIZE);
+
+                    ASSERTV(hints, i, BUFFER_SIZE,
+                            0 == mX.encodeDefiniteLength(&blob, MESSAGE));
+                    ASSERTV(hints, i, BUFFER_SIZE, blob.length(),
+                            PREFIX_SIZE + LENGTH == blob.length());
+
+                    bsl::vector<char> contents(blob.length());
+                    bdlbb::BlobUtil::copy(contents.data(),
+                                          blob,
+                                          0,
+                                          blob.length());
+
+                    ASSERTV(hints, i, BUFFER_SIZE, buffer == contents);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting failure." << endl;
+        {
+            const bsl::vector<int> ARRAY(3, 1);
+
+            balber::BerEncoder mX;
+
+            bsl::vector<char> buffer(PREFIX, PREFIX + PREFIX_SIZE);
+            ASSERT(0           != mX.encodeDefiniteLength(&buffer, ARRAY));
+            ASSERT(PREFIX_SIZE == static_cast<int>(buffer.size()));
+
+            bdlbb::PooledBlobBufferFactory factory(4);
+            bdlbb::Blob                    blob(&factory);
+            bdlbb::BlobUtil::append(&blob, PREFIX, PREFIX_SIZE);
+
+            ASSERT(0           != mX.encodeDefiniteLength(&blob, ARRAY));
+            ASSERT(PREFIX_SIZE == blob.length());
+        }
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // DATE/TIME COMPONENTS
@@ -4192,6 +4411,114 @@ int main(int argc, char *argv[])
                   << (reps / elapsed) << " reps/sec, "
                   << osb.length()     << " bytes" << bsl::endl;
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: DEFINITE-LENGTH ENCODING
+        //   Compare the time taken by `encode`, writing to a
+        //   `bdlsb::MemOutStreamBuf` and to a `bdlbb::OutBlobStreamBuf`, with
+        //   that taken by `encodeDefiniteLength`, writing to a
+        //   `bsl::vector<char>` and to a `bdlbb::Blob`, for the
+        //   `balb::FeatureTestMessage` objects described by
+        //   `s_baltst::DepthTestMessageUtil`, and for a `TimingRequest`
+        //   holding a big record.  The number of iterations may be specified
+        //   as the second command-line argument.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE TEST: DEFINITE-LENGTH ENCODING"
+                             "\n==========================================\n";
+
+        const int NUM_ITERATIONS = argc > 2 ? bsl::atoi(argv[2]) : 1000;
+
+        bsl::vector<balb::FeatureTestMessage> messages;
+        loadFeatureTestMessages(&messages);
+
+        test::BasicRecord basicRec;
+        basicRec.i1() = 11;
+        basicRec.i2() = 22;
+        basicRec.dt() = bdlt::DatetimeTz(
+                                    bdlt::Datetime(bdlt::Date(2007, 9, 3),
+                                                   bdlt::Time(16, 30)),
+                                    0);
+        basicRec.s() = "The quick brown fox jumped over the lazy dog.";
+
+        test::BigRecord bigRec;
+        bigRec.name() = "This record is so big, it has its own gravity.";
+        bigRec.array().resize(200, basicRec);
+
+        test::TimingRequest request;
+        request.makeBig(bigRec);
+
+        bdlbb::PooledBlobBufferFactory factory(4096);
+        balber::BerEncoder             encoder;
+
+        for (int mode = 0; mode < 4; ++mode) {
+            static const char *const NAMES[] = {
+                "encode, MemOutStreamBuf",
+                "encode, OutBlobStreamBuf",
+                "encodeDefiniteLength, vector<char>",
+                "encodeDefiniteLength, Blob"
+            };
+
+            for (int big = 0; big < 2; ++big) {
+                bsls::Types::Int64 numBytes = 0;
+
+                bsls::Stopwatch stopwatch;
+                stopwatch.start();
+
+                for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                    const bsl::size_t numMessages = big ? 1 : messages.size();
+
+                    for (bsl::size_t j = 0; j < numMessages; ++j) {
+                        int rc = -1;
+
+                        switch (mode) {
+                          case 0: {
+                            bdlsb::MemOutStreamBuf osb;
+                            rc = big ? encoder.encode(&osb, request)
+                                     : encoder.encode(&osb, messages[j]);
+                            numBytes += osb.length();
+                          } break;
+                          case 1: {
+                            bdlbb::Blob blob(&factory);
+                            {
+                                bdlbb::OutBlobStreamBuf osb(&blob);
+                                rc = big ? encoder.encode(&osb, request)
+                                         : encoder.encode(&osb, messages[j]);
+                            }
+                            numBytes += blob.length();
+                          } break;
+                          case 2: {
+                            bsl::vector<char> buffer;
+                            rc = big
+                               ? encoder.encodeDefiniteLength(&buffer, request)
+                               : encoder.encodeDefiniteLength(&buffer,
+                                                              messages[j]);
+                            numBytes += buffer.size();
+                          } break;
+                          case 3: {
+                            bdlbb::Blob blob(&factory);
+                            rc = big
+                               ? encoder.encodeDefiniteLength(&blob, request)
+                               : encoder.encodeDefiniteLength(&blob,
+                                                              messages[j]);
+                            numBytes += blob.length();
+                          } break;
+                        }
+
+                        ASSERTV(mode, big, j, 0 == rc);
+                    }
+                }
+
+                stopwatch.stop();
+
+                cout << NAMES[mode] << (big ? ", big record: "
+                                            : ", FeatureTestMessage: ")
+                     << stopwatch.accumulatedWallTime() << " seconds, "
+                     << numBytes / NUM_ITERATIONS << " bytes per iteration"
+                     << endl;
+            }
+        }
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
         testStatus = -1;
@@ -0,0 +1,389 @@
+// balber_berincrementaldecoder.cpp                                   -*-C++-*-
+#include <balber_berincrementaldecoder.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balber_berincrementaldecoder_cpp,"$Id$ $CSID$")
+
+#include <balber_berconstants.h>
+
+#include <bdlbb_blobutil.h>
+
+#include <bsl_climits.h>
+#include <bsl_utility.h>
+
+///Implementation Notes
+///--------------------
+// `scan` examines the elements of the next message in order, one element
+// header (identifier and length octets) at a time.  A header is examined only
+// once all of its octets are available, so that `d_scanOffset` always
+// designates the first octet of an element (or, if the contents of the last
+// element examined have not fully arrived, the octet following them).  Each
+// call to `scan` locates the buffer holding `d_scanOffset` once, and then
+// walks the buffers of `d_data` sequentially.
+//
+// The contents of a primitive element, and of a constructed element encoded
+// in the definite-length form, are skipped without being examined.  The
+// contents of a constructed element encoded in the indefinite-length form
+// are examined, as its extent is known only from the end-of-contents octets
+// that follow its last nested element.
+
+namespace BloombergLP {
+namespace balber {
+namespace {
+namespace u {
+
+/// The maximum number of subsequent identifier octets accepted for a tag
+/// number encoded in the high-tag-number form (enough for any `int`).
+const int k_MAX_TAG_NUMBER_OCTETS = 5;
+
+/// The maximum number of subsequent length octets accepted for a length
+/// encoded in the long form (enough for any `int`).
+const int k_MAX_LENGTH_OCTETS = 4;
+
+/// The value of the first length octet of an element encoded in the
+/// indefinite-length form.
+const unsigned char k_INDEFINITE_LENGTH_OCTET = 0x80;
+
+/// The bits of the first identifier octet holding the tag number.
+const unsigned char k_TAG_NUMBER_MASK = 0x1F;
+
+/// The bit of each octet, other than the last, of a tag number encoded in the
+/// high-tag-number form.
+const unsigned char k_MORE_OCTETS_BIT = 0x80;
+
+                             // =================
+                             // class OctetCursor
+                             // =================
+
+/// This class provides sequential access to the octets of a blob, starting
+/// at an offset supplied at construction.
+class OctetCursor {
+
+    // DATA
+    const bdlbb::Blob *d_blob_p;        // blob being read (held, not owned)
+    int                d_bufferIndex;   // index of the current buffer
+    int                d_bufferOffset;  // offset in the current buffer
+    int                d_numRemaining;  // octets from the cursor to the end
+
+  public:
+    // CREATORS
+
+    /// Create a cursor designating the octet at the specified `offset` of
+    /// the specified `blob`.  The behavior is undefined unless
+    /// `0 <= offset <= blob.length()`.
+    OctetCursor(const bdlbb::Blob& blob, int offset)
+    : d_blob_p(&blob)
+    , d_bufferIndex(0)
+    , d_bufferOffset(0)
+    , d_numRemaining(blob.length() - offset)
+    {
+        BSLS_ASSERT(0 <= offset);
+        BSLS_ASSERT(offset <= blob.length());
+
+        if (0 < d_numRemaining) {
+            const bsl::pair<int, int> place =
+                      bdlbb::BlobUtil::findBufferIndexAndOffset(blob, offset);
+            d_bufferIndex  = place.first;
+            d_bufferOffset = place.second;
+        }
+    }
+
+    // MANIPULATORS
+
+    /// Load the octet designated by this cursor into the specified `octet`
+    /// and advance this cursor by one octet.  Return `true` on success, and
+    /// `false`, with no effect, if this cursor is at the end of the blob.
+    bool readOctet(unsigned char *octet)
+    {
+        if (0 == d_numRemaining) {
+            return false;                                             // RETURN
+        }
+
+        while (d_bufferOffset == d_blob_p->buffer(d_bufferIndex).size()) {
+            ++d_bufferIndex;
+            d_bufferOffset = 0;
+        }
+
+        *octet = static_cast<unsigned char>(
+                    d_blob_p->buffer(d_bufferIndex).data()[d_bufferOffset]);
+        ++d_bufferOffset;
+        --d_numRemaining;
+        return true;
+    }
+
+    /// Advance this cursor by the specified `numOctets`.  The behavior is
+    /// undefined unless `0 <= numOctets <= numRemaining()`.
+    void skip(int numOctets)
+    {
+        BSLS_ASSERT(0 <= numOctets);
+        BSLS_ASSERT(numOctets <= d_numRemaining);
+
+        d_numRemaining -= numOctets;
+        while (0 < numOctets) {
+            const int available = d_blob_p->buffer(d_bufferIndex).size() -
+                                                                d_bufferOffset;
+            if (numOctets < available) {
+                d_bufferOffset += numOctets;
+                return;                                               // RETURN
+            }
+            numOctets      -= available;
+            d_bufferOffset  = 0;
+            ++d_bufferIndex;
+        }
+    }
+
+    // ACCESSORS
+
+    /// Return the number of octets from this cursor to the end of the blob.
+    int numRemaining() const
+    {
+        return d_numRemaining;
+    }
+};
+
+/// Read, from the specified `cursor`, the header of a BER element, and load
+/// into the specified `isConstructed` whether the element is constructed,
+/// into the specified `isEndOfContents` whether the header is an
+/// end-of-contents marker, and into the specified `length` the length of
+/// the contents of the element, or -1 if it is encoded in the
+/// indefinite-length form.  Return 0 on success, `e_NEED_MORE_DATA` if the
+/// header is incomplete, and a negative value if the header is invalid.
+/// `cursor` is left at an unspecified position unless 0 is returned.
+int readHeader(bool        *isConstructed,
+               bool        *isEndOfContents,
+               int         *length,
+               OctetCursor *cursor)
+{
+    const int k_NEED_MORE_DATA = BerIncrementalDecoder::e_NEED_MORE_DATA;
+
+    unsigned char identifier;
+    if (!cursor->readOctet(&identifier)) {
+        return k_NEED_MORE_DATA;                                      // RETURN
+    }
+
+    if (k_TAG_NUMBER_MASK == (identifier & k_TAG_NUMBER_MASK)) {
+        unsigned char octet          = k_MORE_OCTETS_BIT;
+        int           numExtraOctets = 0;
+
+        while (octet & k_MORE_OCTETS_BIT) {
+            if (k_MAX_TAG_NUMBER_OCTETS == numExtraOctets) {
+                return -1;                                            // RETURN
+            }
+            if (!cursor->readOctet(&octet)) {
+                return k_NEED_MORE_DATA;                              // RETURN
+            }
+            ++numExtraOctets;
+        }
+    }
+
+    unsigned char lengthOctet;
+    if (!cursor->readOctet(&lengthOctet)) {
+        return k_NEED_MORE_DATA;                                      // RETURN
+    }
+
+    *isConstructed   = 0 != (identifier & BerConstants::e_CONSTRUCTED);
+    *isEndOfContents = 0 == identifier;
+
+    if (*isEndOfContents) {
+        if (0 != lengthOctet) {
+            return -1;                                                // RETURN
+        }
+        *length = 0;
+        return 0;                                                     // RETURN
+    }
+
+    if (k_INDEFINITE_LENGTH_OCTET == lengthOctet) {
+        if (!*isConstructed) {
+            return -1;                                                // RETURN
+        }
+        *length = -1;
+        return 0;                                                     // RETURN
+    }
+
+    if (!(lengthOctet & k_INDEFINITE_LENGTH_OCTET)) {
+        *length = lengthOctet;
+        return 0;                                                     // RETURN
+    }
+
+    const int numLengthOctets = lengthOctet & ~k_INDEFINITE_LENGTH_OCTET;
+    if (k_MAX_LENGTH_OCTETS < numLengthOctets) {
+        return -1;                                                    // RETURN
+    }
+
+    unsigned int value = 0;
+    for (int i = 0; i < numLengthOctets; ++i) {
+        unsigned char octet;
+        if (!cursor->readOctet(&octet)) {
+            return k_NEED_MORE_DATA;                                  // RETURN
+        }
+        value = (value << 8) | octet;
+    }
+
+    if (static_cast<unsigned int>(INT_MAX) < value) {
+        return -1;                                                    // RETURN
+    }
+
+    *length = static_cast<int>(value);
+    return 0;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                        // ---------------------------
+                        // class BerIncrementalDecoder
+                        // ---------------------------
+
+// PRIVATE MANIPULATORS
+int BerIncrementalDecoder::consumeMessage(int            decodeStatus,
+                                          bsl::streamoff numBytesConsumed)
+{
+    BSLS_ASSERT(0 <= d_messageLength);
+    BSLS_ASSERT(d_messageLength <= d_data.length());
+
+    bdlbb::BlobUtil::erase(&d_data, 0, d_messageLength);
+
+    const bool isComplete = numBytesConsumed == d_messageLength;
+
+    d_scanOffset    = 0;
+    d_depth         = 0;
+    d_messageLength = -1;
+
+    return 0 == decodeStatus && isComplete ? 0 : -1;
+}
+
+int BerIncrementalDecoder::scan()
+{
+    if (!d_isValid) {
+        return -1;                                                    // RETURN
+    }
+
+    if (0 <= d_messageLength) {
+        return d_messageLength <= d_data.length() ? 0 : e_NEED_MORE_DATA;
+                                                                      // RETURN
+    }
+
+    if (d_data.length() <= d_scanOffset) {
+        return e_NEED_MORE_DATA;                                      // RETURN
+    }
+
+    const int maxDepth = d_options_p
+                       ? d_options_p->maxDepth()
+                       : BerDecoderOptions::DEFAULT_MAX_DEPTH;
+
+    u::OctetCursor cursor(d_data, d_scanOffset);
+
+    while (0 < cursor.numRemaining()) {
+        u::OctetCursor next(cursor);
+
+        bool isConstructed;
+        bool isEndOfContents;
+        int  length;
+
+        const int rc = u::readHeader(&isConstructed,
+                                     &isEndOfContents,
+                                     &length,
+                                     &next);
+        if (e_NEED_MORE_DATA == rc) {
+            return rc;                                                // RETURN
+        }
+
+        if (0 != rc) {
+            d_isValid = false;
+            return rc;                                                // RETURN
+        }
+
+        const int headerLength = cursor.numRemaining() - next.numRemaining();
+        const int headerEnd    = d_scanOffset + headerLength;
+
+        if (isEndOfContents) {
+            if (0 == d_depth) {
+                d_isValid = false;
+                return -1;                                            // RETURN
+            }
+            --d_depth;
+        }
+        else if (length < 0) {
+            if (maxDepth <= d_depth) {
+                d_isValid = false;
+                return -1;                                            // RETURN
+            }
+            ++d_depth;
+        }
+        else if (INT_MAX - headerEnd < length) {
+            d_isValid = false;
+            return -1;                                                // RETURN
+        }
+
+        const int contentsLength = length < 0 ? 0 : length;
+
+        d_scanOffset = headerEnd + contentsLength;
+
+        if (0 == d_depth) {
+            d_messageLength = d_scanOffset;
+            return d_messageLength <= d_data.length() ? 0 : e_NEED_MORE_DATA;
+                                                                      // RETURN
+        }
+
+        if (next.numRemaining() < contentsLength) {
+            return e_NEED_MORE_DATA;                                  // RETURN
+        }
+
+        next.skip(contentsLength);
+        cursor = next;
+    }
+
+    return e_NEED_MORE_DATA;
+}
+
+// CREATORS
+BerIncrementalDecoder::BerIncrementalDecoder(
+                                      const BerDecoderOptions *options,
+                                      bslma::Allocator        *basicAllocator)
+: d_options_p(options)
+, d_decoder(options, basicAllocator)
+, d_data(basicAllocator)
+, d_scanOffset(0)
+, d_depth(0)
+, d_messageLength(-1)
+, d_isValid(true)
+{
+}
+
+BerIncrementalDecoder::~BerIncrementalDecoder()
+{
+}
+
+// MANIPULATORS
+void BerIncrementalDecoder::appendData(const bdlbb::Blob& data)
+{
+    bdlbb::BlobUtil::append(&d_data, data);
+}
+
+void BerIncrementalDecoder::reset()
+{
+    d_data.removeAll();
+    d_scanOffset    = 0;
+    d_depth         = 0;
+    d_messageLength = -1;
+    d_isValid       = true;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
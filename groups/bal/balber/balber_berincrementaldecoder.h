@@ -0,0 +1,333 @@
+// balber_berincrementaldecoder.h                                     -*-C++-*-
+#ifndef INCLUDED_BALBER_BERINCREMENTALDECODER
+#define INCLUDED_BALBER_BERINCREMENTALDECODER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a BER decoder that accepts its input in arbitrary chunks.
+//
+//@CLASSES:
+//  balber::BerIncrementalDecoder: BER decoder for incrementally arriving data
+//
+//@SEE_ALSO: balber_berdecoder, bdlbb_blob
+//
+//@DESCRIPTION: This component defines a single class,
+// `balber::BerIncrementalDecoder`, that decodes a sequence of BER-encoded
+// messages whose octets arrive in chunks of arbitrary size, for example as
+// they are read from a socket.  Each chunk is supplied, as a `bdlbb::Blob`,
+// to the `appendData` method, and the `decode` method is called to decode the
+// next message.  `decode` returns `e_NEED_MORE_DATA` until all octets of the
+// next message are available, and then decodes that message, by means of a
+// `balber::BerDecoder`, into an object of a `bdlat`-compatible type.
+//
+// The buffers of each blob supplied to `appendData` are shared, not copied:
+// the decoder reads the message directly from the buffers in which it
+// arrived, which may therefore be split across chunks at any octet, and no
+// contiguous copy of the message is ever made.  The buffers of a message are
+// released once that message has been decoded.
+//
+///Incremental Framing
+///-------------------
+// Determining whether the next message is complete requires the decoder to
+// follow the BER framing of that message: the identifier and length octets
+// of each element and, for an element encoded in the indefinite-length form
+// (as `balber::BerEncoder` encodes constructed elements), the end-of-contents
+// octets closing it.  The state of this scan -- the offset of the next
+// element to examine and the number of indefinite-length elements that
+// enclose it -- is retained between calls, so that each octet of the input
+// is scanned once no matter how many chunks it arrives in.  The contents of
+// an element encoded in the definite-length form are skipped, and need not
+// have arrived before the elements following it are scanned.
+//
+// An error in the framing of the input (e.g., a length that does not fit in
+// an `int`, or indefinite-length elements nested more deeply than the
+// `maxDepth` option) leaves the decoder unable to locate any subsequent
+// message: every later call to `decode` fails until `reset` is called.  An
+// error in decoding a correctly framed message, on the other hand, discards
+// only that message, and the decoder remains usable for the messages that
+// follow it.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Decoding Messages Received in Fragments
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a stream of BER-encoded messages, each holding a string, is
+// received over a network connection that may deliver any part of a message
+// at a time.
+//
+// First, we encode two messages into a blob, standing in for the data
+// written by the peer:
+// ```
+// const bsl::string first("Hello");
+// const bsl::string second(200, 'x');
+//
+// bdlbb::PooledBlobBufferFactory factory(8);
+// bdlbb::Blob                    sent(&factory);
+// bdlbb::OutBlobStreamBuf        osb(&sent);
+//
+// balber::BerEncoder encoder;
+// int                rc = encoder.encode(&osb, first);
+// assert(0 == rc);
+// rc = encoder.encode(&osb, second);
+// assert(0 == rc);
+// osb.pubsync();
+// ```
+// Then, we create a `balber::BerIncrementalDecoder`:
+// ```
+// balber::BerIncrementalDecoder decoder;
+// ```
+// Next, we supply the data to the decoder in chunks of 5 octets, as it might
+// be read from the connection, and decode each message as soon as all of its
+// octets have arrived:
+// ```
+// bsl::vector<bsl::string> received;
+//
+// for (int offset = 0; offset < sent.length(); offset += 5) {
+//     bdlbb::Blob chunk(&factory);
+//     bdlbb::BlobUtil::append(&chunk,
+//                             sent,
+//                             offset,
+//                             bsl::min(5, sent.length() - offset));
+//
+//     decoder.appendData(chunk);
+//
+//     bsl::string value;
+//     while (0 == (rc = decoder.decode(&value))) {
+//         received.push_back(value);
+//     }
+//     assert(balber::BerIncrementalDecoder::e_NEED_MORE_DATA == rc);
+// }
+// ```
+// Finally, we verify that both messages were decoded, and that no input
+// remains buffered:
+// ```
+// assert(2      == received.size());
+// assert(first  == received[0]);
+// assert(second == received[1]);
+// assert(0      == decoder.numBytesBuffered());
+// ```
+
+#include <balscm_version.h>
+
+#include <balber_berdecoder.h>
+#include <balber_berdecoderoptions.h>
+
+#include <bdlbb_blob.h>
+#include <bdlbb_blobstreambuf.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_ios.h>
+
+namespace BloombergLP {
+namespace balber {
+
+                        // ===========================
+                        // class BerIncrementalDecoder
+                        // ===========================
+
+/// This class decodes a sequence of BER-encoded messages supplied as a
+/// series of blobs of arbitrary length.  The buffers of the supplied blobs
+/// are shared by this object until the messages they hold are decoded.  See
+/// {Incremental Framing} for a description of the state retained between
+/// calls.
+class BerIncrementalDecoder {
+
+  public:
+    // PUBLIC TYPES
+    enum Status {
+        e_SUCCESS        = 0,  // a message was decoded
+        e_NEED_MORE_DATA = 1   // the next message is not yet complete
+    };
+
+  private:
+    // DATA
+    const BerDecoderOptions *d_options_p;      // held, not owned (may be 0)
+    BerDecoder               d_decoder;        // decoder of each message
+    bdlbb::Blob              d_data;           // input not yet decoded
+    int                      d_scanOffset;     // offset in `d_data` of the
+                                               // next element to scan
+
+    int                      d_depth;          // number of indefinite-length
+                                               // elements enclosing the
+                                               // element at `d_scanOffset`
+
+    int                      d_messageLength;  // length of the next message,
+                                               // or -1 if not yet known
+
+    bool                     d_isValid;        // `false` after a framing
+                                               // error
+
+  private:
+    // NOT IMPLEMENTED
+    BerIncrementalDecoder(const BerIncrementalDecoder&);
+    BerIncrementalDecoder& operator=(const BerIncrementalDecoder&);
+
+    // PRIVATE MANIPULATORS
+
+    /// Discard the next message, whose decoding returned the specified
+    /// `decodeStatus` after consuming the specified `numBytesConsumed`
+    /// octets, and reset the framing state to scan the message following
+    /// it.  Return 0 if `decodeStatus` is 0 and the whole message was
+    /// consumed, and a negative value otherwise.
+    int consumeMessage(int decodeStatus, bsl::streamoff numBytesConsumed);
+
+    /// Continue scanning the framing of the next message from the point at
+    /// which the previous call left off.  Return 0 if all octets of the
+    /// next message are available, `e_NEED_MORE_DATA` if more input is
+    /// required to complete the message, and a negative value if the input
+    /// is not a valid BER encoding or a previous call failed.
+    int scan();
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(BerIncrementalDecoder,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+
+    /// Create a decoder having no buffered input.  Optionally specify
+    /// decoder `options`.  If `options` is 0, `BerDecoderOptions()` is used.
+    /// Optionally specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.  The behavior is undefined unless `options`, if not 0, remains
+    /// valid throughout the lifetime of this object.
+    explicit BerIncrementalDecoder(
+                              const BerDecoderOptions *options        = 0,
+                              bslma::Allocator        *basicAllocator = 0);
+
+    /// Destroy this object, releasing any buffers it shares.
+    ~BerIncrementalDecoder();
+
+    // MANIPULATORS
+
+    /// Append the octets of the specified `data` to the input of this
+    /// decoder.  The buffers of `data` are shared, not copied; the behavior
+    /// is undefined if the octets they hold are modified before the messages
+    /// containing them have been decoded.
+    void appendData(const bdlbb::Blob& data);
+
+    /// Decode the next message of the input of this decoder into the
+    /// specified `value`, and remove that message from the input.  Return
+    /// 0 on success, `e_NEED_MORE_DATA`, leaving `value` unchanged, if the
+    /// input does not yet hold all octets of the next message, and a
+    /// negative value otherwise.  If the input is not a valid BER framing,
+    /// this and every subsequent call fails until `reset` is called;
+    /// otherwise, a failure to decode the message discards only that
+    /// message.  Note that the log of the most recent decoding operation is
+    /// available from `decoder().loggedMessages()`.
+    template <class TYPE>
+    int decode(TYPE *value);
+
+    /// Discard all buffered input and any framing error, returning this
+    /// decoder to its default-constructed state.
+    void reset();
+
+    // ACCESSORS
+
+    /// Return a reference providing non-modifiable access to the decoder
+    /// used to decode each message.
+    const BerDecoder& decoder() const;
+
+    /// Return `true` if the input of this decoder has not been found to be
+    /// incorrectly framed, and `false` otherwise.
+    bool isValid() const;
+
+    /// Return the number of octets appended to this decoder that have not
+    /// yet been removed by `decode`.
+    int numBytesBuffered() const;
+
+                                  // Aspects
+
+    /// Return the allocator used by this object to supply memory.
+    bslma::Allocator *allocator() const;
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                        // ---------------------------
+                        // class BerIncrementalDecoder
+                        // ---------------------------
+
+// MANIPULATORS
+template <class TYPE>
+int BerIncrementalDecoder::decode(TYPE *value)
+{
+    BSLS_ASSERT(value);
+
+    const int rc = scan();
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    int            decodeStatus;
+    bsl::streamoff numBytesConsumed;
+    {
+        bdlbb::InBlobStreamBuf streamBuf(&d_data);
+
+        decodeStatus     = d_decoder.decode(&streamBuf, value);
+        numBytesConsumed = streamBuf.pubseekoff(0,
+                                                bsl::ios_base::cur,
+                                                bsl::ios_base::in);
+    }
+
+    return consumeMessage(decodeStatus, numBytesConsumed);
+}
+
+// ACCESSORS
+inline
+const BerDecoder& BerIncrementalDecoder::decoder() const
+{
+    return d_decoder;
+}
+
+inline
+bool BerIncrementalDecoder::isValid() const
+{
+    return d_isValid;
+}
+
+inline
+int BerIncrementalDecoder::numBytesBuffered() const
+{
+    return d_data.length();
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *BerIncrementalDecoder::allocator() const
+{
+    return d_data.allocator();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
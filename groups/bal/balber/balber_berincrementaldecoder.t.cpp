@@ -0,0 +1,812 @@
+// balber_berincrementaldecoder.t.cpp                                 -*-C++-*-
+#include <balber_berincrementaldecoder.h>
+
+#include <balber_berdecoderoptions.h>
+#include <balber_berencoder.h>
+
+#include <s_baltst_mysequence.h>
+#include <s_baltst_mysequencewitharray.h>
+
+#include <bdlbb_blob.h>
+#include <bdlbb_blobstreambuf.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The class under test, `balber::BerIncrementalDecoder`, accumulates input
+// supplied in chunks and decodes each BER-encoded message once all of its
+// octets are available.  The bulk of the testing concerns the resumable scan
+// of the BER framing: for a table of encodings, the input is supplied in
+// chunks of every size, and the message is verified to be recognized exactly
+// when its last octet arrives, and not to consume any octet beyond it.
+// Values of several `bdlat` types are then round-tripped through
+// `balber::BerEncoder` and this decoder, again for every chunk size.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 1] BerIncrementalDecoder(const BerDecoderOptions *, Allocator * = 0);
+// [ 1] ~BerIncrementalDecoder();
+//
+// MANIPULATORS
+// [ 1] void appendData(const bdlbb::Blob& data);
+// [ 2] int decode(TYPE *value);
+// [ 3] void reset();
+//
+// ACCESSORS
+// [ 1] const BerDecoder& decoder() const;
+// [ 2] bool isValid() const;
+// [ 1] int numBytesBuffered() const;
+// [ 1] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] FRAMING IS RECOGNIZED ACROSS CHUNKS
+// [ 3] ERRORS AND RECOVERY
+// [ 4] DECODING VALUES SPLIT ACROSS CHUNKS
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balber::BerIncrementalDecoder Obj;
+
+const int k_NEED_MORE_DATA = Obj::e_NEED_MORE_DATA;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// Append to the specified `result` the octets described by the specified
+/// `spec`, a sequence of two-digit hexadecimal numbers separated by spaces,
+/// followed by the specified `numFillOctets` zero octets.
+void appendSpec(bsl::vector<char> *result, const char *spec, int numFillOctets)
+{
+    while (*spec) {
+        if (' ' == *spec) {
+            ++spec;
+            continue;
+        }
+        char *end;
+        const long octet = bsl::strtol(spec, &end, 16);
+        ASSERT(end == spec + 2);
+        result->push_back(static_cast<char>(octet));
+        spec = end;
+    }
+    result->insert(result->end(), numFillOctets, 0);
+}
+
+/// Append to the specified `result` the BER encoding of the specified
+/// `value`.
+template <class TYPE>
+void appendEncoding(bsl::vector<char> *result, const TYPE& value)
+{
+    bdlsb::MemOutStreamBuf osb;
+    balber::BerEncoder     encoder;
+
+    const int rc = encoder.encode(&osb, value);
+    ASSERTV(rc, 0 == rc);
+
+    result->insert(result->end(), osb.data(), osb.data() + osb.length());
+}
+
+/// Supply to the specified `decoder` the specified `length` octets at the
+/// specified `offset` of the specified `data`, as a blob whose buffers are
+/// supplied by the specified `factory`.
+void appendChunk(Obj                      *decoder,
+                 const bsl::vector<char>&  data,
+                 int                       offset,
+                 int                       length,
+                 bdlbb::BlobBufferFactory *factory)
+{
+    bdlbb::Blob chunk(factory);
+    bdlbb::BlobUtil::append(&chunk, data.data() + offset, length);
+    decoder->appendData(chunk);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;  (void) veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Decoding Messages Received in Fragments
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a stream of BER-encoded messages, each holding a string, is
+// received over a network connection that may deliver any part of a message
+// at a time.
+//
+// First, we encode two messages into a blob, standing in for the data
+// written by the peer:
+// ```
+    const bsl::string first("Hello");
+    const bsl::string second(200, 'x');
+
+    bdlbb::PooledBlobBufferFactory factory(8);
+    bdlbb::Blob                    sent(&factory);
+    bdlbb::OutBlobStreamBuf        osb(&sent);
+
+    balber::BerEncoder encoder;
+    int                rc = encoder.encode(&osb, first);
+    ASSERT(0 == rc);
+    rc = encoder.encode(&osb, second);
+    ASSERT(0 == rc);
+    osb.pubsync();
+// ```
+// Then, we create a `balber::BerIncrementalDecoder`:
+// ```
+    balber::BerIncrementalDecoder decoder;
+// ```
+// Next, we supply the data to the decoder in chunks of 5 octets, as it might
+// be read from the connection, and decode each message as soon as all of its
+// octets have arrived:
+// ```
+    bsl::vector<bsl::string> received;
+
+    for (int offset = 0; offset < sent.length(); offset += 5) {
+        bdlbb::Blob chunk(&factory);
+        bdlbb::BlobUtil::append(&chunk,
+                                sent,
+                                offset,
+                                bsl::min(5, sent.length() - offset));
+
+        decoder.appendData(chunk);
+
+        bsl::string value;
+        while (0 == (rc = decoder.decode(&value))) {
+            received.push_back(value);
+        }
+        ASSERT(balber::BerIncrementalDecoder::e_NEED_MORE_DATA == rc);
+    }
+// ```
+// Finally, we verify that both messages were decoded, and that no input
+// remains buffered:
+// ```
+    ASSERT(2      == received.size());
+    ASSERT(first  == received[0]);
+    ASSERT(second == received[1]);
+    ASSERT(0      == decoder.numBytesBuffered());
+// ```
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // DECODING VALUES SPLIT ACROSS CHUNKS
+        //
+        // Concerns:
+        // 1. A value encoded by `balber::BerEncoder` is decoded to the
+        //    original value however its encoding is divided into chunks, and
+        //    however many messages a chunk holds.
+        //
+        // 2. The octets of a message are not copied by the decoder: the
+        //    memory it allocates does not grow with the size of a message.
+        //
+        // Plan:
+        // 1. Encode a sequence of values of several types, including values
+        //    whose encodings use the long form of the length octets.
+        //
+        // 2. For each chunk size from 1 to the length of the encoding, supply
+        //    the encoding in chunks of that size, calling `decode` for the
+        //    next expected value after each chunk until it returns
+        //    `e_NEED_MORE_DATA`.  Verify that each value is decoded once all
+        //    of its octets are supplied, and compare it with the original.
+        //    (C-1)
+        //
+        // 3. Decode a 64KB `bsl::vector<char>` supplied in a single blob of
+        //    1KB buffers, and verify that the decoder allocates less than the
+        //    size of the message.  (C-2)
+        //
+        // Testing:
+        //   int decode(TYPE *value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DECODING VALUES SPLIT ACROSS CHUNKS" << endl
+                          << "===================================" << endl;
+
+        bslma::TestAllocator           ta("test", veryVeryVerbose);
+        bdlbb::PooledBlobBufferFactory factory(4, &ta);
+
+        s_baltst::MySequenceWithArray smallArray;
+        smallArray.attribute1() = -1;
+        smallArray.attribute2().push_back("one");
+        smallArray.attribute2().push_back("two");
+
+        s_baltst::MySequenceWithArray largeArray;
+        largeArray.attribute1() = 123456;
+        largeArray.attribute2().resize(200, "element");
+
+        const bsl::string longString(300, 'x');
+
+        s_baltst::MySequence sequence;
+        sequence.attribute1() = 17;
+        sequence.attribute2() = "seventeen";
+
+        bsl::vector<char> data;
+        bsl::vector<int>  messageEnds;
+
+        appendEncoding(&data, smallArray);
+        messageEnds.push_back(static_cast<int>(data.size()));
+        appendEncoding(&data, sequence);
+        messageEnds.push_back(static_cast<int>(data.size()));
+        appendEncoding(&data, longString);
+        messageEnds.push_back(static_cast<int>(data.size()));
+        appendEncoding(&data, largeArray);
+        messageEnds.push_back(static_cast<int>(data.size()));
+
+        const int LENGTH = static_cast<int>(data.size());
+
+        if (veryVerbose) { T_ P(LENGTH) }
+
+        for (int chunkSize = 1; chunkSize <= LENGTH; ++chunkSize) {
+            Obj mX(0, &ta);  const Obj& X = mX;
+
+            int numDecoded = 0;
+            int numFed     = 0;
+
+            while (numFed < LENGTH) {
+                const int n = bsl::min(chunkSize, LENGTH - numFed);
+                appendChunk(&mX, data, numFed, n, &factory);
+                numFed += n;
+
+                int rc = 0;
+                while (0 == rc && numDecoded < 4) {
+                    switch (numDecoded) {
+                      case 0: {
+                        s_baltst::MySequenceWithArray value(&ta);
+                        rc = mX.decode(&value);
+                        if (0 == rc) {
+                            ASSERTV(chunkSize, smallArray == value);
+                        }
+                      } break;
+                      case 1: {
+                        s_baltst::MySequence value(&ta);
+                        rc = mX.decode(&value);
+                        if (0 == rc) {
+                            ASSERTV(chunkSize, sequence == value);
+                        }
+                      } break;
+                      case 2: {
+                        bsl::string value(&ta);
+                        rc = mX.decode(&value);
+                        if (0 == rc) {
+                            ASSERTV(chunkSize, longString == value);
+                        }
+                      } break;
+                      case 3: {
+                        s_baltst::MySequenceWithArray value(&ta);
+                        rc = mX.decode(&value);
+                        if (0 == rc) {
+                            ASSERTV(chunkSize, largeArray == value);
+                        }
+                      } break;
+                    }
+
+                    if (0 == rc) {
+                        ASSERTV(chunkSize, numDecoded, numFed,
+                                messageEnds[numDecoded] <= numFed);
+                        ASSERTV(chunkSize, numDecoded,
+                                numFed - messageEnds[numDecoded] ==
+                                                       X.numBytesBuffered());
+                        ++numDecoded;
+                    }
+                    else {
+                        ASSERTV(chunkSize, numDecoded, rc,
+                                k_NEED_MORE_DATA == rc);
+                        ASSERTV(chunkSize, numDecoded, numFed,
+                                numFed < messageEnds[numDecoded]);
+                    }
+                }
+            }
+
+            ASSERTV(chunkSize, numDecoded, 4 == numDecoded);
+            ASSERTV(chunkSize, 0 == X.numBytesBuffered());
+            ASSERTV(chunkSize, X.isValid());
+        }
+
+        if (verbose) cout << "\nTesting that messages are not copied." << endl;
+        {
+            const bsl::vector<char> largeValue(64 * 1024, 'y');
+
+            bsl::vector<char> largeData;
+            appendEncoding(&largeData, largeValue);
+
+            bdlbb::PooledBlobBufferFactory largeFactory(1024, &ta);
+
+            bslma::TestAllocator da("decoder", veryVeryVerbose);
+
+            Obj mX(0, &da);  const Obj& X = mX;
+
+            appendChunk(&mX,
+                        largeData,
+                        0,
+                        static_cast<int>(largeData.size()),
+                        &largeFactory);
+
+            ASSERTV(X.numBytesBuffered(),
+                    static_cast<int>(largeData.size()) == X.numBytesBuffered());
+
+            bsl::vector<char> value(&ta);
+            ASSERT(0 == mX.decode(&value));
+            ASSERT(largeValue == value);
+            ASSERT(0          == X.numBytesBuffered());
+
+            ASSERTV(da.numBytesMax(),
+                    da.numBytesMax() < static_cast<int>(largeData.size()) / 8);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ERRORS AND RECOVERY
+        //
+        // Concerns:
+        // 1. After a framing error, `decode` fails, and `isValid` returns
+        //    `false`, until `reset` is called.
+        //
+        // 2. `reset` discards all buffered input.
+        //
+        // 3. A correctly framed message that cannot be decoded is discarded,
+        //    and the next message is decoded normally.
+        //
+        // 4. Nesting of indefinite-length elements deeper than the `maxDepth`
+        //    option is a framing error.
+        //
+        // Plan:
+        // 1. Supply an invalid framing followed by a valid message, verify
+        //    that `decode` fails repeatedly, call `reset`, and verify that a
+        //    subsequently supplied message is decoded.  (C-1..2)
+        //
+        // 2. Supply the encoding of a `bsl::string` followed by that of an
+        //    `int`, and decode them as two `int` values.  Verify that the
+        //    first fails, the second succeeds, and `isValid` remains `true`.
+        //    (C-3)
+        //
+        // 3. Using options having a `maxDepth` of 3, supply 3 and then 4
+        //    nested indefinite-length elements.  (C-4)
+        //
+        // Testing:
+        //   void reset();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ERRORS AND RECOVERY" << endl
+                          << "===================" << endl;
+
+        bslma::TestAllocator           ta("test", veryVeryVerbose);
+        bdlbb::PooledBlobBufferFactory factory(16, &ta);
+
+        if (verbose) cout << "\nTesting framing errors and `reset`." << endl;
+        {
+            Obj mX(0, &ta);  const Obj& X = mX;
+
+            bsl::vector<char> data;
+            appendSpec(&data, "04 80", 0);
+            appendEncoding(&data, 5);
+
+            appendChunk(&mX,
+                        data,
+                        0,
+                        static_cast<int>(data.size()),
+                        &factory);
+
+            int value = 0;
+            ASSERT(0 >  mX.decode(&value));
+            ASSERT(0 >  mX.decode(&value));
+            ASSERT(!X.isValid());
+            ASSERT(0 == value);
+
+            mX.reset();
+            ASSERT(X.isValid());
+            ASSERT(0 == X.numBytesBuffered());
+            ASSERT(k_NEED_MORE_DATA == mX.decode(&value));
+
+            bsl::vector<char> valid;
+            appendEncoding(&valid, 7);
+            appendChunk(&mX,
+                        valid,
+                        0,
+                        static_cast<int>(valid.size()),
+                        &factory);
+
+            ASSERT(0 == mX.decode(&value));
+            ASSERT(7 == value);
+        }
+
+        if (verbose) cout << "\nTesting decoding errors." << endl;
+        {
+            Obj mX(0, &ta);  const Obj& X = mX;
+
+            bsl::vector<char> data;
+            appendEncoding(&data, bsl::string("not an int"));
+            appendEncoding(&data, 9);
+
+            appendChunk(&mX,
+                        data,
+                        0,
+                        static_cast<int>(data.size()),
+                        &factory);
+
+            int value = 0;
+            ASSERT(0 >  mX.decode(&value));
+            ASSERT(X.isValid());
+            ASSERT(0 == mX.decode(&value));
+            ASSERT(9 == value);
+            ASSERT(0 == X.numBytesBuffered());
+        }
+
+        if (verbose) cout << "\nTesting `maxDepth`." << endl;
+        {
+            balber::BerDecoderOptions options;
+            options.setMaxDepth(3);
+
+            const struct {
+                int         d_line;
+                const char *d_spec;
+                bool        d_isValid;
+            } DATA[] = {
+                { L_, "30 80 30 80 30 80 00 00 00 00 00 00",       true  },
+                { L_, "30 80 30 80 30 80 30 80 00 00 00 00 00 00", false },
+                { L_, "30 80 30 80 30 06 30 04 30 02 05 00 00 00 00 00",
+                                                                   true  },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE     = DATA[ti].d_line;
+                const char *SPEC     = DATA[ti].d_spec;
+                const bool  IS_VALID = DATA[ti].d_isValid;
+
+                Obj mX(&options, &ta);  const Obj& X = mX;
+
+                bsl::vector<char> data;
+                appendSpec(&data, SPEC, 0);
+                appendChunk(&mX,
+                            data,
+                            0,
+                            static_cast<int>(data.size()),
+                            &factory);
+
+                int value;
+                mX.decode(&value);
+
+                ASSERTV(LINE, IS_VALID == X.isValid());
+                ASSERTV(LINE, !IS_VALID || 0 == X.numBytesBuffered());
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // FRAMING IS RECOGNIZED ACROSS CHUNKS
+        //
+        // Concerns:
+        // 1. `decode` returns `e_NEED_MORE_DATA` until the last octet of the
+        //    next message is supplied, and then consumes exactly the octets
+        //    of that message.
+        //
+        // 2. Identifier octets in the high-tag-number form, length octets in
+        //    the short, long, and indefinite forms, and constructed elements
+        //    of definite length nested in ones of indefinite length (and vice
+        //    versa) are framed correctly.
+        //
+        // 3. Concerns 1 and 2 hold wherever the input is divided into
+        //    chunks, including within identifier and length octets.
+        //
+        // 4. An invalid framing is reported as an error no later than when
+        //    the octets showing it to be invalid are supplied.
+        //
+        // Plan:
+        // 1. Using the table-driven technique, specify a set of framings,
+        //    each with its expected length or an indication that it is
+        //    invalid.  (C-2)
+        //
+        // 2. For each framing, and for each chunk size from 1 to the length
+        //    of the framing, supply the framing, followed by the encoding of
+        //    an `int`, in chunks of that size.  Call `decode` for an `int`
+        //    after each chunk until it no longer returns `e_NEED_MORE_DATA`.
+        //    Verify the number of octets supplied at that point, and the
+        //    number of octets that remain buffered.  Finally, verify that the
+        //    trailing `int` is decoded for a valid framing, and that the
+        //    decoder remains invalid otherwise.  (C-1, 3..4)
+        //
+        // Testing:
+        //   int decode(TYPE *value);
+        //   bool isValid() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "FRAMING IS RECOGNIZED ACROSS CHUNKS" << endl
+                          << "===================================" << endl;
+
+        const struct {
+            int         d_line;
+            const char *d_spec;
+            int         d_numFillOctets;
+            int         d_length;         // -1 if invalid
+        } DATA[] = {
+            //LINE  SPEC                                    FILL  LENGTH
+            //----  --------------------------------------  ----  ------
+
+            // primitive, short-form length
+            { L_,   "02 01 05",                                0,      3 },
+            { L_,   "05 00",                                   0,      2 },
+            { L_,   "04 7F",                                 127,    129 },
+
+            // high-tag-number form
+            { L_,   "1F 1F 01 05",                             0,      4 },
+            { L_,   "9F 81 00 01 05",                          0,      5 },
+            { L_,   "DF 87 FF FF FF 7F 00",                    0,      7 },
+
+            // long-form length
+            { L_,   "04 81 80",                              128,    131 },
+            { L_,   "04 82 01 00",                           256,    260 },
+            { L_,   "04 83 00 01 00",                        256,    261 },
+            { L_,   "04 81 00",                                0,      3 },
+
+            // constructed, definite length
+            { L_,   "30 00",                                   0,      2 },
+            { L_,   "30 03 02 01 05",                          0,      5 },
+            { L_,   "30 05 30 80 00 00 00",                    0,      7 },
+
+            // constructed, indefinite length
+            { L_,   "30 80 00 00",                             0,      4 },
+            { L_,   "30 80 02 01 05 00 00",                    0,      7 },
+            { L_,   "30 80 30 80 02 01 05 00 00 04 00 00 00",  0,     13 },
+            { L_,   "30 80 30 03 02 01 05 00 00",              0,      9 },
+            { L_,   "A1 80 9F 81 00 01 05 00 00",              0,      9 },
+
+            // invalid
+            { L_,   "04 80",                                   0,     -1 },
+            { L_,   "00 00",                                   0,     -1 },
+            { L_,   "00 01 00",                                0,     -1 },
+            { L_,   "30 80 00 01 00",                          0,     -1 },
+            { L_,   "04 85 00 00 00 00 01",                    0,     -1 },
+            { L_,   "04 84 80 00 00 00",                       0,     -1 },
+            { L_,   "1F 81 81 81 81 81 01 01 05",              0,     -1 },
+            { L_,   "30 80 02 80",                             0,     -1 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator           ta("test", veryVeryVerbose);
+        bdlbb::PooledBlobBufferFactory factory(3, &ta);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE   = DATA[ti].d_line;
+            const char *SPEC   = DATA[ti].d_spec;
+            const int   FILL   = DATA[ti].d_numFillOctets;
+            const int   EXP    = DATA[ti].d_length;
+
+            if (veryVerbose) { T_ P_(LINE) P_(SPEC) P(EXP) }
+
+            bsl::vector<char> data;
+            appendSpec(&data, SPEC, FILL);
+
+            const int SPEC_LENGTH = static_cast<int>(data.size());
+
+            appendEncoding(&data, 7);
+
+            const int LENGTH = static_cast<int>(data.size());
+
+            for (int chunkSize = 1; chunkSize <= LENGTH; ++chunkSize) {
+                Obj mX(0, &ta);  const Obj& X = mX;
+
+                int  numFed = 0;
+                int  rc     = k_NEED_MORE_DATA;
+                int  value  = 0;
+
+                while (numFed < LENGTH && k_NEED_MORE_DATA == rc) {
+                    const int n = bsl::min(chunkSize, LENGTH - numFed);
+                    appendChunk(&mX, data, numFed, n, &factory);
+                    numFed += n;
+
+                    rc = mX.decode(&value);
+                }
+
+                if (0 <= EXP) {
+                    ASSERTV(LINE, chunkSize, rc, k_NEED_MORE_DATA != rc);
+                    ASSERTV(LINE, chunkSize, numFed,
+                            EXP <= numFed && numFed < EXP + chunkSize);
+                    ASSERTV(LINE, chunkSize, X.numBytesBuffered(),
+                            numFed - EXP == X.numBytesBuffered());
+                    ASSERTV(LINE, chunkSize, X.isValid());
+
+                    while (numFed < LENGTH) {
+                        const int n = bsl::min(chunkSize, LENGTH - numFed);
+                        appendChunk(&mX, data, numFed, n, &factory);
+                        numFed += n;
+                    }
+
+                    value = 0;
+                    ASSERTV(LINE, chunkSize, 0 == mX.decode(&value));
+                    ASSERTV(LINE, chunkSize, value, 7 == value);
+                    ASSERTV(LINE, chunkSize, 0 == X.numBytesBuffered());
+                }
+                else {
+                    ASSERTV(LINE, chunkSize, rc, 0 > rc);
+                    ASSERTV(LINE, chunkSize, numFed,
+                            numFed < SPEC_LENGTH + chunkSize);
+                    ASSERTV(LINE, chunkSize, !X.isValid());
+                    ASSERTV(LINE, chunkSize, 0 > mX.decode(&value));
+                }
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Create a decoder, supply it the encoding of a sequence in two
+        //    parts, and decode it.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator           ta("test", veryVeryVerbose);
+        bdlbb::PooledBlobBufferFactory factory(4, &ta);
+
+        s_baltst::MySequenceWithArray original;
+        original.attribute1() = 1000;
+        original.attribute2().resize(10, "value");
+
+        bsl::vector<char> data;
+        appendEncoding(&data, original);
+
+        const int LENGTH = static_cast<int>(data.size());
+
+        Obj mX(0, &ta);  const Obj& X = mX;
+
+        ASSERT(&ta == X.allocator());
+        ASSERT(0   == X.numBytesBuffered());
+        ASSERT(X.isValid());
+
+        s_baltst::MySequenceWithArray value(&ta);
+        ASSERT(k_NEED_MORE_DATA == mX.decode(&value));
+
+        appendChunk(&mX, data, 0, LENGTH / 2, &factory);
+        ASSERT(LENGTH / 2       == X.numBytesBuffered());
+        ASSERT(k_NEED_MORE_DATA == mX.decode(&value));
+        ASSERT(value.attribute2().empty());
+
+        appendChunk(&mX, data, LENGTH / 2, LENGTH - LENGTH / 2, &factory);
+        ASSERT(LENGTH == X.numBytesBuffered());
+        ASSERT(0      == mX.decode(&value));
+        ASSERT(original == value);
+        ASSERT(0      == X.numBytesBuffered());
+        ASSERT(0      == X.decoder().numUnknownElementsSkipped());
+
+        ASSERT(k_NEED_MORE_DATA == mX.decode(&value));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
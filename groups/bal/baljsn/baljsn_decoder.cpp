@@ -13,10 +13,30 @@ BSLS_IDENT_RCSID(baljsn_decoder_cpp,"$Id$ $CSID$")
 
 #include <bsla_fallthrough.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_iterator.h>
 
 namespace BloombergLP {
 namespace baljsn {
+namespace {
+namespace u {
+
+/// This `struct` provides a comparator ordering required attributes by id.
+struct RequiredAttributeIdLess {
+
+    // ACCESSORS
+
+    /// Return `true` if the id of the specified `lhs` is less than that of
+    /// the specified `rhs`, and `false` otherwise.
+    bool operator()(const Decoder_SequencePlan::RequiredAttribute& lhs,
+                    const Decoder_SequencePlan::RequiredAttribute& rhs) const
+    {
+        return lhs.d_id < rhs.d_id;
+    }
+};
+
+}  // close namespace u
+}  // close unnamed namespace
 
                                // -------------
                                // class Decoder
@@ -193,6 +213,47 @@ int Decoder::decodeAny(bsl::istream&          stream,
     return decode(stream, any, options);
 }
 
+                         // --------------------------
+                         // class Decoder_SequencePlan
+                         // --------------------------
+
+// MANIPULATORS
+void Decoder_SequencePlan::addRequiredAttribute(int         id,
+                                                const char *name,
+                                                int         nameLength)
+{
+    BSLS_ASSERT(name || 0 == nameLength);
+    BSLS_ASSERT(0 <= nameLength);
+
+    const RequiredAttribute attribute = { id, name, nameLength };
+
+    bsl::vector<RequiredAttribute>::iterator it =
+                             bsl::lower_bound(d_requiredAttributes.begin(),
+                                              d_requiredAttributes.end(),
+                                              attribute,
+                                              u::RequiredAttributeIdLess());
+
+    if (it == d_requiredAttributes.end() || it->d_id != id) {
+        d_requiredAttributes.insert(it, attribute);
+    }
+}
+
+// ACCESSORS
+int Decoder_SequencePlan::findRequiredAttribute(int id) const
+{
+    const RequiredAttribute attribute = { id, 0, 0 };
+
+    bsl::vector<RequiredAttribute>::const_iterator it =
+                             bsl::lower_bound(d_requiredAttributes.begin(),
+                                              d_requiredAttributes.end(),
+                                              attribute,
+                                              u::RequiredAttributeIdLess());
+
+    return it != d_requiredAttributes.end() && it->d_id == id
+           ? static_cast<int>(it - d_requiredAttributes.begin())
+           : -1;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
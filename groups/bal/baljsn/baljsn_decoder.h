@@ -16,11 +16,17 @@ BSLS_IDENT("$Id: $")
 //@DESCRIPTION: This component provides a class, `baljsn::Decoder`, for
 // decoding value-semantic objects in the JSON format.  In particular, the
 // `class` contains a parameterized `decode` function that decodes an object
-// from a specified stream.  There are two overloaded versions of this
+// from a specified stream.  There are three overloaded versions of this
 // function:
 //
 // * one that reads from a `bsl::streambuf`
 // * one that reads from a `bsl::istream`
+// * one that reads from a contiguous character array
+//
+// The last reads the characters in place: string values are copied directly
+// from the input into the object being decoded, without passing through an
+// intermediate buffer.  Input already held in memory should be decoded using
+// that overload.
 //
 // This component can be used with types that support the `bdeat` framework
 // (see the `bdeat` package for details), which is a compile-time interface for
@@ -171,6 +177,7 @@ BSLS_IDENT("$Id: $")
 #include <bdlat_enumfunctions.h>
 #include <bdlat_enumutil.h>
 #include <bdlat_formattingmode.h>
+#include <bdlat_namelookup.h>
 #include <bdlat_selectioninfo.h>
 #include <bdlat_sequencefunctions.h>
 #include <bdlat_typecategory.h>
@@ -182,18 +189,26 @@ BSLS_IDENT("$Id: $")
 
 #include <bsla_fallthrough.h>
 
+#include <bslma_default.h>
+
 #include <bslmf_assert.h>
+#include <bslmf_integralconstant.h>
 #include <bslmf_isintegral.h>
+#include <bslmf_issame.h>
+
+#include <bslmt_once.h>
 
 #include <bsls_assert.h>
+#include <bsls_objectbuffer.h>
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
 #include <bsl_streambuf.h>
 #include <bsl_string.h>
 #include <bsl_string_view.h>
-#include <bsl_unordered_set.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace baljsn {
@@ -264,6 +279,13 @@ class Decoder {
     template <class TYPE, class ANY_CATEGORY>
     int decodeImp(TYPE *value, ANY_CATEGORY category);
 
+    /// Decode into the specified `value`, of a (template parameter) `TYPE`,
+    /// the JSON data read by `d_tokenizer`, which has just been reset, using
+    /// the specified `options`.  Return 0 on success, and a non-zero value
+    /// otherwise.
+    template <class TYPE>
+    int decodeTopLevel(TYPE *value, const DecoderOptions& options);
+
     /// Log the latest tokenizer error to `d_logStream`.  If the tokenizer
     /// did not have an error, log the specified `alternateString`.  Return
     /// a reference to `d_logStream`.
@@ -327,6 +349,29 @@ class Decoder {
                TYPE                  *value,
                const DecoderOptions  *options);
 
+    /// Decode into the specified `value`, of a (template parameter) `TYPE`,
+    /// the JSON data in the specified `length` characters starting at the
+    /// specified `data`, using the specified `options`.  Specifying a
+    /// nullptr `options` is equivalent to passing a default-constructed
+    /// DecoderOptions in `options`.  `TYPE` shall be a `bdeat`-compatible
+    /// sequence, choice, or array type, or a `bdeat`-compatible dynamic
+    /// type referring to one of those types.  Return 0 on success, and a
+    /// non-zero value otherwise.  The behavior is undefined unless `data`
+    /// refers to at least `length` characters (`data` may be 0 if `length`
+    /// is 0).  Note that, unlike the `streambuf` overloads, this operation
+    /// reads `data` in place rather than buffering it, and so is the
+    /// preferred overload for input already held in memory.
+    template <class TYPE>
+    int decode(const char            *data,
+               bsl::size_t            length,
+               TYPE                  *value,
+               const DecoderOptions&  options);
+    template <class TYPE>
+    int decode(const char            *data,
+               bsl::size_t            length,
+               TYPE                  *value,
+               const DecoderOptions  *options);
+
     /// Decode an object of (template parameter) `TYPE` from the specified
     /// `streamBuf` and load the result into the specified modifiable `value`.
     /// Return 0 on success, and a non-zero value otherwise.
@@ -467,22 +512,153 @@ struct Decoder_DecodeImpProxy {
     int operator()(TYPE *object, ANY_CATEGORY category);
 };
 
-                       // ===================================
-                       // struct Decoder_RequiredAttrsVisitor
-                       // ===================================
+                         // ==========================
+                         // class Decoder_SequencePlan
+                         // ==========================
+
+/// This component-private class provides the part of the decoding of a
+/// sequence type that does not depend on the message being decoded: the
+/// ids and names of its required attributes, i.e., those that must be
+/// present in a message unless `allowMissingRequiredAttributes` is set.
+/// Plans are built by `Decoder_SequencePlanUtil`, once per type where
+/// possible.
+class Decoder_SequencePlan {
+
+  public:
+    // PUBLIC TYPES
+
+    /// This `struct` describes a required attribute.
+    struct RequiredAttribute {
+        int         d_id;          // attribute id
+        const char *d_name_p;      // attribute name (held, not owned)
+        int         d_nameLength;  // length of `d_name_p`
+    };
+
+  private:
+    // DATA
+    bsl::vector<RequiredAttribute> d_requiredAttributes;  // sorted by id
+
+  private:
+    // NOT IMPLEMENTED
+    Decoder_SequencePlan(const Decoder_SequencePlan&);
+    Decoder_SequencePlan& operator=(const Decoder_SequencePlan&);
+
+  public:
+    // CREATORS
+
+    /// Create an empty plan.  Optionally specify a `basicAllocator` used
+    /// to supply memory.  If `basicAllocator` is 0, the currently installed
+    /// default allocator is used.
+    explicit Decoder_SequencePlan(bslma::Allocator *basicAllocator = 0);
+
+    // MANIPULATORS
+
+    /// Add to this plan the required attribute having the specified `id`
+    /// and `name` of the specified `nameLength`, unless an attribute having
+    /// `id` was already added.  The behavior is undefined unless `name`
+    /// outlives this plan.
+    void addRequiredAttribute(int id, const char *name, int nameLength);
+
+    // ACCESSORS
+
+    /// Return the index of the required attribute having the specified
+    /// `id`, and -1 if `id` is not the id of a required attribute.
+    int findRequiredAttribute(int id) const;
+
+    /// Return the number of required attributes of this plan.
+    int numRequiredAttributes() const;
+
+    /// Return a reference providing non-modifiable access to the required
+    /// attribute at the specified `index`.  The behavior is undefined
+    /// unless `0 <= index < numRequiredAttributes()`.
+    const RequiredAttribute& requiredAttribute(int index) const;
+};
+
+                     // =================================
+                     // struct Decoder_SequencePlanVisitor
+                     // =================================
 
-/// This class provides a functor that finds and remembers all non-optional
-/// sequence attributes.
-struct Decoder_RequiredAttrsVisitor {
+/// This class provides a functor that adds the non-optional attributes of a
+/// sequence to a plan, and records whether the category of any of them is
+/// resolved only at run-time.
+struct Decoder_SequencePlanVisitor {
     // PUBLIC DATA
-    bsl::unordered_set<bsl::string> *d_requiredAttributes_p;
-    bool                             d_usesDefaultValueFlag;
+    Decoder_SequencePlan *d_plan_p;
+    bool                  d_usesDefaultValueFlag;
+    bool                  d_hasDynamicAttribute;
 
     // MANIPULATORS
     template <class TYPE, class INFO>
     int operator()(TYPE *value, const INFO& info);
 };
 
+                     // ================================
+                     // struct Decoder_AttributeIdVisitor
+                     // ================================
+
+/// This class provides a functor that records the id of the attribute it is
+/// invoked on.
+struct Decoder_AttributeIdVisitor {
+    // PUBLIC DATA
+    int *d_id_p;
+
+    // MANIPULATORS
+    template <class TYPE, class INFO>
+    int operator()(TYPE *, const INFO& info);
+};
+
+                      // ===============================
+                      // struct Decoder_SequencePlanUtil
+                      // ===============================
+
+/// This `struct` provides a namespace for functions that obtain the plan
+/// for decoding a sequence type, and that look up its attributes by name.
+struct Decoder_SequencePlanUtil {
+
+  private:
+    // PRIVATE CLASS METHODS
+
+    /// Load into the specified `plan` the plan for decoding the specified
+    /// sequence `value`, and return `true` if the plan depends only on the
+    /// (template parameter) `TYPE`, and `false` otherwise.
+    template <class TYPE>
+    static bool build(Decoder_SequencePlan *plan, TYPE *value);
+
+    /// Return the address of the plan for decoding the specified sequence
+    /// `value`, cached for the (template parameter) `TYPE` on first use if
+    /// it depends on `TYPE` only, and otherwise the specified `buffer`
+    /// after loading into it a plan built from `value`.
+    template <class TYPE>
+    static const Decoder_SequencePlan *planImp(Decoder_SequencePlan *buffer,
+                                               TYPE                 *value,
+                                               bsl::true_type);
+    template <class TYPE>
+    static const Decoder_SequencePlan *planImp(Decoder_SequencePlan *buffer,
+                                               TYPE                 *value,
+                                               bsl::false_type);
+
+  public:
+    // CLASS METHODS
+
+    /// Load into the specified `id` the id of the attribute of the
+    /// specified sequence `value` having the specified `name`, and return
+    /// `true` if there is such an attribute, and `false` otherwise.
+    template <class TYPE>
+    static bool findAttributeId(int                     *id,
+                                TYPE                    *value,
+                                const bsl::string_view&  name);
+
+    /// Return the address of the plan for decoding the specified sequence
+    /// `value` of the (template parameter) `TYPE`: a plan built once and
+    /// cached for `TYPE` if `TYPE` provides static attribute information
+    /// (see `bdlat::NameLookupUtil::HasAttributeLookup`) and none of its
+    /// attributes is of a dynamic type, and otherwise the specified
+    /// `buffer`, after loading into it a plan built from `value`.
+    template <class TYPE>
+    static const Decoder_SequencePlan *plan(Decoder_SequencePlan *buffer,
+                                            TYPE                 *value);
+};
+
 // ============================================================================
 //                            INLINE DEFINITIONS
 // ============================================================================
@@ -594,15 +770,20 @@ int Decoder::decodeImp(TYPE *value, int mode, bdlat_TypeCategory::Sequence)
             return -1;                                                // RETURN
         }
 
+        // Track the presence of the non-optional attributes, listed by the
+        // plan cached for 'TYPE' where possible.
+
         bdlma::LocalSequentialAllocator<512> localAllocator;
-        bsl::unordered_set<bsl::string> requiredAttributes(&localAllocator);
+        Decoder_SequencePlan                 localPlan(&localAllocator);
+        const Decoder_SequencePlan          *plan = 0;
         if (!d_allowMissingRequiredAttributes) {
-            // Collect a list of the non-optional attributes
-            Decoder_RequiredAttrsVisitor visitor = {&requiredAttributes,
-                       ::BloombergLP::bdlat_UsesDefaultValueFlag<TYPE>::value};
-            bdlat_SequenceFunctions::manipulateAttributes(value, visitor);
+            plan = Decoder_SequencePlanUtil::plan(&localPlan, value);
         }
 
+        int numMissing = plan ? plan->numRequiredAttributes() : 0;
+
+        bsl::vector<char> isPresent(numMissing, 0, &localAllocator);
+
         while (Tokenizer::e_ELEMENT_NAME == d_tokenizer.tokenType()) {
 
             bslstl::StringRef elementName;
@@ -612,10 +793,10 @@ int Decoder::decodeImp(TYPE *value, int mode, bdlat_TypeCategory::Sequence)
                 return -1;                                            // RETURN
             }
 
-            if (bdlat_SequenceFunctions::hasAttribute(
-                                     *value,
-                                     elementName.data(),
-                                     static_cast<int>(elementName.length()))) {
+            int attributeId;
+            if (Decoder_SequencePlanUtil::findAttributeId(&attributeId,
+                                                          value,
+                                                          elementName)) {
                 d_elementName = elementName;
 
                 rc = d_tokenizer.advanceToNextToken();
@@ -628,18 +809,21 @@ int Decoder::decodeImp(TYPE *value, int mode, bdlat_TypeCategory::Sequence)
                 Decoder_ElementVisitor visitor = { this, mode };
 
                 if (0 != bdlat_SequenceFunctions::manipulateAttribute(
-                                   value,
-                                   visitor,
-                                   d_elementName.data(),
-                                   static_cast<int>(d_elementName.length()))) {
+                                                              value,
+                                                              visitor,
+                                                              attributeId)) {
                     d_logStream << "Could not decode sequence, error decoding "
                                 << "element or bad element name '"
                                 << d_elementName << "' \n";
                     return -1;                                        // RETURN
                 }
 
-                if (!requiredAttributes.empty()) {
-                    requiredAttributes.erase(elementName);
+                if (numMissing) {
+                    const int index = plan->findRequiredAttribute(attributeId);
+                    if (0 <= index && !isPresent[index]) {
+                        isPresent[index] = 1;
+                        --numMissing;
+                    }
                 }
             }
             else {
@@ -674,12 +858,22 @@ int Decoder::decodeImp(TYPE *value, int mode, bdlat_TypeCategory::Sequence)
             return -1;                                                // RETURN
         }
 
-        if (!requiredAttributes.empty()) {
+        if (numMissing) {
             // There are non-optional attributes that are not presented
             // in the decoded message (sequence).
+
+            const int index = static_cast<int>(
+                       bsl::find(isPresent.begin(), isPresent.end(), 0) -
+                                                           isPresent.begin());
+
+            const Decoder_SequencePlan::RequiredAttribute& attribute =
+                                               plan->requiredAttribute(index);
+
             d_logStream << "Could not decode sequence, "
                         << "missing required attribute \""
-                        << *requiredAttributes.begin() << "\"\n";
+                        << bsl::string_view(attribute.d_name_p,
+                                            attribute.d_nameLength)
+                        << "\"\n";
             return -1;                                                // RETURN
         }
 
@@ -1056,30 +1250,9 @@ int Decoder::decodeImp(TYPE *, ANY_CATEGORY)
     return -1;
 }
 
-// CREATORS
-inline
-Decoder::Decoder(bslma::Allocator *basicAllocator)
-: d_logStream(basicAllocator)
-, d_tokenizer(basicAllocator)
-, d_elementName(basicAllocator)
-, d_currentDepth(0)
-, d_maxDepth(0)
-, d_skipUnknownElements(false)
-, d_numUnknownElementsSkipped(0)
-, d_allowMissingRequiredAttributes(
-         DecoderOptions::DEFAULT_INITIALIZER_ALLOW_MISSING_REQUIRED_ATTRIBUTES)
-{
-}
-
-// MANIPULATORS
 template <class TYPE>
-int Decoder::decode(bsl::streambuf        *streamBuf,
-                    TYPE                  *value,
-                    const DecoderOptions&  options)
+int Decoder::decodeTopLevel(TYPE *value, const DecoderOptions& options)
 {
-    BSLS_ASSERT(streamBuf);
-    BSLS_ASSERT(value);
-
     d_logStream.clear();
     d_logStream.str("");
 
@@ -1102,7 +1275,6 @@ int Decoder::decode(bsl::streambuf        *streamBuf,
         return -1;                                                    // RETURN
     }
 
-    d_tokenizer.reset(streamBuf);
     d_tokenizer
     .setAllowStandAloneValues(false)
     .setAllowHeterogenousArrays(true) // needed for nillable arrays
@@ -1131,6 +1303,35 @@ int Decoder::decode(bsl::streambuf        *streamBuf,
     return rc;
 }
 
+// CREATORS
+inline
+Decoder::Decoder(bslma::Allocator *basicAllocator)
+: d_logStream(basicAllocator)
+, d_tokenizer(basicAllocator)
+, d_elementName(basicAllocator)
+, d_currentDepth(0)
+, d_maxDepth(0)
+, d_skipUnknownElements(false)
+, d_numUnknownElementsSkipped(0)
+, d_allowMissingRequiredAttributes(
+         DecoderOptions::DEFAULT_INITIALIZER_ALLOW_MISSING_REQUIRED_ATTRIBUTES)
+{
+}
+
+// MANIPULATORS
+template <class TYPE>
+int Decoder::decode(bsl::streambuf        *streamBuf,
+                    TYPE                  *value,
+                    const DecoderOptions&  options)
+{
+    BSLS_ASSERT(streamBuf);
+    BSLS_ASSERT(value);
+
+    d_tokenizer.reset(streamBuf);
+
+    return decodeTopLevel(value, options);
+}
+
 template <class TYPE>
 int Decoder::decode(bsl::streambuf        *streamBuf,
                     TYPE                  *value,
@@ -1172,6 +1373,30 @@ int Decoder::decode(bsl::istream&          stream,
     return decode(stream, value, options ? *options : localOpts);
 }
 
+template <class TYPE>
+int Decoder::decode(const char            *data,
+                    bsl::size_t            length,
+                    TYPE                  *value,
+                    const DecoderOptions&  options)
+{
+    BSLS_ASSERT(data || 0 == length);
+    BSLS_ASSERT(value);
+
+    d_tokenizer.reset(data, length);
+
+    return decodeTopLevel(value, options);
+}
+
+template <class TYPE>
+int Decoder::decode(const char            *data,
+                    bsl::size_t            length,
+                    TYPE                  *value,
+                    const DecoderOptions  *options)
+{
+    DecoderOptions localOpts;
+    return decode(data, length, value, options ? *options : localOpts);
+}
+
 template <class TYPE>
 int Decoder::decode(bsl::streambuf *streamBuf, TYPE *value)
 {
@@ -1281,14 +1506,49 @@ int Decoder_DecodeImpProxy::operator()(TYPE         *object,
     return d_decoder_p->decodeImp(object, d_mode, category);
 }
 
-                       // -----------------------------------
-                       // struct Decoder_RequiredAttrsVisitor
-                       // -----------------------------------
+                         // --------------------------
+                         // class Decoder_SequencePlan
+                         // --------------------------
+
+// CREATORS
+inline
+Decoder_SequencePlan::Decoder_SequencePlan(bslma::Allocator *basicAllocator)
+: d_requiredAttributes(basicAllocator)
+{
+}
+
+// ACCESSORS
+inline
+int Decoder_SequencePlan::numRequiredAttributes() const
+{
+    return static_cast<int>(d_requiredAttributes.size());
+}
+
+inline
+const Decoder_SequencePlan::RequiredAttribute&
+Decoder_SequencePlan::requiredAttribute(int index) const
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < numRequiredAttributes());
+
+    return d_requiredAttributes[index];
+}
+
+                     // ---------------------------------
+                     // struct Decoder_SequencePlanVisitor
+                     // ---------------------------------
 
 // MANIPULATORS
 template <class TYPE, class INFO>
 inline
-int Decoder_RequiredAttrsVisitor::operator()(TYPE *value, const INFO& info) {
+int Decoder_SequencePlanVisitor::operator()(TYPE *value, const INFO& info)
+{
+    typedef typename bdlat_TypeCategory::Select<TYPE>::Type TypeCategory;
+
+    if (bsl::is_same<TypeCategory, bdlat_TypeCategory::DynamicType>::value) {
+        d_hasDynamicAttribute = true;
+    }
+
     switch(bdlat_TypeCategoryFunctions::select(*value))
     {
       case bdlat_TypeCategory::e_NULLABLE_VALUE_CATEGORY:
@@ -1304,12 +1564,131 @@ int Decoder_RequiredAttrsVisitor::operator()(TYPE *value, const INFO& info) {
       default:
         if (!d_usesDefaultValueFlag ||
             !(info.formattingMode() & bdlat_FormattingMode::e_DEFAULT_VALUE)) {
-            d_requiredAttributes_p->emplace(info.name(), info.nameLength());
+            d_plan_p->addRequiredAttribute(info.id(),
+                                           info.name(),
+                                           info.nameLength());
         }
     }
     return 0;
 }
 
+                     // --------------------------------
+                     // struct Decoder_AttributeIdVisitor
+                     // --------------------------------
+
+// MANIPULATORS
+template <class TYPE, class INFO>
+inline
+int Decoder_AttributeIdVisitor::operator()(TYPE *, const INFO& info)
+{
+    *d_id_p = info.id();
+    return 0;
+}
+
+                      // -------------------------------
+                      // struct Decoder_SequencePlanUtil
+                      // -------------------------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE>
+bool Decoder_SequencePlanUtil::build(Decoder_SequencePlan *plan, TYPE *value)
+{
+    Decoder_SequencePlanVisitor visitor = {
+                      plan,
+                      ::BloombergLP::bdlat_UsesDefaultValueFlag<TYPE>::value,
+                      false };
+    bdlat_SequenceFunctions::manipulateAttributes(value, visitor);
+
+    return !visitor.d_hasDynamicAttribute;
+}
+
+template <class TYPE>
+const Decoder_SequencePlan *Decoder_SequencePlanUtil::planImp(
+                                                  Decoder_SequencePlan *buffer,
+                                                  TYPE                 *value,
+                                                  bsl::true_type)
+{
+    static bsls::ObjectBuffer<Decoder_SequencePlan> s_plan;
+    static bool                                     s_isCached;
+
+    BSLMT_ONCE_DO {
+        Decoder_SequencePlan *plan = new (s_plan.buffer())
+                      Decoder_SequencePlan(bslma::Default::globalAllocator());
+        s_isCached = build(plan, value);
+    }
+
+    if (s_isCached) {
+        return &s_plan.object();                                      // RETURN
+    }
+
+    build(buffer, value);
+    return buffer;
+}
+
+template <class TYPE>
+inline
+const Decoder_SequencePlan *Decoder_SequencePlanUtil::planImp(
+                                                  Decoder_SequencePlan *buffer,
+                                                  TYPE                 *value,
+                                                  bsl::false_type)
+{
+    build(buffer, value);
+    return buffer;
+}
+
+// CLASS METHODS
+template <class TYPE>
+inline
+bool Decoder_SequencePlanUtil::findAttributeId(int                     *id,
+                                               TYPE                    *value,
+                                               const bsl::string_view&  name)
+{
+    BSLS_ASSERT(id);
+    BSLS_ASSERT(value);
+
+    const bdlat::NameLookup *lookup =
+                             bdlat::NameLookupUtil::attributeLookup<TYPE>();
+
+    if (lookup) {
+        if (0 == lookup->find(id,
+                              name.data(),
+                              static_cast<int>(name.length()))) {
+            return true;                                              // RETURN
+        }
+        if (!lookup->hasUntaggedElement()) {
+            return false;                                             // RETURN
+        }
+    }
+
+    // Not in the table (or no table): ask the type itself, which may also
+    // accept names, such as the caseless selection names of an anonymous
+    // choice, that the table does not hold.
+
+    Decoder_AttributeIdVisitor visitor = { id };
+    return 0 == bdlat_SequenceFunctions::manipulateAttribute(
+                                             value,
+                                             visitor,
+                                             name.data(),
+                                             static_cast<int>(name.length()));
+}
+
+template <class TYPE>
+inline
+const Decoder_SequencePlan *Decoder_SequencePlanUtil::plan(
+                                                  Decoder_SequencePlan *buffer,
+                                                  TYPE                 *value)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(value);
+
+    return planImp(
+             buffer,
+             value,
+             bsl::integral_constant<
+                 bool,
+                 bdlat::NameLookupUtil::HasAttributeLookup<TYPE>::value>());
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -61,6 +61,8 @@
 #include <s_baltst_bigrecord.h>
 #include <s_baltst_depthtestmessageutil.h>
 #include <s_baltst_employee.h>
+#include <s_baltst_featuretestmessage.h>
+#include <s_baltst_featuretestmessageutil.h>
 #include <s_baltst_generatetestarray.h>
 #include <s_baltst_generatetestchoice.h>
 #include <s_baltst_generatetestcustomizedtype.h>
@@ -88,6 +90,7 @@
 #include <bsla_maybeunused.h>
 
 #include <bsls_libraryfeatures.h>
+#include <bsls_stopwatch.h>
 
 #include <bsl_climits.h>
 #include <bsl_cstdlib.h>
@@ -130,6 +133,8 @@ namespace test = BloombergLP::s_baltst;
 // [ 4] int decode(bsl::istream& stream, TYPE *v, options);
 // [ 4] int decode(bsl::streambuf *streamBuf, TYPE *v, &options);
 // [ 4] int decode(bsl::istream& stream, TYPE *v, &options);
+// [20] int decode(const char *data, size_t length, TYPE *v, options);
+// [20] int decode(const char *data, size_t length, TYPE *v, &options);
 //
 // ACCESSORS
 // [ 4] bsl::string loggedMessages() const;
@@ -153,7 +158,9 @@ namespace test = BloombergLP::s_baltst;
 // [17] MAXDEPTH IS RESPECTED
 // [18] `allowMissingRequiredAttributes` OPTION
 // [19] TESTING `Decimal64`
-// [20] USAGE EXAMPLE
+// [20] DECODING FROM A CHARACTER ARRAY
+// [21] USAGE EXAMPLE
+// [-1] PERFORMANCE: DECODING `s_baltst::FeatureTestMessage`
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -3400,7 +3407,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 20: {
+      case 21: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -3506,6 +3513,121 @@ int main(int argc, char *argv[])
     ASSERT(21              == employee.age());
 // ```
       } break;
+      case 20: {
+        // --------------------------------------------------------------------
+        // DECODING FROM A CHARACTER ARRAY
+        //
+        // Concerns:
+        // 1. Decoding from a character array produces the same return code
+        //    and value as decoding the same characters from a `streambuf`,
+        //    for valid input, invalid JSON, and invalid UTF-8, with and
+        //    without UTF-8 validation, and, on success, the same logged
+        //    messages.  Note that the offset logged for an error within a
+        //    value may differ, as the position of a streamed tokenizer after
+        //    a failed read depends on its buffering.
+        //
+        // 2. String values longer than the internal buffer of the tokenizer
+        //    are decoded correctly.
+        //
+        // 3. A null `options` is equivalent to default options.
+        //
+        // Plan:
+        // 1. For a table of JSON documents describing a `test::Employee`,
+        //    decode each document from a `bsl::stringbuf` and from a
+        //    character array, with `validateInputIsUtf8` both `false` and
+        //    `true`, and compare the results.  (C-1..2)
+        //
+        // 2. Repeat P-1 using the overload taking the address of the options,
+        //    passing 0 when `validateInputIsUtf8` is `false`.  (C-3)
+        //
+        // Testing:
+        //   int decode(const char *data, size_t length, TYPE *v, options);
+        //   int decode(const char *data, size_t length, TYPE *v, &options);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nDECODING FROM A CHARACTER ARRAY"
+                          << "\n===============================" << endl;
+
+        const bsl::string LONG_NAME(3 * 8192 + 17, 'n');
+
+        const struct {
+            int         d_line;
+            bsl::string d_input;
+        } DATA[] = {
+            //LINE  INPUT
+            //----  ---------------------------------------------------------
+            { L_,   "" },
+            { L_,   "{}" },
+            { L_,   "  { \"name\": \"Bob\", \"age\": 21 }  trailing" },
+            { L_,   "{\"name\":\"Bob\",\"homeAddress\":{\"city\":\"NYC\"}}" },
+            { L_,   "{\"name\":\"B\\u00e9b \\\"q\\\"\"}" },
+            { L_,   "{\"name\":\"" + LONG_NAME + "\",\"age\":3}" },
+            { L_,   "{\"name\":\"B\xc3\xa9\"}" },
+            { L_,   "{\"name\":\"B\xff\"}" },
+            { L_,   "{\"name\":\"" + LONG_NAME + "\xc3\"}" },
+            { L_,   "{\"name\" \"Bob\"}" },
+            { L_,   "{\"age\":\"old\"}" },
+            { L_,   "{\"name\":\"unterminated" },
+            { L_,   "[1]" },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int          LINE  = DATA[ti].d_line;
+            const bsl::string& INPUT = DATA[ti].d_input;
+
+            for (int validate = 0; validate < 2; ++validate) {
+                if (veryVerbose) { T_; P_(LINE); P(validate); }
+
+                baljsn::DecoderOptions options;
+                options.setValidateInputIsUtf8(validate);
+
+                test::Employee  expValue;
+                baljsn::Decoder expDecoder;
+                bsl::stringbuf  sb(INPUT);
+
+                const int EXP_RC = expDecoder.decode(&sb, &expValue, options);
+
+                {
+                    test::Employee  value;
+                    baljsn::Decoder decoder;
+
+                    const int RC = decoder.decode(INPUT.data(),
+                                                  INPUT.length(),
+                                                  &value,
+                                                  options);
+
+                    ASSERTV(LINE, validate, EXP_RC, RC, EXP_RC == RC);
+                    ASSERTV(LINE, validate, expValue == value);
+
+                    if (0 == EXP_RC) {
+                        ASSERTV(LINE,
+                                validate,
+                                expDecoder.loggedMessages(),
+                                decoder.loggedMessages(),
+                                expDecoder.loggedMessages() ==
+                                                     decoder.loggedMessages());
+                    }
+                    else {
+                        ASSERTV(LINE, validate,
+                                !decoder.loggedMessages().empty());
+                    }
+                }
+                {
+                    test::Employee  value;
+                    baljsn::Decoder decoder;
+
+                    const int RC = decoder.decode(INPUT.data(),
+                                                  INPUT.length(),
+                                                  &value,
+                                                  validate ? &options : 0);
+
+                    ASSERTV(LINE, validate, EXP_RC, RC, EXP_RC == RC);
+                    ASSERTV(LINE, validate, expValue == value);
+                }
+            }
+        }
+      } break;
       case 19: {
         // --------------------------------------------------------------------
         // TESTING `Decimal64`
@@ -3942,6 +4064,11 @@ int main(int argc, char *argv[])
         //    `allowMissingRequiredAttributes == false`.  Verify that decoding
         //    was successful.  (C-2)
         //
+        // 5. Using one decoder, repeatedly decode messages that have all,
+        //    some, or none of the non-optional attributes (some repeated),
+        //    both with `decode` and `decodeAny`, and verify the result and
+        //    the attribute named in the error message.  (C-1)
+        //
         // Testing:
         //   `allowMissingRequiredAttributes` OPTION
         // --------------------------------------------------------------------
@@ -3978,6 +4105,70 @@ int main(int argc, char *argv[])
             ASSERT(options.allowMissingRequiredAttributes() == false);
             ASSERT(decoder.decode(ss, &seq, options) == 0);
         }
+
+        if (verbose) cout << "\nRepeated decoding." << endl;
+        {
+            // Note that `decodeAny` requires only the attributes that are
+            // not simple, as `bdlar` references do not have the
+            // `bdlat_UsesDefaultValueFlag` trait.
+
+            static const struct {
+                int         d_line;
+                const char *d_json_p;
+                const char *d_missing_p;     // for `decode`, 0 if none
+                const char *d_anyMissing_p;  // for `decodeAny`, 0 if none
+            } DATA[] = {
+                { L_, "{ \"attribute1\": 1, \"attribute2\": [] }",
+                                                  0,            0            },
+                { L_, "{ \"attribute2\": [], \"attribute1\": 1 }",
+                                                  0,            0            },
+                { L_, "{ \"attribute1\": 1 }",
+                                                  "attribute2", "attribute2" },
+                { L_, "{ \"attribute2\": [\"a\"] }",
+                                                  "attribute1", 0            },
+                { L_, "{ \"attribute1\": 1, \"attribute1\": 2 }",
+                                                  "attribute2", "attribute2" },
+                { L_, "{ }",
+                                                  "attribute1", "attribute2" },
+                { L_, "{ \"attribute1\": 1, \"attribute2\": [] }",
+                                                  0,            0            },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int i = 0; i < 2 * NUM_DATA; ++i) {
+                const int   ti      = i % NUM_DATA;
+                const bool  ANY     = NUM_DATA <= i;
+                const int   LINE    = DATA[ti].d_line;
+                const char *JSON    = DATA[ti].d_json_p;
+                const char *MISSING = ANY
+                                    ? DATA[ti].d_anyMissing_p
+                                    : DATA[ti].d_missing_p;
+
+                if (veryVerbose) {
+                    P_(LINE); P(ANY);
+                }
+
+                bsl::istringstream        ss(JSON);
+                test::MySequenceWithArray seq;
+
+                const int rc = ANY
+                             ? decoder.decodeAny(ss, &seq, options)
+                             : decoder.decode(ss, &seq, options);
+
+                ASSERTV(LINE, ANY, rc, decoder.loggedMessages(),
+                        (0 == MISSING) == (0 == rc));
+
+                if (MISSING) {
+                    const bsl::string expected =
+                        bsl::string("missing required attribute \"") +
+                        MISSING + "\"";
+
+                    ASSERTV(LINE, ANY, decoder.loggedMessages(),
+                            bsl::string::npos !=
+                                  decoder.loggedMessages().find(expected));
+                }
+            }
+        }
       } break;
       case 17: {
         // --------------------------------------------------------------------
@@ -9144,6 +9335,86 @@ int main(int argc, char *argv[])
             ASSERT(21            == bob.age());
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: DECODING `s_baltst::FeatureTestMessage`
+        //
+        // Concerns:
+        // 1. Decoding generated types is efficient.
+        //
+        // 2. Checking for missing required attributes, using the plans cached
+        //    per sequence type, is efficient.
+        //
+        // Plan:
+        // 1. Decode every compact JSON message of
+        //    `s_baltst::FeatureTestMessageUtil` into a
+        //    `s_baltst::FeatureTestMessage` the number of times given by the
+        //    optional second argument, and report the throughput, with
+        //    `allowMissingRequiredAttributes` set to `true` (the default) and
+        //    then to `false`.
+        //
+        // Testing:
+        //   PERFORMANCE: DECODING `s_baltst::FeatureTestMessage`
+        // --------------------------------------------------------------------
+
+        cout << "\nPERFORMANCE: DECODING `s_baltst::FeatureTestMessage`"
+             << "\n===================================================="
+             << endl;
+
+        typedef s_baltst::FeatureTestMessageUtil MessageUtil;
+
+        const int NUM_ITERATIONS = argc > 2 ? bsl::atoi(argv[2]) : 1000;
+
+        for (int allowMissing = 1; allowMissing >= 0; --allowMissing) {
+            baljsn::DecoderOptions options;
+            options.setAllowMissingRequiredAttributes(allowMissing);
+
+            bsl::vector<int> decodable;
+            bsl::size_t      numBytes = 0;
+
+            for (int i = 0; i < MessageUtil::k_NUM_MESSAGES; ++i) {
+                const char *JSON = MessageUtil::s_COMPACT_JSON_MESSAGES[i];
+
+                bdlsb::FixedMemInStreamBuf   isb(JSON, bsl::strlen(JSON));
+                s_baltst::FeatureTestMessage object;
+                baljsn::Decoder              decoder;
+
+                if (0 == decoder.decode(&isb, &object, options)) {
+                    decodable.push_back(i);
+                    numBytes += bsl::strlen(JSON);
+                }
+            }
+            ASSERT(!decodable.empty());
+
+            bsls::Stopwatch timer;
+            timer.start(true);
+
+            for (int iteration = 0; iteration < NUM_ITERATIONS; ++iteration) {
+                for (bsl::size_t k = 0; k < decodable.size(); ++k) {
+                    const char *JSON =
+                            MessageUtil::s_COMPACT_JSON_MESSAGES[decodable[k]];
+
+                    bdlsb::FixedMemInStreamBuf   isb(JSON, bsl::strlen(JSON));
+                    s_baltst::FeatureTestMessage object;
+                    baljsn::Decoder              decoder;
+
+                    const int rc = decoder.decode(&isb, &object, options);
+                    ASSERTV(decodable[k], rc, 0 == rc);
+                }
+            }
+
+            timer.stop();
+
+            const double seconds = timer.accumulatedUserTime();
+            const double megabytes =
+                       static_cast<double>(numBytes) * NUM_ITERATIONS / 1.0e6;
+
+            cout << "allowMissingRequiredAttributes = " << allowMissing
+                 << ": " << decodable.size() << " messages, " << numBytes
+                 << " bytes, " << NUM_ITERATIONS << " iterations: " << seconds
+                 << " s, " << megabytes / seconds << " MB/s" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -15,6 +15,7 @@ BSLS_IDENT_RCSID(ball_asyncfileobserver_cpp,"$Id$ $CSID$")
 #include <bdlt_currenttime.h>
 
 #include <bslma_default.h>
+#include <bslmf_movableref.h>
 #include <bslmt_lockguard.h>
 #include <bslmt_mutexassert.h>
 #include <bslmt_threadattributes.h>
@@ -30,6 +31,18 @@ BSLS_IDENT_RCSID(ball_asyncfileobserver_cpp,"$Id$ $CSID$")
 // To communicate the last record to be published when 'stopThread' (or
 // 'stopPublicationThread') is called, a special record is enqueued
 // (created using 'createStopRecord') for which 'isStopRecord' is 'false'.
+//
+// 'AsyncFileObserver_RecordRing' is a bounded multi-producer, single-consumer
+// ring in the style of Dmitry Vyukov's bounded queue: slot 'i % capacity'
+// carries a sequence number that is 'i' when the slot is free to be claimed
+// for push index 'i', and 'i + 1' once the record pushed at index 'i' is
+// readable.  Popping the record at index 'i' sets the sequence number to
+// 'i + capacity', freeing the slot for the next lap.  Blocking uses a mutex
+// and conditions only on the slow path: the consumer (or a producer) sets
+// 'd_consumerWaiting' (or increments 'd_numPushWaiters') under the mutex and
+// then re-checks the ring, while the other side updates a slot sequence
+// number and then reads the flag; both accesses being sequentially
+// consistent, at least one side observes the other, so no wake-up is lost.
 
 namespace BloombergLP {
 namespace ball {
@@ -38,7 +51,9 @@ namespace {
 
 enum {
     k_DEFAULT_FIXED_QUEUE_SIZE = 8192,
-    k_FORCE_WARN_THRESHOLD     = 5000
+    k_FORCE_WARN_THRESHOLD     = 5000,
+    k_MAX_BATCH_SIZE           =   64,  // records popped at once from a ring
+    k_NUM_POP_SPINS            =    4   // yields before the consumer blocks
 };
 
 static const char *const k_LOG_CATEGORY = "BALL.ASYNCFILEOBSERVER";
@@ -153,10 +168,282 @@ bool isStopRecord(const AsyncFileObserver_Record& record)
 
 }  // close unnamed namespace
 
+                    // ----------------------------------
+                    // class AsyncFileObserver_RecordRing
+                    // ----------------------------------
+
+// PRIVATE MANIPULATORS
+int AsyncFileObserver_RecordRing::pushImp(
+                            bslmf::MovableRef<AsyncFileObserver_Record> record)
+{
+    typedef bdlcc::BoundedQueue<AsyncFileObserver_Record> Status;
+
+    Uint64 index = d_pushIndex.loadRelaxed();
+
+    for (;;) {
+        // The load is sequentially consistent (not merely acquire): a
+        // producer retrying after registering in `d_numPushWaiters` must
+        // either observe a slot released by the consumer or be observed by
+        // the consumer's subsequent read of `d_numPushWaiters`.
+
+        Slot&        slot     = d_slots_p[index & d_mask];
+        const Uint64 sequence = slot.d_sequence.load();
+
+        if (sequence == index) {
+            const Uint64 previous = d_pushIndex.testAndSwapAcqRel(index,
+                                                                  index + 1);
+            if (previous == index) {
+                new (slot.d_record.buffer()) AsyncFileObserver_Record(
+                                 bslmf::MovableRefUtil::move(
+                                     bslmf::MovableRefUtil::access(record)));
+
+                slot.d_sequence = index + 1;
+                return 0;                                             // RETURN
+            }
+            index = previous;
+        }
+        else if (sequence < index) {
+            // The slot still holds the record pushed one lap ago.
+
+            return Status::e_FULL;                                    // RETURN
+        }
+        else {
+            index = d_pushIndex.loadRelaxed();
+        }
+    }
+}
+
+void AsyncFileObserver_RecordRing::releaseSlot(Uint64 index)
+{
+    Slot& slot = d_slots_p[index & d_mask];
+
+    slot.d_record.object().~AsyncFileObserver_Record();
+    slot.d_sequence = index + d_mask + 1;
+}
+
+void AsyncFileObserver_RecordRing::signalProducers()
+{
+    if (0 < d_numPushWaiters) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_pushCondition.broadcast();
+    }
+}
+
+// PRIVATE ACCESSORS
+bool AsyncFileObserver_RecordRing::isReadable(Uint64 index) const
+{
+    return d_slots_p[index & d_mask].d_sequence == index + 1;
+}
+
+// CREATORS
+AsyncFileObserver_RecordRing::AsyncFileObserver_RecordRing(
+                                              bsl::size_t       capacity,
+                                              bslma::Allocator *basicAllocator)
+: d_pushIndex(0)
+, d_popIndex(0)
+, d_consumerWaiting(0)
+, d_numPushWaiters(0)
+, d_popDisabled(false)
+, d_slots_p(0)
+, d_mask(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < capacity);
+
+    Uint64 size = 1;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    d_mask = size - 1;
+
+    d_slots_p = static_cast<Slot *>(
+                    d_allocator_p->allocate(static_cast<bsl::size_t>(size)
+                                                             * sizeof(Slot)));
+    for (Uint64 i = 0; i < size; ++i) {
+        new (d_slots_p + i) Slot();
+        d_slots_p[i].d_sequence.storeRelaxed(i);
+    }
+}
+
+AsyncFileObserver_RecordRing::~AsyncFileObserver_RecordRing()
+{
+    removeAll();
+    d_allocator_p->deallocate(d_slots_p);
+}
+
+// MANIPULATORS
+void AsyncFileObserver_RecordRing::disablePopFront()
+{
+    d_popDisabled = true;
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    d_popCondition.broadcast();
+}
+
+void AsyncFileObserver_RecordRing::enablePopFront()
+{
+    d_popDisabled = false;
+}
+
+int AsyncFileObserver_RecordRing::popFrontBatch(
+                                      AsyncFileObserver_Record *records,
+                                      int                       maxNumRecords,
+                                      int                      *numPopped)
+{
+    typedef bdlcc::BoundedQueue<AsyncFileObserver_Record> Status;
+
+    BSLS_ASSERT(records);
+    BSLS_ASSERT(0 < maxNumRecords);
+    BSLS_ASSERT(numPopped);
+
+    *numPopped = 0;
+
+    Uint64 index = d_popIndex.loadRelaxed();
+
+    for (int i = 0; i < k_NUM_POP_SPINS && !isReadable(index); ++i) {
+        bslmt::ThreadUtil::yield();
+    }
+
+    if (!isReadable(index)) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        d_consumerWaiting = 1;
+        while (!d_popDisabled && !isReadable(index)) {
+            d_popCondition.wait(&d_mutex);
+        }
+        d_consumerWaiting = 0;
+    }
+
+    if (d_popDisabled) {
+        return Status::e_DISABLED;                                    // RETURN
+    }
+
+    int n = 0;
+    do {
+        AsyncFileObserver_Record& record =
+                                   d_slots_p[index & d_mask].d_record.object();
+
+        records[n] = bslmf::MovableRefUtil::move(record);
+        releaseSlot(index);
+        ++index;
+    } while (++n < maxNumRecords
+          && !isStopRecord(records[n - 1])
+          && isReadable(index));
+
+    d_popIndex.storeRelease(index);
+    *numPopped = n;
+
+    signalProducers();
+
+    return 0;
+}
+
+int AsyncFileObserver_RecordRing::pushBack(
+                            bslmf::MovableRef<AsyncFileObserver_Record> record)
+{
+    if (0 == tryPushBack(bslmf::MovableRefUtil::move(record))) {
+        return 0;                                                     // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    ++d_numPushWaiters;
+    while (0 != pushImp(bslmf::MovableRefUtil::move(record))) {
+        d_pushCondition.wait(&d_mutex);
+    }
+    --d_numPushWaiters;
+
+    if (d_consumerWaiting) {
+        d_popCondition.signal();
+    }
+
+    return 0;
+}
+
+void AsyncFileObserver_RecordRing::removeAll()
+{
+    Uint64 index = d_popIndex.loadRelaxed();
+
+    while (isReadable(index)) {
+        releaseSlot(index);
+        ++index;
+    }
+    d_popIndex.storeRelease(index);
+
+    signalProducers();
+}
+
+int AsyncFileObserver_RecordRing::tryPushBack(
+                            bslmf::MovableRef<AsyncFileObserver_Record> record)
+{
+    const int rc = pushImp(bslmf::MovableRefUtil::move(record));
+
+    if (0 == rc && d_consumerWaiting) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_popCondition.signal();
+    }
+
+    return rc;
+}
+
                        // -----------------------
                        // class AsyncFileObserver
                        // -----------------------
 
+void AsyncFileObserver::disablePopFront()
+{
+    if (e_RECORD_RING == d_recordQueueType) {
+        d_recordRing.object().disablePopFront();
+    }
+    else {
+        d_recordQueue.object().disablePopFront();
+    }
+}
+
+void AsyncFileObserver::enablePopFront()
+{
+    if (e_RECORD_RING == d_recordQueueType) {
+        d_recordRing.object().enablePopFront();
+    }
+    else {
+        d_recordQueue.object().enablePopFront();
+    }
+}
+
+int AsyncFileObserver::popRecords(AsyncFileObserver_Record *records,
+                                  int                       maxNumRecords,
+                                  int                      *numPopped)
+{
+    if (e_RECORD_RING == d_recordQueueType) {
+        return d_recordRing.object().popFrontBatch(records,
+                                                   maxNumRecords,
+                                                   numPopped);        // RETURN
+    }
+
+    const int rc = d_recordQueue.object().popFront(records);
+
+    *numPopped = 0 == rc ? 1 : 0;
+    return rc;
+}
+
+void AsyncFileObserver::publishRecord(
+                                  const AsyncFileObserver_Record&  record,
+                                  bsl::shared_ptr<Record>         *rendered)
+{
+    if (record.d_record->fixedFields().isMessageDeferred()) {
+        if (!*rendered) {
+            *rendered = bsl::allocate_shared<Record>(d_allocator_p);
+        }
+        **rendered = *record.d_record;
+        (*rendered)->fixedFields().renderMessage();
+
+        d_fileObserver.publish(*rendered, record.d_context);
+    }
+    else {
+        d_fileObserver.publish(record.d_record, record.d_context);
+    }
+}
+
 void AsyncFileObserver::publishThreadEntryPoint()
 {
     typedef bdlcc::BoundedQueue<AsyncFileObserver_Record> Status;
@@ -170,21 +457,42 @@ void AsyncFileObserver::publishThreadEntryPoint()
 
     BSLS_ASSERT(e_RUNNING == d_threadState);
 
+    // Records having a deferred message are rendered into this copy, which
+    // is private to the publication thread, rather than modifying the
+    // (shared) published record.
+
+    bsl::shared_ptr<Record> rendered;
+
+    // Records are removed from a ring in batches, and from a bounded queue
+    // one at a time.  A batch ends with a stop record, if it holds one.
+
+    AsyncFileObserver_Record records[k_MAX_BATCH_SIZE];
+
+    const int maxBatchSize = e_RECORD_RING == d_recordQueueType
+                           ? static_cast<int>(k_MAX_BATCH_SIZE)
+                           : 1;
+
     bool done = false;
 
     while (!done) {
-        AsyncFileObserver_Record record;
-
-        int rc = d_recordQueue.popFront(&record);
+        int numPopped = 0;
+        int rc        = popRecords(records, maxBatchSize, &numPopped);
 
         BSLS_ASSERT(0 == rc
                  || Status::e_DISABLED == rc
                  || Status::e_FAILED   == rc);
 
-        if (Status::e_SUCCESS == rc && !isStopRecord(record)) {
-            d_fileObserver.publish(record.d_record, record.d_context);
+        for (int i = 0; i < numPopped; ++i) {
+            if (isStopRecord(records[i])) {
+                done = true;
+            }
+            else {
+                publishRecord(records[i], &rendered);
+                records[i].d_record.reset();
+            }
         }
-        else {
+
+        if (Status::e_SUCCESS != rc) {
             done = true;
         }
 
@@ -196,7 +504,7 @@ void AsyncFileObserver::publishThreadEntryPoint()
         // shutting down, so the information is not lost.
 
         if (0 < d_dropCount.loadRelaxed()) {
-            if (d_recordQueue.numElements() <= d_recordQueue.numElements() / 2
+            if (recordQueueLength()         <= recordQueueLength() / 2
             ||  d_dropCount.loadRelaxed()   >= k_FORCE_WARN_THRESHOLD
             ||  done) {
                 int numDropped = d_dropCount.swap(0);
@@ -214,13 +522,43 @@ void AsyncFileObserver::publishThreadEntryPoint()
             // the queue.
 
             logQueueFailureError(&d_fileObserver);
-            d_recordQueue.removeAll();
+            removeAllRecords();
         }
     }
     d_threadState = e_NOT_RUNNING;
 }
 
-void AsyncFileObserver::construct()
+int AsyncFileObserver::pushRecord(AsyncFileObserver_Record *record,
+                                  bool                      block)
+{
+    if (e_RECORD_RING == d_recordQueueType) {
+        AsyncFileObserver_RecordRing& ring = d_recordRing.object();
+
+        return block
+             ? ring.pushBack(bslmf::MovableRefUtil::move(*record))
+             : ring.tryPushBack(bslmf::MovableRefUtil::move(*record));
+                                                                      // RETURN
+    }
+
+    bdlcc::BoundedQueue<AsyncFileObserver_Record>& queue =
+                                                       d_recordQueue.object();
+
+    return block
+         ? queue.pushBack(bslmf::MovableRefUtil::move(*record))
+         : queue.tryPushBack(bslmf::MovableRefUtil::move(*record));
+}
+
+void AsyncFileObserver::removeAllRecords()
+{
+    if (e_RECORD_RING == d_recordQueueType) {
+        d_recordRing.object().removeAll();
+    }
+    else {
+        d_recordQueue.object().removeAll();
+    }
+}
+
+void AsyncFileObserver::construct(int maxRecordQueueSize)
 {
     d_threadHandle = bslmt::ThreadUtil::invalidHandle();
     d_threadState  = e_NOT_RUNNING;
@@ -231,40 +569,55 @@ void AsyncFileObserver::construct()
             bsl::allocator<bsl::function<void()> >(d_allocator_p),
             bdlf::MemFnUtil::memFn(&AsyncFileObserver::publishThreadEntryPoint,
                                    this));
+
+    // The record container is created last, so that no other initialization
+    // can throw once it exists.
+
+    if (e_RECORD_RING == d_recordQueueType) {
+        new (d_recordRing.buffer()) AsyncFileObserver_RecordRing(
+                                                            maxRecordQueueSize,
+                                                            d_allocator_p);
+    }
+    else {
+        new (d_recordQueue.buffer())
+                 bdlcc::BoundedQueue<AsyncFileObserver_Record>(
+                                                            maxRecordQueueSize,
+                                                            d_allocator_p);
+    }
 }
 
 // CREATORS
 AsyncFileObserver::AsyncFileObserver(bslma::Allocator *basicAllocator)
 : d_fileObserver(Severity::e_WARN, basicAllocator)
-, d_recordQueue(k_DEFAULT_FIXED_QUEUE_SIZE, basicAllocator)
+, d_recordQueueType(e_BOUNDED_QUEUE)
 , d_threadState(e_NOT_RUNNING)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
-    construct();
+    construct(k_DEFAULT_FIXED_QUEUE_SIZE);
 }
 
 AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
                                      bslma::Allocator *basicAllocator)
 : d_fileObserver(stdoutThreshold, basicAllocator)
-, d_recordQueue(k_DEFAULT_FIXED_QUEUE_SIZE, basicAllocator)
+, d_recordQueueType(e_BOUNDED_QUEUE)
 , d_threadState(e_NOT_RUNNING)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
-    construct();
+    construct(k_DEFAULT_FIXED_QUEUE_SIZE);
 }
 
 AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
                                      bool              publishInLocalTime,
                                      bslma::Allocator *basicAllocator)
 : d_fileObserver(stdoutThreshold, publishInLocalTime, basicAllocator)
-, d_recordQueue(k_DEFAULT_FIXED_QUEUE_SIZE, basicAllocator)
+, d_recordQueueType(e_BOUNDED_QUEUE)
 , d_threadState(e_NOT_RUNNING)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
-    construct();
+    construct(k_DEFAULT_FIXED_QUEUE_SIZE);
 }
 
 AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
@@ -272,12 +625,27 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
                                      int               maxRecordQueueSize,
                                      bslma::Allocator *basicAllocator)
 : d_fileObserver(stdoutThreshold, publishInLocalTime, basicAllocator)
-, d_recordQueue(maxRecordQueueSize, basicAllocator)
+, d_recordQueueType(e_BOUNDED_QUEUE)
 , d_threadState(e_NOT_RUNNING)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
-    construct();
+    construct(maxRecordQueueSize);
+}
+
+AsyncFileObserver::AsyncFileObserver(
+                             Severity::Level   stdoutThreshold,
+                             bool              publishInLocalTime,
+                             int               maxRecordQueueSize,
+                             Severity::Level   dropRecordsOnFullQueueThreshold,
+                             bslma::Allocator *basicAllocator)
+: d_fileObserver(stdoutThreshold, publishInLocalTime, basicAllocator)
+, d_recordQueueType(e_BOUNDED_QUEUE)
+, d_threadState(e_NOT_RUNNING)
+, d_dropRecordsOnFullQueueThreshold(dropRecordsOnFullQueueThreshold)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    construct(maxRecordQueueSize);
 }
 
 AsyncFileObserver::AsyncFileObserver(
@@ -285,19 +653,31 @@ AsyncFileObserver::AsyncFileObserver(
                              bool              publishInLocalTime,
                              int               maxRecordQueueSize,
                              Severity::Level   dropRecordsOnFullQueueThreshold,
+                             RecordQueueType   recordQueueType,
                              bslma::Allocator *basicAllocator)
 : d_fileObserver(stdoutThreshold, publishInLocalTime, basicAllocator)
-, d_recordQueue(maxRecordQueueSize, basicAllocator)
+, d_recordQueueType(recordQueueType)
 , d_threadState(e_NOT_RUNNING)
 , d_dropRecordsOnFullQueueThreshold(dropRecordsOnFullQueueThreshold)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
-    construct();
+    BSLS_ASSERT(0 < maxRecordQueueSize);
+
+    construct(maxRecordQueueSize);
 }
 
 AsyncFileObserver::~AsyncFileObserver()
 {
     stopPublicationThread();
+
+    if (e_RECORD_RING == d_recordQueueType) {
+        d_recordRing.object().~AsyncFileObserver_RecordRing();
+    }
+    else {
+        typedef bdlcc::BoundedQueue<AsyncFileObserver_Record> RecordQueue;
+
+        d_recordQueue.object().~RecordQueue();
+    }
 }
 
 // MANIPULATORS
@@ -311,10 +691,9 @@ void AsyncFileObserver::publish(const bsl::shared_ptr<const Record>& record,
     asyncRecord.d_record  = record;
     asyncRecord.d_context = context;
 
-    int rc = (record->fixedFields().severity()
-                                           > d_dropRecordsOnFullQueueThreshold)
-      ? d_recordQueue.tryPushBack(asyncRecord)
-      : d_recordQueue.pushBack(asyncRecord);
+    int rc = pushRecord(&asyncRecord,
+                        record->fixedFields().severity()
+                                        <= d_dropRecordsOnFullQueueThreshold);
 
     if (0 != rc) {
       d_dropCount.addRelaxed(1);
@@ -326,7 +705,7 @@ void AsyncFileObserver::releaseRecords()
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
     if (isPublicationThreadRunning()) {
-        d_recordQueue.disablePopFront();
+        disablePopFront();
 
         // If either destroying or creating the publication thread fails, it is
         // a catastrophic error.
@@ -338,10 +717,10 @@ void AsyncFileObserver::releaseRecords()
             return;                                                   // RETURN
         }
 
-        d_recordQueue.removeAll();
+        removeAllRecords();
 
         d_threadState = e_RUNNING;
-        d_recordQueue.enablePopFront();
+        enablePopFront();
 
         bslmt::ThreadAttributes attr;
         setPublicationThreadAttributes(&attr);
@@ -353,7 +732,7 @@ void AsyncFileObserver::releaseRecords()
         }
     }
     else {
-        d_recordQueue.removeAll();
+        removeAllRecords();
     }
 }
 
@@ -373,7 +752,7 @@ int AsyncFileObserver::shutdownPublicationThread()
     if (bslmt::ThreadUtil::invalidHandle() != d_threadHandle) {
         BSLS_ASSERT(e_RUNNING == d_threadState);
 
-        d_recordQueue.disablePopFront();
+        disablePopFront();
 
         result = bslmt::ThreadUtil::join(d_threadHandle);
         d_threadHandle = bslmt::ThreadUtil::invalidHandle();
@@ -405,7 +784,7 @@ int AsyncFileObserver::startPublicationThread()
         BSLS_ASSERT(e_NOT_RUNNING == d_threadState);
 
         d_threadState = e_RUNNING;
-        d_recordQueue.enablePopFront();
+        enablePopFront();
 
         bslmt::ThreadAttributes attr;
         setPublicationThreadAttributes(&attr);
@@ -445,7 +824,7 @@ int AsyncFileObserver::stopPublicationThread()
 
             int rc;
             do {
-                rc = d_recordQueue.tryPushBack(asyncRecord);
+                rc = pushRecord(&asyncRecord, false);
                 bslmt::ThreadUtil::yield();
             } while (Status::e_FULL == rc && d_threadState != e_NOT_RUNNING);
         }
@@ -459,6 +838,12 @@ int AsyncFileObserver::stopPublicationThread()
     return result;
 }
 
+// ACCESSORS
+bool AsyncFileObserver::supportsDeferredMessages() const
+{
+    return true;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
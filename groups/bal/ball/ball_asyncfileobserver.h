@@ -95,6 +95,7 @@ BSLS_IDENT("$Id: $")
 // +-----------------------+---------------------------------+
 // | Log Record Queue      | maxRecordQueueSize              |
 // |                       | dropRecordsOnFullQueueThreshold |
+// |                       | recordQueueType                 |
 // +-----------------------+---------------------------------+
 //
 // +-------------+------------------------------------+
@@ -174,6 +175,29 @@ BSLS_IDENT("$Id: $")
 // record count is reset to 0 after each such warning is published, so each
 // dropped record is counted only once.
 //
+///Record Queue Types
+/// - - - - - - - - -
+// By default the record queue is a `bdlcc::BoundedQueue`, and the publication
+// thread removes records from it one at a time.  Supplying
+// `e_RECORD_RING` for the `recordQueueType` constructor argument selects
+// instead a lock-free, multi-producer, single-consumer ring whose capacity is
+// `maxRecordQueueSize` rounded up to a power of two.  With the ring, a
+// logging thread appends a record with a single compare-and-swap and signals
+// the publication thread only when that thread is idle, and the publication
+// thread removes all available records (up to a fixed batch size) at once.
+// This lowers the latency of `publish`, particularly when several threads log
+// concurrently.  The dropping and blocking behavior on a full queue is the
+// same for both kinds of queue.
+//
+///Deferred Messages
+///-----------------
+// An async file observer supports records having a deferred message (see
+// `ball_observer` and `ball_deferredfmt`): the message of such a record is
+// rendered by the publication thread, so that the cost of formatting the
+// message is not incurred by the logging thread.  The rendered message is
+// written to a copy of the record that is private to the publication thread;
+// the published record is not modified.
+//
 ///Log Record Formatting
 ///---------------------
 // By default, the output format of published log records (whether to `stdout`
@@ -572,13 +596,19 @@ BSLS_IDENT("$Id: $")
 
 #include <bslma_allocator.h>
 
+#include <bslmf_movableref.h>
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
 #include <bslmt_threadutil.h>
 
 #include <bsls_atomic.h>
 #include <bsls_keyword.h>
 #include <bsls_libraryfeatures.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_types.h>
 
 #include <bsl_functional.h>
 #include <bsl_memory.h>
@@ -602,6 +632,160 @@ struct AsyncFileObserver_Record {
     Context                       d_context;  // context of log record
 };
 
+                    // ==================================
+                    // class AsyncFileObserver_RecordRing
+                    // ==================================
+
+/// PRIVATE CLASS.  For use by the `ball::AsyncFileObserver` implementation
+/// only.  This class provides a fixed-capacity, multi-producer,
+/// single-consumer ring of `AsyncFileObserver_Record` objects.  A producer
+/// claims a slot with a single compare-and-swap on the push index and
+/// publishes the slot by advancing the slot's sequence number, so pushing a
+/// record acquires no lock and signals the consumer only if the consumer is
+/// blocked waiting for records.  The (single) consumer removes records in
+/// batches.  The status values returned by the methods of this class are those
+/// of `bdlcc::BoundedQueue`.
+class AsyncFileObserver_RecordRing {
+
+    // PRIVATE TYPES
+
+    /// A slot of the ring.  A slot whose `d_sequence` equals the index being
+    /// pushed is free; a slot whose `d_sequence` is one more than the index
+    /// being popped holds a record.
+    struct Slot {
+        bsls::AtomicUint64                           d_sequence;
+        bsls::ObjectBuffer<AsyncFileObserver_Record> d_record;
+    };
+
+    typedef bsls::Types::Uint64 Uint64;
+
+    // DATA
+    bsls::AtomicUint64  d_pushIndex;         // index of the next slot to be
+                                             // claimed by a producer
+
+    char                d_pushIndexPad[bslmt::Platform::e_CACHE_LINE_SIZE
+                                                 - sizeof(bsls::AtomicUint64)];
+                                             // padding to keep the producer
+                                             // index on its own cache line
+
+    bsls::AtomicUint64  d_popIndex;          // index of the next slot to be
+                                             // read by the consumer
+
+    bsls::AtomicInt     d_consumerWaiting;   // 1 if the consumer is blocked
+                                             // on `d_popCondition`
+
+    bsls::AtomicInt     d_numPushWaiters;    // number of producers blocked on
+                                             // `d_pushCondition`
+
+    bsls::AtomicBool    d_popDisabled;       // `true` if `popFrontBatch` is
+                                             // disabled
+
+    Slot               *d_slots_p;           // ring storage (owned)
+
+    Uint64              d_mask;              // capacity minus 1
+
+    bslmt::Mutex        d_mutex;             // used with the conditions to
+                                             // block consumer and producers
+
+    bslmt::Condition    d_popCondition;      // signaled when a record is
+                                             // pushed to an empty ring
+
+    bslmt::Condition    d_pushCondition;     // signaled when records are
+                                             // removed from a full ring
+
+    bslma::Allocator   *d_allocator_p;       // memory allocator (held, not
+                                             // owned)
+
+    // NOT IMPLEMENTED
+    AsyncFileObserver_RecordRing(const AsyncFileObserver_RecordRing&);
+    AsyncFileObserver_RecordRing& operator=(
+                                          const AsyncFileObserver_RecordRing&);
+
+    // PRIVATE MANIPULATORS
+
+    /// Append the specified `record` to this ring, leaving `record` in a
+    /// valid but unspecified state, if the ring is not full.  Return 0 on
+    /// success, and `bdlcc::BoundedQueue::e_FULL` (with `record` unchanged)
+    /// otherwise.  Note that the consumer is not signaled.
+    int pushImp(bslmf::MovableRef<AsyncFileObserver_Record> record);
+
+    /// Destroy the record at the specified `index`, which must be the index
+    /// of the next record to be popped, and make its slot available to
+    /// producers.
+    void releaseSlot(Uint64 index);
+
+    /// Signal the producers blocked waiting for a free slot, if any.
+    void signalProducers();
+
+    // PRIVATE ACCESSORS
+
+    /// Return `true` if the slot at the specified `index` holds a record,
+    /// and `false` otherwise.
+    bool isReadable(Uint64 index) const;
+
+  public:
+    // CREATORS
+
+    /// Create a ring able to hold at least the specified `capacity` records
+    /// (the capacity is rounded up to a power of two).  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0, the
+    /// currently installed default allocator is used.  The behavior is
+    /// undefined unless `0 < capacity`.
+    explicit AsyncFileObserver_RecordRing(
+                                       bsl::size_t       capacity,
+                                       bslma::Allocator *basicAllocator = 0);
+
+    /// Destroy this ring and the records it holds.
+    ~AsyncFileObserver_RecordRing();
+
+    // MANIPULATORS
+
+    /// Disable removal of records from this ring, causing a blocked
+    /// `popFrontBatch` to return.
+    void disablePopFront();
+
+    /// Enable removal of records from this ring.
+    void enablePopFront();
+
+    /// Remove up to the specified `maxNumRecords` records from the front of
+    /// this ring, in order, into the specified `records` array, blocking
+    /// until at least one record is available, and load into the specified
+    /// `numPopped` the number of records removed.  A batch ends after the
+    /// first stop record (a record having a null `d_record`).  Return 0 on
+    /// success, and `bdlcc::BoundedQueue::e_DISABLED` (with `*numPopped` set
+    /// to 0) if removal is disabled.  The behavior is undefined unless
+    /// `0 < maxNumRecords` and this method is called from a single thread at
+    /// a time.
+    int popFrontBatch(AsyncFileObserver_Record *records,
+                      int                       maxNumRecords,
+                      int                      *numPopped);
+
+    /// Append the specified `record` to this ring, leaving `record` in a
+    /// valid but unspecified state, blocking until a slot is available.
+    /// Return 0.
+    int pushBack(bslmf::MovableRef<AsyncFileObserver_Record> record);
+
+    /// Remove and destroy all records in this ring.  The behavior is
+    /// undefined if this method is called concurrently with
+    /// `popFrontBatch`.
+    void removeAll();
+
+    /// Append the specified `record` to this ring, leaving `record` in a
+    /// valid but unspecified state, if the ring is not full.  Return 0 on
+    /// success, and `bdlcc::BoundedQueue::e_FULL` (with `record` unchanged)
+    /// otherwise.
+    int tryPushBack(bslmf::MovableRef<AsyncFileObserver_Record> record);
+
+    // ACCESSORS
+
+    /// Return the capacity of this ring.
+    bsl::size_t capacity() const;
+
+    /// Return the number of records in this ring.  Note that the value is
+    /// approximate when producers or the consumer are active.
+    bsl::size_t numElements() const;
+};
+
                           // =======================
                           // class AsyncFileObserver
                           // =======================
@@ -613,6 +797,19 @@ struct AsyncFileObserver_Record {
 /// with no guarantee of rollback.  In no event is memory leaked.
 class AsyncFileObserver : public Observer {
 
+  public:
+    // TYPES
+
+    /// Enumeration of the kinds of record queue an async file observer can
+    /// use (see {Record Queue Types}).
+    enum RecordQueueType {
+        e_BOUNDED_QUEUE,  // a `bdlcc::BoundedQueue` (the default)
+
+        e_RECORD_RING     // a lock-free multi-producer ring drained by the
+                          // publication thread in batches
+    };
+
+  private:
     // PRIVATE TYPES
 
     /// State of the publication thread, as captured by `d_threadState`.
@@ -632,10 +829,25 @@ class AsyncFileObserver : public Observer {
     bslmt::ThreadUtil::Handle      d_threadHandle;   // handle of asynchronous
                                                      // publication thread
 
-    bdlcc::BoundedQueue<AsyncFileObserver_Record>
+    const RecordQueueType          d_recordQueueType;
+                                                     // selects which of
+                                                     // `d_recordQueue` and
+                                                     // `d_recordRing` holds
+                                                     // the records
+
+    bsls::ObjectBuffer<bdlcc::BoundedQueue<AsyncFileObserver_Record> >
                                    d_recordQueue;    // fixed-size queue of
                                                      // records processed by
                                                      // the publication thread
+                                                     // (constructed only for
+                                                     // `e_BOUNDED_QUEUE`)
+
+    bsls::ObjectBuffer<AsyncFileObserver_RecordRing>
+                                   d_recordRing;     // fixed-size ring of
+                                                     // records processed by
+                                                     // the publication thread
+                                                     // (constructed only for
+                                                     // `e_RECORD_RING`)
 
     bsls::AtomicInt                d_threadState;    // the publication thread
                                                      // state, one of the
@@ -670,9 +882,32 @@ class AsyncFileObserver : public Observer {
     // PRIVATE MANIPULATORS
 
     /// Initialize members of this object that do not vary between
-    /// constructor overloads.  Note that this method should be removed when
-    /// C++11 constructor chaining is available on all supported platforms.
-    void construct();
+    /// constructor overloads, and create the record container selected by
+    /// `d_recordQueueType` with the specified `maxRecordQueueSize` capacity.
+    /// Note that this method should be removed when C++11 constructor
+    /// chaining is available on all supported platforms.
+    void construct(int maxRecordQueueSize);
+
+    /// Disable removal of records from the record queue.
+    void disablePopFront();
+
+    /// Enable removal of records from the record queue.
+    void enablePopFront();
+
+    /// Remove up to the specified `maxNumRecords` records from the record
+    /// queue into the specified `records` array, blocking until at least one
+    /// record is available, and load into the specified `numPopped` the
+    /// number of records removed.  Return 0 on success, and a non-zero
+    /// `bdlcc::BoundedQueue` status value otherwise.
+    int popRecords(AsyncFileObserver_Record *records,
+                   int                       maxNumRecords,
+                   int                      *numPopped);
+
+    /// Publish the specified `record` to the log file and `stdout`, rendering
+    /// a deferred message into the specified `rendered` record (allocated on
+    /// first use).
+    void publishRecord(const AsyncFileObserver_Record&  record,
+                       bsl::shared_ptr<Record>         *rendered);
 
     /// Publish records from the record queue, to the log file and `stdout`,
     /// until signaled to stop.  The behavior is undefined if this method is
@@ -681,6 +916,16 @@ class AsyncFileObserver : public Observer {
     /// publication thread.
     void publishThreadEntryPoint();
 
+    /// Append the specified `record` to the record queue, leaving `*record`
+    /// in a valid but unspecified state, blocking if the specified `block`
+    /// is `true` and the queue is full.  Return 0 on success, and a non-zero
+    /// `bdlcc::BoundedQueue` status value (with `*record` unchanged)
+    /// otherwise.
+    int pushRecord(AsyncFileObserver_Record *record, bool block);
+
+    /// Remove and destroy all records on the record queue.
+    void removeAllRecords();
+
   public:
     // TYPES
 
@@ -772,6 +1017,30 @@ class AsyncFileObserver : public Observer {
                       Severity::Level   dropRecordsOnFullQueueThreshold,
                       bslma::Allocator *basicAllocator = 0);
 
+    /// Create an async file observer that asynchronously publishes log
+    /// records to `stdout` if their severity is at least as severe as the
+    /// specified `stdoutThreshold` level, and has file logging initially
+    /// disabled.  The timestamp attribute of published records is written
+    /// in local time if the specified `publishInLocalTime` flag is `true`,
+    /// and in UTC time otherwise.  Records received by the `publish` method
+    /// are appended to a record queue of the specified `recordQueueType`
+    /// having the specified (fixed) `maxRecordQueueSize` (rounded up to a
+    /// power of two for `e_RECORD_RING`), and published later by an
+    /// independent publication thread.  Records received when the queue is
+    /// full whose severity is less severe than the specified
+    /// `dropRecordsOnFullQueueThreshold` are discarded; the others block the
+    /// calling thread until space is available.  (See {Log Record Queue} and
+    /// {Record Queue Types} for further information.)  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.  The behavior is
+    /// undefined unless `0 < maxRecordQueueSize`.
+    AsyncFileObserver(Severity::Level   stdoutThreshold,
+                      bool              publishInLocalTime,
+                      int               maxRecordQueueSize,
+                      Severity::Level   dropRecordsOnFullQueueThreshold,
+                      RecordQueueType   recordQueueType,
+                      bslma::Allocator *basicAllocator = 0);
+
     /// Publish all records that were on the record queue upon entry if a
     /// publication thread is running, stop the publication thread (if any),
     /// close the log file if file logging is enabled, and destroy this
@@ -1098,6 +1367,9 @@ class AsyncFileObserver : public Observer {
     /// this async file observer.
     bsl::size_t recordQueueLength() const;
 
+    /// Return the kind of record queue used by this async file observer.
+    RecordQueueType recordQueueType() const;
+
     /// Return the log file lifetime that will trigger a file rotation by
     /// this async file observer if rotation-on-lifetime is in effect, and a
     /// 0 time interval otherwise.
@@ -1113,12 +1385,38 @@ class AsyncFileObserver : public Observer {
     /// threshold less severe than `stdoutThreshold()` may still be output
     /// to the log file if file logging is enabled.
     Severity::Level stdoutThreshold() const;
+
+    /// Return `true`, as the messages of records having a deferred message
+    /// are rendered by the publication thread of this async file observer.
+    bool supportsDeferredMessages() const BSLS_KEYWORD_OVERRIDE;
 };
 
 // ============================================================================
 //                              INLINE DEFINITIONS
 // ============================================================================
 
+                    // ----------------------------------
+                    // class AsyncFileObserver_RecordRing
+                    // ----------------------------------
+
+// ACCESSORS
+inline
+bsl::size_t AsyncFileObserver_RecordRing::capacity() const
+{
+    return static_cast<bsl::size_t>(d_mask + 1);
+}
+
+inline
+bsl::size_t AsyncFileObserver_RecordRing::numElements() const
+{
+    const Uint64 popIndex  = d_popIndex.loadAcquire();
+    const Uint64 pushIndex = d_pushIndex.loadAcquire();
+
+    return pushIndex > popIndex
+         ? static_cast<bsl::size_t>(pushIndex - popIndex)
+         : 0;
+}
+
                           // -----------------------
                           // class AsyncFileObserver
                           // -----------------------
@@ -1346,7 +1644,15 @@ bdlt::DatetimeInterval AsyncFileObserver::localTimeOffset() const
 inline
 bsl::size_t AsyncFileObserver::recordQueueLength() const
 {
-    return d_recordQueue.numElements();
+    return e_RECORD_RING == d_recordQueueType
+           ? d_recordRing.object().numElements()
+           : d_recordQueue.object().numElements();
+}
+
+inline
+AsyncFileObserver::RecordQueueType AsyncFileObserver::recordQueueType() const
+{
+    return d_recordQueueType;
 }
 
 inline
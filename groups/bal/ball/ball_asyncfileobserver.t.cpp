@@ -39,7 +39,12 @@
 #include <bsls_stopwatch.h>
 #include <bsls_systemtime.h>
 #include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
 
+#include <bsl_algorithm.h>   // `sort`
+
+#include <bsl_cctype.h>      // `toupper`
 #include <bsl_climits.h>
 #include <bsl_cmath.h>
 #include <bsl_cstddef.h>
@@ -95,6 +100,7 @@ using bsl::flush;
 // [ X] AsyncFileObserver(ball::Severity::Level, bool, bslma::Allocator *);
 // [ 5] AsyncFileObserver(Severity::Level, bool, int, bslma::Allocator *);
 // [ 5] AsyncFileObserver(Severity, bool, int, Severity, Allocator *);
+// [17] AsyncFileObserver(Severity, bool, int, Severity, Type, Alloc *);
 // [ 2] ~AsyncFileObserver();
 //
 // MANIPULATORS
@@ -132,6 +138,8 @@ using bsl::flush;
 // [ 1] bool isStdoutLoggingPrefixEnabled() const;
 // [ 1] bool isUserFieldsLoggingEnabled() const;
 // [11] int recordQueueLength() const;
+// [17] RecordQueueType recordQueueType() const;
+// [16] bool supportsDeferredMessages() const;
 // [ 6] bdlt::DatetimeInterval rotationLifetime() const;
 // [ 6] int rotationSize() const;
 // [ 1] ball::Severity::Level stdoutThreshold() const;
@@ -145,6 +153,9 @@ using bsl::flush;
 // [ 9] CONCERN: ROTATION
 // [14] TESTING SUPPRESS UNIQUE FILE NAME ON ROTATION
 // [15] USAGE EXAMPLE
+// [16] TESTING DEFERRED MESSAGES
+// [17] TESTING RECORD RING
+// [-1] PUBLISH LATENCY BENCHMARK
 
 // Note assert and debug macros all output to `cerr` instead of cout, unlike
 // most other test drivers.  This is necessary because test case 2 plays tricks
@@ -262,6 +273,19 @@ bsl::shared_ptr<ball::Record> createRecord(const bsl::string&     message,
     return result;
 }
 
+/// Write to the specified `output` the upper-case version of the specified
+/// `length` characters at the specified `data` address.  Note that this
+/// function has the signature of `ball::RecordAttributes::MessageRenderer`.
+void upperCaseRenderer(bsl::streambuf *output,
+                       const char     *data,
+                       bsl::size_t     length)
+{
+    for (bsl::size_t i = 0; i < length; ++i) {
+        output->sputc(static_cast<char>(bsl::toupper(
+                                       static_cast<unsigned char>(data[i]))));
+    }
+}
+
 /// Replace the second space character (' ') in the specified `input` string
 /// with the specified `value`.  Return the index position of the character
 /// that was replaced on success, and `bsl::string::npos` otherwise.
@@ -625,6 +649,89 @@ void releaser(ball::AsyncFileObserver *observer,
 
 }  // close namespace BALL_ASYNCFILEOBSERVER_RELEASERECORDS_TEST
 
+namespace BALL_ASYNCFILEOBSERVER_RECORD_RING_TEST {
+
+typedef ball::AsyncFileObserver_RecordRing Ring;
+
+/// This `struct` holds the arguments of `ringProducer`.
+struct RingProducerArgs {
+    Ring                          *d_ring_p;       // ring to push to
+    bsl::shared_ptr<ball::Record>  d_record;       // record identifying the
+                                                   // producer
+    int                            d_numRecords;   // number of records to
+                                                   // push
+};
+
+/// Push onto the ring `d_numRecords` records, each holding the record
+/// supplied in the specified `arg` (a `RingProducerArgs`) and having a
+/// context whose record index is its position in the sequence of records
+/// pushed by this producer, blocking when the ring is full.
+extern "C" void *ringProducer(void *arg)
+{
+    RingProducerArgs *args = static_cast<RingProducerArgs *>(arg);
+
+    for (int i = 0; i < args->d_numRecords; ++i) {
+        ball::AsyncFileObserver_Record record;
+
+        record.d_record  = args->d_record;
+        record.d_context = ball::Context(ball::Transmission::e_TRIGGER,
+                                         i,
+                                         args->d_numRecords);
+
+        ASSERT(0 == args->d_ring_p->pushBack(
+                                       bslmf::MovableRefUtil::move(record)));
+    }
+    return 0;
+}
+
+/// Return a ring record holding the specified `record` (a stop record if
+/// `record` is null).
+ball::AsyncFileObserver_Record makeRingRecord(
+                                 const bsl::shared_ptr<ball::Record>& record)
+{
+    ball::AsyncFileObserver_Record result;
+    result.d_record = record;
+    return result;
+}
+
+}  // close namespace BALL_ASYNCFILEOBSERVER_RECORD_RING_TEST
+
+namespace BALL_ASYNCFILEOBSERVER_LATENCY_BENCHMARK {
+
+/// This `struct` holds the arguments and the results of
+/// `latencyPublisher`.
+struct LatencyPublisherArgs {
+    ball::AsyncFileObserver       *d_observer_p;   // observer to publish to
+    bsl::shared_ptr<ball::Record>  d_record;       // record to publish
+    bslmt::Barrier                *d_barrier_p;    // start barrier
+    bsl::vector<bsls::Types::Int64>
+                                   d_latencies;    // nanoseconds per
+                                                   // `publish` call
+};
+
+/// Publish to the observer supplied in the specified `arg` (a
+/// `LatencyPublisherArgs`) as many times as there are elements in
+/// `d_latencies`, loading the duration of each call to `publish`, in
+/// nanoseconds, into the corresponding element of `d_latencies`.
+extern "C" void *latencyPublisher(void *arg)
+{
+    LatencyPublisherArgs *args = static_cast<LatencyPublisherArgs *>(arg);
+
+    const ball::Context context;
+    const bsl::size_t   numRecords = args->d_latencies.size();
+
+    args->d_barrier_p->wait();
+
+    for (bsl::size_t i = 0; i < numRecords; ++i) {
+        const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+        args->d_observer_p->publish(args->d_record, context);
+        args->d_latencies[i] = bsls::TimeUtil::getTimer() - start;
+    }
+    return 0;
+}
+
+}  // close namespace BALL_ASYNCFILEOBSERVER_LATENCY_BENCHMARK
+
 //=============================================================================
 //                                 MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -643,6 +750,402 @@ int main(int argc, char *argv[])
     bslma::TestAllocator *Z = &allocator;
 
     switch (test) { case 0:
+      case 17: {
+        // --------------------------------------------------------------------
+        // TESTING RECORD RING
+        //
+        // Concerns:
+        // 1. The capacity of an `AsyncFileObserver_RecordRing` is the
+        //    requested capacity rounded up to a power of two.
+        //
+        // 2. `tryPushBack` fails with `e_FULL` on a full ring, and records
+        //    are popped in the order they were pushed.
+        //
+        // 3. `popFrontBatch` removes at most the requested number of
+        //    records, and a batch ends after a stop record.
+        //
+        // 4. `popFrontBatch` returns `e_DISABLED` while popping is disabled.
+        //
+        // 5. `removeAll` releases the records held by the ring, as does the
+        //    destructor.
+        //
+        // 6. Records pushed concurrently by several producers, blocking on a
+        //    full ring, are all popped, each producer's records in order.
+        //
+        // 7. An async file observer created with `e_RECORD_RING` reports its
+        //    record queue type and logs every record published, including
+        //    across `releaseRecords` and a restart of the publication thread.
+        //
+        // Plan:
+        // 1. Exercise a ring directly, checking capacities, status values,
+        //    batch sizes, and record use counts.  (C-1..5)
+        //
+        // 2. Run four producer threads pushing through a ring of capacity 16
+        //    and pop them in batches in the main thread, checking the record
+        //    indices of each producer's records.  (C-6)
+        //
+        // 3. Publish records from several threads to a blocking
+        //    `e_RECORD_RING` async file observer and count the records in
+        //    the log file.  (C-7)
+        //
+        // Testing:
+        //   AsyncFileObserver(Severity, bool, int, Severity, Type, Alloc *);
+        //   RecordQueueType recordQueueType() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING RECORD RING"
+                          << "\n===================" << endl;
+
+        using namespace BALL_ASYNCFILEOBSERVER_RECORD_RING_TEST;
+
+        typedef bdlcc::BoundedQueue<ball::AsyncFileObserver_Record> Status;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tCapacity, order, and status values." << endl;
+        {
+            ASSERT(1 == Ring(1, &ta).capacity());
+            ASSERT(8 == Ring(5, &ta).capacity());
+            ASSERT(8 == Ring(8, &ta).capacity());
+
+            bsl::shared_ptr<ball::Record> record =
+                             createRecord("ring", ball::Severity::e_INFO, &ta);
+
+            Ring mX(5, &ta);  const Ring& X = mX;
+
+            for (int i = 0; i < 8; ++i) {
+                ball::AsyncFileObserver_Record r = makeRingRecord(record);
+                r.d_context = ball::Context(ball::Transmission::e_TRIGGER,
+                                            i,
+                                            8);
+                ASSERTV(i,
+                        0 == mX.tryPushBack(bslmf::MovableRefUtil::move(r)));
+            }
+            ASSERT(8 == X.numElements());
+            ASSERT(9 == record.use_count());
+
+            ball::AsyncFileObserver_Record extra = makeRingRecord(record);
+            ASSERT(Status::e_FULL ==
+                          mX.tryPushBack(bslmf::MovableRefUtil::move(extra)));
+            ASSERT(extra.d_record == record);
+
+            ball::AsyncFileObserver_Record records[16];
+            int                            numPopped = -1;
+
+            ASSERT(0 == mX.popFrontBatch(records, 3, &numPopped));
+            ASSERT(3 == numPopped);
+            ASSERT(5 == X.numElements());
+
+            ASSERT(0 == mX.popFrontBatch(records + 3, 16, &numPopped));
+            ASSERT(5 == numPopped);
+            ASSERT(0 == X.numElements());
+
+            for (int i = 0; i < 8; ++i) {
+                ASSERTV(i, record == records[i].d_record);
+                ASSERTV(i, i == records[i].d_context.recordIndex());
+                records[i].d_record.reset();
+            }
+            ASSERTV(record.use_count(), 2 == record.use_count());
+
+            // A batch ends after a stop record.
+
+            ball::AsyncFileObserver_Record r1 = makeRingRecord(record);
+            ball::AsyncFileObserver_Record r2 = makeRingRecord(
+                                            bsl::shared_ptr<ball::Record>());
+            ball::AsyncFileObserver_Record r3 = makeRingRecord(record);
+
+            ASSERT(0 == mX.tryPushBack(bslmf::MovableRefUtil::move(r1)));
+            ASSERT(0 == mX.tryPushBack(bslmf::MovableRefUtil::move(r2)));
+            ASSERT(0 == mX.tryPushBack(bslmf::MovableRefUtil::move(r3)));
+
+            ASSERT(0 == mX.popFrontBatch(records, 16, &numPopped));
+            ASSERT(2 == numPopped);
+            ASSERT(records[0].d_record == record);
+            ASSERT(!records[1].d_record);
+
+            // Popping is disabled.
+
+            mX.disablePopFront();
+            ASSERT(Status::e_DISABLED ==
+                                    mX.popFrontBatch(records, 16, &numPopped));
+            ASSERT(0 == numPopped);
+            mX.enablePopFront();
+
+            ASSERT(0 == mX.popFrontBatch(records, 16, &numPopped));
+            ASSERT(1 == numPopped);
+            ASSERT(records[0].d_record == record);
+
+            for (int i = 0; i < 16; ++i) {
+                records[i].d_record.reset();
+            }
+            ASSERTV(record.use_count(), 2 == record.use_count());
+
+            // `removeAll` and the destructor release the records.
+
+            for (int i = 0; i < 3; ++i) {
+                ball::AsyncFileObserver_Record r = makeRingRecord(record);
+                ASSERT(0 == mX.pushBack(bslmf::MovableRefUtil::move(r)));
+            }
+            ASSERT(3 == X.numElements());
+            ASSERT(5 == record.use_count());
+
+            mX.removeAll();
+            ASSERT(0 == X.numElements());
+            ASSERT(2 == record.use_count());
+
+            {
+                Ring mY(4, &ta);
+                for (int i = 0; i < 3; ++i) {
+                    ball::AsyncFileObserver_Record r = makeRingRecord(record);
+                    ASSERT(0 == mY.pushBack(bslmf::MovableRefUtil::move(r)));
+                }
+                ASSERT(5 == record.use_count());
+            }
+            ASSERT(2 == record.use_count());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tConcurrent producers." << endl;
+        {
+            enum { k_NUM_PRODUCERS = 4, k_NUM_RECORDS = 20000 };
+
+            Ring mX(16, &ta);
+
+            RingProducerArgs          args[k_NUM_PRODUCERS];
+            bslmt::ThreadUtil::Handle handles[k_NUM_PRODUCERS];
+
+            for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+                args[i].d_ring_p     = &mX;
+                args[i].d_record     = createRecord("producer",
+                                                    ball::Severity::e_INFO,
+                                                    &ta);
+                args[i].d_numRecords = k_NUM_RECORDS;
+
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      ringProducer,
+                                                      &args[i]));
+            }
+
+            int                            nextIndex[k_NUM_PRODUCERS] = {};
+            int                            numReceived = 0;
+            ball::AsyncFileObserver_Record records[8];
+
+            while (numReceived < k_NUM_PRODUCERS * k_NUM_RECORDS) {
+                int numPopped = 0;
+
+                ASSERT(0 == mX.popFrontBatch(records, 8, &numPopped));
+                ASSERT(0 < numPopped && 8 >= numPopped);
+
+                for (int i = 0; i < numPopped; ++i) {
+                    int producer = 0;
+                    while (producer < k_NUM_PRODUCERS
+                        && args[producer].d_record != records[i].d_record) {
+                        ++producer;
+                    }
+                    ASSERTV(producer, k_NUM_PRODUCERS > producer);
+                    if (k_NUM_PRODUCERS == producer) {
+                        continue;
+                    }
+                    ASSERTV(producer,
+                            nextIndex[producer],
+                            records[i].d_context.recordIndex(),
+                            nextIndex[producer] ==
+                                          records[i].d_context.recordIndex());
+
+                    nextIndex[producer] =
+                                       records[i].d_context.recordIndex() + 1;
+                    records[i].d_record.reset();
+                }
+                numReceived += numPopped;
+            }
+
+            for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+                ASSERTV(i, nextIndex[i], k_NUM_RECORDS == nextIndex[i]);
+            }
+            ASSERT(0 == mX.numElements());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tAsync file observer using a ring." << endl;
+        {
+            using namespace BALL_ASYNCFILEOBSERVER_RELEASERECORDS_TEST;
+
+            ASSERT(Obj::e_BOUNDED_QUEUE == Obj(&ta).recordQueueType());
+
+            bdls::TempDirectoryGuard tempDirGuard("ball_asyncfileobserver_");
+            bsl::string              fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "test17");
+
+            enum { k_NUM_THREADS = 4, k_NUM_RECORDS = 5000 };
+
+            Obj mX(ball::Severity::e_OFF,
+                   false,
+                   100,
+                   ball::Severity::e_TRACE,
+                   Obj::e_RECORD_RING,
+                   &ta);
+            const Obj& X = mX;
+
+            ASSERT(Obj::e_RECORD_RING == X.recordQueueType());
+            ASSERT(0                  == X.recordQueueLength());
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            // Records on the ring while the thread is not running are
+            // discarded by `releaseRecords`.
+
+            bsl::shared_ptr<ball::Record> record =
+                            createRecord("ring", ball::Severity::e_INFO, &ta);
+
+            const ball::Context context;
+
+            mX.publish(record, context);
+            mX.publish(record, context);
+            ASSERT(2 == X.recordQueueLength());
+
+            mX.releaseRecords();
+            ASSERT(0 == X.recordQueueLength());
+            ASSERT(1 == record.use_count());
+
+            ASSERT(0 == mX.startPublicationThread());
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            bslmt::Barrier            barrier(k_NUM_THREADS + 1);
+            bsls::AtomicInt           releaseCounter(1);
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(
+                                   &handles[i],
+                                   bdlf::BindUtil::bind(&publisher,
+                                                        &mX,
+                                                        &releaseCounter,
+                                                        &barrier),
+                                   &ta));
+            }
+            barrier.wait();
+            bslmt::ThreadUtil::microSleep(10000);
+            releaseCounter = 0;
+            barrier.wait();
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+
+            ASSERT(0 == mX.stopPublicationThread());
+            ASSERT(0 == X.recordQueueLength());
+
+            // Restart the publication thread and publish a known number of
+            // records.
+
+            ASSERT(0 == mX.startPublicationThread());
+
+            const int numBefore = countLoggedRecords(fileName);
+
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                mX.publish(record, context);
+            }
+
+            ASSERT(0 == mX.shutdownPublicationThread());
+            ASSERT(0 == mX.startPublicationThread());
+            ASSERT(0 == mX.stopPublicationThread());
+            mX.disableFileLogging();
+
+            ASSERTV(numBefore,
+                    countLoggedRecords(fileName),
+                    numBefore + k_NUM_RECORDS == countLoggedRecords(fileName));
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING DEFERRED MESSAGES
+        //
+        // Concerns:
+        // 1. `supportsDeferredMessages` returns `true`.
+        //
+        // 2. A record holding a deferred message is logged with the rendered
+        //    message.
+        //
+        // 3. The published record itself is not modified (it may be shared
+        //    with other observers).
+        //
+        // 4. Records holding deferred and non-deferred messages can be
+        //    interleaved.
+        //
+        // Plan:
+        // 1. Publish interleaved records holding deferred and non-deferred
+        //    messages, stop the publication thread, and verify the content
+        //    of the log file and of the published records.  (C-1..4)
+        //
+        // Testing:
+        //   bool supportsDeferredMessages() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING DEFERRED MESSAGES"
+                          << "\n=========================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_asyncfileobserver_");
+        bsl::string              fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "test16");
+
+        {
+            Obj mX(ball::Severity::e_OFF, &ta);  const Obj& X = mX;
+
+            ASSERT(true == X.supportsDeferredMessages());
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            mX.startPublicationThread();
+
+            const ball::Context context(ball::Transmission::e_PASSTHROUGH,
+                                        0,
+                                        1);
+
+            const int NUM_RECORDS = 10;
+
+            bsl::vector<bsl::shared_ptr<ball::Record> > records(&ta);
+
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                bsl::ostringstream oss(&ta);
+                oss << "message " << i << " end";
+
+                bsl::shared_ptr<ball::Record> record =
+                      createRecord(oss.str(), ball::Severity::e_WARN, &ta);
+
+                if (i % 2) {
+                    record->fixedFields().setMessageRenderer(
+                                                         &upperCaseRenderer);
+                }
+
+                records.push_back(record);
+                mX.publish(record, context);
+            }
+
+            mX.stopPublicationThread();
+            mX.disableFileLogging();
+
+            const bsl::string content = readPartialFile(fileName, 0);
+
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                bsl::ostringstream oss(&ta);
+                oss << (i % 2 ? "MESSAGE " : "message ")
+                    << i
+                    << (i % 2 ? " END" : " end");
+
+                const bsl::string expected = oss.str();
+
+                ASSERTV(i, expected, content,
+                        bsl::string::npos != content.find(expected));
+
+                ASSERTV(i, (i % 2) ==
+                           records[i]->fixedFields().isMessageDeferred());
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
       case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
@@ -4106,6 +4609,120 @@ int main(int argc, char *argv[])
 
         fclose(stdout);
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PUBLISH LATENCY BENCHMARK
+        //   Measure the latency of `publish` for each record queue type.
+        //   Command line parameters:
+        //   2nd parameter: number of publishing threads (defaults to 4).
+        //   3rd parameter: number of records published by each thread
+        //       (defaults to 200000).
+        //   4th parameter: maximum record queue size (defaults to 8192).
+        //   5th parameter: name of a log file; file logging is disabled if
+        //       the name is not specified or is "-".
+        //
+        // Concerns:
+        // 1. Report the 50th, 99th, and 99.9th percentile latencies, in
+        //    nanoseconds, of `publish` for `e_BOUNDED_QUEUE` and
+        //    `e_RECORD_RING`.
+        //
+        // Plan:
+        // 1. For each record queue type, start the threads publishing to an
+        //    async file observer (which drops records when its queue is
+        //    full) at once, time each call to `publish`, and report the
+        //    percentiles of the merged samples, the number of samples, and the
+        //    number of records dropped.  (C-1)
+        //
+        // Testing:
+        //   PUBLISH LATENCY BENCHMARK
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPUBLISH LATENCY BENCHMARK"
+                          << "\n=========================" << endl;
+
+        using namespace BALL_ASYNCFILEOBSERVER_LATENCY_BENCHMARK;
+
+        typedef bsls::Types::Int64 Int64;
+
+        const int   numThreads = argc > 2 ? atoi(argv[2]) :      4;
+        const int   numRecords = argc > 3 ? atoi(argv[3]) : 200000;
+        const int   queueSize  = argc > 4 ? atoi(argv[4]) :   8192;
+        const char *logFile    = argc > 5 && bsl::strcmp(argv[5], "-")
+                               ? argv[5]
+                               : 0;
+
+        bsls::TimeUtil::initialize();
+
+        const Obj::RecordQueueType TYPES[] = { Obj::e_BOUNDED_QUEUE,
+                                               Obj::e_RECORD_RING };
+        const char *const          NAMES[] = { "BoundedQueue",
+                                               "RecordRing" };
+
+        cout << "Queue,Threads,Records,p50,p99,p99.9,Logged\n";
+
+        for (int ti = 0; ti < 2; ++ti) {
+            Obj mX(ball::Severity::e_OFF,
+                   false,
+                   queueSize,
+                   ball::Severity::e_OFF,
+                   TYPES[ti],
+                   &allocator);
+
+            if (logFile) {
+                bsl::remove(logFile);
+                ASSERT(0 == mX.enableFileLogging(logFile));
+            }
+            ASSERT(0 == mX.startPublicationThread());
+
+            bsl::vector<LatencyPublisherArgs> args(numThreads);
+            bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads);
+            bslmt::Barrier                         barrier(numThreads);
+
+            for (int i = 0; i < numThreads; ++i) {
+                args[i].d_observer_p = &mX;
+                args[i].d_record     = createRecord("latency benchmark",
+                                                    ball::Severity::e_INFO,
+                                                    &allocator);
+                args[i].d_barrier_p  = &barrier;
+                args[i].d_latencies.resize(numRecords);
+
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      latencyPublisher,
+                                                      &args[i]));
+            }
+
+            bsl::vector<Int64> latencies;
+            latencies.reserve(static_cast<bsl::size_t>(numThreads)
+                                                                * numRecords);
+
+            for (int i = 0; i < numThreads; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+                latencies.insert(latencies.end(),
+                                 args[i].d_latencies.begin(),
+                                 args[i].d_latencies.end());
+            }
+
+            ASSERT(0 == mX.stopPublicationThread());
+
+            int numLogged = 0;
+            if (logFile) {
+                mX.disableFileLogging();
+                numLogged = countLoggedRecords(logFile);
+            }
+
+            bsl::sort(latencies.begin(), latencies.end());
+
+            const bsl::size_t n = latencies.size();
+
+            cout << NAMES[ti]                   << ','
+                 << numThreads                  << ','
+                 << n                           << ','
+                 << latencies[n / 2]            << ','
+                 << latencies[n * 99 / 100]     << ','
+                 << latencies[n * 999 / 1000]   << ','
+                 << numLogged                   << '\n';
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
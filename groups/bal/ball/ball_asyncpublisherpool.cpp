@@ -0,0 +1,556 @@
+// ball_asyncpublisherpool.cpp                                        -*-C++-*-
+#include <ball_asyncpublisherpool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_asyncpublisherpool_cpp,"$Id$ $CSID$")
+
+///Implementation Notes
+///--------------------
+// The `d_state` of a `PooledAsyncObserver` tells whether the observer is
+// "owned" by the pool: an observer is `e_SCHEDULED` from the time it is added
+// to the list of ready observers until a publication thread (or a thread
+// draining a stopped pool in `waitUntilIdle`) has published a batch of its
+// records and, under the pool mutex, returned it to `e_IDLE`.  A producer
+// appends a record to the queue and then attempts the `e_IDLE` to
+// `e_SCHEDULED` transition; the consumer returns the observer to `e_IDLE` and
+// then checks whether the queue is empty.  Both accesses to `d_state` being
+// sequentially consistent read-modify-write operations, at least one side
+// observes the other, so a record is never left in the queue of an idle
+// observer.  Because the consumer releases an observer under the pool mutex,
+// and `waitUntilIdle` examines `d_state` under the same mutex, an observer
+// waiting in its destructor is never destroyed while a publication thread
+// still refers to it.
+
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_transmission.h>
+
+#include <bdlf_memfn.h>
+
+#include <bdls_processutil.h>
+
+#include <bdlt_currenttime.h>
+
+#include <bslma_default.h>
+
+#include <bslmf_movableref.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_threadattributes.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_ostream.h>
+
+namespace BloombergLP {
+namespace ball {
+
+namespace {
+
+enum {
+    k_FORCE_WARN_THRESHOLD = 5000  // number of dropped records reported even
+                                   // if the record queue is more than half
+                                   // full
+};
+
+static const char *const k_LOG_CATEGORY = "BALL.POOLEDASYNCOBSERVER";
+
+static const char *const k_THREAD_NAME = "asyncpublisher";
+
+/// Publish a record to the specified `observer` at `WARN` severity level
+/// that the specified `numDropped` records have been dropped from
+/// publication because they could not be enqueued on a pooled asynchronous
+/// observer.  Use the specified `allocator` to supply memory.
+void logDroppedMessageWarning(Observer         *observer,
+                              int               numDropped,
+                              bslma::Allocator *allocator)
+{
+    // We log the record unconditionally (i.e., without consulting the logger
+    // manager as to whether WARN is enabled) to avoid an
+    // observer->loggermanager dependency.
+
+    bsl::shared_ptr<Record> record = bsl::allocate_shared<Record>(allocator);
+
+    RecordAttributes& attributes = record->fixedFields();
+
+    attributes.setFileName(__FILE__);
+    attributes.setLineNumber(__LINE__);
+    attributes.setCategory(k_LOG_CATEGORY);
+    attributes.setSeverity(Severity::e_WARN);
+    attributes.setProcessID(bdls::ProcessUtil::getProcessId());
+    attributes.setTimestamp(bdlt::CurrentTime::utc());
+    attributes.setThreadID(bslmt::ThreadUtil::selfIdAsUint64());
+    attributes.setKernelThreadID(bslmt::ThreadUtil::selfKernelIdAsUint64());
+
+    bsl::ostream os(&attributes.messageStreamBuf());
+    os << "Dropped " << numDropped << " log records." << bsl::flush;
+
+    observer->publish(record, Context(Transmission::e_PASSTHROUGH, 0, 0));
+}
+
+}  // close unnamed namespace
+
+                          // ------------------------
+                          // class AsyncPublisherPool
+                          // ------------------------
+
+// PRIVATE MANIPULATORS
+int AsyncPublisherPool::pushBackWhileStarted(
+                                       PooledAsyncObserver       *observer,
+                                       AsyncPublisherPool_Record *record)
+{
+    BSLS_ASSERT(observer);
+    BSLS_ASSERT(record);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    // The publication threads broadcast `d_idleCondition` with `d_mutex`
+    // locked after each batch, i.e., after making room in the queue, and
+    // `stop` broadcasts it once `d_started` is reset, so no wake-up is lost.
+
+    for (;;) {
+        const int rc = observer->d_recordQueue.tryPushBack(
+                                       bslmf::MovableRefUtil::move(*record));
+
+        if (0 == rc
+         || !d_started
+         || bdlcc::BoundedQueue<AsyncPublisherPool_Record>::e_FULL != rc) {
+            return rc;                                                // RETURN
+        }
+
+        d_idleCondition.wait(&d_mutex);
+    }
+}
+
+void AsyncPublisherPool::schedule(PooledAsyncObserver *observer)
+{
+    BSLS_ASSERT(observer);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_readyObservers.push_back(observer);
+
+    if (d_started) {
+        d_workCondition.signal();
+    }
+    else {
+        // A thread may be waiting in `waitUntilIdle` to publish the records
+        // of `observer` itself.
+
+        d_idleCondition.broadcast();
+    }
+}
+
+void AsyncPublisherPool::threadEntryPoint()
+{
+    // Records having a deferred message are rendered into this copy, which
+    // is private to the publication thread, rather than modifying the
+    // (shared) published record.
+
+    bsl::shared_ptr<Record> rendered;
+
+    bsl::vector<AsyncPublisherPool_Record> records(d_maxBatchSize,
+                                                   d_allocator_p);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    for (;;) {
+        while (d_readyObservers.empty() && !d_stopping) {
+            d_workCondition.wait(&d_mutex);
+        }
+
+        if (d_readyObservers.empty()) {
+            break;                                                    // BREAK
+        }
+
+        PooledAsyncObserver *observer = d_readyObservers.front();
+        d_readyObservers.pop_front();
+
+        d_mutex.unlock();
+
+        observer->publishBatch(records.data(), d_maxBatchSize, &rendered);
+
+        d_mutex.lock();
+
+        // Release the observer, and add it to the back of the list if records
+        // remain in its queue (or arrived during the batch).
+
+        observer->d_state.swap(PooledAsyncObserver::e_IDLE);
+
+        if (!observer->d_recordQueue.isEmpty()
+         && PooledAsyncObserver::e_IDLE == observer->d_state.testAndSwap(
+                                           PooledAsyncObserver::e_IDLE,
+                                           PooledAsyncObserver::e_SCHEDULED)) {
+            d_readyObservers.push_back(observer);
+        }
+
+        d_idleCondition.broadcast();
+    }
+}
+
+void AsyncPublisherPool::waitUntilIdle(PooledAsyncObserver *observer)
+{
+    BSLS_ASSERT(observer);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    while (PooledAsyncObserver::e_SCHEDULED == observer->d_state) {
+        if (!d_started) {
+            bsl::deque<PooledAsyncObserver *>::iterator it =
+                                      bsl::find(d_readyObservers.begin(),
+                                                d_readyObservers.end(),
+                                                observer);
+
+            if (d_readyObservers.end() != it) {
+                // No publication thread will service `observer`: publish its
+                // records in this thread.
+
+                d_readyObservers.erase(it);
+
+                d_mutex.unlock();
+                {
+                    bsl::shared_ptr<Record>                rendered;
+                    bsl::vector<AsyncPublisherPool_Record> records(
+                                                               d_maxBatchSize,
+                                                               d_allocator_p);
+
+                    while (0 < observer->publishBatch(records.data(),
+                                                      d_maxBatchSize,
+                                                      &rendered)) {
+                    }
+                }
+                d_mutex.lock();
+
+                observer->d_state.swap(PooledAsyncObserver::e_IDLE);
+
+                if (!observer->d_recordQueue.isEmpty()
+                 && PooledAsyncObserver::e_IDLE ==
+                        observer->d_state.testAndSwap(
+                                           PooledAsyncObserver::e_IDLE,
+                                           PooledAsyncObserver::e_SCHEDULED)) {
+                    d_readyObservers.push_back(observer);
+                }
+                continue;                                           // CONTINUE
+            }
+        }
+
+        d_idleCondition.wait(&d_mutex);
+    }
+}
+
+// CREATORS
+AsyncPublisherPool::AsyncPublisherPool(int               numThreads,
+                                       bslma::Allocator *basicAllocator)
+: d_readyObservers(basicAllocator)
+, d_stopping(false)
+, d_started(false)
+, d_threadHandles(basicAllocator)
+, d_numThreads(numThreads)
+, d_maxBatchSize(k_DEFAULT_MAX_BATCH_SIZE)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < numThreads);
+
+    d_threadEntryPoint = bsl::function<void()>(
+              bsl::allocator_arg_t(),
+              bsl::allocator<bsl::function<void()> >(d_allocator_p),
+              bdlf::MemFnUtil::memFn(&AsyncPublisherPool::threadEntryPoint,
+                                     this));
+}
+
+AsyncPublisherPool::AsyncPublisherPool(int               numThreads,
+                                       int               maxBatchSize,
+                                       bslma::Allocator *basicAllocator)
+: d_readyObservers(basicAllocator)
+, d_stopping(false)
+, d_started(false)
+, d_threadHandles(basicAllocator)
+, d_numThreads(numThreads)
+, d_maxBatchSize(maxBatchSize)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < numThreads);
+    BSLS_ASSERT(0 < maxBatchSize);
+
+    d_threadEntryPoint = bsl::function<void()>(
+              bsl::allocator_arg_t(),
+              bsl::allocator<bsl::function<void()> >(d_allocator_p),
+              bdlf::MemFnUtil::memFn(&AsyncPublisherPool::threadEntryPoint,
+                                     this));
+}
+
+AsyncPublisherPool::~AsyncPublisherPool()
+{
+    stop();
+
+    BSLS_ASSERT(d_readyObservers.empty());
+}
+
+// MANIPULATORS
+int AsyncPublisherPool::start()
+{
+    bslmt::LockGuard<bslmt::Mutex> controlGuard(&d_controlMutex);
+
+    if (!d_threadHandles.empty()) {
+        return 0;                                                     // RETURN
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        d_started = true;
+    }
+
+    bslmt::ThreadAttributes attributes;
+    attributes.setThreadName(k_THREAD_NAME);
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        bslmt::ThreadUtil::Handle handle;
+
+        const int rc = bslmt::ThreadUtil::create(&handle,
+                                                 attributes,
+                                                 d_threadEntryPoint);
+        if (0 != rc) {
+            // Stop the threads already created.  Note that `stop` cannot be
+            // called while `d_controlMutex` is locked.
+
+            {
+                bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+                d_stopping = true;
+                d_workCondition.broadcast();
+            }
+
+            for (bsl::size_t j = 0; j < d_threadHandles.size(); ++j) {
+                bslmt::ThreadUtil::join(d_threadHandles[j]);
+            }
+            d_threadHandles.clear();
+
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            d_stopping = false;
+            d_started  = false;
+            d_idleCondition.broadcast();
+
+            return rc;                                                // RETURN
+        }
+
+        d_threadHandles.push_back(handle);
+    }
+
+    return 0;
+}
+
+void AsyncPublisherPool::stop()
+{
+    bslmt::LockGuard<bslmt::Mutex> controlGuard(&d_controlMutex);
+
+    if (d_threadHandles.empty()) {
+        return;                                                       // RETURN
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        d_stopping = true;
+        d_workCondition.broadcast();
+    }
+
+    // The threads exit once no observer has queued records.
+
+    for (bsl::size_t i = 0; i < d_threadHandles.size(); ++i) {
+        bslmt::ThreadUtil::join(d_threadHandles[i]);
+    }
+    d_threadHandles.clear();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_stopping = false;
+    d_started  = false;
+
+    // Observers scheduled after the threads exited are drained by the
+    // threads waiting in `waitUntilIdle`, if any.
+
+    d_idleCondition.broadcast();
+}
+
+// ACCESSORS
+bool AsyncPublisherPool::isStarted() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_started;
+}
+
+                         // -------------------------
+                         // class PooledAsyncObserver
+                         // -------------------------
+
+// PRIVATE MANIPULATORS
+int PooledAsyncObserver::publishBatch(
+                                    AsyncPublisherPool_Record *records,
+                                    int                        maxNumRecords,
+                                    bsl::shared_ptr<Record>   *rendered)
+{
+    BSLS_ASSERT(records);
+    BSLS_ASSERT(0 < maxNumRecords);
+    BSLS_ASSERT(rendered);
+
+    bsl::size_t numPopped = 0;
+
+    d_recordQueue.tryPopFrontBatch(records, maxNumRecords, &numPopped);
+
+    const bool renderMessages = !d_observer->supportsDeferredMessages();
+
+    for (bsl::size_t i = 0; i < numPopped; ++i) {
+        const AsyncPublisherPool_Record& record = records[i];
+
+        if (renderMessages
+         && record.d_record->fixedFields().isMessageDeferred()) {
+            // Do not reuse a copy that the wrapped observer retained.
+
+            if (!*rendered || 1 < rendered->use_count()) {
+                *rendered = bsl::allocate_shared<Record>(
+                                                    d_pool_p->d_allocator_p);
+            }
+            **rendered = *record.d_record;
+            (*rendered)->fixedFields().renderMessage();
+
+            d_observer->publish(*rendered, record.d_context);
+        }
+        else {
+            d_observer->publish(record.d_record, record.d_context);
+        }
+
+        records[i].d_record.reset();
+    }
+
+    // Publish the count of dropped records.  To avoid repeatedly publishing
+    // this information when the record queue is full, we publish the number
+    // of dropped records only when the queue becomes half empty or when a
+    // sufficient number of records have been dropped.
+
+    if (0 < d_dropCount.loadRelaxed()) {
+        if (d_recordQueue.numElements() <= d_recordQueue.capacity() / 2
+         || d_dropCount.loadRelaxed()   >= k_FORCE_WARN_THRESHOLD) {
+            const int numDropped = d_dropCount.swap(0);
+
+            if (0 < numDropped) {
+                logDroppedMessageWarning(d_observer.get(),
+                                         numDropped,
+                                         d_allocator_p);
+            }
+        }
+    }
+
+    return static_cast<int>(numPopped);
+}
+
+// CREATORS
+PooledAsyncObserver::PooledAsyncObserver(
+                            const bsl::shared_ptr<Observer>&  observer,
+                            AsyncPublisherPool               *pool,
+                            bslma::Allocator                 *basicAllocator)
+: d_pool_p(pool)
+, d_observer(observer)
+, d_recordQueue(k_DEFAULT_MAX_RECORD_QUEUE_SIZE, basicAllocator)
+, d_state(e_IDLE)
+, d_dropThreshold(Severity::e_OFF)
+, d_dropCount(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(observer);
+    BSLS_ASSERT(pool);
+}
+
+PooledAsyncObserver::PooledAsyncObserver(
+                          const bsl::shared_ptr<Observer>&  observer,
+                          AsyncPublisherPool               *pool,
+                          int                               maxRecordQueueSize,
+                          Severity::Level                   dropThreshold,
+                          bslma::Allocator                 *basicAllocator)
+: d_pool_p(pool)
+, d_observer(observer)
+, d_recordQueue(maxRecordQueueSize, basicAllocator)
+, d_state(e_IDLE)
+, d_dropThreshold(dropThreshold)
+, d_dropCount(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(observer);
+    BSLS_ASSERT(pool);
+    BSLS_ASSERT(0 < maxRecordQueueSize);
+}
+
+PooledAsyncObserver::~PooledAsyncObserver()
+{
+    flush();
+}
+
+// MANIPULATORS
+void PooledAsyncObserver::flush()
+{
+    d_pool_p->waitUntilIdle(this);
+}
+
+void PooledAsyncObserver::publish(const bsl::shared_ptr<const Record>& record,
+                                  const Context&                       context)
+{
+    BSLS_ASSERT(record);
+
+    AsyncPublisherPool_Record asyncRecord;
+
+    asyncRecord.d_record  = record;
+    asyncRecord.d_context = context;
+
+    int rc = d_recordQueue.tryPushBack(
+                                    bslmf::MovableRefUtil::move(asyncRecord));
+
+    if (0 != rc && record->fixedFields().severity() <= d_dropThreshold) {
+        // Wait for room only while the pool is started: a pool that is not
+        // started does not make room in the queue.
+
+        rc = d_pool_p->pushBackWhileStarted(this, &asyncRecord);
+    }
+
+    if (0 != rc) {
+        d_dropCount.addRelaxed(1);
+        return;                                                       // RETURN
+    }
+
+    if (e_IDLE == d_state.testAndSwap(e_IDLE, e_SCHEDULED)) {
+        d_pool_p->schedule(this);
+    }
+}
+
+void PooledAsyncObserver::releaseRecords()
+{
+    d_recordQueue.removeAll();
+    d_observer->releaseRecords();
+}
+
+// ACCESSORS
+bool PooledAsyncObserver::supportsDeferredMessages() const
+{
+    return true;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
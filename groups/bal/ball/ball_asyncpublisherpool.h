@@ -0,0 +1,607 @@
+// ball_asyncpublisherpool.h                                          -*-C++-*-
+#ifndef INCLUDED_BALL_ASYNCPUBLISHERPOOL
+#define INCLUDED_BALL_ASYNCPUBLISHERPOOL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide publication threads shared by many asynchronous observers.
+//
+//@CLASSES:
+//  ball::AsyncPublisherPool: pool of threads publishing queued log records
+//  ball::PooledAsyncObserver: observer queuing records for a publisher pool
+//
+//@SEE_ALSO: ball_asyncfileobserver, ball_fileobserver, ball_streamobserver
+//
+//@DESCRIPTION: This component provides a mechanism,
+// `ball::AsyncPublisherPool`, that owns a small, configurable number of
+// publication threads, and a concrete implementation of the `ball::Observer`
+// protocol, `ball::PooledAsyncObserver`, that appends the records it receives
+// to a queue of its own and relies on the threads of a publisher pool to
+// publish them to another (typically synchronous) observer, such as a
+// `ball::FileObserver` or a `ball::StreamObserver`:
+// ```
+//              ,------------------------.
+//             ( ball::PooledAsyncObserver )
+//              `------------------------'
+//                           |              ctor
+//                           |              flush
+//                           |              maxRecordQueueSize
+//                           |              observer
+//                           |              recordQueueLength
+//                           V
+//                    ,--------------.
+//                   ( ball::Observer )
+//                    `--------------'
+//                                          publish
+//                                          releaseRecords
+//                                          supportsDeferredMessages
+//                                          dtor
+// ```
+// A `ball::AsyncFileObserver` owns a publication thread; a process writing a
+// dozen log files through asynchronous file observers therefore runs a dozen
+// publication threads, each woken separately as records arrive.  Wrapping each
+// `ball::FileObserver` in a `ball::PooledAsyncObserver` attached to a single
+// `ball::AsyncPublisherPool` provides the same decoupling of the logging
+// threads from file I/O with a single publication thread (or as many as the
+// pool is configured with).
+//
+///Publication Threads and Fairness
+///--------------------------------
+// The pool keeps a first-in-first-out list of the observers having queued
+// records.  An observer is added to the back of the list when a record is
+// appended to its (previously empty) queue.  A publication thread removes the
+// observer at the front of the list, and publishes up to `maxBatchSize()`
+// records of that observer; if records remain in the observer's queue, the
+// observer is then added to the back of the list.  An observer flooded with
+// records therefore delays the records of the other observers by at most one
+// batch per publication thread.  An observer is serviced by at most one
+// publication thread at a time, so the records of an observer are published
+// in the order in which they were received, and the wrapped observer is never
+// invoked concurrently by the pool.
+//
+// The threads of a pool are created by `start` and joined by `stop`, which
+// first publishes all queued records.  A pool that is not started holds the
+// records received by its observers until it is started, or until the
+// records are published by `ball::PooledAsyncObserver::flush` (or the
+// destructor of the observer) in the calling thread.
+//
+///Record Queue
+///------------
+// Each `ball::PooledAsyncObserver` has a fixed-size queue of records (8192
+// records, by default).  Records received while the queue is full are
+// discarded, unless their severity is at least as severe as the drop threshold
+// optionally supplied at construction, in which case `publish` blocks until
+// the pool makes room in the queue.  The number of discarded records is
+// periodically published to the wrapped observer, as a record having `WARN`
+// severity.  Note that a pool that is not started does not make room in
+// queues: a record received while the queue is full and the pool is not
+// started is discarded (and counted) whatever its severity, and a `publish`
+// blocked on a full queue discards its record if the pool is stopped, so that
+// a logging thread never waits for a pool that is not running.
+//
+///Deferred Messages
+///-----------------
+// `ball::PooledAsyncObserver` accepts records whose message is deferred (see
+// `ball_recordattributes`), so the logging thread does not format messages.
+// Such a message is rendered by the publication thread, into a copy of the
+// record private to that thread, unless the wrapped observer itself supports
+// deferred messages.
+//
+///Object Lifetimes
+///----------------
+// A `ball::AsyncPublisherPool` must outlive the `ball::PooledAsyncObserver`
+// objects attached to it.  The destructor of a `ball::PooledAsyncObserver`
+// publishes its queued records (waiting for the pool to publish them if the
+// pool is started, and publishing them in the calling thread otherwise), so
+// that the pool never refers to a destroyed observer.
+//
+///Thread Safety
+///-------------
+// `ball::AsyncPublisherPool` and `ball::PooledAsyncObserver` are
+// *thread-safe*, meaning that multiple threads may share the same instance.
+// The wrapped observer must be *thread-safe* if it is used other than through
+// the `ball::PooledAsyncObserver`.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing a Publication Thread Among Log Files
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// First, we create a publisher pool having a single publication thread, and
+// start it:
+// ```
+// ball::AsyncPublisherPool pool(1);
+//
+// int rc = pool.start();
+// assert(0 == rc);
+// ```
+// Then, we create two file observers, one for each component of our service,
+// and wrap each in a pooled asynchronous observer attached to the pool:
+// ```
+// bsl::shared_ptr<ball::FileObserver> ordersFile =
+//                                      bsl::make_shared<ball::FileObserver>();
+// bsl::shared_ptr<ball::FileObserver> pricesFile =
+//                                      bsl::make_shared<ball::FileObserver>();
+//
+// ordersFile->enableFileLogging(ordersFileName.c_str());
+// pricesFile->enableFileLogging(pricesFileName.c_str());
+//
+// ball::PooledAsyncObserver ordersObserver(ordersFile, &pool);
+// ball::PooledAsyncObserver pricesObserver(pricesFile, &pool);
+// ```
+// Next, we publish records to both observers (typically, the observers are
+// registered with a `ball::BroadcastObserver`, or with the logger manager,
+// together with a filter selecting the records of each component).  Both
+// log files are written by the single publication thread of the pool:
+// ```
+// bslma::Allocator *ga = bslma::Default::globalAllocator(0);
+//
+// ball::RecordAttributes attributes;
+// ball::UserFields       fieldValues;
+//
+// attributes.setSeverity(ball::Severity::e_INFO);
+//
+// attributes.setMessage("order 1 accepted");
+// ordersObserver.publish(
+//                 bsl::allocate_shared<ball::Record>(ga, attributes,
+//                                                    fieldValues),
+//                 ball::Context());
+//
+// attributes.setMessage("price 101.25");
+// pricesObserver.publish(
+//                 bsl::allocate_shared<ball::Record>(ga, attributes,
+//                                                    fieldValues),
+//                 ball::Context());
+// ```
+// Finally, we wait until the records are written:
+// ```
+// ordersObserver.flush();
+// pricesObserver.flush();
+// ```
+
+#include <balscm_version.h>
+
+#include <ball_context.h>
+#include <ball_observer.h>
+#include <ball_severity.h>
+
+#include <bdlcc_boundedqueue.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+
+#include <bsl_deque.h>
+#include <bsl_functional.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ball {
+
+class PooledAsyncObserver;
+class Record;
+
+                      // ================================
+                      // struct AsyncPublisherPool_Record
+                      // ================================
+
+/// PRIVATE STRUCT.  For use by the `ball::AsyncPublisherPool` implementation
+/// only.  This `struct` holds a log record and its associated context.
+struct AsyncPublisherPool_Record {
+
+    // PUBLIC DATA
+    bsl::shared_ptr<const Record> d_record;   // log record
+    Context                       d_context;  // context of log record
+};
+
+                          // ========================
+                          // class AsyncPublisherPool
+                          // ========================
+
+/// This mechanism owns the publication threads shared by the
+/// `PooledAsyncObserver` objects attached to it, and schedules the
+/// publication of their queued records (see {Publication Threads and
+/// Fairness}).
+class AsyncPublisherPool {
+
+    // DATA
+    mutable bslmt::Mutex                   d_mutex;          // protects the
+                                                             // list of ready
+                                                             // observers and
+                                                             // `d_stopping`
+
+    bslmt::Condition                       d_workCondition;  // signaled when
+                                                             // an observer is
+                                                             // ready or the
+                                                             // pool stops
+
+    bslmt::Condition                       d_idleCondition;  // signaled when
+                                                             // a batch is
+                                                             // published or
+                                                             // the pool stops
+
+    bsl::deque<PooledAsyncObserver *>      d_readyObservers; // observers
+                                                             // having queued
+                                                             // records, in
+                                                             // service order
+
+    bool                                   d_stopping;       // `true` while
+                                                             // `stop` joins
+                                                             // the threads
+
+    bool                                   d_started;        // `true` if the
+                                                             // threads are
+                                                             // running
+
+    mutable bslmt::Mutex                   d_controlMutex;   // serializes
+                                                             // `start` and
+                                                             // `stop`
+
+    bsl::vector<bslmt::ThreadUtil::Handle> d_threadHandles;  // publication
+                                                             // threads
+
+    const int                              d_numThreads;     // number of
+                                                             // publication
+                                                             // threads
+
+    const int                              d_maxBatchSize;   // maximum number
+                                                             // of records of
+                                                             // an observer
+                                                             // published at
+                                                             // once
+
+    bsl::function<void()>                  d_threadEntryPoint;
+                                                             // publication
+                                                             // thread entry
+                                                             // point functor
+
+    bslma::Allocator                      *d_allocator_p;    // memory
+                                                             // allocator
+                                                             // (held, not
+                                                             // owned)
+
+    // FRIENDS
+    friend class PooledAsyncObserver;
+
+  private:
+    // NOT IMPLEMENTED
+    AsyncPublisherPool(const AsyncPublisherPool&);
+    AsyncPublisherPool& operator=(const AsyncPublisherPool&);
+
+    // PRIVATE MANIPULATORS
+
+    /// Append the specified `record` to the queue of the specified
+    /// `observer`, waiting while that queue is full and this pool is
+    /// started.  Return 0 on success, and the non-zero status of
+    /// `bdlcc::BoundedQueue::tryPushBack` (with no effect on `record`) if the
+    /// queue is full while this pool is not started, or if the queue is
+    /// disabled.
+    int pushBackWhileStarted(PooledAsyncObserver       *observer,
+                             AsyncPublisherPool_Record *record);
+
+    /// Add the specified `observer` to the back of the list of observers
+    /// having queued records.  The behavior is undefined unless `observer`
+    /// was marked as scheduled by the calling thread.
+    void schedule(PooledAsyncObserver *observer);
+
+    /// Publish the records of the observers in the list of observers having
+    /// queued records, until `stop` is called and the list is empty.  Note
+    /// that this function is the entry point for the publication threads.
+    void threadEntryPoint();
+
+    /// Block until the specified `observer` has no queued records and is not
+    /// serviced by a publication thread, publishing the queued records in
+    /// the calling thread if the pool is not started.
+    void waitUntilIdle(PooledAsyncObserver *observer);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(AsyncPublisherPool,
+                                   bslma::UsesBslmaAllocator);
+
+    // PUBLIC CONSTANTS
+    enum {
+        k_DEFAULT_MAX_BATCH_SIZE = 64  // default maximum number of records
+                                       // of an observer published at once
+    };
+
+    // CREATORS
+
+    /// Create a publisher pool having the optionally specified `numThreads`
+    /// publication threads (one, by default), which publish at most
+    /// `k_DEFAULT_MAX_BATCH_SIZE` records of an observer at once.  The
+    /// threads are not created until `start` is called.  Optionally specify
+    /// a `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.  The behavior is
+    /// undefined unless `0 < numThreads`.
+    explicit AsyncPublisherPool(int               numThreads     = 1,
+                                bslma::Allocator *basicAllocator = 0);
+
+    /// Create a publisher pool having the specified `numThreads`
+    /// publication threads, which publish at most the specified
+    /// `maxBatchSize` records of an observer at once.  The threads are not
+    /// created until `start` is called.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.  The behavior is
+    /// undefined unless `0 < numThreads` and `0 < maxBatchSize`.
+    AsyncPublisherPool(int               numThreads,
+                       int               maxBatchSize,
+                       bslma::Allocator *basicAllocator = 0);
+
+    /// Stop this publisher pool (see `stop`) and destroy it.  The behavior
+    /// is undefined unless every `PooledAsyncObserver` attached to this pool
+    /// has been destroyed.
+    ~AsyncPublisherPool();
+
+    // MANIPULATORS
+
+    /// Create the publication threads of this pool, if they are not already
+    /// running.  Return 0 on success, and a non-zero value otherwise (in
+    /// which case no thread is running).
+    int start();
+
+    /// Publish the records queued by the observers attached to this pool,
+    /// and join the publication threads, if they are running.  Note that
+    /// records received by the observers while the pool is stopped remain
+    /// queued until the pool is started again.
+    void stop();
+
+    // ACCESSORS
+
+    /// Return `true` if the publication threads of this pool are running,
+    /// and `false` otherwise.
+    bool isStarted() const;
+
+    /// Return the maximum number of records of an observer that a
+    /// publication thread publishes before servicing the next observer.
+    int maxBatchSize() const;
+
+    /// Return the number of publication threads of this pool.
+    int numThreads() const;
+};
+
+                         // =========================
+                         // class PooledAsyncObserver
+                         // =========================
+
+/// This class implements the `Observer` protocol.  Records received by the
+/// `publish` method are appended to a fixed-size queue, and published to the
+/// observer supplied at construction by the threads of a
+/// `AsyncPublisherPool`.
+class PooledAsyncObserver : public Observer {
+
+    // PRIVATE TYPES
+    enum State {
+        e_IDLE,       // the observer is not in the list of ready observers
+                      // of the pool, nor serviced by a publication thread
+
+        e_SCHEDULED   // the observer is in the list of ready observers, or
+                      // serviced by a publication thread
+    };
+
+    // DATA
+    AsyncPublisherPool                           *d_pool_p;
+                                                   // pool publishing the
+                                                   // records (held, not
+                                                   // owned)
+
+    bsl::shared_ptr<Observer>                     d_observer;
+                                                   // observer to which
+                                                   // records are published
+
+    bdlcc::BoundedQueue<AsyncPublisherPool_Record>
+                                                  d_recordQueue;
+                                                   // fixed-size queue of
+                                                   // records
+
+    bsls::AtomicInt                               d_state;
+                                                   // one of the values of
+                                                   // `State`
+
+    Severity::Level                               d_dropThreshold;
+                                                   // records with severity
+                                                   // below this threshold
+                                                   // are dropped when the
+                                                   // queue is full
+
+    bsls::AtomicInt                               d_dropCount;
+                                                   // number of dropped
+                                                   // records not yet
+                                                   // reported
+
+    bslma::Allocator                             *d_allocator_p;
+                                                   // memory allocator (held,
+                                                   // not owned)
+
+    // FRIENDS
+    friend class AsyncPublisherPool;
+
+  private:
+    // NOT IMPLEMENTED
+    PooledAsyncObserver(const PooledAsyncObserver&);
+    PooledAsyncObserver& operator=(const PooledAsyncObserver&);
+
+    // PRIVATE MANIPULATORS
+
+    /// Publish up to the specified `maxNumRecords` queued records to the
+    /// wrapped observer, using the specified `records` array as scratch
+    /// storage, and rendering deferred messages into the specified
+    /// `rendered` record (allocated on first use).  Return the number of
+    /// records published.  The behavior is undefined unless `records` has
+    /// at least `maxNumRecords` elements, and this method is not called
+    /// concurrently for this object.
+    int publishBatch(AsyncPublisherPool_Record *records,
+                     int                        maxNumRecords,
+                     bsl::shared_ptr<Record>   *rendered);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(PooledAsyncObserver,
+                                   bslma::UsesBslmaAllocator);
+
+    // PUBLIC CONSTANTS
+    enum {
+        k_DEFAULT_MAX_RECORD_QUEUE_SIZE = 8192  // default capacity of the
+                                                // record queue
+    };
+
+    // CREATORS
+
+    /// Create an observer that appends the records it receives to a queue
+    /// of `k_DEFAULT_MAX_RECORD_QUEUE_SIZE` records, from which they are
+    /// published to the specified `observer` by the threads of the specified
+    /// `pool`.  Records received while the queue is full are discarded.
+    /// Optionally specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.  The behavior is undefined unless `observer` is not null, and
+    /// `pool` outlives this object.
+    PooledAsyncObserver(const bsl::shared_ptr<Observer>&  observer,
+                        AsyncPublisherPool               *pool,
+                        bslma::Allocator                 *basicAllocator = 0);
+
+    /// Create an observer that appends the records it receives to a queue
+    /// of the specified `maxRecordQueueSize` records, from which they are
+    /// published to the specified `observer` by the threads of the specified
+    /// `pool`.  Records received while the queue is full whose severity is
+    /// less severe than the specified `dropThreshold` are discarded; the
+    /// others block the calling thread until space is available (see {Record
+    /// Queue}).  Optionally specify a `basicAllocator` used to supply memory.
+    /// If `basicAllocator` is 0, the currently installed default allocator
+    /// is used.  The behavior is undefined unless `observer` is not null,
+    /// `pool` outlives this object, and `0 < maxRecordQueueSize`.
+    PooledAsyncObserver(
+                     const bsl::shared_ptr<Observer>&  observer,
+                     AsyncPublisherPool               *pool,
+                     int                               maxRecordQueueSize,
+                     Severity::Level                   dropThreshold,
+                     bslma::Allocator                 *basicAllocator = 0);
+
+    /// Publish the queued records (see `flush`) and destroy this observer.
+    ~PooledAsyncObserver() BSLS_KEYWORD_OVERRIDE;
+
+    // MANIPULATORS
+
+    /// Block until the records queued by this observer have been published
+    /// to the wrapped observer.  If the pool is not started, the records are
+    /// published in the calling thread.  Note that this method may not
+    /// return while other threads keep publishing records to this observer.
+    void flush();
+
+    using Observer::publish;  // Avoid hiding base class method.
+
+    /// Append the specified `record` and `context` to the record queue of
+    /// this observer, to be published to the wrapped observer by a thread
+    /// of the pool.  If the queue is full, block until space is available
+    /// if the severity of `record` is at least as severe as the drop
+    /// threshold supplied at construction, and discard the record otherwise.
+    void publish(const bsl::shared_ptr<const Record>& record,
+                 const Context&                       context)
+                                                         BSLS_KEYWORD_OVERRIDE;
+
+    /// Discard the records queued by this observer, and call
+    /// `releaseRecords` on the wrapped observer.  Note that a record being
+    /// published by a thread of the pool may still be published.
+    void releaseRecords() BSLS_KEYWORD_OVERRIDE;
+
+    // ACCESSORS
+
+    /// Return the capacity of the record queue of this observer.
+    int maxRecordQueueSize() const;
+
+    /// Return the observer to which this observer publishes records.
+    const bsl::shared_ptr<Observer>& observer() const;
+
+    /// Return the address of the pool publishing the records of this
+    /// observer.
+    AsyncPublisherPool *pool() const;
+
+    /// Return the number of records queued by this observer.  Note that the
+    /// value is approximate when records are being published.
+    int recordQueueLength() const;
+
+    /// Return `true`, as this observer renders deferred messages in the
+    /// publication threads (see {Deferred Messages}).
+    bool supportsDeferredMessages() const BSLS_KEYWORD_OVERRIDE;
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                          // ------------------------
+                          // class AsyncPublisherPool
+                          // ------------------------
+
+// ACCESSORS
+inline
+int AsyncPublisherPool::maxBatchSize() const
+{
+    return d_maxBatchSize;
+}
+
+inline
+int AsyncPublisherPool::numThreads() const
+{
+    return d_numThreads;
+}
+
+                         // -------------------------
+                         // class PooledAsyncObserver
+                         // -------------------------
+
+// ACCESSORS
+inline
+int PooledAsyncObserver::maxRecordQueueSize() const
+{
+    return static_cast<int>(d_recordQueue.capacity());
+}
+
+inline
+const bsl::shared_ptr<Observer>& PooledAsyncObserver::observer() const
+{
+    return d_observer;
+}
+
+inline
+AsyncPublisherPool *PooledAsyncObserver::pool() const
+{
+    return d_pool_p;
+}
+
+inline
+int PooledAsyncObserver::recordQueueLength() const
+{
+    return static_cast<int>(d_recordQueue.numElements());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1265 @@
+// ball_asyncpublisherpool.t.cpp                                      -*-C++-*-
+#include <ball_asyncpublisherpool.h>
+
+#include <ball_context.h>
+#include <ball_fileobserver.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_severity.h>
+#include <ball_testobserver.h>
+#include <ball_userfields.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
+#include <bdls_tempdirectoryguard.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cctype.h>
+#include <bsl_cstdlib.h>
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_sstream.h>
+#include <bsl_streambuf.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a pool of publication threads, and an
+// observer queuing records for the pool.  Records are published to pooled
+// observers wrapping a test observer that logs, in a log shared by all the
+// observers of a test, the records it receives, and that detects concurrent
+// invocations.  The logs are checked for completeness, order, and fairness.
+// ----------------------------------------------------------------------------
+// ball::AsyncPublisherPool
+// ------------------------
+// [ 2] AsyncPublisherPool(int numThreads = 1, Allocator *ba = 0);
+// [ 2] AsyncPublisherPool(int numThreads, int maxBatchSize, Allocator *);
+// [ 2] ~AsyncPublisherPool();
+// [ 2] int start();
+// [ 2] void stop();
+// [ 2] bool isStarted() const;
+// [ 2] int maxBatchSize() const;
+// [ 2] int numThreads() const;
+//
+// ball::PooledAsyncObserver
+// -------------------------
+// [ 3] PooledAsyncObserver(const shared_ptr<Observer>&, Pool *, Alloc *);
+// [ 3] PooledAsyncObserver(observer, pool, int, Level, Alloc *);
+// [ 3] ~PooledAsyncObserver();
+// [ 3] void flush();
+// [ 3] void publish(const shared_ptr<const Record>&, const Context&);
+// [ 5] void releaseRecords();
+// [ 3] int maxRecordQueueSize() const;
+// [ 3] const bsl::shared_ptr<Observer>& observer() const;
+// [ 3] AsyncPublisherPool *pool() const;
+// [ 3] int recordQueueLength() const;
+// [ 7] bool supportsDeferredMessages() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] FAIRNESS
+// [ 5] FULL RECORD QUEUE
+// [ 6] CONCURRENCY
+// [ 7] DEFERRED MESSAGES
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef ball::AsyncPublisherPool  Pool;
+typedef ball::PooledAsyncObserver Obj;
+
+// ============================================================================
+//                  GLOBAL HELPER CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+                               // ===============
+                               // class SharedLog
+                               // ===============
+
+/// This class provides a thread-safe log of the records received by a set of
+/// `LogObserver` objects, each entry being the identifier of the observer
+/// and the message of the record.
+class SharedLog {
+
+    // DATA
+    mutable bslmt::Mutex                         d_mutex;
+    bsl::vector<bsl::pair<int, bsl::string> >    d_entries;
+
+  public:
+    // MANIPULATORS
+
+    /// Append an entry having the specified `observerId` and `message`.
+    void append(int observerId, const bsl::string& message)
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_entries.push_back(bsl::make_pair(observerId, message));
+    }
+
+    // ACCESSORS
+
+    /// Return a copy of the entries of this log.
+    bsl::vector<bsl::pair<int, bsl::string> > entries() const
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        return d_entries;
+    }
+};
+
+                              // =================
+                              // class LogObserver
+                              // =================
+
+/// This class implements the `ball::Observer` protocol, appending the
+/// messages of the records it receives to a `SharedLog`, and counting the
+/// invocations of `publish` that overlap.
+class LogObserver : public ball::Observer {
+
+    // DATA
+    SharedLog       *d_log_p;
+    int              d_id;
+    bool             d_supportsDeferred;
+    bsls::AtomicInt  d_active;
+    bsls::AtomicInt  d_numOverlaps;
+    bsls::AtomicInt  d_numReleases;
+
+  public:
+    // CREATORS
+
+    /// Create an observer having the specified `id`, logging to the
+    /// specified `log`, whose `supportsDeferredMessages` returns the
+    /// optionally specified `supportsDeferred`.
+    LogObserver(SharedLog *log, int id, bool supportsDeferred = false)
+    : d_log_p(log)
+    , d_id(id)
+    , d_supportsDeferred(supportsDeferred)
+    , d_active(0)
+    , d_numOverlaps(0)
+    , d_numReleases(0)
+    {
+    }
+
+    // MANIPULATORS
+    using Observer::publish;
+
+    void publish(const bsl::shared_ptr<const ball::Record>& record,
+                 const ball::Context&) BSLS_KEYWORD_OVERRIDE
+    {
+        if (0 != d_active.swap(1)) {
+            ++d_numOverlaps;
+        }
+
+        d_log_p->append(d_id, bsl::string(record->fixedFields().messageRef()));
+
+        d_active = 0;
+    }
+
+    void releaseRecords() BSLS_KEYWORD_OVERRIDE
+    {
+        ++d_numReleases;
+    }
+
+    // ACCESSORS
+    int numOverlaps() const
+    {
+        return d_numOverlaps;
+    }
+
+    int numReleases() const
+    {
+        return d_numReleases;
+    }
+
+    bool supportsDeferredMessages() const BSLS_KEYWORD_OVERRIDE
+    {
+        return d_supportsDeferred;
+    }
+};
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+/// Return a record having the specified `message` and `severity`, allocated
+/// with the global allocator.
+bsl::shared_ptr<const ball::Record> makeRecord(
+                    const bsl::string_view& message,
+                    int                     severity = ball::Severity::e_INFO)
+{
+    bslma::Allocator *ga = bslma::Default::globalAllocator(0);
+
+    bsl::shared_ptr<ball::Record> record = bsl::allocate_shared<ball::Record>(
+                                                                           ga);
+    record->fixedFields().setMessage(message);
+    record->fixedFields().setSeverity(severity);
+
+    return record;
+}
+
+/// Return the string representation of the specified `value`.
+bsl::string toString(int value)
+{
+    bsl::ostringstream stream;
+    stream << value;
+    return stream.str();
+}
+
+/// Write to the specified `output` the specified `length` characters at the
+/// specified `data` address, in upper case.
+void upperCaseRenderer(bsl::streambuf *output,
+                       const char     *data,
+                       bsl::size_t     length)
+{
+    for (bsl::size_t i = 0; i < length; ++i) {
+        output->sputc(static_cast<char>(bsl::toupper(
+                                       static_cast<unsigned char>(data[i]))));
+    }
+}
+
+                            // ===================
+                            // struct PublishThread
+                            // ===================
+
+/// This `struct` provides a functor publishing to each of a set of
+/// observers a sequence of records whose messages are "<thread>:<index>".
+struct PublishThread {
+    // DATA
+    bsl::vector<Obj *> *d_observers_p;
+    int                 d_threadIndex;
+    int                 d_numRecords;
+
+    // ACCESSORS
+    void operator()() const
+    {
+        for (int i = 0; i < d_numRecords; ++i) {
+            const bsl::shared_ptr<const ball::Record> record = makeRecord(
+                             toString(d_threadIndex) + ":" + toString(i),
+                             ball::Severity::e_FATAL);
+
+            for (bsl::size_t j = 0; j < d_observers_p->size(); ++j) {
+                (*d_observers_p)[j]->publish(record, ball::Context());
+            }
+        }
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                          << "\n=============" << endl;
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_asyncpublisherpool_");
+        bsl::string              ordersFileName(tempDirGuard.getTempDirName());
+        bsl::string              pricesFileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&ordersFileName, "orders.log");
+        bdls::PathUtil::appendRaw(&pricesFileName, "prices.log");
+
+        {
+///Example 1: Sharing a Publication Thread Among Log Files
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// First, we create a publisher pool having a single publication thread, and
+// start it:
+// ```
+        ball::AsyncPublisherPool pool(1);
+
+        int rc = pool.start();
+        ASSERT(0 == rc);
+// ```
+// Then, we create two file observers, one for each component of our service,
+// and wrap each in a pooled asynchronous observer attached to the pool:
+// ```
+        bsl::shared_ptr<ball::FileObserver> ordersFile =
+                                        bsl::make_shared<ball::FileObserver>();
+        bsl::shared_ptr<ball::FileObserver> pricesFile =
+                                        bsl::make_shared<ball::FileObserver>();
+
+        ordersFile->enableFileLogging(ordersFileName.c_str());
+        pricesFile->enableFileLogging(pricesFileName.c_str());
+
+        ball::PooledAsyncObserver ordersObserver(ordersFile, &pool);
+        ball::PooledAsyncObserver pricesObserver(pricesFile, &pool);
+// ```
+// Next, we publish records to both observers (typically, the observers are
+// registered with a `ball::BroadcastObserver`, or with the logger manager,
+// together with a filter selecting the records of each component).  Both
+// log files are written by the single publication thread of the pool:
+// ```
+        bslma::Allocator *ga = bslma::Default::globalAllocator(0);
+
+        ball::RecordAttributes attributes;
+        ball::UserFields       fieldValues;
+
+        attributes.setSeverity(ball::Severity::e_INFO);
+
+        attributes.setMessage("order 1 accepted");
+        ordersObserver.publish(
+                        bsl::allocate_shared<ball::Record>(ga, attributes,
+                                                           fieldValues),
+                        ball::Context());
+
+        attributes.setMessage("price 101.25");
+        pricesObserver.publish(
+                        bsl::allocate_shared<ball::Record>(ga, attributes,
+                                                           fieldValues),
+                        ball::Context());
+// ```
+// Finally, we wait until the records are written:
+// ```
+        ordersObserver.flush();
+        pricesObserver.flush();
+// ```
+
+        ordersFile->disableFileLogging();
+        pricesFile->disableFileLogging();
+        }
+
+        bsl::ifstream ordersStream(ordersFileName.c_str());
+        bsl::ifstream pricesStream(pricesFileName.c_str());
+
+        const bsl::string orders((bsl::istreambuf_iterator<char>(
+                                                                ordersStream)),
+                                 bsl::istreambuf_iterator<char>());
+        const bsl::string prices((bsl::istreambuf_iterator<char>(
+                                                                pricesStream)),
+                                 bsl::istreambuf_iterator<char>());
+
+        ASSERTV(orders, bsl::string::npos != orders.find("order 1 accepted"));
+        ASSERTV(prices, bsl::string::npos != prices.find("price 101.25"));
+        ASSERTV(orders, bsl::string::npos == orders.find("price"));
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // DEFERRED MESSAGES
+        //
+        // Concerns:
+        // 1. `supportsDeferredMessages` returns `true`.
+        //
+        // 2. A deferred message is rendered before the record is published to
+        //    a wrapped observer that does not support deferred messages, and
+        //    the published record is not modified.
+        //
+        // 3. A record having a deferred message is published as is to a
+        //    wrapped observer supporting deferred messages.
+        //
+        // Plan:
+        // 1. Publish records having deferred messages to pooled observers
+        //    wrapping observers that do and do not support deferred messages,
+        //    and verify the messages received.  (C-1..3)
+        //
+        // Testing:
+        //   bool supportsDeferredMessages() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nDEFERRED MESSAGES"
+                          << "\n=================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        SharedLog log;
+
+        Pool pool(1, &ta);
+        ASSERT(0 == pool.start());
+
+        {
+            Obj mA(bsl::make_shared<LogObserver>(&log, 0, false), &pool, &ta);
+            Obj mB(bsl::make_shared<LogObserver>(&log, 1, true),  &pool, &ta);
+
+            ASSERT(mA.supportsDeferredMessages());
+
+            bsl::shared_ptr<ball::Record> record =
+                                            bsl::allocate_shared<ball::Record>(
+                                            bslma::Default::globalAllocator());
+            record->fixedFields().setMessage("deferred");
+            record->fixedFields().setMessageRenderer(&upperCaseRenderer);
+
+            mA.publish(record, ball::Context());
+            mA.publish(record, ball::Context());
+            mB.publish(record, ball::Context());
+
+            mA.flush();
+            mB.flush();
+
+            ASSERT(record->fixedFields().isMessageDeferred());
+        }
+
+        bsl::vector<bsl::pair<int, bsl::string> > entries = log.entries();
+
+        ASSERT(3 == entries.size());
+        for (bsl::size_t i = 0; i < entries.size(); ++i) {
+            ASSERTV(i, entries[i].second,
+                    (0 == entries[i].first ? "DEFERRED" : "deferred") ==
+                                                            entries[i].second);
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        // 1. Records published concurrently to many observers sharing a pool
+        //    of several threads are all published.
+        //
+        // 2. The records received by an observer from a thread are published
+        //    in order.
+        //
+        // 3. A wrapped observer is never invoked concurrently.
+        //
+        // Plan:
+        // 1. Publish records from several threads to each of many observers
+        //    sharing a pool of several threads, and verify the records
+        //    received by each wrapped observer.  Destroy half of the
+        //    observers while the pool is running.  (C-1..3)
+        //
+        // Testing:
+        //   CONCURRENCY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCURRENCY"
+                          << "\n===========" << endl;
+
+        enum {
+            k_NUM_POOL_THREADS = 3,
+            k_NUM_OBSERVERS    = 12,
+            k_NUM_PUBLISHERS   = 4,
+            k_NUM_RECORDS      = 2000
+        };
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        SharedLog log;
+
+        Pool pool(k_NUM_POOL_THREADS, 16, &ta);
+        ASSERT(0 == pool.start());
+
+        bsl::vector<bsl::shared_ptr<LogObserver> > targets;
+        bsl::vector<Obj *>                         observers;
+
+        for (int i = 0; i < k_NUM_OBSERVERS; ++i) {
+            targets.push_back(bsl::make_shared<LogObserver>(&log, i));
+            observers.push_back(new (ta) Obj(targets.back(),
+                                             &pool,
+                                             64,
+                                             ball::Severity::e_FATAL,
+                                             &ta));
+        }
+
+        bslmt::ThreadUtil::Handle handles[k_NUM_PUBLISHERS];
+
+        for (int i = 0; i < k_NUM_PUBLISHERS; ++i) {
+            PublishThread publisher = { &observers, i, k_NUM_RECORDS };
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i], publisher));
+        }
+        for (int i = 0; i < k_NUM_PUBLISHERS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+        }
+
+        for (int i = 0; i < k_NUM_OBSERVERS; i += 2) {
+            ta.deleteObject(observers[i]);
+            observers[i] = 0;
+        }
+
+        pool.stop();
+
+        for (int i = 1; i < k_NUM_OBSERVERS; i += 2) {
+            ASSERTV(i, 0 == observers[i]->recordQueueLength());
+            ta.deleteObject(observers[i]);
+        }
+
+        bsl::vector<bsl::pair<int, bsl::string> > entries = log.entries();
+
+        ASSERTV(entries.size(),
+                k_NUM_OBSERVERS * k_NUM_PUBLISHERS * k_NUM_RECORDS ==
+                                                               entries.size());
+
+        bsl::vector<bsl::vector<int> > next(
+                                      k_NUM_OBSERVERS,
+                                      bsl::vector<int>(k_NUM_PUBLISHERS, 0));
+
+        for (bsl::size_t i = 0; i < entries.size(); ++i) {
+            const int          observer = entries[i].first;
+            const bsl::string& message  = entries[i].second;
+
+            const bsl::size_t colon     = message.find(':');
+            const int         publisher = bsl::atoi(message.c_str());
+            const int         index     = bsl::atoi(message.c_str() +
+                                                    colon + 1);
+
+            ASSERTV(observer, message, next[observer][publisher] == index);
+            next[observer][publisher] = index + 1;
+        }
+
+        for (int i = 0; i < k_NUM_OBSERVERS; ++i) {
+            ASSERTV(i, 0 == targets[i]->numOverlaps());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // FULL RECORD QUEUE
+        //
+        // Concerns:
+        // 1. Records received while the queue is full, whose severity is less
+        //    severe than the drop threshold, are discarded.
+        //
+        // 2. The number of discarded records is published to the wrapped
+        //    observer after the records that were queued.
+        //
+        // 3. Records whose severity is at least as severe as the drop
+        //    threshold block the publishing thread until room is available,
+        //    while the pool is started.
+        //
+        // 4. Records received while the queue is full and the pool is not
+        //    started (or was stopped) are discarded, whatever their severity,
+        //    without blocking the publishing thread.
+        //
+        // 5. `releaseRecords` discards the queued records, and calls
+        //    `releaseRecords` on the wrapped observer.
+        //
+        // Plan:
+        // 1. Publish more records than fit in the queue of an observer
+        //    attached to a stopped pool, flush the observer, and verify the
+        //    records received by the wrapped observer.  (C-1..2)
+        //
+        // 2. Publish, from a separate thread, more records of a severity
+        //    above the drop threshold than fit in the queue of an observer
+        //    attached to a started pool, and verify that every record is
+        //    received.  (C-3)
+        //
+        // 3. Publish more records of a severity above the drop threshold
+        //    than fit in the queue of an observer attached to a pool that
+        //    was never started, and to a pool that was started and stopped,
+        //    and verify that `publish` returns and that the excess records
+        //    are counted as dropped.  (C-4)
+        //
+        // 4. Call `releaseRecords` while records are queued.  (C-5)
+        //
+        // Testing:
+        //   void releaseRecords();
+        //   FULL RECORD QUEUE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nFULL RECORD QUEUE"
+                          << "\n=================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        if (verbose) cout << "\tDiscarding records." << endl;
+        {
+            SharedLog log;
+            Pool      pool(1, &ta);
+
+            Obj mX(bsl::make_shared<LogObserver>(&log, 0),
+                   &pool,
+                   4,
+                   ball::Severity::e_ERROR,
+                   &ta);
+
+            for (int i = 0; i < 10; ++i) {
+                mX.publish(makeRecord(toString(i)), ball::Context());
+            }
+
+            ASSERT(4 == mX.recordQueueLength());
+
+            mX.flush();
+
+            ASSERT(0 == mX.recordQueueLength());
+
+            bsl::vector<bsl::pair<int, bsl::string> > entries = log.entries();
+
+            ASSERTV(entries.size(), 5 == entries.size());
+            if (5 == entries.size()) {
+                ASSERT("0" == entries[0].second);
+                ASSERT("3" == entries[3].second);
+                ASSERTV(entries[4].second,
+                        "Dropped 6 log records." == entries[4].second);
+            }
+        }
+
+        if (verbose) cout << "\tBlocking records." << endl;
+        {
+            SharedLog log;
+            Pool      pool(1, &ta);
+
+            Obj mX(bsl::make_shared<LogObserver>(&log, 0),
+                   &pool,
+                   4,
+                   ball::Severity::e_ERROR,
+                   &ta);
+
+            ASSERT(0 == pool.start());
+
+            bsl::vector<Obj *> observers(1, &mX);
+
+            bslmt::ThreadUtil::Handle handle;
+            PublishThread             publisher = { &observers, 0, 100 };
+
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle, publisher));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            mX.flush();
+
+            bsl::vector<bsl::pair<int, bsl::string> > entries = log.entries();
+
+            ASSERTV(entries.size(), 100 == entries.size());
+            if (100 == entries.size()) {
+                ASSERT("0:0"  == entries[0].second);
+                ASSERT("0:99" == entries[99].second);
+            }
+
+            pool.stop();
+        }
+
+        if (verbose) cout << "\tPublishing to a pool that is not running."
+                          << endl;
+        {
+            for (int stopped = 0; stopped < 2; ++stopped) {
+                SharedLog log;
+                Pool      pool(1, &ta);
+
+                if (stopped) {
+                    ASSERT(0 == pool.start());
+                    pool.stop();
+                }
+
+                Obj mX(bsl::make_shared<LogObserver>(&log, 0),
+                       &pool,
+                       4,
+                       ball::Severity::e_ERROR,
+                       &ta);
+
+                // None of these calls may block, although every record is
+                // more severe than the drop threshold.
+
+                for (int i = 0; i < 10; ++i) {
+                    mX.publish(makeRecord(toString(i),
+                                          ball::Severity::e_FATAL),
+                               ball::Context());
+                }
+
+                ASSERTV(stopped, 4 == mX.recordQueueLength());
+
+                mX.flush();
+
+                ASSERTV(stopped, 0 == mX.recordQueueLength());
+
+                bsl::vector<bsl::pair<int, bsl::string> > entries =
+                                                                 log.entries();
+
+                ASSERTV(stopped, entries.size(), 5 == entries.size());
+                if (5 == entries.size()) {
+                    ASSERTV(stopped, "0" == entries[0].second);
+                    ASSERTV(stopped, "3" == entries[3].second);
+                    ASSERTV(stopped,
+                            entries[4].second,
+                            "Dropped 6 log records." == entries[4].second);
+                }
+            }
+        }
+
+        if (verbose) cout << "\tReleasing records." << endl;
+        {
+            SharedLog log;
+            Pool      pool(1, &ta);
+
+            bsl::shared_ptr<LogObserver> target =
+                                        bsl::make_shared<LogObserver>(&log, 0);
+
+            Obj mX(target, &pool, &ta);
+
+            for (int i = 0; i < 10; ++i) {
+                mX.publish(makeRecord(toString(i)), ball::Context());
+            }
+
+            ASSERT(10 == mX.recordQueueLength());
+
+            mX.releaseRecords();
+
+            ASSERT(0 == mX.recordQueueLength());
+            ASSERT(1 == target->numReleases());
+
+            mX.flush();
+
+            ASSERT(0 == log.entries().size());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // FAIRNESS
+        //
+        // Concerns:
+        // 1. A publication thread publishes at most `maxBatchSize()` records
+        //    of an observer before servicing the next ready observer.
+        //
+        // 2. Observers are serviced in the order in which they became ready.
+        //
+        // Plan:
+        // 1. Publish many records to one observer, and a few records to two
+        //    others, while the pool (having one thread) is stopped.  Start
+        //    the pool, and verify the order of the records received.
+        //    (C-1..2)
+        //
+        // Testing:
+        //   FAIRNESS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nFAIRNESS"
+                          << "\n========" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        SharedLog log;
+
+        Pool pool(1, 4, &ta);
+
+        Obj mA(bsl::make_shared<LogObserver>(&log, 0), &pool, &ta);
+        Obj mB(bsl::make_shared<LogObserver>(&log, 1), &pool, &ta);
+        Obj mC(bsl::make_shared<LogObserver>(&log, 2), &pool, &ta);
+
+        for (int i = 0; i < 20; ++i) {
+            mA.publish(makeRecord(toString(i)), ball::Context());
+        }
+        for (int i = 0; i < 6; ++i) {
+            mB.publish(makeRecord(toString(i)), ball::Context());
+        }
+        mC.publish(makeRecord("0"), ball::Context());
+
+        ASSERT(0 == pool.start());
+
+        pool.stop();
+
+        // Expected order of service: A (4), B (4), C (1), A (4), B (2), A (4),
+        // A (4), A (4).
+
+        static const int EXPECTED[] = {
+            0, 0, 0, 0,  1, 1, 1, 1,  2,  0, 0, 0, 0,  1, 1,
+            0, 0, 0, 0,  0, 0, 0, 0,  0, 0, 0, 0
+        };
+        const bsl::size_t NUM_EXPECTED = sizeof EXPECTED / sizeof *EXPECTED;
+
+        bsl::vector<bsl::pair<int, bsl::string> > entries = log.entries();
+
+        ASSERTV(entries.size(), NUM_EXPECTED == entries.size());
+
+        for (bsl::size_t i = 0; i < entries.size() && i < NUM_EXPECTED; ++i) {
+            ASSERTV(i, entries[i].first, EXPECTED[i] == entries[i].first);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // POOLED ASYNC OBSERVER
+        //
+        // Concerns:
+        // 1. The constructors initialize the accessors as specified.
+        //
+        // 2. Records are published to the wrapped observer, in order, by the
+        //    threads of a started pool.
+        //
+        // 3. `flush` publishes the queued records in the calling thread if
+        //    the pool is not started.
+        //
+        // 4. The destructor publishes the queued records.
+        //
+        // 5. All memory is allocated from the supplied allocator.
+        //
+        // Plan:
+        // 1. Create observers with each constructor, and verify the
+        //    accessors.  (C-1, 5)
+        //
+        // 2. Publish records to observers attached to started and stopped
+        //    pools, call `flush` or destroy the observer, and verify the
+        //    records received by the wrapped observer.  (C-2..4)
+        //
+        // Testing:
+        //   PooledAsyncObserver(const shared_ptr<Observer>&, Pool *, Alloc *);
+        //   PooledAsyncObserver(observer, pool, int, Level, Alloc *);
+        //   ~PooledAsyncObserver();
+        //   void flush();
+        //   void publish(const shared_ptr<const Record>&, const Context&);
+        //   int maxRecordQueueSize() const;
+        //   const bsl::shared_ptr<Observer>& observer() const;
+        //   AsyncPublisherPool *pool() const;
+        //   int recordQueueLength() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPOOLED ASYNC OBSERVER"
+                          << "\n=====================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        SharedLog log;
+
+        bsl::shared_ptr<LogObserver> target =
+                                        bsl::make_shared<LogObserver>(&log, 7);
+
+        if (verbose) cout << "\tConstructors and accessors." << endl;
+        {
+            Pool pool(1, &ta);
+
+            const bsls::Types::Int64 numBlocks = ta.numBlocksInUse();
+            {
+                const Obj X(target, &pool, &ta);
+
+                ASSERT(Obj::k_DEFAULT_MAX_RECORD_QUEUE_SIZE ==
+                                                      X.maxRecordQueueSize());
+                ASSERT(target == X.observer());
+                ASSERT(&pool  == X.pool());
+                ASSERT(0      == X.recordQueueLength());
+                ASSERT(numBlocks < ta.numBlocksInUse());
+            }
+            {
+                const Obj X(target, &pool, 10, ball::Severity::e_WARN, &ta);
+
+                ASSERT(10     == X.maxRecordQueueSize());
+                ASSERT(target == X.observer());
+                ASSERT(&pool  == X.pool());
+            }
+            ASSERT(numBlocks == ta.numBlocksInUse());
+
+            if (verbose) cout << "\tNegative testing." << endl;
+            {
+                bsls::AssertTestHandlerGuard hG;
+
+                bsl::shared_ptr<ball::Observer> null;
+
+                ASSERT_FAIL(Obj(null, &pool, &ta));
+                ASSERT_FAIL(Obj(target, 0, &ta));
+                ASSERT_FAIL(Obj(target, &pool, 0, ball::Severity::e_OFF));
+            }
+        }
+
+        if (verbose) cout << "\tStarted pool." << endl;
+        {
+            Pool pool(2, &ta);
+            ASSERT(0 == pool.start());
+
+            Obj mX(target, &pool, &ta);
+
+            for (int i = 0; i < 1000; ++i) {
+                mX.publish(makeRecord(toString(i)), ball::Context());
+            }
+            mX.flush();
+
+            ASSERT(0 == mX.recordQueueLength());
+
+            bsl::vector<bsl::pair<int, bsl::string> > entries = log.entries();
+
+            ASSERTV(entries.size(), 1000 == entries.size());
+            for (bsl::size_t i = 0; i < entries.size(); ++i) {
+                ASSERTV(i, 7 == entries[i].first);
+                ASSERTV(i, toString(static_cast<int>(i)) == entries[i].second);
+            }
+        }
+
+        if (verbose) cout << "\tStopped pool." << endl;
+        {
+            SharedLog                    log;
+            bsl::shared_ptr<LogObserver> target =
+                                        bsl::make_shared<LogObserver>(&log, 0);
+
+            Pool pool(1, &ta);
+
+            Obj mX(target, &pool, &ta);
+
+            for (int i = 0; i < 10; ++i) {
+                mX.publish(makeRecord(toString(i)), ball::Context());
+            }
+
+            ASSERT(10 == mX.recordQueueLength());
+            ASSERT(0  == log.entries().size());
+
+            mX.flush();
+
+            ASSERT(0  == mX.recordQueueLength());
+            ASSERT(10 == log.entries().size());
+
+            // Records received after a flush are held until the next one.
+
+            mX.publish(makeRecord("10"), ball::Context());
+
+            ASSERT(1  == mX.recordQueueLength());
+            ASSERT(10 == log.entries().size());
+
+            mX.flush();
+
+            ASSERT(11 == log.entries().size());
+        }
+
+        if (verbose) cout << "\tDestruction." << endl;
+        {
+            SharedLog                    log;
+            bsl::shared_ptr<LogObserver> target =
+                                        bsl::make_shared<LogObserver>(&log, 0);
+
+            Pool pool(1, &ta);
+            {
+                Obj mX(target, &pool, &ta);
+
+                for (int i = 0; i < 10; ++i) {
+                    mX.publish(makeRecord(toString(i)), ball::Context());
+                }
+            }
+            ASSERT(10 == log.entries().size());
+
+            ASSERT(0 == pool.start());
+            {
+                Obj mX(target, &pool, &ta);
+
+                for (int i = 0; i < 10; ++i) {
+                    mX.publish(makeRecord(toString(i)), ball::Context());
+                }
+            }
+            ASSERT(20 == log.entries().size());
+        }
+
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // ASYNC PUBLISHER POOL
+        //
+        // Concerns:
+        // 1. The constructors initialize the accessors as specified.
+        //
+        // 2. `start` creates the threads, and is idempotent.
+        //
+        // 3. `stop` publishes the queued records, joins the threads, and is
+        //    idempotent.
+        //
+        // 4. A pool can be restarted.
+        //
+        // Plan:
+        // 1. Create pools with each constructor, and verify the accessors.
+        //    (C-1)
+        //
+        // 2. Start and stop a pool repeatedly, publishing records to an
+        //    observer while the pool is started and stopped.  (C-2..4)
+        //
+        // Testing:
+        //   AsyncPublisherPool(int numThreads = 1, Allocator *ba = 0);
+        //   AsyncPublisherPool(int numThreads, int maxBatchSize, Allocator *);
+        //   ~AsyncPublisherPool();
+        //   int start();
+        //   void stop();
+        //   bool isStarted() const;
+        //   int maxBatchSize() const;
+        //   int numThreads() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nASYNC PUBLISHER POOL"
+                          << "\n====================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        {
+            const Pool X;
+
+            ASSERT(1 == X.numThreads());
+            ASSERT(Pool::k_DEFAULT_MAX_BATCH_SIZE == X.maxBatchSize());
+            ASSERT(!X.isStarted());
+        }
+        {
+            const Pool X(3, &ta);
+
+            ASSERT(3 == X.numThreads());
+            ASSERT(Pool::k_DEFAULT_MAX_BATCH_SIZE == X.maxBatchSize());
+            ASSERT(!X.isStarted());
+        }
+        {
+            const Pool X(2, 5, &ta);
+
+            ASSERT(2 == X.numThreads());
+            ASSERT(5 == X.maxBatchSize());
+            ASSERT(!X.isStarted());
+        }
+
+        {
+            SharedLog log;
+
+            Pool mX(2, &ta); const Pool& X = mX;
+
+            mX.stop();
+            ASSERT(!X.isStarted());
+
+            Obj observer(bsl::make_shared<LogObserver>(&log, 0), &mX, &ta);
+
+            for (bsl::size_t round = 0; round < 3; ++round) {
+                for (int i = 0; i < 5; ++i) {
+                    observer.publish(makeRecord(toString(i)),
+                                     ball::Context());
+                }
+
+                ASSERTV(round, 0 == mX.start());
+                ASSERTV(round, X.isStarted());
+                ASSERTV(round, 0 == mX.start());
+                ASSERTV(round, X.isStarted());
+
+                for (int i = 5; i < 10; ++i) {
+                    observer.publish(makeRecord(toString(i)),
+                                     ball::Context());
+                }
+
+                mX.stop();
+                ASSERTV(round, !X.isStarted());
+                mX.stop();
+                ASSERTV(round, !X.isStarted());
+
+                ASSERTV(round, 0 == observer.recordQueueLength());
+                ASSERTV(round, (round + 1) * 10 == log.entries().size());
+            }
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Pool(1, &ta));
+            ASSERT_FAIL(Pool(0, &ta));
+            ASSERT_PASS(Pool(1, 1, &ta));
+            ASSERT_FAIL(Pool(1, 0, &ta));
+        }
+
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        // 1. The classes are sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Publish records to two observers sharing a pool, and verify that
+        //    the wrapped observers receive them.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        Pool pool(1, &ta);
+        ASSERT(0 == pool.start());
+        ASSERT(pool.isStarted());
+
+        bsl::shared_ptr<ball::TestObserver> targetA =
+                                bsl::make_shared<ball::TestObserver>(&cout);
+        bsl::shared_ptr<ball::TestObserver> targetB =
+                                bsl::make_shared<ball::TestObserver>(&cout);
+
+        Obj mA(targetA, &pool, &ta);
+        Obj mB(targetB, &pool, &ta);
+
+        mA.publish(makeRecord("a1"), ball::Context());
+        mB.publish(makeRecord("b1"), ball::Context());
+        mA.publish(makeRecord("a2"), ball::Context());
+
+        mA.flush();
+        mB.flush();
+
+        ASSERT(2 == targetA->numPublishedRecords());
+        ASSERT(1 == targetB->numPublishedRecords());
+        ASSERT(bsl::string("a2") ==
+                       targetA->lastPublishedRecord().fixedFields().message());
+
+        pool.stop();
+        ASSERT(!pool.isStarted());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        // 1. A pool of few threads sustains the publication rate of many
+        //    observers.
+        //
+        // Plan:
+        // 1. Publish records round-robin to 12 observers sharing a pool of
+        //    one thread, and of four threads, and report the time per record
+        //    and the number of records dropped.  The number of records
+        //    published to each observer is given by the second command-line
+        //    argument (default: 100000).
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        cout << "\nPERFORMANCE TEST"
+             << "\n================" << endl;
+
+        enum { k_NUM_OBSERVERS = 12 };
+
+        const int NUM_ITERATIONS = argc > 2 && bsl::atoi(argv[2]) > 0
+                                 ? bsl::atoi(argv[2])
+                                 : 100000;
+
+        const bsl::shared_ptr<const ball::Record> record =
+                                   makeRecord("performance test record");
+
+        for (int numThreads = 1; numThreads <= 4; numThreads *= 4) {
+            bsl::shared_ptr<ball::TestObserver> target =
+                                bsl::make_shared<ball::TestObserver>(&cout);
+
+            Pool pool(numThreads);
+            ASSERT(0 == pool.start());
+
+            bsl::vector<Obj *> observers;
+            for (int i = 0; i < k_NUM_OBSERVERS; ++i) {
+                observers.push_back(new Obj(target, &pool));
+            }
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                for (int j = 0; j < k_NUM_OBSERVERS; ++j) {
+                    observers[j]->publish(record, ball::Context());
+                }
+            }
+            for (int j = 0; j < k_NUM_OBSERVERS; ++j) {
+                observers[j]->flush();
+            }
+            timer.stop();
+
+            for (int j = 0; j < k_NUM_OBSERVERS; ++j) {
+                delete observers[j];
+            }
+
+            const int numRecords = NUM_ITERATIONS * k_NUM_OBSERVERS;
+
+            cout << "pool threads:          " << numThreads << endl
+                 << "records:               " << numRecords << endl
+                 << "published:             "
+                 << target->numPublishedRecords() << endl
+                 << "ns per record:         "
+                 << timer.elapsedTime() * 1e9 / numRecords << endl;
+        }
+      } break;
+      default: {
+        cout << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cout << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -5,8 +5,8 @@
 BSLS_IDENT_RCSID(ball_broadcastobserver_cpp,"$Id$ $CSID$")
 
 #include <ball_context.h>               // for testing only
-#include <ball_record.h>                // for testing only
-#include <ball_recordattributes.h>      // for testing only
+#include <ball_record.h>
+#include <ball_recordattributes.h>
 #include <ball_testobserver.h>          // for testing only
 #include <ball_transmission.h>          // for testing only
 
@@ -25,6 +25,21 @@ BroadcastObserver::~BroadcastObserver()
     deregisterAllObservers();
 }
 
+// PRIVATE MANIPULATORS
+void BroadcastObserver::updateSupportsDeferredMessages()
+{
+    bool supported = !d_observers.empty();
+
+    ObserverRegistry::const_iterator it  = d_observers.begin();
+    ObserverRegistry::const_iterator end = d_observers.end();
+
+    for (; supported && it != end; ++it) {
+        supported = (it->second)->supportsDeferredMessages();
+    }
+
+    d_supportsDeferredMessages = supported;
+}
+
 // MANIPULATORS
 int BroadcastObserver::deregisterObserver(const bsl::string_view& observerName)
 {
@@ -40,6 +55,8 @@ int BroadcastObserver::deregisterObserver(const bsl::string_view& observerName)
 
     d_observers.erase(it);
 
+    updateSupportsDeferredMessages();
+
     observer->releaseRecords();
 
     return 0;
@@ -58,6 +75,8 @@ void BroadcastObserver::deregisterAllObservers()
 
         observer->releaseRecords();
     }
+
+    d_supportsDeferredMessages = false;
 }
 
 bsl::shared_ptr<Observer> BroadcastObserver::findObserver(
@@ -82,8 +101,28 @@ void BroadcastObserver::publish(const bsl::shared_ptr<const Record>& record,
     ObserverRegistry::const_iterator it  = d_observers.begin();
     ObserverRegistry::const_iterator end = d_observers.end();
 
+    if (!record->fixedFields().isMessageDeferred()) {
+        for (; it != end; ++it) {
+            (it->second)->publish(record, context);
+        }
+        return;                                                       // RETURN
+    }
+
+    bsl::shared_ptr<Record> rendered;  // created on first use
+
     for (; it != end; ++it) {
-        (it->second)->publish(record, context);
+        if ((it->second)->supportsDeferredMessages()) {
+            (it->second)->publish(record, context);
+        }
+        else {
+            if (!rendered) {
+                rendered = bsl::allocate_shared<Record>(
+                                                   d_observers.get_allocator(),
+                                                   *record);
+                rendered->fixedFields().renderMessage();
+            }
+            (it->second)->publish(rendered, context);
+        }
     }
 }
 
@@ -93,7 +132,13 @@ int BroadcastObserver::registerObserver(
 {
     bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> guard(&d_rwMutex);
 
-    return !d_observers.emplace(observerName, observer).second;
+    if (!d_observers.emplace(observerName, observer).second) {
+        return 1;                                                     // RETURN
+    }
+
+    updateSupportsDeferredMessages();
+
+    return 0;
 }
 
 void BroadcastObserver::releaseRecords()
@@ -123,6 +168,11 @@ BroadcastObserver::findObserver(const bsl::string_view& observerName) const
     return it->second;
 }
 
+bool BroadcastObserver::supportsDeferredMessages() const
+{
+    return d_supportsDeferredMessages;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -33,6 +33,7 @@ BSLS_IDENT("$Id: $")
 //                                         dtor
 //                                         publish
 //                                         releaseRecords
+//                                         supportsDeferredMessages
 // ```
 // `ball::BroadcastObserver` is a concrete class derived from `ball::Observer`
 // that processes the log records it receives through its `publish` method by
@@ -43,6 +44,16 @@ BSLS_IDENT("$Id: $")
 // `deregisterObserver` method.  Once registered, an observer receives all log
 // records that its associated broadcast observer receives.
 //
+///Deferred Messages
+///-----------------
+// A broadcast observer supports records having a deferred message (see
+// `ball_observer`) if at least one observer is registered and every
+// registered observer supports them.  If a record having a deferred message
+// is nonetheless published (e.g., a record buffered before an observer not
+// supporting deferred messages was registered), the observers not supporting
+// deferred messages are supplied a copy of the record in which the message is
+// rendered.
+//
 ///Thread Safety
 ///-------------
 // `ball::BroadcastObserver` is thread-safe, meaning that multiple threads may
@@ -156,6 +167,7 @@ BSLS_IDENT("$Id: $")
 #include <bslmt_readerwritermutex.h>
 #include <bslmt_readlockguard.h>
 
+#include <bsls_atomic.h>
 #include <bsls_keyword.h>
 
 #include <bsl_memory.h>
@@ -198,11 +210,25 @@ class BroadcastObserver : public Observer {
     mutable bslmt::ReaderWriterMutex d_rwMutex;    // protects concurrent
                                                    // access to `d_observers`
 
+    bsls::AtomicBool                 d_supportsDeferredMessages;
+                                                   // `true` if the registry
+                                                   // is not empty and all
+                                                   // registered observers
+                                                   // support deferred
+                                                   // messages
+
   private:
     // NOT IMPLEMENTED
     BroadcastObserver(const BroadcastObserver&);
     BroadcastObserver& operator=(const BroadcastObserver&);
 
+    // PRIVATE MANIPULATORS
+
+    /// Recompute whether all the observers in the registry of this broadcast
+    /// observer support deferred messages.  The behavior is undefined unless
+    /// the write lock on `d_rwMutex` is held.
+    void updateSupportsDeferredMessages();
+
   public:
     // CREATORS
 
@@ -265,7 +291,9 @@ class BroadcastObserver : public Observer {
 
     /// Process the specified log `record` having the specified publishing
     /// `context` by forwarding `record` and `context` to each of the
-    /// observers registered with this broadcast observer.
+    /// observers registered with this broadcast observer.  If the message of
+    /// `record` is deferred, the observers that do not support deferred
+    /// messages are supplied a copy of `record` having the rendered message.
     void publish(const bsl::shared_ptr<const Record>& record,
                  const Context&                       context)
                                                          BSLS_KEYWORD_OVERRIDE;
@@ -339,6 +367,11 @@ class BroadcastObserver : public Observer {
     /// observer.
     int numRegisteredObservers() const;
 
+    /// Return `true` if at least one observer is registered with this
+    /// broadcast observer and every registered observer supports records
+    /// having a deferred message, and `false` otherwise.
+    bool supportsDeferredMessages() const BSLS_KEYWORD_OVERRIDE;
+
     /// Invoke the specified `visitor` functor of (template parameter)
     /// `t_VISITOR` type on each element in the registry of this broadcast
     /// observer, supplying that functor modifiable access to each observer.
@@ -364,6 +397,7 @@ class BroadcastObserver : public Observer {
 inline
 BroadcastObserver::BroadcastObserver(bslma::Allocator *basicAllocator)
 : d_observers(bslma::Default::allocator(basicAllocator))
+, d_supportsDeferredMessages(false)
 {
 }
 
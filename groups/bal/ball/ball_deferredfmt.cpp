@@ -0,0 +1,73 @@
+// ball_deferredfmt.cpp                                               -*-C++-*-
+#include <ball_deferredfmt.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_deferredfmt_cpp,"$Id$ $CSID$")
+
+#include <bsls_exceptionutil.h>
+
+#include <bsl_ios.h>
+#include <bsl_iterator.h>
+
+namespace BloombergLP {
+namespace ball {
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+
+                           // ----------------------
+                           // struct DeferredFmtUtil
+                           // ----------------------
+
+// CLASS METHODS
+void DeferredFmtUtil::render(bsl::streambuf   *output,
+                             bsl::string_view  format,
+                             bsl::format_args  args)
+{
+    BSLS_ASSERT(output);
+
+    typedef bsl::streambuf::pos_type pos_type;
+
+    const pos_type start = output->pubseekoff(0,
+                                              bsl::ios_base::cur,
+                                              bsl::ios_base::out);
+
+    BSLS_TRY {
+        bsl::vformat_to(bsl::ostreambuf_iterator<char>(output), format, args);
+    }
+    BSLS_CATCH(const bsl::format_error& error) {
+        // The format string is not checked until the message is rendered;
+        // discard any partial output (if `output` is seekable), and preserve
+        // what was logged along with the reason it is invalid.
+
+        static const char k_SEPARATOR[] = " [invalid format: ";
+
+        if (pos_type(-1) != start) {
+            output->pubseekpos(start, bsl::ios_base::out);
+        }
+        output->sputn(format.data(), format.length());
+        output->sputn(k_SEPARATOR, sizeof k_SEPARATOR - 1);
+        output->sputn(error.what(), bsl::strlen(error.what()));
+        output->sputc(']');
+    }
+}
+
+#endif  // BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
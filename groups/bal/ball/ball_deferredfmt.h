@@ -0,0 +1,601 @@
+// ball_deferredfmt.h                                                 -*-C++-*-
+#ifndef INCLUDED_BALL_DEFERREDFMT
+#define INCLUDED_BALL_DEFERREDFMT
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide macros for `bsl::format` logging with deferred formatting.
+//
+//@CLASSES:
+//  ball::DeferredFmtUtil: utility for capturing deferred messages
+//
+//@MACROS:
+//  BALL_DEFERRED_FMT: capture a deferred message within a `*_BLOCK`
+//  BALL_DEFERRED_FMT_TRACE: log a deferred message with the `e_TRACE` level
+//  BALL_DEFERRED_FMT_DEBUG: log a deferred message with the `e_DEBUG` level
+//  BALL_DEFERRED_FMT_INFO: log a deferred message with the `e_INFO` level
+//  BALL_DEFERRED_FMT_WARN: log a deferred message with the `e_WARN` level
+//  BALL_DEFERRED_FMT_ERROR: log a deferred message with the `e_ERROR` level
+//  BALL_DEFERRED_FMT_FATAL: log a deferred message with the `e_FATAL` level
+//
+//@SEE_ALSO: ball_fmt, ball_recordattributes, ball_asyncfileobserver
+//
+//@DESCRIPTION: This component provides preprocessor macros, analogous to
+// those provided by `ball_fmt`, that log a message specified by a standard
+// `format` format string and a sequence of arguments, but that *defer* the
+// formatting of the message: rather than rendering the message text on the
+// logging thread, the macros capture the address of the format string and a
+// bitwise copy of the arguments into the message buffer of the log record,
+// and the message text is rendered only when (and where) it is required.
+//
+// When the observer registered with the logger manager supports deferred
+// messages (see `ball_observer`) -- e.g., when all log records are published
+// through a `ball::AsyncFileObserver` -- the message is rendered by the
+// publication thread of the observer, removing the (often dominant) cost of
+// formatting from the logging thread.  Otherwise, the logger renders the
+// message before publishing the record, so that the macros can be used with
+// any observer (at a cost similar to that of the `ball_fmt` macros).
+//
+// This component also provides the utility `ball::DeferredFmtUtil`, used by
+// the macros to capture a deferred message into a `ball::RecordAttributes`.
+//
+///Argument Types
+///--------------
+// As the arguments are formatted after the logging statement completes, their
+// values are captured at the time of the logging statement.  The supported
+// argument types are:
+//
+// * types convertible to `bsl::string_view` (e.g., `const char *`,
+//   `bsl::string`, and `bsl::string_view`), whose characters are copied, and
+//   which are formatted as a `bsl::string_view`, and
+// * bitwise copyable types (e.g., fundamental types, `const void *`, and
+//   `bdlt::Date`) having a `bsl::formatter` specialization, which are copied
+//   bitwise, and are formatted as themselves.
+//
+// A logging statement having an argument of any other type, or of a pointer
+// type other than a pointer to `void` (or to a character type, which is a
+// string), fails to compile; use the `ball_fmt` macros for such statements.
+// Note that a null `const char *` argument is formatted as the empty string.
+//
+// **WARNING**: Only the argument *object* is copied.  The formatter of a
+// bitwise copyable argument runs on the publication thread, possibly long
+// after the logging statement has returned, so it must not dereference any
+// pointer (or reference, or handle) held by the argument: a user-defined,
+// bitwise copyable type holding, e.g., a `const char *` member, and having a
+// `bsl::formatter` that prints the characters it refers to, compiles, but the
+// rendered message then reads memory that may have been modified or freed.
+// Format such a value with the `ball_fmt` macros, or pass the referenced data
+// itself (e.g., as a `bsl::string_view`) as the argument.
+//
+///Format Strings
+///--------------
+// The format string must be a string literal, as only its address is
+// captured.  The macros enforce this by concatenating an empty string literal
+// with their first argument: a format string that is not a literal (e.g.,
+// `str.c_str()` or a `const char *` variable) fails to compile.  As the format
+// string is not checked until the message is rendered, a format string that
+// is not valid for the supplied arguments does not result in a compilation
+// error; rather, the rendered message is the format string followed by a
+// description of the error.
+//
+///C++03 Support
+///-------------
+// Deferred formatting requires variadic templates.  If variadic templates are
+// not supported by the compiler, the macros provided by this component are
+// equivalent to the corresponding `ball_fmt` macros (i.e., the message is
+// formatted on the logging thread).
+//
+///Thread Safety
+///-------------
+// All macros defined in this component are thread-safe, and can be invoked
+// concurrently by multiple threads.
+//
+///Macro Reference
+///---------------
+// The following `BALL_DEFERRED_FMT_*` macros log a single message:
+// ```
+// BALL_DEFERRED_FMT_TRACE(format_string_literal, ARG1, ARG2, ...);
+// BALL_DEFERRED_FMT_DEBUG(format_string_literal, ARG1, ARG2, ...);
+// BALL_DEFERRED_FMT_INFO( format_string_literal, ARG1, ARG2, ...);
+// BALL_DEFERRED_FMT_WARN( format_string_literal, ARG1, ARG2, ...);
+// BALL_DEFERRED_FMT_ERROR(format_string_literal, ARG1, ARG2, ...);
+// BALL_DEFERRED_FMT_FATAL(format_string_literal, ARG1, ARG2, ...);
+// ```
+// Within the logging code blocks of `ball_log` (e.g., `BALL_LOG_INFO_BLOCK`),
+// the special macro `BALL_DEFERRED_FMT` captures a deferred message into the
+// log record being built there:
+// ```
+// BALL_DEFERRED_FMT(format_string_literal, ARG1, ARG2, ...);
+// ```
+// Note that, unlike `BALL_FMT`, `BALL_DEFERRED_FMT` *replaces* the message of
+// the log record, so it should be used at most once within a block.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Logging Off the Critical Path
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose a latency-sensitive thread logs each order it processes, and that
+// log records are published through a `ball::AsyncFileObserver`.
+//
+// First, we initialize the log category within the context of the function:
+// ```
+// BALL_LOG_SET_CATEGORY("EXAMPLE.ORDERS");
+// ```
+// Then, we log the order using `BALL_DEFERRED_FMT_INFO`.  The logging thread
+// only copies the address of the format string and the values of the
+// arguments into the log record; the message is formatted by the publication
+// thread of the async file observer:
+// ```
+// const int         orderId  = 1234;
+// const double      price    = 99.5;
+// const bsl::string symbol("IBM", &scratchAllocator);
+//
+// BALL_DEFERRED_FMT_INFO("Order {}: {} at {:.2f}", orderId, symbol, price);
+// ```
+// The rendered message is "Order 1234: IBM at 99.50".
+
+#include <balscm_version.h>
+
+#include <ball_fmt.h>
+#include <ball_log.h>
+#include <ball_recordattributes.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_decay.h>
+#include <bslmf_isbitwisecopyable.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_ispointer.h>
+#include <bslmf_isvoid.h>
+#include <bslmf_removepointer.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_util.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstring.h>
+#include <bsl_format.h>
+#include <bsl_streambuf.h>
+#include <bsl_string_view.h>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+
+                         // =========================
+                         // Logging Macro Definitions
+                         // =========================
+
+// The empty string literal is concatenated with the format string, the first
+// of the macro arguments, so that only a string literal is accepted.
+
+#define BALL_DEFERRED_FMT(...)                                                \
+    BloombergLP::ball::DeferredFmtUtil::capture(                              \
+                           &BALL_LOG_RECORD->fixedFields(), "" __VA_ARGS__)
+
+#define BALL_DEFERRED_FMT_TRACE(...)                                          \
+    BALL_LOG_STREAM_CONST_IMP(BloombergLP::ball::Severity::e_TRACE)           \
+    BALL_DEFERRED_FMT(__VA_ARGS__)
+
+#define BALL_DEFERRED_FMT_DEBUG(...)                                          \
+    BALL_LOG_STREAM_CONST_IMP(BloombergLP::ball::Severity::e_DEBUG)           \
+    BALL_DEFERRED_FMT(__VA_ARGS__)
+
+#define BALL_DEFERRED_FMT_INFO(...)                                           \
+    BALL_LOG_STREAM_CONST_IMP(BloombergLP::ball::Severity::e_INFO)            \
+    BALL_DEFERRED_FMT(__VA_ARGS__)
+
+#define BALL_DEFERRED_FMT_WARN(...)                                           \
+    BALL_LOG_STREAM_CONST_IMP(BloombergLP::ball::Severity::e_WARN)            \
+    BALL_DEFERRED_FMT(__VA_ARGS__)
+
+#define BALL_DEFERRED_FMT_ERROR(...)                                          \
+    BALL_LOG_STREAM_CONST_IMP(BloombergLP::ball::Severity::e_ERROR)           \
+    BALL_DEFERRED_FMT(__VA_ARGS__)
+
+#define BALL_DEFERRED_FMT_FATAL(...)                                          \
+    BALL_LOG_STREAM_CONST_IMP(BloombergLP::ball::Severity::e_FATAL)           \
+    BALL_DEFERRED_FMT(__VA_ARGS__)
+
+namespace BloombergLP {
+namespace ball {
+
+                         // ======================
+                         // struct DeferredFmtUtil
+                         // ======================
+
+/// This `struct` provides a namespace for utility functions that capture a
+/// deferred `bsl::format` message into the message attribute of a
+/// `RecordAttributes` object.
+struct DeferredFmtUtil {
+
+    // CLASS METHODS
+
+    /// Set the message attribute of the specified `attributes` to the
+    /// deferred message specified by the `format` string and the specified
+    /// `args`.  The message is rendered, as if by `bsl::format`, when
+    /// `attributes->renderMessage()` is called.  The behavior is undefined
+    /// unless `format` has static storage duration (e.g., is a string
+    /// literal).  Note that this method does not compile unless each of the
+    /// (template parameter) `t_ARGS` types is either convertible to
+    /// `bsl::string_view` or bitwise copyable and not a pointer to an
+    /// object.  Also note that, unlike the macros of this component, this
+    /// method cannot verify that `format` is a string literal.
+    template <class... t_ARGS>
+    static void capture(RecordAttributes *attributes,
+                        const char       *format,
+                        const t_ARGS&...  args);
+
+    /// Write to the specified `output` the result of formatting the
+    /// specified `args` according to the specified `format`.  If `format` is
+    /// not valid for `args`, write `format` followed by a description of the
+    /// error instead; any partial result already written is discarded if
+    /// `output` supports seeking.
+    static void render(bsl::streambuf   *output,
+                       bsl::string_view  format,
+                       bsl::format_args  args);
+};
+
+                      // ================================
+                      // struct DeferredFmt_ArgumentCodec
+                      // ================================
+
+/// This component-private `struct` provides functions to encode a value of
+/// the (template parameter) `t_TYPE` into the message buffer of a record, and
+/// to decode the value from the encoded representation.  This primary
+/// template handles bitwise copyable types other than pointers to objects,
+/// which would be dereferenced after the logging statement has returned.
+template <class t_TYPE,
+          bool  t_IS_STRING =
+                   bsl::is_convertible<const t_TYPE&, bsl::string_view>::value>
+struct DeferredFmt_ArgumentCodec {
+
+    BSLMF_ASSERT(bslmf::IsBitwiseCopyable<t_TYPE>::value);
+    BSLMF_ASSERT(
+           !bsl::is_pointer<t_TYPE>::value ||
+            bsl::is_void<typename bsl::remove_pointer<t_TYPE>::type>::value);
+
+    // TYPES
+    typedef t_TYPE DecodedType;
+
+    // CLASS METHODS
+
+    /// Write the encoded representation of the specified `value` to the
+    /// specified `output`.
+    static void encode(bsl::streambuf *output, const t_TYPE& value);
+
+    /// Load into the specified `result` the value decoded from the encoded
+    /// representation at the specified `data` address, and return the
+    /// address following the encoded representation.
+    static const char *decode(bsls::ObjectBuffer<DecodedType> *result,
+                              const char                      *data);
+};
+
+/// This partial specialization of `DeferredFmt_ArgumentCodec` handles the
+/// types convertible to `bsl::string_view`, whose characters are encoded and
+/// which are decoded as a `bsl::string_view`.
+template <class t_TYPE>
+struct DeferredFmt_ArgumentCodec<t_TYPE, true> {
+
+    // TYPES
+    typedef bsl::string_view DecodedType;
+
+  private:
+    // PRIVATE CLASS METHODS
+
+    /// Return a string view of the specified `value`, or an empty string
+    /// view if `value` is null.
+    static bsl::string_view toView(const char *value);
+    static bsl::string_view toView(char *value);
+
+    /// Return a string view of the specified `value`.
+    template <class t_OTHER>
+    static bsl::string_view toView(const t_OTHER& value);
+
+  public:
+    // CLASS METHODS
+
+    /// Write the encoded representation of the specified `value` to the
+    /// specified `output`.
+    static void encode(bsl::streambuf *output, const t_TYPE& value);
+
+    /// Load into the specified `result` a string view of the characters
+    /// encoded at the specified `data` address, and return the address
+    /// following the encoded representation.
+    static const char *decode(bsls::ObjectBuffer<DecodedType> *result,
+                              const char                      *data);
+};
+
+                        // ===========================
+                        // struct DeferredFmt_Renderer
+                        // ===========================
+
+/// This component-private `struct` provides a function that renders a
+/// deferred message from the encoded values of the (template parameter)
+/// `t_ARGS` types.
+template <class... t_ARGS>
+struct DeferredFmt_Renderer;
+
+/// This specialization of `DeferredFmt_Renderer` renders the deferred message
+/// once all arguments have been decoded.
+template <>
+struct DeferredFmt_Renderer<> {
+
+    // CLASS METHODS
+
+    /// Write to the specified `output` the result of formatting the
+    /// specified `decoded` values according to the specified `format`.  The
+    /// behavior is undefined unless `data == end`.
+    template <class... t_DECODED>
+    static void renderImp(bsl::streambuf *output,
+                          const char     *format,
+                          const char     *data,
+                          const char     *end,
+                          t_DECODED&...   decoded);
+};
+
+/// This partial specialization of `DeferredFmt_Renderer` decodes the value of
+/// the (template parameter) `t_HEAD` type, and recurses on the `t_TAIL`
+/// types.
+template <class t_HEAD, class... t_TAIL>
+struct DeferredFmt_Renderer<t_HEAD, t_TAIL...> {
+
+    // CLASS METHODS
+
+    /// Decode the value of the (template parameter) `t_HEAD` type at the
+    /// specified `data` address and write to the specified `output` the
+    /// result of formatting the specified previously `decoded` values, the
+    /// decoded value, and the values of the `t_TAIL` types that follow it,
+    /// according to the specified `format`.  The behavior is undefined
+    /// unless the values are encoded in the range `[data .. end)`.
+    template <class... t_DECODED>
+    static void renderImp(bsl::streambuf *output,
+                          const char     *format,
+                          const char     *data,
+                          const char     *end,
+                          t_DECODED&...   decoded);
+};
+
+                         // ==========================
+                         // struct DeferredFmt_Message
+                         // ==========================
+
+/// This component-private `struct` provides the message renderer of the
+/// deferred messages having arguments of the (template parameter) `t_ARGS`
+/// types.
+template <class... t_ARGS>
+struct DeferredFmt_Message {
+
+    // CLASS METHODS
+
+    /// Write to the specified `output` the text of the deferred message
+    /// whose encoded representation, having the specified `length`, is at
+    /// the specified `data` address.  Note that this function has the
+    /// signature of `RecordAttributes::MessageRenderer`.
+    static void render(bsl::streambuf *output,
+                       const char     *data,
+                       bsl::size_t     length);
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                      // --------------------------------
+                      // struct DeferredFmt_ArgumentCodec
+                      // --------------------------------
+
+// CLASS METHODS
+template <class t_TYPE, bool t_IS_STRING>
+inline
+void DeferredFmt_ArgumentCodec<t_TYPE, t_IS_STRING>::encode(
+                                                   bsl::streambuf *output,
+                                                   const t_TYPE&   value)
+{
+    output->sputn(reinterpret_cast<const char *>(bsls::Util::addressOf(value)),
+                  sizeof(t_TYPE));
+}
+
+template <class t_TYPE, bool t_IS_STRING>
+inline
+const char *DeferredFmt_ArgumentCodec<t_TYPE, t_IS_STRING>::decode(
+                                     bsls::ObjectBuffer<DecodedType> *result,
+                                     const char                      *data)
+{
+    bsl::memcpy(result->buffer(), data, sizeof(t_TYPE));
+    return data + sizeof(t_TYPE);
+}
+
+// PRIVATE CLASS METHODS
+template <class t_TYPE>
+inline
+bsl::string_view DeferredFmt_ArgumentCodec<t_TYPE, true>::toView(
+                                                             const char *value)
+{
+    return value ? bsl::string_view(value) : bsl::string_view();
+}
+
+template <class t_TYPE>
+inline
+bsl::string_view DeferredFmt_ArgumentCodec<t_TYPE, true>::toView(char *value)
+{
+    return value ? bsl::string_view(value) : bsl::string_view();
+}
+
+template <class t_TYPE>
+template <class t_OTHER>
+inline
+bsl::string_view DeferredFmt_ArgumentCodec<t_TYPE, true>::toView(
+                                                         const t_OTHER& value)
+{
+    return bsl::string_view(value);
+}
+
+// CLASS METHODS
+template <class t_TYPE>
+inline
+void DeferredFmt_ArgumentCodec<t_TYPE, true>::encode(bsl::streambuf *output,
+                                                     const t_TYPE&   value)
+{
+    const bsl::string_view view   = toView(value);
+    const bsl::size_t      length = view.length();
+
+    output->sputn(reinterpret_cast<const char *>(&length), sizeof length);
+    output->sputn(view.data(), length);
+}
+
+template <class t_TYPE>
+inline
+const char *DeferredFmt_ArgumentCodec<t_TYPE, true>::decode(
+                                     bsls::ObjectBuffer<DecodedType> *result,
+                                     const char                      *data)
+{
+    bsl::size_t length;
+    bsl::memcpy(&length, data, sizeof length);
+    data += sizeof length;
+
+    new (result->buffer()) bsl::string_view(data, length);
+    return data + length;
+}
+
+                        // ---------------------------
+                        // struct DeferredFmt_Renderer
+                        // ---------------------------
+
+// CLASS METHODS
+template <class... t_DECODED>
+inline
+void DeferredFmt_Renderer<>::renderImp(bsl::streambuf *output,
+                                       const char     *format,
+                                       const char     *data,
+                                       const char     *end,
+                                       t_DECODED&...   decoded)
+{
+    BSLS_ASSERT(data == end);
+    (void)data;
+    (void)end;
+
+    DeferredFmtUtil::render(output, format, bsl::make_format_args(decoded...));
+}
+
+template <class t_HEAD, class... t_TAIL>
+template <class... t_DECODED>
+inline
+void DeferredFmt_Renderer<t_HEAD, t_TAIL...>::renderImp(
+                                                   bsl::streambuf *output,
+                                                   const char     *format,
+                                                   const char     *data,
+                                                   const char     *end,
+                                                   t_DECODED&...   decoded)
+{
+    typedef DeferredFmt_ArgumentCodec<t_HEAD> Codec;
+
+    // Note that the decoded types are trivially destructible.
+
+    bsls::ObjectBuffer<typename Codec::DecodedType> value;
+
+    data = Codec::decode(&value, data);
+
+    DeferredFmt_Renderer<t_TAIL...>::renderImp(output,
+                                               format,
+                                               data,
+                                               end,
+                                               decoded...,
+                                               value.object());
+}
+
+                         // --------------------------
+                         // struct DeferredFmt_Message
+                         // --------------------------
+
+// CLASS METHODS
+template <class... t_ARGS>
+void DeferredFmt_Message<t_ARGS...>::render(bsl::streambuf *output,
+                                            const char     *data,
+                                            bsl::size_t     length)
+{
+    BSLS_ASSERT(sizeof(const char *) <= length);
+
+    const char *format;
+    bsl::memcpy(&format, data, sizeof format);
+
+    DeferredFmt_Renderer<t_ARGS...>::renderImp(output,
+                                               format,
+                                               data + sizeof format,
+                                               data + length);
+}
+
+                           // ----------------------
+                           // struct DeferredFmtUtil
+                           // ----------------------
+
+// CLASS METHODS
+template <class... t_ARGS>
+void DeferredFmtUtil::capture(RecordAttributes *attributes,
+                              const char       *format,
+                              const t_ARGS&...  args)
+{
+    BSLS_ASSERT(attributes);
+    BSLS_ASSERT(format);
+
+    attributes->clearMessage();
+
+    bsl::streambuf *output = &attributes->messageStreamBuf();
+
+    output->sputn(reinterpret_cast<const char *>(&format), sizeof format);
+
+    // Encode each argument in order; the braced initializer guarantees
+    // left-to-right evaluation.
+
+    int expand[] = {
+        0,
+        (DeferredFmt_ArgumentCodec<typename bsl::decay<const t_ARGS>::type>::
+                                                          encode(output, args),
+         0)...
+    };
+    (void)expand;
+
+    typedef DeferredFmt_Message<typename bsl::decay<const t_ARGS>::type...>
+                                                                       Message;
+
+    attributes->setMessageRenderer(&Message::render);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#else  // if !defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+
+                         // =========================
+                         // Logging Macro Definitions
+                         // =========================
+
+#define BALL_DEFERRED_FMT(...)       BALL_FMT(__VA_ARGS__)
+#define BALL_DEFERRED_FMT_TRACE(...) BALL_FMT_TRACE(__VA_ARGS__)
+#define BALL_DEFERRED_FMT_DEBUG(...) BALL_FMT_DEBUG(__VA_ARGS__)
+#define BALL_DEFERRED_FMT_INFO(...)  BALL_FMT_INFO(__VA_ARGS__)
+#define BALL_DEFERRED_FMT_WARN(...)  BALL_FMT_WARN(__VA_ARGS__)
+#define BALL_DEFERRED_FMT_ERROR(...) BALL_FMT_ERROR(__VA_ARGS__)
+#define BALL_DEFERRED_FMT_FATAL(...) BALL_FMT_FATAL(__VA_ARGS__)
+
+#endif  // BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES
+
+#endif  // INCLUDED_BALL_DEFERREDFMT
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,704 @@
+// ball_deferredfmt.t.cpp                                             -*-C++-*-
+#include <ball_deferredfmt.h>
+
+#include <ball_administration.h>
+#include <ball_log.h>
+#include <ball_observer.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_streamobserver.h>
+#include <ball_testobserver.h>
+
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>    // atoi()
+#include <bsl_cstring.h>    // strcmp()
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+
+// Warning: the following `using` declarations interfere with the testing of
+// the macros defined in this component.  Please do not un-comment them.
+//
+// using namespace BloombergLP;
+// using namespace bsl;
+
+using bsl::cout;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test consists of a utility that captures a deferred
+// message into a `ball::RecordAttributes` object, and of a few preprocessor
+// macros implemented in terms of that utility.
+//
+// We first verify that `DeferredFmtUtil::capture` encodes arguments of every
+// supported kind such that the message rendered by `renderMessage` is the
+// message `bsl::format` would produce.  We then verify that an invalid format
+// string is reported in the rendered message.  Finally, each macro is tested
+// to ensure that the published record has the expected attributes, both when
+// the registered observer does not support deferred messages (so the logger
+// renders the message) and when it does (so the message reaches the observer
+// deferred).
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 1] void capture(RecordAttributes *, const char *, const t_ARGS&...);
+// [ 2] void render(bsl::streambuf *, bsl::string_view, bsl::format_args);
+//
+// MACROS
+// [ 3] BALL_DEFERRED_FMT
+// [ 3] BALL_DEFERRED_FMT_TRACE
+// [ 3] BALL_DEFERRED_FMT_DEBUG
+// [ 3] BALL_DEFERRED_FMT_INFO
+// [ 3] BALL_DEFERRED_FMT_WARN
+// [ 3] BALL_DEFERRED_FMT_ERROR
+// [ 3] BALL_DEFERRED_FMT_FATAL
+// ----------------------------------------------------------------------------
+// [ 4] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+using BloombergLP::bslma::TestAllocator;
+
+typedef BloombergLP::ball::RecordAttributes RecordAttributes;
+typedef BloombergLP::ball::DeferredFmtUtil  Util;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+/// Return the message of the specified `attributes`, rendering a copy of
+/// `attributes` first if its message is deferred.  Use the specified
+/// `allocator` to supply memory.
+bsl::string renderedMessage(const RecordAttributes&        attributes,
+                            BloombergLP::bslma::Allocator *allocator)
+{
+    RecordAttributes copy(attributes, allocator);
+    copy.renderMessage();
+    return bsl::string(copy.messageRef(), allocator);
+}
+
+                        // =======================
+                        // class DeferringObserver
+                        // =======================
+
+/// This class provides an observer that supports deferred messages, and that
+/// retains the last record published to it.
+class DeferringObserver : public BloombergLP::ball::Observer {
+
+    // DATA
+    bsl::shared_ptr<const BloombergLP::ball::Record> d_lastRecord;
+    int                                              d_numRecords;
+
+  public:
+    // CREATORS
+    DeferringObserver()
+    : d_numRecords(0)
+    {
+    }
+
+    // MANIPULATORS
+    using BloombergLP::ball::Observer::publish;
+
+    void publish(
+               const bsl::shared_ptr<const BloombergLP::ball::Record>& record,
+               const BloombergLP::ball::Context&) BSLS_KEYWORD_OVERRIDE
+    {
+        d_lastRecord = record;
+        ++d_numRecords;
+    }
+
+    void releaseRecords() BSLS_KEYWORD_OVERRIDE
+    {
+        d_lastRecord.reset();
+    }
+
+    // ACCESSORS
+    const BloombergLP::ball::Record& lastRecord() const
+    {
+        return *d_lastRecord;
+    }
+
+    int numRecords() const
+    {
+        return d_numRecords;
+    }
+
+    bool supportsDeferredMessages() const BSLS_KEYWORD_OVERRIDE
+    {
+        return true;
+    }
+};
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;
+
+    TestAllocator ta("test", veryVeryVeryVerbose);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file must
+        //    compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into driver, remove leading
+        //    comment characters, and replace `assert` with `ASSERT`.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nUSAGE EXAMPLE"
+                               << "\n=============" << bsl::endl;
+
+        using namespace BloombergLP;    // OK here
+
+        ball::LoggerManagerConfiguration lmConfig;
+        lmConfig.setDefaultThresholdLevelsIfValid(ball::Severity::e_TRACE);
+        ball::LoggerManagerScopedGuard lmGuard(lmConfig, &ta);
+
+        bsl::shared_ptr<u::DeferringObserver> observer =
+                               bsl::allocate_shared<u::DeferringObserver>(&ta);
+
+        ball::LoggerManager::singleton().registerObserver(observer, "default");
+
+        bslma::TestAllocator  scratchAllocator("scratch",
+                                               veryVeryVeryVerbose);
+        bslma::Allocator     *sa = &scratchAllocator;
+        (void)sa;
+
+///Example 1: Logging Off the Critical Path
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose a latency-sensitive thread logs each order it processes, and that
+// log records are published through a `ball::AsyncFileObserver`.
+//
+// First, we initialize the log category within the context of the function:
+// ```
+   BALL_LOG_SET_CATEGORY("EXAMPLE.ORDERS");
+// ```
+// Then, we log the order using `BALL_DEFERRED_FMT_INFO`.  The logging thread
+// only copies the address of the format string and the values of the
+// arguments into the log record; the message is formatted by the publication
+// thread of the async file observer:
+// ```
+   const int         orderId  = 1234;
+   const double      price    = 99.5;
+   const bsl::string symbol("IBM", &scratchAllocator);
+
+   BALL_DEFERRED_FMT_INFO("Order {}: {} at {:.2f}", orderId, symbol, price);
+// ```
+// The rendered message is "Order 1234: IBM at 99.50".
+
+        ASSERT(1 == observer->numRecords());
+
+        const RecordAttributes& attributes =
+                                          observer->lastRecord().fixedFields();
+
+        ASSERT(attributes.isMessageDeferred());
+        ASSERTV(u::renderedMessage(attributes, &ta),
+                "Order 1234: IBM at 99.50" ==
+                                        u::renderedMessage(attributes, &ta));
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING MACROS
+        //
+        // Concerns:
+        // 1. Each `BALL_DEFERRED_FMT_*` macro logs a record having the
+        //    severity of the macro, the category in scope, and the file name
+        //    and line number of the invocation, if and only if the severity
+        //    is enabled for the category.
+        //
+        // 2. `BALL_DEFERRED_FMT` captures a deferred message into the record
+        //    of the enclosing `BALL_LOG_*_BLOCK`.
+        //
+        // 3. If the registered observer does not support deferred messages,
+        //    the published record holds the rendered message.
+        //
+        // 4. If the registered observer supports deferred messages, the
+        //    published record holds a deferred message that renders to the
+        //    expected text.
+        //
+        // 5. The macros accept a format string formed by the concatenation
+        //    of string literals.  (That they reject a format string that is
+        //    not a literal can be verified only by a failure to compile.)
+        //
+        // Plan:
+        // 1. Register a `ball::TestObserver`, which does not support deferred
+        //    messages, and, for each macro, log a message in a category
+        //    having the severity enabled and in one having it disabled.
+        //    Verify the number and attributes of the published records.
+        //    (C-1..3)
+        //
+        // 2. Replace the observer with one that supports deferred messages,
+        //    log a message using each macro, and verify that the published
+        //    record holds a deferred message that renders as expected.  (C-4)
+        //
+        // 3. Supply the format string of every message as two concatenated
+        //    string literals.  (C-5)
+        //
+        // Testing:
+        //   BALL_DEFERRED_FMT
+        //   BALL_DEFERRED_FMT_TRACE
+        //   BALL_DEFERRED_FMT_DEBUG
+        //   BALL_DEFERRED_FMT_INFO
+        //   BALL_DEFERRED_FMT_WARN
+        //   BALL_DEFERRED_FMT_ERROR
+        //   BALL_DEFERRED_FMT_FATAL
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nTESTING MACROS"
+                               << "\n==============" << bsl::endl;
+
+        using namespace BloombergLP;    // OK here
+
+        const char  *MESSAGE = "message:1:2:3";
+        const char   SEP     = ':';
+        const int    ARGS[]  = { 1, 2, 3 };
+
+        ball::LoggerManagerConfiguration lmc;
+        ball::LoggerManagerScopedGuard   lmg(lmc, &ta);
+
+        ball::LoggerManager& manager = ball::LoggerManager::singleton();
+
+        bsl::shared_ptr<ball::TestObserver> observer =
+                     bsl::allocate_shared<ball::TestObserver>(&ta, &bsl::cout);
+
+        ASSERT(0 == manager.registerObserver(observer, "test"));
+
+        ball::Administration::addCategory("all",
+                                          ball::Severity::e_TRACE,
+                                          ball::Severity::e_TRACE,
+                                          0,
+                                          0);
+        ball::Administration::addCategory("none", 0, 0, 0, 0);
+
+        const int TRACE = ball::Severity::e_TRACE;
+        const int DEBUG = ball::Severity::e_DEBUG;
+        const int INFO  = ball::Severity::e_INFO;
+        const int WARN  = ball::Severity::e_WARN;
+        const int ERROR = ball::Severity::e_ERROR;
+        const int FATAL = ball::Severity::e_FATAL;
+
+#define DFMT_ARGS                                                             \
+        "message{0}{1}" "{0}{2}{0}{3}", SEP, ARGS[0], ARGS[1], ARGS[2]
+
+#define DFMT_TEST(MACRO, SEVERITY, BLOCK)                                     \
+        {                                                                     \
+            {                                                                 \
+                BALL_LOG_SET_CATEGORY("none");                                \
+                const int NUM = observer->numPublishedRecords();              \
+                MACRO(DFMT_ARGS);                                             \
+                ASSERT(NUM == observer->numPublishedRecords());               \
+            }                                                                 \
+            BALL_LOG_SET_CATEGORY("all");                                     \
+            const int NUM  = observer->numPublishedRecords();                 \
+            const int LINE = L_; MACRO(DFMT_ARGS);                            \
+            ASSERTV(#MACRO, NUM + 1 == observer->numPublishedRecords());      \
+            {                                                                 \
+                const RecordAttributes& ATTR =                                \
+                               observer->lastPublishedRecord().fixedFields(); \
+                ASSERTV(#MACRO, !ATTR.isMessageDeferred());                   \
+                ASSERTV(#MACRO, 0 == bsl::strcmp("all", ATTR.category()));    \
+                ASSERTV(#MACRO, SEVERITY == ATTR.severity());                 \
+                ASSERTV(#MACRO, 0 == bsl::strcmp(__FILE__, ATTR.fileName())); \
+                ASSERTV(#MACRO, LINE, ATTR.lineNumber(),                      \
+                        LINE == ATTR.lineNumber());                           \
+                ASSERTV(#MACRO, ATTR.message(),                               \
+                        0 == bsl::strcmp(MESSAGE, ATTR.message()));           \
+            }                                                                 \
+            BLOCK {                                                           \
+                BALL_DEFERRED_FMT(DFMT_ARGS);                                 \
+            }                                                                 \
+            ASSERTV(#MACRO, NUM + 2 == observer->numPublishedRecords());      \
+            {                                                                 \
+                const RecordAttributes& ATTR =                                \
+                               observer->lastPublishedRecord().fixedFields(); \
+                ASSERTV(#MACRO, SEVERITY == ATTR.severity());                 \
+                ASSERTV(#MACRO, ATTR.message(),                               \
+                        0 == bsl::strcmp(MESSAGE, ATTR.message()));           \
+            }                                                                 \
+        }
+
+        if (veryVerbose) cout << "\tObserver rendering on publication\n";
+
+        DFMT_TEST(BALL_DEFERRED_FMT_TRACE, TRACE, BALL_LOG_TRACE_BLOCK);
+        DFMT_TEST(BALL_DEFERRED_FMT_DEBUG, DEBUG, BALL_LOG_DEBUG_BLOCK);
+        DFMT_TEST(BALL_DEFERRED_FMT_INFO,  INFO,  BALL_LOG_INFO_BLOCK);
+        DFMT_TEST(BALL_DEFERRED_FMT_WARN,  WARN,  BALL_LOG_WARN_BLOCK);
+        DFMT_TEST(BALL_DEFERRED_FMT_ERROR, ERROR, BALL_LOG_ERROR_BLOCK);
+        DFMT_TEST(BALL_DEFERRED_FMT_FATAL, FATAL, BALL_LOG_FATAL_BLOCK);
+
+#undef DFMT_TEST
+
+        if (veryVerbose) cout << "\tObserver supporting deferred messages\n";
+        {
+            ASSERT(0 == manager.deregisterObserver("test"));
+
+            bsl::shared_ptr<u::DeferringObserver> deferring =
+                               bsl::allocate_shared<u::DeferringObserver>(&ta);
+
+            ASSERT(0 == manager.registerObserver(deferring, "deferring"));
+
+            BALL_LOG_SET_CATEGORY("all");
+
+#define DFMT_TEST(MACRO, SEVERITY)                                            \
+            {                                                                 \
+                const int NUM = deferring->numRecords();                      \
+                MACRO(DFMT_ARGS);                                             \
+                ASSERTV(#MACRO, NUM + 1 == deferring->numRecords());          \
+                const RecordAttributes& ATTR =                                \
+                                        deferring->lastRecord().fixedFields();\
+                ASSERTV(#MACRO, ATTR.isMessageDeferred());                    \
+                ASSERTV(#MACRO, SEVERITY == ATTR.severity());                 \
+                ASSERTV(#MACRO, MESSAGE == u::renderedMessage(ATTR, &ta));    \
+            }
+
+            DFMT_TEST(BALL_DEFERRED_FMT_TRACE, TRACE);
+            DFMT_TEST(BALL_DEFERRED_FMT_DEBUG, DEBUG);
+            DFMT_TEST(BALL_DEFERRED_FMT_INFO,  INFO);
+            DFMT_TEST(BALL_DEFERRED_FMT_WARN,  WARN);
+            DFMT_TEST(BALL_DEFERRED_FMT_ERROR, ERROR);
+            DFMT_TEST(BALL_DEFERRED_FMT_FATAL, FATAL);
+
+#undef DFMT_TEST
+
+            ASSERT(0 == manager.deregisterObserver("deferring"));
+        }
+
+#undef DFMT_ARGS
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING INVALID FORMAT STRINGS
+        //
+        // Concerns:
+        // 1. `render` writes the formatted message if the format string is
+        //    valid for the arguments.
+        //
+        // 2. `render` writes the format string followed by a description of
+        //    the error if the format string is not valid for the arguments.
+        //
+        // 3. A deferred message having an invalid format string renders as in
+        //    C-2.
+        //
+        // Plan:
+        // 1. Render messages having valid and invalid format strings, and
+        //    verify the output.  (C-1..3)
+        //
+        // Testing:
+        //   void render(bsl::streambuf *, bsl::string_view, bsl::format_args);
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nTESTING INVALID FORMAT STRINGS"
+                               << "\n==============================\n";
+
+        using namespace BloombergLP;    // OK here
+
+        const int VALUE = 7;
+
+        {
+            bdlsb::MemOutStreamBuf buffer(&ta);
+
+            Util::render(&buffer, "value {}", bsl::make_format_args(VALUE));
+
+            const bsl::string_view result(buffer.data(), buffer.length());
+            ASSERTV(result, "value 7" == result);
+        }
+        {
+            bdlsb::MemOutStreamBuf buffer(&ta);
+
+            Util::render(&buffer, "value {} {}", bsl::make_format_args(VALUE));
+
+            const bsl::string_view result(buffer.data(), buffer.length());
+            ASSERTV(result, 0 == result.find("value {} {} [invalid format: "));
+            ASSERTV(result, ']' == result.back());
+        }
+        {
+            RecordAttributes mX(&ta);
+
+            Util::capture(&mX, "value {} {1}", VALUE);
+
+            const bsl::string result = u::renderedMessage(mX, &ta);
+            ASSERTV(result,
+                    0 == result.find("value {} {1} [invalid format: "));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // TESTING `capture`
+        //
+        // Concerns:
+        // 1. After `capture`, the message of the record attributes is
+        //    deferred, and rendering it produces the message `bsl::format`
+        //    would produce for the same format string and arguments.
+        //
+        // 2. Fundamental, pointer, and string-like arguments (including a null
+        //    `const char *`, which renders as the empty string) are
+        //    supported, in any number and combination.
+        //
+        // 3. The characters of string-like arguments are captured, so that
+        //    modifying the argument after `capture` does not affect the
+        //    message.
+        //
+        // 4. `capture` replaces any previous message, deferred or not.
+        //
+        // 5. After `renderMessage`, the message is not deferred, and
+        //    `renderMessage` has no further effect.
+        //
+        // 6. Capturing and rendering a message allocates no memory from the
+        //    default allocator, if the message fits the pre-allocated
+        //    buffers.
+        //
+        // Plan:
+        // 1. Capture messages having arguments of various types, verify that
+        //    the message is deferred, and compare the rendered message to the
+        //    expected text.  (C-1..2, 5)
+        //
+        // 2. Modify a `bsl::string` argument after capture and verify the
+        //    rendered message.  (C-3)
+        //
+        // 3. Capture a message into record attributes already holding a
+        //    message, and verify the rendered message.  (C-4)
+        //
+        // 4. Install a test allocator as the default allocator and verify it
+        //    is not used.  (C-6)
+        //
+        // Testing:
+        //   void capture(RecordAttributes *, const char *, const t_ARGS&...);
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nTESTING `capture`"
+                               << "\n=================" << bsl::endl;
+
+        using namespace BloombergLP;    // OK here
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        RecordAttributes mX(&ta);  const RecordAttributes& X = mX;
+
+        ASSERT(!X.isMessageDeferred());
+
+        if (veryVerbose) cout << "\tFundamental types\n";
+        {
+            Util::capture(&mX, "no arguments");
+            ASSERT(X.isMessageDeferred());
+            ASSERT(0 != X.messageRenderer());
+
+            mX.renderMessage();
+            ASSERT(!X.isMessageDeferred());
+            ASSERT(0 == X.messageRenderer());
+            ASSERTV(X.message(), "no arguments" == X.messageRef());
+
+            mX.renderMessage();
+            ASSERTV(X.message(), "no arguments" == X.messageRef());
+
+            const char               C  = 'c';
+            const bool               B  = true;
+            const short              S  = -3;
+            const unsigned           U  = 4u;
+            const long long          LL = -5000000000LL;
+            const unsigned long long UL = 6000000000ULL;
+            const float              F  = 0.5f;
+            const double             D  = 1.25;
+
+            Util::capture(&mX, "{} {} {} {} {} {} {} {:.3f}",
+                          C, B, S, U, LL, UL, F, D);
+            ASSERT(X.isMessageDeferred());
+
+            mX.renderMessage();
+            ASSERTV(X.message(),
+                    "c true -3 4 -5000000000 6000000000 0.5 1.250" ==
+                                                              X.messageRef());
+
+            Util::capture(&mX, "{1}{0}{1}", 2, 'x');
+            mX.renderMessage();
+            ASSERTV(X.message(), "x2x" == X.messageRef());
+        }
+
+        if (veryVerbose) cout << "\tPointers\n";
+        {
+            int         object;
+            const void *P = &object;
+
+            bsl::string expected(&ta);
+            bsl::format_to(bsl::back_inserter(expected), "{}", P);
+
+            Util::capture(&mX, "{}", P);
+            mX.renderMessage();
+            ASSERTV(X.message(), expected, expected == X.messageRef());
+        }
+
+        if (veryVerbose) cout << "\tString-like types\n";
+        {
+            const char             *LITERAL = "literal";
+            const char             *NULLSTR = 0;
+            char                    ARRAY[] = "array";
+            bsl::string             STRING("string", &ta);
+            const bsl::string_view  VIEW("view-and-more", 4);
+
+            Util::capture(&mX,
+                          "{}|{}|{}|{}|{}|{:>5}|{}",
+                          LITERAL,
+                          NULLSTR,
+                          ARRAY,
+                          STRING,
+                          VIEW,
+                          "lit",
+                          bsl::string_view());
+            ASSERT(X.isMessageDeferred());
+
+            STRING = "modified";  // the characters have already been captured
+
+            mX.renderMessage();
+            ASSERTV(X.message(),
+                    "literal||array|string|view|  lit|" == X.messageRef());
+
+            const bsl::string LONG(1000, 'z', &ta);
+
+            bsl::string expected(LONG, &ta);
+            expected.append("-1");
+
+            Util::capture(&mX, "{}-{}", LONG, 1);
+            mX.renderMessage();
+            ASSERTV(X.messageRef().length(), expected == X.messageRef());
+        }
+
+        if (veryVerbose) cout << "\tReplacing a message\n";
+        {
+            mX.setMessage("old");
+            Util::capture(&mX, "new {}", 1);
+            Util::capture(&mX, "newer {}", 2);
+            ASSERT(X.isMessageDeferred());
+
+            mX.renderMessage();
+            ASSERTV(X.message(), "newer 2" == X.messageRef());
+        }
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      default: {
+        bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        bsl::cerr << "Error, non-zero test status = " << testStatus << "."
+                  << bsl::endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -27,6 +27,8 @@ BSLS_IDENT_RCSID(ball_fileobserver2_cpp,"$Id$ $CSID$")
 #include <bdlt_localtimeoffset.h>
 #include <bdlt_time.h>
 
+#include <bslma_default.h>
+
 #include <bslmt_lockguard.h>
 
 #include <bsls_assert.h>
@@ -52,6 +54,8 @@ BSLS_IDENT_RCSID(ball_fileobserver2_cpp,"$Id$ $CSID$")
 #ifdef BSLS_PLATFORM_OS_UNIX
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
 #endif
 
 #ifdef BSLS_PLATFORM_OS_WINDOWS
@@ -79,6 +83,19 @@ enum {
     k_ERROR_BUFFER_SIZE   = 1280  // 1024 (max path) + 256
 };
 
+enum {
+    k_DEFAULT_WRITE_BUFFER_SIZE = 256 * 1024,  // default total size of the
+                                               // write coalescing buffers
+
+    k_MIN_CHUNK_SIZE            =  64 * 1024,  // minimum size of a chunk
+                                               // (unless the capacity is
+                                               // smaller)
+
+    k_MAX_NUM_CHUNKS            =  64          // maximum number of chunks,
+                                               // and of `iovec` structures
+                                               // in one vectored write
+};
+
 #define LOG_PLATFORM_MESSAGE(severity, formatStr, ...) \
     {\
         char message[k_ERROR_BUFFER_SIZE]; \
@@ -98,6 +115,19 @@ static int getErrorCode(void)
 #endif
 }
 
+/// Commit the data written to the file having the specified `descriptor` to
+/// the storage device.  Return 0 on success, and a non-zero value otherwise.
+static int syncFile(bdls::FilesystemUtil::FileDescriptor descriptor)
+{
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+    return FlushFileBuffers(descriptor) ? 0 : -1;
+#elif defined(BSLS_PLATFORM_OS_LINUX)
+    return ::fdatasync(descriptor);
+#else
+    return ::fsync(descriptor);
+#endif
+}
+
 /// Return the specified `timestamp` in the `YYYYMMDD_hhmmss` format.
 static bsl::string getTimestampSuffix(const bdlt::Datetime& timestamp)
 {
@@ -351,11 +381,207 @@ static bdlt::Datetime computeNextRotationTime(
 
 }  // close unnamed namespace
 
+                      // -------------------------------
+                      // class FileObserver2_WriteBuffer
+                      // -------------------------------
+
+// PROTECTED MANIPULATORS
+FileObserver2_WriteBuffer::int_type
+FileObserver2_WriteBuffer::overflow(int_type c)
+{
+    if (traits_type::eq_int_type(c, traits_type::eof())) {
+        return traits_type::not_eof(c);                               // RETURN
+    }
+
+    if (0 == d_maxNumChunks) {
+        return traits_type::eof();                                    // RETURN
+    }
+
+    if (pbase()) {
+        // The current chunk is full.
+
+        ++d_numFull;
+        setp(0, 0);
+    }
+
+    if (d_maxNumChunks == d_numFull && 0 != write()) {
+        return traits_type::eof();                                    // RETURN
+    }
+
+    if (d_chunks.size() == d_numFull) {
+        d_chunks.push_back(static_cast<char *>(
+                                       d_allocator_p->allocate(d_chunkSize)));
+    }
+
+    char *chunk = d_chunks[d_numFull];
+    setp(chunk, chunk + d_chunkSize);
+
+    *pptr() = traits_type::to_char_type(c);
+    pbump(1);
+
+    return c;
+}
+
+// CREATORS
+FileObserver2_WriteBuffer::FileObserver2_WriteBuffer(
+                                              bslma::Allocator *basicAllocator)
+: d_chunks(basicAllocator)
+, d_chunkSize(0)
+, d_maxNumChunks(0)
+, d_numFull(0)
+, d_descriptor(bdls::FilesystemUtil::k_INVALID_FD)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    setp(0, 0);
+}
+
+FileObserver2_WriteBuffer::~FileObserver2_WriteBuffer()
+{
+    setCapacity(0);
+}
+
+// MANIPULATORS
+void FileObserver2_WriteBuffer::reset()
+{
+    d_numFull = 0;
+    setp(0, 0);
+}
+
+void FileObserver2_WriteBuffer::setCapacity(bsl::size_t capacity)
+{
+    reset();
+
+    for (bsl::size_t i = 0; i < d_chunks.size(); ++i) {
+        d_allocator_p->deallocate(d_chunks[i]);
+    }
+    d_chunks.clear();
+
+    if (0 == capacity) {
+        d_chunkSize    = 0;
+        d_maxNumChunks = 0;
+        return;                                                       // RETURN
+    }
+
+    // Use the fewest chunks of at least 'k_MIN_CHUNK_SIZE' bytes, rounding
+    // the chunk size up to a multiple of the minimum chunk size (itself a
+    // multiple of any common page size) when more than 'k_MAX_NUM_CHUNKS'
+    // such chunks would be needed.
+
+    if (capacity <= k_MIN_CHUNK_SIZE) {
+        d_chunkSize = capacity;
+    }
+    else {
+        const bsl::size_t minChunkSize = (capacity + k_MAX_NUM_CHUNKS - 1)
+                                       / k_MAX_NUM_CHUNKS;
+
+        d_chunkSize = (minChunkSize + k_MIN_CHUNK_SIZE - 1)
+                    / k_MIN_CHUNK_SIZE
+                    * k_MIN_CHUNK_SIZE;
+    }
+    d_maxNumChunks = (capacity + d_chunkSize - 1) / d_chunkSize;
+    d_chunks.reserve(d_maxNumChunks);
+}
+
+int FileObserver2_WriteBuffer::write()
+{
+    const bsl::size_t lastLength = pptr() - pbase();
+    const bsl::size_t numChunks  = d_numFull + (lastLength ? 1 : 0);
+
+    int rc = 0;
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+    struct iovec iov[k_MAX_NUM_CHUNKS];
+
+    for (bsl::size_t i = 0; i < numChunks; ++i) {
+        iov[i].iov_base = d_chunks[i];
+        iov[i].iov_len  = i < d_numFull ? d_chunkSize : lastLength;
+    }
+
+    struct iovec *next      = iov;
+    int           remaining = static_cast<int>(numChunks);
+
+    while (0 < remaining) {
+        ssize_t numWritten = ::writev(d_descriptor, next, remaining);
+
+        if (0 > numWritten) {
+            if (EINTR == errno) {
+                continue;                                           // CONTINUE
+            }
+            rc = -1;
+            break;
+        }
+
+        // Skip the fully written segments, and adjust a partially written
+        // one.
+
+        while (0 < remaining
+            && static_cast<bsl::size_t>(numWritten) >= next->iov_len) {
+            numWritten -= next->iov_len;
+            ++next;
+            --remaining;
+        }
+        if (0 < remaining) {
+            next->iov_base = static_cast<char *>(next->iov_base) + numWritten;
+            next->iov_len -= numWritten;
+        }
+    }
+#else
+    for (bsl::size_t i = 0; i < numChunks; ++i) {
+        const int length = static_cast<int>(i < d_numFull ? d_chunkSize
+                                                           : lastLength);
+
+        if (length != bdls::FilesystemUtil::write(d_descriptor,
+                                                  d_chunks[i],
+                                                  length)) {
+            rc = -1;
+            break;
+        }
+    }
+#endif
+
+    reset();
+    return rc;
+}
+
                           // -------------------
                           // class FileObserver2
                           // -------------------
 
 // PRIVATE MANIPULATORS
+int FileObserver2::flushImp(const bdlt::Datetime& nowUtc)
+{
+    if (0 == d_writeBuffer.length()) {
+        return 0;                                                     // RETURN
+    }
+
+    if (!d_logStreamBuf.isOpened()) {
+        d_writeBuffer.reset();
+        return 0;                                                     // RETURN
+    }
+
+    d_writeBuffer.setFileDescriptor(d_logStreamBuf.fileDescriptor());
+
+    if (0 != d_writeBuffer.write()) {
+        handleWriteError();
+        return -1;                                                    // RETURN
+    }
+
+    syncIfNecessary(nowUtc);
+    return 0;
+}
+
+void FileObserver2::handleWriteError()
+{
+    LOG_PLATFORM_MESSAGE(bsls::LogSeverity::e_ERROR,
+                         "Error on file stream for %s: %s.",
+                         d_logFileName.c_str(),
+                         bsl::strerror(getErrorCode()));
+
+    d_writeBuffer.reset();
+    d_writeStream.clear();
+    d_logStreamBuf.clear();
+}
+
 int FileObserver2::rotateFile(bsl::string *rotatedLogFileName)
 {
     BSLS_ASSERT(rotatedLogFileName);
@@ -368,6 +594,12 @@ int FileObserver2::rotateFile(bsl::string *rotatedLogFileName)
 
     int returnStatus = k_ROTATE_SUCCESS;
 
+    // Write the records accumulated for the current log file.
+
+    if (0 != flushImp(bdlt::CurrentTime::utc())) {
+        return -k_ROTATE_NEW_LOG_ERROR;                               // RETURN
+    }
+
     // Close current log file.
     if (0 != d_logStreamBuf.clear()) {
         LOG_PLATFORM_MESSAGE(bsls::LogSeverity::e_WARN,
@@ -471,8 +703,13 @@ int FileObserver2::rotateIfNecessary(bsl::string           *rotatedLogFileName,
         // 'tellp' returns -1 on failure.  Rotate the log file if either
         // 'tellp' fails, or the rotation size is exceeded.
 
-        if (static_cast<bsls::Types::Uint64>(d_logOutStream.tellp()) >
-            static_cast<bsls::Types::Uint64>(d_rotationSize) * 1024) {
+        // Records accumulated by write coalescing count toward the size.
+
+        const bsls::Types::Int64 offset = d_logOutStream.tellp();
+
+        if (0 > offset
+         || static_cast<bsls::Types::Uint64>(offset) + d_writeBuffer.length()
+                > static_cast<bsls::Types::Uint64>(d_rotationSize) * 1024) {
 
             return rotateFile(rotatedLogFileName);                    // RETURN
         }
@@ -486,6 +723,23 @@ int FileObserver2::rotateIfNecessary(bsl::string           *rotatedLogFileName,
     return 1;
 }
 
+void FileObserver2::syncIfNecessary(const bdlt::Datetime& nowUtc)
+{
+    if (0 == d_syncInterval.totalMilliseconds()
+     || !d_logStreamBuf.isOpened()
+     || nowUtc - d_lastSyncTimeUtc < d_syncInterval) {
+        return;                                                       // RETURN
+    }
+
+    if (0 != syncFile(d_logStreamBuf.fileDescriptor())) {
+        LOG_PLATFORM_MESSAGE(bsls::LogSeverity::e_WARN,
+                             "Cannot sync log file %s: %s.",
+                             d_logFileName.c_str(),
+                             bsl::strerror(getErrorCode()));
+    }
+    d_lastSyncTimeUtc = nowUtc;
+}
+
 // PRIVATE ACCESSORS
 template <class STRING>
 bool FileObserver2::isFileLoggingEnabledImpl(STRING *result) const
@@ -522,11 +776,19 @@ FileObserver2::FileObserver2(bslma::Allocator *basicAllocator)
                  bsl::allocator<FileObserver2::OnFileRotationCallback>(
                                                                basicAllocator))
 , d_rotationCbMutex()
+, d_writeBuffer(basicAllocator)
+, d_writeStream(&d_writeBuffer)
+, d_flushSize(0)
+, d_flushInterval(0)
+, d_flushSeverityThreshold(Severity::e_OFF)
+, d_syncInterval(0)
 {
 }
 
 FileObserver2::~FileObserver2()
 {
+    flushImp(bdlt::CurrentTime::utc());
+
     if (d_logStreamBuf.isOpened()) {
         d_logStreamBuf.clear();
     }
@@ -537,6 +799,8 @@ void FileObserver2::disableFileLogging()
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
 
+    flushImp(bdlt::CurrentTime::utc());
+
     if (d_logStreamBuf.isOpened()) {
         d_logStreamBuf.clear();
     }
@@ -567,6 +831,14 @@ void FileObserver2::disableTimeIntervalRotation()
     d_rotationInterval.setTotalSeconds(0);
 }
 
+void FileObserver2::disableWriteCoalescing()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    flushImp(bdlt::CurrentTime::utc());
+    d_writeBuffer.setCapacity(0);
+}
+
 int FileObserver2::enableFileLogging(const char *logFilenamePattern)
 {
     BSLS_ASSERT(logFilenamePattern);
@@ -646,6 +918,53 @@ void FileObserver2::enablePublishInLocalTime()
                                            RecordFormatterTimezone::e_LOCAL);
 }
 
+void FileObserver2::enableWriteCoalescing()
+{
+    enableWriteCoalescing(k_DEFAULT_WRITE_BUFFER_SIZE);
+}
+
+void FileObserver2::enableWriteCoalescing(int bufferSize)
+{
+    BSLS_ASSERT(0 < bufferSize);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    flushImp(bdlt::CurrentTime::utc());
+    d_writeBuffer.setCapacity(bufferSize);
+}
+
+int FileObserver2::flush()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return flushImp(bdlt::CurrentTime::utc());
+}
+
+void FileObserver2::flushOnSeverity(Severity::Level threshold)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_flushSeverityThreshold = threshold;
+}
+
+void FileObserver2::flushOnSize(int numBytes)
+{
+    BSLS_ASSERT(0 <= numBytes);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_flushSize = numBytes;
+}
+
+void FileObserver2::flushOnTimeInterval(const bdlt::DatetimeInterval& interval)
+{
+    BSLS_ASSERT(0 <= interval.totalMilliseconds());
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_flushInterval = interval;
+}
+
 void FileObserver2::publish(const bsl::shared_ptr<const Record>& record,
                             const Context&)
 {
@@ -657,7 +976,34 @@ void FileObserver2::publish(const bsl::shared_ptr<const Record>& record,
         rotationStatus = rotateIfNecessary(&rotatedFileName,
                                            record->fixedFields().timestamp());
 
-        if (d_logStreamBuf.isOpened()) {
+        const bdlt::Datetime& timestamp = record->fixedFields().timestamp();
+
+        if (d_logStreamBuf.isOpened() && 0 < d_writeBuffer.capacity()) {
+            // Write coalescing: the record is written when a flush occurs
+            // (or when the buffer is full).
+
+            if (0 == d_writeBuffer.length()) {
+                d_oldestPendingTimestamp = timestamp;
+            }
+            d_writeBuffer.setFileDescriptor(d_logStreamBuf.fileDescriptor());
+
+            d_observerFormatterImp.formatLogRecord(d_writeStream, record);
+
+            if (!d_writeStream) {
+                handleWriteError();
+            }
+            else if (record->fixedFields().severity()
+                                                  <= d_flushSeverityThreshold
+                  || (0 < d_flushSize
+                   && static_cast<bsl::size_t>(d_flushSize)
+                                                   <= d_writeBuffer.length())
+                  || (0 != d_flushInterval.totalMilliseconds()
+                   && d_flushInterval
+                                <= timestamp - d_oldestPendingTimestamp)) {
+                flushImp(timestamp);
+            }
+        }
+        else if (d_logStreamBuf.isOpened()) {
             d_observerFormatterImp.formatLogRecord(d_logOutStream, record);
 
             if (!d_logOutStream) {
@@ -668,6 +1014,9 @@ void FileObserver2::publish(const bsl::shared_ptr<const Record>& record,
 
                 d_logStreamBuf.clear();
             }
+            else {
+                syncIfNecessary(timestamp);
+            }
         }
     }
 
@@ -751,6 +1100,15 @@ int FileObserver2::setFormat(const bsl::string_view& format)
     return d_observerFormatterImp.setFormat(format);
 }
 
+void FileObserver2::syncOnTimeInterval(const bdlt::DatetimeInterval& interval)
+{
+    BSLS_ASSERT(0 <= interval.totalMilliseconds());
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_syncInterval = interval;
+}
+
 void FileObserver2::setOnFileRotationCallback(
                               const OnFileRotationCallback& onRotationCallback)
 {
@@ -759,6 +1117,27 @@ void FileObserver2::setOnFileRotationCallback(
 }
 
 // ACCESSORS
+bdlt::DatetimeInterval FileObserver2::flushInterval() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_flushInterval;
+}
+
+Severity::Level FileObserver2::flushSeverityThreshold() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_flushSeverityThreshold;
+}
+
+int FileObserver2::flushSize() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_flushSize;
+}
+
 bool FileObserver2::isFileLoggingEnabled() const
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
@@ -798,6 +1177,13 @@ bool FileObserver2::isSuppressUniqueFileNameOnRotation() const
     return d_suppressUniqueFileName;
 }
 
+bool FileObserver2::isWriteCoalescingEnabled() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return 0 < d_writeBuffer.capacity();
+}
+
 const bsl::string& FileObserver2::getFormat() const
 {
     return d_observerFormatterImp.getFormat();
@@ -829,6 +1215,20 @@ int FileObserver2::rotationSize() const
     return d_rotationSize;
 }
 
+bdlt::DatetimeInterval FileObserver2::syncInterval() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_syncInterval;
+}
+
+int FileObserver2::writeBufferSize() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return static_cast<int>(d_writeBuffer.capacity());
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
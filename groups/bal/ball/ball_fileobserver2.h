@@ -27,8 +27,14 @@ BSLS_IDENT("$Id: $")
 //                        |              disableTimeIntervalRotation
 //                        |              disableSizeRotation
 //                        |              disablePublishInLocalTime
+//                        |              disableWriteCoalescing
 //                        |              enableFileLogging
 //                        |              enablePublishInLocalTime
+//                        |              enableWriteCoalescing
+//                        |              flush
+//                        |              flushOnSeverity
+//                        |              flushOnSize
+//                        |              flushOnTimeInterval
 //                        |              forceRotation
 //                        |              rotateOnSize
 //                        |              rotateOnTimeInterval
@@ -36,12 +42,19 @@ BSLS_IDENT("$Id: $")
 //                        |              setLogFileFunctor
 //                        |              setOnFileRotationCallback
 //                        |              suppressUniqueFileNameOnRotation
+//                        |              syncOnTimeInterval
+//                        |              flushInterval
+//                        |              flushSeverityThreshold
+//                        |              flushSize
 //                        |              getFormat
 //                        |              isFileLoggingEnabled
 //                        |              isPublishInLocalTimeEnabled
 //                        |              isSuppressUniqueFileNameOnRotation
+//                        |              isWriteCoalescingEnabled
 //                        |              rotationLifetime
 //                        |              rotationSize
+//                        |              syncInterval
+//                        |              writeBufferSize
 //                        V
 //                 ,--------------.
 //                ( ball::Observer )
@@ -90,6 +103,20 @@ BSLS_IDENT("$Id: $")
 // |             | rotationLifetime                   |
 // |             | isSuppressUniqueFileNameOnRotation |
 // +-------------+------------------------------------+
+// | Write       | enableWriteCoalescing              |
+// | Coalescing  | disableWriteCoalescing             |
+// | and         | flush                              |
+// | Flushing    | flushOnSeverity                    |
+// |             | flushOnSize                        |
+// |             | flushOnTimeInterval                |
+// |             | syncOnTimeInterval                 |
+// |             | isWriteCoalescingEnabled           |
+// |             | writeBufferSize                    |
+// |             | flushSeverityThreshold             |
+// |             | flushSize                          |
+// |             | flushInterval                      |
+// |             | syncInterval                       |
+// +-------------+------------------------------------+
 // ```
 // In general, a `ball::FileObserver2` object can be dynamically configured
 // throughout its lifetime (in particular, before or after being registered
@@ -302,6 +329,44 @@ BSLS_IDENT("$Id: $")
 // the period is one day), then a unique name on each rotation is produced with
 // the (local) time at which file rotation occurred embedded in the filename.
 //
+///Write Coalescing and Flushing
+///------------------------------
+// By default, each published record is written to the log file (with one
+// `write` system call) before `publish` returns.  Calling
+// `enableWriteCoalescing` makes a file observer instead accumulate formatted
+// records in memory buffers of a configurable total size, and write all of the
+// accumulated records to the log file with a single vectored write (`writev`
+// where available) when a *flush* occurs.  A flush occurs when:
+//
+// * the buffers are full,
+// * a flush rule applies (see below),
+// * `flush` is called, or
+// * the log file is rotated, file logging is disabled, write coalescing is
+//   disabled, or the file observer is destroyed.
+//
+// Three flush rules may be established, each disabled by default:
+//
+// * `flushOnSize`: flush once the accumulated records occupy at least the
+//   specified number of bytes.
+// * `flushOnTimeInterval`: flush once the timestamp of a published record is
+//   at least the specified interval later than that of the oldest record
+//   not yet written.
+// * `flushOnSeverity`: flush after publishing a record whose severity is at
+//   least as severe as the specified threshold (so that, for example, an
+//   `ERROR` record and the records preceding it reach the file before
+//   `publish` returns).
+//
+// Note that the rules are evaluated only when a record is published: records
+// held in the buffers when logging becomes idle are written by the next flush,
+// which a client may force by calling `flush` (e.g., periodically, or before
+// exiting).  Also note that records are written without any newline
+// translation (i.e., in binary mode) when write coalescing is enabled.
+//
+// Independently of write coalescing, `syncOnTimeInterval` configures a file
+// observer to commit the written records to the storage device
+// (`fdatasync`) after a write, provided at least the specified interval has
+// elapsed since the previous such commit.
+//
 ///Thread Safety
 ///-------------
 // All methods of `ball::FileObserver2` are thread-safe, and can be called
@@ -372,6 +437,7 @@ BSLS_IDENT("$Id: $")
 #include <ball_severity.h>
 
 #include <bdls_fdstreambuf.h>
+#include <bdls_filesystemutil.h>
 
 #include <bdlt_datetime.h>
 #include <bdlt_datetimeinterval.h>
@@ -388,11 +454,14 @@ BSLS_IDENT("$Id: $")
 #include <bsls_keyword.h>
 #include <bsls_libraryfeatures.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_fstream.h>
 #include <bsl_functional.h>
 #include <bsl_iosfwd.h>
 #include <bsl_memory.h>
+#include <bsl_streambuf.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #include <string>           // `std::string`, `std::pmr::string`
 
@@ -402,6 +471,91 @@ namespace ball {
 class Context;
 class Record;
 
+                      // ===============================
+                      // class FileObserver2_WriteBuffer
+                      // ===============================
+
+/// PRIVATE CLASS.  For use by the `ball::FileObserver2` implementation only.
+/// This class provides a stream buffer that accumulates the characters
+/// written to it in a sequence of fixed-size memory chunks, and writes the
+/// accumulated characters to a file descriptor with a single vectored write.
+/// Note that `pubsync` does not write to the file descriptor, so that a
+/// record formatter flushing its stream after each record does not cause a
+/// write.
+class FileObserver2_WriteBuffer : public bsl::streambuf {
+
+    // PRIVATE TYPES
+    typedef bdls::FilesystemUtil::FileDescriptor FileDescriptor;
+
+    // DATA
+    bsl::vector<char *>  d_chunks;        // allocated chunks (owned)
+
+    bsl::size_t          d_chunkSize;     // size of each chunk
+
+    bsl::size_t          d_maxNumChunks;  // number of chunks at capacity
+
+    bsl::size_t          d_numFull;       // number of full chunks preceding
+                                          // the chunk being filled
+
+    FileDescriptor       d_descriptor;    // file to which the characters are
+                                          // written
+
+    bslma::Allocator    *d_allocator_p;   // memory allocator (held, not
+                                          // owned)
+
+    // NOT IMPLEMENTED
+    FileObserver2_WriteBuffer(const FileObserver2_WriteBuffer&);
+    FileObserver2_WriteBuffer& operator=(const FileObserver2_WriteBuffer&);
+
+  protected:
+    // PROTECTED MANIPULATORS
+
+    /// Start filling the next chunk with the specified `c`, first writing
+    /// the accumulated characters to the file descriptor if all chunks are
+    /// full.  Return `c` on success, and `traits_type::eof()` if the write
+    /// fails or the capacity of this buffer is 0.
+    int_type overflow(int_type c = traits_type::eof()) BSLS_KEYWORD_OVERRIDE;
+
+  public:
+    // CREATORS
+
+    /// Create a write buffer having a capacity of 0.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.
+    explicit FileObserver2_WriteBuffer(bslma::Allocator *basicAllocator = 0);
+
+    /// Destroy this object, discarding the characters it holds.
+    ~FileObserver2_WriteBuffer() BSLS_KEYWORD_OVERRIDE;
+
+    // MANIPULATORS
+
+    /// Discard the characters held by this buffer.
+    void reset();
+
+    /// Discard the characters held by this buffer, release its memory, and
+    /// set its capacity to at least the specified `capacity` (0 meaning
+    /// that characters are not accumulated).  Memory is allocated as it is
+    /// needed.
+    void setCapacity(bsl::size_t capacity);
+
+    /// Set the file descriptor to which accumulated characters are written
+    /// to the specified `descriptor`.
+    void setFileDescriptor(FileDescriptor descriptor);
+
+    /// Write the characters held by this buffer to the file descriptor, and
+    /// discard them.  Return 0 on success, and a non-zero value otherwise
+    /// (in which case the characters are discarded as well).
+    int write();
+
+    // ACCESSORS
+
+    /// Return the capacity of this buffer.
+    bsl::size_t capacity() const;
+
+    /// Return the number of characters held by this buffer.
+    bsl::size_t length() const;
+};
+
                           // ===================
                           // class FileObserver2
                           // ===================
@@ -495,6 +649,38 @@ class FileObserver2 : public Observer {
                                                        // called with 'd_mutex'
                                                        // unlocked
 
+    FileObserver2_WriteBuffer
+                           d_writeBuffer;              // accumulates records
+                                                       // when write coalescing
+                                                       // is enabled (capacity
+                                                       // 0 otherwise)
+
+    bsl::ostream           d_writeStream;              // output stream for
+                                                       // write coalescing
+                                                       // (refers to
+                                                       // `d_writeBuffer`)
+
+    bdlt::Datetime         d_oldestPendingTimestamp;   // timestamp of the
+                                                       // oldest record in
+                                                       // `d_writeBuffer`
+
+    int                    d_flushSize;                // accumulated size (in
+                                                       // bytes) triggering a
+                                                       // flush, or 0
+
+    bdlt::DatetimeInterval d_flushInterval;            // record age triggering
+                                                       // a flush, or 0
+
+    Severity::Level        d_flushSeverityThreshold;   // records at least this
+                                                       // severe trigger a
+                                                       // flush, unless `e_OFF`
+
+    bdlt::DatetimeInterval d_syncInterval;             // minimum interval
+                                                       // between syncs, or 0
+
+    bdlt::Datetime         d_lastSyncTimeUtc;          // time of the last
+                                                       // sync
+
   private:
     // NOT IMPLEMENTED
     FileObserver2(const FileObserver2&);
@@ -503,6 +689,18 @@ class FileObserver2 : public Observer {
   private:
     // PRIVATE MANIPULATORS
 
+    /// Write the records accumulated by write coalescing, if any, to the log
+    /// file, syncing the file if a sync is due at the specified `nowUtc`.
+    /// Return 0 on success, and a non-zero value otherwise, in which case
+    /// file logging is disabled.  The behavior is undefined unless the
+    /// caller acquired the lock for this object.
+    int flushImp(const bdlt::Datetime& nowUtc);
+
+    /// Handle an error writing to the log file by reporting it and disabling
+    /// file logging.  The behavior is undefined unless the caller acquired
+    /// the lock for this object.
+    void handleWriteError();
+
     /// Perform a log file rotation by closing the current log file of this
     /// file observer, renaming the closed log file if necessary, and
     /// opening a new log file.  Load, into the specified
@@ -526,6 +724,12 @@ class FileObserver2 : public Observer {
     int rotateIfNecessary(bsl::string           *rotatedLogFileName,
                           const bdlt::Datetime&  currentLogTimeUtc);
 
+    /// Commit the log file to the storage device if a sync interval is in
+    /// effect and at least that interval has elapsed between the last sync
+    /// and the specified `nowUtc`.  The behavior is undefined unless the
+    /// caller acquired the lock for this object.
+    void syncIfNecessary(const bdlt::Datetime& nowUtc);
+
     // PRIVATE ACCESSORS
 
     /// Return `true` if file logging is enabled for this file observer, and
@@ -587,6 +791,14 @@ class FileObserver2 : public Observer {
     /// rotation-on-time-interval is not enabled.
     void disableTimeIntervalRotation();
 
+    /// Disable write coalescing for this file observer, first writing any
+    /// accumulated records to the log file, and release the memory used to
+    /// accumulate records.  Henceforth, each published record is written to
+    /// the log file before `publish` returns.  This method has no effect if
+    /// write coalescing is not enabled.  See {Write Coalescing and
+    /// Flushing}.
+    void disableWriteCoalescing();
+
     /// Enable logging of all records published to this file observer to a
     /// file whose name is derived from the specified `logFilenamePattern`.
     /// Return 0 on success, a positive value if file logging is already
@@ -634,6 +846,41 @@ class FileObserver2 : public Observer {
     /// affects log filenames (see {Log Filename Patterns}).
     void enablePublishInLocalTime();
 
+    /// Enable write coalescing for this file observer, accumulating
+    /// published records in memory buffers having a total size of the
+    /// optionally specified `bufferSize` bytes (256 kilobytes if not
+    /// specified), and writing them to the log file when a flush occurs.
+    /// If write coalescing is already enabled, first write any accumulated
+    /// records to the log file.  The behavior is undefined unless
+    /// `0 < bufferSize`.  See {Write Coalescing and Flushing}.
+    void enableWriteCoalescing();
+    void enableWriteCoalescing(int bufferSize);
+
+    /// Write any records accumulated by write coalescing to the log file.
+    /// Return 0 on success (including if there are no such records), and a
+    /// non-zero value otherwise, in which case file logging is disabled.
+    int flush();
+
+    /// Set this file observer to flush after publishing a record whose
+    /// severity is at least as severe as the specified `threshold` when
+    /// write coalescing is enabled; `Severity::e_OFF` disables this rule.
+    /// This rule replaces any flush-on-severity rule currently in effect.
+    void flushOnSeverity(Severity::Level threshold);
+
+    /// Set this file observer to flush once the records accumulated by write
+    /// coalescing occupy at least the specified `numBytes`; 0 disables this
+    /// rule.  This rule replaces any flush-on-size rule currently in effect.
+    /// The behavior is undefined unless `0 <= numBytes`.
+    void flushOnSize(int numBytes);
+
+    /// Set this file observer to flush once the timestamp of a published
+    /// record is at least the specified `interval` later than the timestamp
+    /// of the oldest record accumulated by write coalescing; a 0 interval
+    /// disables this rule.  This rule replaces any flush-on-time-interval
+    /// rule currently in effect.  The behavior is undefined unless
+    /// `0 <= interval.totalMilliseconds()`.
+    void flushOnTimeInterval(const bdlt::DatetimeInterval& interval);
+
     /// Process the specified log `record` having the specified publishing
     /// `context` by writing `record` and `context` to the current log file
     /// if file logging is enabled for this file observer.  The method has
@@ -738,8 +985,27 @@ class FileObserver2 : public Observer {
     /// otherwise.  See {Rotated File Naming} for details.
     void suppressUniqueFileNameOnRotation(bool suppress);
 
+    /// Set this file observer to commit the log file to the storage device
+    /// (e.g., using `fdatasync`) after writing records to it, provided that
+    /// at least the specified `interval` has elapsed since the previous
+    /// such commit; a 0 interval disables syncing.  The behavior is
+    /// undefined unless `0 <= interval.totalMilliseconds()`.
+    void syncOnTimeInterval(const bdlt::DatetimeInterval& interval);
+
     // ACCESSORS
 
+    /// Return the record age triggering a flush if a flush-on-time-interval
+    /// rule is in effect, and a 0 time interval otherwise.
+    bdlt::DatetimeInterval flushInterval() const;
+
+    /// Return the severity threshold of the flush-on-severity rule, or
+    /// `Severity::e_OFF` if no such rule is in effect.
+    Severity::Level flushSeverityThreshold() const;
+
+    /// Return the accumulated size (in bytes) triggering a flush if a
+    /// flush-on-size rule is in effect, and 0 otherwise.
+    int flushSize() const;
+
     /// Return `true` if file logging is enabled for this file observer, and
     /// `false` otherwise.  Load the optionally specified `result` with the
     /// name of the current log file if file logging is enabled, and leave
@@ -769,6 +1035,10 @@ class FileObserver2 : public Observer {
     /// suppressed, and false otherwise.
     bool isSuppressUniqueFileNameOnRotation() const;
 
+    /// Return `true` if write coalescing is enabled for this file observer,
+    /// and `false` otherwise.
+    bool isWriteCoalescingEnabled() const;
+
     /// Return the format config of the last successful `setFormat` call.
     const bsl::string& getFormat() const;
 
@@ -782,6 +1052,15 @@ class FileObserver2 : public Observer {
     /// effect, and 0 otherwise.
     int rotationSize() const;
 
+    /// Return the minimum interval between commits of the log file to the
+    /// storage device if syncing is enabled, and a 0 time interval
+    /// otherwise.
+    bdlt::DatetimeInterval syncInterval() const;
+
+    /// Return the total size (in bytes) of the buffers accumulating records
+    /// if write coalescing is enabled, and 0 otherwise.
+    int writeBufferSize() const;
+
     /// Return the difference between the local time and UTC time in effect
     /// when this file observer was constructed.  Note that this value
     /// remains unchanged during the lifetime of this object and therefore
@@ -797,6 +1076,30 @@ class FileObserver2 : public Observer {
 //                              INLINE DEFINITIONS
 // ============================================================================
 
+                      // -------------------------------
+                      // class FileObserver2_WriteBuffer
+                      // -------------------------------
+
+// MANIPULATORS
+inline
+void FileObserver2_WriteBuffer::setFileDescriptor(FileDescriptor descriptor)
+{
+    d_descriptor = descriptor;
+}
+
+// ACCESSORS
+inline
+bsl::size_t FileObserver2_WriteBuffer::capacity() const
+{
+    return d_chunkSize * d_maxNumChunks;
+}
+
+inline
+bsl::size_t FileObserver2_WriteBuffer::length() const
+{
+    return d_numFull * d_chunkSize + (pptr() - pbase());
+}
+
                           // -------------------
                           // class FileObserver2
                           // -------------------
@@ -40,6 +40,7 @@
 #include <bslstl_stringref.h>
 
 #include <bsls_assert.h>
+#include <bsls_asserttest.h>
 #include <bsls_platform.h>
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
@@ -97,6 +98,14 @@ using bsl::flush;
 // [ 1] void disablePublishInLocalTime();
 // [ 2] void disableSizeRotation();
 // [ 8] void disableTimeIntervalRotation();
+// [14] void disableWriteCoalescing();
+// [14] void enableWriteCoalescing();
+// [14] void enableWriteCoalescing(int bufferSize);
+// [14] int flush();
+// [14] void flushOnSeverity(Severity::Level threshold);
+// [14] void flushOnSize(int numBytes);
+// [14] void flushOnTimeInterval(const DatetimeInterval& interval);
+// [14] void syncOnTimeInterval(const DatetimeInterval& interval);
 // [ 1] int  enableFileLogging(const char *fileName);
 // [ 1] int  enableFileLogging(const char *fileName, bool timestampFlag);
 // [ 1] void enablePublishInLocalTime();
@@ -112,6 +121,9 @@ using bsl::flush;
 // [ 5] void setOnFileRotationCallback(const OnFileRotationCallback&);
 //
 // ACCESSORS
+// [14] DatetimeInterval flushInterval() const;
+// [14] Severity::Level flushSeverityThreshold() const;
+// [14] int flushSize() const;
 // [ 1] const bsl::string& getFormat() const;
 // [ 1] bool isFileLoggingEnabled() const;
 // [ 1] bool isFileLoggingEnabled(bsl::string *result) const;
@@ -120,8 +132,11 @@ using bsl::flush;
 // [ 1] bool isPublishInLocalTimeEnabled() const;
 // [ 2] DatetimeInterval rotationLifetime() const;
 // [ 2] int rotationSize() const;
+// [14] bool isWriteCoalescingEnabled() const;
+// [14] DatetimeInterval syncInterval() const;
+// [14] int writeBufferSize() const;
 // ----------------------------------------------------------------------------
-// [13] USAGE EXAMPLE
+// [15] USAGE EXAMPLE
 // [12] CONCERN: CURRENT LOCAL-TIME OFFSET IN TIMESTAMP
 // [11] CONCERN: TIME CALLBACKS ARE CALLED
 // [10] CONCERN: ROTATION CAN BE ENABLED AFTER FILE LOGGING
@@ -192,6 +207,13 @@ void aSsErT2(bool condition, const char *message, int line)
 #define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
 #define L_           BSLIM_TESTUTIL_L_  // current Line number
 
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
 // ============================================================================
 //                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
 // ----------------------------------------------------------------------------
@@ -488,6 +510,31 @@ void publishRecord(Obj *observer, const char *message)
     observer->publish(record, context);
 }
 
+/// Publish a record having the specified `message`, `severity`, and
+/// `timestamp` to the specified `observer` object.
+void publishRecord(Obj                   *observer,
+                   const char            *message,
+                   ball::Severity::Level  severity,
+                   const bdlt::Datetime&  timestamp)
+{
+    ball::RecordAttributes attr(timestamp,
+                                1,
+                                2,
+                                "FILENAME",
+                                3,
+                                "CATEGORY",
+                                severity,
+                                message);
+
+    bsl::shared_ptr<ball::Record> record;
+    record.createInplace(bslma::Default::allocator(),
+                         attr,
+                         ball::UserFields());
+    ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+    observer->publish(record, context);
+}
+
 
 /// Return the number of lines in the file with the specified `fileName`.
 int getNumLines(const char *fileName)
@@ -705,7 +752,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -729,7 +776,7 @@ int main(int argc, char *argv[])
         // the test.
         bdls::TempDirectoryGuard tempDirGuard("ball_fileobserver2_");
         bsl::string              fileName(tempDirGuard.getTempDirName());
-        bdls::PathUtil::appendRaw(&fileName, "test14.log");
+        bdls::PathUtil::appendRaw(&fileName, "test15.log");
 
 ///Example: Basic Usage
 /// - - - - - - - - - -
@@ -780,6 +827,440 @@ int main(int argc, char *argv[])
         ASSERT(0 == rc);
 // ```
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING WRITE COALESCING AND FLUSH POLICIES
+        //
+        // Concerns:
+        // 1. Write coalescing is disabled by default, and, when disabled,
+        //    every published record is written to the file immediately.
+        //
+        // 2. When write coalescing is enabled, published records are not
+        //    written until `flush` is called or a flush rule triggers.
+        //
+        // 3. Each of the size, severity, and time-interval flush rules
+        //    triggers a flush, and a value of 0 (or `e_OFF`) disables it.
+        //
+        // 4. Records are written in publication order when the buffer fills
+        //    up, including when it is made of several chunks.
+        //
+        // 5. Pending records are written before the file is closed by
+        //    `disableFileLogging`, by a rotation, by `disableWriteCoalescing`,
+        //    and by the destructor.
+        //
+        // 6. Pending records count toward the size rotation rule.
+        //
+        // 7. The accessors return the configured values.
+        //
+        // 8. All memory is supplied by the object allocator and released.
+        //
+        // Plan:
+        // 1. Publish records with coalescing disabled and verify the file
+        //    grows with each record.  (C-1)
+        //
+        // 2. Enable coalescing, publish records, and verify the file size is
+        //    unchanged until `flush` is called.  (C-2)
+        //
+        // 3. Configure each flush rule in turn, and publish records that do
+        //    and do not satisfy it.  (C-3)
+        //
+        // 4. Publish many numbered records through buffers of several sizes
+        //    and verify the file contains every record in order.  (C-4)
+        //
+        // 5. Leave records pending and exercise each closing operation.
+        //    (C-5..6)
+        //
+        // 6. Verify the accessors after each configuration change, and use a
+        //    test allocator for the object.  (C-7..8)
+        //
+        // Testing:
+        //   void disableWriteCoalescing();
+        //   void enableWriteCoalescing();
+        //   void enableWriteCoalescing(int bufferSize);
+        //   int flush();
+        //   void flushOnSeverity(Severity::Level threshold);
+        //   void flushOnSize(int numBytes);
+        //   void flushOnTimeInterval(const DatetimeInterval& interval);
+        //   void syncOnTimeInterval(const DatetimeInterval& interval);
+        //   DatetimeInterval flushInterval() const;
+        //   Severity::Level flushSeverityThreshold() const;
+        //   int flushSize() const;
+        //   bool isWriteCoalescingEnabled() const;
+        //   DatetimeInterval syncInterval() const;
+        //   int writeBufferSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING WRITE COALESCING AND FLUSH POLICIES"
+                          << "\n==========================================="
+                          << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        const bdlt::Datetime         NOW = bdlt::CurrentTime::utc();
+        const ball::Severity::Level  INFO  = ball::Severity::e_INFO;
+        const ball::Severity::Level  ERROR = ball::Severity::e_ERROR;
+
+        if (verbose) cout << "\tDefault configuration." << endl;
+        {
+            bdls::TempDirectoryGuard tempDirGuard("ball_fileobserver2_");
+            bsl::string              fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(false                  == X.isWriteCoalescingEnabled());
+            ASSERT(0                      == X.writeBufferSize());
+            ASSERT(0                      == X.flushSize());
+            ASSERT(bdlt::DatetimeInterval() == X.flushInterval());
+            ASSERT(ball::Severity::e_OFF  == X.flushSeverityThreshold());
+            ASSERT(bdlt::DatetimeInterval() == X.syncInterval());
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            Int64 size = FsUtil::getFileSize(fileName.c_str());
+            for (int i = 0; i < 3; ++i) {
+                publishRecord(&mX, "unbuffered", INFO, NOW);
+
+                const Int64 newSize = FsUtil::getFileSize(fileName.c_str());
+                ASSERTV(i, size < newSize);
+                size = newSize;
+            }
+
+            // `flush` is a no-op when coalescing is disabled.
+
+            ASSERT(0    == mX.flush());
+            ASSERT(size == FsUtil::getFileSize(fileName.c_str()));
+
+            mX.disableFileLogging();
+            ASSERT(0 == mX.flush());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tExplicit flush." << endl;
+        {
+            bdls::TempDirectoryGuard tempDirGuard("ball_fileobserver2_");
+            bsl::string              fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            mX.enableWriteCoalescing();
+            ASSERT(true       == X.isWriteCoalescingEnabled());
+            ASSERT(256 * 1024 == X.writeBufferSize());
+
+            mX.enableWriteCoalescing(4096);
+            ASSERT(true == X.isWriteCoalescingEnabled());
+            ASSERT(4096 == X.writeBufferSize());
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            for (int i = 0; i < 5; ++i) {
+                publishRecord(&mX, "buffered", INFO, NOW);
+            }
+            ASSERT(0 == FsUtil::getFileSize(fileName.c_str()));
+
+            ASSERT(0  == mX.flush());
+            ASSERT(10 == getNumLines(fileName.c_str()));
+
+            ASSERT(0  == mX.flush());
+            ASSERT(10 == getNumLines(fileName.c_str()));
+
+            // `disableWriteCoalescing` writes the pending records.
+
+            publishRecord(&mX, "buffered", INFO, NOW);
+            ASSERT(10 == getNumLines(fileName.c_str()));
+
+            mX.disableWriteCoalescing();
+            ASSERT(false == X.isWriteCoalescingEnabled());
+            ASSERT(0     == X.writeBufferSize());
+            ASSERT(12    == getNumLines(fileName.c_str()));
+
+            publishRecord(&mX, "unbuffered", INFO, NOW);
+            ASSERT(14    == getNumLines(fileName.c_str()));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tFlush on size." << endl;
+        {
+            bdls::TempDirectoryGuard tempDirGuard("ball_fileobserver2_");
+            bsl::string              fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            mX.enableWriteCoalescing(64 * 1024);
+            mX.flushOnSize(1024);
+            ASSERT(1024 == X.flushSize());
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            publishRecord(&mX, "small", INFO, NOW);
+            ASSERT(0 == FsUtil::getFileSize(fileName.c_str()));
+
+            const bsl::string LARGE(1024, 'x');
+            publishRecord(&mX, LARGE.c_str(), INFO, NOW);
+            ASSERT(4 == getNumLines(fileName.c_str()));
+
+            mX.flushOnSize(0);
+            ASSERT(0 == X.flushSize());
+
+            publishRecord(&mX, LARGE.c_str(), INFO, NOW);
+            ASSERT(4 == getNumLines(fileName.c_str()));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tFlush on severity." << endl;
+        {
+            bdls::TempDirectoryGuard tempDirGuard("ball_fileobserver2_");
+            bsl::string              fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            mX.enableWriteCoalescing(4096);
+            mX.flushOnSeverity(ball::Severity::e_WARN);
+            ASSERT(ball::Severity::e_WARN == X.flushSeverityThreshold());
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            publishRecord(&mX, "info", INFO, NOW);
+            publishRecord(&mX, "info", INFO, NOW);
+            ASSERT(0 == FsUtil::getFileSize(fileName.c_str()));
+
+            publishRecord(&mX, "error", ERROR, NOW);
+            ASSERT(6 == getNumLines(fileName.c_str()));
+
+            mX.flushOnSeverity(ball::Severity::e_OFF);
+            ASSERT(ball::Severity::e_OFF == X.flushSeverityThreshold());
+
+            publishRecord(&mX, "error", ERROR, NOW);
+            ASSERT(6 == getNumLines(fileName.c_str()));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tFlush on time interval." << endl;
+        {
+            bdls::TempDirectoryGuard tempDirGuard("ball_fileobserver2_");
+            bsl::string              fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            const bdlt::DatetimeInterval INTERVAL(0, 0, 0, 5);
+
+            mX.enableWriteCoalescing(4096);
+            mX.flushOnTimeInterval(INTERVAL);
+            ASSERT(INTERVAL == X.flushInterval());
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            bdlt::Datetime timestamp(NOW);
+
+            publishRecord(&mX, "first", INFO, timestamp);
+            timestamp.addSeconds(4);
+            publishRecord(&mX, "second", INFO, timestamp);
+            ASSERT(0 == FsUtil::getFileSize(fileName.c_str()));
+
+            // The interval is measured from the oldest pending record.
+
+            timestamp.addSeconds(1);
+            publishRecord(&mX, "third", INFO, timestamp);
+            ASSERT(6 == getNumLines(fileName.c_str()));
+
+            timestamp.addSeconds(4);
+            publishRecord(&mX, "fourth", INFO, timestamp);
+            ASSERT(6 == getNumLines(fileName.c_str()));
+
+            mX.flushOnTimeInterval(bdlt::DatetimeInterval());
+            ASSERT(bdlt::DatetimeInterval() == X.flushInterval());
+
+            timestamp.addSeconds(60);
+            publishRecord(&mX, "fifth", INFO, timestamp);
+            ASSERT(6 == getNumLines(fileName.c_str()));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tBuffer full." << endl;
+        {
+            static const int BUFFER_SIZES[] = {
+                1, 100, 4096, 64 * 1024, 100 * 1024, 1024 * 1024
+            };
+            const int NUM_BUFFER_SIZES = static_cast<int>(
+                              sizeof BUFFER_SIZES / sizeof *BUFFER_SIZES);
+
+            const int NUM_RECORDS = 20000;
+
+            for (int ti = 0; ti < NUM_BUFFER_SIZES; ++ti) {
+                const int BUFFER_SIZE = BUFFER_SIZES[ti];
+
+                if (veryVerbose) { T_ P(BUFFER_SIZE) }
+
+                bdls::TempDirectoryGuard tempDirGuard("ball_fileobserver2_");
+                bsl::string              fileName(
+                                                tempDirGuard.getTempDirName());
+                bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+                {
+                    Obj mX(&ta);
+
+                    mX.enableWriteCoalescing(BUFFER_SIZE);
+                    ASSERT(0 == mX.setFormat("%m\n"));
+                    ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+                    for (int i = 0; i < NUM_RECORDS; ++i) {
+                        bsl::ostringstream message;
+                        message << "record " << i;
+                        publishRecord(&mX, message.str().c_str(), INFO, NOW);
+                    }
+
+                    // The destructor writes the pending records.
+                }
+                ASSERTV(BUFFER_SIZE, 0 == ta.numBlocksInUse());
+
+                bsl::ifstream fs(fileName.c_str());
+                ASSERTV(BUFFER_SIZE, fs.is_open());
+
+                int         numLines = 0;
+                bsl::string line;
+                while (bsl::getline(fs, line)) {
+                    bsl::ostringstream expected;
+                    expected << "record " << numLines;
+                    ASSERTV(BUFFER_SIZE, numLines, line,
+                            expected.str() == line);
+                    ++numLines;
+                }
+                ASSERTV(BUFFER_SIZE, numLines, NUM_RECORDS == numLines);
+            }
+        }
+
+        if (verbose) cout << "\tClosing and rotating the file." << endl;
+        {
+            bdls::TempDirectoryGuard tempDirGuard("ball_fileobserver2_");
+            bsl::string              fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            Obj mX(&ta);
+
+            mX.enableWriteCoalescing(4096);
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            publishRecord(&mX, "pending", INFO, NOW);
+            ASSERT(0 == FsUtil::getFileSize(fileName.c_str()));
+
+            mX.disableFileLogging();
+            ASSERT(2 == getNumLines(fileName.c_str()));
+
+            // Records published while file logging is disabled are dropped.
+
+            publishRecord(&mX, "dropped", INFO, NOW);
+            ASSERT(0 == mX.flush());
+
+            bsl::string rotatedFileName(fileName);
+            rotatedFileName += ".rotated";
+
+            ASSERT(0 == FsUtil::move(fileName.c_str(),
+                                     rotatedFileName.c_str()));
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            RotCb cb(&ta);
+            mX.setOnFileRotationCallback(cb);
+
+            publishRecord(&mX, "pending", INFO, NOW);
+            ASSERT(0 == FsUtil::getFileSize(fileName.c_str()));
+
+            mX.forceRotation();
+            ASSERT(1 == cb.numInvocations());
+            ASSERT(0 == cb.status());
+            ASSERT(2 == getNumLines(cb.rotatedFileName().c_str()));
+            ASSERT(0 == FsUtil::getFileSize(fileName.c_str()));
+
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tRotation on size." << endl;
+        {
+            // Pending records count toward the rotation size.
+
+            bdls::TempDirectoryGuard tempDirGuard("ball_fileobserver2_");
+            bsl::string              fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            Obj mX(&ta);
+
+            mX.enableWriteCoalescing(64 * 1024);
+            mX.rotateOnSize(1);
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            RotCb cb(&ta);
+            mX.setOnFileRotationCallback(cb);
+
+            const bsl::string LARGE(1024, 'x');
+            publishRecord(&mX, LARGE.c_str(), INFO, NOW);
+            ASSERT(0 == cb.numInvocations());
+            ASSERT(0 == FsUtil::getFileSize(fileName.c_str()));
+
+            publishRecord(&mX, "next", INFO, NOW);
+            ASSERT(1 == cb.numInvocations());
+            ASSERT(0 == cb.status());
+            ASSERT(2 == getNumLines(cb.rotatedFileName().c_str()));
+            ASSERT(0 == FsUtil::getFileSize(fileName.c_str()));
+
+            mX.disableFileLogging();
+            ASSERT(2 == getNumLines(fileName.c_str()));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tSync on time interval." << endl;
+        {
+            bdls::TempDirectoryGuard tempDirGuard("ball_fileobserver2_");
+            bsl::string              fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            const bdlt::DatetimeInterval INTERVAL(0, 0, 0, 1);
+
+            mX.syncOnTimeInterval(INTERVAL);
+            ASSERT(INTERVAL == X.syncInterval());
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            publishRecord(&mX, "synced", INFO, NOW);
+            ASSERT(2 == getNumLines(fileName.c_str()));
+
+            mX.enableWriteCoalescing(4096);
+            mX.flushOnSeverity(ball::Severity::e_ERROR);
+
+            publishRecord(&mX, "synced", ERROR, NOW);
+            ASSERT(4 == getNumLines(fileName.c_str()));
+
+            mX.syncOnTimeInterval(bdlt::DatetimeInterval());
+            ASSERT(bdlt::DatetimeInterval() == X.syncInterval());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&ta);
+
+            ASSERT_PASS(mX.enableWriteCoalescing(1));
+            ASSERT_FAIL(mX.enableWriteCoalescing(0));
+
+            ASSERT_PASS(mX.flushOnSize(0));
+            ASSERT_FAIL(mX.flushOnSize(-1));
+
+            const bdlt::DatetimeInterval ZERO;
+            const bdlt::DatetimeInterval NEGATIVE(0, 0, 0, -1);
+
+            ASSERT_PASS(mX.flushOnTimeInterval(ZERO));
+            ASSERT_FAIL(mX.flushOnTimeInterval(NEGATIVE));
+
+            ASSERT_PASS(mX.syncOnTimeInterval(ZERO));
+            ASSERT_FAIL(mX.syncOnTimeInterval(NEGATIVE));
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // REPRODUCE BUG FROM DRQS 123123158
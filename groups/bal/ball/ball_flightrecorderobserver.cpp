@@ -0,0 +1,642 @@
+// ball_flightrecorderobserver.cpp                                    -*-C++-*-
+#include <ball_flightrecorderobserver.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_flightrecorderobserver_cpp,"$Id$ $CSID$")
+
+///Implementation Notes
+///--------------------
+// The mapped file holds a `FileHeader` followed by the ring.  A record is
+// written at the absolute byte position `commit` (the ring offset being
+// `commit % capacity`) as a `RecordHeader` followed by the file name, the
+// category, and the message, padded to a multiple of 8 bytes.  A record never
+// wraps around the end of the ring: if it does not fit in the bytes remaining
+// before the end, these bytes are skipped (and marked by a padding header, if
+// large enough to hold one) and the record is written at offset 0.
+//
+// Before overwriting any bytes of the ring, `publish` advances the reserve
+// position past the end of the new record; after the record is copied, it
+// advances the commit position.  A reader therefore trusts only the records
+// lying within `[reserve - capacity, commit)`: anything before that interval
+// may have been overwritten, and anything after it may be incomplete.  The
+// reader finds the first record boundary in that interval by scanning 8-byte
+// aligned slots for a header whose magic number and self-recorded position
+// match the slot, and then follows the record lengths.
+//
+// The two positions form a sequence lock.  The writer stores the reserve
+// position and then issues a full fence, as a store, even sequentially
+// consistent, does not prevent the later (plain) stores into the ring from
+// becoming visible before it; it advances the commit position with a release
+// store after the copy.  A live reader (`readFile`) loads the commit position
+// with an acquire load before copying the file, and issues an acquire fence
+// between the copy and its second load of the reserve position, so that the
+// second load observes every reservation whose overwritten bytes the copy may
+// contain.  No other synchronization is needed for the file to be consistent
+// after the process dies, as the mapping is shared with the page cache.
+
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_memoryutil.h>
+
+#include <bdlt_datetime.h>
+
+#include <bslma_allocatorutil.h>
+
+#include <bslmf_assert.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_libraryfeatures.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_atomic.h>
+#include <bsl_cstring.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ball {
+
+namespace {
+
+typedef bsls::AtomicOperations               AtomicOps;
+typedef bsls::AtomicOperations::AtomicTypes  AtomicTypes;
+typedef bsls::Types::Uint64                  Uint64;
+typedef bsls::Types::Int64                   Int64;
+typedef unsigned int                         Uint32;
+
+const Uint64 k_FILE_MAGIC     = 0x434552464C4C4142ULL;  // "BALLFREC"
+const Uint32 k_FILE_VERSION   = 1;
+
+const Uint32 k_RECORD_MAGIC   = 0x31434552;             // "REC1"
+const Uint32 k_PADDING_MAGIC  = 0x31444150;             // "PAD1"
+
+const int    k_ALIGNMENT      = 8;
+const int    k_PREFIX_SIZE    = 16;  // magic, length, and position of a
+                                     // record (or padding) header
+
+const bsl::size_t k_MAX_FIELD_LENGTH = 0xFFFF;
+                                     // maximum length of the file name and
+                                     // of the category
+
+/// This `struct` describes the header of a flight recorder file.
+struct FileHeader {
+    Uint64              d_magic;
+    Uint32              d_version;
+    Uint32              d_headerSize;       // `sizeof(FileHeader)`
+    Uint64              d_capacity;         // size of the ring
+    AtomicTypes::Uint64 d_reservePosition;  // end of the bytes that may be
+                                            // overwritten
+    AtomicTypes::Uint64 d_commitPosition;   // end of the complete records
+    Uint64              d_reserved[3];
+};
+
+/// This `struct` describes the header of a record in the ring.
+struct RecordHeader {
+    Uint32         d_magic;           // `k_RECORD_MAGIC` or
+                                      // `k_PADDING_MAGIC`
+    Uint32         d_length;          // length of the record (including
+                                      // this header and padding)
+    Uint64         d_position;        // absolute position of the record
+    Int64          d_timestamp;       // microseconds since 0001/01/01
+    Uint64         d_threadId;
+    Uint64         d_kernelThreadId;
+    int            d_processId;
+    int            d_lineNumber;
+    int            d_severity;
+    Uint32         d_messageLength;
+    unsigned short d_fileNameLength;
+    unsigned short d_categoryLength;
+    Uint32         d_reserved;
+};
+
+BSLMF_ASSERT(64 == sizeof(FileHeader));
+BSLMF_ASSERT(64 == sizeof(RecordHeader));
+
+/// Prevent the memory accesses preceding this call from being reordered
+/// with those following it.
+inline
+void fullFence()
+{
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP11_BASELINE_LIBRARY
+    bsl::atomic_thread_fence(bsl::memory_order_seq_cst);
+#else
+    // Without `atomic_thread_fence`, rely on the full barrier that the
+    // supported platforms implement a sequentially consistent
+    // read-modify-write operation with.
+
+    AtomicTypes::Int fence;
+    AtomicOps::initInt(&fence, 0);
+    AtomicOps::addInt(&fence, 1);
+#endif
+}
+
+/// Prevent the memory loads preceding this call from being reordered with
+/// the memory accesses following it.
+inline
+void acquireFence()
+{
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP11_BASELINE_LIBRARY
+    bsl::atomic_thread_fence(bsl::memory_order_acquire);
+#else
+    fullFence();
+#endif
+}
+
+/// Return the specified `value` rounded up to a multiple of `k_ALIGNMENT`.
+inline
+Uint64 align(Uint64 value)
+{
+    return (value + k_ALIGNMENT - 1) & ~static_cast<Uint64>(k_ALIGNMENT - 1);
+}
+
+/// Return the origin of the encoding of timestamps.
+inline
+bdlt::Datetime timestampOrigin()
+{
+    return bdlt::Datetime(1, 1, 1, 0, 0, 0);
+}
+
+/// Return the largest valid encoding of a timestamp.
+inline
+Int64 maxTimestamp()
+{
+    return (bdlt::Datetime(9999, 12, 31, 23, 59, 59, 999, 999)
+                                      - timestampOrigin()).totalMicroseconds();
+}
+
+}  // close unnamed namespace
+
+                       // ----------------------------
+                       // class FlightRecorderObserver
+                       // ----------------------------
+
+// PRIVATE MANIPULATORS
+void FlightRecorderObserver::closeImp()
+{
+    if (d_mapping_p) {
+        bdls::FilesystemUtil::unmap(d_mapping_p, d_mappingSize);
+
+        d_mapping_p   = 0;
+        d_mappingSize = 0;
+        d_capacity    = 0;
+        d_fileName.clear();
+    }
+}
+
+// CREATORS
+FlightRecorderObserver::FlightRecorderObserver(
+                                               const allocator_type& allocator)
+: d_mutex()
+, d_mapping_p(0)
+, d_mappingSize(0)
+, d_capacity(0)
+, d_fileName(allocator)
+{
+}
+
+FlightRecorderObserver::~FlightRecorderObserver()
+{
+    closeImp();
+}
+
+// MANIPULATORS
+void FlightRecorderObserver::close()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    closeImp();
+}
+
+int FlightRecorderObserver::open(const bsl::string_view& fileName,
+                                 bsls::Types::Uint64     capacity)
+{
+    typedef bdls::FilesystemUtil FileUtil;
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    closeImp();
+
+    capacity = align(bsl::max<Uint64>(capacity, k_MIN_CAPACITY));
+
+    const Uint64 size = sizeof(FileHeader) + capacity;
+
+    if (size != static_cast<bsl::size_t>(size)) {
+        return -1;                                                    // RETURN
+    }
+
+    FileUtil::FileDescriptor fd = FileUtil::open(fileName,
+                                                 FileUtil::e_OPEN_OR_CREATE,
+                                                 FileUtil::e_READ_WRITE,
+                                                 FileUtil::e_TRUNCATE);
+    if (FileUtil::k_INVALID_FD == fd) {
+        return -2;                                                    // RETURN
+    }
+
+    void *mapping = 0;
+
+    int rc = FileUtil::growFile(fd, size, true);
+    if (0 == rc) {
+        rc = FileUtil::map(fd,
+                           &mapping,
+                           0,
+                           static_cast<bsl::size_t>(size),
+                           bdls::MemoryUtil::k_ACCESS_READ_WRITE);
+    }
+
+    // The mapping remains valid after the file is closed.
+
+    FileUtil::close(fd);
+
+    if (0 != rc) {
+        return -3;                                                    // RETURN
+    }
+
+    d_mapping_p   = static_cast<char *>(mapping);
+    d_mappingSize = static_cast<bsl::size_t>(size);
+    d_capacity    = capacity;
+    d_fileName.assign(fileName.data(), fileName.length());
+
+    // Initialize the header, writing the magic number last so that a reader
+    // never accepts a partially initialized file.
+
+    FileHeader *header = reinterpret_cast<FileHeader *>(d_mapping_p);
+
+    bsl::memset(d_mapping_p, 0, sizeof(FileHeader));
+
+    header->d_version    = k_FILE_VERSION;
+    header->d_headerSize = sizeof(FileHeader);
+    header->d_capacity   = capacity;
+    AtomicOps::initUint64(&header->d_reservePosition, 0);
+    AtomicOps::initUint64(&header->d_commitPosition, 0);
+
+    Uint64 magic = k_FILE_MAGIC;
+    AtomicTypes::Uint64 *magicAddress =
+                     reinterpret_cast<AtomicTypes::Uint64 *>(&header->d_magic);
+    AtomicOps::setUint64Release(magicAddress, magic);
+
+    return 0;
+}
+
+void FlightRecorderObserver::publish(
+                                  const bsl::shared_ptr<const Record>& record,
+                                  const Context&)
+{
+    BSLS_ASSERT(record);
+
+    const RecordAttributes& fixedFields = record->fixedFields();
+
+    const bsl::string_view fileName = fixedFields.fileName();
+    const bsl::string_view category = fixedFields.category();
+    const bsl::string_view message  = fixedFields.messageRef();
+
+    const Int64 timestamp =
+             (fixedFields.timestamp() - timestampOrigin()).totalMicroseconds();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (!d_mapping_p) {
+        return;                                                       // RETURN
+    }
+
+    // Truncate the fields so that the record takes at most a quarter of the
+    // ring.
+
+    bsl::size_t budget = static_cast<bsl::size_t>(d_capacity / 4)
+                                                        - sizeof(RecordHeader);
+
+    const bsl::size_t fileNameLength = bsl::min(
+                                     bsl::min(fileName.length(), budget),
+                                     k_MAX_FIELD_LENGTH);
+    budget -= fileNameLength;
+
+    const bsl::size_t categoryLength = bsl::min(
+                                     bsl::min(category.length(), budget),
+                                     k_MAX_FIELD_LENGTH);
+    budget -= categoryLength;
+
+    const bsl::size_t messageLength = bsl::min(message.length(), budget);
+
+    const Uint64 length = align(sizeof(RecordHeader)
+                              + fileNameLength
+                              + categoryLength
+                              + messageLength);
+
+    FileHeader *header = reinterpret_cast<FileHeader *>(d_mapping_p);
+    char       *ring   = d_mapping_p + sizeof(FileHeader);
+
+    Uint64 position  = AtomicOps::getUint64Relaxed(&header->d_commitPosition);
+    Uint64 offset    = position % d_capacity;
+    Uint64 remaining = d_capacity - offset;
+
+    // Advance the reserve position ahead of overwriting the ring, and fence
+    // so that the stores below do not become visible before it.
+
+    if (remaining < length) {
+        AtomicOps::setUint64(&header->d_reservePosition,
+                             position + remaining + length);
+        fullFence();
+
+        if (remaining >= static_cast<Uint64>(k_PREFIX_SIZE)) {
+            RecordHeader padding;
+
+            padding.d_magic    = k_PADDING_MAGIC;
+            padding.d_length   = static_cast<Uint32>(remaining);
+            padding.d_position = position;
+
+            bsl::memcpy(ring + offset, &padding, k_PREFIX_SIZE);
+        }
+
+        position += remaining;
+        offset    = 0;
+    }
+    else {
+        AtomicOps::setUint64(&header->d_reservePosition, position + length);
+        fullFence();
+    }
+
+    RecordHeader recordHeader;
+
+    recordHeader.d_magic          = k_RECORD_MAGIC;
+    recordHeader.d_length         = static_cast<Uint32>(length);
+    recordHeader.d_position       = position;
+    recordHeader.d_timestamp      = timestamp;
+    recordHeader.d_threadId       = fixedFields.threadID();
+    recordHeader.d_kernelThreadId = fixedFields.kernelThreadID();
+    recordHeader.d_processId      = fixedFields.processID();
+    recordHeader.d_lineNumber     = fixedFields.lineNumber();
+    recordHeader.d_severity       = fixedFields.severity();
+    recordHeader.d_messageLength  = static_cast<Uint32>(messageLength);
+    recordHeader.d_fileNameLength =
+                                 static_cast<unsigned short>(fileNameLength);
+    recordHeader.d_categoryLength =
+                                 static_cast<unsigned short>(categoryLength);
+    recordHeader.d_reserved       = 0;
+
+    char *output = ring + offset;
+
+    bsl::memcpy(output, &recordHeader, sizeof(RecordHeader));
+    output += sizeof(RecordHeader);
+
+    bsl::memcpy(output, fileName.data(), fileNameLength);
+    output += fileNameLength;
+
+    bsl::memcpy(output, category.data(), categoryLength);
+    output += categoryLength;
+
+    bsl::memcpy(output, message.data(), messageLength);
+
+    AtomicOps::setUint64Release(&header->d_commitPosition, position + length);
+}
+
+int FlightRecorderObserver::sync(bool waitFlag)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (!d_mapping_p) {
+        return -1;                                                    // RETURN
+    }
+
+    // The mapping extends to the end of its last page.
+
+    const bsl::size_t pageSize = bdls::MemoryUtil::pageSize();
+    const bsl::size_t numBytes = (d_mappingSize + pageSize - 1)
+                                                         / pageSize * pageSize;
+
+    return bdls::FilesystemUtil::sync(d_mapping_p, numBytes, waitFlag);
+}
+
+// ACCESSORS
+bsls::Types::Uint64 FlightRecorderObserver::capacity() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_capacity;
+}
+
+bsl::string FlightRecorderObserver::fileName() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_fileName;
+}
+
+bool FlightRecorderObserver::isOpen() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return 0 != d_mapping_p;
+}
+
+                     // --------------------------------
+                     // class FlightRecorderObserverUtil
+                     // --------------------------------
+
+// CLASS METHODS
+int FlightRecorderObserverUtil::readBuffer(
+                                   const char                  *buffer,
+                                   bsl::size_t                  length,
+                                   const RecordVisitor&         visitor,
+                                   const bsl::allocator<char>&  allocator)
+{
+    BSLS_ASSERT(buffer || 0 == length);
+
+    if (length < sizeof(FileHeader)) {
+        return -1;                                                    // RETURN
+    }
+
+    FileHeader header;
+    bsl::memcpy(&header, buffer, sizeof(FileHeader));
+
+    const Uint64 capacity = header.d_capacity;
+
+    if (k_FILE_MAGIC          != header.d_magic
+     || k_FILE_VERSION        != header.d_version
+     || sizeof(FileHeader)    != header.d_headerSize
+     || 0                     == capacity
+     || 0                     != capacity % k_ALIGNMENT
+     || length - sizeof(FileHeader) < capacity) {
+        return -1;                                                    // RETURN
+    }
+
+    const Uint64 commit  = AtomicOps::getUint64(&header.d_commitPosition);
+    const Uint64 reserve = AtomicOps::getUint64(&header.d_reservePosition);
+
+    if (reserve < commit) {
+        return -1;                                                    // RETURN
+    }
+
+    const char *ring     = buffer + sizeof(FileHeader);
+    Uint64      position = reserve > capacity ? reserve - capacity : 0;
+    int         count    = 0;
+
+    Record record(bslma::AllocatorUtil::adapt(allocator));
+
+    while (position < commit) {
+        const Uint64 offset    = position % capacity;
+        const Uint64 remaining = capacity - offset;
+
+        if (remaining < static_cast<Uint64>(k_PREFIX_SIZE)) {
+            position += remaining;
+            continue;                                               // CONTINUE
+        }
+
+        RecordHeader recordHeader;
+        bsl::memcpy(&recordHeader, ring + offset, k_PREFIX_SIZE);
+
+        const Uint64 recordLength = recordHeader.d_length;
+
+        bool valid = (k_RECORD_MAGIC  == recordHeader.d_magic
+                   || k_PADDING_MAGIC == recordHeader.d_magic)
+                  && position == recordHeader.d_position
+                  && 0 == recordLength % k_ALIGNMENT
+                  && static_cast<Uint64>(k_PREFIX_SIZE) <= recordLength
+                  && recordLength <= remaining
+                  && position + recordLength <= commit;
+
+        if (valid && k_RECORD_MAGIC == recordHeader.d_magic) {
+            valid = sizeof(RecordHeader) <= recordLength;
+            if (valid) {
+                bsl::memcpy(&recordHeader,
+                            ring + offset,
+                            sizeof(RecordHeader));
+
+                valid = sizeof(RecordHeader)
+                      + recordHeader.d_fileNameLength
+                      + recordHeader.d_categoryLength
+                      + static_cast<Uint64>(recordHeader.d_messageLength)
+                                                               <= recordLength
+                     && 0 <= recordHeader.d_timestamp
+                     && recordHeader.d_timestamp <= maxTimestamp();
+            }
+            if (valid) {
+                const char *input = ring + offset + sizeof(RecordHeader);
+
+                RecordAttributes& fixedFields = record.fixedFields();
+
+                bdlt::Datetime timestamp = timestampOrigin();
+                timestamp.addMicroseconds(recordHeader.d_timestamp);
+
+                fixedFields.setTimestamp(timestamp);
+                fixedFields.setProcessID(recordHeader.d_processId);
+                fixedFields.setThreadID(recordHeader.d_threadId);
+                fixedFields.setKernelThreadID(recordHeader.d_kernelThreadId);
+                fixedFields.setLineNumber(recordHeader.d_lineNumber);
+                fixedFields.setSeverity(recordHeader.d_severity);
+
+                fixedFields.setFileName(
+                       bsl::string_view(input, recordHeader.d_fileNameLength));
+                input += recordHeader.d_fileNameLength;
+
+                fixedFields.setCategory(
+                       bsl::string_view(input, recordHeader.d_categoryLength));
+                input += recordHeader.d_categoryLength;
+
+                fixedFields.setMessage(
+                        bsl::string_view(input, recordHeader.d_messageLength));
+
+                visitor(record);
+                ++count;
+            }
+        }
+
+        // Until the first record boundary is found, scan the slots one at a
+        // time.
+
+        position += valid ? recordLength : k_ALIGNMENT;
+    }
+
+    return count;
+}
+
+int FlightRecorderObserverUtil::readFile(
+                                   const bsl::string_view&      fileName,
+                                   const RecordVisitor&         visitor,
+                                   const bsl::allocator<char>&  allocator)
+{
+    typedef bdls::FilesystemUtil FileUtil;
+
+    FileUtil::FileDescriptor fd = FileUtil::open(fileName,
+                                                 FileUtil::e_OPEN,
+                                                 FileUtil::e_READ_ONLY);
+    if (FileUtil::k_INVALID_FD == fd) {
+        return -2;                                                    // RETURN
+    }
+
+    const FileUtil::Offset size = FileUtil::getFileSize(fd);
+
+    if (size < static_cast<FileUtil::Offset>(sizeof(FileHeader))
+     || static_cast<Uint64>(size) != static_cast<bsl::size_t>(size)) {
+        FileUtil::close(fd);
+        return -1;                                                    // RETURN
+    }
+
+    void *mapping = 0;
+
+    int rc = FileUtil::map(fd,
+                           &mapping,
+                           0,
+                           static_cast<bsl::size_t>(size),
+                           bdls::MemoryUtil::k_ACCESS_READ);
+
+    FileUtil::close(fd);
+
+    if (0 != rc) {
+        return -3;                                                    // RETURN
+    }
+
+    // Decode a copy of the file, so that a live writer cannot modify the
+    // records while they are decoded.  The commit position is read before the
+    // copy, so that the records it covers are complete in the copy, and the
+    // reserve position is read again after the copy (and an acquire fence),
+    // to exclude the records that the writer may have overwritten during the
+    // copy.
+
+    const char       *source       = static_cast<const char *>(mapping);
+    const FileHeader *sourceHeader =
+                                 reinterpret_cast<const FileHeader *>(source);
+
+    const Uint64 commit = AtomicOps::getUint64Acquire(
+                                              &sourceHeader->d_commitPosition);
+
+    bsl::vector<char> contents(source, source + size, allocator);
+
+    acquireFence();
+
+    const Uint64 reserve = AtomicOps::getUint64Relaxed(
+                                             &sourceHeader->d_reservePosition);
+
+    FileHeader *header = reinterpret_cast<FileHeader *>(contents.data());
+
+    AtomicOps::setUint64Relaxed(&header->d_commitPosition, commit);
+    AtomicOps::setUint64Relaxed(
+              &header->d_reservePosition,
+              bsl::max(AtomicOps::getUint64Relaxed(&header->d_reservePosition),
+                       reserve));
+
+    FileUtil::unmap(mapping, static_cast<bsl::size_t>(size));
+
+    return readBuffer(contents.data(), contents.size(), visitor, allocator);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
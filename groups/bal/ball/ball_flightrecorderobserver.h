@@ -0,0 +1,385 @@
+// ball_flightrecorderobserver.h                                      -*-C++-*-
+#ifndef INCLUDED_BALL_FLIGHTRECORDEROBSERVER
+#define INCLUDED_BALL_FLIGHTRECORDEROBSERVER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an observer recording log records in a mapped ring file.
+//
+//@CLASSES:
+//  ball::FlightRecorderObserver: observer writing records to a mapped ring
+//  ball::FlightRecorderObserverUtil: utility decoding flight recorder files
+//
+//@SEE_ALSO: ball_fixedsizerecordbuffer, ball_observer, bdls_filesystemutil
+//
+//@DESCRIPTION: This component provides a concrete implementation of the
+// `ball::Observer` protocol, `ball::FlightRecorderObserver`, that writes a
+// compact binary encoding of the log records it receives into a fixed-size
+// ring buffer held in a memory-mapped file, and a utility,
+// `ball::FlightRecorderObserverUtil`, that decodes such a file (or a copy of
+// its contents) back into `ball::Record` objects:
+// ```
+//            ,----------------------------.
+//           ( ball::FlightRecorderObserver )
+//            `----------------------------'
+//                          |              ctor
+//                          |              open
+//                          |              close
+//                          |              sync
+//                          |              capacity
+//                          |              fileName
+//                          |              isOpen
+//                          V
+//                   ,--------------.
+//                  ( ball::Observer )
+//                   `--------------'
+//                                         publish
+//                                         releaseRecords
+//                                         dtor
+// ```
+// A flight recorder keeps the most recent log records of a process (the last
+// `capacity()` bytes of encoded records, at all severities) in a form that
+// survives the abnormal termination of the process: because the ring buffer
+// is a shared mapping of a file, the records written to it are owned by the
+// operating system's page cache as soon as they are copied, and remain in the
+// file if the process is killed (e.g., by `SIGKILL` or the out-of-memory
+// killer) or crashes.  Publishing a record costs a mutex acquisition and a
+// copy of the record's fixed fields into mapped memory; there is no system
+// call, formatting, or memory allocation.  This makes it practical to keep a
+// `TRACE`-level history of a process that is only ever inspected after a
+// failure, in contrast to `ball::FixedSizeRecordBuffer`, whose records are
+// lost with the process.  Note that records are only guaranteed to reach
+// the storage device when `sync` is called (or when the operating system
+// writes back the mapping); they do *not* survive a failure of the host.
+//
+///Recorded Fields
+///---------------
+// Only the fixed fields of a record are recorded: the timestamp, process id,
+// thread id, kernel thread id, severity, file name, line number, category,
+// and message.  User fields and attributes are not recorded.  File names and
+// categories longer than 65535 bytes, and messages longer than permitted by
+// the capacity of the ring (a quarter of the capacity, less the space taken
+// by the other fields), are truncated.
+//
+///File Format
+///-----------
+// The file consists of a header followed by the ring buffer.  The header
+// holds a magic number, a format version, the capacity of the ring, and two
+// monotonically increasing byte positions: the *reserve* position, advanced
+// before a record is copied into the ring, and the *commit* position,
+// advanced after the copy completes.  Each record is 8-byte aligned and
+// begins with a header carrying its length and its own position, so that the
+// reader can locate the oldest intact record without any other index, and
+// ignores records that were partially overwritten (or partially written when
+// the process died).  All integers are stored in the native byte order of
+// the writing host; a file must be decoded on a host of the same byte order.
+//
+///Thread Safety
+///-------------
+// `ball::FlightRecorderObserver` is *thread-safe*, meaning that multiple
+// threads may share the same instance.  The functions of
+// `ball::FlightRecorderObserverUtil` are *thread-safe*.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recording and Recovering Log Records
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// First, at the start of the process, we recover the records of the previous
+// run (if any), printing them with a `ball::RecordStringFormatter`, before
+// the file is reinitialized:
+// ```
+// void printRecord(bsl::ostream                       *stream,
+//                  const ball::RecordStringFormatter&  formatter,
+//                  const ball::Record&                 record)
+// {
+//     formatter(*stream, record);
+// }
+//
+// int recoverPreviousRun(const char *fileName, bsl::ostream& stream)
+// {
+//     ball::RecordStringFormatter formatter("%I %t %s %F:%l %m\n");
+//
+//     using namespace bdlf::PlaceHolders;
+//     return ball::FlightRecorderObserverUtil::readFile(
+//                                      fileName,
+//                                      bdlf::BindUtil::bind(&printRecord,
+//                                                           &stream,
+//                                                           formatter,
+//                                                           _1));
+// }
+// ```
+// Then, we create a flight recorder observer having a 1 MB ring, and open
+// its file:
+// ```
+// ball::FlightRecorderObserver observer;
+//
+// int rc = observer.open(fileName, 1024 * 1024);
+// assert(0 == rc);
+// assert(observer.isOpen());
+// ```
+// Next, we publish a record (typically, the observer is registered with the
+// logger manager, possibly through a `ball::BroadcastObserver`, with a
+// pass-through severity of `TRACE`):
+// ```
+// ball::RecordAttributes attributes;
+// ball::UserFields       fieldValues;
+//
+// attributes.setSeverity(ball::Severity::e_TRACE);
+// attributes.setMessage("entering the matching loop");
+//
+// bslma::Allocator *ga = bslma::Default::globalAllocator(0);
+// const bsl::shared_ptr<const ball::Record>
+//            record(new (*ga) ball::Record(attributes, fieldValues, ga), ga);
+//
+// observer.publish(record, ball::Context());
+// ```
+// Finally, should the process be killed at this point, the record can be
+// read from the file by another process:
+// ```
+// bsl::vector<bsl::string> messages;
+//
+// rc = ball::FlightRecorderObserverUtil::readFile(
+//                                      fileName,
+//                                      bdlf::BindUtil::bind(&saveMessage,
+//                                                           &messages,
+//                                                           _1));
+// assert(1 == rc);
+// assert("entering the matching loop" == messages[0]);
+// ```
+// where `saveMessage` appends the message of the record to `messages`.
+
+#include <balscm_version.h>
+
+#include <ball_observer.h>
+
+#include <bslma_allocator.h>
+#include <bslma_bslallocator.h>
+
+#include <bslmt_mutex.h>
+
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+
+namespace BloombergLP {
+namespace ball {
+
+class Context;
+class Record;
+
+                       // ============================
+                       // class FlightRecorderObserver
+                       // ============================
+
+/// This class provides a concrete implementation of the `Observer`
+/// protocol that writes the fixed fields of the log records it receives to
+/// a ring buffer in a memory-mapped file.
+class FlightRecorderObserver : public Observer {
+
+  public:
+    // TYPES
+    typedef bsl::allocator<char> allocator_type;
+
+    enum {
+        k_MIN_CAPACITY = 4096  // minimum capacity (in bytes) of the ring
+    };
+
+  private:
+    // DATA
+    mutable bslmt::Mutex  d_mutex;        // serializes `publish` and the
+                                          // (re)mapping of the file
+
+    char                 *d_mapping_p;    // mapped file (header and ring),
+                                          // or 0 if not open
+
+    bsl::size_t           d_mappingSize;  // size of the mapping
+
+    bsls::Types::Uint64   d_capacity;     // size of the ring
+
+    bsl::string           d_fileName;     // name of the mapped file
+
+  private:
+    // NOT IMPLEMENTED
+    FlightRecorderObserver(const FlightRecorderObserver&);
+    FlightRecorderObserver& operator=(const FlightRecorderObserver&);
+
+    // PRIVATE MANIPULATORS
+
+    /// Unmap the file of this observer, if any.  The behavior is undefined
+    /// unless `d_mutex` is locked.
+    void closeImp();
+
+  public:
+    // CREATORS
+
+    /// Create a flight recorder observer that is not open.  Optionally
+    /// specify an `allocator` (e.g., the address of a `bslma::Allocator`
+    /// object) to supply memory; otherwise, the default allocator is used.
+    explicit
+    FlightRecorderObserver(const allocator_type& allocator = allocator_type());
+
+    /// Close this observer (see `close`) and destroy it.
+    ~FlightRecorderObserver() BSLS_KEYWORD_OVERRIDE;
+
+    // MANIPULATORS
+
+    using Observer::publish;  // Picks up the deprecated `publish` overload.
+
+    /// Close this observer: stop recording, and unmap its file.  Records
+    /// already written remain in the file.  This method has no effect if
+    /// this observer is not open.
+    void close();
+
+    /// Create (or truncate) the file having the specified `fileName`, size
+    /// it to hold a ring of the specified `capacity` bytes (rounded up to a
+    /// multiple of 8, and to at least `k_MIN_CAPACITY`), map it into
+    /// memory, and record subsequently published records into it.  Return
+    /// 0 on success, and a non-zero value otherwise (in which case this
+    /// observer is not open).  If this observer is already open, it is
+    /// closed first.  Note that the disk space of the file is reserved, so
+    /// that writing to the mapping cannot fail for lack of space.  Also
+    /// note that any records of a previous run stored in `fileName` are
+    /// discarded: use `FlightRecorderObserverUtil::readFile` to recover
+    /// them beforehand.
+    int open(const bsl::string_view& fileName, bsls::Types::Uint64 capacity);
+
+    /// Process the specified log `record` having the specified publishing
+    /// `context` by writing the fixed fields of `record` to the ring buffer
+    /// of this observer, overwriting the oldest records if necessary.  This
+    /// method has no effect if this observer is not open.  The behavior is
+    /// undefined if `record` is modified during the execution of this
+    /// method.
+    void publish(const bsl::shared_ptr<const Record>& record,
+                 const Context&                       context)
+                                                         BSLS_KEYWORD_OVERRIDE;
+
+    /// Do nothing: this observer does not retain shared references to the
+    /// records supplied to `publish`.
+    void releaseRecords() BSLS_KEYWORD_OVERRIDE;
+
+    /// Write the mapped file of this observer to its storage device; if the
+    /// optionally specified `waitFlag` is `true`, wait for the write to
+    /// complete.  Return 0 on success, and a non-zero value otherwise (or
+    /// if this observer is not open).  Note that this method is only needed
+    /// for the records to survive the failure of the host, not that of the
+    /// process.
+    int sync(bool waitFlag = true);
+
+    // ACCESSORS
+
+    /// Return the capacity (in bytes) of the ring buffer of this observer,
+    /// or 0 if this observer is not open.
+    bsls::Types::Uint64 capacity() const;
+
+    /// Return the name of the file of this observer, or an empty string if
+    /// this observer is not open.
+    bsl::string fileName() const;
+
+    /// Return `true` if this observer is open, and `false` otherwise.
+    bool isOpen() const;
+
+                                  // Aspects
+
+    /// Return the allocator used by this object to supply memory.
+    allocator_type get_allocator() const;
+};
+
+                     // ================================
+                     // class FlightRecorderObserverUtil
+                     // ================================
+
+/// This `struct` provides a namespace for functions decoding the records
+/// written by a `FlightRecorderObserver`.
+struct FlightRecorderObserverUtil {
+
+    // TYPES
+
+    /// `RecordVisitor` is an alias for the type of a function invoked for
+    /// each decoded record.
+    typedef bsl::function<void(const Record&)> RecordVisitor;
+
+    // CLASS METHODS
+
+    /// Invoke the specified `visitor` with each of the intact records held
+    /// in the specified `buffer` of the specified `length` bytes, which is
+    /// a copy of the contents of a flight recorder file, in the order in
+    /// which they were published (oldest first).  Return the number of
+    /// records visited on success, and a negative value if `buffer` does
+    /// not hold a flight recorder file.  Optionally specify an `allocator`
+    /// (e.g., the address of a `bslma::Allocator` object) to supply memory
+    /// for the records; otherwise, the default allocator is used.
+    static int readBuffer(
+              const char                  *buffer,
+              bsl::size_t                  length,
+              const RecordVisitor&         visitor,
+              const bsl::allocator<char>&  allocator = bsl::allocator<char>());
+
+    /// Invoke the specified `visitor` with each of the intact records held
+    /// in the flight recorder file having the specified `fileName`, in the
+    /// order in which they were published (oldest first).  Return the
+    /// number of records visited on success, and a negative value if the
+    /// file cannot be read or does not hold a flight recorder file.
+    /// Optionally specify an `allocator` (e.g., the address of a
+    /// `bslma::Allocator` object) to supply memory for the records;
+    /// otherwise, the default allocator is used.  Note that the file may be
+    /// read while it is being written by a live process, in which case the
+    /// records visited are those intact at the time the header is read.
+    static int readFile(
+              const bsl::string_view&      fileName,
+              const RecordVisitor&         visitor,
+              const bsl::allocator<char>&  allocator = bsl::allocator<char>());
+};
+
+// ============================================================================
+//                          INLINE DEFINITIONS
+// ============================================================================
+
+                       // ----------------------------
+                       // class FlightRecorderObserver
+                       // ----------------------------
+
+// MANIPULATORS
+inline
+void FlightRecorderObserver::releaseRecords()
+{
+}
+
+// ACCESSORS
+
+                                  // Aspects
+
+inline
+FlightRecorderObserver::allocator_type
+FlightRecorderObserver::get_allocator() const
+{
+    return d_fileName.get_allocator();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1218 @@
+// ball_flightrecorderobserver.t.cpp                                  -*-C++-*-
+#include <ball_flightrecorderobserver.h>
+
+#include <ball_context.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_recordstringformatter.h>
+#include <ball_severity.h>
+#include <ball_userfields.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
+#include <bdls_tempdirectoryguard.h>
+
+#include <bdlt_datetime.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+#include <bsl_iterator.h>
+#include <bsl_memory.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides an observer writing records to a mapped
+// ring file, and a utility decoding such files.  The two are tested together:
+// records are published to an observer, and the records decoded from its file
+// (while it is still open, as would be the case after the writing process is
+// killed) are compared with those published.  The decoder is then exercised
+// on damaged copies of a file: the decoder must never read outside of the
+// buffer, and must ignore the damaged records only.
+// ----------------------------------------------------------------------------
+// ball::FlightRecorderObserver
+// ----------------------------
+// CREATORS
+// [ 2] FlightRecorderObserver(const allocator_type& allocator = {});
+// [ 2] ~FlightRecorderObserver();
+//
+// MANIPULATORS
+// [ 2] void close();
+// [ 2] int open(const bsl::string_view& fileName, Uint64 capacity);
+// [ 3] void publish(const shared_ptr<const Record>&, const Context&);
+// [ 2] void releaseRecords();
+// [ 2] int sync(bool waitFlag = true);
+//
+// ACCESSORS
+// [ 2] Uint64 capacity() const;
+// [ 2] bsl::string fileName() const;
+// [ 2] bool isOpen() const;
+// [ 2] allocator_type get_allocator() const;
+//
+// ball::FlightRecorderObserverUtil
+// --------------------------------
+// [ 5] int readBuffer(const char *, size_t, const RecordVisitor&, alloc);
+// [ 3] int readFile(const string_view&, const RecordVisitor&, alloc);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] WRAP-AROUND AND TRUNCATION
+// [ 6] CONCURRENT PUBLICATION
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef ball::FlightRecorderObserver     Obj;
+typedef ball::FlightRecorderObserverUtil Util;
+typedef bsls::Types::Uint64              Uint64;
+
+const int k_FILE_HEADER_SIZE   = 64;  // size of the file header
+const int k_RECORD_HEADER_SIZE = 64;  // size of a record header
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// Return a record, allocated with the specified `allocator`, having the
+/// specified `message`, `category`, `fileName`, `lineNumber`, `severity`,
+/// and `threadId`, and a fixed timestamp and process id.
+bsl::shared_ptr<ball::Record> makeRecord(const bsl::string_view&  message,
+                                         const bsl::string_view&  category,
+                                         const bsl::string_view&  fileName,
+                                         int                      lineNumber,
+                                         int                      severity,
+                                         Uint64                   threadId,
+                                         bslma::Allocator        *allocator)
+{
+    bsl::shared_ptr<ball::Record> record;
+    record.createInplace(allocator, allocator);
+
+    ball::RecordAttributes& attributes = record->fixedFields();
+
+    attributes.setTimestamp(bdlt::Datetime(2026, 3, 14, 15, 9, 26, 535, 897));
+    attributes.setProcessID(4321);
+    attributes.setThreadID(threadId);
+    attributes.setKernelThreadID(threadId + 1000);
+    attributes.setFileName(fileName);
+    attributes.setLineNumber(lineNumber);
+    attributes.setCategory(category);
+    attributes.setSeverity(severity);
+    attributes.setMessage(message);
+
+    return record;
+}
+
+/// Append a copy of the specified `record` to the specified `records`.
+void saveRecord(bsl::vector<ball::Record> *records,
+                const ball::Record&        record)
+{
+    records->push_back(record);
+}
+
+/// Append the message of the specified `record` to the specified
+/// `messages`.
+void saveMessage(bsl::vector<bsl::string> *messages,
+                 const ball::Record&       record)
+{
+    messages->push_back(record.fixedFields().message());
+}
+
+/// Load into the specified `contents` the contents of the file having the
+/// specified `fileName`.
+void readContents(bsl::vector<char> *contents, const bsl::string& fileName)
+{
+    bsl::ifstream stream(fileName.c_str(), bsl::ios::binary);
+
+    contents->assign(bsl::istreambuf_iterator<char>(stream),
+                     bsl::istreambuf_iterator<char>());
+}
+
+/// Return the number of records decoded from the specified `contents`,
+/// loading their messages into the specified `messages`.
+int readMessages(bsl::vector<bsl::string> *messages,
+                 const bsl::vector<char>&  contents)
+{
+    using namespace bdlf::PlaceHolders;
+
+    messages->clear();
+    return Util::readBuffer(contents.data(),
+                            contents.size(),
+                            bdlf::BindUtil::bind(&saveMessage, messages, _1));
+}
+
+/// Store the specified `value` into the specified `contents` at the
+/// specified `offset`.
+void store(bsl::vector<char> *contents, bsl::size_t offset, Uint64 value)
+{
+    bsl::memcpy(contents->data() + offset, &value, sizeof value);
+}
+
+/// Return the value stored in the specified `contents` at the specified
+/// `offset`.
+Uint64 load(const bsl::vector<char>& contents, bsl::size_t offset)
+{
+    Uint64 value;
+    bsl::memcpy(&value, contents.data() + offset, sizeof value);
+    return value;
+}
+
+const bsl::size_t k_RESERVE_OFFSET = 24;  // offset of the reserve position
+const bsl::size_t k_COMMIT_OFFSET  = 32;  // offset of the commit position
+
+                            // ===================
+                            // struct PublishThread
+                            // ===================
+
+/// This `struct` provides a functor publishing a sequence of records, whose
+/// messages are their indices, to an observer.
+struct PublishThread {
+    // DATA
+    Obj    *d_observer_p;
+    int     d_threadIndex;
+    int     d_numRecords;
+
+    // ACCESSORS
+    void operator()() const
+    {
+        bslma::Allocator *ga = bslma::Default::globalAllocator(0);
+
+        for (int i = 0; i < d_numRecords; ++i) {
+            bsl::ostringstream message;
+            message << i;
+
+            d_observer_p->publish(makeRecord(message.str(),
+                                             "THREAD",
+                                             __FILE__,
+                                             __LINE__,
+                                             ball::Severity::e_TRACE,
+                                             d_threadIndex,
+                                             ga),
+                                  ball::Context());
+        }
+    }
+};
+
+///Usage
+///-----
+
+/// Print the specified `record` to the specified `stream` using the
+/// specified `formatter`.
+void printRecord(bsl::ostream                       *stream,
+                 const ball::RecordStringFormatter&  formatter,
+                 const ball::Record&                 record)
+{
+    formatter(*stream, record);
+}
+
+/// Print to the specified `stream` the records of the flight recorder file
+/// having the specified `fileName`, and return the number of records
+/// printed, or a negative value if the file cannot be read.
+int recoverPreviousRun(const char *fileName, bsl::ostream& stream)
+{
+    ball::RecordStringFormatter formatter("%I %t %s %F:%l %m\n");
+
+    using namespace bdlf::PlaceHolders;
+    return ball::FlightRecorderObserverUtil::readFile(
+                                     fileName,
+                                     bdlf::BindUtil::bind(&printRecord,
+                                                          &stream,
+                                                          formatter,
+                                                          _1));
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    using namespace bdlf::PlaceHolders;
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                          << "\n=============" << endl;
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_flightrecorderobserver_");
+        bsl::string              fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "flight.rec");
+
+        bsl::ostringstream previousRun;
+        ASSERT(0 > recoverPreviousRun(fileName.c_str(), previousRun));
+
+///Example 1: Recording and Recovering Log Records
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Then, we create a flight recorder observer having a 1 MB ring, and open
+// its file:
+// ```
+        ball::FlightRecorderObserver observer;
+
+        int rc = observer.open(fileName, 1024 * 1024);
+        ASSERT(0 == rc);
+        ASSERT(observer.isOpen());
+// ```
+// Next, we publish a record (typically, the observer is registered with the
+// logger manager, possibly through a `ball::BroadcastObserver`, with a
+// pass-through severity of `TRACE`):
+// ```
+        ball::RecordAttributes attributes;
+        ball::UserFields       fieldValues;
+
+        attributes.setSeverity(ball::Severity::e_TRACE);
+        attributes.setMessage("entering the matching loop");
+
+        bslma::Allocator *ga = bslma::Default::globalAllocator(0);
+        const bsl::shared_ptr<const ball::Record>
+               record(new (*ga) ball::Record(attributes, fieldValues, ga), ga);
+
+        observer.publish(record, ball::Context());
+// ```
+// Finally, should the process be killed at this point, the record can be
+// read from the file by another process:
+// ```
+        bsl::vector<bsl::string> messages;
+
+        rc = ball::FlightRecorderObserverUtil::readFile(
+                                           fileName,
+                                           bdlf::BindUtil::bind(&saveMessage,
+                                                                &messages,
+                                                                _1));
+        ASSERT(1 == rc);
+        ASSERT("entering the matching loop" == messages[0]);
+// ```
+
+        ASSERT(1 == recoverPreviousRun(fileName.c_str(), previousRun));
+        if (veryVerbose) {
+            cout << previousRun.str();
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENT PUBLICATION
+        //
+        // Concerns:
+        // 1. Records published concurrently from several threads are all
+        //    recorded intact.
+        //
+        // 2. The records of each thread are recorded in the order in which
+        //    they were published.
+        //
+        // Plan:
+        // 1. Publish a sequence of records from each of several threads to an
+        //    observer whose ring can hold all of them.  Decode the file, and
+        //    verify that every record is present, and that the records of
+        //    each thread are in order.  (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENT PUBLICATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCURRENT PUBLICATION"
+                          << "\n======================" << endl;
+
+        enum { k_NUM_THREADS = 4, k_NUM_RECORDS = 1000 };
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_flightrecorderobserver_");
+        bsl::string              fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "test6.rec");
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        Obj mX(&ta);
+
+        ASSERT(0 == mX.open(fileName, 1024 * 1024));
+
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            PublishThread publisher = { &mX, i, k_NUM_RECORDS };
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i], publisher));
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+        }
+
+        bsl::vector<ball::Record> records(&ta);
+
+        ASSERT(k_NUM_THREADS * k_NUM_RECORDS ==
+                     Util::readFile(fileName,
+                                    bdlf::BindUtil::bind(&saveRecord,
+                                                         &records,
+                                                         _1),
+                                    &ta));
+
+        int next[k_NUM_THREADS] = { 0 };
+
+        for (bsl::size_t i = 0; i < records.size(); ++i) {
+            const ball::RecordAttributes& attributes =
+                                                     records[i].fixedFields();
+
+            const int threadIndex = static_cast<int>(attributes.threadID());
+
+            ASSERTV(threadIndex, 0 <= threadIndex);
+            ASSERTV(threadIndex, threadIndex < k_NUM_THREADS);
+            if (0 > threadIndex || threadIndex >= k_NUM_THREADS) {
+                continue;                                           // CONTINUE
+            }
+
+            ASSERTV(threadIndex, i, next[threadIndex] ==
+                                          bsl::atoi(attributes.message()));
+            ++next[threadIndex];
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // DECODING DAMAGED FILES
+        //
+        // Concerns:
+        // 1. A buffer too short to hold a file header, or whose header is not
+        //    that of a flight recorder file, is rejected.
+        //
+        // 2. A buffer shorter than the capacity recorded in its header is
+        //    rejected.
+        //
+        // 3. Records between the commit and the reserve positions (i.e.,
+        //    records being written when the writing process died) are
+        //    ignored.
+        //
+        // 4. A damaged record is skipped, and the records following it are
+        //    decoded.
+        //
+        // 5. Arbitrarily damaged contents never cause the decoder to read
+        //    outside of the buffer.
+        //
+        // Plan:
+        // 1. Publish records to an observer, and copy its file.  Decode
+        //    modified copies, and verify the number of records decoded.
+        //    (C-1..4)
+        //
+        // 2. Decode copies in which random bytes were overwritten, and verify
+        //    that the number of records decoded does not exceed the number of
+        //    records published.  (C-5)
+        //
+        // Testing:
+        //   int readBuffer(const char *, size_t, const RecordVisitor&, alloc);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nDECODING DAMAGED FILES"
+                          << "\n======================" << endl;
+
+        enum { k_NUM_RECORDS = 20 };
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_flightrecorderobserver_");
+        bsl::string              fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "test5.rec");
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        Obj mX(&ta);
+
+        ASSERT(0 == mX.open(fileName, 8192));
+
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            bsl::ostringstream message;
+            message << "message " << i;
+
+            mX.publish(makeRecord(message.str(),
+                                  "CATEGORY",
+                                  "file.cpp",
+                                  i,
+                                  ball::Severity::e_INFO,
+                                  1,
+                                  &ta),
+                       ball::Context());
+        }
+
+        bsl::vector<char>        original;
+        bsl::vector<bsl::string> messages;
+
+        readContents(&original, fileName);
+
+        ASSERT(k_FILE_HEADER_SIZE + 8192 == original.size());
+        ASSERT(k_NUM_RECORDS == readMessages(&messages, original));
+
+        if (verbose) cout << "\tInvalid headers." << endl;
+        {
+            bsl::vector<char> contents(original);
+
+            ASSERT(0 > Util::readBuffer(contents.data(),
+                                        k_FILE_HEADER_SIZE - 1,
+                                        bdlf::BindUtil::bind(&saveMessage,
+                                                             &messages,
+                                                             _1)));
+
+            ASSERT(0 > Util::readBuffer(contents.data(),
+                                        contents.size() - 1,
+                                        bdlf::BindUtil::bind(&saveMessage,
+                                                             &messages,
+                                                             _1)));
+
+            contents[0] ^= 1;
+            ASSERT(0 > readMessages(&messages, contents));
+
+            contents = original;
+            store(&contents, k_COMMIT_OFFSET,
+                  load(contents, k_RESERVE_OFFSET) + 8);
+            ASSERT(0 > readMessages(&messages, contents));
+        }
+
+        if (verbose) cout << "\tIncomplete records." << endl;
+        {
+            // Move the commit position back to the start of the last record,
+            // as if the process died while the last record was copied.
+
+            bsl::vector<char> contents(original);
+
+            const Uint64 commit = load(contents, k_COMMIT_OFFSET);
+            Uint64       last   = 0;
+            Uint64       position = 0;
+            while (position < commit) {
+                last = position;
+                position += static_cast<unsigned int>(load(
+                                  contents,
+                                  k_FILE_HEADER_SIZE + position) >> 32);
+            }
+            ASSERT(commit == position);
+
+            store(&contents, k_COMMIT_OFFSET, last);
+
+            ASSERT(k_NUM_RECORDS - 1 == readMessages(&messages, contents));
+            ASSERT(k_NUM_RECORDS - 1 == messages.size());
+            ASSERT("message 18"      == messages.back());
+        }
+
+        if (verbose) cout << "\tDamaged records." << endl;
+        {
+            bsl::vector<char> contents(original);
+
+            // Damage the magic number of the first record.
+
+            contents[k_FILE_HEADER_SIZE] ^= 1;
+
+            ASSERT(k_NUM_RECORDS - 1 == readMessages(&messages, contents));
+            ASSERT(k_NUM_RECORDS - 1 == messages.size());
+            ASSERT("message 1"       == messages.front());
+            ASSERT("message 19"      == messages.back());
+        }
+
+        if (verbose) cout << "\tRandomly damaged contents." << endl;
+        {
+            bsl::srand(12345);
+
+            for (int i = 0; i < 1000; ++i) {
+                // Copy into a buffer of the exact size, so that reads outside
+                // of it are caught by memory checkers.
+
+                const bsl::size_t size = original.size();
+                bsl::vector<char> contents(original);
+
+                const int numChanges = 1 + bsl::rand() % 16;
+                for (int j = 0; j < numChanges; ++j) {
+                    const bsl::size_t offset = k_FILE_HEADER_SIZE
+                          + bsl::rand() % (size - k_FILE_HEADER_SIZE);
+                    contents[offset] = static_cast<char>(bsl::rand());
+                }
+
+                const int count = readMessages(&messages, contents);
+                ASSERTV(i, count, 0 <= count && count <= k_NUM_RECORDS);
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // WRAP-AROUND AND TRUNCATION
+        //
+        // Concerns:
+        // 1. When the ring is full, the oldest records are overwritten, and
+        //    the decoded records are the most recent ones, in order, with no
+        //    gap.
+        //
+        // 2. Records are never split across the end of the ring.
+        //
+        // 3. Messages are truncated to fit in a quarter of the ring, and file
+        //    names and categories are truncated to 65535 bytes.
+        //
+        // Plan:
+        // 1. Publish many records of varying lengths to an observer having
+        //    the minimum capacity, decoding the file after each record, and
+        //    verify that the decoded records are a suffix of the published
+        //    ones, which fills at least half of the ring.  (C-1..2)
+        //
+        // 2. Publish records having long fields, and verify the lengths of
+        //    the decoded fields.  (C-3)
+        //
+        // Testing:
+        //   WRAP-AROUND AND TRUNCATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nWRAP-AROUND AND TRUNCATION"
+                          << "\n==========================" << endl;
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_flightrecorderobserver_");
+        bsl::string              fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "test4.rec");
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        if (verbose) cout << "\tWrap-around." << endl;
+        {
+            Obj mX(&ta);
+
+            ASSERT(0 == mX.open(fileName, Obj::k_MIN_CAPACITY));
+
+            bsl::vector<bsl::string> messages;
+            bsl::vector<char>        contents;
+
+            for (int i = 0; i < 500; ++i) {
+                bsl::ostringstream message;
+                message << i << ' ' << bsl::string(i % 97, 'x');
+
+                mX.publish(makeRecord(message.str(),
+                                      "CATEGORY",
+                                      "file.cpp",
+                                      i,
+                                      ball::Severity::e_INFO,
+                                      1,
+                                      &ta),
+                           ball::Context());
+
+                readContents(&contents, fileName);
+
+                const int count = readMessages(&messages, contents);
+
+                ASSERTV(i, count, 0 < count && count <= i + 1);
+                if (0 >= count) {
+                    continue;                                       // CONTINUE
+                }
+
+                bsl::size_t bytes = 0;
+                for (int j = 0; j < count; ++j) {
+                    const int index = i - count + 1 + j;
+
+                    ASSERTV(i, j, index == bsl::atoi(messages[j].c_str()));
+                    const bsl::string::size_type EXP_SIZE =
+                                      index % 97 + 1 + (index < 10  ? 1
+                                                      : index < 100 ? 2
+                                                      :               3);
+
+                    ASSERTV(i, j, EXP_SIZE, messages[j].size(),
+                            EXP_SIZE == messages[j].size());
+
+                    bytes += k_RECORD_HEADER_SIZE + 8 + 8 + messages[j].size();
+                }
+
+                // Once the ring has wrapped around, the records decoded fill
+                // at least half of it (at most a quarter of the ring is lost
+                // to the record being written, and at most a quarter to the
+                // padding at the end of the ring).
+
+                if (count < i + 1) {
+                    ASSERTV(i, bytes, bytes >= Obj::k_MIN_CAPACITY / 2);
+                }
+            }
+        }
+
+        if (verbose) cout << "\tTruncation." << endl;
+        {
+            Obj mX(&ta);
+
+            ASSERT(0 == mX.open(fileName, Obj::k_MIN_CAPACITY));
+
+            const bsl::string longMessage(10000, 'm');
+
+            mX.publish(makeRecord(longMessage,
+                                  "CAT",
+                                  "f.cpp",
+                                  1,
+                                  ball::Severity::e_WARN,
+                                  1,
+                                  &ta),
+                       ball::Context());
+
+            const bsl::string longCategory(10000, 'c');
+
+            mX.publish(makeRecord(longMessage,
+                                  longCategory,
+                                  "f.cpp",
+                                  1,
+                                  ball::Severity::e_WARN,
+                                  1,
+                                  &ta),
+                       ball::Context());
+
+            bsl::vector<ball::Record> records(&ta);
+
+            ASSERT(2 == Util::readFile(fileName,
+                                       bdlf::BindUtil::bind(&saveRecord,
+                                                            &records,
+                                                            _1),
+                                       &ta));
+
+            const bsl::size_t budget = Obj::k_MIN_CAPACITY / 4
+                                                       - k_RECORD_HEADER_SIZE;
+
+            ASSERT(budget - 5 - 3 ==
+                           bsl::strlen(records[0].fixedFields().message()));
+            ASSERT(bsl::string("CAT") == records[0].fixedFields().category());
+
+            ASSERT(0 == bsl::strlen(records[1].fixedFields().message()));
+            ASSERT(budget - 5 ==
+                          bsl::strlen(records[1].fixedFields().category()));
+        }
+        {
+            Obj mX(&ta);
+
+            ASSERT(0 == mX.open(fileName, 1024 * 1024));
+
+            const bsl::string longFileName(100000, 'f');
+
+            mX.publish(makeRecord("message",
+                                  "CAT",
+                                  longFileName,
+                                  1,
+                                  ball::Severity::e_WARN,
+                                  1,
+                                  &ta),
+                       ball::Context());
+
+            bsl::vector<ball::Record> records(&ta);
+
+            ASSERT(1 == Util::readFile(fileName,
+                                       bdlf::BindUtil::bind(&saveRecord,
+                                                            &records,
+                                                            _1),
+                                       &ta));
+
+            ASSERT(65535 == bsl::strlen(records[0].fixedFields().fileName()));
+            ASSERT("message" ==
+                        bsl::string(records[0].fixedFields().message()));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // PUBLISH AND READFILE
+        //
+        // Concerns:
+        // 1. Every fixed field of a published record is decoded.
+        //
+        // 2. Records are decoded in the order in which they were published.
+        //
+        // 3. The records can be decoded while the observer is open (i.e., as
+        //    they would be after the writing process is killed).
+        //
+        // 4. `publish` does not allocate memory.
+        //
+        // 5. `publish` has no effect if the observer is not open.
+        //
+        // 6. `readFile` fails if the file does not exist.
+        //
+        // Plan:
+        // 1. Publish records having distinct field values, decode the file
+        //    while the observer is open, and compare the decoded records
+        //    with the published ones.  Verify that the test allocators
+        //    record no allocation during `publish`.  (C-1..4)
+        //
+        // 2. Close the observer, publish a record, and verify that the file
+        //    is unchanged.  (C-5)
+        //
+        // 3. Call `readFile` on a file that does not exist.  (C-6)
+        //
+        // Testing:
+        //   void publish(const shared_ptr<const Record>&, const Context&);
+        //   int readFile(const string_view&, const RecordVisitor&, alloc);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPUBLISH AND READFILE"
+                          << "\n====================" << endl;
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_flightrecorderobserver_");
+        bsl::string              fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "test3.rec");
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        static const struct {
+            int         d_line;
+            const char *d_message;
+            const char *d_category;
+            const char *d_fileName;
+            int         d_severity;
+        } DATA[] = {
+            { L_, "",             "",          "",         0               },
+            { L_, "a",            "B",         "c.cpp",    32              },
+            { L_, "hello, world", "MY.CAT",    "my.cpp",   64              },
+            { L_, "1234567",      "12345678",  "123456789", 96             },
+            { L_, "embedded\nnl", "X",         "/a/b/c.h", 128             },
+            { L_, "a\0b",         "Y",         "d.cpp",    192             },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        bsl::vector<bsl::shared_ptr<ball::Record> > published(&ta);
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            published.push_back(makeRecord(DATA[i].d_message,
+                                           DATA[i].d_category,
+                                           DATA[i].d_fileName,
+                                           DATA[i].d_line,
+                                           DATA[i].d_severity,
+                                           i,
+                                           &ta));
+            published.back()->fixedFields().setTimestamp(
+                       bdlt::Datetime(2026, 1 + i, 2, 3, 4, 5, 6 * i, 7 * i));
+        }
+
+        Obj mX(&ta);
+
+        ASSERT(0 == mX.open(fileName, 64 * 1024));
+
+        const bsls::Types::Int64 numTestAllocations = ta.numAllocations();
+        const bsls::Types::Int64 numDefaultAllocations = da.numAllocations();
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            mX.publish(published[i], ball::Context());
+        }
+
+        ASSERT(numTestAllocations    == ta.numAllocations());
+        ASSERT(numDefaultAllocations == da.numAllocations());
+
+        bsl::vector<ball::Record> records(&ta);
+
+        ASSERT(NUM_DATA == Util::readFile(fileName,
+                                          bdlf::BindUtil::bind(&saveRecord,
+                                                               &records,
+                                                               _1),
+                                          &ta));
+        ASSERT(NUM_DATA == static_cast<int>(records.size()));
+
+        for (int i = 0; i < NUM_DATA && i < static_cast<int>(records.size());
+             ++i) {
+            const int LINE = DATA[i].d_line;
+
+            const ball::RecordAttributes& EXP = published[i]->fixedFields();
+            const ball::RecordAttributes& X   = records[i].fixedFields();
+
+            if (veryVerbose) {
+                P_(LINE) P(X);
+            }
+
+            ASSERTV(LINE, EXP.timestamp()      == X.timestamp());
+            ASSERTV(LINE, EXP.processID()      == X.processID());
+            ASSERTV(LINE, EXP.threadID()       == X.threadID());
+            ASSERTV(LINE, EXP.kernelThreadID() == X.kernelThreadID());
+            ASSERTV(LINE, bsl::string(EXP.fileName()) == X.fileName());
+            ASSERTV(LINE, EXP.lineNumber()     == X.lineNumber());
+            ASSERTV(LINE, bsl::string(EXP.category()) == X.category());
+            ASSERTV(LINE, EXP.severity()       == X.severity());
+            ASSERTV(LINE, EXP.messageRef()     == X.messageRef());
+        }
+
+        if (verbose) cout << "\tPublishing to a closed observer." << endl;
+        {
+            mX.close();
+
+            mX.publish(published[1], ball::Context());
+
+            bsl::vector<bsl::string> messages(&ta);
+
+            ASSERT(NUM_DATA == Util::readFile(
+                                           fileName,
+                                           bdlf::BindUtil::bind(&saveMessage,
+                                                                &messages,
+                                                                _1),
+                                           &ta));
+        }
+
+        if (verbose) cout << "\tReading a missing file." << endl;
+        {
+            bsl::string missing(tempDirGuard.getTempDirName(), &ta);
+            bdls::PathUtil::appendRaw(&missing, "missing.rec");
+
+            bsl::vector<bsl::string> messages(&ta);
+
+            ASSERT(0 > Util::readFile(missing,
+                                      bdlf::BindUtil::bind(&saveMessage,
+                                                           &messages,
+                                                           _1),
+                                      &ta));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // OPEN, CLOSE, AND ACCESSORS
+        //
+        // Concerns:
+        // 1. A default-constructed observer is not open, and uses the
+        //    specified allocator (or the default allocator).
+        //
+        // 2. `open` creates (or truncates) the file, rounds the capacity up to
+        //    a multiple of 8 no smaller than `k_MIN_CAPACITY`, and sizes the
+        //    file accordingly.
+        //
+        // 3. `open` discards the records of a previously open file.
+        //
+        // 4. `open` fails if the file cannot be created.
+        //
+        // 5. `close` and `sync` may be called whether or not the observer is
+        //    open.
+        //
+        // Plan:
+        // 1. Open observers with various capacities, and verify the state of
+        //    the observer and the size of the file.  (C-1..5)
+        //
+        // Testing:
+        //   FlightRecorderObserver(const allocator_type& allocator = {});
+        //   ~FlightRecorderObserver();
+        //   void close();
+        //   int open(const bsl::string_view& fileName, Uint64 capacity);
+        //   void releaseRecords();
+        //   int sync(bool waitFlag = true);
+        //   Uint64 capacity() const;
+        //   bsl::string fileName() const;
+        //   bool isOpen() const;
+        //   allocator_type get_allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nOPEN, CLOSE, AND ACCESSORS"
+                          << "\n==========================" << endl;
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_flightrecorderobserver_");
+        bsl::string              fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "test2.rec");
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVerbose);
+
+        {
+            bslma::DefaultAllocatorGuard guard(&da);
+
+            const Obj X;
+            ASSERT(&da == X.get_allocator().mechanism());
+        }
+
+        Obj mX(&ta); const Obj& X = mX;
+
+        ASSERT(&ta == X.get_allocator().mechanism());
+        ASSERT(!X.isOpen());
+        ASSERT(0  == X.capacity());
+        ASSERT("" == X.fileName());
+        ASSERT(0  != mX.sync());
+
+        mX.close();
+        mX.releaseRecords();
+
+        static const struct {
+            int    d_line;
+            Uint64 d_capacity;
+            Uint64 d_expected;
+        } DATA[] = {
+            { L_,     0,  Obj::k_MIN_CAPACITY },
+            { L_,     1,  Obj::k_MIN_CAPACITY },
+            { L_,  4095,  Obj::k_MIN_CAPACITY },
+            { L_,  4096,  4096                },
+            { L_,  4097,  4104                },
+            { L_, 10000, 10000                },
+            { L_, 10001, 10008                },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const int    LINE     = DATA[i].d_line;
+            const Uint64 CAPACITY = DATA[i].d_capacity;
+            const Uint64 EXPECTED = DATA[i].d_expected;
+
+            ASSERTV(LINE, 0 == mX.open(fileName, CAPACITY));
+            ASSERTV(LINE, X.isOpen());
+            ASSERTV(LINE, EXPECTED == X.capacity());
+            ASSERTV(LINE, fileName == X.fileName());
+            ASSERTV(LINE, 0 == mX.sync(false));
+            ASSERTV(LINE, 0 == mX.sync());
+
+            ASSERTV(LINE, static_cast<bdls::FilesystemUtil::Offset>(
+                                               k_FILE_HEADER_SIZE + EXPECTED)
+                                 == bdls::FilesystemUtil::getFileSize(
+                                                                    fileName));
+
+            mX.publish(makeRecord("message",
+                                  "CAT",
+                                  "file.cpp",
+                                  LINE,
+                                  ball::Severity::e_INFO,
+                                  1,
+                                  &ta),
+                       ball::Context());
+
+            bsl::vector<bsl::string> messages(&ta);
+
+            ASSERTV(LINE, 1 == Util::readFile(
+                                           fileName,
+                                           bdlf::BindUtil::bind(&saveMessage,
+                                                                &messages,
+                                                                _1),
+                                           &ta));
+
+            if (i % 2) {
+                mX.close();
+
+                ASSERTV(LINE, !X.isOpen());
+                ASSERTV(LINE, 0  == X.capacity());
+                ASSERTV(LINE, "" == X.fileName());
+
+                // The records remain in the file after `close`.
+
+                ASSERTV(LINE, 1 == Util::readFile(
+                                           fileName,
+                                           bdlf::BindUtil::bind(&saveMessage,
+                                                                &messages,
+                                                                _1),
+                                           &ta));
+            }
+        }
+
+        if (verbose) cout << "\tFailure to open." << endl;
+        {
+            bsl::string badName(tempDirGuard.getTempDirName(), &ta);
+            bdls::PathUtil::appendRaw(&badName, "missing");
+            bdls::PathUtil::appendRaw(&badName, "test2.rec");
+
+            ASSERT(0 != mX.open(badName, 4096));
+            ASSERT(!X.isOpen());
+            ASSERT("" == X.fileName());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Open an observer, publish a few records, and decode its file.
+        //    (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_flightrecorderobserver_");
+        bsl::string              fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "test1.rec");
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        Obj mX(&ta);
+
+        ASSERT(0 == mX.open(fileName, 4096));
+        ASSERT(mX.isOpen());
+
+        mX.publish(makeRecord("first", "CAT", "a.cpp", 10,
+                              ball::Severity::e_ERROR, 1, &ta),
+                   ball::Context());
+        mX.publish(makeRecord("second", "CAT", "b.cpp", 20,
+                              ball::Severity::e_DEBUG, 2, &ta),
+                   ball::Context());
+
+        bsl::vector<ball::Record> records(&ta);
+
+        ASSERT(2 == Util::readFile(fileName,
+                                   bdlf::BindUtil::bind(&saveRecord,
+                                                        &records,
+                                                        _1),
+                                   &ta));
+        ASSERT(2 == records.size());
+        ASSERT(bsl::string("first")  == records[0].fixedFields().message());
+        ASSERT(bsl::string("second") == records[1].fixedFields().message());
+        ASSERT(20 == records[1].fixedFields().lineNumber());
+        ASSERT(ball::Severity::e_DEBUG == records[1].fixedFields().severity());
+
+        mX.close();
+        ASSERT(!mX.isOpen());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        // 1. Publishing a record is fast enough to leave a flight recorder
+        //    observer registered at `TRACE` severity.
+        //
+        // Plan:
+        // 1. Publish the same record repeatedly to an observer having a 16 MB
+        //    ring, and report the time per record.  The number of records
+        //    published is given by the second command-line argument
+        //    (default: 1000000).
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        cout << "\nPERFORMANCE TEST"
+             << "\n================" << endl;
+
+        const int NUM_ITERATIONS = argc > 2 && bsl::atoi(argv[2]) > 0
+                                 ? bsl::atoi(argv[2])
+                                 : 1000000;
+
+        bdls::TempDirectoryGuard tempDirGuard("ball_flightrecorderobserver_");
+        bsl::string              fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "perf.rec");
+
+        Obj mX;
+
+        ASSERT(0 == mX.open(fileName, 16 * 1024 * 1024));
+
+        const bsl::shared_ptr<ball::Record> record = makeRecord(
+                        "order 12345 accepted: 100 shares at 101.25 (IOC)",
+                        "EQUITY.ORDERS",
+                        "groups/bal/ball/ball_flightrecorderobserver.t.cpp",
+                        __LINE__,
+                        ball::Severity::e_TRACE,
+                        1,
+                        bslma::Default::defaultAllocator());
+
+        const ball::Context context;
+
+        bsls::Stopwatch timer;
+        timer.start();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            mX.publish(record, context);
+        }
+        timer.stop();
+
+        bsl::vector<bsl::string> messages;
+
+        const int count = Util::readFile(fileName,
+                                         bdlf::BindUtil::bind(&saveMessage,
+                                                              &messages,
+                                                              _1));
+
+        cout << "iterations:           " << NUM_ITERATIONS << endl
+             << "publish (ns per call): "
+             << timer.elapsedTime() * 1e9 / NUM_ITERATIONS << endl
+             << "records in the ring:  " << count << endl;
+      } break;
+      default: {
+        cout << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cout << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
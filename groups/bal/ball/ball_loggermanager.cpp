@@ -420,6 +420,14 @@ void Logger::logMessage(const Category&                category,
                              record.get(),
                              bdlf::PlaceHolders::_1));
 
+    // Render a deferred message now, while the record is not yet shared,
+    // unless the observer renders it on publication.
+
+    if (record->fixedFields().isMessageDeferred()
+     && !d_observer->supportsDeferredMessages()) {
+        record->fixedFields().renderMessage();
+    }
+
     if (levels.recordLevel() >= severity) {
         d_recordBuffer_p->pushBack(record);
     }
@@ -910,6 +918,8 @@ LoggerManager::initSingleton(LoggerManager *singleton, bool adoptSingleton)
 
 void LoggerManager::logMessage(int severity, Record *record)
 {
+    record->fixedFields().renderMessage();
+
     bsl::ostringstream datetimeStream;
     datetimeStream << bdlt::CurrentTime::utc();
 
@@ -1141,7 +1141,10 @@ class Logger {
     /// `severity` is in the range `[1 .. 255]`, both `fileName` and
     /// `message` are null-terminated, and `record` was previously obtained
     /// by a call to `getRecord` on this logger.  Note that `record` will be
-    /// invalid after this method returns.
+    /// invalid after this method returns.  Also note that, if the message of
+    /// `record` is deferred (see `RecordAttributes::isMessageDeferred`), it
+    /// is rendered by this method unless the observer held by this logger
+    /// supports deferred messages.
     void logMessage(const Category&  category,
                     int              severity,
                     Record          *record);
@@ -47,6 +47,12 @@ void Observer::releaseRecords()
 {
 }
 
+// ACCESSORS
+bool Observer::supportsDeferredMessages() const
+{
+    return false;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
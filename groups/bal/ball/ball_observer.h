@@ -17,6 +17,26 @@ BSLS_IDENT("$Id: $")
 // derived from this protocol, receive log records, and process them in a
 // manner defined by the derived class author.
 //
+///Deferred Messages
+///-----------------
+// A log record may carry a *deferred* message: an encoded representation of
+// the message that is rendered into text only when needed (see
+// `ball::RecordAttributes::isMessageDeferred`).  By default, an observer is
+// never supplied a record having a deferred message, as the logger renders the
+// message beforehand.  An observer able to render the message itself, e.g., on
+// a thread other than the logging thread, overrides
+// `supportsDeferredMessages` to return `true`.  Such an observer must not
+// modify the supplied (shared) record; it renders the message into a copy of
+// the record instead.
+//
+// The value returned by `supportsDeferredMessages` may change during the
+// lifetime of an observer (e.g., `ball::BroadcastObserver` reports the
+// combined capability of its currently registered observers), and a caller
+// may act on an answer that is already stale.  Therefore, a caller must treat
+// the value only as a hint for the record at hand, and an observer whose value
+// can change from `true` to `false` must still accept records having a
+// deferred message (e.g., by rendering the message into a copy of the record).
+//
 ///Usage
 ///-----
 // This example shows the definition and use of a simple concrete observer that
@@ -221,6 +241,17 @@ class Observer {
     /// operation should be called if resources underlying the previously
     /// provided shared pointers must be released.
     virtual void releaseRecords();
+
+    // ACCESSORS
+
+    /// Return `true` if this observer can be supplied records having a
+    /// deferred message (see `RecordAttributes::isMessageDeferred`), and
+    /// `false` otherwise.  The value returned may change during the lifetime
+    /// of this observer, so callers must tolerate a stale answer, and an
+    /// observer that has returned `true` must continue to accept records
+    /// having a deferred message (see {Deferred Messages}).  The default
+    /// implementation returns `false`.
+    virtual bool supportsDeferredMessages() const;
 };
 
 }  // close package namespace
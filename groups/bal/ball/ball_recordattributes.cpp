@@ -6,6 +6,8 @@ BSLS_IDENT_RCSID(ball_recordattributes_cpp,"$Id$ $CSID$")
 
 #include <bdlb_print.h>
 
+#include <bdlma_localsequentialallocator.h>
+
 #include <bslma_default.h>
 
 #include <bsls_assert.h>
@@ -32,6 +34,7 @@ RecordAttributes::RecordAttributes(bslma::Allocator *basicAllocator)
 , d_severity(0)
 , d_messageStreamBuf(basicAllocator)
 , d_messageStream(&d_messageStreamBuf)
+, d_messageRenderer_p(0)
 {
 }
 
@@ -54,6 +57,7 @@ RecordAttributes::RecordAttributes(const bdlt::Datetime&    timestamp,
 , d_severity(severity)
 , d_messageStreamBuf(basicAllocator)
 , d_messageStream(&d_messageStreamBuf)
+, d_messageRenderer_p(0)
 {
     setMessage(message);
 }
@@ -78,6 +82,7 @@ RecordAttributes::RecordAttributes(const bdlt::Datetime&    timestamp,
 , d_severity(severity)
 , d_messageStreamBuf(basicAllocator)
 , d_messageStream(&d_messageStreamBuf)
+, d_messageRenderer_p(0)
 {
     setMessage(message);
 }
@@ -94,18 +99,42 @@ RecordAttributes::RecordAttributes(const RecordAttributes&  original,
 , d_severity(original.d_severity)
 , d_messageStreamBuf(basicAllocator)
 , d_messageStream(&d_messageStreamBuf)
+, d_messageRenderer_p(original.d_messageRenderer_p)
 {
     d_messageStreamBuf.pubseekpos(0);
     d_messageStreamBuf.sputn(original.d_messageStreamBuf.data(),
                              original.d_messageStreamBuf.length());
 }
 
+// PRIVATE MANIPULATORS
+void RecordAttributes::renderDeferredMessage()
+{
+    BSLS_ASSERT(d_messageRenderer_p);
+
+    // The encoded representation is copied aside, as the rendered text is
+    // written to the same stream buffer.
+
+    bdlma::LocalSequentialAllocator<k_RENDER_BUFFER_SIZE> allocator(
+                                       d_category.get_allocator().mechanism());
+
+    const bsl::string encoded(d_messageStreamBuf.data(),
+                              d_messageStreamBuf.length(),
+                              &allocator);
+
+    const MessageRenderer renderer = d_messageRenderer_p;
+
+    clearMessage();
+
+    renderer(&d_messageStreamBuf, encoded.data(), encoded.length());
+}
+
 // MANIPULATORS
 void RecordAttributes::setMessage(const bsl::string_view& message)
 {
     d_messageStreamBuf.pubseekpos(0);
     d_messageStreamBuf.sputn(message.data(), message.length());
     resetMessageStreamState();
+    d_messageRenderer_p = 0;
 }
 
 RecordAttributes& RecordAttributes::operator=(const RecordAttributes& rhs)
@@ -123,6 +152,7 @@ RecordAttributes& RecordAttributes::operator=(const RecordAttributes& rhs)
         d_messageStreamBuf.sputn(rhs.d_messageStreamBuf.data(),
                                  rhs.d_messageStreamBuf.length());
         resetMessageStreamState();
+        d_messageRenderer_p = rhs.d_messageRenderer_p;
     }
     return *this;
 }
@@ -270,8 +300,18 @@ bsl::ostream& RecordAttributes::print(bsl::ostream& stream,
     else {
         stream << ' ';
     }
-    bslstl::StringRef message = messageRef();
-    stream.write(message.data(), message.length());
+    if (d_messageRenderer_p) {
+        RecordAttributes rendered(*this,
+                                  d_category.get_allocator().mechanism());
+        rendered.renderMessage();
+
+        bslstl::StringRef message = rendered.messageRef();
+        stream.write(message.data(), message.length());
+    }
+    else {
+        bslstl::StringRef message = messageRef();
+        stream.write(message.data(), message.length());
+    }
 
     if (0 <= spacesPerLevel) {
         stream << '\n';
@@ -298,6 +338,7 @@ bool ball::operator==(const RecordAttributes& lhs, const RecordAttributes& rhs)
            lhs.d_lineNumber == rhs.d_lineNumber &&
            lhs.d_fileName == rhs.d_fileName &&
            lhs.d_category == rhs.d_category &&
+           lhs.d_messageRenderer_p == rhs.d_messageRenderer_p &&
            lhs.messageRef() == rhs.messageRef();
 }
 
@@ -71,6 +71,23 @@ BSLS_IDENT("$Id: $")
 // respective attributes by the default constructor of
 // `ball::RecordAttributes`.
 //
+///Deferred Messages
+///-----------------
+// To move the cost of formatting a message off of the logging thread, the
+// message attribute may hold, instead of text, an encoded representation of
+// the message (typically a format string and the values of its arguments)
+// along with the address of a `MessageRenderer` function able to produce the
+// text from that representation.  Such a *deferred* message is created by
+// writing the encoded representation to `messageStreamBuf` and then calling
+// `setMessageRenderer`; `isMessageDeferred` then returns `true`, and a
+// subsequent call to `renderMessage` replaces the encoded representation with
+// the rendered text.  Note that `messageRef` returns the encoded
+// representation of a deferred message, so `renderMessage` must be called
+// before the message attribute is interpreted as text; the `print` method
+// renders a deferred message on the fly.  Also note that `setMessage`,
+// `clearMessage`, and `renderMessage` all leave the message not deferred.
+// See `ball_deferredfmt` for the facility that creates deferred messages.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -197,11 +214,14 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bsls_assert.h>
 #include <bsls_performancehint.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_ostream.h>
+#include <bsl_streambuf.h>
 #include <bsl_string.h>
 #include <bsl_string_view.h>
 
@@ -230,14 +250,31 @@ namespace ball {
 /// both source and destination) is supported in all cases.
 class RecordAttributes {
 
+  public:
+    // TYPES
+
+    /// `MessageRenderer` is an alias for the type of a function that writes,
+    /// to the specified `output`, the text of a deferred message from its
+    /// encoded representation, having the specified `length`, at the
+    /// specified `data` address.
+    typedef void (*MessageRenderer)(bsl::streambuf *output,
+                                    const char     *data,
+                                    bsl::size_t     length);
+
+  private:
     // PRIVATE TYPES
     typedef bsls::Types::Uint64 Uint64;
 
     // PRIVATE CONSTANTS
     enum {
-        k_RESET_MESSAGE_STREAM_CAPACITY = 256  // maximum capacity above which
+        k_RESET_MESSAGE_STREAM_CAPACITY = 256, // maximum capacity above which
                                                // the message stream is reset
                                                // (and not rewound)
+
+        k_RENDER_BUFFER_SIZE            = 256  // size of the local buffer
+                                               // holding the encoded
+                                               // representation of a deferred
+                                               // message while it is rendered
     };
 
     // DATA
@@ -256,6 +293,10 @@ class RecordAttributes {
     bsl::ostream           d_messageStream;     // stream associated with the
                                                 // message attribute
 
+    MessageRenderer        d_messageRenderer_p; // renderer of the deferred
+                                                // message, or 0 if the
+                                                // message is not deferred
+
     // FRIENDS
     friend bool operator==(const RecordAttributes&, const RecordAttributes&);
 
@@ -267,6 +308,11 @@ class RecordAttributes {
     /// the first place).
     void resetMessageStreamState();
 
+    /// Replace the deferred message attribute of this record attributes
+    /// object with the text rendered from its encoded representation.  The
+    /// behavior is undefined unless the message is deferred.
+    void renderDeferredMessage();
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(RecordAttributes,
@@ -324,7 +370,8 @@ class RecordAttributes {
 
     /// Set the message attribute of this record attributes object to the
     /// empty string.  Resets the objects returned by the `messageStreamBuf`
-    /// and `messageStream` methods.
+    /// and `messageStream` methods.  Note that, after this call, the message
+    /// is not deferred.
     void clearMessage();
 
     /// Return a reference to the modifiable stream buffer associated with
@@ -347,11 +394,27 @@ class RecordAttributes {
     /// the specified `lineNumber`.
     void setLineNumber(int lineNumber);
 
+    /// If the message attribute of this record attributes object is
+    /// deferred, replace it with the text produced by the message renderer
+    /// from the encoded representation held in the message attribute;
+    /// otherwise, this method has no effect.  Resets the objects returned by
+    /// the `messageStreamBuf` and `messageStream` methods if the message is
+    /// deferred.  Note that, after this call, the message is not deferred.
+    void renderMessage();
+
     /// Set the message attribute of this record attributes object to the
     /// specified `message`.  Resets the objects returned by the
-    /// `messageStreamBuf` and `messageStream` methods.
+    /// `messageStreamBuf` and `messageStream` methods.  Note that, after this
+    /// call, the message is not deferred.
     void setMessage(const bsl::string_view& message);
 
+    /// Mark the message attribute of this record attributes object as
+    /// deferred: the current content of the message attribute is the encoded
+    /// representation of the message, which the specified `renderer` is able
+    /// to render into text.  The behavior is undefined unless `renderer` is
+    /// non-null.
+    void setMessageRenderer(MessageRenderer renderer);
+
     /// Set the processID attribute of this record attributes object to the
     /// specified `processID`.
     void setProcessID(int processID);
@@ -380,9 +443,19 @@ class RecordAttributes {
     /// Return the filename attribute of this record attributes object.
     const char *fileName() const;
 
+    /// Return `true` if the message attribute of this record attributes
+    /// object is deferred (i.e., holds an encoded representation of the
+    /// message that must be rendered by `renderMessage` before it can be
+    /// interpreted as text), and `false` otherwise.
+    bool isMessageDeferred() const;
+
     /// Return the line number attribute of this record attributes object.
     int lineNumber() const;
 
+    /// Return the message renderer of the deferred message attribute of this
+    /// record attributes object, or 0 if the message is not deferred.
+    MessageRenderer messageRenderer() const;
+
     /// Return the message attribute of this record attributes object.  Note
     /// that this method will return a truncated message if it contains
     /// embedded null ('\0') characters; see `messageRef` for an alternative
@@ -443,7 +516,8 @@ class RecordAttributes {
 /// Return `true` if the specified `lhs` and `rhs` record attributes objects
 /// have the same value, and `false` otherwise.  Two record attributes
 /// objects have the same value if each respective pair of attributes have
-/// the same value.
+/// the same value, and either both or neither messages are deferred, using
+/// the same message renderer.
 bool operator==(const RecordAttributes& lhs, const RecordAttributes& rhs);
 
 /// Return `true` if the specified `lhs` and `rhs` record attributes objects
@@ -500,6 +574,7 @@ void RecordAttributes::clearMessage()
         d_messageStreamBuf.pubseekpos(0);
     }
     resetMessageStreamState();
+    d_messageRenderer_p = 0;
 }
 
 inline
@@ -514,6 +589,15 @@ bsl::ostream& RecordAttributes::messageStream()
     return d_messageStream;
 }
 
+inline
+void RecordAttributes::renderMessage()
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_messageRenderer_p)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        renderDeferredMessage();
+    }
+}
+
 inline
 void RecordAttributes::setCategory(const bsl::string_view& category)
 {
@@ -532,6 +616,14 @@ void RecordAttributes::setLineNumber(int lineNumber)
     d_lineNumber = lineNumber;
 }
 
+inline
+void RecordAttributes::setMessageRenderer(MessageRenderer renderer)
+{
+    BSLS_ASSERT(renderer);
+
+    d_messageRenderer_p = renderer;
+}
+
 inline
 void RecordAttributes::setProcessID(int processID)
 {
@@ -575,12 +667,24 @@ const char *RecordAttributes::fileName() const
     return d_fileName.c_str();
 }
 
+inline
+bool RecordAttributes::isMessageDeferred() const
+{
+    return 0 != d_messageRenderer_p;
+}
+
 inline
 int RecordAttributes::lineNumber() const
 {
     return d_lineNumber;
 }
 
+inline
+RecordAttributes::MessageRenderer RecordAttributes::messageRenderer() const
+{
+    return d_messageRenderer_p;
+}
+
 inline
 int RecordAttributes::processID() const
 {
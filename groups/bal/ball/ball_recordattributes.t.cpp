@@ -10,6 +10,7 @@
 #include <bdlt_datetimeutil.h>
 #include <bdlt_epochutil.h>
 
+#include <bslma_defaultallocatorguard.h>
 #include <bslma_testallocator.h>
 #include <bslma_testallocatorexception.h>
 
@@ -20,6 +21,7 @@
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
+#include <bsl_cctype.h>       // toupper()
 #include <bsl_cstddef.h>
 #include <bsl_cstdlib.h>      // atoi()
 #include <bsl_cstring.h>      // strlen(), memset(), memcpy(), memcmp()
@@ -91,6 +93,10 @@ using namespace bsl;
 // [ 4] void clearMessage();
 // [ 2] bdlsb::MemOutStreamBuf& messageStreamBuf();
 // [ 2] bsl::ostream& messageStream();
+// [ 7] void renderMessage();
+// [ 7] void setMessageRenderer(MessageRenderer renderer);
+// [ 7] bool isMessageDeferred() const;
+// [ 7] MessageRenderer messageRenderer() const;
 // [ 2] ostream& print(ostream& os, int level = 0, int spl = 4) const;
 //
 // [ 2] bool operator==(const Obj& lhs, const Obj& rhs);
@@ -100,6 +106,7 @@ using namespace bsl;
 // [ 1] BREATHING TEST
 // [ 5] USAGE EXAMPLE 1
 // [ 6] USAGE EXAMPLE 2
+// [ 7] DEFERRED MESSAGES
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -297,6 +304,29 @@ void initRecordAttributes(ball::RecordAttributes&    lhs,
     ASSERT(lhs.timestamp()  == rhs.timestamp);
 }
 
+/// Write to the specified `output` the upper-case version of the specified
+/// `length` characters at the specified `data` address.  Note that this
+/// function has the signature of `ball::RecordAttributes::MessageRenderer`.
+void upperCaseRenderer(bsl::streambuf *output,
+                       const char     *data,
+                       bsl::size_t     length)
+{
+    for (bsl::size_t i = 0; i < length; ++i) {
+        output->sputc(static_cast<char>(bsl::toupper(
+                                       static_cast<unsigned char>(data[i]))));
+    }
+}
+
+/// Write to the specified `output` the specified `length` characters at the
+/// specified `data` address.  Note that this function has the signature of
+/// `ball::RecordAttributes::MessageRenderer`.
+void identityRenderer(bsl::streambuf *output,
+                      const char     *data,
+                      bsl::size_t     length)
+{
+    output->sputn(data, length);
+}
+
 #define EXPLICIT_CONSTRUCTOR(OBJ, ORA, ALLOC)                       \
     Obj OBJ(ORA.timestamp,                                          \
             ORA.processID,                                          \
@@ -332,6 +362,169 @@ int main(int argc, char *argv[])
     bslma::TestAllocator testAllocator(veryVeryVerbose);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING DEFERRED MESSAGES
+        //
+        // Concerns:
+        // 1. By default, and after `setMessage` or `clearMessage`, the
+        //    message is not deferred and `messageRenderer` returns 0.
+        //
+        // 2. After `setMessageRenderer`, the message is deferred,
+        //    `messageRenderer` returns the renderer, and `messageRef` returns
+        //    the encoded representation.
+        //
+        // 3. `renderMessage` replaces the encoded representation with the
+        //    text produced by the renderer, after which the message is not
+        //    deferred; it has no effect on a message that is not deferred.
+        //
+        // 4. Encoded representations larger than the local rendering buffer
+        //    are rendered correctly, without using the default allocator.
+        //
+        // 5. Copy construction and assignment preserve the renderer, and
+        //    `operator==` takes the renderer into account.
+        //
+        // 6. `print` renders a deferred message without modifying the object.
+        //
+        // 7. Streaming into the message after `renderMessage` extends the
+        //    rendered message.
+        //
+        // Plan:
+        // 1. Use test renderers to exercise each manipulator and accessor,
+        //    with encoded representations of various lengths, verifying the
+        //    state of the object after each step.  (C-1..7)
+        //
+        // Testing:
+        //   void renderMessage();
+        //   void setMessageRenderer(MessageRenderer renderer);
+        //   bool isMessageDeferred() const;
+        //   MessageRenderer messageRenderer() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "Testing Deferred Messages" << endl
+                                  << "=========================" << endl;
+
+        bslma::TestAllocator         da(veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        Obj mX(&testAllocator);  const Obj& X = mX;
+
+        ASSERT(!X.isMessageDeferred());
+        ASSERT(0 == X.messageRenderer());
+
+        if (verbose) cout << "\tRendering a deferred message." << endl;
+        {
+            mX.messageStreamBuf().sputn("abc", 3);
+            mX.setMessageRenderer(&upperCaseRenderer);
+
+            ASSERT(X.isMessageDeferred());
+            ASSERT(&upperCaseRenderer == X.messageRenderer());
+            ASSERT("abc" == X.messageRef());
+
+            mX.renderMessage();
+
+            ASSERT(!X.isMessageDeferred());
+            ASSERT(0 == X.messageRenderer());
+            ASSERTV(X.messageRef(), "ABC" == X.messageRef());
+
+            mX.renderMessage();
+
+            ASSERTV(X.messageRef(), "ABC" == X.messageRef());
+
+            mX.messageStream() << "-def";
+
+            ASSERTV(X.messageRef(), "ABC-def" == X.messageRef());
+        }
+
+        if (verbose) cout << "\tResetting a deferred message." << endl;
+        {
+            mX.clearMessage();
+            mX.messageStreamBuf().sputn("abc", 3);
+            mX.setMessageRenderer(&upperCaseRenderer);
+            mX.setMessage("xyz");
+
+            ASSERT(!X.isMessageDeferred());
+            ASSERT("xyz" == X.messageRef());
+
+            mX.messageStreamBuf().sputn("abc", 3);
+            mX.setMessageRenderer(&upperCaseRenderer);
+            mX.clearMessage();
+
+            ASSERT(!X.isMessageDeferred());
+            ASSERT(0 == X.messageRef().length());
+        }
+
+        if (verbose) cout << "\tRendering large messages." << endl;
+        {
+            const bsl::size_t LENGTHS[] = { 0, 1, 255, 256, 257, 1000, 5000 };
+            const bsl::size_t NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+            for (bsl::size_t i = 0; i < NUM_LENGTHS; ++i) {
+                const bsl::size_t LENGTH = LENGTHS[i];
+
+                const bsl::string INPUT(LENGTH, 'q', &testAllocator);
+                const bsl::string EXPECTED(LENGTH, 'Q', &testAllocator);
+
+                mX.clearMessage();
+                mX.messageStreamBuf().sputn(INPUT.data(), LENGTH);
+                mX.setMessageRenderer(&upperCaseRenderer);
+                mX.renderMessage();
+
+                ASSERTV(LENGTH, X.messageRef().length(),
+                        EXPECTED == X.messageRef());
+            }
+        }
+
+        if (verbose) cout << "\tCopying and comparing." << endl;
+        {
+            mX.clearMessage();
+            mX.messageStreamBuf().sputn("abc", 3);
+            mX.setMessageRenderer(&upperCaseRenderer);
+
+            Obj mY(X, &testAllocator);  const Obj& Y = mY;
+
+            ASSERT(Y.isMessageDeferred());
+            ASSERT(&upperCaseRenderer == Y.messageRenderer());
+            ASSERT(X == Y);
+
+            Obj mZ(&testAllocator);  const Obj& Z = mZ;
+
+            mZ = X;
+
+            ASSERT(&upperCaseRenderer == Z.messageRenderer());
+            ASSERT(X == Z);
+
+            mZ.setMessageRenderer(&identityRenderer);
+
+            ASSERT(X != Z);
+
+            mZ.renderMessage();
+
+            ASSERT(X != Z);
+            ASSERT("abc" == Z.messageRef());
+
+            mY.renderMessage();
+
+            ASSERT(X != Y);
+            ASSERT("ABC" == Y.messageRef());
+        }
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+        if (verbose) cout << "\tPrinting a deferred message." << endl;
+        {
+            mX.clearMessage();
+            mX.messageStreamBuf().sputn("abc", 3);
+            mX.setMessageRenderer(&upperCaseRenderer);
+
+            bsl::ostringstream oss(&testAllocator);
+            X.print(oss);
+
+            ASSERTV(oss.str(), bsl::string::npos != oss.str().find("ABC"));
+            ASSERT(X.isMessageDeferred());
+            ASSERT("abc" == X.messageRef());
+        }
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 2
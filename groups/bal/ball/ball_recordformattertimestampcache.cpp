@@ -0,0 +1,226 @@
+// ball_recordformattertimestampcache.cpp                             -*-C++-*-
+#include <ball_recordformattertimestampcache.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_recordformattertimestampcache_cpp,"$Id$ $CSID$")
+
+#include <bdlt_date.h>
+#include <bdlt_datetimetz.h>
+#include <bdlt_iso8601util.h>
+#include <bdlt_iso8601utilconfiguration.h>
+#include <bdlt_time.h>
+
+#include <bsls_assert.h>
+#include <bsls_keyword.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstring.h>
+#include <bsl_c_stdio.h>   // for 'snprintf'
+
+namespace BloombergLP {
+namespace ball {
+namespace {
+
+typedef RecordFormatterTimestampCache Cache;
+
+/// This `struct` holds the text of the most recently rendered second in one
+/// format and precision.  A zero-initialized object holds no text, so objects
+/// of this type can be declared thread-local without a constructor.
+struct CacheEntry {
+    bsls::Types::Int64 d_secondPlusOne;   // one plus the second (since
+                                          // 0001/01/01) of `d_text`, or 0 if
+                                          // this entry is empty
+
+    int                d_offset;          // offset (in minutes) of `d_text`
+
+    int                d_fractionIndex;   // index of the first
+                                          // fractional-second digit in
+                                          // `d_text`
+
+    int                d_length;          // length of `d_text`
+
+    char               d_text[Cache::k_MAX_LENGTH];
+                                          // text of the cached second
+};
+
+enum {
+    k_NUM_PRECISIONS = 3,                         // 0, 3, and 6 digits
+
+    k_NUM_ENTRIES    = (Cache::e_ISO_8601 + 1) * k_NUM_PRECISIONS
+};
+
+// The cached text of the calling thread, indexed by format and precision, so
+// that the (possibly shared) `Cache` objects are never modified.
+
+BSLS_KEYWORD_THREAD_LOCAL CacheEntry t_entries[k_NUM_ENTRIES];
+
+/// Render into the specified `entry` the specified `timestamp`, truncated to
+/// the second, having the specified `offsetInMinutes`, in the specified
+/// `format` with the specified `precision` fractional-second digits.
+void fillEntry(CacheEntry            *entry,
+               Cache::Format          format,
+               int                    precision,
+               const bdlt::Datetime&  timestamp,
+               int                    offsetInMinutes)
+{
+    const bdlt::Datetime second(timestamp.date(),
+                                bdlt::Time(timestamp.hour(),
+                                           timestamp.minute(),
+                                           timestamp.second()));
+
+    char *text   = entry->d_text;
+    int   length = 0;
+
+    switch (format) {
+      case Cache::e_BDE_PRINT: {
+        length = second.printToBuffer(text, Cache::k_MAX_LENGTH, precision);
+      } break;
+      case Cache::e_BDE_PRINT_TZ_OFFSET: {
+        length = second.printToBuffer(text, Cache::k_MAX_LENGTH, precision);
+
+        const char sign    = offsetInMinutes < 0 ? '-' : '+';
+        const int  minutes = offsetInMinutes < 0 ? -offsetInMinutes
+                                                 :  offsetInMinutes;
+        const int  hours   = minutes / 60;
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#define snprintf _snprintf
+#endif
+
+        // Although an offset greater than 24 hours is undefined behavior,
+        // such invalid 'DatetimeTz' objects still can be created under
+        // certain circumstances.  We want to enable clients to detect these
+        // errors as quickly as possible (DRQS 12693813).
+
+        if (hours < 100) {
+            length += snprintf(text + length,
+                               Cache::k_MAX_LENGTH - length,
+                               "%c%02d%02d",
+                               sign,
+                               hours,
+                               minutes % 60);
+        }
+        else {
+            length += snprintf(text + length,
+                               Cache::k_MAX_LENGTH - length,
+                               "%cXX%02d",
+                               sign,
+                               minutes % 60);
+        }
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#undef snprintf
+#endif
+      } break;
+      case Cache::e_ISO_8601: {
+        bdlt::Iso8601UtilConfiguration config;
+
+        config.setFractionalSecondPrecision(precision);
+        config.setUseZAbbreviationForUtc(true);
+
+        length = bdlt::Iso8601Util::generateRaw(
+                                   text,
+                                   bdlt::DatetimeTz(second, offsetInMinutes),
+                                   config);
+      } break;
+    }
+
+    BSLS_ASSERT(0 < length && length < Cache::k_MAX_LENGTH);
+
+    entry->d_length        = length;
+    entry->d_fractionIndex = 0;
+    if (precision) {
+        const char *decimalSign = static_cast<const char *>(
+                                               bsl::memchr(text, '.', length));
+        BSLS_ASSERT(decimalSign);
+
+        entry->d_fractionIndex = static_cast<int>(decimalSign - text) + 1;
+    }
+}
+
+}  // close unnamed namespace
+
+                    // -----------------------------------
+                    // class RecordFormatterTimestampCache
+                    // -----------------------------------
+
+// CREATORS
+RecordFormatterTimestampCache::RecordFormatterTimestampCache(
+                                         Format format,
+                                         int    fractionalSecondPrecision)
+: d_format(format)
+, d_precision(fractionalSecondPrecision)
+{
+    BSLS_ASSERT(0 == fractionalSecondPrecision
+             || 3 == fractionalSecondPrecision
+             || 6 == fractionalSecondPrecision);
+}
+
+// ACCESSORS
+int RecordFormatterTimestampCache::generate(
+                                 char                  *result,
+                                 const bdlt::Datetime&  timestamp,
+                                 int                    offsetInMinutes) const
+{
+    BSLS_ASSERT(result);
+
+    static const bdlt::Date k_FIRST_DATE(1, 1, 1);
+
+    const bsls::Types::Int64 days   = timestamp.date() - k_FIRST_DATE;
+    const bsls::Types::Int64 second = days * 86400
+                                    + timestamp.hour() * 3600
+                                    + timestamp.minute() * 60
+                                    + timestamp.second();
+
+    CacheEntry& entry =
+                     t_entries[d_format * k_NUM_PRECISIONS + d_precision / 3];
+
+    if (second + 1 != entry.d_secondPlusOne
+     || offsetInMinutes != entry.d_offset) {
+        fillEntry(&entry, d_format, d_precision, timestamp, offsetInMinutes);
+
+        entry.d_secondPlusOne = second + 1;
+        entry.d_offset        = offsetInMinutes;
+    }
+
+    bsl::memcpy(result, entry.d_text, entry.d_length);
+
+    if (d_precision) {
+        // Overwrite the (zero) fractional-second digits of the cached text,
+        // from the least significant.
+
+        int fraction = timestamp.millisecond();
+        if (6 == d_precision) {
+            fraction = fraction * 1000 + timestamp.microsecond();
+        }
+
+        for (char *digit = result + entry.d_fractionIndex + d_precision - 1;
+             digit >= result + entry.d_fractionIndex;
+             --digit) {
+            *digit    = static_cast<char>('0' + fraction % 10);
+            fraction /= 10;
+        }
+    }
+
+    return entry.d_length;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,212 @@
+// ball_recordformattertimestampcache.h                               -*-C++-*-
+#ifndef INCLUDED_BALL_RECORDFORMATTERTIMESTAMPCACHE
+#define INCLUDED_BALL_RECORDFORMATTERTIMESTAMPCACHE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a per-second cache for rendering log record timestamps.
+//
+//@CLASSES:
+//  ball::RecordFormatterTimestampCache: renderer of timestamps, caching text
+//
+//@SEE_ALSO: ball_recordstringformatter, ball_recordjsonformatter
+//
+//@DESCRIPTION: This component provides a mechanism,
+// `ball::RecordFormatterTimestampCache`, that renders `bdlt::Datetime` values
+// (typically log record timestamps) as text in one of the formats used by the
+// `ball` record formatters, and that caches, per thread, the text of the most
+// recently rendered second.  Log records are typically published in bursts,
+// and many consecutive records share the same second; for such records only
+// the fractional-second digits are formatted, and the rest of the text (date,
+// time of day, and time-zone offset) is copied from the cache.  The text
+// produced is identical to that produced by the `bdlt` facilities named in
+// the table below:
+// ```
+// +-----------------------+-------------------------------+-----------------+
+// | Format                | Example (3 fractional digits) | Generated like  |
+// +=======================+===============================+=================+
+// | e_BDE_PRINT           | 15JAN2024_12:00:59.999        | printToBuffer   |
+// +-----------------------+-------------------------------+-----------------+
+// | e_BDE_PRINT_TZ_OFFSET | 15JAN2024_12:00:59.999-0530   | printToBuffer   |
+// +-----------------------+-------------------------------+-----------------+
+// | e_ISO_8601            | 2024-01-15T12:00:59.999-05:30 | Iso8601Util     |
+// +-----------------------+-------------------------------+-----------------+
+// ```
+// The number of fractional-second digits is 0, 3, or 6, and fractional
+// seconds are truncated (not rounded).  Note that a zero offset is rendered
+// as "Z" in the `e_ISO_8601` format, and as "+0000" in the
+// `e_BDE_PRINT_TZ_OFFSET` format.
+//
+///Thread Safety
+///-------------
+// `ball::RecordFormatterTimestampCache` is *const* *thread-safe*, meaning
+// that accessors may be invoked concurrently from different threads, but it
+// is not safe to access or modify an object while it is being modified in
+// another thread.  Note that `generate` is an accessor: the cached text is
+// not held by the object, but in thread-local storage shared by all objects
+// having the same format and precision, so a single object can render
+// timestamps concurrently in several threads (as the `ball` record formatters
+// do from their `const` function-call operators).
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Rendering Timestamps
+///- - - - - - - - - - - - - - - -
+// First, we create a cache that renders timestamps in the ISO 8601 format
+// with millisecond precision:
+// ```
+// typedef ball::RecordFormatterTimestampCache Cache;
+//
+// Cache cache(Cache::e_ISO_8601, 3);
+// ```
+// Then, we render a timestamp having a time-zone offset of -5 hours:
+// ```
+// char           buffer[Cache::k_MAX_LENGTH];
+// bdlt::Datetime timestamp(2024, 1, 15, 12, 0, 59, 123);
+//
+// int length = cache.generate(buffer, timestamp, -300);
+//
+// assert("2024-01-15T12:00:59.123-05:00" ==
+//                                          bsl::string_view(buffer, length));
+// ```
+// Finally, we render a timestamp within the same second.  This time only the
+// fractional-second digits are formatted:
+// ```
+// timestamp.setMillisecond(456);
+//
+// length = cache.generate(buffer, timestamp, -300);
+//
+// assert("2024-01-15T12:00:59.456-05:00" ==
+//                                          bsl::string_view(buffer, length));
+// ```
+
+#include <balscm_version.h>
+
+#include <bdlt_datetime.h>
+
+namespace BloombergLP {
+namespace ball {
+
+                    // ===================================
+                    // class RecordFormatterTimestampCache
+                    // ===================================
+
+/// This mechanism class renders timestamps in a format and a fractional
+/// second precision fixed at construction, using a thread-local cache of the
+/// text of the most recently rendered second.
+class RecordFormatterTimestampCache {
+
+  public:
+    // TYPES
+    enum Format {
+        // Enumeration used to distinguish among the supported formats.
+
+        e_BDE_PRINT           = 0,  // `bdlt::Datetime::printToBuffer`
+
+        e_BDE_PRINT_TZ_OFFSET = 1,  // `e_BDE_PRINT` followed by the offset
+                                    // formatted as "+hhmm"
+
+        e_ISO_8601            = 2   // `bdlt::Iso8601Util`, using "Z" for a
+                                    // zero offset
+    };
+
+    enum {
+        k_MAX_LENGTH = 48  // maximum number of characters written by
+                           // `generate` (no null terminator is written)
+    };
+
+  private:
+    // DATA
+    Format             d_format;          // rendering format
+
+    int                d_precision;       // number of fractional-second
+                                          // digits (0, 3, or 6)
+
+  public:
+    // CREATORS
+
+    /// Create a timestamp cache rendering in the specified `format` with
+    /// the specified `fractionalSecondPrecision` digits.  The behavior is
+    /// undefined unless `fractionalSecondPrecision` is 0, 3, or 6.
+    RecordFormatterTimestampCache(Format format,
+                                  int    fractionalSecondPrecision);
+
+    //! RecordFormatterTimestampCache(
+    //!                   const RecordFormatterTimestampCache& original) =
+    //!                                                               default;
+    //! ~RecordFormatterTimestampCache() = default;
+
+    // MANIPULATORS
+
+    //! RecordFormatterTimestampCache& operator=(
+    //!                     const RecordFormatterTimestampCache& rhs) =
+    //!                                                               default;
+
+    // ACCESSORS
+
+    /// Write to the specified `result` the text of the specified
+    /// `timestamp`, labeled with the specified `offsetInMinutes` time-zone
+    /// offset, in the format and precision of this object, and return the
+    /// number of characters written.  No null terminator is written.  Note
+    /// that `timestamp` is rendered as is: it should already have been
+    /// adjusted by `offsetInMinutes`.  Also note that this method updates
+    /// only the cache of the calling thread.  The behavior is undefined
+    /// unless `result` can hold `k_MAX_LENGTH` characters, and
+    /// `-1440 < offsetInMinutes < 1440` if `e_ISO_8601 == format()`.
+    int generate(char                  *result,
+                 const bdlt::Datetime&  timestamp,
+                 int                    offsetInMinutes) const;
+
+    /// Return the format in which this object renders timestamps.
+    Format format() const;
+
+    /// Return the number of fractional-second digits that this object
+    /// renders.
+    int fractionalSecondPrecision() const;
+};
+
+// ============================================================================
+//                          INLINE DEFINITIONS
+// ============================================================================
+
+                    // -----------------------------------
+                    // class RecordFormatterTimestampCache
+                    // -----------------------------------
+
+// ACCESSORS
+inline
+RecordFormatterTimestampCache::Format
+RecordFormatterTimestampCache::format() const
+{
+    return d_format;
+}
+
+inline
+int RecordFormatterTimestampCache::fractionalSecondPrecision() const
+{
+    return d_precision;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
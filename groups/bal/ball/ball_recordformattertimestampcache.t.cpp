@@ -0,0 +1,677 @@
+// ball_recordformattertimestampcache.t.cpp                           -*-C++-*-
+#include <ball_recordformattertimestampcache.h>
+
+#include <bdlt_date.h>
+#include <bdlt_datetime.h>
+#include <bdlt_datetimeinterval.h>
+#include <bdlt_datetimetz.h>
+#include <bdlt_iso8601util.h>
+#include <bdlt_iso8601utilconfiguration.h>
+
+#include <bslim_testutil.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a mechanism whose only manipulator, `generate`,
+// renders a timestamp.  The output of `generate` is compared against a
+// reference rendering computed directly with the `bdlt` facilities, for
+// sequences of timestamps chosen so that every call either hits or misses the
+// cache, in every format and precision.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] RecordFormatterTimestampCache(Format format, int precision);
+//
+// ACCESSORS
+// [ 3] int generate(char *result, const Datetime& timestamp, int offset);
+// [ 2] Format format() const;
+// [ 2] int fractionalSecondPrecision() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCURRENT RENDERING
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef ball::RecordFormatterTimestampCache Obj;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// Return the rendering of the specified `timestamp` having the specified
+/// `offsetInMinutes` in the specified `format` with the specified
+/// `precision`, computed without any caching.
+bsl::string referenceRendering(Obj::Format           format,
+                               int                   precision,
+                               const bdlt::Datetime& timestamp,
+                               int                   offsetInMinutes)
+{
+    char buffer[64];
+    int  length = 0;
+
+    switch (format) {
+      case Obj::e_BDE_PRINT: {
+        length = timestamp.printToBuffer(buffer, sizeof buffer, precision);
+      } break;
+      case Obj::e_BDE_PRINT_TZ_OFFSET: {
+        length = timestamp.printToBuffer(buffer, sizeof buffer, precision);
+
+        const int minutes = offsetInMinutes < 0 ? -offsetInMinutes
+                                                :  offsetInMinutes;
+
+        length += bsl::sprintf(buffer + length,
+                               "%c%02d%02d",
+                               offsetInMinutes < 0 ? '-' : '+',
+                               minutes / 60,
+                               minutes % 60);
+      } break;
+      case Obj::e_ISO_8601: {
+        bdlt::Iso8601UtilConfiguration config;
+
+        config.setFractionalSecondPrecision(precision);
+        config.setUseZAbbreviationForUtc(true);
+
+        length = bdlt::Iso8601Util::generateRaw(
+                                 buffer,
+                                 bdlt::DatetimeTz(timestamp, offsetInMinutes),
+                                 config);
+      } break;
+    }
+
+    return bsl::string(buffer, length);
+}
+
+                            // ==================
+                            // class RenderThread
+                            // ==================
+
+/// This functor renders, with a (shared) timestamp cache, timestamps in a
+/// range of seconds distinct from that of every other thread, and counts the
+/// renderings that differ from `referenceRendering`.
+class RenderThread {
+
+    // DATA
+    const Obj       *d_cache_p;      // shared cache (held, not owned)
+    int              d_threadIndex;  // selects the seconds rendered
+    bsls::AtomicInt *d_numErrors_p;  // number of incorrect renderings
+
+  public:
+    // CREATORS
+
+    /// Create a functor rendering timestamps with the specified `cache` in
+    /// the seconds selected by the specified `threadIndex`, and counting
+    /// incorrect renderings in the specified `numErrors`.
+    RenderThread(const Obj       *cache,
+                 int              threadIndex,
+                 bsls::AtomicInt *numErrors)
+    : d_cache_p(cache)
+    , d_threadIndex(threadIndex)
+    , d_numErrors_p(numErrors)
+    {
+    }
+
+    // ACCESSORS
+
+    /// Render the timestamps of this thread and count the errors.
+    void operator()() const
+    {
+        const int k_NUM_SECONDS = 50;
+        const int k_NUM_REPEATS = 20;
+
+        const int OFFSET = d_threadIndex * 30;
+
+        for (int si = 0; si < k_NUM_SECONDS; ++si) {
+            const bdlt::Datetime SECOND(2024,
+                                        1 + d_threadIndex,
+                                        15,
+                                        12,
+                                        0,
+                                        si);
+
+            for (int ri = 0; ri < k_NUM_REPEATS; ++ri) {
+                bdlt::Datetime timestamp(SECOND);
+                timestamp.addMicroseconds(ri * 1001);
+
+                const bsl::string EXP = referenceRendering(
+                                       d_cache_p->format(),
+                                       d_cache_p->fractionalSecondPrecision(),
+                                       timestamp,
+                                       OFFSET);
+
+                char      buffer[Obj::k_MAX_LENGTH];
+                const int length = d_cache_p->generate(buffer,
+                                                       timestamp,
+                                                       OFFSET);
+
+                if (EXP != bsl::string_view(buffer, length)) {
+                    ++*d_numErrors_p;
+                }
+            }
+        }
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                          << "\n=============" << endl;
+
+///Example 1: Rendering Timestamps
+///- - - - - - - - - - - - - - - -
+// First, we create a cache that renders timestamps in the ISO 8601 format
+// with millisecond precision:
+// ```
+        typedef ball::RecordFormatterTimestampCache Cache;
+
+        Cache cache(Cache::e_ISO_8601, 3);
+// ```
+// Then, we render a timestamp having a time-zone offset of -5 hours:
+// ```
+        char           buffer[Cache::k_MAX_LENGTH];
+        bdlt::Datetime timestamp(2024, 1, 15, 12, 0, 59, 123);
+
+        int length = cache.generate(buffer, timestamp, -300);
+
+        ASSERT("2024-01-15T12:00:59.123-05:00" ==
+                                             bsl::string_view(buffer, length));
+// ```
+// Finally, we render a timestamp within the same second.  This time only the
+// fractional-second digits are formatted:
+// ```
+        timestamp.setMillisecond(456);
+
+        length = cache.generate(buffer, timestamp, -300);
+
+        ASSERT("2024-01-15T12:00:59.456-05:00" ==
+                                             bsl::string_view(buffer, length));
+// ```
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENT RENDERING
+        //
+        // Concerns:
+        // 1. A single object can render timestamps concurrently from several
+        //    threads, each rendering seconds (and offsets) that differ from
+        //    those of the other threads.
+        //
+        // Plan:
+        // 1. For each format, create one object having millisecond precision
+        //    and start several threads, each rendering a distinct range of
+        //    timestamps with that object, and verify that every rendering
+        //    matches `referenceRendering`.  (C-1)
+        //
+        // Testing:
+        //   CONCURRENT RENDERING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCURRENT RENDERING"
+                          << "\n====================" << endl;
+
+        static const Obj::Format FORMATS[] = {
+            Obj::e_BDE_PRINT,
+            Obj::e_BDE_PRINT_TZ_OFFSET,
+            Obj::e_ISO_8601
+        };
+        const int NUM_FORMATS = static_cast<int>(sizeof FORMATS
+                                                 / sizeof *FORMATS);
+
+        enum { k_NUM_THREADS = 8 };
+
+        for (int fi = 0; fi < NUM_FORMATS; ++fi) {
+            const Obj::Format FORMAT = FORMATS[fi];
+
+            if (veryVerbose) { T_ P(FORMAT) }
+
+            const Obj       X(FORMAT, 3);
+            bsls::AtomicInt numErrors(0);
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+            for (int ti = 0; ti < k_NUM_THREADS; ++ti) {
+                ASSERTV(FORMAT, ti, 0 == bslmt::ThreadUtil::create(
+                                                   &handles[ti],
+                                                   RenderThread(&X,
+                                                                ti,
+                                                                &numErrors)));
+            }
+            for (int ti = 0; ti < k_NUM_THREADS; ++ti) {
+                ASSERTV(FORMAT, ti, 0 == bslmt::ThreadUtil::join(handles[ti]));
+            }
+
+            ASSERTV(FORMAT, numErrors, 0 == numErrors);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING `generate`
+        //
+        // Concerns:
+        // 1. `generate` renders the same text as the corresponding `bdlt`
+        //    facility, in every format and precision.
+        //
+        // 2. Fractional seconds are truncated, including values that would
+        //    carry into the next second if rounded.
+        //
+        // 3. The cached text is reused only for the same second and offset:
+        //    a change of either (in either direction) is rendered correctly.
+        //
+        // 4. No null terminator is written.
+        //
+        // Plan:
+        // 1. For each format and precision, render a sequence of timestamps
+        //    and offsets chosen to hit and miss the cache, and compare each
+        //    result with `referenceRendering`.  (C-1..3)
+        //
+        // 2. Fill the output buffer with a sentinel before each call, and
+        //    verify the character following the output is unchanged.  (C-4)
+        //
+        // Testing:
+        //   int generate(char *result, const Datetime& timestamp, int offset);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING `generate`"
+                          << "\n==================" << endl;
+
+        static const struct {
+            int d_line;
+            int d_year;
+            int d_month;
+            int d_day;
+            int d_hour;
+            int d_minute;
+            int d_second;
+            int d_millisecond;
+            int d_microsecond;
+            int d_offset;
+        } DATA[] = {
+            //LINE  YEAR  MO  DAY  HR  MIN  SEC  MSEC  USEC  OFFSET
+            //----  ----  --  ---  --  ---  ---  ----  ----  ------
+            { L_,   2024,  1,  15, 12,   0,  59,    0,    0,      0 },
+            { L_,   2024,  1,  15, 12,   0,  59,    1,    2,      0 },
+            { L_,   2024,  1,  15, 12,   0,  59,  999,  999,      0 },
+            { L_,   2024,  1,  15, 12,   1,   0,    0,    0,      0 },
+            { L_,   2024,  1,  15, 12,   1,   0,   50,    7,      0 },
+            { L_,   2024,  1,  15, 12,   1,   0,   50,    7,    -330 },
+            { L_,   2024,  1,  15, 12,   1,   0,   51,    0,    -330 },
+            { L_,   2024,  1,  15, 12,   1,   0,   52,    0,      60 },
+            { L_,   2024,  1,  15, 12,   0,  59,  500,  500,     60 },
+            { L_,   2024,  1,  15, 23,  59,  59,  999,  999,     60 },
+            { L_,   2024,  1,  16,  0,   0,   0,    0,    1,     60 },
+            { L_,   2023,  1,  16,  0,   0,   0,    0,    1,     60 },
+            { L_,   2024, 12,  31, 23,  59,  59,  123,  456,   1439 },
+            { L_,   2025,  1,   1,  0,   0,   0,  123,  456,  -1439 },
+            { L_,      1,  1,   1,  0,   0,   0,    0,    0,      0 },
+            { L_,      1,  1,   1,  0,   0,   0,    0,    1,      0 },
+            { L_,   9999, 12,  31, 23,  59,  59,  999,  999,      0 },
+            { L_,   9999, 12,  31, 23,  59,  59,    0,    0,      0 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        static const Obj::Format FORMATS[] = {
+            Obj::e_BDE_PRINT,
+            Obj::e_BDE_PRINT_TZ_OFFSET,
+            Obj::e_ISO_8601
+        };
+        const int NUM_FORMATS = static_cast<int>(sizeof FORMATS
+                                                 / sizeof *FORMATS);
+
+        static const int PRECISIONS[] = { 0, 3, 6 };
+        const int NUM_PRECISIONS = static_cast<int>(sizeof PRECISIONS
+                                                    / sizeof *PRECISIONS);
+
+        for (int fi = 0; fi < NUM_FORMATS; ++fi) {
+            const Obj::Format FORMAT = FORMATS[fi];
+
+            for (int pi = 0; pi < NUM_PRECISIONS; ++pi) {
+                const int PRECISION = PRECISIONS[pi];
+
+                if (veryVerbose) { T_ P_(FORMAT) P(PRECISION) }
+
+                Obj mX(FORMAT, PRECISION);
+
+                for (int ti = 0; ti < NUM_DATA; ++ti) {
+                    const int LINE = DATA[ti].d_line;
+
+                    const bdlt::Datetime TIMESTAMP(DATA[ti].d_year,
+                                                   DATA[ti].d_month,
+                                                   DATA[ti].d_day,
+                                                   DATA[ti].d_hour,
+                                                   DATA[ti].d_minute,
+                                                   DATA[ti].d_second,
+                                                   DATA[ti].d_millisecond,
+                                                   DATA[ti].d_microsecond);
+                    const int OFFSET = DATA[ti].d_offset;
+
+                    const bsl::string EXP = referenceRendering(FORMAT,
+                                                               PRECISION,
+                                                               TIMESTAMP,
+                                                               OFFSET);
+
+                    // Render each timestamp twice: the second call always
+                    // hits the cache.
+
+                    for (int ri = 0; ri < 2; ++ri) {
+                        char buffer[Obj::k_MAX_LENGTH + 1];
+                        bsl::memset(buffer, '#', sizeof buffer);
+
+                        const int length = mX.generate(buffer,
+                                                       TIMESTAMP,
+                                                       OFFSET);
+
+                        ASSERTV(LINE, FORMAT, PRECISION, ri, length,
+                                0 < length && length <= Obj::k_MAX_LENGTH);
+
+                        const bsl::string_view RESULT(buffer, length);
+
+                        ASSERTV(LINE, FORMAT, PRECISION, ri, EXP, RESULT,
+                                EXP == RESULT);
+                        ASSERTV(LINE, FORMAT, PRECISION, ri,
+                                '#' == buffer[length]);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj            mX(Obj::e_BDE_PRINT, 3);
+            char           buffer[Obj::k_MAX_LENGTH];
+            bdlt::Datetime timestamp(2024, 1, 15);
+
+            ASSERT_PASS(mX.generate(buffer, timestamp, 0));
+            ASSERT_FAIL(mX.generate(0,      timestamp, 0));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATOR AND ACCESSORS
+        //
+        // Concerns:
+        // 1. The constructor sets the format and precision, which the
+        //    accessors return.
+        //
+        // 2. The constructor asserts on an invalid precision.
+        //
+        // Plan:
+        // 1. Construct an object for each format and valid precision, and
+        //    verify the accessors.  (C-1)
+        //
+        // 2. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid precisions.  (C-2)
+        //
+        // Testing:
+        //   RecordFormatterTimestampCache(Format format, int precision);
+        //   Format format() const;
+        //   int fractionalSecondPrecision() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCREATOR AND ACCESSORS"
+                          << "\n=====================" << endl;
+
+        static const Obj::Format FORMATS[] = {
+            Obj::e_BDE_PRINT,
+            Obj::e_BDE_PRINT_TZ_OFFSET,
+            Obj::e_ISO_8601
+        };
+
+        for (int fi = 0; fi < 3; ++fi) {
+            for (int precision = 0; precision <= 6; precision += 3) {
+                const Obj X(FORMATS[fi], precision);
+
+                ASSERTV(fi, precision, FORMATS[fi] == X.format());
+                ASSERTV(fi, precision,
+                        precision == X.fractionalSecondPrecision());
+            }
+        }
+
+        if (verbose) cout << "\nNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(Obj::e_ISO_8601, 0));
+            ASSERT_FAIL(Obj(Obj::e_ISO_8601, 1));
+            ASSERT_FAIL(Obj(Obj::e_ISO_8601, 7));
+            ASSERT_FAIL(Obj(Obj::e_ISO_8601, -1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Render a few timestamps in each format.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        char buffer[Obj::k_MAX_LENGTH];
+
+        const bdlt::Datetime T1(2024, 1, 15, 12, 0, 59, 999, 999);
+        const bdlt::Datetime T2(2024, 1, 15, 12, 1,  0,   1,   2);
+
+        Obj mA(Obj::e_BDE_PRINT, 3);
+
+        ASSERT("15JAN2024_12:00:59.999" ==
+                         bsl::string_view(buffer, mA.generate(buffer, T1, 0)));
+        ASSERT("15JAN2024_12:01:00.001" ==
+                         bsl::string_view(buffer, mA.generate(buffer, T2, 0)));
+
+        Obj mB(Obj::e_BDE_PRINT_TZ_OFFSET, 6);
+
+        ASSERT("15JAN2024_12:00:59.999999-0130" ==
+                       bsl::string_view(buffer, mB.generate(buffer, T1, -90)));
+
+        Obj mC(Obj::e_ISO_8601, 0);
+
+        ASSERT("2024-01-15T12:00:59Z" ==
+                         bsl::string_view(buffer, mC.generate(buffer, T1, 0)));
+        ASSERT("2024-01-15T12:01:00+01:00" ==
+                        bsl::string_view(buffer, mC.generate(buffer, T2, 60)));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        // 1. Rendering a timestamp within the cached second is substantially
+        //    faster than rendering it with the `bdlt` facilities.
+        //
+        // Plan:
+        // 1. Render timestamps one microsecond apart with the cache and with
+        //    `bdlt::Iso8601Util`, and report the time per call.  The number
+        //    of iterations may be specified as the second argument.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE TEST"
+                          << "\n================" << endl;
+
+        const int NUM_ITERATIONS = argc > 2 && bsl::atoi(argv[2]) > 0
+                                 ? bsl::atoi(argv[2])
+                                 : 1000000;
+
+        const bdlt::Datetime            START(2024, 1, 15, 12);
+        const bdlt::DatetimeInterval    STEP(0, 0, 0, 0, 0, 1);
+        char                            buffer[Obj::k_MAX_LENGTH];
+        bsls::Types::Int64              checksum = 0;
+        bsls::Stopwatch                 timer;
+
+        Obj mX(Obj::e_ISO_8601, 6);
+
+        bdlt::Datetime timestamp(START);
+
+        timer.start();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            checksum += mX.generate(buffer, timestamp, 0) + buffer[25];
+            timestamp += STEP;
+        }
+        timer.stop();
+
+        const double cached = timer.elapsedTime();
+
+        bdlt::Iso8601UtilConfiguration config;
+        config.setFractionalSecondPrecision(6);
+        config.setUseZAbbreviationForUtc(true);
+
+        timestamp = START;
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            checksum += bdlt::Iso8601Util::generateRaw(
+                                             buffer,
+                                             bdlt::DatetimeTz(timestamp, 0),
+                                             config) + buffer[25];
+            timestamp += STEP;
+        }
+        timer.stop();
+
+        const double uncached = timer.elapsedTime();
+
+        cout << "iterations:             " << NUM_ITERATIONS << endl
+             << "cached   (ns per call): "
+             << cached * 1e9 / NUM_ITERATIONS << endl
+             << "uncached (ns per call): "
+             << uncached * 1e9 / NUM_ITERATIONS << endl
+             << "checksum:               " << checksum << endl;
+      } break;
+      default: {
+        cout << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cout << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
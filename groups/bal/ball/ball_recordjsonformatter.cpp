@@ -242,6 +242,7 @@ BSLS_IDENT_RCSID(ball_recordjsonformatter_cpp,"$Id$ $CSID$")
 #include <ball_managedattribute.h>
 #include <ball_record.h>
 #include <ball_recordattributes.h>
+#include <ball_recordformattertimestampcache.h>
 #include <ball_recordformattertimezone.h>
 #include <ball_severity.h>
 
@@ -258,12 +259,13 @@ BSLS_IDENT_RCSID(ball_recordjsonformatter_cpp,"$Id$ $CSID$")
 #include <bdls_pathutil.h>
 
 #include <bdlsb_fixedmemoutstreambuf.h>
+#include <bdlsb_overflowmemoutstreambuf.h>
 
 #include <bdlt_datetime.h>
 #include <bdlt_currenttime.h>
 #include <bdlt_localtimeoffset.h>
-#include <bdlt_iso8601util.h>
-#include <bdlt_iso8601utilconfiguration.h>
+
+#include <bslalg_numericformatterutil.h>
 
 #include <bslim_printer.h>
 
@@ -466,6 +468,14 @@ class TimestampFormatter : public RecordJsonFormatter_FieldFormatter {
     Format                        d_format;
     RecordFormatterTimezone::Enum d_timezone;
     FractionalSecondPrecision     d_precision;
+    RecordFormatterTimestampCache d_cache;      // renders `d_format` with
+                                                // `d_precision` digits
+
+    // PRIVATE CLASS METHODS
+
+    /// Return the timestamp cache format corresponding to the specified
+    /// `format`.
+    static RecordFormatterTimestampCache::Format cacheFormat(Format format);
 
   public:
 
@@ -485,6 +495,7 @@ class TimestampFormatter : public RecordJsonFormatter_FieldFormatter {
     , d_format(format)
     , d_timezone(timezoneDefault)
     , d_precision(precision)
+    , d_cache(cacheFormat(format), precision)
     {}
 
     // MANIPULATORS
@@ -1139,6 +1150,17 @@ class FieldFormattersDestructor {
 // CLASS DATA
 const char *const TimestampFormatter::k_DEFAULT_NAME = k_KEY_TIMESTAMP;
 
+// PRIVATE CLASS METHODS
+RecordFormatterTimestampCache::Format
+TimestampFormatter::cacheFormat(Format format)
+{
+    BSLS_ASSERT(e_FORMAT_BDE_PRINT == format || e_FORMAT_ISO_8601 == format);
+
+    return e_FORMAT_ISO_8601 == format
+           ? RecordFormatterTimestampCache::e_ISO_8601
+           : RecordFormatterTimestampCache::e_BDE_PRINT;
+}
+
 // MANIPULATORS
 void TimestampFormatter::deleteSelf(const bsl::allocator<> allocator)
 {
@@ -1148,55 +1170,25 @@ void TimestampFormatter::deleteSelf(const bsl::allocator<> allocator)
 int TimestampFormatter::format(baljsn::SimpleFormatter *formatter,
                                const Record&            record)
 {
-    bdlt::DatetimeInterval  offset;
+    const bdlt::Datetime& timestamp = record.fixedFields().timestamp();
+
+    bdlt::DatetimeInterval offset;
 
     if (RecordFormatterTimezone::e_LOCAL == d_timezone) {
         bsls::Types::Int64 localTimeOffsetInSeconds =
-            bdlt::LocalTimeOffset::localTimeOffset(
-                              record.fixedFields().timestamp()).totalSeconds();
+            bdlt::LocalTimeOffset::localTimeOffset(timestamp).totalSeconds();
 
         offset.setTotalSeconds(localTimeOffsetInSeconds);
     }
-    bdlt::DatetimeTz timestamp(record.fixedFields().timestamp() + offset,
-                               static_cast<int>(offset.totalMinutes()));
 
-    switch (d_format) {
-      case e_FORMAT_ISO_8601: {
-        bdlt::Iso8601UtilConfiguration config;
+    char buffer[RecordFormatterTimestampCache::k_MAX_LENGTH];
 
-        config.setFractionalSecondPrecision(d_precision);
-        config.setUseZAbbreviationForUtc(true);
-
-        char buffer[bdlt::Iso8601Util::k_DATETIMETZ_STRLEN + 1];
-
-        int outputLength = bdlt::Iso8601Util::generateRaw(buffer,
-                                                          timestamp,
-                                                          config);
-        int rc = formatter->addValue(d_name,
-                                     bsl::string_view(buffer, outputLength));
-        if (rc) {
-            return rc;                                                // RETURN
-        }
-      } break;
-      case e_FORMAT_BDE_PRINT: {
-        char buffer[32];
-
-        timestamp.localDatetime().printToBuffer(buffer,
-                                                sizeof buffer,
-                                                d_precision);
-
-        int rc = formatter->addValue(d_name, buffer);
-        if (rc) {
-            return rc;                                                // RETURN
-        }
-      } break;
-      default: {
-          BSLS_ASSERT(0 == "Unexpected timestamp format");
-          return -1;                                                  // RETURN
-      }
-    }
+    const int length = d_cache.generate(
+                                    buffer,
+                                    timestamp + offset,
+                                    static_cast<int>(offset.totalMinutes()));
 
-    return 0;
+    return formatter->addValue(d_name, bsl::string_view(buffer, length));
 }
 
 int TimestampFormatter::parse(bdld::DatumMapRef v)
@@ -1245,6 +1237,9 @@ int TimestampFormatter::parse(bdld::DatumMapRef v)
             }
         }
     }
+
+    d_cache = RecordFormatterTimestampCache(cacheFormat(d_format),
+                                            d_precision);
     return 0;
 }
 
@@ -1275,21 +1270,23 @@ int ThreadIdFormatter::format(baljsn::SimpleFormatter *formatter,
                                      : record.fixedFields().kernelThreadID());
       } break;
       case e_HEXADECIMAL: {
-        char buffer[32];
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
-        snprintf(buffer,
-                 sizeof(buffer),
-                 "%llX",
-                 e_TID == d_type
-                     ? record.fixedFields().threadID()
-                     : record.fixedFields().kernelThreadID());
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
-        rc = formatter->addValue(d_name, &buffer[0]);
+        char  buffer[32];
+        char *end = bslalg::NumericFormatterUtil::toChars(
+                                      buffer,
+                                      buffer + sizeof buffer,
+                                      e_TID == d_type
+                                      ? record.fixedFields().threadID()
+                                      : record.fixedFields().kernelThreadID(),
+                                      16);
+
+        for (char *digit = buffer; digit != end; ++digit) {
+            if ('a' <= *digit) {
+                *digit = static_cast<char>(*digit - 'a' + 'A');
+            }
+        }
+
+        rc = formatter->addValue(d_name, bsl::string_view(buffer,
+                                                          end - buffer));
       } break;
       default: {
           BSLS_ASSERT(0 == "Unexpected thread format");
@@ -2192,23 +2189,41 @@ RecordJsonFormatter& RecordJsonFormatter::operator=(
 void RecordJsonFormatter::operator()(bsl::ostream& stream,
                                      const Record& record) const
 {
-    baljsn::SimpleFormatter formatter(stream);
-    int rc;
-    formatter.openObject();
+    // Render the record into a local buffer, so that 'stream' is written
+    // once per record rather than once per JSON token.
+
+    const int k_BUFFER_SIZE = 512;
+
+    char                           buffer[k_BUFFER_SIZE];
+    bdlsb::OverflowMemOutStreamBuf streamBuffer(buffer, k_BUFFER_SIZE);
+    bsl::ostream                   os(&streamBuffer);
 
-    for (FieldFormatters::const_iterator it = d_fieldFormatters.cbegin();
-         it != d_fieldFormatters.cend();
-         ++it)
     {
-        rc = (*it)->format(&formatter, record);
-        if (rc) {
-            stream << "Error: JSON encoding failure.";
-            break;                                                     // BREAK
+        baljsn::SimpleFormatter formatter(os);
+        int rc;
+        formatter.openObject();
+
+        for (FieldFormatters::const_iterator it = d_fieldFormatters.cbegin();
+             it != d_fieldFormatters.cend();
+             ++it)
+        {
+            rc = (*it)->format(&formatter, record);
+            if (rc) {
+                os << "Error: JSON encoding failure.";
+                break;                                                 // BREAK
+            }
         }
+
+        formatter.closeObject();
     }
+    os << d_recordSeparator;
 
-    formatter.closeObject();
-    stream << d_recordSeparator;
+    stream.write(streamBuffer.initialBuffer(),
+                 streamBuffer.dataLengthInInitialBuffer());
+    if (streamBuffer.overflowBuffer()) {
+        stream.write(streamBuffer.overflowBuffer(),
+                     streamBuffer.dataLengthInOverflowBuffer());
+    }
     stream.flush();
 
     return;
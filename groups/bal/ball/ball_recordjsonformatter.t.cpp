@@ -10,6 +10,8 @@
 
 #include <bdlf_bind.h>
 
+#include <bdlsb_fixedmemoutstreambuf.h>
+
 #include <bdlt_currenttime.h>
 #include <bdlt_datetime.h>
 #include <bdlt_iso8601util.h>
@@ -25,6 +27,7 @@
 #include <bslmt_threadutil.h>
 
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_cstdlib.h>
@@ -77,6 +80,7 @@ using namespace bsl;
 //
 // ACCESSORS
 // [ 4] int operator(bsl::ostream& stream, const Record& record) const;
+// [11] int operator(bsl::ostream& stream, const Record& record) const;
 // [ 3] const bsl::string& format() const;
 // [ 3] SpecSyntax formatSyntax() const;
 // [ 3] RecordFormatterTimezone::Enum timezoneDefault() const;
@@ -89,7 +93,8 @@ using namespace bsl;
 // [ 3] bool operator!=(lhs, rhs);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [11] USAGE EXAMPLE
+// [12] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -267,7 +272,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 11: {
+      case 12: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -318,6 +323,171 @@ int main(int argc, char *argv[])
 //  {"tid":6,"message":"Hello, World!"}
 // ```
       } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // TESTING CONSECUTIVE RECORDS
+        //
+        // Concerns:
+        // 1. Formatting a sequence of records with the same formatter, whose
+        //    timestamps fall within the same second, straddle seconds and
+        //    days, or go back in time, produces the same text as formatting
+        //    each record with a newly created formatter (i.e., the
+        //    per-second timestamp caches are never stale).
+        //
+        // 2. A change of the local time offset takes effect for the next
+        //    formatted record, even within the same second.
+        //
+        // 3. Records whose text exceeds the internal buffer of `operator()`
+        //    are rendered completely.
+        //
+        // Plan:
+        // 1. For each format specification in a table, format a sequence of
+        //    records with one formatter, and compare the text with that
+        //    produced by a copy of the formatter created for each record.
+        //    (C-1)
+        //
+        // 2. Format two records in the same second, changing the local time
+        //    offset in between, and verify the text.  (C-2)
+        //
+        // 3. Format records having messages of increasing length, and
+        //    compare the text with the expected text.  (C-3)
+        //
+        // Testing:
+        //   void operator()(bsl::ostream&, const ball::Record&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING CONSECUTIVE RECORDS\n"
+                             "===========================\n";
+
+        bslma::TestAllocator         oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        RA fields(&oa);
+
+        fields.setThreadID(0xABCDEF);
+        fields.setMessage("message");
+
+        if (verbose) cout << "\tConsecutive timestamps.\n";
+        {
+            static const char *const SPECS[] = {
+                "[\"timestamp\"]",
+                "[{\"timestamp\":{\"fractionalSecPrecision\":\"none\"}}]",
+                "[{\"timestamp\":{\"fractionalSecPrecision\":"
+                                                         "\"microseconds\"}}]",
+                "[{\"timestamp\":{\"format\":\"bdePrint\"}}]",
+                "[{\"timestamp\":{\"format\":\"bdePrint\","
+                                 "\"fractionalSecPrecision\":\"microseconds\","
+                                 "\"timeZone\":\"local\"}},"
+                 "{\"tid\":{\"format\":\"hex\"}}, \"message\"]",
+                "[{\"timestamp\":{\"timeZone\":\"local\"}},"
+                 "{\"timestamp\":{\"name\":\"utc\"}}]",
+            };
+            const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+            const bdlt::Datetime TIMESTAMPS[] = {
+                bdlt::Datetime(2024, 12, 31, 23, 59, 58, 999, 999),
+                bdlt::Datetime(2024, 12, 31, 23, 59, 59,   0,   0),
+                bdlt::Datetime(2024, 12, 31, 23, 59, 59,   0,   1),
+                bdlt::Datetime(2024, 12, 31, 23, 59, 59, 123, 456),
+                bdlt::Datetime(2025,  1,  1,  0,  0,  0,   0,   0),
+                bdlt::Datetime(2025,  1,  1,  0,  0,  0,   7,   8),
+                bdlt::Datetime(2024, 12, 31, 23, 59, 59, 500,   0),
+                bdlt::Datetime(2025,  1,  2,  0,  0,  0,  10,  20),
+                bdlt::Datetime(2025,  1,  2,  0,  0,  0,  10,  20),
+            };
+            const int NUM_TIMESTAMPS = sizeof TIMESTAMPS / sizeof *TIMESTAMPS;
+
+            bdlt::LocalTimeOffset::LocalTimeOffsetCallback defaultCallback =
+                             bdlt::LocalTimeOffset::setLocalTimeOffsetCallback(
+                                        &LocalTimeOffsetUtil::localTimeOffset);
+
+            LocalTimeOffsetUtil::d_offset = -5 * 3600 - 30 * 60;
+
+            for (int si = 0; si < NUM_SPECS; ++si) {
+                Obj mX(&oa);  const Obj& X = mX;
+
+                ASSERTV(si, 0 == mX.setJsonFormat(SPECS[si]));
+
+                for (int ti = 0; ti < NUM_TIMESTAMPS; ++ti) {
+                    fields.setTimestamp(TIMESTAMPS[ti]);
+                    const Rec record(fields, UF(&oa), &oa);
+
+                    const Obj EXP(X, &oa);
+
+                    bsl::ostringstream actual(&oa);
+                    bsl::ostringstream expected(&oa);
+
+                    X(actual, record);
+                    EXP(expected, record);
+
+                    if (veryVerbose) {
+                        T_ P_(si) P(actual.str());
+                    }
+
+                    ASSERTV(si, ti, expected.str(), actual.str(),
+                            expected.str() == actual.str());
+                }
+            }
+
+            bdlt::LocalTimeOffset::setLocalTimeOffsetCallback(defaultCallback);
+        }
+
+        if (verbose) cout << "\tChanging the local time offset.\n";
+        {
+            bdlt::LocalTimeOffset::LocalTimeOffsetCallback defaultCallback =
+                             bdlt::LocalTimeOffset::setLocalTimeOffsetCallback(
+                                        &LocalTimeOffsetUtil::localTimeOffset);
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(0 == mX.setJsonFormat(
+                             "[{\"timestamp\":{\"timeZone\":\"local\"}}]"));
+            mX.setRecordSeparator("");
+
+            fields.setTimestamp(bdlt::Datetime(2021, 1, 2, 3, 4, 5, 6));
+            const Rec record(fields, UF(&oa), &oa);
+
+            bsl::ostringstream oss(&oa);
+
+            LocalTimeOffsetUtil::d_offset = 0;
+            X(oss, record);
+            ASSERTV(oss.str(),
+                    "{\"timestamp\":\"2021-01-02T03:04:05.006Z\"}" ==
+                                                                   oss.str());
+
+            oss.str("");
+            LocalTimeOffsetUtil::d_offset = 3600;
+            X(oss, record);
+            ASSERTV(oss.str(),
+                    "{\"timestamp\":\"2021-01-02T04:04:05.006+01:00\"}" ==
+                                                                   oss.str());
+
+            bdlt::LocalTimeOffset::setLocalTimeOffsetCallback(defaultCallback);
+        }
+
+        if (verbose) cout << "\tLong records.\n";
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(0 == mX.setJsonFormat("[\"message\"]"));
+
+            for (int length = 0; length < 2048; length += 97) {
+                const bsl::string message(length, 'x', &oa);
+
+                fields.setMessage(message);
+                const Rec record(fields, UF(&oa), &oa);
+
+                bsl::ostringstream oss(&oa);
+                X(oss, record);
+
+                const bsl::string EXPECTED = "{\"message\":\"" + message +
+                                                                    "\"}\n";
+
+                ASSERTV(length, oss.str().length(), EXPECTED == oss.str());
+            }
+        }
+      } break;
       case 10: {
         // --------------------------------------------------------------------
         // TESTING loadJsonSchemeFormatter AND loadQjsonSchemeFormatter
@@ -3361,6 +3531,82 @@ int main(int argc, char *argv[])
 
         P(oss.str().c_str());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        // 1. Report the number of records per second formatted by
+        //    `operator()` for representative format specifications.
+        //
+        // Plan:
+        // 1. For each format specification in a table, format records whose
+        //    timestamps advance by one microsecond into a fixed buffer, and
+        //    report the rate.  The number of iterations may be specified as
+        //    the second argument.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PERFORMANCE TEST\n"
+                             "================\n";
+
+        const int NUM_ITERATIONS = argc > 2 && bsl::atoi(argv[2]) > 0
+                                 ? bsl::atoi(argv[2])
+                                 : 1000000;
+
+        static const char *const SPECS[] = {
+            "[\"timestamp\", \"pid\", \"tid\", \"severity\", \"file\","
+             "\"line\", \"category\", \"message\"]",
+            "[{\"timestamp\":{\"fractionalSecPrecision\":\"microseconds\"}},"
+             "{\"tid\":{\"format\":\"hex\"}}, \"message\"]",
+        };
+        const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        RA fields(&oa);
+
+        fields.setProcessID(12345);
+        fields.setThreadID(67890);
+        fields.setSeverity(ball::Severity::e_INFO);
+        fields.setFileName("groups/bal/ball/ball_record.cpp");
+        fields.setLineNumber(1234);
+        fields.setCategory("PERFORMANCE.TEST");
+        fields.setMessage("The quick brown fox jumps over the lazy dog.");
+
+        Rec                         record(fields, UF(&oa), &oa);
+        bdlt::Datetime              timestamp(2024, 1, 15, 12);
+        char                        buffer[1024];
+        bdlsb::FixedMemOutStreamBuf streamBuf(buffer, sizeof buffer);
+        bsl::ostream                stream(&streamBuf);
+        bsls::Stopwatch             timer;
+
+        for (int si = 0; si < NUM_SPECS; ++si) {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERTV(si, 0 == mX.setJsonFormat(SPECS[si]));
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                timestamp.addMicroseconds(1);
+                record.fixedFields().setTimestamp(timestamp);
+
+                streamBuf.pubseekpos(0);
+                X(stream, record);
+            }
+            timer.stop();
+
+            cout << "format:           " << si << endl
+                 << "iterations:       " << NUM_ITERATIONS << endl
+                 << "records / second: "
+                 << static_cast<bsls::Types::Int64>(
+                                        NUM_ITERATIONS / timer.elapsedTime())
+                 << endl;
+        }
+      } break;
       default: {
           bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND."
                     << bsl::endl;
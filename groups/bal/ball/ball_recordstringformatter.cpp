@@ -10,6 +10,19 @@ BSLS_IDENT_RCSID(ball_recordstringformatter_cpp,"$Id$ $CSID$")
 // significant performance overhead.  For this reason, the 'operator()' method
 // is implemented by writing the formatted string to a buffer before inserting
 // to a stream.
+//
+// The format specification is compiled (by 'parseFormatSpecification') into a
+// 'Program': a sequence of instructions that 'operator()' executes with a
+// single 'switch' per instruction.  Literal text is merged into spans of the
+// 'd_literals' string, fixed fields of the record are rendered directly into
+// the output buffer (integers with 'bslalg::NumericFormatterUtil' rather than
+// 'snprintf'), and each timestamp specifier owns a
+// 'ball::RecordFormatterTimestampCache' that formats only the fractional
+// seconds of timestamps falling in the most recently rendered second.  Only
+// the attribute specifiers, whose formatters cache attribute positions, are
+// still invoked through 'bsl::function' objects.  Note that the timestamp
+// caches keep their text in thread-local storage, so, unlike the attribute
+// formatters, they are not modified by 'operator()'.
 
 #include <ball_attribute.h>               // for testing only
 #include <ball_managedattribute.h>
@@ -19,9 +32,6 @@ BSLS_IDENT_RCSID(ball_recordstringformatter_cpp,"$Id$ $CSID$")
 #include <ball_userfields.h>
 #include <ball_userfieldvalue.h>
 
-#include <bdlf_bind.h>
-#include <bdlf_placeholder.h>
-
 #include <bdlma_bufferedsequentialallocator.h>
 
 #include <bdls_pathutil.h>
@@ -31,14 +41,15 @@ BSLS_IDENT_RCSID(ball_recordstringformatter_cpp,"$Id$ $CSID$")
 #include <bdlt_datetime.h>
 #include <bdlt_currenttime.h>
 #include <bdlt_localtimeoffset.h>
-#include <bdlt_iso8601util.h>
-#include <bdlt_iso8601utilconfiguration.h>
 
 #include <bdlsb_overflowmemoutstreambuf.h>
 
+#include <bslalg_numericformatterutil.h>
+
 #include <bslim_printer.h>
 
 #include <bsls_annotation.h>
+#include <bsls_assert.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
@@ -92,6 +103,28 @@ struct PublishInLocalTimeUtil {
     };
 };
 
+/// This enumeration defines the operations of the instructions of a
+/// compiled format specification.
+enum Opcode {
+    e_LITERAL,                // literal text
+    e_TIMESTAMP,              // "%d", "%D", "%dtz", "%Dtz", "%i", "%I", "%O"
+    e_PROCESS_ID,             // "%p"
+    e_THREAD_ID,              // "%t"
+    e_THREAD_ID_HEX,          // "%T"
+    e_KERNEL_THREAD_ID,       // "%k"
+    e_KERNEL_THREAD_ID_HEX,   // "%K"
+    e_SEVERITY,               // "%s"
+    e_FILE_PATH,              // "%f"
+    e_FILE_BASENAME,          // "%F"
+    e_LINE_NUMBER,            // "%l"
+    e_CATEGORY,               // "%c"
+    e_MESSAGE,                // "%m"
+    e_MESSAGE_NON_PRINTABLE,  // "%x"
+    e_MESSAGE_HEX,            // "%X"
+    e_USER_FIELDS,            // "%u"
+    e_FIELD_FORMATTER         // "%a", "%av", "%a[key]", "%av[key]", "%A"
+};
+
                        // ===============
                        // class PrintUtil
                        // ===============
@@ -109,14 +142,15 @@ struct PrintUtil {
         e_FSP_MICROSECONDS = 6
     };
 
-    enum TimestampFormat {
-        // Enumeration used to distinguish among different formats of
-        // timestamp representation.
-        e_TF_DATETIME           = 0,
-        e_TF_DATETIME_TZ_OFFSET = 1,
-        e_TF_ISO8601            = 2
-    };
+  private:
+    // PRIVATE CLASS METHODS
+
+    /// Append the specified `value` to the specified `result` string in
+    /// decimal format.
+    template <class INTEGER>
+    static void appendInteger(bsl::string *result, INTEGER value);
 
+  public:
     // CLASS METHODS
 
     /// Append the key of the specified `attribute`, followed by the value
@@ -134,17 +168,6 @@ struct PrintUtil {
     /// processing "%c" specifier.
     static void appendCategory(bsl::string *result, const Record& record);
 
-    /// Append to the specified `result` the datetime provided by the
-    /// specified `record` in the specified `timestampFormat`, having the
-    /// specified fractional `secondPrecision` numbers, and the specified
-    /// `timestampOffset`.  Note that this method is invoked when processing
-    /// "%d", "%D", "%dtz", "%Dtz", "%i", "%I" or  "%O" specifiers.
-    static void appendDatetime(bsl::string                  *result,
-                               const Record&                 record,
-                               const bdlt::DatetimeInterval *timestampOffset,
-                               TimestampFormat               timestampFormat,
-                               FractionalSecondPrecision     secondPrecision);
-
     /// Append a path to a file-name provided by the specified `record` to
     /// the specified `result` string if the specified `fullPath` is true,
     /// and a base-name only otherwise.  Note that this method is invoked
@@ -158,6 +181,11 @@ struct PrintUtil {
     static void appendHexDump(bsl::string             *result,
                               const bsl::string_view&  string);
 
+    /// Append the specified `value` to the specified `result` string in
+    /// uppercase hexadecimal format.
+    static void appendHexValue(bsl::string         *result,
+                               bsls::Types::Uint64  value);
+
     /// Append to the specified `result` a line-number provided by the
     /// specified `record`.  Note that this method is invoked when
     /// processing "%l" specifier.
@@ -219,12 +247,16 @@ struct PrintUtil {
     /// processing "%s" specifier.
     static void appendSeverity(bsl::string *result, const Record& record);
 
-    /// Append the specified `value` to the specified `result` string
-    /// according to the specified `format`.
-    template <class T>
-    static void appendValue(bsl::string  *result,
-                            const char   *format,
-                            T             value);
+    /// Append to the specified `result` the timestamp provided by the
+    /// specified `record`, adjusted by the specified `timestampOffset` (or
+    /// by the local time offset), and rendered by the specified `cache`.
+    /// Note that this method is invoked when processing "%d", "%D", "%dtz",
+    /// "%Dtz", "%i", "%I" or  "%O" specifiers.
+    static void appendTimestamp(
+                         bsl::string                          *result,
+                         const Record&                         record,
+                         const bdlt::DatetimeInterval&         timestampOffset,
+                         const RecordFormatterTimestampCache&  cache);
 
     /// Append the specified `value` to the specified `result` string.
     static void appendValue(bsl::string  *result, int                value);
@@ -407,113 +439,6 @@ void PrintUtil::appendCategory(bsl::string *result, const Record& record)
     *result += record.fixedFields().category();
 }
 
-void PrintUtil::appendDatetime(bsl::string                  *result,
-                               const Record&                 record,
-                               const bdlt::DatetimeInterval *timestampOffset,
-                               TimestampFormat               timestampFormat,
-                               FractionalSecondPrecision     secondPrecision)
-{
-    bdlt::DatetimeInterval  offset;
-
-    if (PublishInLocalTimeUtil::k_ENABLE ==
-                                          timestampOffset->totalMilliseconds())
-    {
-        bsls::Types::Int64 localTimeOffsetInSeconds =
-            bdlt::LocalTimeOffset::localTimeOffset(
-                              record.fixedFields().timestamp()).totalSeconds();
-        offset.setTotalSeconds(localTimeOffsetInSeconds);
-    } else if (PublishInLocalTimeUtil::k_DISABLE !=
-                                        timestampOffset->totalMilliseconds()) {
-        offset = *timestampOffset;
-    }
-
-    int              offsetInMinutes = static_cast<int>(offset.totalMinutes());
-    bdlt::DatetimeTz timestamp(record.fixedFields().timestamp() + offset,
-                               offsetInMinutes);
-
-    switch (timestampFormat) {
-      case e_TF_ISO8601: {
-        bdlt::Iso8601UtilConfiguration config;
-
-        if (secondPrecision) {
-            config.setFractionalSecondPrecision(secondPrecision);
-        }
-        config.setUseZAbbreviationForUtc(true);
-
-        char buffer[bdlt::Iso8601Util::k_DATETIMETZ_STRLEN + 1];
-
-        int outputLength = bdlt::Iso8601Util::generateRaw(buffer,
-                                                          timestamp,
-                                                          config);
-
-        if (e_FSP_NONE == secondPrecision) {
-
-            enum { k_DECIMAL_SIGN_OFFSET = 19,
-                   k_TZINFO_OFFSET       = k_DECIMAL_SIGN_OFFSET + 4 };
-
-            bsl::string_view head(buffer, k_DECIMAL_SIGN_OFFSET);
-            bsl::string_view tail(buffer + k_TZINFO_OFFSET,
-                                  outputLength - k_TZINFO_OFFSET);
-            *result += head;
-            *result += tail;
-        }
-        else {
-            result->append(buffer, outputLength);
-        }
-      } break;
-      case e_TF_DATETIME: {
-        char buffer[32];
-
-        timestamp.localDatetime().printToBuffer(buffer,
-                                                sizeof buffer,
-                                                secondPrecision);
-        *result += buffer;
-      } break;
-      case e_TF_DATETIME_TZ_OFFSET: {
-        char buffer[64];
-
-        // Printing local time.
-
-        int numChars = timestamp.localDatetime().printToBuffer(
-                                                              buffer,
-                                                              sizeof buffer,
-                                                              secondPrecision);
-
-        // Printing offset.
-
-        char       *offsetBuffer = buffer + numChars;
-        const char  sign         = offsetInMinutes < 0 ? '-' : '+';
-        offsetInMinutes          = offsetInMinutes < 0 ? -offsetInMinutes
-                                                       :  offsetInMinutes;
-        const int   hours        = offsetInMinutes / 60;
-        const int   minutes      = offsetInMinutes % 60;
-
-        // Although an offset greater than 24 hours is undefined behavior, such
-        // invalid 'DatetimeTz' objects still can be created under certain
-        // circumstances.  We want to enable clients to detect these errors as
-        // quickly as possible (DRQS 12693813).
-
-        if (hours < 100) {
-            bsl::snprintf(offsetBuffer,
-                          sizeof buffer - numChars,
-                          "%c%02d%02d",
-                          sign,
-                          hours,
-                          minutes);
-        }
-        else {
-            bsl::snprintf(offsetBuffer,
-                          sizeof buffer - numChars,
-                          "%cXX%02d",
-                          sign,
-                          minutes);
-        }
-
-        *result += buffer;
-      } break;
-    }
-}
-
 void PrintUtil::appendFilename(bsl::string   *result,
                                bool           fullPath,
                                const Record&  record)
@@ -522,6 +447,25 @@ void PrintUtil::appendFilename(bsl::string   *result,
 
     if (fullPath) {
         *result += filename;
+        return;                                                       // RETURN
+    }
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    const char *const k_SEPARATORS = "\\/";
+#else
+    const char *const k_SEPARATORS = "/";
+#endif
+
+    // Extract the basename without allocating when the path ends in a
+    // non-empty filename that follows a separator (the common case), and
+    // defer to 'bdls::PathUtil' otherwise.
+
+    const bsl::string_view::size_type separator =
+                                       filename.find_last_of(k_SEPARATORS);
+
+    if (bsl::string_view::npos != separator
+     && filename.length() != separator + 1) {
+        *result += filename.substr(separator + 1);
     }
     else {
         bsl::string basename;
@@ -574,54 +518,63 @@ void PrintUtil::appendMessageAsHex(bsl::string *result, const Record& record)
     appendHexDump(result, record.fixedFields().messageRef());
 }
 
-template <class T>
-void PrintUtil::appendValue(bsl::string *result,
-                            const char  *format,
-                            T            value)
+void PrintUtil::appendHexValue(bsl::string         *result,
+                               bsls::Types::Uint64  value)
 {
-    char buffer[24];
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
+    char  buffer[24];
+    char *end = bslalg::NumericFormatterUtil::toChars(buffer,
+                                                      buffer + sizeof buffer,
+                                                      value,
+                                                      16);
+
+    for (char *digit = buffer; digit != end; ++digit) {
+        if ('a' <= *digit) {
+            *digit = static_cast<char>(*digit - 'a' + 'A');
+        }
+    }
 
-    snprintf(buffer, sizeof buffer, format, value);
+    result->append(buffer, end - buffer);
+}
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
+template <class INTEGER>
+void PrintUtil::appendInteger(bsl::string *result, INTEGER value)
+{
+    char  buffer[24];
+    char *end = bslalg::NumericFormatterUtil::toChars(buffer,
+                                                      buffer + sizeof buffer,
+                                                      value);
 
-    *result += buffer;
+    result->append(buffer, end - buffer);
 }
 
 void PrintUtil::appendValue(bsl::string *result, int value)
 {
-    appendValue(result, "%d", value);
+    appendInteger(result, value);
 }
 
 void PrintUtil::appendValue(bsl::string  *result, long value)
 {
-    appendValue(result, "%ld", value);
+    appendInteger(result, value);
 }
 
 void PrintUtil::appendValue(bsl::string  *result, long long value)
 {
-    appendValue(result, "%lld", value);
+    appendInteger(result, value);
 }
 
 void PrintUtil::appendValue(bsl::string  *result, unsigned int value)
 {
-    appendValue(result, "%u", value);
+    appendInteger(result, value);
 }
 
 void PrintUtil::appendValue(bsl::string  *result, unsigned long value)
 {
-    appendValue(result, "%lu", value);
+    appendInteger(result, value);
 }
 
 void PrintUtil::appendValue(bsl::string  *result, unsigned long long value)
 {
-    appendValue(result, "%llu", value);
+    appendInteger(result, value);
 }
 
 void PrintUtil::appendProcessId(bsl::string   *result,
@@ -671,25 +624,25 @@ void PrintUtil::appendString(bsl::string             *result,
 void PrintUtil::appendThreadId(bsl::string   *result,
                                const Record&  record)
 {
-    appendValue(result, "%llu", record.fixedFields().threadID());
+    appendInteger(result, record.fixedFields().threadID());
 }
 
 void PrintUtil::appendThreadIdAsHex(bsl::string   *result,
                                     const Record&  record)
 {
-    appendValue(result, "%llX", record.fixedFields().threadID());
+    appendHexValue(result, record.fixedFields().threadID());
 }
 
 void PrintUtil::appendKernelThreadId(bsl::string   *result,
                                      const Record&  record)
 {
-    appendValue(result, "%llu", record.fixedFields().kernelThreadID());
+    appendInteger(result, record.fixedFields().kernelThreadID());
 }
 
 void PrintUtil::appendKernelThreadIdAsHex(bsl::string   *result,
                                           const Record&  record)
 {
-    appendValue(result, "%llX", record.fixedFields().kernelThreadID());
+    appendHexValue(result, record.fixedFields().kernelThreadID());
 }
 
 void PrintUtil::appendSeverity(bsl::string   *result,
@@ -699,6 +652,37 @@ void PrintUtil::appendSeverity(bsl::string   *result,
                                             record.fixedFields().severity())));
 }
 
+void PrintUtil::appendTimestamp(
+                         bsl::string                          *result,
+                         const Record&                         record,
+                         const bdlt::DatetimeInterval&         timestampOffset,
+                         const RecordFormatterTimestampCache&  cache)
+{
+    const bdlt::Datetime& timestamp = record.fixedFields().timestamp();
+
+    bdlt::DatetimeInterval offset;
+
+    if (PublishInLocalTimeUtil::k_ENABLE ==
+                                           timestampOffset.totalMilliseconds())
+    {
+        const bsls::TimeInterval localTimeOffset =
+                          bdlt::LocalTimeOffset::localTimeOffset(timestamp);
+        offset.setTotalSeconds(localTimeOffset.seconds());
+    } else if (PublishInLocalTimeUtil::k_DISABLE !=
+                                         timestampOffset.totalMilliseconds()) {
+        offset = timestampOffset;
+    }
+
+    char buffer[RecordFormatterTimestampCache::k_MAX_LENGTH];
+
+    const int length = cache.generate(
+                                    buffer,
+                                    timestamp + offset,
+                                    static_cast<int>(offset.totalMinutes()));
+
+    result->append(buffer, length);
+}
+
 void PrintUtil::appendUserFields(bsl::string *result, const Record& record)
 {
     typedef UserFields Values;
@@ -861,17 +845,79 @@ const char *RecordStringFormatter::k_BASIC_ATTRIBUTE_FORMAT =
     "\n%d %p:%t %s %f:%l %c %a %m\n";
 
 // PRIVATE MANIPULATORS
+template <class FORMATTER>
+void RecordStringFormatter::appendFieldFormatter(const FORMATTER& formatter)
+{
+    Instruction instruction = {
+        e_FIELD_FORMATTER,
+        static_cast<int>(d_fieldFormatters.size()),
+        0
+    };
+
+    d_fieldFormatters.emplace_back(formatter);
+    d_program.push_back(instruction);
+}
+
+void RecordStringFormatter::appendInstruction(int opcode)
+{
+    Instruction instruction = { opcode, 0, 0 };
+
+    d_program.push_back(instruction);
+}
+
+void RecordStringFormatter::appendLiteral(const bsl::string_view& text)
+{
+    if (text.empty()) {
+        return;                                                       // RETURN
+    }
+
+    if (!d_program.empty() && e_LITERAL == d_program.back().d_opcode) {
+        // The text of the preceding literal ends 'd_literals'.
+
+        d_program.back().d_length += static_cast<int>(text.length());
+    }
+    else {
+        Instruction instruction = {
+            e_LITERAL,
+            static_cast<int>(d_literals.length()),
+            static_cast<int>(text.length())
+        };
+
+        d_program.push_back(instruction);
+    }
+
+    d_literals.append(text.data(), text.length());
+}
+
+void RecordStringFormatter::appendTimestamp(
+                            RecordFormatterTimestampCache::Format format,
+                            int                                   precision)
+{
+    Instruction instruction = {
+        e_TIMESTAMP,
+        static_cast<int>(d_timestampCaches.size()),
+        0
+    };
+
+    d_timestampCaches.push_back(RecordFormatterTimestampCache(format,
+                                                              precision));
+    d_program.push_back(instruction);
+}
+
 void RecordStringFormatter::parseFormatSpecification()
 {
+    typedef RecordFormatterTimestampCache Cache;
+
+    d_literals.clear();
+    d_program.clear();
     d_fieldFormatters.clear();
+    d_timestampCaches.clear();
     d_skipAttributes.clear();
 
     bsl::string::iterator i    = d_formatSpec.begin();
     bsl::string::iterator end  = d_formatSpec.end();
     bsl::string::iterator text = end;
 
-    using namespace bdlf::PlaceHolders;
-
     while (i != end) {
         switch (*i) {
           default: {  // --------------------- text ---------------------------
@@ -885,37 +931,19 @@ void RecordStringFormatter::parseFormatSpecification()
             }
             if (text != end) {
                 // append text preceding to 'i'
-                d_fieldFormatters.emplace_back(
-                    bdlf::BindUtil::bind(&PrintUtil::appendString,
-                                         _1,
-                                         bsl::string_view(
-                                                       text,
-                                                       bsl::distance(text, i)),
-                                         false));
+                appendLiteral(bsl::string_view(text, bsl::distance(text, i)));
                 text = end;
             }
             ++i;
             switch (*i) {
               case 'n': {
-                d_fieldFormatters.emplace_back(
-                                 bdlf::BindUtil::bind(&PrintUtil::appendString,
-                                                      _1,
-                                                      "\n",
-                                                      false));
+                appendLiteral("\n");
               } break;
               case 't': {
-                d_fieldFormatters.emplace_back(
-                                bdlf::BindUtil::bind( &PrintUtil::appendString,
-                                                      _1,
-                                                      "\t",
-                                                      false));
+                appendLiteral("\t");
               } break;
               case '\\': {
-                d_fieldFormatters.emplace_back(
-                                 bdlf::BindUtil::bind(&PrintUtil::appendString,
-                                                      _1,
-                                                      "\\",
-                                                      false));
+                appendLiteral("\\");
               } break;
               default: {
                 // Undefined: we just output the verbatim characters.
@@ -931,13 +959,7 @@ void RecordStringFormatter::parseFormatSpecification()
 
             if (text != end) {
                 // append text preceding to 'i'
-                d_fieldFormatters.emplace_back(
-                      bdlf::BindUtil::bind(&PrintUtil::appendString,
-                                           _1,
-                                           bsl::string_view(
-                                                       text,
-                                                       bsl::distance(text, i)),
-                                           false));
+                appendLiteral(bsl::string_view(text, bsl::distance(text, i)));
                 text = end;
             }
 
@@ -953,22 +975,12 @@ void RecordStringFormatter::parseFormatSpecification()
                     end !=  (i + 2) &&
                     'z' == *(i + 2)) {  //  Datetime + timezone offset ('%dtz')
                     i += 2;
-                    d_fieldFormatters.emplace_back(
-                       bdlf::BindUtil::bind(&PrintUtil::appendDatetime,
-                                            _1,
-                                            _2,
-                                            &d_timestampOffset,
-                                            PrintUtil::e_TF_DATETIME_TZ_OFFSET,
-                                            PrintUtil::e_FSP_MILLISECONDS));
+                    appendTimestamp(Cache::e_BDE_PRINT_TZ_OFFSET,
+                                    PrintUtil::e_FSP_MILLISECONDS);
                 }
                 else {
-                    d_fieldFormatters.emplace_back(
-                          bdlf::BindUtil::bind(&PrintUtil::appendDatetime,
-                                               _1,
-                                               _2,
-                                               &d_timestampOffset,
-                                               PrintUtil::e_TF_DATETIME,
-                                               PrintUtil::e_FSP_MILLISECONDS));
+                    appendTimestamp(Cache::e_BDE_PRINT,
+                                    PrintUtil::e_FSP_MILLISECONDS);
                 }
               } break;
               case 'D': {  // ---------------- Datetime -----------------------
@@ -977,131 +989,63 @@ void RecordStringFormatter::parseFormatSpecification()
                     end !=  (i + 2) &&
                     'z' == *(i + 2)) {  //  Datetime + timezone offset ('%Dtz')
                     i += 2;
-                    d_fieldFormatters.emplace_back(
-                        bdlf::BindUtil::bind(&PrintUtil::appendDatetime,
-                                            _1,
-                                            _2,
-                                            &d_timestampOffset,
-                                            PrintUtil::e_TF_DATETIME_TZ_OFFSET,
-                                            PrintUtil::e_FSP_MICROSECONDS));
+                    appendTimestamp(Cache::e_BDE_PRINT_TZ_OFFSET,
+                                    PrintUtil::e_FSP_MICROSECONDS);
                 }
                 else {
-                    d_fieldFormatters.emplace_back(
-                          bdlf::BindUtil::bind(&PrintUtil::appendDatetime,
-                                               _1,
-                                               _2,
-                                               &d_timestampOffset,
-                                               PrintUtil::e_TF_DATETIME,
-                                               PrintUtil::e_FSP_MICROSECONDS));
+                    appendTimestamp(Cache::e_BDE_PRINT,
+                                    PrintUtil::e_FSP_MICROSECONDS);
                 }
               } break;
               case 'i': {  // ---------------- Datetime ISO 8601 --------------
-                d_fieldFormatters.emplace_back(
-                          bdlf::BindUtil::bind(&PrintUtil::appendDatetime,
-                                               _1,
-                                               _2,
-                                               &d_timestampOffset,
-                                               PrintUtil::e_TF_ISO8601,
-                                               PrintUtil::e_FSP_NONE));
+                appendTimestamp(Cache::e_ISO_8601, PrintUtil::e_FSP_NONE);
               } break;
               case 'I': {  // ---------------- Datetime ISO 8601 --------------
-                d_fieldFormatters.emplace_back(
-                          bdlf::BindUtil::bind(&PrintUtil::appendDatetime,
-                                               _1,
-                                               _2,
-                                               &d_timestampOffset,
-                                               PrintUtil::e_TF_ISO8601,
-                                               PrintUtil::e_FSP_MILLISECONDS));
+                appendTimestamp(Cache::e_ISO_8601,
+                                PrintUtil::e_FSP_MILLISECONDS);
               } break;
               case 'O': {  // ---------------- Datetime ISO 8601 --------------
-                d_fieldFormatters.emplace_back(
-                          bdlf::BindUtil::bind(&PrintUtil::appendDatetime,
-                                               _1,
-                                               _2,
-                                               &d_timestampOffset,
-                                               PrintUtil::e_TF_ISO8601,
-                                               PrintUtil::e_FSP_MICROSECONDS));
+                appendTimestamp(Cache::e_ISO_8601,
+                                PrintUtil::e_FSP_MICROSECONDS);
               } break;
               case 'p': {  // ---------------- Process ID ---------------------
-                d_fieldFormatters.emplace_back(
-                              bdlf::BindUtil::bind(&PrintUtil::appendProcessId,
-                                                   _1,
-                                                   _2));
+                appendInstruction(e_PROCESS_ID);
               } break;
               case 't': {  // ---------------- Thread ID ----------------------
-                d_fieldFormatters.emplace_back(
-                               bdlf::BindUtil::bind(&PrintUtil::appendThreadId,
-                                                    _1,
-                                                    _2));
+                appendInstruction(e_THREAD_ID);
               } break;
               case 'T': {  // ---------------- Thread ID hex ------------------
-                d_fieldFormatters.emplace_back(
-                          bdlf::BindUtil::bind(&PrintUtil::appendThreadIdAsHex,
-                                               _1,
-                                               _2));
+                appendInstruction(e_THREAD_ID_HEX);
               } break;
               case 'k': {  // ---------------- Kernel Thread ID ---------------
-                d_fieldFormatters.emplace_back(
-                          bdlf::BindUtil::bind(&PrintUtil::appendKernelThreadId,
-                                               _1,
-                                               _2));
+                appendInstruction(e_KERNEL_THREAD_ID);
               } break;
               case 'K': {  // ---------------- Kernel Thread ID hex -----------
-                d_fieldFormatters.emplace_back(
-                    bdlf::BindUtil::bind(&PrintUtil::appendKernelThreadIdAsHex,
-                                         _1,
-                                         _2));
+                appendInstruction(e_KERNEL_THREAD_ID_HEX);
               } break;
               case 's': {  // ---------------- Severity -----------------------
-                d_fieldFormatters.emplace_back(
-                               bdlf::BindUtil::bind(&PrintUtil::appendSeverity,
-                                                    _1,
-                                                    _2));
+                appendInstruction(e_SEVERITY);
               } break;
               case 'f': {  // ---------------- Filename -----------------------
-                d_fieldFormatters.emplace_back(
-                               bdlf::BindUtil::bind(&PrintUtil::appendFilename,
-                                                    _1,
-                                                    true,
-                                                    _2));
+                appendInstruction(e_FILE_PATH);
               } break;
               case 'F': {  // ---------------- Filename ----------------------
-                d_fieldFormatters.emplace_back(
-                               bdlf::BindUtil::bind(&PrintUtil::appendFilename,
-                                                    _1,
-                                                    false,
-                                                    _2));
+                appendInstruction(e_FILE_BASENAME);
               } break;
               case 'l': {  // ---------------- Line Number --------------------
-                d_fieldFormatters.emplace_back(
-                             bdlf::BindUtil::bind(&PrintUtil::appendLineNumber,
-                                                  _1,
-                                                  _2));
+                appendInstruction(e_LINE_NUMBER);
               } break;
               case 'c': {  // ---------------- Category -----------------------
-                d_fieldFormatters.emplace_back(
-                               bdlf::BindUtil::bind(&PrintUtil::appendCategory,
-                                                    _1,
-                                                    _2));
+                appendInstruction(e_CATEGORY);
               } break;
               case 'm': {  // ---------------- Message ------------------------
-                d_fieldFormatters.emplace_back(
-                                bdlf::BindUtil::bind(&PrintUtil::appendMessage,
-                                                     _1,
-                                                     _2));
+                appendInstruction(e_MESSAGE);
               } break;
               case 'x': {  // ---------------- Message ------------------------
-                d_fieldFormatters.emplace_back(
-                    bdlf::BindUtil::bind(
-                                    &PrintUtil::appendMessageNonPrintableChars,
-                                    _1,
-                                    _2));
+                appendInstruction(e_MESSAGE_NON_PRINTABLE);
               } break;
               case 'X': {  // ---------------- Message as hex -----------------
-                d_fieldFormatters.emplace_back(
-                           bdlf::BindUtil::bind(&PrintUtil::appendMessageAsHex,
-                                                _1,
-                                                _2));
+                appendInstruction(e_MESSAGE_HEX);
               } break;
               case 'a': {  // ---------------- Attributes (%a/%av) ------------
                 bsl::string::iterator j = i + 1;
@@ -1116,7 +1060,7 @@ void RecordStringFormatter::parseFormatSpecification()
                     if (keyEnd != end) {
                         const bsl::string_view key(j + 1,
                                                    bsl::distance(j+1, keyEnd));
-                        d_fieldFormatters.emplace_back(
+                        appendFieldFormatter(
                                            AttributeFormatter(key, renderKey));
                         if (d_skipAttributes.end() ==
                             d_skipAttributes.find(key))
@@ -1127,21 +1071,18 @@ void RecordStringFormatter::parseFormatSpecification()
                     }
                 }
                 else {
-                    d_fieldFormatters.emplace_back(
+                    appendFieldFormatter(
                         AttributesFormatter(&d_skipAttributes,
                                             d_skipAttributes.get_allocator()));
                 }
               } break;
               case 'A': {  // ---------------- Attributes (%A) ----------------
-                d_fieldFormatters.emplace_back(
+                appendFieldFormatter(
                         AttributesFormatter(0,
                                             d_skipAttributes.get_allocator()));
               } break;
               case 'u': {
-                d_fieldFormatters.emplace_back(
-                             bdlf::BindUtil::bind(&PrintUtil::appendUserFields,
-                                                  _1,
-                                                  _2));
+                appendInstruction(e_USER_FIELDS);
               } break;
               default: {
                 // Undefined: we just output the verbatim characters.
@@ -1155,11 +1096,7 @@ void RecordStringFormatter::parseFormatSpecification()
     }
 
     if (text != end) {
-        d_fieldFormatters.emplace_back(
-                                 bdlf::BindUtil::bind(&PrintUtil::appendString,
-                                                      _1,
-                                                      text,
-                                                      false));
+        appendLiteral(bsl::string_view(text, bsl::distance(text, end)));
     }
 }
 
@@ -1184,7 +1121,10 @@ int RecordStringFormatter::loadTextSchemeFormatter(
 // CREATORS
 RecordStringFormatter::RecordStringFormatter(const allocator_type& allocator)
 : d_formatSpec(k_DEFAULT_FORMAT_SPEC, allocator)
+, d_literals(allocator)
+, d_program(allocator)
 , d_fieldFormatters(allocator)
+, d_timestampCaches(allocator)
 , d_skipAttributes(allocator)
 , d_timestampOffset(0)
 {
@@ -1193,7 +1133,10 @@ RecordStringFormatter::RecordStringFormatter(const allocator_type& allocator)
 
 RecordStringFormatter::RecordStringFormatter(bslma::Allocator *basicAllocator)
 : d_formatSpec(k_DEFAULT_FORMAT_SPEC, basicAllocator)
+, d_literals(basicAllocator)
+, d_program(basicAllocator)
 , d_fieldFormatters(basicAllocator)
+, d_timestampCaches(basicAllocator)
 , d_skipAttributes(basicAllocator)
 , d_timestampOffset(0)
 {
@@ -1203,7 +1146,10 @@ RecordStringFormatter::RecordStringFormatter(bslma::Allocator *basicAllocator)
 RecordStringFormatter::RecordStringFormatter(const char            *format,
                                              const allocator_type&  allocator)
 : d_formatSpec(format, allocator)
+, d_literals(allocator)
+, d_program(allocator)
 , d_fieldFormatters(allocator)
+, d_timestampCaches(allocator)
 , d_skipAttributes(allocator)
 , d_timestampOffset(0)
 {
@@ -1213,7 +1159,10 @@ RecordStringFormatter::RecordStringFormatter(const char            *format,
 RecordStringFormatter::RecordStringFormatter(const char       *format,
                                              bslma::Allocator *basicAllocator)
 : d_formatSpec(format, basicAllocator)
+, d_literals(basicAllocator)
+, d_program(basicAllocator)
 , d_fieldFormatters(basicAllocator)
+, d_timestampCaches(basicAllocator)
 , d_skipAttributes(basicAllocator)
 , d_timestampOffset(0)
 {
@@ -1223,7 +1172,10 @@ RecordStringFormatter::RecordStringFormatter(const char       *format,
 RecordStringFormatter::RecordStringFormatter(const bsl::string_view& format,
                                              const allocator_type&   allocator)
 : d_formatSpec(format, allocator)
+, d_literals(allocator)
+, d_program(allocator)
 , d_fieldFormatters(allocator)
+, d_timestampCaches(allocator)
 , d_skipAttributes(allocator)
 , d_timestampOffset(0)
 {
@@ -1234,7 +1186,10 @@ RecordStringFormatter::RecordStringFormatter(
                                       const bdlt::DatetimeInterval&  offset,
                                       const allocator_type&          allocator)
 : d_formatSpec(k_DEFAULT_FORMAT_SPEC, allocator)
+, d_literals(allocator)
+, d_program(allocator)
 , d_fieldFormatters(allocator)
+, d_timestampCaches(allocator)
 , d_skipAttributes(allocator)
 , d_timestampOffset(offset)
 {
@@ -1245,7 +1200,10 @@ RecordStringFormatter::RecordStringFormatter(
                                       bool                  publishInLocalTime,
                                       const allocator_type& allocator)
 : d_formatSpec(k_DEFAULT_FORMAT_SPEC, allocator)
+, d_literals(allocator)
+, d_program(allocator)
 , d_fieldFormatters(allocator)
+, d_timestampCaches(allocator)
 , d_skipAttributes(allocator)
 , d_timestampOffset(0,
                     0,
@@ -1263,7 +1221,10 @@ RecordStringFormatter::RecordStringFormatter(
                                       const bdlt::DatetimeInterval&  offset,
                                       const allocator_type&          allocator)
 : d_formatSpec(format, allocator)
+, d_literals(allocator)
+, d_program(allocator)
 , d_fieldFormatters(allocator)
+, d_timestampCaches(allocator)
 , d_skipAttributes(allocator)
 , d_timestampOffset(offset)
 {
@@ -1275,7 +1236,10 @@ RecordStringFormatter::RecordStringFormatter(
                                      bool                   publishInLocalTime,
                                      const allocator_type&  allocator)
 : d_formatSpec(format, allocator)
+, d_literals(allocator)
+, d_program(allocator)
 , d_fieldFormatters(allocator)
+, d_timestampCaches(allocator)
 , d_skipAttributes(allocator)
 , d_timestampOffset(0,
                     0,
@@ -1292,7 +1256,10 @@ RecordStringFormatter::RecordStringFormatter(
                                         const RecordStringFormatter& original,
                                         const allocator_type&        allocator)
 : d_formatSpec(original.d_formatSpec, allocator)
+, d_literals(allocator)
+, d_program(allocator)
 , d_fieldFormatters(allocator)
+, d_timestampCaches(allocator)
 , d_skipAttributes(allocator)
 , d_timestampOffset(original.d_timestampOffset)
 {
@@ -1320,10 +1287,13 @@ RecordStringFormatter& RecordStringFormatter::operator=(
                                               const RecordStringFormatter& rhs)
 {
     if (this != &rhs) {
+        // The compiled form refers to the format specification (and the set
+        // of skipped attributes) of the formatter that owns it, so it is
+        // recompiled rather than copied.
+
         d_formatSpec      = rhs.d_formatSpec;
-        d_fieldFormatters = rhs.d_fieldFormatters;
-        d_skipAttributes  = rhs.d_skipAttributes;
         d_timestampOffset = rhs.d_timestampOffset;
+        parseFormatSpecification();
     }
 
     return *this;
@@ -1344,11 +1314,69 @@ void RecordStringFormatter::operator()(bsl::ostream& stream,
     bsl::string output(&stringAllocator);
     output.reserve(k_STRING_RESERVATION);
 
-    for (FieldStringFormatters::const_iterator i = d_fieldFormatters.cbegin();
-         i != d_fieldFormatters.cend();
+    for (Program::const_iterator i = d_program.cbegin();
+         i != d_program.cend();
          ++i)
     {
-        (*i)(&output, record);
+        switch (i->d_opcode) {
+          case e_LITERAL: {
+            output.append(d_literals.data() + i->d_index, i->d_length);
+          } break;
+          case e_TIMESTAMP: {
+            PrintUtil::appendTimestamp(&output,
+                                       record,
+                                       d_timestampOffset,
+                                       d_timestampCaches[i->d_index]);
+          } break;
+          case e_PROCESS_ID: {
+            PrintUtil::appendProcessId(&output, record);
+          } break;
+          case e_THREAD_ID: {
+            PrintUtil::appendThreadId(&output, record);
+          } break;
+          case e_THREAD_ID_HEX: {
+            PrintUtil::appendThreadIdAsHex(&output, record);
+          } break;
+          case e_KERNEL_THREAD_ID: {
+            PrintUtil::appendKernelThreadId(&output, record);
+          } break;
+          case e_KERNEL_THREAD_ID_HEX: {
+            PrintUtil::appendKernelThreadIdAsHex(&output, record);
+          } break;
+          case e_SEVERITY: {
+            PrintUtil::appendSeverity(&output, record);
+          } break;
+          case e_FILE_PATH: {
+            PrintUtil::appendFilename(&output, true, record);
+          } break;
+          case e_FILE_BASENAME: {
+            PrintUtil::appendFilename(&output, false, record);
+          } break;
+          case e_LINE_NUMBER: {
+            PrintUtil::appendLineNumber(&output, record);
+          } break;
+          case e_CATEGORY: {
+            PrintUtil::appendCategory(&output, record);
+          } break;
+          case e_MESSAGE: {
+            PrintUtil::appendMessage(&output, record);
+          } break;
+          case e_MESSAGE_NON_PRINTABLE: {
+            PrintUtil::appendMessageNonPrintableChars(&output, record);
+          } break;
+          case e_MESSAGE_HEX: {
+            PrintUtil::appendMessageAsHex(&output, record);
+          } break;
+          case e_USER_FIELDS: {
+            PrintUtil::appendUserFields(&output, record);
+          } break;
+          case e_FIELD_FORMATTER: {
+            d_fieldFormatters[i->d_index](&output, record);
+          } break;
+          default: {
+            BSLS_ASSERT_INVOKE_NORETURN("Unreachable");
+          }
+        }
     }
 
     stream.write(output.c_str(), output.size());
@@ -105,6 +105,23 @@ BSLS_IDENT("$Id: $")
 // are *not* quoted, whereas attribute values, if they are strings, are
 // *always* quoted.
 //
+///Performance and Thread Safety
+///-----------------------------
+// A format specification is compiled into a sequence of rendering steps when
+// it is supplied, so that formatting a record does not re-examine the
+// specification.  Timestamps are rendered through a
+// `ball::RecordFormatterTimestampCache` per timestamp specifier, which
+// formats the date and time of day once per second and only the fractional
+// seconds of each subsequent record within that second.  The text of that
+// second is cached per thread, not in the record formatter, so rendering
+// timestamps does not modify the record formatter, and timestamp specifiers
+// can be rendered concurrently from several threads.  Note that the attribute
+// specifiers "%a", "%a[name]", and "%av[name]" remember the positions of the
+// attributes they render, as they always have, so a record formatter whose
+// specification contains them must not be used to format records
+// concurrently (the `ball` observers format records while holding their own
+// locks).
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate how to use an instance of
@@ -143,6 +160,7 @@ BSLS_IDENT("$Id: $")
 
 #include <ball_recordformatterfunctor.h>
 #include <ball_recordformatteroptions.h>
+#include <ball_recordformattertimestampcache.h>
 
 #include <bdlt_datetimeinterval.h>
 
@@ -190,6 +208,26 @@ class RecordStringFormatter {
     /// should not be printed as part of a `"%a"` format specifier.
     typedef bsl::set<bsl::string_view>        SkipAttributes;
 
+    /// `Instruction` describes one step of the compiled form of a format
+    /// specification: the rendering of a span of literal text, of a field
+    /// of the record, or the invocation of a field string formatter.
+    struct Instruction {
+        int d_opcode;  // rendering operation (see the implementation)
+
+        int d_index;   // offset of the literal text in `d_literals`, or
+                       // index of the timestamp cache or field formatter
+
+        int d_length;  // length of the literal text
+    };
+
+    /// `Program` is an alias for the compiled form of a format
+    /// specification.
+    typedef bsl::vector<Instruction>                   Program;
+
+    /// `TimestampCaches` is an alias for a vector of timestamp renderers,
+    /// one for each timestamp specifier in a format specification.
+    typedef bsl::vector<RecordFormatterTimestampCache> TimestampCaches;
+
   public:
     // TYPES
     typedef bsl::allocator<char>  allocator_type;
@@ -197,13 +235,44 @@ class RecordStringFormatter {
   private:
     // DATA
     bsl::string              d_formatSpec;       // 'printf'-style format spec.
-    FieldStringFormatters    d_fieldFormatters;  // field formatter collection
+
+    bsl::string              d_literals;         // literal text of the
+                                                 // format specification
+
+    Program                  d_program;          // compiled format
+                                                 // specification
+
+    FieldStringFormatters    d_fieldFormatters;  // attribute formatters
+
+    TimestampCaches          d_timestampCaches;  // timestamp renderers
+
     SkipAttributes           d_skipAttributes;   // set of skipped attributes
     bdlt::DatetimeInterval   d_timestampOffset;  // offset added to timestamps
 
     // PRIVATE MANIPULATORS
 
-    /// Parse the format specification.
+    /// Append to the compiled format specification an instruction that
+    /// invokes a field string formatter that is a copy of the specified
+    /// `formatter` functor.
+    template <class FORMATTER>
+    void appendFieldFormatter(const FORMATTER& formatter);
+
+    /// Append to the compiled format specification an instruction having
+    /// the specified `opcode`.
+    void appendInstruction(int opcode);
+
+    /// Append to the compiled format specification an instruction that
+    /// renders the specified literal `text`, merging it with the preceding
+    /// instruction if that instruction also renders literal text.
+    void appendLiteral(const bsl::string_view& text);
+
+    /// Append to the compiled format specification an instruction that
+    /// renders the record timestamp in the specified `format` with the
+    /// specified `fractionalSecondPrecision`.
+    void appendTimestamp(RecordFormatterTimestampCache::Format format,
+                         int fractionalSecondPrecision);
+
+    /// Parse the format specification into its compiled form.
     void parseFormatSpecification();
 
   public:
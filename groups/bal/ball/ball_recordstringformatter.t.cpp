@@ -8,6 +8,8 @@
 #include <ball_severity.h>
 #include <ball_userfields.h>
 
+#include <bdlsb_fixedmemoutstreambuf.h>
+
 #include <bdlt_currenttime.h>
 #include <bdlt_datetime.h>
 #include <bdlt_datetimetz.h>
@@ -25,6 +27,7 @@
 #include <bslmt_threadutil.h>
 
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_iostream.h>
@@ -90,6 +93,7 @@ using bsl::uppercase;
 //
 // MANIPULATORS
 // [ 9] const ball::RSF& operator=(const ball::RSF& other);
+// [16] const ball::RSF& operator=(const ball::RSF& other);
 // [13] void disablePublishInLocalTime();
 // [13] void enablePublishInLocalTime();
 // [ 2] void setFormat(const char *format);
@@ -100,6 +104,7 @@ using bsl::uppercase;
 // [13] bool isPublishInLocalTimeEnabled() const;
 // [ 2] const bdlt::DatetimeInterval& timestampOffset() const;
 // [11] void operator()(bsl::ostream&, const ball::Record&) const;
+// [16] void operator()(bsl::ostream&, const ball::Record&) const;
 //
 // FREE OPERATORS
 // [ 6] bool operator==(const ball::RSF& lhs, const ball::RSF& rhs);
@@ -107,7 +112,8 @@ using bsl::uppercase;
 // [ 5] bsl::ostream& operator<<(bsl::ostream&, const ball::RSF&);
 // ----------------------------------------------------------------------------
 // [ 1] breathing test
-// [16] USAGE example
+// [17] USAGE example
+// [-1] PERFORMANCE TEST
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -297,7 +303,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 16: {
+      case 17: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -359,6 +365,239 @@ int main(int argc, char *argv[])
         formatter(oss, record);
         if (veryVerbose) cout << oss.str();
       } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING COMPILED FORMAT SPECIFICATIONS
+        //
+        // Concerns:
+        // 1. Formatting a sequence of records with the same formatter, whose
+        //    timestamps fall within the same second, straddle seconds, days,
+        //    and years, or go back in time, produces the same text as
+        //    formatting each record with a newly created formatter (i.e.,
+        //    the per-second timestamp caches are never stale).
+        //
+        // 2. A change of the timestamp offset (including enabling and
+        //    disabling publishing in local time) takes effect for the next
+        //    formatted record.
+        //
+        // 3. Adjacent literal text and escape sequences are rendered
+        //    verbatim, and thread ids are rendered in uppercase hex by "%T"
+        //    and "%K".
+        //
+        // 4. "%F" renders the basename of the file name for any path.
+        //
+        // 5. A formatter assigned from another formatter remains valid after
+        //    the other formatter is modified or destroyed.
+        //
+        // Plan:
+        // 1. For each format specification in a table, and each of several
+        //    timestamp offsets, format a sequence of records with one
+        //    formatter, and compare the text with that produced by a newly
+        //    created formatter.  (C-1..2)
+        //
+        // 2. Format records having selected thread ids and file names, and
+        //    compare the text with the expected text.  (C-3..4)
+        //
+        // 3. Assign a formatter from a temporary formatter, destroy the
+        //    temporary, and format a record.  (C-5)
+        //
+        // Testing:
+        //   void operator()(bsl::ostream&, const ball::Record&) const;
+        //   const ball::RSF& operator=(const ball::RSF& other);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING COMPILED FORMAT SPECIFICATIONS"
+                          << "\n======================================"
+                          << endl;
+
+        bslma::TestAllocator         oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        ball::RecordAttributes fixedFields(&oa);
+
+        fixedFields.setProcessID(100);
+        fixedFields.setThreadID(0xABCDEF);
+        fixedFields.setSeverity(ball::Severity::e_WARN);
+        fixedFields.setFileName("a/b/test.cpp");
+        fixedFields.setLineNumber(42);
+        fixedFields.setCategory("TEST.CAT");
+        fixedFields.setMessage("Test message");
+
+        if (verbose) cout << "\tConsecutive records." << endl;
+        {
+            static const char *const FORMATS[] = {
+                "%d",
+                "%D",
+                "%dtz|%Dtz",
+                "%i %I %O",
+                "\\n%d %p:%t %s %f:%l %c %m %u\\n",
+                "[%O] %% text \\t%T %F:%l%%%i%k",
+                "%%%d%%%D%%",
+            };
+            const int NUM_FORMATS = sizeof FORMATS / sizeof *FORMATS;
+
+            const bdlt::DatetimeInterval OFFSETS[] = {
+                bdlt::DatetimeInterval(0),
+                bdlt::DatetimeInterval(0, 5, 30),
+                bdlt::DatetimeInterval(0, -8),
+                bdlt::DatetimeInterval(0, 23, 59, 59, 999),
+            };
+            const int NUM_OFFSETS = sizeof OFFSETS / sizeof *OFFSETS;
+
+            const bdlt::Datetime TIMESTAMPS[] = {
+                bdlt::Datetime(2024, 12, 31, 23, 59, 58, 999, 999),
+                bdlt::Datetime(2024, 12, 31, 23, 59, 59,   0,   0),
+                bdlt::Datetime(2024, 12, 31, 23, 59, 59,   0,   1),
+                bdlt::Datetime(2024, 12, 31, 23, 59, 59, 123, 456),
+                bdlt::Datetime(2024, 12, 31, 23, 59, 59, 999, 999),
+                bdlt::Datetime(2025,  1,  1,  0,  0,  0,   0,   0),
+                bdlt::Datetime(2025,  1,  1,  0,  0,  0,   7,   8),
+                bdlt::Datetime(2024, 12, 31, 23, 59, 59, 500,   0),
+                bdlt::Datetime(2025,  1,  2,  0,  0,  0,  10,  20),
+                bdlt::Datetime(2025,  1,  2,  0,  0,  0,  10,  20),
+            };
+            const int NUM_TIMESTAMPS = sizeof TIMESTAMPS / sizeof *TIMESTAMPS;
+
+            for (int fi = 0; fi < NUM_FORMATS; ++fi) {
+                const char *FORMAT = FORMATS[fi];
+
+                for (int oi = 0; oi <= NUM_OFFSETS; ++oi) {
+                    Obj mX(FORMAT, &oa);  const Obj& X = mX;
+
+                    // The last iteration publishes in local time.
+
+                    if (NUM_OFFSETS == oi) {
+                        mX.enablePublishInLocalTime();
+                    }
+                    else {
+                        mX.setTimestampOffset(OFFSETS[oi]);
+                    }
+
+                    for (int ti = 0; ti < NUM_TIMESTAMPS; ++ti) {
+                        fixedFields.setTimestamp(TIMESTAMPS[ti]);
+                        const Rec record(fixedFields, ball::UserFields(), &oa);
+
+                        const Obj EXP(X, &oa);
+
+                        ostringstream actual(&oa);
+                        ostringstream expected(&oa);
+
+                        X(actual, record);
+                        EXP(expected, record);
+
+                        if (veryVerbose) {
+                            T_ P_(fi) P_(oi) P(actual.str());
+                        }
+
+                        ASSERTV(fi, oi, ti, expected.str(), actual.str(),
+                                expected.str() == actual.str());
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\tChanging the timestamp offset." << endl;
+        {
+            fixedFields.setTimestamp(bdlt::Datetime(2024, 6, 1, 12, 0, 0, 1));
+            const Rec record(fixedFields, ball::UserFields(), &oa);
+
+            Obj mX("%I", &oa);  const Obj& X = mX;
+
+            ostringstream oss(&oa);
+
+            X(oss, record);
+            ASSERTV(oss.str(), "2024-06-01T12:00:00.001Z" == oss.str());
+
+            oss.str("");
+            mX.setTimestampOffset(bdlt::DatetimeInterval(0, 1));
+            X(oss, record);
+            ASSERTV(oss.str(), "2024-06-01T13:00:00.001+01:00" == oss.str());
+
+            oss.str("");
+            mX.disablePublishInLocalTime();
+            X(oss, record);
+            ASSERTV(oss.str(), "2024-06-01T12:00:00.001Z" == oss.str());
+
+            oss.str("");
+            mX.enablePublishInLocalTime();
+            X(oss, record);
+
+            const Obj EXP(X, &oa);
+            ostringstream expected(&oa);
+            EXP(expected, record);
+
+            ASSERTV(expected.str(), oss.str(), expected.str() == oss.str());
+        }
+
+        if (verbose) cout << "\tLiterals, hex thread ids, basenames."
+                          << endl;
+        {
+            static const struct {
+                int         d_line;       // source line number
+                Uint64      d_threadId;   // thread id (and kernel thread id)
+                const char *d_fileName;   // file name
+                const char *d_hex;        // expected thread id in hex
+                const char *d_basename;   // expected basename
+            } DATA[] = {
+                //LINE  TID        FILE          HEX                 BASENAME
+                //----  ---------  ------------  ------------------  --------
+                { L_,   0,         "",           "0",                ""      },
+                { L_,   0xABCDEF,  "x.cpp",      "ABCDEF",           "x.cpp" },
+                { L_,   255,       "a/b/c.cpp",  "FF",               "c.cpp" },
+                { L_,   16,        "/c.cpp",     "10",               "c.cpp" },
+                { L_,   1,         "a/b/",       "1",                "b"     },
+                { L_,   ~0ULL,     "/",          "FFFFFFFFFFFFFFFF", "/"     },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            const Obj X("<%T|%K|%F>\\t%%\\\\", &oa);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int    LINE = DATA[ti].d_line;
+                const string HEX(DATA[ti].d_hex, &oa);
+
+                const string EXPECTED = "<" + HEX + "|" + HEX + "|" +
+                                        DATA[ti].d_basename + ">\t%\\";
+
+                fixedFields.setThreadID(DATA[ti].d_threadId);
+                fixedFields.setKernelThreadID(DATA[ti].d_threadId);
+                fixedFields.setFileName(DATA[ti].d_fileName);
+
+                const Rec record(fixedFields, ball::UserFields(), &oa);
+
+                ostringstream oss(&oa);
+                X(oss, record);
+
+                ASSERTV(LINE, EXPECTED, oss.str(), EXPECTED == oss.str());
+            }
+        }
+
+        if (verbose) cout << "\tAssignment from a temporary." << endl;
+        {
+            fixedFields.setThreadID(7);
+            fixedFields.setMessage("message");
+            fixedFields.setTimestamp(bdlt::Datetime(2024, 6, 1, 12));
+
+            ball::UserFields userFields(&oa);
+            const Rec        record(fixedFields, userFields, &oa);
+
+            Obj mX(&oa);  const Obj& X = mX;
+            {
+                Obj mY("%i %t %a[k] %av[k] %a %A %m", &oa);
+
+                mX = mY;
+
+                mY.setFormat("garbage %a[zzz]");
+            }
+
+            ostringstream oss(&oa);
+            X(oss, record);
+
+            ASSERTV(oss.str(), "2024-06-01T12:00:00Z 7     message" ==
+                                                                   oss.str());
+        }
+      } break;
       case 15: {
         // --------------------------------------------------------------------
         // TESTING loadTextSchemeFormatter FACTORY FUNCTION
@@ -2927,6 +3166,81 @@ int main(int argc, char *argv[])
         ASSERT( 0 == (X1 == X3));        ASSERT(1 == (X1 != X3));
         ASSERT( 1 == (X1 == X4));        ASSERT(0 == (X1 != X4));
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        // 1. Report the number of records per second formatted by
+        //    `operator()` for representative format specifications.
+        //
+        // Plan:
+        // 1. For each format specification in a table, format records whose
+        //    timestamps advance by one microsecond into a fixed buffer, and
+        //    report the rate.  The number of iterations may be specified as
+        //    the second argument.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE TEST"
+                          << "\n================" << endl;
+
+        const int NUM_ITERATIONS = argc > 2 && bsl::atoi(argv[2]) > 0
+                                 ? bsl::atoi(argv[2])
+                                 : 1000000;
+
+        static const char *const FORMATS[] = {
+            F0,
+            "\n%I %p:%t %s %F:%l %c %m\n",
+            "%O %T %K %s %m %A\n",
+        };
+        const int NUM_FORMATS = sizeof FORMATS / sizeof *FORMATS;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        ball::RecordAttributes fixedFields(&oa);
+
+        fixedFields.setProcessID(12345);
+        fixedFields.setThreadID(67890);
+        fixedFields.setKernelThreadID(13579);
+        fixedFields.setSeverity(ball::Severity::e_INFO);
+        fixedFields.setFileName("groups/bal/ball/ball_record.cpp");
+        fixedFields.setLineNumber(1234);
+        fixedFields.setCategory("PERFORMANCE.TEST");
+        fixedFields.setMessage(MSG_200BYTE);
+
+        Rec                         record(fixedFields,
+                                           ball::UserFields(),
+                                           &oa);
+        bdlt::Datetime              timestamp(2024, 1, 15, 12);
+        char                        buffer[1024];
+        bdlsb::FixedMemOutStreamBuf streamBuf(buffer, sizeof buffer);
+        bsl::ostream                stream(&streamBuf);
+        bsls::Stopwatch             timer;
+
+        for (int fi = 0; fi < NUM_FORMATS; ++fi) {
+            const Obj X(FORMATS[fi], &oa);
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                timestamp.addMicroseconds(1);
+                record.fixedFields().setTimestamp(timestamp);
+
+                streamBuf.pubseekpos(0);
+                X(stream, record);
+            }
+            timer.stop();
+
+            cout << "format:           " << fi << endl
+                 << "iterations:       " << NUM_ITERATIONS << endl
+                 << "records / second: "
+                 << static_cast<Int64>(NUM_ITERATIONS / timer.elapsedTime())
+                 << endl;
+        }
+      } break;
       default:
         {
             cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
@@ -0,0 +1,345 @@
+// bdlat_namelookup.cpp                                               -*-C++-*-
+#include <bdlat_namelookup.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlat_namelookup_cpp,"$Id$ $CSID$")
+
+#include <bdlat_formattingmode.h>
+
+#include <bsl_algorithm.h>
+
+///Implementation Notes
+///--------------------
+// The table is built using the "hash and displace" scheme of Belazzougui,
+// Botelho, and Dietzfelbinger.  Each name is hashed once, under a seed, to a
+// 64-bit value `h`.  The low-order bits of `h` select one of `numBuckets`
+// buckets; two further hash values, `f1` and `f2` (the latter odd), are
+// taken from the high-order bits (see `slot`).  A name of a bucket having
+// the displacements `(d0, d1)` occupies slot `(f1 + d0 * f2 + d1) & mask`.
+//
+// Buckets are placed largest first.  For each bucket, the candidate
+// displacements are tried in the order `(0, 0)`, `(0, 1)`, ...,
+// `(0, tableSize - 1)`, `(1, 0)`, ..., so that a bucket holding a single name
+// is always placed within the first `tableSize` candidates.  Because there
+// are about half as many buckets as names, and twice as many slots as names,
+// larger buckets are rare and are placed while the table is still mostly
+// empty.  Should a bucket not be placed within a bounded number of
+// candidates, another seed, and then a larger table, is tried.
+
+namespace BloombergLP {
+namespace bdlat {
+namespace {
+namespace u {
+
+/// The number of seeds tried for each table size.
+const int k_NUM_SEEDS = 16;
+
+/// The number of table sizes tried (each twice the previous one).
+const int k_NUM_TABLE_SIZES = 3;
+
+/// The maximum value of the first displacement tried for a bucket.
+const unsigned int k_MAX_DISPLACEMENT0 = 64;
+
+                           // ======================
+                           // struct BucketOrderLess
+                           // ======================
+
+/// This `struct` provides a comparator ordering the indices of names so that
+/// the names of each bucket are contiguous, and larger buckets precede
+/// smaller ones.
+struct BucketOrderLess {
+
+    // DATA
+    const bsls::Types::Uint64 *d_hashes_p;       // hash of each name
+    const int                 *d_bucketSizes_p;  // size of each bucket
+    unsigned int               d_bucketMask;     // number of buckets - 1
+
+    // ACCESSORS
+
+    /// Return `true` if the name having the specified index `lhs` is
+    /// ordered before the name having the specified index `rhs`, and
+    /// `false` otherwise.
+    bool operator()(int lhs, int rhs) const
+    {
+        const unsigned int lhsBucket =
+                   static_cast<unsigned int>(d_hashes_p[lhs]) & d_bucketMask;
+        const unsigned int rhsBucket =
+                   static_cast<unsigned int>(d_hashes_p[rhs]) & d_bucketMask;
+
+        const int lhsSize = d_bucketSizes_p[lhsBucket];
+        const int rhsSize = d_bucketSizes_p[rhsBucket];
+
+        return lhsSize != rhsSize ? lhsSize > rhsSize : lhsBucket < rhsBucket;
+    }
+};
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                              // ----------------
+                              // class NameLookup
+                              // ----------------
+
+// PRIVATE MANIPULATORS
+void NameLookup::build(const Entry *names, int numNames)
+{
+    BSLS_ASSERT(names || 0 == numNames);
+    BSLS_ASSERT(0 <= numNames);
+
+    bslma::Allocator *allocator = d_entries.get_allocator().mechanism();
+
+    // Discard all but the first occurrence of each name.
+
+    bsl::vector<Entry> unique(allocator);
+    unique.reserve(numNames);
+
+    for (int i = 0; i < numNames; ++i) {
+        const Entry& name      = names[i];
+        bool         duplicate = false;
+
+        for (bsl::size_t j = 0; j < unique.size(); ++j) {
+            if (unique[j].d_nameLength == name.d_nameLength &&
+                0 == bsl::memcmp(unique[j].d_name_p,
+                                 name.d_name_p,
+                                 name.d_nameLength)) {
+                duplicate = true;
+                break;
+            }
+        }
+
+        if (!duplicate) {
+            unique.push_back(name);
+        }
+    }
+
+    d_entries.clear();
+    d_displacements.clear();
+    d_seed       = 0;
+    d_mask       = 0;
+    d_bucketMask = 0;
+    d_numNames   = static_cast<int>(unique.size());
+    d_isPerfect  = true;
+
+    if (unique.empty()) {
+        return;                                                       // RETURN
+    }
+
+    const unsigned int n = static_cast<unsigned int>(unique.size());
+
+    unsigned int numBuckets = 1;
+    while (2 * numBuckets < n) {
+        numBuckets <<= 1;
+    }
+
+    unsigned int tableSize = 2;
+    while (tableSize < 2 * n) {
+        tableSize <<= 1;
+    }
+
+    for (int i = 0; i < u::k_NUM_TABLE_SIZES; ++i, tableSize <<= 1) {
+        for (int j = 0; j < u::k_NUM_SEEDS; ++j) {
+            const bsls::Types::Uint64 seed =
+                static_cast<bsls::Types::Uint64>(i * u::k_NUM_SEEDS + j) *
+                                                     0x9e3779b97f4a7c15ULL;
+
+            if (tryBuild(unique, seed, tableSize, numBuckets)) {
+                return;                                               // RETURN
+            }
+        }
+    }
+
+    d_entries.swap(unique);
+    d_isPerfect = false;
+}
+
+bool NameLookup::tryBuild(const bsl::vector<Entry>& names,
+                          bsls::Types::Uint64       seed,
+                          unsigned int              tableSize,
+                          unsigned int              numBuckets)
+{
+    BSLS_ASSERT(!names.empty());
+    BSLS_ASSERT(0 == (tableSize & (tableSize - 1)));
+    BSLS_ASSERT(0 == (numBuckets & (numBuckets - 1)));
+
+    bslma::Allocator *allocator = d_entries.get_allocator().mechanism();
+
+    const int          numNames   = static_cast<int>(names.size());
+    const unsigned int mask       = tableSize - 1;
+    const unsigned int bucketMask = numBuckets - 1;
+
+    bsl::vector<bsls::Types::Uint64> hashes(allocator);
+    bsl::vector<int>                 bucketSizes(numBuckets, 0, allocator);
+    bsl::vector<int>                 order(allocator);
+
+    hashes.reserve(numNames);
+    order.reserve(numNames);
+
+    for (int i = 0; i < numNames; ++i) {
+        const bsls::Types::Uint64 h = hash(seed,
+                                           names[i].d_name_p,
+                                           names[i].d_nameLength);
+        hashes.push_back(h);
+        order.push_back(i);
+        ++bucketSizes[static_cast<unsigned int>(h) & bucketMask];
+    }
+
+    const u::BucketOrderLess less = { hashes.data(),
+                                      bucketSizes.data(),
+                                      bucketMask };
+    bsl::sort(order.begin(), order.end(), less);
+
+    Entry emptyEntry = { 0, -1, 0 };
+
+    bsl::vector<Entry>        entries(tableSize, emptyEntry, allocator);
+    bsl::vector<unsigned int> displacements(2 * numBuckets, 0, allocator);
+    bsl::vector<unsigned int> bucketSlots(allocator);
+
+    const unsigned int maxDisplacement0 = bsl::min(tableSize,
+                                                   u::k_MAX_DISPLACEMENT0);
+
+    int end = 0;
+    for (int begin = 0; begin < numNames; begin = end) {
+        const unsigned int bucket =
+                         static_cast<unsigned int>(hashes[order[begin]]) &
+                                                                    bucketMask;
+
+        end = begin + bucketSizes[bucket];
+
+        bool placed = false;
+        for (unsigned int d0 = 0; !placed && d0 < maxDisplacement0; ++d0) {
+            for (unsigned int d1 = 0; !placed && d1 < tableSize; ++d1) {
+                bucketSlots.clear();
+
+                bool fits = true;
+                for (int k = begin; fits && k < end; ++k) {
+                    const unsigned int s = slot(hashes[order[k]],
+                                                d0,
+                                                d1,
+                                                mask);
+
+                    fits = -1 == entries[s].d_nameLength
+                        && bucketSlots.end() == bsl::find(bucketSlots.begin(),
+                                                          bucketSlots.end(),
+                                                          s);
+                    bucketSlots.push_back(s);
+                }
+
+                if (fits) {
+                    for (int k = begin; k < end; ++k) {
+                        entries[bucketSlots[k - begin]] = names[order[k]];
+                    }
+                    displacements[2 * bucket]     = d0;
+                    displacements[2 * bucket + 1] = d1;
+                    placed                        = true;
+                }
+            }
+        }
+
+        if (!placed) {
+            return false;                                             // RETURN
+        }
+    }
+
+    d_entries.swap(entries);
+    d_displacements.swap(displacements);
+    d_seed       = seed;
+    d_mask       = mask;
+    d_bucketMask = bucketMask;
+    return true;
+}
+
+// CREATORS
+NameLookup::NameLookup(bslma::Allocator *basicAllocator)
+: d_entries(basicAllocator)
+, d_displacements(basicAllocator)
+, d_seed(0)
+, d_mask(0)
+, d_bucketMask(0)
+, d_numNames(0)
+, d_isPerfect(true)
+, d_hasUntaggedElement(false)
+{
+}
+
+// MANIPULATORS
+void NameLookup::reset(const bdlat_AttributeInfo *attributeInfos,
+                       int                        numAttributes)
+{
+    BSLS_ASSERT(attributeInfos || 0 == numAttributes);
+    BSLS_ASSERT(0 <= numAttributes);
+
+    bsl::vector<Entry> names(d_entries.get_allocator());
+    names.reserve(numAttributes);
+
+    for (int i = 0; i < numAttributes; ++i) {
+        const Entry entry = { attributeInfos[i].d_name_p,
+                              attributeInfos[i].d_nameLength,
+                              attributeInfos[i].d_id };
+        names.push_back(entry);
+    }
+
+    build(names.data(), numAttributes);
+
+    d_hasUntaggedElement = false;
+    for (int i = 0; i < numAttributes; ++i) {
+        if (attributeInfos[i].d_formattingMode &
+                                            bdlat_FormattingMode::e_UNTAGGED) {
+            d_hasUntaggedElement = true;
+            break;
+        }
+    }
+}
+
+void NameLookup::reset(const bdlat_SelectionInfo *selectionInfos,
+                       int                        numSelections)
+{
+    BSLS_ASSERT(selectionInfos || 0 == numSelections);
+    BSLS_ASSERT(0 <= numSelections);
+
+    bsl::vector<Entry> names(d_entries.get_allocator());
+    names.reserve(numSelections);
+
+    for (int i = 0; i < numSelections; ++i) {
+        const Entry entry = { selectionInfos[i].d_name_p,
+                              selectionInfos[i].d_nameLength,
+                              selectionInfos[i].d_id };
+        names.push_back(entry);
+    }
+
+    build(names.data(), numSelections);
+
+    d_hasUntaggedElement = false;
+    for (int i = 0; i < numSelections; ++i) {
+        if (selectionInfos[i].d_formattingMode &
+                                            bdlat_FormattingMode::e_UNTAGGED) {
+            d_hasUntaggedElement = true;
+            break;
+        }
+    }
+}
+
+                            // ---------------------
+                            // struct NameLookupUtil
+                            // ---------------------
+
+// CONSTANTS
+const int NameLookupUtil::k_MIN_NUM_NAMES;
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
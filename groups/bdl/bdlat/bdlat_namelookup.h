@@ -0,0 +1,935 @@
+// bdlat_namelookup.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLAT_NAMELOOKUP
+#define INCLUDED_BDLAT_NAMELOOKUP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide perfect-hash lookup of attribute and selection names.
+//
+//@CLASSES:
+//  bdlat::NameLookup: perfect-hash table mapping element names to ids
+//  bdlat::NameLookupUtil: name-based sequence and choice operations
+//
+//@SEE_ALSO: bdlat_sequencefunctions, bdlat_choicefunctions
+//
+//@DESCRIPTION: This component provides a mechanism, `bdlat::NameLookup`,
+// that maps the names held in an array of `bdlat_AttributeInfo` or
+// `bdlat_SelectionInfo` objects to the corresponding ids using a perfect
+// hash, and a utility `struct`, `bdlat::NameLookupUtil`, providing drop-in
+// replacements for the name-based operations of
+// `bdlat_SequenceFunctions` and `bdlat_ChoiceFunctions` that consult such a
+// table for each type having enough elements to benefit from one.
+//
+// The name-based functions of types generated from an XSD schema (e.g., by
+// `bas_codegen.pl`) locate an element by comparing the supplied name against
+// the name of every attribute (or selection) in turn.  Decoders call these
+// functions once for every element they read, so the cost of decoding a
+// message grows with the product of the number of elements in the message
+// and the number of elements declared by each type.  Such a linear search is
+// faster than a hash lookup for a handful of names, however, and the
+// decoders of `bal` therefore do not use this component: clients decoding
+// types that declare many elements may opt in by calling
+// `bdlat::NameLookupUtil` where they would call `bdlat_SequenceFunctions` or
+// `bdlat_ChoiceFunctions`.
+//
+///`bdlat::NameLookup`
+///-------------------
+// A `bdlat::NameLookup` is loaded, using `reset`, from an array of
+// `bdlat_AttributeInfo` or `bdlat_SelectionInfo` objects.  `reset` builds a
+// minimal-branch perfect hash using the "hash and displace" scheme: the names
+// are distributed into buckets by a seeded hash, and for each bucket, largest
+// first, a pair of displacements is chosen that moves every name of the
+// bucket into a distinct, unoccupied slot of a (power of two) table having
+// at least twice as many slots as there are names.  `find` then computes one
+// hash, reads the displacements of one bucket, inspects one slot, and
+// performs at most one `memcmp`.  Should no placement be found for any of a
+// small number of seeds and table sizes (which does not occur for sets of
+// distinct names of practical size), `find` degrades to a linear search, and
+// `isPerfect` returns `false`.
+//
+// A `bdlat::NameLookup` does not copy the names it is loaded with: the
+// names must remain valid, and unmodified, for as long as the lookup is
+// used.  This is always true of the static info arrays of generated types.
+// If a name occurs more than once, `find` returns the id of the first
+// occurrence.  `hasUntaggedElement` reports whether any element the table
+// was loaded with has the `bdlat_FormattingMode::e_UNTAGGED` formatting mode.
+//
+///`bdlat::NameLookupUtil`
+///-----------------------
+// The functions of `bdlat::NameLookupUtil` have the same contracts as the
+// like-named functions of `bdlat_SequenceFunctions` and
+// `bdlat_ChoiceFunctions`.  For a `TYPE` that has the
+// `bdlat_IsBasicSequence` (respectively, `bdlat_IsBasicChoice`) trait and
+// that declares the static data members `ATTRIBUTE_INFO_ARRAY` and
+// `NUM_ATTRIBUTES` (respectively, `SELECTION_INFO_ARRAY` and
+// `NUM_SELECTIONS`), as generated types do, and that declares at least
+// `bdlat::NameLookupUtil::k_MIN_NUM_NAMES` elements, the name is first looked
+// up in a `bdlat::NameLookup` that is built, once per `TYPE`, on first use,
+// and on success the id-based function of `bdlat_SequenceFunctions`
+// (respectively, `bdlat_ChoiceFunctions`) is invoked.  For any other `TYPE`,
+// including generated types declaring fewer elements, for which the
+// generated linear search is at least as fast, the functions simply forward
+// to `bdlat_SequenceFunctions` and `bdlat_ChoiceFunctions`.
+//
+// The name lookup of a generated type may also accept names other than
+// those in its info array: the (caseless) selection names of an anonymous
+// choice, which is an element having the `bdlat_FormattingMode::e_UNTAGGED`
+// formatting mode.  A name that is not found in the table of a type having
+// such an element is therefore passed on to the name-based function of
+// `bdlat_SequenceFunctions` (respectively, `bdlat_ChoiceFunctions`), and
+// costs both a table lookup and a linear search.  For all other types, a name
+// that is not found in the table is not an element name, and the name-based
+// function is not called.  The table therefore assumes that no additional
+// name is also the name of a different element of the type, and that only
+// types having an untagged element accept additional names, both of which
+// generated types guarantee.
+//
+// The tables built by `bdlat::NameLookupUtil`, one for each type on which it
+// is used, are allocated from the global allocator and are never destroyed.
+//
+///Thread Safety
+///-------------
+// `bdlat::NameLookup` is *const* *thread-safe*: its `const` methods may be
+// invoked concurrently from multiple threads, but it is not safe to invoke
+// `reset` while the object is accessed from another thread.  The functions
+// of `bdlat::NameLookupUtil` are thread-safe, provided that the object on
+// which they operate is not concurrently modified; the per-type tables are
+// built under a `bslmt::Once`.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Looking Up Attribute Names
+///- - - - - - - - - - - - - - - - - - -
+// Suppose we have an array of `bdlat_AttributeInfo` objects describing the
+// attributes of a sequence type:
+// ```
+// const bdlat_AttributeInfo INFO[] = {
+//     { 1, "name",  4, "", bdlat_FormattingMode::e_TEXT },
+//     { 2, "age",   3, "", bdlat_FormattingMode::e_DEC  },
+//     { 5, "email", 5, "", bdlat_FormattingMode::e_TEXT }
+// };
+// ```
+// First, we load a `bdlat::NameLookup` from the array:
+// ```
+// bdlat::NameLookup lookup;
+// lookup.reset(INFO, 3);
+// assert(3 == lookup.numNames());
+// ```
+// Now, we look up names in the table:
+// ```
+// int id;
+// assert(0 == lookup.find(&id, "email", 5));
+// assert(5  == id);
+// assert(0 == lookup.find(&id, "age", 3));
+// assert(2  == id);
+// ```
+// Finally, we observe that a name that is not in the table is not found:
+// ```
+// assert(0 != lookup.find(&id, "phone", 5));
+// assert(0 != lookup.find(&id, "ag",    2));
+// ```
+//
+///Example 2: Manipulating an Attribute by Name
+/// - - - - - - - - - - - - - - - - - - - - - -
+// A decoder that reads an element name from its input and must decode the
+// element's value into the corresponding attribute of a sequence can call
+// `bdlat::NameLookupUtil::manipulateAttribute` where it would otherwise call
+// `bdlat_SequenceFunctions::manipulateAttribute`:
+// ```
+// template <class TYPE, class MANIPULATOR>
+// int decodeElement(TYPE               *object,
+//                   MANIPULATOR&        manipulator,
+//                   const bsl::string&  elementName)
+// {
+//     if (!bdlat::NameLookupUtil::hasAttribute(
+//                                   *object,
+//                                   elementName.data(),
+//                                   static_cast<int>(elementName.length()))) {
+//         return -1;                                                // RETURN
+//     }
+//     return bdlat::NameLookupUtil::manipulateAttribute(
+//                                    object,
+//                                    manipulator,
+//                                    elementName.data(),
+//                                    static_cast<int>(elementName.length()));
+// }
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdlat_attributeinfo.h>
+#include <bdlat_choicefunctions.h>
+#include <bdlat_selectioninfo.h>
+#include <bdlat_sequencefunctions.h>
+#include <bdlat_typetraits.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_integralconstant.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmf_tag.h>
+
+#include <bslmt_once.h>
+
+#include <bsls_assert.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_types.h>
+
+#include <bsl_cstring.h>
+#include <bsl_new.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlat {
+
+                              // ================
+                              // class NameLookup
+                              // ================
+
+/// This class provides a perfect-hash table mapping names to integer ids,
+/// loaded from an array of `bdlat_AttributeInfo` or `bdlat_SelectionInfo`
+/// objects.  The table refers to, but does not own, the names it is loaded
+/// with.
+class NameLookup {
+
+    // PRIVATE TYPES
+
+    /// A slot of the table.  An empty slot has a `d_nameLength` of -1.
+    struct Entry {
+        const char *d_name_p;      // name (not owned)
+        int         d_nameLength;  // length of `d_name_p`, or -1 if empty
+        int         d_id;          // id of the element named `d_name_p`
+    };
+
+    // DATA
+    bsl::vector<Entry>        d_entries;        // slots (all names, in
+                                                // order, if not perfect)
+
+    bsl::vector<unsigned int> d_displacements;  // two displacements per
+                                                // bucket
+
+    bsls::Types::Uint64       d_seed;           // hash seed
+
+    unsigned int              d_mask;           // `d_entries.size() - 1`
+
+    unsigned int              d_bucketMask;     // number of buckets - 1
+
+    int                       d_numNames;       // number of distinct names
+
+    bool                      d_isPerfect;      // `true` if one probe
+                                                // suffices
+
+    bool                      d_hasUntaggedElement;
+                                                // `true` if an element is
+                                                // untagged
+
+    // PRIVATE CLASS METHODS
+
+    /// Return the hash of the specified `name` having the specified
+    /// `nameLength` under the specified `seed`.
+    static bsls::Types::Uint64 hash(bsls::Types::Uint64  seed,
+                                    const char          *name,
+                                    int                  nameLength);
+
+    /// Return the slot, in a table having the specified `mask`, of a name
+    /// having the specified `hashValue` and belonging to a bucket having
+    /// the specified `displacement0` and `displacement1`.
+    static unsigned int slot(bsls::Types::Uint64 hashValue,
+                             unsigned int        displacement0,
+                             unsigned int        displacement1,
+                             unsigned int        mask);
+
+    // PRIVATE MANIPULATORS
+
+    /// Load this table from the specified `names` array having the
+    /// specified `numNames` elements.
+    void build(const Entry *names, int numNames);
+
+    /// Attempt to load this table from the specified `names` using the
+    /// specified `seed`, `tableSize`, and `numBuckets`.  Return `true`, and
+    /// modify this table, if every bucket is placed, and return `false`,
+    /// with no effect on this table, otherwise.  The behavior is undefined
+    /// unless `names` is not empty and contains distinct names, and
+    /// `tableSize` and `numBuckets` are powers of two.
+    bool tryBuild(const bsl::vector<Entry>& names,
+                  bsls::Types::Uint64       seed,
+                  unsigned int              tableSize,
+                  unsigned int              numBuckets);
+
+    // NOT IMPLEMENTED
+    NameLookup(const NameLookup&);
+    NameLookup& operator=(const NameLookup&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(NameLookup, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+
+    /// Create an empty table.  Optionally specify a `basicAllocator` used
+    /// to supply memory.  If `basicAllocator` is 0, the currently
+    /// installed default allocator is used.
+    explicit NameLookup(bslma::Allocator *basicAllocator = 0);
+
+    /// Destroy this object.
+    //! ~NameLookup() = default;
+
+    // MANIPULATORS
+
+    /// Load this table with the names and ids of the specified
+    /// `attributeInfos` array having the specified `numAttributes`
+    /// elements, replacing any previous contents.  The names must remain
+    /// valid and unmodified for as long as this table is used.  The
+    /// behavior is undefined unless `0 <= numAttributes` and
+    /// `attributeInfos` refers to at least `numAttributes` elements.
+    void reset(const bdlat_AttributeInfo *attributeInfos, int numAttributes);
+
+    /// Load this table with the names and ids of the specified
+    /// `selectionInfos` array having the specified `numSelections`
+    /// elements, replacing any previous contents.  The names must remain
+    /// valid and unmodified for as long as this table is used.  The
+    /// behavior is undefined unless `0 <= numSelections` and
+    /// `selectionInfos` refers to at least `numSelections` elements.
+    void reset(const bdlat_SelectionInfo *selectionInfos, int numSelections);
+
+    // ACCESSORS
+
+    /// Load into the specified `id` the id associated with the specified
+    /// `name` having the specified `nameLength`.  Return 0 on success, and
+    /// a non-zero value, with no effect on `id`, if `name` is not in this
+    /// table.  The behavior is undefined unless `0 <= nameLength`.
+    int find(int *id, const char *name, int nameLength) const;
+
+    /// Return `true` if any element of the info array this table was last
+    /// loaded from has the `bdlat_FormattingMode::e_UNTAGGED` formatting
+    /// mode, and `false` otherwise.
+    bool hasUntaggedElement() const;
+
+    /// Return `true` if `find` inspects a single slot of this table, and
+    /// `false` if it searches linearly.
+    bool isPerfect() const;
+
+    /// Return the number of distinct names in this table.
+    int numNames() const;
+
+    /// Return the number of slots in this table.
+    int tableSize() const;
+
+                                  // Aspects
+
+    /// Return the allocator used by this object to supply memory.
+    bslma::Allocator *allocator() const;
+};
+
+                    // =======================================
+                    // struct NameLookup_HasAttributeInfoArray
+                    // =======================================
+
+/// This component-private metafunction derives from `bsl::true_type` if
+/// the (template parameter) `TYPE` declares the static data members
+/// `ATTRIBUTE_INFO_ARRAY` and `NUM_ATTRIBUTES`, and from `bsl::false_type`
+/// otherwise.
+template <class TYPE>
+struct NameLookup_HasAttributeInfoArray {
+  private:
+    // PRIVATE TYPES
+    typedef char YesType;
+    struct NoType {
+        char d_padding[2];
+    };
+
+    // PRIVATE CLASS METHODS
+    template <class OTHER>
+    static YesType test(
+                 bslmf::Tag<sizeof(OTHER::ATTRIBUTE_INFO_ARRAY[0].d_name_p) +
+                            OTHER::NUM_ATTRIBUTES> *);
+    template <class OTHER>
+    static NoType test(...);
+
+  public:
+    // TYPES
+    enum { value = sizeof(test<TYPE>(0)) == sizeof(YesType) };
+
+    typedef bsl::integral_constant<bool, value> type;
+};
+
+                    // =======================================
+                    // struct NameLookup_HasSelectionInfoArray
+                    // =======================================
+
+/// This component-private metafunction derives from `bsl::true_type` if
+/// the (template parameter) `TYPE` declares the static data members
+/// `SELECTION_INFO_ARRAY` and `NUM_SELECTIONS`, and from `bsl::false_type`
+/// otherwise.
+template <class TYPE>
+struct NameLookup_HasSelectionInfoArray {
+  private:
+    // PRIVATE TYPES
+    typedef char YesType;
+    struct NoType {
+        char d_padding[2];
+    };
+
+    // PRIVATE CLASS METHODS
+    template <class OTHER>
+    static YesType test(
+                 bslmf::Tag<sizeof(OTHER::SELECTION_INFO_ARRAY[0].d_name_p) +
+                            OTHER::NUM_SELECTIONS> *);
+    template <class OTHER>
+    static NoType test(...);
+
+  public:
+    // TYPES
+    enum { value = sizeof(test<TYPE>(0)) == sizeof(YesType) };
+
+    typedef bsl::integral_constant<bool, value> type;
+};
+
+                            // =====================
+                            // struct NameLookupUtil
+                            // =====================
+
+/// This `struct` provides a namespace for function templates that perform
+/// the name-based operations of `bdlat_SequenceFunctions` and
+/// `bdlat_ChoiceFunctions` using a per-type `NameLookup` where the type
+/// supports it.
+struct NameLookupUtil {
+
+    // CONSTANTS
+
+    /// The minimum number of elements a type must declare for its
+    /// name-based operations to use a `NameLookup`.  Below this number, the
+    /// linear search of a generated type is at least as fast.
+    static const int k_MIN_NUM_NAMES = 8;
+
+    // TYPES
+
+    /// This metafunction derives from `bsl::true_type` if the "sequence"
+    /// (template parameter) `TYPE` exposes the attribute information from
+    /// which a `NameLookup` is built, and from `bsl::false_type` otherwise.
+    /// Note that a `NameLookup` is used for `TYPE` only if it also declares
+    /// at least `k_MIN_NUM_NAMES` attributes.
+    template <class TYPE>
+    struct HasAttributeLookup
+    : bsl::integral_constant<
+                       bool,
+                       bdlat_IsBasicSequence<TYPE>::value &&
+                       NameLookup_HasAttributeInfoArray<TYPE>::value> {
+    };
+
+    /// This metafunction derives from `bsl::true_type` if the "choice"
+    /// (template parameter) `TYPE` exposes the selection information from
+    /// which a `NameLookup` is built, and from `bsl::false_type` otherwise.
+    /// Note that a `NameLookup` is used for `TYPE` only if it also declares
+    /// at least `k_MIN_NUM_NAMES` selections.
+    template <class TYPE>
+    struct HasSelectionLookup
+    : bsl::integral_constant<
+                       bool,
+                       bdlat_IsBasicChoice<TYPE>::value &&
+                       NameLookup_HasSelectionInfoArray<TYPE>::value> {
+    };
+
+  private:
+    // PRIVATE CLASS METHODS
+
+    /// Return the address of the lookup of the attributes of the
+    /// (template parameter) `TYPE`, building it on first use, if `TYPE`
+    /// exposes its attribute information and declares at least
+    /// `k_MIN_NUM_NAMES` attributes, and 0 otherwise.
+    template <class TYPE>
+    static const NameLookup *attributeLookupImp(bsl::true_type);
+    template <class TYPE>
+    static const NameLookup *attributeLookupImp(bsl::false_type);
+
+    /// Return the address of the lookup of the selections of the
+    /// (template parameter) `TYPE`, building it on first use, if `TYPE`
+    /// exposes its selection information and declares at least
+    /// `k_MIN_NUM_NAMES` selections, and 0 otherwise.
+    template <class TYPE>
+    static const NameLookup *selectionLookupImp(bsl::true_type);
+    template <class TYPE>
+    static const NameLookup *selectionLookupImp(bsl::false_type);
+
+    /// Invoke the specified `manipulator` on the attribute of the specified
+    /// `object` indicated by the specified `attributeName` of the specified
+    /// `attributeNameLength`, as `manipulateAttribute` does, using the
+    /// attribute lookup of the (template parameter) `TYPE`, if any, if the
+    /// last argument is of type `bsl::true_type`.
+    template <class TYPE, class MANIPULATOR>
+    static int manipulateAttributeImp(TYPE         *object,
+                                      MANIPULATOR&  manipulator,
+                                      const char   *attributeName,
+                                      int           attributeNameLength,
+                                      bsl::true_type);
+    template <class TYPE, class MANIPULATOR>
+    static int manipulateAttributeImp(TYPE         *object,
+                                      MANIPULATOR&  manipulator,
+                                      const char   *attributeName,
+                                      int           attributeNameLength,
+                                      bsl::false_type);
+
+    /// Make the selection of the specified `object` indicated by the
+    /// specified `selectionName` of the specified `selectionNameLength`, as
+    /// `makeSelection` does, using the selection lookup of the (template
+    /// parameter) `TYPE`, if any, if the last argument is of type
+    /// `bsl::true_type`.
+    template <class TYPE>
+    static int makeSelectionImp(TYPE       *object,
+                                const char *selectionName,
+                                int         selectionNameLength,
+                                bsl::true_type);
+    template <class TYPE>
+    static int makeSelectionImp(TYPE       *object,
+                                const char *selectionName,
+                                int         selectionNameLength,
+                                bsl::false_type);
+
+  public:
+    // CLASS METHODS
+
+    /// Return the address of the lookup of the attributes of the "sequence"
+    /// (template parameter) `TYPE`, building it on first use, if
+    /// `HasAttributeLookup<TYPE>::value` is `true` and `TYPE` declares at
+    /// least `k_MIN_NUM_NAMES` attributes, and 0 otherwise.
+    template <class TYPE>
+    static const NameLookup *attributeLookup();
+
+    /// Return the address of the lookup of the selections of the "choice"
+    /// (template parameter) `TYPE`, building it on first use, if
+    /// `HasSelectionLookup<TYPE>::value` is `true` and `TYPE` declares at
+    /// least `k_MIN_NUM_NAMES` selections, and 0 otherwise.
+    template <class TYPE>
+    static const NameLookup *selectionLookup();
+
+    /// Return `true` if the specified sequence `object` has an attribute
+    /// with the specified `attributeName` of the specified
+    /// `attributeNameLength`, and `false` otherwise.  See
+    /// `bdlat_SequenceFunctions::hasAttribute`.
+    template <class TYPE>
+    static bool hasAttribute(const TYPE&  object,
+                             const char  *attributeName,
+                             int          attributeNameLength);
+
+    /// Invoke the specified `manipulator` on the address of the (modifiable)
+    /// attribute indicated by the specified `attributeName` and
+    /// `attributeNameLength` of the specified sequence `object`, supplying
+    /// `manipulator` with the corresponding attribute information
+    /// structure.  Return a non-zero value if the attribute is not found,
+    /// and the value returned from the invocation of `manipulator`
+    /// otherwise.  See `bdlat_SequenceFunctions::manipulateAttribute`.
+    template <class TYPE, class MANIPULATOR>
+    static int manipulateAttribute(TYPE         *object,
+                                   MANIPULATOR&  manipulator,
+                                   const char   *attributeName,
+                                   int           attributeNameLength);
+
+    /// Return `true` if the specified choice `object` has a selection with
+    /// the specified `selectionName` of the specified
+    /// `selectionNameLength`, and `false` otherwise.  See
+    /// `bdlat_ChoiceFunctions::hasSelection`.
+    template <class TYPE>
+    static bool hasSelection(const TYPE&  object,
+                             const char  *selectionName,
+                             int          selectionNameLength);
+
+    /// Set the value of the specified choice `object` to be the default
+    /// for the selection indicated by the specified `selectionName` of the
+    /// specified `selectionNameLength`.  Return 0 on success, and non-zero
+    /// value otherwise (i.e., the selection is not found).  See
+    /// `bdlat_ChoiceFunctions::makeSelection`.
+    template <class TYPE>
+    static int makeSelection(TYPE       *object,
+                             const char *selectionName,
+                             int         selectionNameLength);
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                              // ----------------
+                              // class NameLookup
+                              // ----------------
+
+// PRIVATE CLASS METHODS
+inline
+bsls::Types::Uint64 NameLookup::hash(bsls::Types::Uint64  seed,
+                                     const char          *name,
+                                     int                  nameLength)
+{
+    // The name is consumed eight bytes at a time, each word being mixed in
+    // with one multiplication; a final avalanche makes the low-order bits
+    // (which select the bucket) depend on every byte of `name`.  The hash
+    // depends on the byte order of the platform, which is immaterial as
+    // tables are not persisted.
+
+    typedef bsls::Types::Uint64 Uint64;
+
+    const Uint64 k_MULTIPLIER = 0xbf58476d1ce4e5b9ULL;
+
+    Uint64 h = seed ^ (static_cast<Uint64>(nameLength) *
+                                                       0x9e3779b97f4a7c15ULL);
+
+    for (; nameLength >= 8; name += 8, nameLength -= 8) {
+        Uint64 word;
+        bsl::memcpy(&word, name, 8);
+        h  = (h ^ word) * k_MULTIPLIER;
+        h ^= h >> 31;
+    }
+
+    if (nameLength) {
+        Uint64 word = 0;
+        for (int i = 0; i < nameLength; ++i) {
+            word |= static_cast<Uint64>(static_cast<unsigned char>(name[i]))
+                                                                 << (8 * i);
+        }
+        h  = (h ^ word) * k_MULTIPLIER;
+        h ^= h >> 31;
+    }
+
+    h ^= h >> 32;
+    h *= 0x94d049bb133111ebULL;
+    h ^= h >> 29;
+    return h;
+}
+
+inline
+unsigned int NameLookup::slot(bsls::Types::Uint64 hashValue,
+                              unsigned int        displacement0,
+                              unsigned int        displacement1,
+                              unsigned int        mask)
+{
+    // The bucket is selected by the low-order bits of `hashValue`; the two
+    // hash functions of the scheme are taken from the high-order bits.
+
+    const unsigned int f1 = static_cast<unsigned int>(hashValue >> 32);
+    const unsigned int f2 = static_cast<unsigned int>(hashValue >> 16) | 1u;
+
+    return (f1 + displacement0 * f2 + displacement1) & mask;
+}
+
+// ACCESSORS
+inline
+int NameLookup::find(int *id, const char *name, int nameLength) const
+{
+    BSLS_ASSERT(id);
+    BSLS_ASSERT(name || 0 == nameLength);
+    BSLS_ASSERT(0 <= nameLength);
+
+    if (d_isPerfect) {
+        if (0 == d_numNames) {
+            return -1;                                                // RETURN
+        }
+
+        const bsls::Types::Uint64  h      = hash(d_seed, name, nameLength);
+        const unsigned int         bucket = static_cast<unsigned int>(h) &
+                                                                  d_bucketMask;
+        const unsigned int        *d      = &d_displacements[2 * bucket];
+        const Entry&               entry  = d_entries[slot(h,
+                                                           d[0],
+                                                           d[1],
+                                                           d_mask)];
+
+        if (entry.d_nameLength != nameLength ||
+            0 != bsl::memcmp(entry.d_name_p, name, nameLength)) {
+            return -1;                                                // RETURN
+        }
+
+        *id = entry.d_id;
+        return 0;                                                     // RETURN
+    }
+
+    for (bsl::size_t i = 0; i < d_entries.size(); ++i) {
+        const Entry& entry = d_entries[i];
+
+        if (entry.d_nameLength == nameLength &&
+            0 == bsl::memcmp(entry.d_name_p, name, nameLength)) {
+            *id = entry.d_id;
+            return 0;                                                 // RETURN
+        }
+    }
+    return -1;
+}
+
+inline
+bool NameLookup::hasUntaggedElement() const
+{
+    return d_hasUntaggedElement;
+}
+
+inline
+bool NameLookup::isPerfect() const
+{
+    return d_isPerfect;
+}
+
+inline
+int NameLookup::numNames() const
+{
+    return d_numNames;
+}
+
+inline
+int NameLookup::tableSize() const
+{
+    return static_cast<int>(d_entries.size());
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *NameLookup::allocator() const
+{
+    return d_entries.get_allocator().mechanism();
+}
+
+                            // ---------------------
+                            // struct NameLookupUtil
+                            // ---------------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE>
+const NameLookup *NameLookupUtil::attributeLookupImp(bsl::true_type)
+{
+    if (TYPE::NUM_ATTRIBUTES < k_MIN_NUM_NAMES) {
+        return 0;                                                     // RETURN
+    }
+
+    static bsls::ObjectBuffer<NameLookup> s_lookup;
+
+    BSLMT_ONCE_DO {
+        NameLookup *lookup = new (s_lookup.buffer())
+                                NameLookup(bslma::Default::globalAllocator());
+        lookup->reset(TYPE::ATTRIBUTE_INFO_ARRAY, TYPE::NUM_ATTRIBUTES);
+    }
+
+    return &s_lookup.object();
+}
+
+template <class TYPE>
+inline
+const NameLookup *NameLookupUtil::attributeLookupImp(bsl::false_type)
+{
+    return 0;
+}
+
+template <class TYPE>
+const NameLookup *NameLookupUtil::selectionLookupImp(bsl::true_type)
+{
+    if (TYPE::NUM_SELECTIONS < k_MIN_NUM_NAMES) {
+        return 0;                                                     // RETURN
+    }
+
+    static bsls::ObjectBuffer<NameLookup> s_lookup;
+
+    BSLMT_ONCE_DO {
+        NameLookup *lookup = new (s_lookup.buffer())
+                                NameLookup(bslma::Default::globalAllocator());
+        lookup->reset(TYPE::SELECTION_INFO_ARRAY, TYPE::NUM_SELECTIONS);
+    }
+
+    return &s_lookup.object();
+}
+
+template <class TYPE>
+inline
+const NameLookup *NameLookupUtil::selectionLookupImp(bsl::false_type)
+{
+    return 0;
+}
+
+template <class TYPE, class MANIPULATOR>
+int NameLookupUtil::manipulateAttributeImp(TYPE         *object,
+                                           MANIPULATOR&  manipulator,
+                                           const char   *attributeName,
+                                           int           attributeNameLength,
+                                           bsl::true_type)
+{
+    const NameLookup *lookup = attributeLookup<TYPE>();
+
+    if (lookup) {
+        int id;
+        if (0 == lookup->find(&id, attributeName, attributeNameLength)) {
+            return bdlat_SequenceFunctions::manipulateAttribute(object,
+                                                                manipulator,
+                                                                id);  // RETURN
+        }
+        if (!lookup->hasUntaggedElement()) {
+            return -1;                                                // RETURN
+        }
+    }
+
+    return bdlat_SequenceFunctions::manipulateAttribute(object,
+                                                        manipulator,
+                                                        attributeName,
+                                                        attributeNameLength);
+}
+
+template <class TYPE, class MANIPULATOR>
+inline
+int NameLookupUtil::manipulateAttributeImp(TYPE         *object,
+                                           MANIPULATOR&  manipulator,
+                                           const char   *attributeName,
+                                           int           attributeNameLength,
+                                           bsl::false_type)
+{
+    return bdlat_SequenceFunctions::manipulateAttribute(object,
+                                                        manipulator,
+                                                        attributeName,
+                                                        attributeNameLength);
+}
+
+template <class TYPE>
+int NameLookupUtil::makeSelectionImp(TYPE       *object,
+                                     const char *selectionName,
+                                     int         selectionNameLength,
+                                     bsl::true_type)
+{
+    const NameLookup *lookup = selectionLookup<TYPE>();
+
+    if (lookup) {
+        int id;
+        if (0 == lookup->find(&id, selectionName, selectionNameLength)) {
+            return bdlat_ChoiceFunctions::makeSelection(object, id);  // RETURN
+        }
+        if (!lookup->hasUntaggedElement()) {
+            return -1;                                                // RETURN
+        }
+    }
+
+    return bdlat_ChoiceFunctions::makeSelection(object,
+                                                selectionName,
+                                                selectionNameLength);
+}
+
+template <class TYPE>
+inline
+int NameLookupUtil::makeSelectionImp(TYPE       *object,
+                                     const char *selectionName,
+                                     int         selectionNameLength,
+                                     bsl::false_type)
+{
+    return bdlat_ChoiceFunctions::makeSelection(object,
+                                                selectionName,
+                                                selectionNameLength);
+}
+
+// CLASS METHODS
+template <class TYPE>
+inline
+const NameLookup *NameLookupUtil::attributeLookup()
+{
+    return attributeLookupImp<TYPE>(
+                                   typename HasAttributeLookup<TYPE>::type());
+}
+
+template <class TYPE>
+inline
+const NameLookup *NameLookupUtil::selectionLookup()
+{
+    return selectionLookupImp<TYPE>(
+                                   typename HasSelectionLookup<TYPE>::type());
+}
+
+template <class TYPE>
+inline
+bool NameLookupUtil::hasAttribute(const TYPE&  object,
+                                  const char  *attributeName,
+                                  int          attributeNameLength)
+{
+    const NameLookup *lookup = attributeLookup<TYPE>();
+
+    if (lookup) {
+        int id;
+        if (0 == lookup->find(&id, attributeName, attributeNameLength)) {
+            return true;                                              // RETURN
+        }
+        if (!lookup->hasUntaggedElement()) {
+            return false;                                             // RETURN
+        }
+    }
+
+    return bdlat_SequenceFunctions::hasAttribute(object,
+                                                 attributeName,
+                                                 attributeNameLength);
+}
+
+template <class TYPE, class MANIPULATOR>
+inline
+int NameLookupUtil::manipulateAttribute(TYPE         *object,
+                                        MANIPULATOR&  manipulator,
+                                        const char   *attributeName,
+                                        int           attributeNameLength)
+{
+    BSLS_ASSERT(object);
+
+    return manipulateAttributeImp(object,
+                                  manipulator,
+                                  attributeName,
+                                  attributeNameLength,
+                                  typename HasAttributeLookup<TYPE>::type());
+}
+
+template <class TYPE>
+inline
+bool NameLookupUtil::hasSelection(const TYPE&  object,
+                                  const char  *selectionName,
+                                  int          selectionNameLength)
+{
+    const NameLookup *lookup = selectionLookup<TYPE>();
+
+    if (lookup) {
+        int id;
+        if (0 == lookup->find(&id, selectionName, selectionNameLength)) {
+            return true;                                              // RETURN
+        }
+        if (!lookup->hasUntaggedElement()) {
+            return false;                                             // RETURN
+        }
+    }
+
+    return bdlat_ChoiceFunctions::hasSelection(object,
+                                               selectionName,
+                                               selectionNameLength);
+}
+
+template <class TYPE>
+inline
+int NameLookupUtil::makeSelection(TYPE       *object,
+                                  const char *selectionName,
+                                  int         selectionNameLength)
+{
+    BSLS_ASSERT(object);
+
+    return makeSelectionImp(object,
+                            selectionName,
+                            selectionNameLength,
+                            typename HasSelectionLookup<TYPE>::type());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif  // INCLUDED_BDLAT_NAMELOOKUP
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1453 @@
+// bdlat_namelookup.t.cpp                                             -*-C++-*-
+#include <bdlat_namelookup.h>
+
+#include <bdlat_attributeinfo.h>
+#include <bdlat_choicefunctions.h>
+#include <bdlat_formattingmode.h>
+#include <bdlat_selectioninfo.h>
+#include <bdlat_sequencefunctions.h>
+#include <bdlat_typetraits.h>
+
+#include <bdlb_string.h>
+
+#include <bsla_maybeunused.h>
+
+#include <bslalg_typetraits.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The component under test provides a perfect-hash table, `NameLookup`, and
+// a utility, `NameLookupUtil`, whose functions must behave exactly like the
+// name-based functions of `bdlat_SequenceFunctions` and
+// `bdlat_ChoiceFunctions`.  `NameLookup` is tested on name sets chosen to
+// provoke hash collisions (long common prefixes, names differing in one
+// character, names that are prefixes of other names, and large sets) by
+// verifying that every name, and no other string, is found.
+// `NameLookupUtil` is tested on types modeled after generated types,
+// including one whose name lookup also accepts the (caseless) selection names
+// of an anonymous choice and one declaring too few elements to use a table,
+// and on types that do not support a table.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] NameLookup(bslma::Allocator *basicAllocator = 0);
+//
+// MANIPULATORS
+// [ 2] void reset(const bdlat_AttributeInfo *, int);
+// [ 2] void reset(const bdlat_SelectionInfo *, int);
+//
+// ACCESSORS
+// [ 2] int find(int *id, const char *name, int nameLength) const;
+// [ 2] bool hasUntaggedElement() const;
+// [ 2] bool isPerfect() const;
+// [ 2] int numNames() const;
+// [ 2] int tableSize() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// UTILITY
+// [ 3] NameLookupUtil::k_MIN_NUM_NAMES
+// [ 3] NameLookupUtil::HasAttributeLookup<TYPE>
+// [ 3] NameLookupUtil::HasSelectionLookup<TYPE>
+// [ 3] const NameLookup *attributeLookup<TYPE>();
+// [ 3] const NameLookup *selectionLookup<TYPE>();
+// [ 4] bool hasAttribute(const TYPE&, const char *, int);
+// [ 4] int manipulateAttribute(TYPE *, MANIPULATOR&, const char *, int);
+// [ 5] bool hasSelection(const TYPE&, const char *, int);
+// [ 5] int makeSelection(TYPE *, const char *, int);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: `find` VS. LINEAR SEARCH
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        bsl::cout << "Error " __FILE__ "(" << line << "): " << message
+                  << "    (failed)" << bsl::endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlat::NameLookup     Obj;
+typedef bdlat::NameLookupUtil Util;
+
+// ============================================================================
+//                   NAMESPACE-SCOPE ENTITIES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace test {
+
+                                // ============
+                                // class Record
+                                // ============
+
+/// This class is modeled after a generated "sequence" type having an
+/// untagged (anonymous) choice attribute, `Choice`, whose selection names,
+/// "Pick1" and "Pick2", are also accepted, caselessly, by the name-based
+/// functions and refer to `Choice`.  The number of name-based lookups
+/// performed by the class is counted.
+class Record {
+
+  public:
+    // TYPES
+    enum {
+        ATTRIBUTE_ID_NAME    = 1,
+        ATTRIBUTE_ID_AGE     = 2,
+        ATTRIBUTE_ID_EMAIL   = 5,
+        ATTRIBUTE_ID_CHOICE  = 7,
+        ATTRIBUTE_ID_STREET  = 8,
+        ATTRIBUTE_ID_CITY    = 9,
+        ATTRIBUTE_ID_COUNTRY = 10,
+        ATTRIBUTE_ID_ZIP     = 12
+    };
+
+    enum { NUM_ATTRIBUTES = 8 };
+
+    // CONSTANTS
+    static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
+
+    // CLASS DATA
+    static int s_numNameLookups;  // number of name-based lookups
+
+    // TRAITS
+    BSLALG_DECLARE_NESTED_TRAITS(Record, bdlat_TypeTraitBasicSequence);
+
+    // DATA
+    int d_values[NUM_ATTRIBUTES];
+
+    // CLASS METHODS
+    static const bdlat_AttributeInfo *lookupAttributeInfo(int id);
+    static const bdlat_AttributeInfo *lookupAttributeInfo(
+                                                       const char *name,
+                                                       int         nameLength);
+
+    // MANIPULATORS
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR& manipulator, int id)
+    {
+        const bdlat_AttributeInfo *info = lookupAttributeInfo(id);
+        if (0 == info) {
+            return -1;                                                // RETURN
+        }
+        return manipulator(&d_values[info - ATTRIBUTE_INFO_ARRAY], *info);
+    }
+
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR&  manipulator,
+                            const char   *name,
+                            int           nameLength)
+    {
+        const bdlat_AttributeInfo *info = lookupAttributeInfo(name,
+                                                              nameLength);
+        if (0 == info) {
+            return -1;                                                // RETURN
+        }
+        return manipulateAttribute(manipulator, info->d_id);
+    }
+};
+
+const bdlat_AttributeInfo Record::ATTRIBUTE_INFO_ARRAY[] = {
+    { ATTRIBUTE_ID_NAME,    "name",    4, "", bdlat_FormattingMode::e_TEXT },
+    { ATTRIBUTE_ID_AGE,     "age",     3, "", bdlat_FormattingMode::e_DEC  },
+    { ATTRIBUTE_ID_EMAIL,   "email",   5, "", bdlat_FormattingMode::e_TEXT },
+    { ATTRIBUTE_ID_CHOICE,  "Choice",  6, "",
+                                         bdlat_FormattingMode::e_UNTAGGED },
+    { ATTRIBUTE_ID_STREET,  "street",  6, "", bdlat_FormattingMode::e_TEXT },
+    { ATTRIBUTE_ID_CITY,    "city",    4, "", bdlat_FormattingMode::e_TEXT },
+    { ATTRIBUTE_ID_COUNTRY, "country", 7, "", bdlat_FormattingMode::e_TEXT },
+    { ATTRIBUTE_ID_ZIP,     "zip",     3, "", bdlat_FormattingMode::e_TEXT }
+};
+
+int Record::s_numNameLookups = 0;
+
+const bdlat_AttributeInfo *Record::lookupAttributeInfo(int id)
+{
+    for (int i = 0; i < NUM_ATTRIBUTES; ++i) {
+        if (id == ATTRIBUTE_INFO_ARRAY[i].d_id) {
+            return &ATTRIBUTE_INFO_ARRAY[i];                          // RETURN
+        }
+    }
+    return 0;
+}
+
+const bdlat_AttributeInfo *Record::lookupAttributeInfo(const char *name,
+                                                       int         nameLength)
+{
+    ++s_numNameLookups;
+
+    if (bdlb::String::areEqualCaseless("pick1", name, nameLength) ||
+        bdlb::String::areEqualCaseless("pick2", name, nameLength)) {
+        return &ATTRIBUTE_INFO_ARRAY[3];                              // RETURN
+    }
+
+    for (int i = 0; i < NUM_ATTRIBUTES; ++i) {
+        const bdlat_AttributeInfo& info = ATTRIBUTE_INFO_ARRAY[i];
+
+        if (nameLength == info.d_nameLength &&
+            0 == bsl::memcmp(info.d_name_p, name, nameLength)) {
+            return &info;                                             // RETURN
+        }
+    }
+    return 0;
+}
+
+                                // ============
+                                // class Choice
+                                // ============
+
+/// This class is modeled after a generated "choice" type having no untagged
+/// selection.  The number of name-based lookups performed by the class is
+/// counted.
+class Choice {
+
+  public:
+    // TYPES
+    enum {
+        SELECTION_ID_UNDEFINED = -1,
+        SELECTION_ID_RED       = 0,
+        SELECTION_ID_GREEN     = 1,
+        SELECTION_ID_BLUE      = 4,
+        SELECTION_ID_CYAN      = 5,
+        SELECTION_ID_PINK      = 6,
+        SELECTION_ID_GOLD      = 7,
+        SELECTION_ID_BLACK     = 8,
+        SELECTION_ID_WHITE     = 9
+    };
+
+    enum { NUM_SELECTIONS = 8 };
+
+    // CONSTANTS
+    static const bdlat_SelectionInfo SELECTION_INFO_ARRAY[];
+
+    // CLASS DATA
+    static int s_numNameLookups;  // number of name-based lookups
+
+    // TRAITS
+    BSLALG_DECLARE_NESTED_TRAITS(Choice, bdlat_TypeTraitBasicChoice);
+
+    // DATA
+    int d_selectionId;
+
+    // CLASS METHODS
+    static const bdlat_SelectionInfo *lookupSelectionInfo(int id);
+    static const bdlat_SelectionInfo *lookupSelectionInfo(
+                                                       const char *name,
+                                                       int         nameLength);
+
+    // MANIPULATORS
+    int makeSelection(int id)
+    {
+        if (0 == lookupSelectionInfo(id)) {
+            return -1;                                                // RETURN
+        }
+        d_selectionId = id;
+        return 0;
+    }
+
+    int makeSelection(const char *name, int nameLength)
+    {
+        const bdlat_SelectionInfo *info = lookupSelectionInfo(name,
+                                                              nameLength);
+        if (0 == info) {
+            return -1;                                                // RETURN
+        }
+        return makeSelection(info->d_id);
+    }
+};
+
+const bdlat_SelectionInfo Choice::SELECTION_INFO_ARRAY[] = {
+    { SELECTION_ID_RED,   "red",   3, "", bdlat_FormattingMode::e_DEFAULT },
+    { SELECTION_ID_GREEN, "green", 5, "", bdlat_FormattingMode::e_DEFAULT },
+    { SELECTION_ID_BLUE,  "blue",  4, "", bdlat_FormattingMode::e_DEFAULT },
+    { SELECTION_ID_CYAN,  "cyan",  4, "", bdlat_FormattingMode::e_DEFAULT },
+    { SELECTION_ID_PINK,  "pink",  4, "", bdlat_FormattingMode::e_DEFAULT },
+    { SELECTION_ID_GOLD,  "gold",  4, "", bdlat_FormattingMode::e_DEFAULT },
+    { SELECTION_ID_BLACK, "black", 5, "", bdlat_FormattingMode::e_DEFAULT },
+    { SELECTION_ID_WHITE, "white", 5, "", bdlat_FormattingMode::e_DEFAULT }
+};
+
+int Choice::s_numNameLookups = 0;
+
+const bdlat_SelectionInfo *Choice::lookupSelectionInfo(int id)
+{
+    for (int i = 0; i < NUM_SELECTIONS; ++i) {
+        if (id == SELECTION_INFO_ARRAY[i].d_id) {
+            return &SELECTION_INFO_ARRAY[i];                          // RETURN
+        }
+    }
+    return 0;
+}
+
+const bdlat_SelectionInfo *Choice::lookupSelectionInfo(const char *name,
+                                                       int         nameLength)
+{
+    ++s_numNameLookups;
+
+    for (int i = 0; i < NUM_SELECTIONS; ++i) {
+        const bdlat_SelectionInfo& info = SELECTION_INFO_ARRAY[i];
+
+        if (nameLength == info.d_nameLength &&
+            0 == bsl::memcmp(info.d_name_p, name, nameLength)) {
+            return &info;                                             // RETURN
+        }
+    }
+    return 0;
+}
+
+                             // =================
+                             // class SmallRecord
+                             // =================
+
+/// This class is modeled after a generated "sequence" type declaring fewer
+/// than `NameLookupUtil::k_MIN_NUM_NAMES` attributes.  The number of
+/// name-based lookups performed by the class is counted.
+class SmallRecord {
+
+  public:
+    // TYPES
+    enum {
+        ATTRIBUTE_ID_KEY   = 0,
+        ATTRIBUTE_ID_VALUE = 1
+    };
+
+    enum { NUM_ATTRIBUTES = 2 };
+
+    // CONSTANTS
+    static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
+
+    // CLASS DATA
+    static int s_numNameLookups;  // number of name-based lookups
+
+    // TRAITS
+    BSLALG_DECLARE_NESTED_TRAITS(SmallRecord, bdlat_TypeTraitBasicSequence);
+
+    // DATA
+    int d_values[NUM_ATTRIBUTES];
+
+    // CLASS METHODS
+    static const bdlat_AttributeInfo *lookupAttributeInfo(
+                                                       const char *name,
+                                                       int         nameLength)
+    {
+        ++s_numNameLookups;
+
+        for (int i = 0; i < NUM_ATTRIBUTES; ++i) {
+            const bdlat_AttributeInfo& info = ATTRIBUTE_INFO_ARRAY[i];
+
+            if (nameLength == info.d_nameLength &&
+                0 == bsl::memcmp(info.d_name_p, name, nameLength)) {
+                return &info;                                         // RETURN
+            }
+        }
+        return 0;
+    }
+
+    // MANIPULATORS
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR& manipulator, int id)
+    {
+        if (id < 0 || NUM_ATTRIBUTES <= id) {
+            return -1;                                                // RETURN
+        }
+        return manipulator(&d_values[id], ATTRIBUTE_INFO_ARRAY[id]);
+    }
+
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR&  manipulator,
+                            const char   *name,
+                            int           nameLength)
+    {
+        const bdlat_AttributeInfo *info = lookupAttributeInfo(name,
+                                                              nameLength);
+        if (0 == info) {
+            return -1;                                                // RETURN
+        }
+        return manipulateAttribute(manipulator, info->d_id);
+    }
+};
+
+const bdlat_AttributeInfo SmallRecord::ATTRIBUTE_INFO_ARRAY[] = {
+    { ATTRIBUTE_ID_KEY,   "key",   3, "", bdlat_FormattingMode::e_TEXT },
+    { ATTRIBUTE_ID_VALUE, "value", 5, "", bdlat_FormattingMode::e_DEC  }
+};
+
+int SmallRecord::s_numNameLookups = 0;
+
+                                // ============
+                                // class Opaque
+                                // ============
+
+/// This class is a "sequence" type that, like a wrapper type, does not
+/// expose an `ATTRIBUTE_INFO_ARRAY`.  It has a single attribute, "value",
+/// having the id 1.
+class Opaque {
+
+  public:
+    // TYPES
+    enum { NUM_ATTRIBUTES = 1 };
+
+    // CLASS DATA
+    static int s_numNameLookups;  // number of name-based lookups
+
+    // TRAITS
+    BSLALG_DECLARE_NESTED_TRAITS(Opaque, bdlat_TypeTraitBasicSequence);
+
+    // DATA
+    int d_value;
+
+    // CLASS METHODS
+    static const bdlat_AttributeInfo *lookupAttributeInfo(
+                                                       const char *name,
+                                                       int         nameLength)
+    {
+        static const bdlat_AttributeInfo k_INFO = {
+            1, "value", 5, "", bdlat_FormattingMode::e_DEC
+        };
+
+        ++s_numNameLookups;
+        return 5 == nameLength && 0 == bsl::memcmp("value", name, 5)
+               ? &k_INFO
+               : 0;
+    }
+
+    // MANIPULATORS
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR&  manipulator,
+                            const char   *name,
+                            int           nameLength)
+    {
+        const bdlat_AttributeInfo *info = lookupAttributeInfo(name,
+                                                              nameLength);
+        if (0 == info) {
+            return -1;                                                // RETURN
+        }
+        return manipulator(&d_value, *info);
+    }
+};
+
+int Opaque::s_numNameLookups = 0;
+
+                                // ===========
+                                // struct Tags
+                                // ===========
+
+/// This `struct` is not a "sequence" type, but declares the static members
+/// of one.
+struct Tags {
+    enum { NUM_ATTRIBUTES = 1 };
+    static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
+};
+
+const bdlat_AttributeInfo Tags::ATTRIBUTE_INFO_ARRAY[] = {
+    { 1, "tag", 3, "", bdlat_FormattingMode::e_TEXT }
+};
+
+                          // ==========================
+                          // struct RecordingManipulator
+                          // ==========================
+
+/// This manipulator records the id of, and the address passed for, the
+/// attribute it is invoked on.
+struct RecordingManipulator {
+
+    // DATA
+    int  d_id;
+    int *d_address_p;
+
+    // MANIPULATORS
+    int operator()(int *address, const bdlat_AttributeInfo& info)
+    {
+        d_id        = info.d_id;
+        d_address_p = address;
+        return 0;
+    }
+};
+
+}  // close namespace test
+
+namespace {
+namespace u {
+
+/// Load into the specified `infos` an attribute info for each of the
+/// specified `names`, having the id `i * 3 + 1` for the `i`th name.
+void loadInfos(bsl::vector<bdlat_AttributeInfo> *infos,
+               const bsl::vector<bsl::string>&   names)
+{
+    infos->clear();
+    for (bsl::size_t i = 0; i < names.size(); ++i) {
+        const bdlat_AttributeInfo info = {
+            static_cast<int>(i * 3 + 1),
+            names[i].c_str(),
+            static_cast<int>(names[i].length()),
+            "",
+            bdlat_FormattingMode::e_DEFAULT
+        };
+        infos->push_back(info);
+    }
+}
+
+/// Return the id of the specified `name` in the specified `infos` array
+/// having the specified `numInfos` elements using a linear search, or -1 if
+/// `name` is not found.
+int linearFind(const bdlat_AttributeInfo *infos,
+               int                        numInfos,
+               const char                *name,
+               int                        nameLength)
+{
+    for (int i = 0; i < numInfos; ++i) {
+        if (nameLength == infos[i].d_nameLength &&
+            0 == bsl::memcmp(infos[i].d_name_p, name, nameLength)) {
+            return infos[i].d_id;                                     // RETURN
+        }
+    }
+    return -1;
+}
+
+/// Load into the specified `names` the specified `count` names formed by
+/// appending a number to the specified `prefix`.
+void makeNames(bsl::vector<bsl::string> *names,
+               const char               *prefix,
+               int                       count)
+{
+    names->clear();
+    for (int i = 0; i < count; ++i) {
+        char buffer[32];
+        bsl::sprintf(buffer, "%d", i);
+        names->push_back(bsl::string(prefix) + buffer);
+    }
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+///Example 2: Manipulating an Attribute by Name
+/// - - - - - - - - - - - - - - - - - - - - - -
+// A decoder that reads an element name from its input and must decode the
+// element's value into the corresponding attribute of a sequence can call
+// `bdlat::NameLookupUtil::manipulateAttribute` where it would otherwise call
+// `bdlat_SequenceFunctions::manipulateAttribute`:
+// ```
+template <class TYPE, class MANIPULATOR>
+int decodeElement(TYPE               *object,
+                  MANIPULATOR&        manipulator,
+                  const bsl::string&  elementName)
+{
+    if (!bdlat::NameLookupUtil::hasAttribute(
+                                   *object,
+                                   elementName.data(),
+                                   static_cast<int>(elementName.length()))) {
+        return -1;                                                    // RETURN
+    }
+    return bdlat::NameLookupUtil::manipulateAttribute(
+                                    object,
+                                    manipulator,
+                                    elementName.data(),
+                                    static_cast<int>(elementName.length()));
+}
+// ```
+
+}  // close namespace usage
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+
+    BSLA_MAYBE_UNUSED const bool             verbose = argc > 2;
+    BSLA_MAYBE_UNUSED const bool         veryVerbose = argc > 3;
+    BSLA_MAYBE_UNUSED const bool     veryVeryVerbose = argc > 4;
+    BSLA_MAYBE_UNUSED const bool veryVeryVeryVerbose = argc > 5;
+
+    bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;
+
+    // CONCERN: `BSLS_REVIEW` failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // The per-type tables of `NameLookupUtil` are (intentionally) allocated
+    // from the global allocator and never released, so the global allocator
+    // is not replaced by a test allocator.
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nUSAGE EXAMPLE"
+                               << "\n=============" << bsl::endl;
+
+///Example 1: Looking Up Attribute Names
+///- - - - - - - - - - - - - - - - - - -
+// Suppose we have an array of `bdlat_AttributeInfo` objects describing the
+// attributes of a sequence type:
+// ```
+        const bdlat_AttributeInfo INFO[] = {
+            { 1, "name",  4, "", bdlat_FormattingMode::e_TEXT },
+            { 2, "age",   3, "", bdlat_FormattingMode::e_DEC  },
+            { 5, "email", 5, "", bdlat_FormattingMode::e_TEXT }
+        };
+// ```
+// First, we load a `bdlat::NameLookup` from the array:
+// ```
+        bdlat::NameLookup lookup;
+        lookup.reset(INFO, 3);
+        ASSERT(3 == lookup.numNames());
+// ```
+// Now, we look up names in the table:
+// ```
+        int id;
+        ASSERT(0 == lookup.find(&id, "email", 5));
+        ASSERT(5  == id);
+        ASSERT(0 == lookup.find(&id, "age", 3));
+        ASSERT(2  == id);
+// ```
+// Finally, we observe that a name that is not in the table is not found:
+// ```
+        ASSERT(0 != lookup.find(&id, "phone", 5));
+        ASSERT(0 != lookup.find(&id, "ag",    2));
+// ```
+
+        test::Record               record;
+        test::RecordingManipulator manipulator = { 0, 0 };
+
+        ASSERT(0 == usage::decodeElement(&record, manipulator, "email"));
+        ASSERT(test::Record::ATTRIBUTE_ID_EMAIL == manipulator.d_id);
+        ASSERT(0 != usage::decodeElement(&record, manipulator, "phone"));
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // SELECTION LOOKUP
+        //
+        // Concerns:
+        // 1. `hasSelection` and `makeSelection` return the same results as
+        //    the like-named functions of `bdlat_ChoiceFunctions` for every
+        //    selection name, and for names that are not selection names.
+        //
+        // 2. Selection names are resolved by the table, without calling the
+        //    name-based functions of the type.
+        //
+        // 3. As the type has no untagged selection, names not in the table
+        //    are not passed on to the type.
+        //
+        // Plan:
+        // 1. For a table of names, invoke both sets of functions on
+        //    `test::Choice` and compare the results and the resulting
+        //    selection.  (C-1)
+        //
+        // 2. Count the name-based lookups of `test::Choice`.  (C-2..3)
+        //
+        // Testing:
+        //   bool hasSelection(const TYPE&, const char *, int);
+        //   int makeSelection(TYPE *, const char *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nSELECTION LOOKUP"
+                               << "\n================" << bsl::endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_name_p;
+            bool        d_inTable;
+        } DATA[] = {
+            // LINE  NAME      IN TABLE
+            // ----  -------   --------
+            { L_,    "red",    true    },
+            { L_,    "green",  true    },
+            { L_,    "blue",   true    },
+            { L_,    "pink",   true    },
+            { L_,    "white",  true    },
+            { L_,    "Red",    false   },
+            { L_,    "gree",   false   },
+            { L_,    "",       false   },
+            { L_,    "purple", false   },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE     = DATA[ti].d_line;
+            const char *NAME     = DATA[ti].d_name_p;
+            const int   LENGTH   = static_cast<int>(bsl::strlen(NAME));
+            const bool  IN_TABLE = DATA[ti].d_inTable;
+
+            test::Choice mX = { test::Choice::SELECTION_ID_UNDEFINED };
+            test::Choice mY = { test::Choice::SELECTION_ID_UNDEFINED };
+
+            const bool EXP_HAS = bdlat_ChoiceFunctions::hasSelection(mY,
+                                                                     NAME,
+                                                                     LENGTH);
+            const int  EXP_RC  = bdlat_ChoiceFunctions::makeSelection(&mY,
+                                                                      NAME,
+                                                                      LENGTH);
+
+            test::Choice::s_numNameLookups = 0;
+
+            ASSERTV(LINE, EXP_HAS == Util::hasSelection(mX, NAME, LENGTH));
+            ASSERTV(LINE, EXP_RC  == Util::makeSelection(&mX, NAME, LENGTH));
+            ASSERTV(LINE, mY.d_selectionId == mX.d_selectionId);
+
+            ASSERTV(LINE, IN_TABLE == EXP_HAS);
+            ASSERTV(LINE, test::Choice::s_numNameLookups,
+                    0 == test::Choice::s_numNameLookups);
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ATTRIBUTE LOOKUP
+        //
+        // Concerns:
+        // 1. `hasAttribute` and `manipulateAttribute` return the same results
+        //    as the like-named functions of `bdlat_SequenceFunctions`, and
+        //    invoke the manipulator on the same attribute, for every
+        //    attribute name, for names accepted only by the type (the
+        //    caseless selection names of an anonymous choice), and for
+        //    names that are not accepted.
+        //
+        // 2. Attribute names are resolved by the table, without calling the
+        //    name-based functions of the type.
+        //
+        // 3. As the type has an untagged attribute, names not in the table
+        //    are passed on to the type.
+        //
+        // 4. The functions simply forward to `bdlat_SequenceFunctions` for a
+        //    type that does not support a table, and for a type declaring
+        //    fewer than `k_MIN_NUM_NAMES` attributes.
+        //
+        // 5. The table is allocated from the global allocator.
+        //
+        // Plan:
+        // 1. For a table of names, invoke both sets of functions on
+        //    `test::Record` and compare the results and the id and address
+        //    recorded by the manipulator.  (C-1)
+        //
+        // 2. Count the name-based lookups of `test::Record`.  (C-2..3)
+        //
+        // 3. Repeat P-1..2 for `test::Opaque` and `test::SmallRecord`,
+        //    expecting every lookup to be passed on.  (C-4)
+        //
+        // 4. Verify that the global allocator, and not the default
+        //    allocator, was used.  (C-5)
+        //
+        // Testing:
+        //   bool hasAttribute(const TYPE&, const char *, int);
+        //   int manipulateAttribute(TYPE *, MANIPULATOR&, const char *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nATTRIBUTE LOOKUP"
+                               << "\n================" << bsl::endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_name_p;
+            bool        d_inTable;
+        } DATA[] = {
+            // LINE  NAME       IN TABLE
+            // ----  --------   --------
+            { L_,    "name",    true    },
+            { L_,    "age",     true    },
+            { L_,    "email",   true    },
+            { L_,    "Choice",  true    },
+            { L_,    "street",  true    },
+            { L_,    "zip",     true    },
+            { L_,    "pick1",   false   },
+            { L_,    "PICK2",   false   },
+            { L_,    "Pick2",   false   },
+            { L_,    "Name",    false   },
+            { L_,    "nam",     false   },
+            { L_,    "names",   false   },
+            { L_,    "",        false   },
+            { L_,    "value",   false   },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        if (verbose) bsl::cout << "\tGenerated-like type." << bsl::endl;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE     = DATA[ti].d_line;
+            const char *NAME     = DATA[ti].d_name_p;
+            const int   LENGTH   = static_cast<int>(bsl::strlen(NAME));
+            const bool  IN_TABLE = DATA[ti].d_inTable;
+
+            test::Record mX = {};
+            test::Record mY = {};
+
+            test::RecordingManipulator expected = { -1, 0 };
+            test::RecordingManipulator actual   = { -1, 0 };
+
+            const bool EXP_HAS = bdlat_SequenceFunctions::hasAttribute(
+                                                                       mY,
+                                                                       NAME,
+                                                                       LENGTH);
+            const int  EXP_RC  = bdlat_SequenceFunctions::manipulateAttribute(
+                                                                      &mY,
+                                                                      expected,
+                                                                      NAME,
+                                                                      LENGTH);
+
+            test::Record::s_numNameLookups = 0;
+
+            ASSERTV(LINE, EXP_HAS == Util::hasAttribute(mX, NAME, LENGTH));
+            ASSERTV(LINE, EXP_RC  == Util::manipulateAttribute(&mX,
+                                                               actual,
+                                                               NAME,
+                                                               LENGTH));
+            ASSERTV(LINE, expected.d_id == actual.d_id);
+            ASSERTV(LINE, (0 == expected.d_address_p) ==
+                                                   (0 == actual.d_address_p));
+            if (expected.d_address_p) {
+                ASSERTV(LINE, expected.d_address_p - mY.d_values ==
+                                            actual.d_address_p - mX.d_values);
+            }
+
+            ASSERTV(LINE, test::Record::s_numNameLookups,
+                    (IN_TABLE ? 0 : 2) == test::Record::s_numNameLookups);
+        }
+
+        if (verbose) bsl::cout << "\tType without a table." << bsl::endl;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE   = DATA[ti].d_line;
+            const char *NAME   = DATA[ti].d_name_p;
+            const int   LENGTH = static_cast<int>(bsl::strlen(NAME));
+
+            test::Opaque mX = { 0 };
+
+            test::RecordingManipulator actual = { -1, 0 };
+
+            const bool EXP_HAS = 0 == bsl::strcmp("value", NAME);
+
+            test::Opaque::s_numNameLookups = 0;
+
+            ASSERTV(LINE, EXP_HAS == Util::hasAttribute(mX, NAME, LENGTH));
+            ASSERTV(LINE, EXP_HAS == (0 == Util::manipulateAttribute(&mX,
+                                                                     actual,
+                                                                     NAME,
+                                                                     LENGTH)));
+            ASSERTV(LINE, EXP_HAS == (&mX.d_value == actual.d_address_p));
+            ASSERTV(LINE, 2 == test::Opaque::s_numNameLookups);
+        }
+
+        if (verbose) bsl::cout << "\tType with few attributes." << bsl::endl;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE   = DATA[ti].d_line;
+            const char *NAME   = DATA[ti].d_name_p;
+            const int   LENGTH = static_cast<int>(bsl::strlen(NAME));
+
+            test::SmallRecord mX = {};
+
+            test::RecordingManipulator actual = { -1, 0 };
+
+            const bool EXP_HAS = 0 == bsl::strcmp("value", NAME);
+
+            test::SmallRecord::s_numNameLookups = 0;
+
+            ASSERTV(LINE, EXP_HAS == Util::hasAttribute(mX, NAME, LENGTH));
+            ASSERTV(LINE, EXP_HAS == (0 == Util::manipulateAttribute(&mX,
+                                                                     actual,
+                                                                     NAME,
+                                                                     LENGTH)));
+            ASSERTV(LINE, EXP_HAS == (&mX.d_values[1] == actual.d_address_p));
+            ASSERTV(LINE, 2 == test::SmallRecord::s_numNameLookups);
+        }
+
+        if (verbose) bsl::cout << "\tMemory." << bsl::endl;
+        {
+            const Obj *LOOKUP = Util::attributeLookup<test::Record>();
+
+            ASSERT(bslma::Default::globalAllocator() == LOOKUP->allocator());
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TABLE SELECTION
+        //
+        // Concerns:
+        // 1. A table is used exactly for "sequence" (respectively, "choice")
+        //    types that have the basic-sequence (respectively, basic-choice)
+        //    trait, expose the info array and count of their elements, and
+        //    declare at least `k_MIN_NUM_NAMES` elements.
+        //
+        // 2. The table of a type holds the names of its info array, and is
+        //    the same object on each call.
+        //
+        // Plan:
+        // 1. Check the metafunctions, and the tables returned, for types
+        //    having, and lacking, the trait and the static members, and
+        //    declaring fewer than `k_MIN_NUM_NAMES` elements.  (C-1)
+        //
+        // 2. Look up each name of the tables returned for `test::Record` and
+        //    `test::Choice`.  (C-2)
+        //
+        // Testing:
+        //   NameLookupUtil::k_MIN_NUM_NAMES
+        //   NameLookupUtil::HasAttributeLookup<TYPE>
+        //   NameLookupUtil::HasSelectionLookup<TYPE>
+        //   const NameLookup *attributeLookup<TYPE>();
+        //   const NameLookup *selectionLookup<TYPE>();
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nTABLE SELECTION"
+                               << "\n===============" << bsl::endl;
+
+        ASSERT(8 == Util::k_MIN_NUM_NAMES);
+        ASSERT(Util::k_MIN_NUM_NAMES <= test::Record::NUM_ATTRIBUTES);
+        ASSERT(Util::k_MIN_NUM_NAMES <= test::Choice::NUM_SELECTIONS);
+        ASSERT(Util::k_MIN_NUM_NAMES >  test::SmallRecord::NUM_ATTRIBUTES);
+
+        ASSERT( Util::HasAttributeLookup<test::Record>::value);
+        ASSERT( Util::HasAttributeLookup<test::SmallRecord>::value);
+        ASSERT(!Util::HasAttributeLookup<test::Opaque>::value);
+        ASSERT(!Util::HasAttributeLookup<test::Tags>::value);
+        ASSERT(!Util::HasAttributeLookup<test::Choice>::value);
+        ASSERT(!Util::HasAttributeLookup<int>::value);
+
+        ASSERT( Util::HasSelectionLookup<test::Choice>::value);
+        ASSERT(!Util::HasSelectionLookup<test::Record>::value);
+        ASSERT(!Util::HasSelectionLookup<int>::value);
+
+        ASSERT(0 == Util::attributeLookup<test::Opaque>());
+        ASSERT(0 == Util::attributeLookup<test::SmallRecord>());
+        ASSERT(0 == Util::selectionLookup<test::Record>());
+
+        const Obj *ATTRIBUTES = Util::attributeLookup<test::Record>();
+        const Obj *SELECTIONS = Util::selectionLookup<test::Choice>();
+
+        ASSERT(0 != ATTRIBUTES);
+        ASSERT(0 != SELECTIONS);
+        ASSERT(ATTRIBUTES == Util::attributeLookup<test::Record>());
+        ASSERT(SELECTIONS == Util::selectionLookup<test::Choice>());
+        ASSERT(bslma::Default::globalAllocator() == ATTRIBUTES->allocator());
+        ASSERT( ATTRIBUTES->hasUntaggedElement());
+        ASSERT(!SELECTIONS->hasUntaggedElement());
+
+        ASSERT(test::Record::NUM_ATTRIBUTES == ATTRIBUTES->numNames());
+        for (int i = 0; i < test::Record::NUM_ATTRIBUTES; ++i) {
+            const bdlat_AttributeInfo& INFO =
+                                      test::Record::ATTRIBUTE_INFO_ARRAY[i];
+
+            int id = -1;
+            ASSERTV(i, 0 == ATTRIBUTES->find(&id,
+                                             INFO.d_name_p,
+                                             INFO.d_nameLength));
+            ASSERTV(i, INFO.d_id == id);
+        }
+
+        ASSERT(test::Choice::NUM_SELECTIONS == SELECTIONS->numNames());
+        for (int i = 0; i < test::Choice::NUM_SELECTIONS; ++i) {
+            const bdlat_SelectionInfo& INFO =
+                                      test::Choice::SELECTION_INFO_ARRAY[i];
+
+            int id = -1;
+            ASSERTV(i, 0 == SELECTIONS->find(&id,
+                                             INFO.d_name_p,
+                                             INFO.d_nameLength));
+            ASSERTV(i, INFO.d_id == id);
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // `NameLookup`
+        //
+        // Concerns:
+        // 1. After `reset`, `find` finds every name of the info array, with
+        //    its id, and finds no other string, including prefixes and
+        //    extensions of the names and strings differing in one character.
+        //
+        // 2. Construction of a perfect table succeeds for collision-prone
+        //    and large name sets, using at most 16 slots per name.
+        //
+        // 3. The id of the first occurrence of a duplicated name is found.
+        //
+        // 4. An empty table finds nothing; an empty name can be looked up.
+        //
+        // 5. `reset` replaces the previous contents.
+        //
+        // 6. Memory comes from the supplied allocator.
+        //
+        // 7. Both `reset` overloads load the same table.
+        //
+        // 8. `hasUntaggedElement` reports whether an element of the info
+        //    array last loaded has the `e_UNTAGGED` formatting mode.
+        //
+        // 9. QoI: Asserted precondition violations are detected when
+        //    enabled.
+        //
+        // Plan:
+        // 1. For a number of name sets, load a `NameLookup` and look up every
+        //    name, every proper prefix, every name with one extra character,
+        //    and every name with one character changed; compare against a
+        //    linear search.  (C-1..2, 6)
+        //
+        // 2. Load tables having duplicates, no names, and an empty name.
+        //    (C-3..5)
+        //
+        // 3. Load a table from an equivalent selection info array.  (C-7)
+        //
+        // 4. Load tables from info arrays having, and lacking, an untagged
+        //    element.  (C-8)
+        //
+        // 5. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-9)
+        //
+        // Testing:
+        //   NameLookup(bslma::Allocator *basicAllocator = 0);
+        //   void reset(const bdlat_AttributeInfo *, int);
+        //   void reset(const bdlat_SelectionInfo *, int);
+        //   int find(int *id, const char *name, int nameLength) const;
+        //   bool hasUntaggedElement() const;
+        //   bool isPerfect() const;
+        //   int numNames() const;
+        //   int tableSize() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\n`NameLookup`"
+                               << "\n============" << bsl::endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        bsl::vector<bsl::vector<bsl::string> > nameSets;
+        bsl::vector<bsl::string>               names;
+
+        const char *const SIMPLE[] = {
+            "a", "b", "ab", "ba", "abc", "id", "ID", "Id", "iD", "x",
+            "selection1", "selection2", "selection3", "selection10",
+            "SimpleElement", "simpleElement", "element1", "element10",
+        };
+        names.assign(SIMPLE, SIMPLE + sizeof SIMPLE / sizeof *SIMPLE);
+        nameSets.push_back(names);
+
+        for (int count = 1; count <= 40; ++count) {
+            u::makeNames(&names, "element", count);
+            nameSets.push_back(names);
+        }
+
+        u::makeNames(&names, "aVeryLongCommonPrefixForEveryAttributeName_",
+                     150);
+        nameSets.push_back(names);
+
+        u::makeNames(&names, "", 1000);
+        nameSets.push_back(names);
+
+        names.clear();
+        for (char c0 = 'a'; c0 <= 'z'; ++c0) {
+            for (char c1 = 'a'; c1 <= 'z'; ++c1) {
+                names.push_back(bsl::string(1, c0) + c1);
+            }
+        }
+        nameSets.push_back(names);
+
+        for (bsl::size_t ti = 0; ti < nameSets.size(); ++ti) {
+            const bsl::vector<bsl::string>& NAMES = nameSets[ti];
+            const int NUM_NAMES = static_cast<int>(NAMES.size());
+
+            bsl::vector<bdlat_AttributeInfo> infos;
+            u::loadInfos(&infos, NAMES);
+
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERTV(ti, &oa == X.allocator());
+
+            mX.reset(infos.data(), NUM_NAMES);
+
+            if (veryVerbose) {
+                T_ P_(ti) P_(X.numNames()) P(X.tableSize())
+            }
+
+            ASSERTV(ti, X.isPerfect());
+            ASSERTV(ti, NUM_NAMES == X.numNames());
+            ASSERTV(ti, X.tableSize(), X.tableSize() <= 16 * NUM_NAMES);
+
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                const bsl::string& NAME = NAMES[i];
+                const int          LEN  = static_cast<int>(NAME.length());
+
+                int id = -1;
+                ASSERTV(ti, NAME, 0 == X.find(&id, NAME.data(), LEN));
+                ASSERTV(ti, NAME, id, i * 3 + 1 == id);
+
+                bsl::vector<bsl::string> probes;
+                for (int k = 0; k < LEN; ++k) {
+                    probes.push_back(NAME.substr(0, k));
+
+                    bsl::string changed(NAME);
+                    changed[k] = static_cast<char>(changed[k] ^ 0x01);
+                    probes.push_back(changed);
+                }
+                probes.push_back(NAME + "x");
+                probes.push_back(NAME + '\0');
+
+                for (bsl::size_t k = 0; k < probes.size(); ++k) {
+                    const bsl::string& PROBE = probes[k];
+                    const int          PLEN  =
+                                            static_cast<int>(PROBE.length());
+                    const int          EXP   = u::linearFind(infos.data(),
+                                                             NUM_NAMES,
+                                                             PROBE.data(),
+                                                             PLEN);
+
+                    id = -1;
+                    const int rc = X.find(&id, PROBE.data(), PLEN);
+                    ASSERTV(ti, PROBE, (-1 == EXP) == (0 != rc));
+                    ASSERTV(ti, PROBE, EXP == id);
+                }
+            }
+        }
+        ASSERT(0 < oa.numBlocksTotal());
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) bsl::cout << "\tDuplicates, empty tables, and reset."
+                               << bsl::endl;
+        {
+            const bdlat_AttributeInfo INFO[] = {
+                { 1, "",    0, "", bdlat_FormattingMode::e_DEFAULT },
+                { 2, "dup", 3, "", bdlat_FormattingMode::e_DEFAULT },
+                { 3, "dup", 3, "", bdlat_FormattingMode::e_DEFAULT },
+                { 4, "one", 3, "", bdlat_FormattingMode::e_DEFAULT },
+            };
+
+            Obj mX;  const Obj& X = mX;
+            ASSERT(&defaultAllocator == X.allocator());
+
+            int id = -1;
+            ASSERT(0 == X.numNames());
+            ASSERT(0 != X.find(&id, "", 0));
+            ASSERT(0 != X.find(&id, "dup", 3));
+            ASSERT(-1 == id);
+
+            mX.reset(INFO, 4);
+            ASSERT(3 == X.numNames());
+            ASSERT(0 == X.find(&id, "", 0));    ASSERT(1 == id);
+            ASSERT(0 == X.find(&id, "dup", 3)); ASSERT(2 == id);
+            ASSERT(0 == X.find(&id, "one", 3)); ASSERT(4 == id);
+
+            mX.reset(INFO + 2, 1);
+            ASSERT(1 == X.numNames());
+            ASSERT(0 == X.find(&id, "dup", 3)); ASSERT(3 == id);
+            ASSERT(0 != X.find(&id, "one", 3));
+            ASSERT(0 != X.find(&id, "", 0));
+
+            mX.reset(INFO, 0);
+            ASSERT(0 == X.numNames());
+            ASSERT(0 != X.find(&id, "dup", 3));
+        }
+
+        if (verbose) bsl::cout << "\tSelection infos." << bsl::endl;
+        {
+            bsl::vector<bsl::string> NAMES;
+            u::makeNames(&NAMES, "selection", 25);
+
+            bsl::vector<bdlat_SelectionInfo> infos;
+            for (bsl::size_t i = 0; i < NAMES.size(); ++i) {
+                const bdlat_SelectionInfo info = {
+                    static_cast<int>(i) * 2,
+                    NAMES[i].c_str(),
+                    static_cast<int>(NAMES[i].length()),
+                    "",
+                    bdlat_FormattingMode::e_DEFAULT
+                };
+                infos.push_back(info);
+            }
+
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.reset(infos.data(), static_cast<int>(infos.size()));
+            ASSERT(25 == X.numNames());
+
+            for (bsl::size_t i = 0; i < NAMES.size(); ++i) {
+                int id = -1;
+                ASSERTV(i, 0 == X.find(&id,
+                                       NAMES[i].data(),
+                                       static_cast<int>(NAMES[i].length())));
+                ASSERTV(i, static_cast<int>(i) * 2 == id);
+            }
+        }
+
+        if (verbose) bsl::cout << "\tUntagged elements." << bsl::endl;
+        {
+            const bdlat_AttributeInfo ATTRIBUTES[] = {
+                { 1, "one", 3, "", bdlat_FormattingMode::e_DEFAULT },
+                { 2, "two", 3, "", bdlat_FormattingMode::e_DEFAULT
+                                 | bdlat_FormattingMode::e_UNTAGGED },
+            };
+            const bdlat_SelectionInfo SELECTIONS[] = {
+                { 1, "one", 3, "", bdlat_FormattingMode::e_DEFAULT },
+                { 2, "two", 3, "", bdlat_FormattingMode::e_UNTAGGED },
+            };
+
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(!X.hasUntaggedElement());
+
+            mX.reset(ATTRIBUTES, 2);
+            ASSERT( X.hasUntaggedElement());
+
+            mX.reset(ATTRIBUTES, 1);
+            ASSERT(!X.hasUntaggedElement());
+
+            mX.reset(SELECTIONS, 2);
+            ASSERT( X.hasUntaggedElement());
+
+            mX.reset(SELECTIONS, 1);
+            ASSERT(!X.hasUntaggedElement());
+
+            mX.reset(ATTRIBUTES + 1, 1);
+            ASSERT( X.hasUntaggedElement());
+
+            mX.reset(ATTRIBUTES, 0);
+            ASSERT(!X.hasUntaggedElement());
+        }
+
+        if (verbose) bsl::cout << "\tNegative testing." << bsl::endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const bdlat_AttributeInfo INFO[] = {
+                { 1, "one", 3, "", bdlat_FormattingMode::e_DEFAULT },
+            };
+
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.reset(INFO, 1);
+
+            int id;
+            ASSERT_PASS(X.find(&id, "one", 3));
+            ASSERT_FAIL(X.find(0,   "one", 3));
+            ASSERT_FAIL(X.find(&id, "one", -1));
+            ASSERT_FAIL(X.find(&id, 0,     3));
+
+            ASSERT_PASS(mX.reset(INFO, 0));
+            ASSERT_FAIL(mX.reset(INFO, -1));
+            ASSERT_FAIL(mX.reset(static_cast<bdlat_AttributeInfo *>(0), 1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Load a table and look up names; look up names of a
+        //    generated-like type through the utility.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nBREATHING TEST"
+                               << "\n==============" << bsl::endl;
+
+        Obj mX;  const Obj& X = mX;
+        mX.reset(test::Record::ATTRIBUTE_INFO_ARRAY,
+                 test::Record::NUM_ATTRIBUTES);
+
+        int id = 0;
+        ASSERT(0 == X.find(&id, "age", 3));
+        ASSERT(test::Record::ATTRIBUTE_ID_AGE == id);
+        ASSERT(0 != X.find(&id, "pick1", 5));
+
+        test::Record record = {};
+        ASSERT( Util::hasAttribute(record, "email", 5));
+        ASSERT( Util::hasAttribute(record, "pick1", 5));
+        ASSERT(!Util::hasAttribute(record, "phone", 5));
+
+        test::Choice choice = { test::Choice::SELECTION_ID_UNDEFINED };
+        ASSERT(0 == Util::makeSelection(&choice, "green", 5));
+        ASSERT(test::Choice::SELECTION_ID_GREEN == choice.d_selectionId);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: `find` VS. LINEAR SEARCH
+        //
+        // Concerns:
+        // 1. `find` is faster than the linear search performed by generated
+        //    types for `NameLookupUtil::k_MIN_NUM_NAMES` or more names, and
+        //    its cost does not grow with the number of names.
+        //
+        // Plan:
+        // 1. For name sets of several sizes, time looking up every name
+        //    (round-robin) with `find` and with a linear search.  The
+        //    optional second argument gives the number of lookups.
+        //
+        // Testing:
+        //   PERFORMANCE: `find` VS. LINEAR SEARCH
+        // --------------------------------------------------------------------
+
+        bsl::cout << "\nPERFORMANCE: `find` VS. LINEAR SEARCH"
+                  << "\n=====================================" << bsl::endl;
+
+        const int NUM_LOOKUPS = argc > 2 ? bsl::atoi(argv[2]) : 10000000;
+
+        const int SIZES[] = { 2, 4, 6, 8, 12, 19, 50, 150 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const int NUM_NAMES = SIZES[si];
+
+            bsl::vector<bsl::string> names;
+            u::makeNames(&names, "attribute", NUM_NAMES);
+
+            bsl::vector<bdlat_AttributeInfo> infos;
+            u::loadInfos(&infos, names);
+
+            Obj mX;  const Obj& X = mX;
+            mX.reset(infos.data(), NUM_NAMES);
+
+            bsls::Types::Int64 sum = 0;
+            bsls::Stopwatch    timer;
+
+            timer.start(true);
+            for (int i = 0; i < NUM_LOOKUPS; ++i) {
+                const bsl::string& NAME = names[i % NUM_NAMES];
+
+                int id = 0;
+                X.find(&id, NAME.data(), static_cast<int>(NAME.length()));
+                sum += id;
+            }
+            timer.stop();
+            const double findTime = timer.accumulatedUserTime();
+
+            timer.reset();
+            timer.start(true);
+            for (int i = 0; i < NUM_LOOKUPS; ++i) {
+                const bsl::string& NAME = names[i % NUM_NAMES];
+
+                sum -= u::linearFind(infos.data(),
+                                     NUM_NAMES,
+                                     NAME.data(),
+                                     static_cast<int>(NAME.length()));
+            }
+            timer.stop();
+            const double linearTime = timer.accumulatedUserTime();
+
+            ASSERTV(sum, 0 == sum);
+
+            bsl::printf("%4d names: find %6.2f ns, linear %7.2f ns"
+                        " (table size %d)\n",
+                        NUM_NAMES,
+                        findTime * 1e9 / NUM_LOOKUPS,
+                        linearTime * 1e9 / NUM_LOOKUPS,
+                        X.tableSize());
+        }
+      } break;
+      default: {
+        bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        bsl::cerr << "Error, non-zero test status = " << testStatus << "."
+                  << bsl::endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
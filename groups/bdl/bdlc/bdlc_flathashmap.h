@@ -48,6 +48,16 @@ BSLS_IDENT("$Id: $")
 // before using `bdlc::FlatHashMap` -- particularly on non-Intel production
 // environments.
 //
+///Batch Lookup
+///------------
+// When a map is larger than the processor caches, a lookup is dominated by
+// the latency of the cache misses on the control values and on the entry
+// holding the key, and `find` incurs these misses one after another.
+// `findBatch` looks up an array of keys, hashing a batch of keys and
+// prefetching the memory their lookups access before probing for any of them,
+// so that the cache misses of the lookups of a batch are serviced
+// concurrently.  The results are identical to invoking `find` for each key.
+//
 ///Interface Differences with `unordered_map`
 ///------------------------------------------
 // A `bdlc::FlatHashMap` meets most of the requirements of an unordered
@@ -768,6 +778,34 @@ class FlatHashMap {
     /// this map.
     iterator find(const KEY& key);
 
+    /// Load into each of the specified `numKeys` elements of the specified
+    /// `results` array an iterator referring to the modifiable element in
+    /// this map having the corresponding element of the specified `keys`
+    /// array, or `end()` if no such entry exists in this map.  The behavior
+    /// is undefined unless `results` and `keys` each have at least
+    /// `numKeys` elements.  See {Batch Lookup}.
+    void findBatch(iterator *results, const KEY *keys, bsl::size_t numKeys);
+
+    /// Load into each of the specified `numKeys` elements of the specified
+    /// `results` array an iterator referring to the modifiable element in
+    /// this map having the key equivalent to the corresponding element of
+    /// the specified `keys` array, or `end()` if no such entry exists in
+    /// this map.  The behavior is undefined unless `results` and `keys`
+    /// each have at least `numKeys` elements.  See {Batch Lookup}.
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+            BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+         && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value
+          , void>::type
+    findBatch(iterator          *results,
+              const LOOKUP_KEY  *keys,
+              bsl::size_t        numKeys)
+    {
+        // Note: implemented inline due to Sun CC compilation error.
+
+        d_impl.findBatch(results, keys, numKeys);
+    }
+
     /// Return an `iterator` referring to the modifiable element in this map
     /// having the key equivalent to the specified `key`, or `end()` if no such
     /// entry exists in this map.
@@ -1203,6 +1241,36 @@ class FlatHashMap {
     /// this map.
     const_iterator find(const KEY& key) const;
 
+    /// Load into each of the specified `numKeys` elements of the specified
+    /// `results` array a `const_iterator` referring to the element in this
+    /// map having the corresponding element of the specified `keys` array,
+    /// or `end()` if no such entry exists in this map.  The behavior is
+    /// undefined unless `results` and `keys` each have at least `numKeys`
+    /// elements.  See {Batch Lookup}.
+    void findBatch(const_iterator *results,
+                   const KEY      *keys,
+                   bsl::size_t     numKeys) const;
+
+    /// Load into each of the specified `numKeys` elements of the specified
+    /// `results` array a `const_iterator` referring to the element in this
+    /// map having the key equivalent to the corresponding element of the
+    /// specified `keys` array, or `end()` if no such entry exists in this
+    /// map.  The behavior is undefined unless `results` and `keys` each
+    /// have at least `numKeys` elements.  See {Batch Lookup}.
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+            BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+         && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value
+          , void>::type
+    findBatch(const_iterator    *results,
+              const LOOKUP_KEY  *keys,
+              bsl::size_t        numKeys) const
+    {
+        // Note: implemented inline due to Sun CC compilation error.
+
+        d_impl.findBatch(results, keys, numKeys);
+    }
+
     /// Return a `const_iterator` referring to the element in this map
     /// having the specified `key`, or `end()` if no such entry exists in
     /// this map.
@@ -1743,6 +1811,15 @@ FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key)
     return d_impl.find(key);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::findBatch(iterator    *results,
+                                                     const KEY   *keys,
+                                                     bsl::size_t  numKeys)
+{
+    d_impl.findBatch(results, keys, numKeys);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 template <class INPUT_ITERATOR>
 void FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(INPUT_ITERATOR first,
@@ -1992,6 +2069,16 @@ FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key) const
     return d_impl.find(key);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::findBatch(
+                                                const_iterator *results,
+                                                const KEY      *keys,
+                                                bsl::size_t     numKeys) const
+{
+    d_impl.findBatch(results, keys, numKeys);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 HASH FlatHashMap<KEY, VALUE, HASH, EQUAL>::hash_function() const
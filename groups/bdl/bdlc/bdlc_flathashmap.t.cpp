@@ -147,6 +147,8 @@ using namespace bsl;
 // [17] iterator erase(iterator);
 // [18] iterator erase(const_iterator, const_iterator);
 // [24] iterator find(const KEY& key);
+// [34] void findBatch(iterator *, const KEY *, size_t);
+// [34] void findBatch(iterator *, const LOOKUP_KEY *, size_t);
 // [ 2] bsl::pair<iterator, bool> insert(FORWARD_REF(VALUE_TYPE) entry)
 // [28] iterator insert(const_iterator, FORWARD_REF(VALUE_TYPE) entry)
 // [16] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
@@ -180,6 +182,8 @@ using namespace bsl;
 // [11] bool empty() const;
 // [12] bsl::pair<ci, ci> equal_range(const KEY&) const;
 // [ 4] const_iterator find(const KEY&) const;
+// [34] void findBatch(const_iterator *, const KEY *, size_t) const;
+// [34] void findBatch(ci *, const LOOKUP_KEY *, size_t) const;
 // [ 4] HASH hash_function() const;
 // [ 4] EQUAL key_eq() const;
 // [11] float load_factor() const;
@@ -200,7 +204,7 @@ using namespace bsl;
 // FREE FUNCTIONS
 // [ 8] void swap(FlatHashMap&, FlatHashMap&);
 // ----------------------------------------------------------------------------
-// [34] USAGE EXAMPLE
+// [35] USAGE EXAMPLE
 // [32] CONCERN: `find`             handles transparent comparators
 // [32] CONCERN: `contains`         handles transparent comparators
 // [32] CONCERN: `count`            handles transparent comparators
@@ -215,6 +219,8 @@ using namespace bsl;
 // [30] DRQS 169531176: bsl::inserter compatibility on Sun
 // [ 1] BREATHING TEST
 // [-1] PERFORMANCE TEST
+// [-2] PERFORMANCE TEST: PROBE COST AT HIGH LOAD FACTORS
+// [-3] PERFORMANCE TEST: `findBatch` VS. `find`
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -968,6 +974,69 @@ bsls::TimeInterval performanceFindNotPresent(MAP *map)
     return results[NUM_TRIAL / 2];
 }
 
+/// Return the median, over the specified `numTrial` trials, of the number
+/// of nanoseconds per key looked up by invoking `findBatch` on the specified
+/// `map` for the specified `keys`, in batches of the specified `batchSize`
+/// keys.  The behavior is undefined unless `0 < batchSize`.
+template <class MAP>
+double performanceFindBatchNanoseconds(const MAP&              map,
+                                       const bsl::vector<int>& keys,
+                                       bsl::size_t             batchSize,
+                                       int                     numTrial)
+{
+    bsl::vector<typename MAP::const_iterator> found(batchSize);
+
+    bsl::vector<bsls::TimeInterval> results;
+    for (int trial = 0; trial < numTrial; ++trial) {
+        bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+
+        for (bsl::size_t i = 0; i < keys.size(); i += batchSize) {
+            const bsl::size_t n = bsl::min(batchSize, keys.size() - i);
+
+            map.findBatch(found.data(), keys.data() + i, n);
+            for (bsl::size_t j = 0; j < n; ++j) {
+                if (map.end() != found[j]) {
+                    ++s_antiOptimization;
+                }
+            }
+        }
+
+        results.push_back(bsls::SystemTime::nowMonotonicClock() - start);
+    }
+
+    bsl::sort(results.begin(), results.end());
+
+    return static_cast<double>(results[numTrial / 2].totalNanoseconds()) /
+                                              static_cast<double>(keys.size());
+}
+
+/// Return the median, over the specified `numTrial` trials, of the number
+/// of nanoseconds per invocation of `find` on the specified `map` for each
+/// of the specified `keys`.
+template <class MAP>
+double performanceFindNanoseconds(const MAP&              map,
+                                  const bsl::vector<int>& keys,
+                                  int                     numTrial)
+{
+    bsl::vector<bsls::TimeInterval> results;
+    for (int trial = 0; trial < numTrial; ++trial) {
+        bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+
+        for (bsl::size_t i = 0; i < keys.size(); ++i) {
+            if (map.end() != map.find(keys[i])) {
+                ++s_antiOptimization;
+            }
+        }
+
+        results.push_back(bsls::SystemTime::nowMonotonicClock() - start);
+    }
+
+    bsl::sort(results.begin(), results.end());
+
+    return static_cast<double>(results[numTrial / 2].totalNanoseconds()) /
+                                              static_cast<double>(keys.size());
+}
+
                     // =============================
                     // class TransparentlyComparable
                     // =============================
@@ -1456,6 +1525,144 @@ int main(int argc, char *argv[])
 
     switch (test) { case 0:  // Zero is always the leading case.
       case 34: {
+        // --------------------------------------------------------------------
+        // TESTING `findBatch`
+        //
+        // Concerns:
+        // 1. Each result of `findBatch` is the iterator `find` returns for
+        //    the corresponding key, for keys present and absent, including
+        //    for an empty map having no capacity.
+        //
+        // 2. Arrays of keys whose length is not a multiple of the internal
+        //    batch size, including 0 and 1, are fully processed.
+        //
+        // 3. The `const` and non-`const` overloads return equivalent
+        //    iterators.
+        //
+        // 4. A map having a transparent hash and comparator looks up keys of
+        //    another type without converting them to `KEY`.
+        //
+        // 5. `findBatch` allocates no memory.
+        //
+        // Plan:
+        // 1. For a series of map sizes, populate a map with even keys, and
+        //    invoke both overloads of `findBatch` on arrays of even and odd
+        //    keys of various lengths, comparing each result with `find`.
+        //    (C-1..3)
+        //
+        // 2. Invoke `findBatch` on a transparent map with an array of `long`
+        //    keys, and compare each result with `find`.  (C-4)
+        //
+        // 3. Use a test allocator monitor to verify that `findBatch` does not
+        //    allocate.  (C-5)
+        //
+        // Testing:
+        //   void findBatch(iterator *, const KEY *, size_t);
+        //   void findBatch(iterator *, const LOOKUP_KEY *, size_t);
+        //   void findBatch(const_iterator *, const KEY *, size_t) const;
+        //   void findBatch(ci *, const LOOKUP_KEY *, size_t) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING `findBatch`"
+                            "\n===================\n");
+
+        typedef bdlc::FlatHashMap<int, int> Obj;
+
+        const int SIZES[]   = { 0, 1, 2, 15, 16, 17, 100, 1000, 5000 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        const bsl::size_t LENGTHS[]   = { 0, 1, 7, 16, 17, 33, 250 };
+        const int         NUM_LENGTHS = static_cast<int>(sizeof  LENGTHS /
+                                                         sizeof *LENGTHS);
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int i = 0; i < SIZE; ++i) {
+                mX.insert(bsl::make_pair(i * 2, i));
+            }
+
+            // Look up every key in `[-8 .. 2 * SIZE + 8)`, half of which are
+            // absent.
+
+            bsl::vector<int> keys(&sa);
+            for (int key = -8; key < 2 * SIZE + 8; ++key) {
+                keys.push_back(key);
+            }
+
+            bsl::vector<Obj::iterator>       results(keys.size(), &sa);
+            bsl::vector<Obj::const_iterator> cresults(keys.size(), &sa);
+
+            for (int tj = 0; tj < NUM_LENGTHS; ++tj) {
+                const bsl::size_t LENGTH = LENGTHS[tj];
+                const bsl::size_t STEP   = LENGTH ? LENGTH : 1;
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                for (bsl::size_t start = 0; start < keys.size();
+                                                             start += STEP) {
+                    const bsl::size_t n = bsl::min(LENGTH,
+                                                   keys.size() - start);
+
+                    mX.findBatch(results.data() + start,
+                                 keys.data()    + start,
+                                 n);
+                     X.findBatch(cresults.data() + start,
+                                 keys.data()     + start,
+                                 n);
+
+                    for (bsl::size_t i = start; i < start + n; ++i) {
+                        ASSERTV(SIZE, LENGTH, keys[i],
+                                mX.find(keys[i]) == results[i]);
+                        ASSERTV(SIZE, LENGTH, keys[i],
+                                X.find(keys[i]) == cresults[i]);
+
+                        const bool PRESENT = 0 <= keys[i]
+                                          && keys[i] < 2 * SIZE
+                                          && 0 == keys[i] % 2;
+                        ASSERTV(SIZE, LENGTH, keys[i],
+                                PRESENT == (X.end() != cresults[i]));
+                    }
+                }
+                ASSERTV(SIZE, LENGTH, oam.isTotalSame());
+            }
+        }
+
+        if (verbose) printf("\tTesting transparent lookup.\n");
+        {
+            typedef bdlc::FlatHashMap<int, int,
+                            TransparentHasher, TransparentComparator> TObj;
+
+            TObj mX(&oa);  const TObj& X = mX;
+
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(bsl::make_pair(i * 3, i));
+            }
+
+            long                 keys[300];
+            TObj::iterator       results[300];
+            TObj::const_iterator cresults[300];
+
+            for (int i = 0; i < 300; ++i) {
+                keys[i] = i;
+            }
+
+            mX.findBatch(results,  keys, 300);
+             X.findBatch(cresults, keys, 300);
+
+            for (int i = 0; i < 300; ++i) {
+                ASSERTV(i, mX.find(i) == results[i]);
+                ASSERTV(i,  X.find(i) == cresults[i]);
+                ASSERTV(i, (0 == i % 3) == (X.end() != cresults[i]));
+            }
+        }
+      } break;
+      case 35: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -5733,6 +5940,210 @@ int main(int argc, char *argv[])
             cout << "anti-optimization: " << s_antiOptimization << endl;
         }
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: PROBE COST AT HIGH LOAD FACTORS
+        //   Report the cost of `find` as the load factor approaches
+        //   `max_load_factor()`, where probe sequences span several groups.
+        //   The second command line parameter, if supplied, is the base-2
+        //   logarithm of the capacity (default 20).
+        //
+        // Concerns:
+        // 1. The cost of `find`, for keys present and not present, remains
+        //    moderate up to the maximum load factor for the group size (see
+        //    `bdlc_flathashtable_groupcontrol`) of the build.
+        //
+        // Plan:
+        // 1. For a fixed capacity and increasing load factors, populate a map
+        //    with even keys, and time `find` for those keys and for odd keys
+        //    in a shuffled order.  Report the number of nanoseconds per
+        //    `find` for each load factor.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: PROBE COST AT HIGH LOAD FACTORS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PROBE COST AT HIGH LOAD FACTORS" << endl
+                          << "===============================" << endl;
+
+        typedef bdlc::FlatHashMap<int, int>     Obj;
+        typedef bdlc::FlatHashTable_GroupControl GroupControl;
+
+        const int         LOG2_CAPACITY = argc > 2 ? atoi(argv[2]) : 20;
+        const bsl::size_t CAPACITY      = bsl::size_t(1) << LOG2_CAPACITY;
+        const int         NUM_TRIAL     = 11;
+
+        // Load factors, in sixteenths.  The last one is just below the
+        // maximum load factor of 7/8.
+
+        const int LOAD_FACTORS[]   = { 4, 8, 10, 12, 13, 14 };
+        const int NUM_LOAD_FACTORS = static_cast<int>(
+                                sizeof LOAD_FACTORS / sizeof *LOAD_FACTORS);
+
+        bslma::NewDeleteAllocator oa;
+
+        bslma::DefaultAllocatorGuard dag(&oa);
+
+        cout << "group size: " << GroupControl::k_SIZE
+             << ", capacity: " << CAPACITY << endl
+             << setw(12) << "load factor"
+             << setw(16) << "present (ns)"
+             << setw(16) << "absent (ns)" << endl;
+
+        for (int li = 0; li < NUM_LOAD_FACTORS; ++li) {
+            const bsl::size_t NUM_ITEMS = CAPACITY * LOAD_FACTORS[li] / 16 - 1;
+
+            Obj mX(CAPACITY, &oa);  const Obj& X = mX;
+
+            bsl::vector<int> present(&oa);
+            bsl::vector<int> absent(&oa);
+            present.reserve(NUM_ITEMS);
+            absent.reserve(NUM_ITEMS);
+
+            for (bsl::size_t i = 0; i < NUM_ITEMS; ++i) {
+                const int key = static_cast<int>(i * 2);
+                mX.insert(bsl::make_pair(key, key));
+                present.push_back(key);
+                absent.push_back(key + 1);
+            }
+            ASSERTV(li, X.capacity(), CAPACITY == X.capacity());
+
+            // Shuffle the keys so that successive lookups do not visit
+            // adjacent groups.
+
+            unsigned int seed = 12345;
+            for (bsl::size_t i = NUM_ITEMS - 1; i > 0; --i) {
+                seed = seed * 1103515245u + 12345u;
+                const bsl::size_t j = (seed >> 4) % (i + 1);
+                bsl::swap(present[i], present[j]);
+                bsl::swap(absent[i],  absent[j]);
+            }
+
+            const double presentNs = performanceFindNanoseconds(X,
+                                                                present,
+                                                                NUM_TRIAL);
+            const double absentNs  = performanceFindNanoseconds(X,
+                                                                absent,
+                                                                NUM_TRIAL);
+
+            cout << setw(12) << X.load_factor()
+                 << setw(16) << presentNs
+                 << setw(16) << absentNs << endl;
+        }
+
+        if (veryVeryVeryVerbose) {
+            cout << "anti-optimization: " << s_antiOptimization << endl;
+        }
+      } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: `findBatch` VS. `find`
+        //   Compare the cost per key of `findBatch` with that of `find` for
+        //   maps larger than the last-level cache.  The second command line
+        //   parameter, if supplied, is the base-2 logarithm of the number of
+        //   elements (default 23, i.e., about 200MB of entries and control
+        //   values).
+        //
+        // Concerns:
+        // 1. For a map whose entries are not in cache, `findBatch` looks up
+        //    keys, present and absent, faster than `find`.
+        //
+        // 2. For a small map, `findBatch` is not significantly slower than
+        //    `find`.
+        //
+        // Plan:
+        // 1. For a large and a small map, populate the map with even keys,
+        //    and time `find` and `findBatch`, with several batch sizes, for
+        //    those keys and for odd keys in a shuffled order.  Report the
+        //    number of nanoseconds per key.  (C-1..2)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: `findBatch` VS. `find`
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "`findBatch` VS. `find`" << endl
+                          << "======================" << endl;
+
+        typedef bdlc::FlatHashMap<int, bsls::Types::Int64> Obj;
+
+        const int LOG2_SIZE = argc > 2 ? atoi(argv[2]) : 23;
+        const int NUM_TRIAL = 5;
+
+        const bsl::size_t BATCH_SIZES[]   = { 8, 16, 64, 1024 };
+        const int         NUM_BATCH_SIZES = static_cast<int>(
+                                  sizeof BATCH_SIZES / sizeof *BATCH_SIZES);
+
+        const bsl::size_t SIZES[] = { bsl::size_t(1) << 12,
+                                      bsl::size_t(1) << LOG2_SIZE };
+
+        bslma::NewDeleteAllocator oa;
+
+        bslma::DefaultAllocatorGuard dag(&oa);
+
+        for (int si = 0; si < 2; ++si) {
+            const bsl::size_t NUM_ITEMS = SIZES[si];
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            bsl::vector<int> present(&oa);
+            bsl::vector<int> absent(&oa);
+            present.reserve(NUM_ITEMS);
+            absent.reserve(NUM_ITEMS);
+
+            for (bsl::size_t i = 0; i < NUM_ITEMS; ++i) {
+                const int key = static_cast<int>(i * 2);
+                mX.insert(bsl::make_pair(key, key));
+                present.push_back(key);
+                absent.push_back(key + 1);
+            }
+
+            unsigned int seed = 12345;
+            for (bsl::size_t i = NUM_ITEMS - 1; i > 0; --i) {
+                seed = seed * 1103515245u + 12345u;
+                const bsl::size_t j = (seed >> 4) % (i + 1);
+                bsl::swap(present[i], present[j]);
+                bsl::swap(absent[i],  absent[j]);
+            }
+
+            cout << "elements: " << NUM_ITEMS
+                 << ", capacity: " << X.capacity() << endl
+                 << setw(12) << "batch size"
+                 << setw(16) << "present (ns)"
+                 << setw(16) << "absent (ns)" << endl;
+
+            cout << setw(12) << "find"
+                 << setw(16) << performanceFindNanoseconds(X,
+                                                           present,
+                                                           NUM_TRIAL)
+                 << setw(16) << performanceFindNanoseconds(X,
+                                                           absent,
+                                                           NUM_TRIAL)
+                 << endl;
+
+            for (int bi = 0; bi < NUM_BATCH_SIZES; ++bi) {
+                const bsl::size_t BATCH_SIZE = BATCH_SIZES[bi];
+
+                cout << setw(12) << BATCH_SIZE
+                     << setw(16) << performanceFindBatchNanoseconds(
+                                                                X,
+                                                                present,
+                                                                BATCH_SIZE,
+                                                                NUM_TRIAL)
+                     << setw(16) << performanceFindBatchNanoseconds(
+                                                                X,
+                                                                absent,
+                                                                BATCH_SIZE,
+                                                                NUM_TRIAL)
+                     << endl;
+            }
+        }
+
+        if (veryVeryVeryVerbose) {
+            cout << "anti-optimization: " << s_antiOptimization << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
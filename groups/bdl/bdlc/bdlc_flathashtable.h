@@ -378,6 +378,17 @@ class FlatHashTable
 
     // PRIVATE ACCESSORS
 
+    /// Load into the specified `results` an iterator referring to the entry
+    /// of this table having a key equivalent to the corresponding element
+    /// of the specified `keys` array of the specified `numKeys` keys, or
+    /// `end()` if no such entry exists.  Keys are looked up in batches of
+    /// `k_BATCH_SIZE`, all keys of a batch being hashed, and the memory
+    /// they probe prefetched, before any of them is probed.
+    template <class ITERATOR, class LOOKUP_KEY>
+    void findBatchImp(ITERATOR          *results,
+                      const LOOKUP_KEY  *keys,
+                      bsl::size_t        numKeys) const;
+
     /// Return the index of the entry within `d_entries_p` containing the
     /// specified `key`, which has the specified `hashValue`, or
     /// `d_capacity` if the `key` is not present.  The behavior is undefined
@@ -399,43 +410,28 @@ class FlatHashTable
 
         BSLS_ASSERT_SAFE(hashValue == d_hasher(key));
 
-        bsl::size_t  index   = (hashValue >> d_groupControlShift)
-                                                        * GroupControl::k_SIZE;
-        bsl::uint8_t hashlet = static_cast<bsl::uint8_t>(
-                                                   hashValue & k_HASHLET_MASK);
-
-        for (bsl::size_t i = 0; i < d_capacity; i += GroupControl::k_SIZE) {
-            bsl::uint8_t *controlStart = d_controls_p + index;
-            ENTRY        *entryStart   = d_entries_p  + index;
-
-            GroupControl  groupControl(controlStart);
-            bsl::uint32_t candidates = groupControl.match(hashlet);
-            while (candidates) {
-                int offset = bdlb::BitUtil::numTrailingUnsetBits(candidates);
-
-                ENTRY *entry = entryStart + offset;
-
-                if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
-                                      d_equal(ENTRY_UTIL::key(*entry), key))) {
-                    return index + offset;                            // RETURN
-                }
-                candidates = bdlb::BitUtil::withBitCleared(candidates, offset);
-            }
-            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(groupControl.neverFull()))
-            {
-                break;
-            }
-
-            index = (index + GroupControl::k_SIZE) & (d_capacity - 1);
-        }
-
-        return d_capacity;
+        return probeGroups(key,
+                           hashValue,
+                           (hashValue >> d_groupControlShift)
+                                                       * GroupControl::k_SIZE);
     }
 
     /// Return the minimum capacity that satisfies all class invariants, and
     /// is at least the specified `minimumCapacity`.
     bsl::size_t minimumCompliantCapacity(bsl::size_t minimumCapacity) const;
 
+    /// Return the index of the entry within `d_entries_p` containing a key
+    /// equivalent to the specified `key`, which has the specified
+    /// `hashValue`, or `d_capacity` if a key equivalent to `key` is not
+    /// present, probing the groups of control values in order starting with
+    /// the group at the specified `homeIndex`.  The behavior is undefined
+    /// unless `hashValue == d_hasher(key)` and `homeIndex` is the index of
+    /// the home group of `hashValue`.
+    template <class LOOKUP_KEY>
+    bsl::size_t probeGroups(const LOOKUP_KEY& key,
+                            bsl::size_t       hashValue,
+                            bsl::size_t       homeIndex) const;
+
   private:
     // NOT IMPLEMENTED
     FlatHashTable();
@@ -458,6 +454,10 @@ class FlatHashTable
                                                       // specifies the maximum
                                                       // load factor
 
+    static const bsl::size_t  k_BATCH_SIZE = 16;      // number of keys whose
+                                                      // probes are overlapped
+                                                      // by `findBatch`
+
     // CREATORS
 
     /// Create an empty table having at least the specified `capacity`, that
@@ -633,6 +633,37 @@ class FlatHashTable
     /// position in the iteration sequence provided by this container.
     iterator erase(const_iterator first, const_iterator last);
 
+    /// Load into each of the specified `numKeys` elements of the specified
+    /// `results` array an iterator providing modifiable access to the
+    /// object in this flat hash table with a key equal to the corresponding
+    /// element of the specified `keys` array, if such an entry exists, and
+    /// `end()` otherwise.  The behavior is undefined unless `results` and
+    /// `keys` each have at least `numKeys` elements.  Note that, for a
+    /// table whose entries are not in cache, this method is faster than
+    /// invoking `find` for each key, as the memory accesses of several
+    /// lookups are overlapped.
+    void findBatch(iterator *results, const KEY *keys, bsl::size_t numKeys);
+
+    /// Load into each of the specified `numKeys` elements of the specified
+    /// `results` array an iterator providing modifiable access to the
+    /// object in this flat hash table with a key equivalent to the
+    /// corresponding element of the specified `keys` array, if such an
+    /// entry exists, and `end()` otherwise.  The behavior is undefined
+    /// unless `results` and `keys` each have at least `numKeys` elements.
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+            BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+         && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value
+          , void>::type
+    findBatch(iterator          *results,
+              const LOOKUP_KEY  *keys,
+              bsl::size_t        numKeys)
+    {
+        // Note: implemented inline due to Sun CC compilation error.
+
+        findBatchImp(results, keys, numKeys);
+    }
+
     /// Return an iterator providing modifiable access to the object in this
     /// flat hash table with a key equal to the specified `key`, if such an
     /// entry exists, and `end()` otherwise.
@@ -916,6 +947,39 @@ class FlatHashTable
     /// entry exists in this table.
     const_iterator find(const KEY& key) const;
 
+    /// Load into each of the specified `numKeys` elements of the specified
+    /// `results` array an iterator representing the position of the entry
+    /// in this flat hash table having the corresponding element of the
+    /// specified `keys` array, or `end()` if no such entry exists in this
+    /// table.  The behavior is undefined unless `results` and `keys` each
+    /// have at least `numKeys` elements.  Note that, for a table whose
+    /// entries are not in cache, this method is faster than invoking `find`
+    /// for each key, as the memory accesses of several lookups are
+    /// overlapped.
+    void findBatch(const_iterator *results,
+                   const KEY      *keys,
+                   bsl::size_t     numKeys) const;
+
+    /// Load into each of the specified `numKeys` elements of the specified
+    /// `results` array an iterator representing the position of the entry
+    /// in this flat hash table that is equivalent to the corresponding
+    /// element of the specified `keys` array, or `end()` if no such entry
+    /// exists in this table.  The behavior is undefined unless `results`
+    /// and `keys` each have at least `numKeys` elements.
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+            BloombergLP::bslmf::IsTransparentPredicate<HASH, LOOKUP_KEY>::value
+         && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,LOOKUP_KEY>::value
+          , void>::type
+    findBatch(const_iterator    *results,
+              const LOOKUP_KEY  *keys,
+              bsl::size_t        numKeys) const
+    {
+        // Note: implemented inline due to Sun CC compilation error.
+
+        findBatchImp(results, keys, numKeys);
+    }
+
     /// Return an iterator representing the position of the entry in this
     /// flat hash table that is equivalent to the specified `key`, or `end()`
     //  if no such entry exists in this table.
@@ -1480,42 +1544,92 @@ void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehashRaw(
 
 // PRIVATE ACCESSORS
 template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
-bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findKey(
-                                                   const KEY&  key,
-                                                   bsl::size_t hashValue) const
-{
-    BSLS_ASSERT_SAFE(hashValue == d_hasher(key));
+template <class ITERATOR, class LOOKUP_KEY>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findBatchImp(
+                                            ITERATOR          *results,
+                                            const LOOKUP_KEY  *keys,
+                                            bsl::size_t        numKeys) const
+{
+    BSLS_ASSERT(results || 0 == numKeys);
+    BSLS_ASSERT(keys    || 0 == numKeys);
+
+    if (0 == d_capacity) {
+        for (bsl::size_t i = 0; i < numKeys; ++i) {
+            results[i] = ITERATOR();
+        }
+        return;                                                       // RETURN
+    }
 
-    bsl::size_t  index   = (hashValue >> d_groupControlShift)
-                                                        * GroupControl::k_SIZE;
-    bsl::uint8_t hashlet = static_cast<bsl::uint8_t>(
-                                                   hashValue & k_HASHLET_MASK);
+    bsl::size_t hashValues[k_BATCH_SIZE];
+    bsl::size_t homeIndices[k_BATCH_SIZE];  // index of the home group
 
-    for (bsl::size_t i = 0; i < d_capacity; i += GroupControl::k_SIZE) {
-        bsl::uint8_t *controlStart = d_controls_p + index;
-        ENTRY        *entryStart   = d_entries_p  + index;
+    while (0 < numKeys) {
+        const bsl::size_t batchSize = numKeys < k_BATCH_SIZE
+                                      ? numKeys
+                                      : k_BATCH_SIZE;
 
-        GroupControl  groupControl(controlStart);
-        bsl::uint32_t candidates = groupControl.match(hashlet);
-        while (candidates) {
-            int offset = bdlb::BitUtil::numTrailingUnsetBits(candidates);
+        // First, hash every key of the batch and prefetch the control values
+        // of its home group, so that the cache misses on the control values
+        // of the batch are serviced concurrently.
 
-            ENTRY *entry = entryStart + offset;
+        for (bsl::size_t i = 0; i < batchSize; ++i) {
+            hashValues[i]  = d_hasher(keys[i]);
+            homeIndices[i] = (hashValues[i] >> d_groupControlShift)
+                                                        * GroupControl::k_SIZE;
 
-            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
-                                      d_equal(ENTRY_UTIL::key(*entry), key))) {
-                return index + offset;                                // RETURN
+            bsls::PerformanceHint::prefetchForReading(
+                                              d_controls_p + homeIndices[i]);
+        }
+
+        // Then, prefetch the first entry of each home group whose control
+        // value matches the hashlet of the key, which is, in the vast
+        // majority of cases, the entry holding the key.
+
+        for (bsl::size_t i = 0; i < batchSize; ++i) {
+            const bsl::size_t  index   = homeIndices[i];
+            const bsl::uint8_t hashlet = static_cast<bsl::uint8_t>(
+                                               hashValues[i] & k_HASHLET_MASK);
+
+            const bsl::uint32_t candidates =
+                            GroupControl(d_controls_p + index).match(hashlet);
+            if (candidates) {
+                bsls::PerformanceHint::prefetchForReading(
+                        d_entries_p + index +
+                             bdlb::BitUtil::numTrailingUnsetBits(candidates));
             }
-            candidates = bdlb::BitUtil::withBitCleared(candidates, offset);
         }
-        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(groupControl.neverFull())) {
-            break;
+
+        // Finally, probe for every key of the batch.
+
+        for (bsl::size_t i = 0; i < batchSize; ++i) {
+            const bsl::size_t index = probeGroups(keys[i],
+                                                  hashValues[i],
+                                                  homeIndices[i]);
+
+            results[i] = index == d_capacity
+                         ? ITERATOR()
+                         : ITERATOR(IteratorImp(d_entries_p  + index,
+                                                d_controls_p + index,
+                                                d_capacity   - index - 1));
         }
 
-        index = (index + GroupControl::k_SIZE) & (d_capacity - 1);
+        results += batchSize;
+        keys    += batchSize;
+        numKeys -= batchSize;
     }
+}
 
-    return d_capacity;
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findKey(
+                                                   const KEY&  key,
+                                                   bsl::size_t hashValue) const
+{
+    BSLS_ASSERT_SAFE(hashValue == d_hasher(key));
+
+    return probeGroups(key,
+                       hashValue,
+                       (hashValue >> d_groupControlShift)
+                                                       * GroupControl::k_SIZE);
 }
 
 template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
@@ -1544,6 +1658,44 @@ bsl::size_t FlatHashTable<KEY,
     return capacity;
 }
 
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class LOOKUP_KEY>
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::probeGroups(
+                                             const LOOKUP_KEY& key,
+                                             bsl::size_t       hashValue,
+                                             bsl::size_t       homeIndex) const
+{
+    bsl::size_t  index   = homeIndex;
+    bsl::uint8_t hashlet = static_cast<bsl::uint8_t>(
+                                                   hashValue & k_HASHLET_MASK);
+
+    for (bsl::size_t i = 0; i < d_capacity; i += GroupControl::k_SIZE) {
+        bsl::uint8_t *controlStart = d_controls_p + index;
+        ENTRY        *entryStart   = d_entries_p  + index;
+
+        GroupControl  groupControl(controlStart);
+        bsl::uint32_t candidates = groupControl.match(hashlet);
+        while (candidates) {
+            int offset = bdlb::BitUtil::numTrailingUnsetBits(candidates);
+
+            ENTRY *entry = entryStart + offset;
+
+            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                      d_equal(ENTRY_UTIL::key(*entry), key))) {
+                return index + offset;                                // RETURN
+            }
+            candidates = bdlb::BitUtil::withBitCleared(candidates, offset);
+        }
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(groupControl.neverFull())) {
+            break;
+        }
+
+        index = (index + GroupControl::k_SIZE) & (d_capacity - 1);
+    }
+
+    return d_capacity;
+}
+
 // CREATORS
 template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
 inline
@@ -1948,6 +2100,16 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
     return rv;
 }
 
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findBatch(
+                                                      iterator    *results,
+                                                      const KEY   *keys,
+                                                      bsl::size_t  numKeys)
+{
+    findBatchImp(results, keys, numKeys);
+}
+
 template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
 inline
 typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
@@ -2286,6 +2448,16 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key) const
     return end();
 }
 
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findBatch(
+                                                const_iterator *results,
+                                                const KEY      *keys,
+                                                bsl::size_t     numKeys) const
+{
+    findBatchImp(results, keys, numKeys);
+}
+
 template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
 inline
 HASH FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::hash_function() const
@@ -15,6 +15,23 @@ BSLS_IDENT("$Id: $")
 // of flat hash table control values.  Note that the number of entries in a
 // group control and the inquiry performance is platform dependant.
 //
+///Group Size and Instruction Set Selection
+///----------------------------------------
+// The implementation, and therefore `k_SIZE`, is selected at compile time:
+//
+// * 32 entries using AVX2, if the compiler targets AVX2 (e.g., `-mavx2`) and
+//   `BDLC_FLATHASHTABLE_GROUPCONTROL_ENABLE_AVX2` is defined.
+// * 16 entries using SSE2 on x86 and x86-64 platforms supporting SSE2.
+// * 16 entries using NEON on 64-bit ARM platforms.
+// * 8 entries using portable 64-bit arithmetic otherwise.
+//
+// The 32-entry AVX2 implementation must be explicitly enabled because `k_SIZE`
+// determines the minimum capacity and the probing sequence of the flat hash
+// containers: every translation unit of a program that shares a flat hash
+// container must be compiled with the same selection, which is not ensured by
+// instruction set flags that may differ between libraries.  The performance
+// test of `bdlc_flathashmap` reports the probe cost of each configuration.
+//
 // The flat hash map/set/table data structures are inspired by Google's
 // flat_hash_map CppCon presentations (available on youtube).  The
 // implementations draw from Google's open source `raw_hash_set.h` file at:
@@ -35,9 +52,23 @@ BSLS_IDENT("$Id: $")
 #include <bsl_cstdint.h>
 #include <bsl_cstring.h>
 
-#if defined(BSLS_PLATFORM_CPU_SSE2)
+#if defined(BSLS_PLATFORM_CPU_AVX2)                                           \
+ && defined(BDLC_FLATHASHTABLE_GROUPCONTROL_ENABLE_AVX2)
+#define BDLC_FLATHASHTABLE_GROUPCONTROL_USE_AVX2 1
+#elif defined(BSLS_PLATFORM_CPU_SSE2)
+#define BDLC_FLATHASHTABLE_GROUPCONTROL_USE_SSE2 1
+#elif defined(BSLS_PLATFORM_CPU_ARM)                                          \
+   && defined(BSLS_PLATFORM_CPU_64_BIT)                                       \
+   && defined(__ARM_NEON)
+#define BDLC_FLATHASHTABLE_GROUPCONTROL_USE_NEON 1
+#endif
+
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_USE_AVX2)                         \
+ || defined(BDLC_FLATHASHTABLE_GROUPCONTROL_USE_SSE2)
 #include <immintrin.h>
 #include <emmintrin.h>
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_USE_NEON)
+#include <arm_neon.h>
 #endif
 
 namespace BloombergLP {
@@ -53,8 +84,12 @@ class FlatHashTable_GroupControl
 {
   public:
     // TYPES
-#if defined(BSLS_PLATFORM_CPU_SSE2)
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_USE_AVX2)
+    typedef __m256i       Storage;
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_USE_SSE2)
     typedef __m128i       Storage;
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_USE_NEON)
+    typedef uint8x16_t    Storage;
 #else
     typedef bsl::uint64_t Storage;
 #endif
@@ -69,6 +104,16 @@ class FlatHashTable_GroupControl
     // DATA
     Storage d_value;  // efficiently cached value for inquiries
 
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_USE_NEON)
+    // PRIVATE CLASS METHODS
+
+    /// Return a bit mask having the bit at index `i` set if and only if the
+    /// byte at index `i` of the specified `lanes` is non-zero.  The
+    /// behavior is undefined unless each byte of `lanes` is either 0x00 or
+    /// 0xFF.
+    static bsl::uint32_t moveMask(uint8x16_t lanes);
+#endif
+
     // PRIVATE ACCESSORS
 
     /// Return a bit mask of the `k_SIZE` entries that have the specified
@@ -127,14 +172,37 @@ class FlatHashTable_GroupControl
                      // class FlatHashTable_GroupControl
                      // --------------------------------
 
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_USE_NEON)
+// PRIVATE CLASS METHODS
+inline
+bsl::uint32_t FlatHashTable_GroupControl::moveMask(uint8x16_t lanes)
+{
+    // NEON has no equivalent of `_mm_movemask_epi8`: keep one distinct bit
+    // per byte of each half, and sum the bytes of each half horizontally.
+
+    const uint8x8_t bits = vcreate_u8(0x8040201008040201ull);
+
+    const bsl::uint32_t low  = vaddv_u8(vand_u8(vget_low_u8(lanes),  bits));
+    const bsl::uint32_t high = vaddv_u8(vand_u8(vget_high_u8(lanes), bits));
+
+    return low | (high << 8);
+}
+#endif
+
 // PRIVATE ACCESSORS
 inline
 bsl::uint32_t FlatHashTable_GroupControl::matchRaw(bsl::uint8_t value) const
 {
-#if defined(BSLS_PLATFORM_CPU_SSE2)
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_USE_AVX2)
+    return static_cast<bsl::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+                                    _mm256_set1_epi8(static_cast<char>(value)),
+                                    d_value)));
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_USE_SSE2)
     return _mm_movemask_epi8(_mm_cmpeq_epi8(
                                        _mm_set1_epi8(static_cast<char>(value)),
                                        d_value));
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_USE_NEON)
+    return moveMask(vceqq_u8(vdupq_n_u8(value), d_value));
 #else
     Storage t = d_value ^ (k_MULT * value);
 
@@ -152,9 +220,14 @@ inline
 FlatHashTable_GroupControl::FlatHashTable_GroupControl(
                                                       const bsl::uint8_t *data)
 {
-#if defined(BSLS_PLATFORM_CPU_SSE2)
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_USE_AVX2)
+    d_value = _mm256_loadu_si256(static_cast<const Storage *>(
+                                             static_cast<const void *>(data)));
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_USE_SSE2)
     d_value = _mm_loadu_si128(static_cast<const Storage *>(
                                              static_cast<const void *>(data)));
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_USE_NEON)
+    d_value = vld1q_u8(data);
 #else
     bsl::memcpy(&d_value, data, k_SIZE);
     d_value = BSLS_BYTEORDER_HOST_U64_TO_LE(d_value);
@@ -165,8 +238,12 @@ FlatHashTable_GroupControl::FlatHashTable_GroupControl(
 inline
 bsl::uint32_t FlatHashTable_GroupControl::available() const
 {
-#if defined(BSLS_PLATFORM_CPU_SSE2)
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_USE_AVX2)
+    return static_cast<bsl::uint32_t>(_mm256_movemask_epi8(d_value));
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_USE_SSE2)
     return _mm_movemask_epi8(d_value);
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_USE_NEON)
+    return moveMask(vtstq_u8(d_value, vdupq_n_u8(k_EMPTY)));
 #else
     return static_cast<bsl::uint32_t>(
                       ((d_value & k_MSB_MASK) * k_DEFLATE) >> k_DEFLATE_SHIFT);
@@ -176,7 +253,10 @@ bsl::uint32_t FlatHashTable_GroupControl::available() const
 inline
 bsl::uint32_t FlatHashTable_GroupControl::inUse() const
 {
-#if defined(BSLS_PLATFORM_CPU_SSE2)
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_USE_AVX2)
+    return ~available();
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_USE_SSE2)                       \
+   || defined(BDLC_FLATHASHTABLE_GROUPCONTROL_USE_NEON)
     return (~available()) & 0xFFFF;
 #else
     return (~available()) & 0xFF;
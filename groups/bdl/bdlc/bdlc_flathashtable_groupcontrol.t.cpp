@@ -12,6 +12,7 @@
 
 #include <bsl_cstddef.h>
 #include <bsl_cstdint.h>
+#include <bsl_cstring.h>
 #include <bsl_iostream.h>
 
 using namespace BloombergLP;
@@ -117,10 +118,30 @@ const bsl::uint8_t VC = 0x01;
 const bsl::uint8_t VD = 0x10;
 const bsl::uint8_t VE = 0x11;
 
+// Maximum number of control values in a group on any platform.
+
+const bsl::size_t k_MAX_SIZE = 32;
+
+BSLMF_ASSERT(Obj::k_SIZE <= k_MAX_SIZE);
+
+// Number of leading control values of a group considered at the highest
+// enumeration depth, which is limited to bound the run time of the test.
+
+const bsl::size_t k_DEPTH4_SIZE = Obj::k_SIZE < 16 ? Obj::k_SIZE : 16;
+
 // ============================================================================
 //                    GLOBAL HELPER FUNCTIONS FOR TESTING
 // ----------------------------------------------------------------------------
 
+/// Load into the specified `result` the specified 16 control values `spec`
+/// followed, up to `k_MAX_SIZE` control values, by copies of the last value
+/// of `spec`.
+void extend(bsl::uint8_t *result, const bsl::uint8_t *spec)
+{
+    bsl::memcpy(result, spec, 16);
+    bsl::memset(result + 16, spec[15], k_MAX_SIZE - 16);
+}
+
 /// Print a representation of the specified `data`.
 void print(const bsl::uint8_t *data)
 {
@@ -271,13 +292,11 @@ int main(int argc, char *argv[])
         if (verbose) cout << "\nTesting accessors." << endl;
 
         {
-            bsl::uint8_t BACKGROUND[][16] =
-                       {
-                           { EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE },
-                           { XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX },
-                       };
-            const bsl::size_t NUM_BACKGROUND
-                                      = sizeof BACKGROUND / sizeof *BACKGROUND;
+            const bsl::size_t NUM_BACKGROUND = 2;
+
+            bsl::uint8_t BACKGROUND[NUM_BACKGROUND][k_MAX_SIZE];
+            bsl::memset(BACKGROUND[0], EE, k_MAX_SIZE);
+            bsl::memset(BACKGROUND[1], XX, k_MAX_SIZE);
 
             bsl::uint8_t VALUE[] = { VA, VB, VC, VD, VE, EE, XX };
             const bsl::size_t NUM_VALUE = sizeof VALUE / sizeof *VALUE;
@@ -289,8 +308,8 @@ int main(int argc, char *argv[])
             }
             { // depth 1
                 for (bsl::size_t bi = 0; bi < NUM_BACKGROUND; ++bi) {
-                    bsl::uint8_t data[16];
-                    bsl::memcpy(data, BACKGROUND[bi], 16);
+                    bsl::uint8_t data[k_MAX_SIZE];
+                    bsl::memcpy(data, BACKGROUND[bi], k_MAX_SIZE);
 
                     for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
                         for (bsl::size_t ii = 0; ii < NUM_VALUE; ++ii) {
@@ -303,8 +322,8 @@ int main(int argc, char *argv[])
             }
             { // depth 2
                 for (bsl::size_t bi = 0; bi < NUM_BACKGROUND; ++bi) {
-                    bsl::uint8_t data[16];
-                    bsl::memcpy(data, BACKGROUND[bi], 16);
+                    bsl::uint8_t data[k_MAX_SIZE];
+                    bsl::memcpy(data, BACKGROUND[bi], k_MAX_SIZE);
             //------^
             for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
                 for (bsl::size_t ii = 0; ii < NUM_VALUE; ++ii) {
@@ -324,8 +343,8 @@ int main(int argc, char *argv[])
             }
             { // depth 3
                 for (bsl::size_t bi = 0; bi < NUM_BACKGROUND; ++bi) {
-                    bsl::uint8_t data[16];
-                    bsl::memcpy(data, BACKGROUND[bi], 16);
+                    bsl::uint8_t data[k_MAX_SIZE];
+                    bsl::memcpy(data, BACKGROUND[bi], k_MAX_SIZE);
         //----------^
         for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
             for (bsl::size_t ii = 0; ii < NUM_VALUE; ++ii) {
@@ -351,19 +370,19 @@ int main(int argc, char *argv[])
             }
             { // depth 4
                 for (bsl::size_t bi = 0; bi < NUM_BACKGROUND; ++bi) {
-                    bsl::uint8_t data[16];
-                    bsl::memcpy(data, BACKGROUND[bi], 16);
+                    bsl::uint8_t data[k_MAX_SIZE];
+                    bsl::memcpy(data, BACKGROUND[bi], k_MAX_SIZE);
 //------------------^
-for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
+for (bsl::size_t i = 0; i < k_DEPTH4_SIZE; ++i) {
     for (bsl::size_t ii = 0; ii < NUM_VALUE; ++ii) {
         data[i] = VALUE[ii];
-        for (bsl::size_t j = i + 1; j < Obj::k_SIZE; ++j) {
+        for (bsl::size_t j = i + 1; j < k_DEPTH4_SIZE; ++j) {
             for (bsl::size_t jj = 0; jj < NUM_VALUE; ++jj) {
                 data[j] = VALUE[jj];
-                for (bsl::size_t k = j + 1; k < Obj::k_SIZE; ++k) {
+                for (bsl::size_t k = j + 1; k < k_DEPTH4_SIZE; ++k) {
                     for (bsl::size_t kk = 0; kk < NUM_VALUE; ++kk) {
                         data[k] = VALUE[kk];
-                        for (bsl::size_t m = k + 1; m < Obj::k_SIZE; ++m) {
+                        for (bsl::size_t m = k + 1; m < k_DEPTH4_SIZE; ++m) {
                             for (bsl::size_t mm = 0; mm < NUM_VALUE; ++mm) {
                                 data[m] = VALUE[mm];
                                 verifyWithOracle(data);
@@ -388,9 +407,12 @@ for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
         {
             bsls::AssertTestHandlerGuard hG;
 
-            bsl::uint8_t data[16] =
+            const bsl::uint8_t SPEC[16] =
                            { XX,VA,XX,VB,VA,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
 
+            bsl::uint8_t data[k_MAX_SIZE];
+            extend(data, SPEC);
+
             Obj mX(data);  const Obj& X = mX;
 
             ASSERT_SAFE_PASS(X.match(VA));
@@ -426,9 +448,12 @@ for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
                           << "========" << endl;
 
         {
-            bsl::uint8_t data[16] =
+            const bsl::uint8_t SPEC[16] =
                            { XX,VA,XX,VB,VA,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
 
+            bsl::uint8_t data[k_MAX_SIZE];
+            extend(data, SPEC);
+
             Obj mX(data);  const Obj& X = mX;
 
             ASSERT(0x1A == X.inUse());
@@ -440,9 +465,12 @@ for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
             ASSERT(true == X.neverFull());
         }
         {
-            bsl::uint8_t data[16] =
+            const bsl::uint8_t SPEC[16] =
                            { VA,VB,VC,VD,VE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
 
+            bsl::uint8_t data[k_MAX_SIZE];
+            extend(data, SPEC);
+
             Obj mX(data);  const Obj& X = mX;
 
             ASSERT(0x1F == X.inUse());
@@ -454,9 +482,12 @@ for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
             ASSERT(true == X.neverFull());
         }
         {
-            bsl::uint8_t data[16] =
+            const bsl::uint8_t SPEC[16] =
                            { XX,VA,XX,VB,VA,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX };
 
+            bsl::uint8_t data[k_MAX_SIZE];
+            extend(data, SPEC);
+
             Obj mX(data);  const Obj& X = mX;
 
             ASSERT(0x1A  == X.inUse());
@@ -488,9 +519,12 @@ for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
                           << "BREATHING TEST" << endl
                           << "==============" << endl;
 
-        bsl::uint8_t data[16] =
+        const bsl::uint8_t SPEC[16] =
                            { XX,VA,XX,VB,VA,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
 
+        bsl::uint8_t data[k_MAX_SIZE];
+        extend(data, SPEC);
+
         Obj mX(data);  const Obj& X = mX;
 
         ASSERT(0x1A == X.inUse());
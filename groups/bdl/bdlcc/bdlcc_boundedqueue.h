@@ -30,6 +30,11 @@ BSLS_IDENT("$Id: $")
 // value, if the queue is full.  The `tryPopFront` method fails immediately,
 // returning a non-zero value, if the queue is empty.
 //
+// Batch methods, `pushBackBatch`, `tryPushBackBatch`, `popFrontBatch`, and
+// `tryPopFrontBatch`, transfer a contiguous array of elements with a single
+// acquisition of the queue's internal semaphores and a single reservation of
+// element locations (see {Batch Operations}).
+//
 // The queue may be placed into a "enqueue disabled" state using the
 // `disablePushBack` method.  When disabled, `pushBack` and `tryPushBack` fail
 // immediately and return an error code.  Any threads blocked in `pushBack`
@@ -55,6 +60,28 @@ BSLS_IDENT("$Id: $")
 // performance of various queues in the article Concurrent Queue Evaluation
 // (https://tinyurl.com/mr2un9f7).
 //
+///Batch Operations
+///----------------
+// Each call to `pushBack` or `popFront` performs several atomic
+// read-modify-write operations on state shared by all producers and consumers
+// (the semaphore count, the started/finished operation counts, and the element
+// index).  When a producer generates, or a consumer processes, elements in
+// groups, this per-element synchronization can dominate the cost of using the
+// queue.  The batch methods amortize that cost: `pushBackBatch` and
+// `popFrontBatch` acquire as many element permits as are available (up to the
+// requested number) with one semaphore operation, reserve the corresponding
+// range of element locations with one atomic addition, and publish the whole
+// range to the complementary operation with one atomic update.
+//
+// `popFrontBatch` blocks until at least one element is available and then
+// removes up to the requested number of elements; `tryPopFrontBatch` does not
+// block.  `pushBackBatch` blocks until every supplied element has been
+// appended (appending in as many chunks as the available capacity requires),
+// and `tryPushBackBatch` appends only as many elements as currently fit.  Note
+// that elements appended by a single batch call are contiguous in the queue
+// only when the batch is appended in a single chunk; concurrent producers may
+// interleave with a blocking `pushBackBatch` that must wait for capacity.
+//
 ///Template Requirements
 ///---------------------
 // `bdlcc::BoundedQueue` is a template that is parameterized on the type of
@@ -74,6 +101,12 @@ BSLS_IDENT("$Id: $")
 // which point the element is "reclaimed").  This failure to write does not
 // increment the result returned by `numElements`.  Hence,
 // `numElements() == capacity()` is not a valid replacement for `isFull()`.
+// If an exception occurs while writing the elements of a batch, the element
+// being written and all subsequent elements of the batch are marked unusable
+// (as above), and the preceding elements of the batch remain in the queue.  If
+// an exception occurs while reading the elements of a batch, the elements of
+// the reserved range that have not been loaded are removed from the queue and
+// destroyed.
 //
 ///Move Semantics in C++03
 ///-----------------------
@@ -291,6 +324,117 @@ class BoundedQueue_PushExceptionCompleteProctor {
     void release();
 };
 
+                 // ========================================
+                 // class BoundedQueue_PopBatchCompleteGuard
+                 // ========================================
+
+/// This class implements a guard that manages a contiguous range of nodes
+/// reserved by a batch "pop" operation of a queue of (template parameter)
+/// `TYPE`, and invokes `TYPE::popBatchComplete` upon destruction.  The guard
+/// tracks the nodes of the range that have not yet been processed, and the
+/// number of element permits acquired from the queue's pop semaphore that
+/// have not yet been matched with an element.
+template <class TYPE>
+class BoundedQueue_PopBatchCompleteGuard {
+
+    // DATA
+    TYPE                *d_queue_p;         // managed queue
+
+    bsls::Types::Uint64  d_index;           // index of the first unprocessed
+                                            // node
+
+    int                  d_numNodes;        // number of nodes in the range
+
+    int                  d_numUnprocessed;  // number of unprocessed nodes
+
+    int                  d_numPermits;      // number of unmatched permits
+
+  private:
+    // NOT IMPLEMENTED
+    BoundedQueue_PopBatchCompleteGuard();
+    BoundedQueue_PopBatchCompleteGuard(
+                                    const BoundedQueue_PopBatchCompleteGuard&);
+    BoundedQueue_PopBatchCompleteGuard& operator=(
+                                    const BoundedQueue_PopBatchCompleteGuard&);
+
+  public:
+    // CREATORS
+
+    /// Create a `popBatchComplete` guard managing the specified `numNodes`
+    /// nodes of the specified `queue` starting at the specified `index`, and
+    /// the specified `numPermits` acquired permits.
+    BoundedQueue_PopBatchCompleteGuard(TYPE                *queue,
+                                       bsls::Types::Uint64  index,
+                                       int                  numNodes,
+                                       int                  numPermits);
+
+    /// Destroy this object and invoke the `TYPE::popBatchComplete` method
+    /// with the unprocessed nodes and the unmatched permits.
+    ~BoundedQueue_PopBatchCompleteGuard();
+
+    // MANIPULATORS
+
+    /// Mark the first unprocessed node as processed.  If the specified
+    /// `loadedFlag` is `true`, the value of the node was loaded and
+    /// destroyed, and one permit is matched with the node; otherwise the node
+    /// was unconstructed and no permit is matched.
+    void advance(bool loadedFlag);
+
+    /// Return the number of unmatched permits and release them from
+    /// management.  The behavior is undefined unless all nodes have been
+    /// processed.
+    int release();
+};
+
+              // ==========================================
+              // class BoundedQueue_PushBatchCompleteGuard
+              // ==========================================
+
+/// This class implements a guard that manages a contiguous range of nodes
+/// reserved by a batch "push" operation of a queue of (template parameter)
+/// `TYPE`, and invokes `TYPE::pushBatchComplete` upon destruction.  Nodes of
+/// the range that have not been written when the guard is destroyed (i.e.,
+/// due to an exception) are marked for reclamation.
+template <class TYPE>
+class BoundedQueue_PushBatchCompleteGuard {
+
+    // DATA
+    TYPE                *d_queue_p;         // managed queue
+
+    bsls::Types::Uint64  d_index;           // index of the first unwritten
+                                            // node
+
+    int                  d_numPushed;       // number of written nodes
+
+    int                  d_numUnwritten;    // number of unwritten nodes
+
+  private:
+    // NOT IMPLEMENTED
+    BoundedQueue_PushBatchCompleteGuard();
+    BoundedQueue_PushBatchCompleteGuard(
+                                   const BoundedQueue_PushBatchCompleteGuard&);
+    BoundedQueue_PushBatchCompleteGuard& operator=(
+                                   const BoundedQueue_PushBatchCompleteGuard&);
+
+  public:
+    // CREATORS
+
+    /// Create a `pushBatchComplete` guard managing the specified `numNodes`
+    /// nodes of the specified `queue` starting at the specified `index`.
+    BoundedQueue_PushBatchCompleteGuard(TYPE                *queue,
+                                        bsls::Types::Uint64  index,
+                                        int                  numNodes);
+
+    /// Destroy this object and invoke the `TYPE::pushBatchComplete` method
+    /// with the written and unwritten nodes.
+    ~BoundedQueue_PushBatchCompleteGuard();
+
+    // MANIPULATORS
+
+    /// Mark the first unwritten node as written.
+    void advance();
+};
+
                          // ========================
                          // struct BoundedQueue_Node
                          // ========================
@@ -457,6 +601,10 @@ class BoundedQueue {
     friend class BoundedQueue_PushExceptionCompleteProctor<
                                                           BoundedQueue<TYPE> >;
 
+    friend class BoundedQueue_PopBatchCompleteGuard<BoundedQueue<TYPE> >;
+
+    friend class BoundedQueue_PushBatchCompleteGuard<BoundedQueue<TYPE> >;
+
     // PRIVATE CLASS METHODS
 
     /// Return `true` if the specified `lhs` is circularly greater than the
@@ -465,6 +613,10 @@ class BoundedQueue {
     /// in `[1 .. 2^31]` to `rhs`.
     static bool circularlyGreater(Uint lhs, Uint rhs);
 
+    /// Return the specified `numValues` if it is representable as an `int`,
+    /// and `INT_MAX` otherwise.
+    static int clampNumValues(bsl::size_t numValues);
+
     /// Return `true` if the specified `count` implies a quiescent state (see
     /// **Implementation Note**), and `false` otherwise.  A quiescent state
     /// indicates there is a (possibly zero length) contiguous set of elements
@@ -519,16 +671,52 @@ class BoundedQueue {
 
     // PRIVATE MANIPULATORS
 
+    /// Destroy the values stored in the specified `numUnprocessed` nodes
+    /// starting at the specified `index`, `post` the specified `numPermits`
+    /// unmatched permits back to `d_popSemaphore`, mark the specified
+    /// `numNodes` "pop" operations as complete, and `post` to the
+    /// `d_pushSemaphore` if appropriate.  This method is used by a guard
+    /// within `popFrontBatchHelper` to complete a batch "pop" operation, both
+    /// normally (in which case `numUnprocessed` and `numPermits` are 0) and in
+    /// the presence of an exception.
+    void popBatchComplete(Uint64 index,
+                          int    numUnprocessed,
+                          int    numNodes,
+                          int    numPermits);
+
     /// Destruct the value stored in the specified `node`, and mark the `node`
     /// writable.  This method is used within `popFrontHelper` by a guard to
     /// complete the reclamation of a node in the presence of an exception.
     void popComplete(Node *node);
 
+    /// Remove the specified `numValues` elements from the front of this queue
+    /// and load them into the array starting at the specified `values`.  The
+    /// behavior is undefined unless `numValues` permits have been acquired
+    /// from `d_popSemaphore`.  This method is invoked by `popFrontBatch` and
+    /// `tryPopFrontBatch` once the elements are available.
+    void popFrontBatchHelper(TYPE *values, int numValues);
+
     /// Remove the element from the front of this queue and load that element
     /// into the specified `value`.  This method is invoked by `popFront` and
     /// `tryPopFront` once an element is available.
     void popFrontHelper(TYPE *value);
 
+    /// Append the specified `numValues` elements of the array starting at the
+    /// specified `values` to the back of this queue.  The behavior is
+    /// undefined unless `numValues` permits have been acquired from
+    /// `d_pushSemaphore`.  This method is invoked by `pushBackBatch` and
+    /// `tryPushBackBatch` once the capacity is available.
+    void pushBackBatchHelper(const TYPE *values, int numValues);
+
+    /// Mark the specified `numUnwritten` nodes starting at the specified
+    /// `index` for reclamation, mark the specified `numPushed` "push"
+    /// operations as complete and the `numUnwritten` "push" operations as
+    /// aborted, and `post` to the `d_popSemaphore` if appropriate.  This
+    /// method is used by a guard within `pushBackBatchHelper` to complete a
+    /// batch "push" operation, both normally (in which case `numUnwritten` is
+    /// 0) and in the presence of an exception.
+    void pushBatchComplete(Uint64 index, int numPushed, int numUnwritten);
+
     /// Mark a "push" operation as complete, and `post` to the `d_popSemaphore`
     /// if appropriate.
     void pushComplete();
@@ -592,6 +780,22 @@ class BoundedQueue {
     /// is invoked.
     int popFront(TYPE *value);
 
+    /// Remove up to the specified `maxNumValues` elements from the front of
+    /// this queue, load them, in order, into the array starting at the
+    /// specified `values`, and load into the specified `numPopped` the number
+    /// of elements removed.  If the queue is empty, block until it is not
+    /// empty.  Return 0 on success, and a non-zero value otherwise.
+    /// Specifically, return `e_SUCCESS` on success, `e_DISABLED` if
+    /// `isPopFrontDisabled()` and `e_FAILED` if an error occurs.  On success,
+    /// `*numPopped` is in the range `[1 .. maxNumValues]`; on failure,
+    /// `*numPopped` is 0 and `values` is not changed.  Threads blocked due to
+    /// the queue being empty will return `e_DISABLED` if `disablePopFront` is
+    /// invoked.  The behavior is undefined unless `values` refers to an array
+    /// of at least `maxNumValues` elements, and `0 < maxNumValues`.
+    int popFrontBatch(TYPE        *values,
+                      bsl::size_t  maxNumValues,
+                      bsl::size_t *numPopped);
+
     /// Append the specified `value` to the back of this queue.  If the
     /// queue is full, block until it is not full.  Return 0 on success, and
     /// a non-zero value otherwise.  Specifically, return `e_SUCCESS` on
@@ -610,6 +814,23 @@ class BoundedQueue {
     /// `disablePushBack` is invoked.
     int pushBack(bslmf::MovableRef<TYPE> value);
 
+    /// Append, in order, the specified `numValues` elements of the array
+    /// starting at the specified `values` to the back of this queue.  If the
+    /// queue is full, block until it is not full; elements are appended in as
+    /// many chunks as the available capacity requires.  Optionally specify
+    /// `numPushed`, into which the number of appended elements is loaded.
+    /// Return 0 on success, and a non-zero value otherwise.  Specifically,
+    /// return `e_SUCCESS` if all `numValues` elements were appended,
+    /// `e_DISABLED` if `isPushBackDisabled()` and `e_FAILED` if an error
+    /// occurs.  On failure, a (possibly empty) prefix of `values` may have
+    /// been appended.  Threads blocked due to the queue being full will return
+    /// `e_DISABLED` if `disablePushBack` is invoked.  The behavior is
+    /// undefined unless `values` refers to an array of at least `numValues`
+    /// elements.
+    int pushBackBatch(const TYPE  *values,
+                      bsl::size_t  numValues,
+                      bsl::size_t *numPushed = 0);
+
     /// Remove all items currently in this queue.  Note that this operation
     /// is not atomic; if other threads are concurrently pushing items into
     /// the queue the result of `numElements()` after this function returns
@@ -625,6 +846,21 @@ class BoundedQueue {
     /// an error occurs.  On failure, `value` is not changed.
     int tryPopFront(TYPE *value);
 
+    /// Attempt to remove up to the specified `maxNumValues` elements from the
+    /// front of this queue without blocking, load them, in order, into the
+    /// array starting at the specified `values`, and load into the specified
+    /// `numPopped` the number of elements removed.  Return 0 on success, and
+    /// a non-zero value otherwise.  Specifically, return `e_SUCCESS` on
+    /// success, `e_DISABLED` if `isPopFrontDisabled()`, `e_EMPTY` if
+    /// `!isPopFrontDisabled()` and the queue was empty, and `e_FAILED` if an
+    /// error occurs.  On success, `*numPopped` is in the range
+    /// `[1 .. maxNumValues]`; on failure, `*numPopped` is 0 and `values` is
+    /// not changed.  The behavior is undefined unless `values` refers to an
+    /// array of at least `maxNumValues` elements, and `0 < maxNumValues`.
+    int tryPopFrontBatch(TYPE        *values,
+                         bsl::size_t  maxNumValues,
+                         bsl::size_t *numPopped);
+
     /// Append the specified `value` to the back of this queue.  Return 0 on
     /// success, and a non-zero value otherwise.  Specifically, return
     /// `e_SUCCESS` on success, `e_DISABLED` if `isPushBackDisabled()`,
@@ -640,6 +876,21 @@ class BoundedQueue {
     /// `e_FAILED` if an error occurs.  On failure, `value` is not changed.
     int tryPushBack(bslmf::MovableRef<TYPE> value);
 
+    /// Append, in order and without blocking, as many of the specified
+    /// `numValues` elements of the array starting at the specified `values`
+    /// to the back of this queue as the available capacity allows, and load
+    /// into the specified `numPushed` the number of elements appended.  Return
+    /// 0 on success, and a non-zero value otherwise.  Specifically, return
+    /// `e_SUCCESS` if at least one element was appended (or `0 == numValues`),
+    /// `e_DISABLED` if `isPushBackDisabled()`, `e_FULL` if
+    /// `!isPushBackDisabled()` and the queue was full, and `e_FAILED` if an
+    /// error occurs.  On failure, `*numPushed` is 0.  The behavior is
+    /// undefined unless `values` refers to an array of at least `numValues`
+    /// elements.
+    int tryPushBackBatch(const TYPE  *values,
+                         bsl::size_t  numValues,
+                         bsl::size_t *numPushed);
+
                        // Enqueue/Dequeue State
 
     /// Disable dequeueing from this queue.  All subsequent invocations of
@@ -761,6 +1012,99 @@ void BoundedQueue_PushExceptionCompleteProctor<TYPE>::release()
     d_queue_p = 0;
 }
 
+                 // ----------------------------------------
+                 // class BoundedQueue_PopBatchCompleteGuard
+                 // ----------------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+BoundedQueue_PopBatchCompleteGuard<TYPE>::BoundedQueue_PopBatchCompleteGuard(
+                                             TYPE                *queue,
+                                             bsls::Types::Uint64  index,
+                                             int                  numNodes,
+                                             int                  numPermits)
+: d_queue_p(queue)
+, d_index(index)
+, d_numNodes(numNodes)
+, d_numUnprocessed(numNodes)
+, d_numPermits(numPermits)
+{
+}
+
+template <class TYPE>
+inline
+BoundedQueue_PopBatchCompleteGuard<TYPE>::~BoundedQueue_PopBatchCompleteGuard()
+{
+    d_queue_p->popBatchComplete(d_index,
+                                d_numUnprocessed,
+                                d_numNodes,
+                                d_numPermits);
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void BoundedQueue_PopBatchCompleteGuard<TYPE>::advance(bool loadedFlag)
+{
+    BSLS_ASSERT(0 < d_numUnprocessed);
+
+    ++d_index;
+    --d_numUnprocessed;
+    if (loadedFlag) {
+        --d_numPermits;
+    }
+}
+
+template <class TYPE>
+inline
+int BoundedQueue_PopBatchCompleteGuard<TYPE>::release()
+{
+    BSLS_ASSERT(0 == d_numUnprocessed);
+
+    int numPermits = d_numPermits;
+    d_numPermits   = 0;
+    return numPermits;
+}
+
+              // ------------------------------------------
+              // class BoundedQueue_PushBatchCompleteGuard
+              // ------------------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+BoundedQueue_PushBatchCompleteGuard<TYPE>::BoundedQueue_PushBatchCompleteGuard(
+                                               TYPE                *queue,
+                                               bsls::Types::Uint64  index,
+                                               int                  numNodes)
+: d_queue_p(queue)
+, d_index(index)
+, d_numPushed(0)
+, d_numUnwritten(numNodes)
+{
+}
+
+template <class TYPE>
+inline
+BoundedQueue_PushBatchCompleteGuard<TYPE>::
+                                         ~BoundedQueue_PushBatchCompleteGuard()
+{
+    d_queue_p->pushBatchComplete(d_index, d_numPushed, d_numUnwritten);
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void BoundedQueue_PushBatchCompleteGuard<TYPE>::advance()
+{
+    BSLS_ASSERT(0 < d_numUnwritten);
+
+    ++d_index;
+    ++d_numPushed;
+    --d_numUnwritten;
+}
+
                          // ------------------------
                          // struct BoundedQueue_Node
                          // ------------------------
@@ -809,6 +1153,15 @@ bool BoundedQueue<TYPE>::circularlyGreater(Uint lhs, Uint rhs)
                      : (rhs - lhs) >  k_MAXIMUM_CIRCULAR_DIFFERENCE;
 }
 
+template <class TYPE>
+inline
+int BoundedQueue<TYPE>::clampNumValues(bsl::size_t numValues)
+{
+    return numValues < static_cast<bsl::size_t>(INT_MAX)
+           ? static_cast<int>(numValues)
+           : INT_MAX;
+}
+
 template <class TYPE>
 inline
 bool BoundedQueue<TYPE>::isQuiescentState(bsls::Types::Uint64 count)
@@ -863,6 +1216,58 @@ bsls::Types::Uint64 BoundedQueue<TYPE>::unmarkStartedOperation(
 }
 
 // PRIVATE MANIPULATORS
+template <class TYPE>
+void BoundedQueue<TYPE>::popBatchComplete(Uint64 index,
+                                          int    numUnprocessed,
+                                          int    numNodes,
+                                          int    numPermits)
+{
+    // Unprocessed nodes remain only if an exception occurred while loading a
+    // value; the values of these nodes are discarded.
+
+    for (; 0 < numUnprocessed; --numUnprocessed, ++index) {
+        Node& node = d_element_p[index % d_capacity];
+
+        if (!node.isUnconstructed()) {
+            node.d_value.object().~TYPE();
+            --numPermits;
+        }
+    }
+
+    // Permits not matched with a node of the reserved range refer to elements
+    // beyond the range, and are returned for use by other "pop" operations.
+
+    if (0 < numPermits) {
+        d_popSemaphore.post(numPermits);
+    }
+
+    Uint64 count = markFinishedOperation(&d_popCount, numNodes);
+    if (isQuiescentState(count)) {
+
+        // The total number of popped elements is 'count & k_STARTED_MASK'.
+        // Attempt, once, to zero the count and, if successful, post to the
+        // push semaphore.
+
+        if (AtomicOp::testAndSwapUint64AcqRel(&d_popCount,
+                                              count,
+                                              0) == count) {
+            d_pushSemaphore.postWithRedundantSignal(
+                                      static_cast<int>(count & k_STARTED_MASK),
+                                      static_cast<int>(d_capacity),
+                                      1);
+
+            Uint emptyCount = AtomicOp::getUintAcquire(&d_emptyWaiterCount);
+
+            if (isEmpty() && updateEmptyCountSeen(emptyCount)) {
+                {
+                    bslmt::LockGuard<bslmt::Mutex> guard(&d_emptyMutex);
+                }
+                d_emptyCondition.broadcast();
+            }
+        }
+    }
+}
+
 template <class TYPE>
 inline
 void BoundedQueue<TYPE>::popComplete(Node *node)
@@ -930,6 +1335,57 @@ void BoundedQueue<TYPE>::popFrontHelper(TYPE *value)
 #endif
 }
 
+template <class TYPE>
+void BoundedQueue<TYPE>::popFrontBatchHelper(TYPE *values, int numValues)
+{
+    // Reserve a range of 'numPermits' nodes with a single update of each of
+    // 'd_popCount' and 'd_popIndex'.  Nodes marked for reclamation are not
+    // counted in 'd_popSemaphore', so a range containing such nodes holds
+    // fewer than 'numPermits' values and a further range is reserved for the
+    // unmatched permits (see 'removeAll').
+
+    int numPermits = numValues;
+
+    while (numPermits) {
+        const int count = numPermits;
+
+        markStartedOperation(&d_popCount, count);
+
+        // 'd_popIndex' stores the next location to use (want the original
+        // value)
+
+        Uint64 index = AtomicOp::addUint64NvAcqRel(&d_popIndex, count)
+                                                                       - count;
+
+        BoundedQueue_PopBatchCompleteGuard<BoundedQueue<TYPE> > guard(
+                                                                     this,
+                                                                     index,
+                                                                     count,
+                                                                     count);
+
+        for (int i = 0; i < count; ++i, ++index) {
+            Node& node = d_element_p[index % d_capacity];
+
+            if (node.isUnconstructed()) {
+                guard.advance(false);
+                continue;                                           // CONTINUE
+            }
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+            *values = bslmf::MovableRefUtil::move(node.d_value.object());
+#else
+            *values = node.d_value.object();
+#endif
+            node.d_value.object().~TYPE();
+
+            ++values;
+            guard.advance(true);
+        }
+
+        numPermits = guard.release();
+    }
+}
+
 template <class TYPE>
 inline
 void BoundedQueue<TYPE>::pushComplete()
@@ -974,6 +1430,74 @@ void BoundedQueue<TYPE>::pushExceptionComplete()
     }
 }
 
+template <class TYPE>
+void BoundedQueue<TYPE>::pushBackBatchHelper(const TYPE *values, int numValues)
+{
+    markStartedOperation(&d_pushCount, numValues);
+
+    // 'd_pushIndex' stores the next location to use (want the original value)
+
+    Uint64 index = AtomicOp::addUint64NvAcqRel(&d_pushIndex, numValues)
+                                                                   - numValues;
+
+    BoundedQueue_PushBatchCompleteGuard<BoundedQueue<TYPE> > guard(this,
+                                                                   index,
+                                                                   numValues);
+
+    for (int i = 0; i < numValues; ++i, ++index) {
+        Node& node = d_element_p[index % d_capacity];
+
+        node.setIsUnconstructed(true);
+
+        bslalg::ScalarPrimitives::copyConstruct(node.d_value.address(),
+                                                values[i],
+                                                d_allocator_p);
+
+        node.setIsUnconstructed(false);
+
+        guard.advance();
+    }
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::pushBatchComplete(Uint64 index,
+                                           int    numPushed,
+                                           int    numUnwritten)
+{
+    // Unwritten nodes remain only if an exception occurred while writing a
+    // value; these nodes are skipped, and reclaimed, by "pop" operations.
+
+    for (int i = 0; i < numUnwritten; ++i, ++index) {
+        d_element_p[index % d_capacity].setIsUnconstructed(true);
+    }
+
+    // Mark the written nodes finished, and the unwritten nodes aborted, with a
+    // single update of 'd_pushCount'.
+
+    Uint64 count = AtomicOp::addUint64NvAcqRel(
+                                 &d_pushCount,
+                                 numPushed * k_FINISHED_INC
+                                 + numUnwritten * k_STARTED_DEC);
+
+    int numToPost = static_cast<int>(count & k_STARTED_MASK);
+
+    if (0 != numToPost && isQuiescentState(count)) {
+
+        // The total number of pushed elements is 'count & k_STARTED_MASK'.
+        // Attempt, once, to zero the count and, if successful, post to the pop
+        // semaphore.
+
+        if (AtomicOp::testAndSwapUint64AcqRel(&d_pushCount,
+                                               count,
+                                               0) == count) {
+            d_popSemaphore.postWithRedundantSignal(
+                                                 numToPost,
+                                                 static_cast<int>(d_capacity),
+                                                 1);
+        }
+    }
+}
+
 template <class TYPE>
 inline
 bool BoundedQueue<TYPE>::updateEmptyCountSeen(Uint emptyCount)
@@ -1051,6 +1575,38 @@ int BoundedQueue<TYPE>::popFront(TYPE *value)
     return e_SUCCESS;
 }
 
+template <class TYPE>
+int BoundedQueue<TYPE>::popFrontBatch(TYPE        *values,
+                                      bsl::size_t  maxNumValues,
+                                      bsl::size_t *numPopped)
+{
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 < maxNumValues);
+    BSLS_ASSERT(numPopped);
+
+    *numPopped = 0;
+
+    const int maxNum = clampNumValues(maxNumValues);
+
+    int num = d_popSemaphore.isDisabled() ? 0 : d_popSemaphore.take(maxNum);
+    if (0 == num) {
+        int rv = d_popSemaphore.wait();
+        if (rv) {
+            if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+                return e_DISABLED;                                    // RETURN
+            }
+            return e_FAILED;                                          // RETURN
+        }
+        num = 1 + d_popSemaphore.take(maxNum - 1);
+    }
+
+    popFrontBatchHelper(values, num);
+
+    *numPopped = num;
+
+    return e_SUCCESS;
+}
+
 template <class TYPE>
 int BoundedQueue<TYPE>::pushBack(const TYPE& value)
 {
@@ -1124,6 +1680,48 @@ int BoundedQueue<TYPE>::pushBack(bslmf::MovableRef<TYPE> value)
     return e_SUCCESS;
 }
 
+template <class TYPE>
+int BoundedQueue<TYPE>::pushBackBatch(const TYPE  *values,
+                                      bsl::size_t  numValues,
+                                      bsl::size_t *numPushed)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    bsl::size_t pushed = 0;
+    int         result = e_SUCCESS;
+
+    while (pushed < numValues) {
+        if (d_pushSemaphore.isDisabled()) {
+            result = e_DISABLED;
+            break;                                                     // BREAK
+        }
+
+        const int maxNum = clampNumValues(numValues - pushed);
+
+        int num = d_pushSemaphore.take(maxNum);
+        if (0 == num) {
+            int rv = d_pushSemaphore.wait();
+            if (rv) {
+                result = bslmt::FastPostSemaphore::e_DISABLED == rv
+                         ? e_DISABLED
+                         : e_FAILED;
+                break;                                                 // BREAK
+            }
+            num = 1 + d_pushSemaphore.take(maxNum - 1);
+        }
+
+        pushBackBatchHelper(values + pushed, num);
+
+        pushed += num;
+    }
+
+    if (numPushed) {
+        *numPushed = pushed;
+    }
+
+    return result;
+}
+
 template <class TYPE>
 void BoundedQueue<TYPE>::removeAll()
 {
@@ -1210,6 +1808,33 @@ int BoundedQueue<TYPE>::tryPopFront(TYPE *value)
     return e_SUCCESS;
 }
 
+template <class TYPE>
+int BoundedQueue<TYPE>::tryPopFrontBatch(TYPE        *values,
+                                         bsl::size_t  maxNumValues,
+                                         bsl::size_t *numPopped)
+{
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 < maxNumValues);
+    BSLS_ASSERT(numPopped);
+
+    *numPopped = 0;
+
+    if (d_popSemaphore.isDisabled()) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    int num = d_popSemaphore.take(clampNumValues(maxNumValues));
+    if (0 == num) {
+        return e_EMPTY;                                               // RETURN
+    }
+
+    popFrontBatchHelper(values, num);
+
+    *numPopped = num;
+
+    return e_SUCCESS;
+}
+
 template <class TYPE>
 int BoundedQueue<TYPE>::tryPushBack(const TYPE& value)
 {
@@ -1286,6 +1911,36 @@ int BoundedQueue<TYPE>::tryPushBack(bslmf::MovableRef<TYPE> value)
 
     pushComplete();
 
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+int BoundedQueue<TYPE>::tryPushBackBatch(const TYPE  *values,
+                                         bsl::size_t  numValues,
+                                         bsl::size_t *numPushed)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(numPushed);
+
+    *numPushed = 0;
+
+    if (d_pushSemaphore.isDisabled()) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    if (0 == numValues) {
+        return e_SUCCESS;                                             // RETURN
+    }
+
+    int num = d_pushSemaphore.take(clampNumValues(numValues));
+    if (0 == num) {
+        return e_FULL;                                                // RETURN
+    }
+
+    pushBackBatchHelper(values, num);
+
+    *numPushed = num;
+
     return e_SUCCESS;
 }
 
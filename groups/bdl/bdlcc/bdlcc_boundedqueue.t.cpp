@@ -18,6 +18,8 @@
 #include <bslmt_mutex.h>
 #include <bslmt_threadgroup.h>
 #include <bslmt_threadutil.h>
+#include <bslmt_throughputbenchmark.h>
+#include <bslmt_throughputbenchmarkresult.h>
 #include <bslmt_timedcompletionguard.h>
 
 #include <bsls_assert.h>
@@ -34,6 +36,7 @@
 #include <bsl_cstring.h>
 #include <bsl_cstdlib.h>
 #include <bsl_format.h>
+#include <bsl_iomanip.h>
 #include <bsl_iostream.h>
 #include <bsl_ostream.h>
 #include <bsl_string.h>
@@ -82,12 +85,16 @@ using namespace bsl;
 // [ 2] BoundedQueue(bsl::size_t capacity, bslma::Allocator bA = 0);
 // [ 2] ~BoundedQueue();
 // [ 2] int popFront(TYPE *value);
+// [16] int popFrontBatch(TYPE *, size_t, size_t *);
 // [ 2] int pushBack(const TYPE& value);
 // [ 9] int pushBack(bslmf::MovableRef<TYPE> value);
+// [16] int pushBackBatch(const TYPE *, size_t, size_t * = 0);
 // [ 2] void removeAll();
 // [ 7] int tryPopFront(TYPE *value);
+// [16] int tryPopFrontBatch(TYPE *, size_t, size_t *);
 // [ 6] int tryPushBack(const TYPE& value);
 // [ 9] int tryPushBack(bslmf::MovableRef<TYPE> value);
+// [16] int tryPushBackBatch(const TYPE *, size_t, size_t *);
 // [ 5] void disablePopFront();
 // [ 5] void disablePushBack();
 // [ 5] void enablePopFront();
@@ -102,7 +109,7 @@ using namespace bsl;
 // [ 4] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [16] USAGE EXAMPLE
+// [17] USAGE EXAMPLE
 // [ 3] Obj& gg(Obj *object, const char *spec);
 // [ 3] int ggg(Obj *object, const char *spec);
 // [ 2] CONCERN: 0 == e_SUCCESS
@@ -114,6 +121,7 @@ using namespace bsl;
 // [13] DRQS 164984269: `removeAll` STARTED/FINISHED ISSUE
 // [14] DRQS 153332608: `pushBack`, `pushBack`, `waitUntilEmpty`
 // [15] DRQS 168011541: `waitUntilEmpty` RACE WITH `disablePopFront`
+// [-1] THROUGHPUT BENCHMARK: BATCH OPERATIONS
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -160,6 +168,13 @@ void aSsErT(bool condition, const char *message, int line)
 #define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
 #define L_           BSLIM_TESTUTIL_L_  // current Line number
 
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
 // ============================================================================
 //                        GLOBAL MACROS FOR TESTING
 // ----------------------------------------------------------------------------
@@ -532,6 +547,17 @@ extern "C" void *deferredDisablePopFront(void *arg)
     return 0;
 }
 
+extern "C" void *deferredDisablePushBack(void *arg)
+{
+    Obj& mX = *static_cast<Obj *>(arg);
+
+    bslmt::ThreadUtil::microSleep(0, 1);
+
+    mX.disablePushBack();
+
+    return 0;
+}
+
 extern "C" void *deferredPopFront(void *arg)
 {
     Obj& mX = *static_cast<Obj *>(arg);
@@ -837,6 +863,166 @@ extern "C" void *case13_popFront(void *arg)
     return 0;
 }
 
+const int k_BATCH_NUM_PUSH_THREADS = 3;
+const int k_BATCH_NUM_PER_THREAD   = 20000;
+
+struct BatchData {
+    Obj             *d_obj_p;
+    int              d_threadIndex;   // index of pushing thread
+    bsls::AtomicInt *d_numPopped_p;   // total number of popped elements
+};
+
+/// Push, using batches of varying size, `k_BATCH_NUM_PER_THREAD` values
+/// encoding the thread index and a sequence number to the queue of the
+/// specified `arg`, which refers to a `BatchData`.
+extern "C" void *batchPush(void *arg)
+{
+    BatchData& data = *static_cast<BatchData *>(arg);
+    Obj&       mX   = *data.d_obj_p;
+
+    int values[7];
+    int sequence = 0;
+    int size     = 1;
+
+    while (sequence < k_BATCH_NUM_PER_THREAD) {
+        int num = k_BATCH_NUM_PER_THREAD - sequence < size
+                  ? k_BATCH_NUM_PER_THREAD - sequence
+                  : size;
+
+        for (int i = 0; i < num; ++i) {
+            values[i] = data.d_threadIndex * k_BATCH_NUM_PER_THREAD
+                      + sequence
+                      + i;
+        }
+
+        bsl::size_t numPushed = 0;
+
+        ASSERT(e_SUCCESS == mX.pushBackBatch(values, num, &numPushed));
+        ASSERTV(num, numPushed, static_cast<bsl::size_t>(num) == numPushed);
+
+        sequence += num;
+        size      = size % 7 + 1;
+    }
+
+    return 0;
+}
+
+/// Pop, using batches, values from the queue of the specified `arg`, which
+/// refers to a `BatchData`, until the queue is dequeue disabled, and verify
+/// the values pushed by each thread are observed in increasing order.
+extern "C" void *batchPop(void *arg)
+{
+    BatchData& data = *static_cast<BatchData *>(arg);
+    Obj&       mX   = *data.d_obj_p;
+
+    int values[5];
+    int last[k_BATCH_NUM_PUSH_THREADS];
+
+    for (int i = 0; i < k_BATCH_NUM_PUSH_THREADS; ++i) {
+        last[i] = -1;
+    }
+
+    bsl::size_t numPopped;
+    while (e_SUCCESS == mX.popFrontBatch(values, 5, &numPopped)) {
+        ASSERT(0 < numPopped && 5 >= numPopped);
+
+        for (bsl::size_t i = 0; i < numPopped; ++i) {
+            int thread   = values[i] / k_BATCH_NUM_PER_THREAD;
+            int sequence = values[i] % k_BATCH_NUM_PER_THREAD;
+
+            ASSERTV(thread, 0 <= thread && k_BATCH_NUM_PUSH_THREADS > thread);
+            ASSERTV(thread, last[thread], sequence, last[thread] < sequence);
+
+            last[thread] = sequence;
+        }
+
+        *data.d_numPopped_p += static_cast<int>(numPopped);
+    }
+
+    return 0;
+}
+
+                         // =========================
+                         // class BatchBenchmarkQueue
+                         // =========================
+
+/// This class provides the run, shutdown, and cleanup functions used with a
+/// `bslmt::ThroughputBenchmark` to measure the throughput of a
+/// `bdlcc::BoundedQueue<int>` using either single-element operations (batch
+/// size of 0) or batch operations.
+class BatchBenchmarkQueue {
+
+    // DATA
+    Obj         d_queue;      // queue under test
+    bsl::size_t d_batchSize;  // elements per batch, 0 for single-element
+
+  public:
+    // PUBLIC CONSTANTS
+    enum { k_MAX_BATCH_SIZE = 1024 };
+
+    // CREATORS
+
+    /// Create a benchmark queue having the specified `capacity` that
+    /// transfers elements in batches of the specified `batchSize` (or one at
+    /// a time using `pushBack` and `popFront` if `0 == batchSize`).
+    /// Optionally specify a `basicAllocator` used to supply memory.  The
+    /// behavior is undefined unless `batchSize <= k_MAX_BATCH_SIZE`.
+    BatchBenchmarkQueue(bsl::size_t       capacity,
+                        bsl::size_t       batchSize,
+                        bslma::Allocator *basicAllocator = 0)
+    : d_queue(capacity, basicAllocator)
+    , d_batchSize(batchSize)
+    {
+    }
+
+    // MANIPULATORS
+
+    /// Remove all elements from the queue and re-enable the queue.
+    void cleanup(bool)
+    {
+        d_queue.removeAll();
+        d_queue.enablePushBack();
+        d_queue.enablePopFront();
+    }
+
+    /// Pop one batch of elements.
+    void pop(int)
+    {
+        int values[k_MAX_BATCH_SIZE];
+
+        if (0 == d_batchSize) {
+            d_queue.popFront(values);
+        }
+        else {
+            bsl::size_t numPopped;
+            d_queue.popFrontBatch(values, d_batchSize, &numPopped);
+        }
+    }
+
+    /// Push one batch of elements.
+    void push(int threadIndex)
+    {
+        int values[k_MAX_BATCH_SIZE];
+
+        if (0 == d_batchSize) {
+            d_queue.pushBack(threadIndex);
+        }
+        else {
+            for (bsl::size_t i = 0; i < d_batchSize; ++i) {
+                values[i] = threadIndex;
+            }
+            d_queue.pushBackBatch(values, d_batchSize);
+        }
+    }
+
+    /// Disable the queue so blocked threads return.
+    void shutdown(bool)
+    {
+        d_queue.disablePushBack();
+        d_queue.disablePopFront();
+    }
+};
+
 // ============================================================================
 //               GENERATOR FUNCTIONS `gg` AND `ggg` FOR TESTING
 // ----------------------------------------------------------------------------
@@ -1065,7 +1251,7 @@ int main(int argc, char *argv[])
                                       bsl::format("case {}", test)));
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 16: {
+      case 17: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1092,6 +1278,343 @@ int main(int argc, char *argv[])
         myProducer(k_NUM_THREADS);
 
       } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // BATCH OPERATIONS
+        //
+        // Concerns:
+        // 1. `pushBackBatch` appends all the supplied elements, in order,
+        //    blocking while the queue is full.
+        //
+        // 2. `tryPushBackBatch` appends as many elements as fit, and returns
+        //    `e_FULL` if none fit.
+        //
+        // 3. `popFrontBatch` and `tryPopFrontBatch` remove up to the
+        //    requested number of elements, in order; `tryPopFrontBatch`
+        //    returns `e_EMPTY` if the queue is empty.
+        //
+        // 4. The batch methods return `e_DISABLED` when the queue is disabled,
+        //    and blocked batch methods return when the queue is disabled.
+        //
+        // 5. Batches that wrap around the end of the internal element array
+        //    are handled correctly.
+        //
+        // 6. If the copy of an element of a batch throws, the preceding
+        //    elements remain in the queue, the remaining elements are not
+        //    added, and the capacity used by the failed elements is reclaimed.
+        //
+        // 7. Batch operations interoperate with concurrent batch operations,
+        //    preserving the order of the elements pushed by each thread.
+        //
+        // 8. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Push and pop batches of various sizes on a queue of capacity 8
+        //    and verify the return values, output counts, and values.
+        //    (C-1..3, 5)
+        //
+        // 2. Disable the queue and verify the return values; block a
+        //    `popFrontBatch` on an empty queue and a `pushBackBatch` on a full
+        //    queue and disable the queue from another thread.  (C-4)
+        //
+        // 3. Using a test allocator with an allocation limit, cause the copy
+        //    of the second element of a batch to throw and verify the state
+        //    of the queue.  (C-6)
+        //
+        // 4. Run several threads invoking `pushBackBatch` concurrently with
+        //    two threads invoking `popFrontBatch` and verify the number and
+        //    ordering of the popped values.  (C-7)
+        //
+        // 5. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-8)
+        //
+        // Testing:
+        //   int popFrontBatch(TYPE *, size_t, size_t *);
+        //   int pushBackBatch(const TYPE *, size_t, size_t * = 0);
+        //   int tryPopFrontBatch(TYPE *, size_t, size_t *);
+        //   int tryPushBackBatch(const TYPE *, size_t, size_t *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCH OPERATIONS" << endl
+                          << "================" << endl;
+
+        if (verbose) cout << "\nSingle-threaded batch operations." << endl;
+        {
+            Obj mX(8);  const Obj& X = mX;
+
+            int         values[12] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+            int         results[12];
+            bsl::size_t num;
+
+            ASSERT(e_SUCCESS == mX.pushBackBatch(values, 5, &num));
+            ASSERT(5 == num);
+            ASSERT(5 == X.numElements());
+
+            ASSERT(e_SUCCESS == mX.tryPushBackBatch(values + 5, 5, &num));
+            ASSERT(3 == num);
+            ASSERT(8 == X.numElements());
+            ASSERT(X.isFull());
+
+            num = 99;
+            ASSERT(e_FULL == mX.tryPushBackBatch(values + 8, 4, &num));
+            ASSERT(0 == num);
+
+            ASSERT(e_SUCCESS == mX.tryPushBackBatch(values, 0, &num));
+            ASSERT(0 == num);
+
+            ASSERT(e_SUCCESS == mX.tryPopFrontBatch(results, 3, &num));
+            ASSERT(3 == num);
+            for (int i = 0; i < 3; ++i) {
+                ASSERTV(i, results[i], i + 1 == results[i]);
+            }
+
+            ASSERT(e_SUCCESS == mX.popFrontBatch(results, 12, &num));
+            ASSERT(5 == num);
+            for (int i = 0; i < 5; ++i) {
+                ASSERTV(i, results[i], i + 4 == results[i]);
+            }
+            ASSERT(X.isEmpty());
+
+            num = 99;
+            ASSERT(e_EMPTY == mX.tryPopFrontBatch(results, 12, &num));
+            ASSERT(0 == num);
+        }
+
+        if (verbose) cout << "\nBatches wrapping the element array." << endl;
+        {
+            Obj mX(8);  const Obj& X = mX;
+
+            int next     = 0;
+            int expected = 0;
+
+            for (int iteration = 0; iteration < 100; ++iteration) {
+                const int pushSize = iteration % 8 + 1;
+                const int popSize  = (iteration * 3) % 8 + 1;
+
+                int         values[8];
+                bsl::size_t num;
+
+                for (int i = 0; i < pushSize; ++i) {
+                    values[i] = next++;
+                }
+
+                ASSERT(e_SUCCESS == mX.pushBackBatch(values, pushSize, &num));
+                ASSERTV(iteration, num, pushSize == static_cast<int>(num));
+
+                while (!X.isEmpty()) {
+                    ASSERT(e_SUCCESS == mX.tryPopFrontBatch(values,
+                                                            popSize,
+                                                            &num));
+                    ASSERT(0 < num && popSize >= static_cast<int>(num));
+
+                    for (bsl::size_t i = 0; i < num; ++i) {
+                        ASSERTV(iteration, values[i], expected,
+                                expected == values[i]);
+                        ++expected;
+                    }
+                }
+            }
+            ASSERT(next == expected);
+        }
+
+        if (verbose) cout << "\nBatch operations and disablement." << endl;
+        {
+            Obj mX(8);  const Obj& X = mX;
+
+            int         values[12] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+            bsl::size_t num;
+
+            mX.disablePushBack();
+
+            num = 99;
+            ASSERT(e_DISABLED == mX.pushBackBatch(values, 4, &num));
+            ASSERT(0 == num);
+            num = 99;
+            ASSERT(e_DISABLED == mX.tryPushBackBatch(values, 4, &num));
+            ASSERT(0 == num);
+            ASSERT(X.isEmpty());
+
+            mX.enablePushBack();
+
+            ASSERT(e_SUCCESS == mX.pushBackBatch(values, 4));
+
+            mX.disablePopFront();
+
+            num = 99;
+            ASSERT(e_DISABLED == mX.popFrontBatch(values, 4, &num));
+            ASSERT(0 == num);
+            num = 99;
+            ASSERT(e_DISABLED == mX.tryPopFrontBatch(values, 4, &num));
+            ASSERT(0 == num);
+            ASSERT(4 == X.numElements());
+
+            mX.enablePopFront();
+
+            // A `pushBackBatch` larger than the capacity blocks once the
+            // queue is full, and returns when push is disabled.
+
+            bslmt::ThreadUtil::Handle handle;
+            bslmt::ThreadUtil::create(&handle,
+                                      deferredDisablePushBack,
+                                      &mX);
+
+            ASSERT(e_DISABLED == mX.pushBackBatch(values, 12, &num));
+            ASSERT(4 == num);
+            ASSERT(X.isFull());
+
+            bslmt::ThreadUtil::join(handle);
+
+            mX.removeAll();
+            mX.enablePushBack();
+
+            // A `popFrontBatch` on an empty queue blocks, and returns when pop
+            // is disabled.
+
+            bslmt::ThreadUtil::create(&handle,
+                                      deferredDisablePopFront,
+                                      &mX);
+
+            num = 99;
+            ASSERT(e_DISABLED == mX.popFrontBatch(values, 4, &num));
+            ASSERT(0 == num);
+
+            bslmt::ThreadUtil::join(handle);
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) cout << "\nException during `pushBackBatch`." << endl;
+        {
+            // white-box test for when the element copy throws
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            bdlcc::BoundedQueue<AllocExceptionHelper>        mX(4, &sa);
+            const bdlcc::BoundedQueue<AllocExceptionHelper>& X = mX;
+
+            bsl::vector<AllocExceptionHelper> values(3,
+                                                     AllocExceptionHelper(&sa),
+                                                     &sa);
+
+            int numException = 0;
+
+            sa.setAllocationLimit(1);
+            try {
+                mX.pushBackBatch(values.data(), 3);
+            } catch (BloombergLP::bslma::TestAllocatorException& e) {
+                ++numException;
+            }
+            sa.setAllocationLimit(-1);
+
+            ASSERT(1 == numException);
+            ASSERT(1 == X.numElements());
+
+            AllocExceptionHelper              result(&sa);
+            bsl::vector<AllocExceptionHelper> results(4, result, &sa);
+            bsl::size_t                       num;
+
+            ASSERT(e_SUCCESS == mX.tryPopFrontBatch(results.data(), 4, &num));
+            ASSERT(1 == num);
+            ASSERT(0 == X.numElements());
+            ASSERT(!X.isEmpty());
+
+            // The two failed elements are not available to "push" operations
+            // until they are reclaimed by a "pop" operation.
+
+            values.resize(4, AllocExceptionHelper(&sa));
+
+            ASSERT(e_SUCCESS == mX.tryPushBackBatch(values.data(), 4, &num));
+            ASSERT(2 == num);
+            ASSERT(X.isFull());
+            ASSERT(2 == X.numElements());
+
+            // The reserved range of the next "pop" starts with the failed
+            // elements, which are skipped and reclaimed.
+
+            ASSERT(e_SUCCESS == mX.popFrontBatch(results.data(), 4, &num));
+            ASSERT(2 == num);
+            ASSERT(X.isEmpty());
+
+            ASSERT(e_SUCCESS == mX.tryPushBackBatch(values.data(), 4, &num));
+            ASSERT(4 == num);
+            ASSERT(X.isFull());
+
+            ASSERT(e_SUCCESS == mX.popFrontBatch(results.data(), 4, &num));
+            ASSERT(4 == num);
+            ASSERT(X.isEmpty());
+        }
+#endif
+
+        if (verbose) cout << "\nConcurrent batch operations." << endl;
+        {
+            Obj mX(32);
+
+            bsls::AtomicInt numPopped(0);
+
+            BatchData pushData[k_BATCH_NUM_PUSH_THREADS];
+            BatchData popData = { &mX, 0, &numPopped };
+
+            bslmt::ThreadUtil::Handle pushHandle[k_BATCH_NUM_PUSH_THREADS];
+            bslmt::ThreadUtil::Handle popHandle[2];
+
+            for (int i = 0; i < 2; ++i) {
+                bslmt::ThreadUtil::create(&popHandle[i], batchPop, &popData);
+            }
+
+            for (int i = 0; i < k_BATCH_NUM_PUSH_THREADS; ++i) {
+                pushData[i].d_obj_p       = &mX;
+                pushData[i].d_threadIndex = i;
+                pushData[i].d_numPopped_p = &numPopped;
+
+                bslmt::ThreadUtil::create(&pushHandle[i],
+                                          batchPush,
+                                          &pushData[i]);
+            }
+
+            for (int i = 0; i < k_BATCH_NUM_PUSH_THREADS; ++i) {
+                bslmt::ThreadUtil::join(pushHandle[i]);
+            }
+
+            ASSERT(e_SUCCESS == mX.waitUntilEmpty());
+
+            mX.disablePopFront();
+
+            for (int i = 0; i < 2; ++i) {
+                bslmt::ThreadUtil::join(popHandle[i]);
+            }
+
+            ASSERTV(numPopped,
+                    k_BATCH_NUM_PUSH_THREADS * k_BATCH_NUM_PER_THREAD ==
+                                                                   numPopped);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(8);
+
+            int         values[4] = { 1, 2, 3, 4 };
+            bsl::size_t num;
+
+            ASSERT_PASS(mX.pushBackBatch(values, 2, &num));
+            ASSERT_PASS(mX.pushBackBatch(0, 0, &num));
+            ASSERT_FAIL(mX.pushBackBatch(0, 2, &num));
+
+            ASSERT_PASS(mX.tryPushBackBatch(values, 2, &num));
+            ASSERT_FAIL(mX.tryPushBackBatch(values, 2, 0));
+
+            ASSERT_PASS(mX.tryPopFrontBatch(values, 2, &num));
+            ASSERT_FAIL(mX.tryPopFrontBatch(0, 2, &num));
+            ASSERT_FAIL(mX.tryPopFrontBatch(values, 0, &num));
+            ASSERT_FAIL(mX.tryPopFrontBatch(values, 2, 0));
+
+            ASSERT_PASS(mX.popFrontBatch(values, 2, &num));
+            ASSERT_FAIL(mX.popFrontBatch(0, 2, &num));
+            ASSERT_FAIL(mX.popFrontBatch(values, 0, &num));
+            ASSERT_FAIL(mX.popFrontBatch(values, 2, 0));
+        }
+      } break;
       case 15: {
         // --------------------------------------------------------------------
         // DRQS 168011541: `waitUntilEmpty` RACE WITH `disablePopFront`
@@ -3164,6 +3687,135 @@ int main(int argc, char *argv[])
         ASSERT(3 == v);
         ASSERT(0 == X.numElements());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // THROUGHPUT BENCHMARK: BATCH OPERATIONS
+        //   Measure the element throughput of producers and consumers using
+        //   single-element operations and batch operations.  Command line
+        //   parameters:
+        //   2nd parameter: comma separated batch sizes; 0 denotes the
+        //       single-element `pushBack` and `popFront` (default
+        //       "0,1,4,16,64").
+        //   3rd parameter: number of producer threads (defaults to 2).
+        //   4th parameter: number of consumer threads (defaults to 2).
+        //   5th parameter: capacity of the queue (defaults to 1024).
+        //   6th parameter: number of milliseconds each sample runs (defaults
+        //       to 1000).
+        //   7th parameter: number of samples to run (defaults to 5).
+        //
+        // Concerns:
+        // 1. Report the median and quartile throughputs, in elements pushed
+        //    per second, for each batch size.
+        //
+        // Plan:
+        // 1. For each batch size, use a `bslmt::ThroughputBenchmark` with a
+        //    producer thread group invoking `BatchBenchmarkQueue::push` and a
+        //    consumer thread group invoking `BatchBenchmarkQueue::pop`, and
+        //    scale the producer throughput by the batch size.  (C-1)
+        //
+        // Testing:
+        //   THROUGHPUT BENCHMARK: BATCH OPERATIONS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "THROUGHPUT BENCHMARK: BATCH OPERATIONS" << endl
+                          << "======================================" << endl;
+
+        bsl::vector<int> batchSizes;
+        {
+            bsl::string sizes = argc > 2 ? argv[2] : "0,1,4,16,64";
+
+            bsl::size_t pos = 0;
+            while (pos <= sizes.size()) {
+                bsl::size_t comma = sizes.find(',', pos);
+                if (bsl::string::npos == comma) {
+                    comma = sizes.size();
+                }
+                batchSizes.push_back(atoi(sizes.substr(pos,
+                                                       comma - pos).c_str()));
+                pos = comma + 1;
+            }
+        }
+
+        const int numProducers = argc > 3 ? atoi(argv[3]) :    2;
+        const int numConsumers = argc > 4 ? atoi(argv[4]) :    2;
+        const int capacity     = argc > 5 ? atoi(argv[5]) : 1024;
+        const int numMillis    = argc > 6 ? atoi(argv[6]) : 1000;
+        const int numSamples   = argc > 7 ? atoi(argv[7]) :    5;
+
+        // `bslmt::ThroughputBenchmark` creates its threads using the global
+        // allocator; supply a distinct one for the duration of this case.
+
+        bslma::TestAllocator  benchmarkAllocator("benchmark",
+                                                 veryVeryVeryVerbose);
+        bslma::Allocator     *globalAllocatorPtr =
+                                             bslma::Default::globalAllocator();
+
+        bslma::Default::setGlobalAllocator(&benchmarkAllocator);
+
+        cout << "Batch,NP,NC,Capacity,25%,50%,75%\n";
+
+        for (bsl::size_t i = 0; i < batchSizes.size(); ++i) {
+            const int batchSize = batchSizes[i];
+
+            ASSERTV(batchSize,
+                    0 <= batchSize
+                 && BatchBenchmarkQueue::k_MAX_BATCH_SIZE >= batchSize);
+            if (0 > batchSize
+             || BatchBenchmarkQueue::k_MAX_BATCH_SIZE < batchSize) {
+                continue;
+            }
+
+            BatchBenchmarkQueue queue(capacity, batchSize);
+
+            bslmt::ThroughputBenchmark       bench;
+            bslmt::ThroughputBenchmarkResult result;
+
+            typedef bslmt::ThroughputBenchmark TB;
+
+            const int producerGroup = bench.addThreadGroup(
+                               bdlf::BindUtil::bind(&BatchBenchmarkQueue::push,
+                                                    &queue,
+                                                    bdlf::PlaceHolders::_1),
+                               numProducers,
+                               0);
+            bench.addThreadGroup(
+                                bdlf::BindUtil::bind(&BatchBenchmarkQueue::pop,
+                                                     &queue,
+                                                     bdlf::PlaceHolders::_1),
+                                numConsumers,
+                                0);
+
+            bench.execute(&result,
+                          numMillis,
+                          numSamples,
+                          TB::InitializeSampleFunction(),
+                          bdlf::BindUtil::bind(&BatchBenchmarkQueue::shutdown,
+                                               &queue,
+                                               bdlf::PlaceHolders::_1),
+                          bdlf::BindUtil::bind(&BatchBenchmarkQueue::cleanup,
+                                               &queue,
+                                               bdlf::PlaceHolders::_1));
+
+            const double scale = 0 == batchSize ? 1.0 : batchSize;
+
+            double q1, median, q3;
+            result.getPercentile(&q1,     0.25, producerGroup);
+            result.getPercentile(&median, 0.5,  producerGroup);
+            result.getPercentile(&q3,     0.75, producerGroup);
+
+            cout << bsl::fixed << bsl::setprecision(0)
+                 << batchSize    << ","
+                 << numProducers << ","
+                 << numConsumers << ","
+                 << capacity     << ","
+                 << q1 * scale     << ","
+                 << median * scale << ","
+                 << q3 * scale     << "\n";
+        }
+
+        bslma::Default::setGlobalAllocator(globalAllocatorPtr);
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -2,6 +2,193 @@
 
 #include <bdlcc_cache.h>
 
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_cache_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+namespace {
+
+enum {
+    k_NUM_ROWS          = 4,    // number of hash functions (rows) of the
+                                // count-min sketch
+
+    k_MAX_COUNT         = 15,   // maximum value of a counter
+
+    k_SAMPLE_FACTOR     = 10    // number of accesses, per unit of capacity,
+                                // between two resets
+};
+
+// The capacity of the sketch is clamped, so that an unbounded cache does not
+// attempt to allocate an unbounded table.
+
+const bsl::size_t k_MAX_CAPACITY = bsl::size_t(1) << 24;
+
+const bsls::Types::Uint64 k_SEEDS[k_NUM_ROWS] = {
+    0xc3a5c85c97cb3127ULL,
+    0xb492b66fbe98f273ULL,
+    0x9ae16a3b2f90404fULL,
+    0xcbf29ce484222325ULL
+};
+
+}  // close unnamed namespace
+
+                        // ---------------------------
+                        // class Cache_FrequencySketch
+                        // ---------------------------
+
+// PRIVATE CLASS METHODS
+bsls::Types::Uint64 Cache_FrequencySketch::mix(bsl::size_t hashValue,
+                                               int         row)
+{
+    // This is the 64-bit finalizer of MurmurHash3, applied to the hash value
+    // offset by a per-row seed.
+
+    bsls::Types::Uint64 h = static_cast<bsls::Types::Uint64>(hashValue) +
+                                                                 k_SEEDS[row];
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+// PRIVATE MANIPULATORS
+void Cache_FrequencySketch::reset()
+{
+    const bsls::Types::Uint64 k_MASK = 0x7777777777777777ULL;
+
+    for (bsl::size_t i = 0; i <= d_tableMask; ++i) {
+        bsls::Types::Uint64 word = d_table_p[i].loadRelaxed();
+        while (true) {
+            const bsls::Types::Uint64 halved = (word >> 1) & k_MASK;
+            const bsls::Types::Uint64 prev   =
+                                      d_table_p[i].testAndSwap(word, halved);
+            if (prev == word) {
+                break;
+            }
+            word = prev;
+        }
+    }
+}
+
+// CREATORS
+Cache_FrequencySketch::Cache_FrequencySketch(
+                                           bsl::size_t       capacity,
+                                           bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_table_p(0)
+, d_tableMask(0)
+, d_sampleSize(0)
+, d_numAccesses(0)
+{
+    if (0 == capacity) {
+        return;                                                       // RETURN
+    }
+
+    if (capacity > k_MAX_CAPACITY) {
+        capacity = k_MAX_CAPACITY;
+    }
+
+    // Use one 64-bit word (i.e., 16 counters) per item of capacity, rounded
+    // up to a power of two.
+
+    bsl::size_t numWords = 16;
+    while (numWords < capacity) {
+        numWords <<= 1;
+    }
+
+    d_table_p = static_cast<bsls::AtomicUint64 *>(
+                  d_allocator_p->allocate(numWords * sizeof(*d_table_p)));
+    for (bsl::size_t i = 0; i < numWords; ++i) {
+        new (d_table_p + i) bsls::AtomicUint64(0);
+    }
+
+    d_tableMask  = numWords - 1;
+    d_sampleSize = static_cast<bsls::Types::Int64>(k_SAMPLE_FACTOR) *
+                                  static_cast<bsls::Types::Int64>(capacity);
+}
+
+Cache_FrequencySketch::~Cache_FrequencySketch()
+{
+    if (d_table_p) {
+        // 'bsls::AtomicUint64' is trivially destructible.
+
+        d_allocator_p->deallocate(d_table_p);
+    }
+}
+
+// MANIPULATORS
+void Cache_FrequencySketch::clear()
+{
+    for (bsl::size_t i = 0; d_table_p && i <= d_tableMask; ++i) {
+        d_table_p[i].storeRelaxed(0);
+    }
+    d_numAccesses.storeRelaxed(0);
+}
+
+void Cache_FrequencySketch::increment(bsl::size_t hashValue)
+{
+    if (!d_table_p) {
+        return;                                                       // RETURN
+    }
+
+    for (int row = 0; row < k_NUM_ROWS; ++row) {
+        const bsls::Types::Uint64 h     = mix(hashValue, row);
+        bsls::AtomicUint64&       word  = d_table_p[h & d_tableMask];
+        const int                 shift = static_cast<int>(h >> 60) * 4;
+
+        bsls::Types::Uint64 value = word.loadRelaxed();
+        while (((value >> shift) & k_MAX_COUNT) < k_MAX_COUNT) {
+            const bsls::Types::Uint64 prev = word.testAndSwap(
+                             value,
+                             value + (static_cast<bsls::Types::Uint64>(1)
+                                                                    << shift));
+            if (prev == value) {
+                break;
+            }
+            value = prev;
+        }
+    }
+
+    // Only the thread whose access reaches the sample size performs the
+    // reset, so that concurrent accesses do not halve the counters twice.
+
+    if (d_numAccesses.addRelaxed(1) == d_sampleSize) {
+        reset();
+        d_numAccesses.addRelaxed(-(d_sampleSize / 2));
+    }
+}
+
+// ACCESSORS
+int Cache_FrequencySketch::frequency(bsl::size_t hashValue) const
+{
+    if (!d_table_p) {
+        return 0;                                                     // RETURN
+    }
+
+    int result = k_MAX_COUNT;
+    for (int row = 0; row < k_NUM_ROWS; ++row) {
+        const bsls::Types::Uint64 h     = mix(hashValue, row);
+        const int                 shift = static_cast<int>(h >> 60) * 4;
+        const int                 count = static_cast<int>(
+               (d_table_p[h & d_tableMask].loadRelaxed() >> shift) &
+                                                                  k_MAX_COUNT);
+        if (count < result) {
+            result = count;
+        }
+    }
+    return result;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
 // ----------------------------------------------------------------------------
 // Copyright 2017 Bloomberg Finance L.P.
 //
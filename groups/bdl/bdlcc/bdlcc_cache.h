@@ -27,11 +27,49 @@ BSLS_IDENT("$Id: $")
 // fixed maximum size is obtained by setting the high and low watermarks to the
 // same value.
 //
-// Two eviction policies are supported: LRU (Least Recently Used) and FIFO
-// (First In, First Out).  With LRU, the item that has *not* been accessed for
-// the longest period of time will be evicted first.  With FIFO, the eviction
+// Five eviction policies are supported: LRU (Least Recently Used), FIFO
+// (First In, First Out), CLOCK, SIEVE, and W-TinyLFU (Windowed Tiny Least
+// Frequently Used).  With LRU, the item that has *not* been accessed for the
+// longest period of time will be evicted first.  With FIFO, the eviction
 // order is based on the order of insertion, with the earliest inserted item
-// being evicted first.
+// being evicted first.  The remaining policies are described below.
+//
+///Eviction Policies
+///-----------------
+// LRU requires every successful lookup to move the item to the back of the
+// eviction queue, and therefore to acquire the write lock of the cache.  The
+// CLOCK, SIEVE, and W-TinyLFU policies instead associate a *reference* bit
+// with each item, which a lookup sets using a relaxed atomic store while
+// holding only a read lock; all the bookkeeping is deferred until an item
+// must be evicted:
+//
+// * `e_CLOCK`: Items are kept in insertion order.  To select an item for
+//   eviction, the item at the front of the queue is examined; if its
+//   reference bit is set, the bit is cleared and the item is moved to the
+//   back of the queue (i.e., it is given a "second chance"), and the process
+//   repeats.  The first item found with a clear reference bit is evicted.
+//
+// * `e_SIEVE`: Items are kept in insertion order, and a "hand" remembers the
+//   position of the last eviction.  To select an item for eviction, the hand
+//   moves from the oldest towards the newest item (wrapping around), clearing
+//   set reference bits, and evicts the first item found with a clear
+//   reference bit.  Unlike CLOCK, surviving items are never moved, so that
+//   recently inserted, unpopular items are evicted quickly.
+//
+// * `e_W_TINYLFU`: New items are inserted into a small *admission window*
+//   (1% of the high watermark) and items leaving the window enter the *main*
+//   region, which is managed using CLOCK.  The cache maintains an approximate
+//   access frequency for recently seen keys (a count-min sketch of 4-bit
+//   counters, periodically halved so that old popularity decays).  When an
+//   item must be evicted, the oldest item of the window (the *candidate*)
+//   competes with the item CLOCK selects in the main region (the *victim*):
+//   the candidate is admitted to the main region, and the victim evicted,
+//   only if the candidate has been accessed more frequently; otherwise the
+//   candidate is evicted.  A one-off scan over many keys therefore cannot
+//   flush frequently accessed items from the cache.
+//
+// For all policies, inserting a value for a key already in the cache counts
+// as an access of that key.
 //
 ///Thread Safety
 ///-------------
@@ -51,10 +89,12 @@ BSLS_IDENT("$Id: $")
 // All of the modifier methods of the cache potentially requires a write lock.
 // Of particular note is the `tryGetValue` method, which requires a writer lock
 // only if the eviction queue needs to be modified.  This means `tryGetValue`
-// requires only a read lock if the eviction policy is set to FIFO or the
-// argument `modifyEvictionQueue` is set to `false`.  For limited cases where
-// contention is likely, temporarily setting `modifyEvictionQueue` to `false`
-// might be of value.
+// requires only a read lock if the eviction policy is set to FIFO, CLOCK,
+// SIEVE, or W-TinyLFU, or the argument `modifyEvictionQueue` is set to
+// `false`.  For limited cases where contention is likely with the LRU policy,
+// temporarily setting `modifyEvictionQueue` to `false` might be of value;
+// using the CLOCK or SIEVE policy is usually preferable, as their hit rate is
+// comparable to that of LRU.
 //
 // The `visit` method acquires a read lock and calls the supplied visitor
 // function for every item in the cache, or until the visitor function returns
@@ -91,7 +131,8 @@ BSLS_IDENT("$Id: $")
 // | tryGetValue                                        | Average: O[1]      |
 // |                                                    | Worst:   O[n]      |
 // +----------------------------------------------------+--------------------+
-// | popFront                                           | O[1]               |
+// | popFront                                           | Average: O[1]      |
+// |                                                    | Worst:   O[n]      |
 // +----------------------------------------------------+--------------------+
 // | erase                                              | Average: O[1]      |
 // |                                                    | Worst:   O[n]      |
@@ -312,8 +353,10 @@ BSLS_IDENT("$Id: $")
 #include <bslmf_movableref.h>
 
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
 #include <bsls_libraryfeatures.h>
 #include <bsls_review.h>
+#include <bsls_types.h>
 
 #include <bsl_memory.h>
 #include <bsl_map.h>
@@ -335,11 +378,132 @@ struct CacheEvictionPolicy {
     /// Enumeration of supported cache eviction policies.
     enum Enum {
 
-        e_LRU,  // Least Recently Used
-        e_FIFO  // First In, First Out
+        e_LRU,        // Least Recently Used
+        e_FIFO,       // First In, First Out
+        e_CLOCK,      // CLOCK (second chance)
+        e_SIEVE,      // SIEVE
+        e_W_TINYLFU   // Windowed TinyLFU admission, CLOCK main region
     };
 };
 
+                        // ===========================
+                        // class Cache_FrequencySketch
+                        // ===========================
+
+/// This class implements a count-min sketch of 4-bit counters estimating
+/// the access frequency of keys identified by their hash values, as used by
+/// the TinyLFU admission policy.  Counters saturate at 15 and are halved
+/// once the number of recorded accesses reaches a sample size proportional
+/// to the capacity supplied at construction, so that the estimates reflect
+/// recent history.  `increment` and `frequency` may be called concurrently
+/// from multiple threads.
+class Cache_FrequencySketch {
+
+    // DATA
+    bslma::Allocator    *d_allocator_p;  // memory allocator (held, not owned)
+
+    bsls::AtomicUint64  *d_table_p;      // table of packed counters (owned),
+                                         // 0 if the sketch is disabled
+
+    bsl::size_t          d_tableMask;    // number of words in the table - 1
+
+    bsls::Types::Int64   d_sampleSize;   // number of accesses between resets
+
+    bsls::AtomicInt64    d_numAccesses;  // accesses since the last reset
+
+    // PRIVATE CLASS METHODS
+
+    /// Return a well-mixed 64-bit value derived from the specified
+    /// `hashValue` and `row`.
+    static bsls::Types::Uint64 mix(bsl::size_t hashValue, int row);
+
+    // PRIVATE MANIPULATORS
+
+    /// Halve every counter of this sketch.
+    void reset();
+
+  private:
+    // NOT IMPLEMENTED
+    Cache_FrequencySketch(const Cache_FrequencySketch&);
+    Cache_FrequencySketch& operator=(const Cache_FrequencySketch&);
+
+  public:
+    // CREATORS
+
+    /// Create a sketch sized for a cache holding approximately the specified
+    /// `capacity` items, using the specified `basicAllocator` to supply
+    /// memory.  If `capacity` is 0, the sketch is disabled: it allocates no
+    /// memory, `increment` has no effect and `frequency` always returns 0.
+    /// If `basicAllocator` is 0, the currently installed default allocator is
+    /// used.
+    explicit Cache_FrequencySketch(bsl::size_t       capacity,
+                                   bslma::Allocator *basicAllocator = 0);
+
+    /// Destroy this object.
+    ~Cache_FrequencySketch();
+
+    // MANIPULATORS
+
+    /// Reset all the counters of this sketch to 0.  The behavior is undefined
+    /// if this method is called concurrently with any other method.
+    void clear();
+
+    /// Record an access to the key having the specified `hashValue`.
+    void increment(bsl::size_t hashValue);
+
+    // ACCESSORS
+
+    /// Return the estimated number of recent accesses, in the range
+    /// `[0 .. 15]`, to the key having the specified `hashValue`.
+    int frequency(bsl::size_t hashValue) const;
+
+    /// Return `true` if this sketch is enabled, and `false` otherwise.
+    bool isEnabled() const;
+};
+
+                        // ====================
+                        // class Cache_MapValue
+                        // ====================
+
+/// This class template is the value type of the hash map of `Cache`,
+/// holding the shared pointer to the cached value, the position of the key
+/// in the eviction queue, and the per-item state used by the CLOCK, SIEVE,
+/// and W-TinyLFU eviction policies.
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+struct Cache_MapValue {
+
+    // PUBLIC DATA
+    VALUE_PTR                d_valuePtr;    // cached value
+
+    QUEUE_ITERATOR           d_queueIt;     // position of the key in its
+                                            // eviction queue
+
+    bool                     d_inWindow;    // `true` if the key is in the
+                                            // W-TinyLFU admission window
+
+    mutable bsls::AtomicBool d_referenced;  // `true` if the item has been
+                                            // accessed since the eviction
+                                            // policy last examined it
+
+    // CREATORS
+
+    /// Create a map value holding the specified `valuePtr` and `queueIt`,
+    /// and having the specified `inWindow` flag and a clear reference bit.
+    Cache_MapValue(const VALUE_PTR&      valuePtr,
+                   const QUEUE_ITERATOR& queueIt,
+                   bool                  inWindow);
+    Cache_MapValue(bslmf::MovableRef<VALUE_PTR> valuePtr,
+                   const QUEUE_ITERATOR&        queueIt,
+                   bool                         inWindow);
+
+    /// Create a map value having the value of the specified `original`.
+    Cache_MapValue(const Cache_MapValue& original);
+
+    /// Create a map value having the value of the specified `original`,
+    /// leaving `original` in a valid but unspecified state.
+    Cache_MapValue(bslmf::MovableRef<Cache_MapValue> original);
+};
+
 /// This class implements a proctor that, on destruction, restores the queue to
 /// its state at the time of the proctor's creation.  We assume that the only
 /// change to the queue is that 0 or more items have been added to the end.  If
@@ -408,7 +572,8 @@ class Cache {
     typedef bsl::list<KEY>                                        QueueType;
 
     /// Value type of the hash map.
-    typedef bsl::pair<ValuePtrType, typename QueueType::iterator> MapValue;
+    typedef Cache_MapValue<ValuePtrType, typename QueueType::iterator>
+                                                                  MapValue;
 
     /// Hash map type.
     typedef bsl::unordered_map<KEY, MapValue, HASH, EQUAL>        MapType;
@@ -429,7 +594,32 @@ class Cache {
                                                        // keys, the key of the
                                                        // first item to be
                                                        // evicted is at the
-                                                       // front of the queue
+                                                       // front of the queue;
+                                                       // for W-TinyLFU, the
+                                                       // main region followed
+                                                       // by the admission
+                                                       // window
+
+    typename QueueType::iterator
+                               d_windowBegin;          // first item of the
+                                                       // W-TinyLFU admission
+                                                       // window, or
+                                                       // `d_queue.end()` if
+                                                       // the window is empty
+
+    bsl::size_t                d_windowSize;           // number of items in
+                                                       // the admission window
+
+    typename QueueType::iterator
+                               d_hand;                 // SIEVE hand, or
+                                                       // `d_queue.end()` if
+                                                       // the hand is to start
+                                                       // from the front
+
+    Cache_FrequencySketch      d_sketch;               // W-TinyLFU access
+                                                       // frequencies;
+                                                       // disabled for other
+                                                       // policies
 
     CacheEvictionPolicy::Enum  d_evictionPolicy;       // eviction policy
 
@@ -442,6 +632,10 @@ class Cache {
                                                        // starts after an
                                                        // insert
 
+    bsl::size_t                d_windowCapacity;       // maximum size of the
+                                                       // admission window
+                                                       // outside of eviction
+
     PostEvictionCallback       d_postEvictionCallback; // the function to call
                                                        // after a value has
                                                        // been evicted from the
@@ -450,8 +644,34 @@ class Cache {
     // FRIENDS
     friend class Cache_TestUtil<KEY, VALUE, HASH, EQUAL>;
 
+    // PRIVATE CLASS METHODS
+
+    /// Return the capacity of the frequency sketch of a cache having the
+    /// specified `evictionPolicy` and `highWatermark`.
+    static bsl::size_t sketchCapacity(
+                                     CacheEvictionPolicy::Enum evictionPolicy,
+                                     bsl::size_t               highWatermark);
+
     // PRIVATE MANIPULATORS
 
+    /// Return an iterator to the item in the main region of the eviction
+    /// queue (i.e., preceding `d_windowBegin`) that the CLOCK algorithm
+    /// selects for eviction, giving a second chance to (i.e., clearing the
+    /// reference bit of, and moving to the back of the main region) every
+    /// referenced item examined.  The behavior is undefined unless the main
+    /// region is not empty.
+    typename MapType::iterator clockVictim();
+
+    /// Return an iterator to the item to be evicted next according to the
+    /// eviction policy, updating the eviction queues as the policy requires.
+    /// The behavior is undefined unless this cache is not empty.
+    typename MapType::iterator selectVictim();
+
+    /// Move items from the front of the W-TinyLFU admission window to the
+    /// back of the main region while the window holds more than
+    /// `d_windowCapacity` items and the main region has room for them.
+    void drainWindow();
+
     /// Evict items from this cache if `size() >= highWatermark()` until
     /// `size() < lowWatermark()` beginning from the front of the eviction
     /// queue.  Invoke the post-eviction callback for each item evicted.
@@ -461,6 +681,12 @@ class Cache {
     /// callback for that item.
     void evictItem(const typename MapType::iterator& mapIt);
 
+    /// Record an access to the item at the specified `mapIt` having the
+    /// specified `key`, as required by the eviction policy, without
+    /// modifying the eviction queues.  Note that this method may be called
+    /// with only a read lock held.
+    void recordHit(const typename MapType::iterator& mapIt, const KEY& key);
+
     /// Add a node with the specified `*key_p` and the specified `*valuePtr_p`
     /// to the cache.  If an entry already exists for `*key_p`, override its
     /// value with `*valuePtr_p`.  If the specified `moveKey` is `true`, move
@@ -583,9 +809,10 @@ class Cache {
     /// but unspecified state.
     int insertBulk(bslmf::MovableRef<bsl::vector<KVType> > data);
 
-    /// Remove the item at the front of the eviction queue.  Invoke the
-    /// post-eviction callback for the removed item.  Return 0 on success,
-    /// and 1 if this cache is empty.
+    /// Remove the item that would be evicted next according to the eviction
+    /// policy (for LRU and FIFO, the item at the front of the eviction
+    /// queue).  Invoke the post-eviction callback for the removed item.
+    /// Return 0 on success, and 1 if this cache is empty.
     int popFront();
 
     /// Set the post-eviction callback to the specified
@@ -596,10 +823,14 @@ class Cache {
 
     /// Load, into the specified `value`, the value associated with the
     /// specified `key` in this cache.  If the optionally specified
-    /// `modifyEvictionQueue` is `true` and the eviction policy is LRU, then
-    /// move the cached item to the back of the eviction queue.  Return 0 on
-    /// success, and 1 if `key` does not exist in this cache.  Note that a
-    /// write lock is acquired only if this queue is modified.
+    /// `modifyEvictionQueue` is `true`, record the access as required by the
+    /// eviction policy: if the eviction policy is LRU, move the cached item
+    /// to the back of the eviction queue; if it is CLOCK, SIEVE, or
+    /// W-TinyLFU, set the reference bit of the item (and, for W-TinyLFU,
+    /// count the access of `key` even if it is not in the cache).  Return 0
+    /// on success, and 1 if `key` does not exist in this cache.  Note that a
+    /// write lock is acquired only if the eviction queue is modified, i.e.,
+    /// only for LRU.
     int tryGetValue(bsl::shared_ptr<VALUE> *value,
                     const KEY&              key,
                     bool                    modifyEvictionQueue = true);
@@ -630,7 +861,9 @@ class Cache {
     bsl::size_t size() const;
 
     /// Call the specified `visitor` for every item stored in this cache in
-    /// the order of the eviction queue until `visitor` returns `false`.
+    /// the order of the eviction queue until `visitor` returns `false`.  For
+    /// W-TinyLFU, the items of the main region are visited before those of
+    /// the admission window.
     /// The `VISITOR` type must be a callable object that can be invoked in
     /// the same way as the function `bool (const KEY&, const VALUE&)`
     template <class VISITOR>
@@ -716,19 +949,102 @@ void Cache_QueueProctor<KEY>::release()
     d_queue_p = 0;
 }
 
+                        // ---------------------------
+                        // class Cache_FrequencySketch
+                        // ---------------------------
+
+// ACCESSORS
+inline
+bool Cache_FrequencySketch::isEnabled() const
+{
+    return 0 != d_table_p;
+}
+
+                        // --------------------
+                        // class Cache_MapValue
+                        // --------------------
+
+// CREATORS
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                               const VALUE_PTR&      valuePtr,
+                                               const QUEUE_ITERATOR& queueIt,
+                                               bool                  inWindow)
+: d_valuePtr(valuePtr)
+, d_queueIt(queueIt)
+, d_inWindow(inWindow)
+, d_referenced(false)
+{
+}
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                       bslmf::MovableRef<VALUE_PTR> valuePtr,
+                                       const QUEUE_ITERATOR&        queueIt,
+                                       bool                         inWindow)
+: d_valuePtr(bslmf::MovableRefUtil::move(valuePtr))
+, d_queueIt(queueIt)
+, d_inWindow(inWindow)
+, d_referenced(false)
+{
+}
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                                const Cache_MapValue& original)
+: d_valuePtr(original.d_valuePtr)
+, d_queueIt(original.d_queueIt)
+, d_inWindow(original.d_inWindow)
+, d_referenced(original.d_referenced.loadRelaxed())
+{
+}
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                    bslmf::MovableRef<Cache_MapValue> original)
+: d_valuePtr(bslmf::MovableRefUtil::move(
+                       bslmf::MovableRefUtil::access(original).d_valuePtr))
+, d_queueIt(bslmf::MovableRefUtil::access(original).d_queueIt)
+, d_inWindow(bslmf::MovableRefUtil::access(original).d_inWindow)
+, d_referenced(
+          bslmf::MovableRefUtil::access(original).d_referenced.loadRelaxed())
+{
+}
+
                         // -----------
                         // class Cache
                         // -----------
 
+// PRIVATE CLASS METHODS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t Cache<KEY, VALUE, HASH, EQUAL>::sketchCapacity(
+                                      CacheEvictionPolicy::Enum evictionPolicy,
+                                      bsl::size_t               highWatermark)
+{
+    return CacheEvictionPolicy::e_W_TINYLFU == evictionPolicy
+           ? highWatermark
+           : 0;
+}
+
 // CREATORS
 template <class KEY, class VALUE, class HASH, class EQUAL>
 Cache<KEY, VALUE, HASH, EQUAL>::Cache(bslma::Allocator *basicAllocator)
 : d_allocator_p(bslma::Default::allocator(basicAllocator))
 , d_map(d_allocator_p)
 , d_queue(d_allocator_p)
+, d_windowBegin(d_queue.end())
+, d_windowSize(0)
+, d_hand(d_queue.end())
+, d_sketch(0, d_allocator_p)
 , d_evictionPolicy(CacheEvictionPolicy::e_LRU)
 , d_lowWatermark(bsl::numeric_limits<bsl::size_t>::max())
 , d_highWatermark(bsl::numeric_limits<bsl::size_t>::max())
+, d_windowCapacity(1)
 , d_postEvictionCallback(bsl::allocator_arg, d_allocator_p)
 {
 }
@@ -742,9 +1058,14 @@ Cache<KEY, VALUE, HASH, EQUAL>::Cache(
 : d_allocator_p(bslma::Default::allocator(basicAllocator))
 , d_map(d_allocator_p)
 , d_queue(d_allocator_p)
+, d_windowBegin(d_queue.end())
+, d_windowSize(0)
+, d_hand(d_queue.end())
+, d_sketch(sketchCapacity(evictionPolicy, highWatermark), d_allocator_p)
 , d_evictionPolicy(evictionPolicy)
 , d_lowWatermark(lowWatermark)
 , d_highWatermark(highWatermark)
+, d_windowCapacity(highWatermark / 100 > 1 ? highWatermark / 100 : 1)
 , d_postEvictionCallback(bsl::allocator_arg, d_allocator_p)
 {
     BSLS_REVIEW(lowWatermark <= highWatermark);
@@ -763,9 +1084,14 @@ Cache<KEY, VALUE, HASH, EQUAL>::Cache(
 : d_allocator_p(bslma::Default::allocator(basicAllocator))
 , d_map(0, hashFunction, equalFunction, d_allocator_p)
 , d_queue(d_allocator_p)
+, d_windowBegin(d_queue.end())
+, d_windowSize(0)
+, d_hand(d_queue.end())
+, d_sketch(sketchCapacity(evictionPolicy, highWatermark), d_allocator_p)
 , d_evictionPolicy(evictionPolicy)
 , d_lowWatermark(lowWatermark)
 , d_highWatermark(highWatermark)
+, d_windowCapacity(highWatermark / 100 > 1 ? highWatermark / 100 : 1)
 , d_postEvictionCallback(bsl::allocator_arg, d_allocator_p)
 {
     BSLS_REVIEW(lowWatermark <= highWatermark);
@@ -774,6 +1100,105 @@ Cache<KEY, VALUE, HASH, EQUAL>::Cache(
 }
 
 // PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+typename Cache<KEY, VALUE, HASH, EQUAL>::MapType::iterator
+Cache<KEY, VALUE, HASH, EQUAL>::clockVictim()
+{
+    BSLS_ASSERT(d_queue.begin() != d_windowBegin);
+
+    // Each iteration either returns or clears a reference bit, so at most one
+    // more iteration than the size of the main region is performed.
+
+    while (true) {
+        const typename MapType::iterator mapIt = d_map.find(d_queue.front());
+        BSLS_ASSERT(mapIt != d_map.end());
+
+        if (!mapIt->second.d_referenced.loadRelaxed()) {
+            return mapIt;                                             // RETURN
+        }
+        mapIt->second.d_referenced.storeRelaxed(false);
+        d_queue.splice(d_windowBegin, d_queue, d_queue.begin());
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+typename Cache<KEY, VALUE, HASH, EQUAL>::MapType::iterator
+Cache<KEY, VALUE, HASH, EQUAL>::selectVictim()
+{
+    switch (d_evictionPolicy) {
+      case CacheEvictionPolicy::e_CLOCK: {
+        return clockVictim();                                         // RETURN
+      }
+      case CacheEvictionPolicy::e_SIEVE: {
+        typename QueueType::iterator it = d_hand;
+        while (true) {
+            if (d_queue.end() == it) {
+                it = d_queue.begin();
+            }
+            const typename MapType::iterator mapIt = d_map.find(*it);
+            BSLS_ASSERT(mapIt != d_map.end());
+
+            if (!mapIt->second.d_referenced.loadRelaxed()) {
+                d_hand = it;
+                return mapIt;                                         // RETURN
+            }
+            mapIt->second.d_referenced.storeRelaxed(false);
+            ++it;
+        }
+      }
+      case CacheEvictionPolicy::e_W_TINYLFU: {
+        if (0 == d_windowSize) {
+            return clockVictim();                                     // RETURN
+        }
+
+        const typename MapType::iterator candidateIt =
+                                                    d_map.find(*d_windowBegin);
+        BSLS_ASSERT(candidateIt != d_map.end());
+
+        if (d_queue.begin() == d_windowBegin) {
+            return candidateIt;                                       // RETURN
+        }
+
+        const typename MapType::iterator victimIt = clockVictim();
+
+        const HASH hasher = d_map.hash_function();
+        if (d_sketch.frequency(hasher(candidateIt->first)) <=
+                                 d_sketch.frequency(hasher(victimIt->first))) {
+            return candidateIt;                                       // RETURN
+        }
+
+        // Admit the candidate to the main region.
+
+        ++d_windowBegin;
+        --d_windowSize;
+        candidateIt->second.d_inWindow = false;
+
+        return victimIt;                                              // RETURN
+      }
+      default: {
+        const typename MapType::iterator mapIt = d_map.find(d_queue.front());
+        BSLS_ASSERT(mapIt != d_map.end());
+        return mapIt;                                                 // RETURN
+      }
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void Cache<KEY, VALUE, HASH, EQUAL>::drainWindow()
+{
+    const bsl::size_t mainCapacity = d_highWatermark - d_windowCapacity;
+
+    while (d_windowSize > d_windowCapacity &&
+                               d_queue.size() - d_windowSize < mainCapacity) {
+        const typename MapType::iterator mapIt = d_map.find(*d_windowBegin);
+        BSLS_ASSERT(mapIt != d_map.end());
+
+        ++d_windowBegin;
+        --d_windowSize;
+        mapIt->second.d_inWindow = false;
+    }
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 void Cache<KEY, VALUE, HASH, EQUAL>::enforceHighWatermark()
 {
@@ -782,9 +1207,7 @@ void Cache<KEY, VALUE, HASH, EQUAL>::enforceHighWatermark()
     }
 
     while (d_map.size() >= d_lowWatermark && d_map.size() > 0) {
-        const typename MapType::iterator mapIt = d_map.find(d_queue.front());
-        BSLS_ASSERT(mapIt != d_map.end());
-        evictItem(mapIt);
+        evictItem(selectVictim());
     }
 }
 
@@ -792,15 +1215,39 @@ template <class KEY, class VALUE, class HASH, class EQUAL>
 void Cache<KEY, VALUE, HASH, EQUAL>::evictItem(
                                        const typename MapType::iterator& mapIt)
 {
-    ValuePtrType value = mapIt->second.first;
+    ValuePtrType value = mapIt->second.d_valuePtr;
+
+    const typename QueueType::iterator queueIt = mapIt->second.d_queueIt;
 
-    d_queue.erase(mapIt->second.second);
+    if (d_hand == queueIt) {
+        ++d_hand;
+    }
+    if (d_windowBegin == queueIt) {
+        ++d_windowBegin;
+    }
+    if (mapIt->second.d_inWindow) {
+        --d_windowSize;
+    }
+    d_queue.erase(queueIt);
     d_map.erase(mapIt);
 
     if (d_postEvictionCallback) {
         d_postEvictionCallback(value);
     }
 }
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void Cache<KEY, VALUE, HASH, EQUAL>::recordHit(
+                                       const typename MapType::iterator& mapIt,
+                                       const KEY&                        key)
+{
+    mapIt->second.d_referenced.storeRelaxed(true);
+    if (d_sketch.isEnabled()) {
+        d_sketch.increment(d_map.hash_function()(key));
+    }
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
@@ -823,21 +1270,34 @@ bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
     typename MapType::iterator mapIt = d_map.find(key);
     if (mapIt != d_map.end()) {
         if (k_RVALUE_ASSIGN && moveValuePtr) {
-            mapIt->second.first = bslmf::MovableRefUtil::move(valuePtr);
+            mapIt->second.d_valuePtr = bslmf::MovableRefUtil::move(valuePtr);
         }
         else {
-            mapIt->second.first = valuePtr;
+            mapIt->second.d_valuePtr = valuePtr;
         }
 
-        typename QueueType::iterator queueIt = mapIt->second.second;
+        if (CacheEvictionPolicy::e_LRU  == d_evictionPolicy ||
+            CacheEvictionPolicy::e_FIFO == d_evictionPolicy) {
+            typename QueueType::iterator queueIt = mapIt->second.d_queueIt;
 
-        // Move 'queueIt' to the back of 'd_queue'.
+            // Move 'queueIt' to the back of 'd_queue'.
 
-        d_queue.splice(d_queue.end(), d_queue, queueIt);
+            d_queue.splice(d_queue.end(), d_queue, queueIt);
+        }
+        else {
+            recordHit(mapIt, key);
+        }
 
         return false;                                                 // RETURN
     }
     else {
+        const bool inWindow = CacheEvictionPolicy::e_W_TINYLFU ==
+                                                              d_evictionPolicy;
+
+        if (d_sketch.isEnabled()) {
+            d_sketch.increment(d_map.hash_function()(key));
+        }
+
         Cache_QueueProctor<KEY>      proctor(&d_queue);
         d_queue.push_back(key);
         typename QueueType::iterator queueIt = d_queue.end();
@@ -849,12 +1309,12 @@ bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
         if (moveValuePtr) {
             new (mapValue_p) MapValue(bslmf::MovableRefUtil::move(valuePtr),
                                       queueIt,
-                                      d_allocator_p);
+                                      inWindow);
         }
         else {
             new (mapValue_p) MapValue(valuePtr,
                                       queueIt,
-                                      d_allocator_p);
+                                      inWindow);
         }
         bslma::DestructorGuard<MapValue> mapValueGuard(mapValue_p);
 
@@ -869,6 +1329,14 @@ bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
 
         proctor.release();
 
+        if (inWindow) {
+            if (0 == d_windowSize) {
+                d_windowBegin = queueIt;
+            }
+            ++d_windowSize;
+            drainWindow();
+        }
+
         return true;                                                  // RETURN
     }
 }
@@ -880,6 +1348,10 @@ void Cache<KEY, VALUE, HASH, EQUAL>::clear()
     bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
     d_map.clear();
     d_queue.clear();
+    d_windowBegin = d_queue.end();
+    d_windowSize  = 0;
+    d_hand        = d_queue.end();
+    d_sketch.clear();
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
@@ -1055,9 +1527,7 @@ int Cache<KEY, VALUE, HASH, EQUAL>::popFront()
     bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
 
     if (d_map.size() > 0) {
-        const typename MapType::iterator mapIt = d_map.find(d_queue.front());
-        BSLS_ASSERT(mapIt != d_map.end());
-        evictItem(mapIt);
+        evictItem(selectVictim());
         return 0;                                                     // RETURN
     }
 
@@ -1095,19 +1565,26 @@ int Cache<KEY, VALUE, HASH, EQUAL>::tryGetValue(
 
     typename MapType::iterator mapIt = d_map.find(key);
     if (mapIt == d_map.end()) {
+        if (modifyEvictionQueue && d_sketch.isEnabled()) {
+            d_sketch.increment(d_map.hash_function()(key));
+        }
         return 1;                                                     // RETURN
     }
 
-    *value = mapIt->second.first;
+    *value = mapIt->second.d_valuePtr;
 
     if (writeLock) {
-        typename QueueType::iterator queueIt = mapIt->second.second;
+        typename QueueType::iterator queueIt = mapIt->second.d_queueIt;
         typename QueueType::iterator last = d_queue.end();
         --last;
         if (last != queueIt) {
             d_queue.splice(d_queue.end(), d_queue, queueIt);
         }
     }
+    else if (modifyEvictionQueue &&
+                         CacheEvictionPolicy::e_FIFO != d_evictionPolicy) {
+        recordHit(mapIt, key);
+    }
 
     return 0;
 }
@@ -1169,7 +1646,7 @@ void Cache<KEY, VALUE, HASH, EQUAL>::visit(VISITOR& visitor) const
         const KEY&                             key = *queueIt;
         const typename MapType::const_iterator mapIt = d_map.find(key);
         BSLS_ASSERT(mapIt != d_map.end());
-        const ValuePtrType& valuePtr = mapIt->second.first;
+        const ValuePtrType& valuePtr = mapIt->second.d_valuePtr;
 
         if (!visitor(key, *valuePtr)) {
             break;
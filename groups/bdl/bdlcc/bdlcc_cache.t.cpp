@@ -42,13 +42,14 @@
 #include <bsls_timeutil.h>  // `CachePerformance`
 #include <bsls_types.h>     // `BloombergLP::bsls::Types::Int64`
 
+#include <bsl_algorithm.h>  // `lower_bound`
 #include <bsl_format.h>
 #include <bsl_iostream.h>
 #include <bsl_vector.h>
 #include <bsl_string.h>
 #include <bsl_iomanip.h>
 #include <bsl_cstdlib.h>    // `atoi`, `rand`
-#include <bsl_cmath.h>      // `sqrt`
+#include <bsl_cmath.h>      // `sqrt`, `pow`
 #include <bsl_cstdio.h>     // `sprintf`
 
 using namespace BloombergLP;
@@ -129,6 +130,14 @@ using namespace bsl;
 // [ 4] HASH hashFunction() const;
 // [ 4] EQUAL equalFunction() const;
 //
+//
+// Cache_FrequencySketch
+// [20] Cache_FrequencySketch(bsl::size_t capacity, Allocator *ba);
+// [20] ~Cache_FrequencySketch();
+// [20] void clear();
+// [20] void increment(bsl::size_t hashValue);
+// [20] int frequency(bsl::size_t hashValue) const;
+// [20] bool isEnabled() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 3] TEST APPARATUS
@@ -137,11 +146,16 @@ using namespace bsl;
 // [16] LOCKING TEST UTIL
 // [17] LOCKING
 // [19] CONCERN: USE `allocator_arg` CONSTRUCTORS
-// [20] USAGE EXAMPLE
+// [21] CacheEvictionPolicy::e_CLOCK
+// [21] CacheEvictionPolicy::e_SIEVE
+// [21] CacheEvictionPolicy::e_W_TINYLFU
+// [22] CONCERN: CONCURRENT ACCESS WITH CLOCK, SIEVE, AND W-TINYLFU
+// [23] USAGE EXAMPLE
 // [-1] INSERT PERFORMANCE
 // [-2] INSERT BULK PERFORMANCE
 // [-3] READ PERFORMANCE
 // [-4] READ WRITE PERFORMANCE
+// [-5] EVICTION POLICY HIT RATE AND THROUGHPUT
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -1781,6 +1795,514 @@ void threadedTest1()
 
 }  // close namespace threaded
 
+namespace evictionPolicy {
+
+typedef bdlcc::Cache<int, int>             CacheType;
+typedef bdlcc::CacheEvictionPolicy         Policy;
+
+/// This visitor appends the visited keys to a vector.
+struct KeyCollector {
+    // DATA
+    bsl::vector<int> *d_keys_p;
+
+    // MANIPULATORS
+    bool operator()(const int& key, const int&)
+    {
+        d_keys_p->push_back(key);
+        return true;
+    }
+};
+
+/// Return `true` if the specified `cache` contains the specified `key`, and
+/// `false` otherwise, without recording an access of `key`.
+bool contains(CacheType& cache, int key)
+{
+    CacheType::ValuePtrType valuePtr;
+    return 0 == cache.tryGetValue(&valuePtr, key, false);
+}
+
+/// Access the specified `key` in the specified `cache`, and return the
+/// result of `tryGetValue`.
+int touch(CacheType& cache, int key)
+{
+    CacheType::ValuePtrType valuePtr;
+    return cache.tryGetValue(&valuePtr, key);
+}
+
+void testFrequencySketch()
+{
+    // ------------------------------------------------------------------------
+    // CLASS `Cache_FrequencySketch`
+    //
+    // Concerns:
+    // 1. A sketch created with a capacity of 0 is disabled: it allocates no
+    //    memory, and reports a frequency of 0 for every key.
+    //
+    // 2. The frequency of a key counts the number of times it has been
+    //    incremented, saturating at 15.
+    //
+    // 3. Incrementing one key does not (in the absence of hash collisions in
+    //    every row) affect the frequency of another.
+    //
+    // 4. The counters are halved once the number of accesses reaches the
+    //    sample size (10 times the capacity).
+    //
+    // 5. `clear` resets every counter to 0.
+    //
+    // 6. Memory is supplied by the specified allocator, and released on
+    //    destruction.
+    //
+    // Plan:
+    // 1. Create a disabled sketch and verify that no memory is allocated and
+    //    that `frequency` returns 0 after `increment`.  (C-1)
+    //
+    // 2. Create an enabled sketch, increment a key up to, and past, 15
+    //    times, verifying the frequency after each increment.  Verify that
+    //    another key has a frequency of 0.  (C-2..3, 6)
+    //
+    // 3. Increment another key until the sample size is reached, and verify
+    //    that the frequency of the first key was halved.  (C-4)
+    //
+    // 4. Call `clear` and verify that all frequencies are 0.  (C-5)
+    //
+    // Testing:
+    //   Cache_FrequencySketch(bsl::size_t capacity, Allocator *ba);
+    //   ~Cache_FrequencySketch();
+    //   void clear();
+    //   void increment(bsl::size_t hashValue);
+    //   int frequency(bsl::size_t hashValue) const;
+    //   bool isEnabled() const;
+    // ------------------------------------------------------------------------
+
+    typedef bdlcc::Cache_FrequencySketch Obj;
+
+    bslma::TestAllocator ta("sketch", veryVeryVeryVerbose);
+
+    if (verbose) cout << "\nDisabled sketch." << endl;
+    {
+        Obj mX(0, &ta);  const Obj& X = mX;
+
+        ASSERT(false == X.isEnabled());
+        ASSERT(0     == ta.numBlocksTotal());
+
+        mX.increment(1);
+        ASSERTV(X.frequency(1), 0 == X.frequency(1));
+    }
+
+    if (verbose) cout << "\nCounting and saturation." << endl;
+    {
+        const bsl::size_t k_CAPACITY = 16;
+
+        Obj mX(k_CAPACITY, &ta);  const Obj& X = mX;
+
+        ASSERT(true == X.isEnabled());
+        ASSERT(1    == ta.numBlocksInUse());
+
+        ASSERTV(X.frequency(1), 0 == X.frequency(1));
+
+        for (int i = 1; i <= 20; ++i) {
+            mX.increment(1);
+
+            const int EXP = i < 15 ? i : 15;
+            ASSERTV(i, X.frequency(1), EXP == X.frequency(1));
+        }
+        ASSERTV(X.frequency(2), 0 == X.frequency(2));
+
+        if (verbose) cout << "\nAging." << endl;
+
+        // 20 accesses have been recorded; the sample size is 160.
+
+        for (int i = 21; i < 160; ++i) {
+            mX.increment(2);
+        }
+        ASSERTV(X.frequency(1), 15 == X.frequency(1));
+
+        mX.increment(2);
+        ASSERTV(X.frequency(1), 7 == X.frequency(1));
+        ASSERTV(X.frequency(2), 7 == X.frequency(2));
+
+        if (verbose) cout << "\nClear." << endl;
+
+        mX.clear();
+        ASSERTV(X.frequency(1), 0 == X.frequency(1));
+        ASSERTV(X.frequency(2), 0 == X.frequency(2));
+    }
+    ASSERT(0 == ta.numBlocksInUse());
+}
+
+void testPolicies()
+{
+    // ------------------------------------------------------------------------
+    // CLOCK, SIEVE, AND W-TINYLFU EVICTION POLICIES
+    //
+    // Concerns:
+    // 1. With CLOCK, an item accessed since it was last examined is given a
+    //    second chance and moved to the back of the eviction queue.
+    //
+    // 2. With SIEVE, an item accessed since it was last examined is skipped
+    //    without being moved, and the hand resumes from the position of the
+    //    last eviction.
+    //
+    // 3. `tryGetValue` with `modifyEvictionQueue` set to `false` does not
+    //    record an access, and re-inserting an existing key does.
+    //
+    // 4. With W-TinyLFU, frequently accessed items are retained in the
+    //    presence of a scan of items accessed only once, which flushes an LRU
+    //    cache of the same size.
+    //
+    // 5. `popFront`, `erase`, `clear`, and `visit` account for the items of
+    //    the W-TinyLFU admission window.
+    //
+    // Plan:
+    // 1. For each of CLOCK and SIEVE, create a cache having low and high
+    //    watermarks of 4, insert and access items, and verify the evicted
+    //    items.  (C-1..3)
+    //
+    // 2. Create a W-TinyLFU cache and an LRU cache of 100 items, access a set
+    //    of 50 "hot" keys repeatedly, then insert 1000 unique keys while
+    //    accessing a hot key every 4 inserts, and verify the number of hot
+    //    keys remaining in each cache.  (C-4)
+    //
+    // 3. Create a small W-TinyLFU cache, and exercise `popFront`, `erase`,
+    //    `visit`, and `clear`.  (C-5)
+    //
+    // Testing:
+    //   CacheEvictionPolicy::e_CLOCK
+    //   CacheEvictionPolicy::e_SIEVE
+    //   CacheEvictionPolicy::e_W_TINYLFU
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator ta("policies", veryVeryVeryVerbose);
+
+    if (verbose) cout << "\nCLOCK." << endl;
+    {
+        CacheType mX(Policy::e_CLOCK, 4, 4, &ta);  const CacheType& X = mX;
+
+        for (int i = 0; i < 3; ++i) {
+            mX.insert(i, i);
+        }
+        mX.insert(1, 10);       // re-inserting 1 counts as an access
+        ASSERT(0 == touch(mX, 0));
+        ASSERT(1 == touch(mX, 9));
+        mX.insert(3, 3);
+        ASSERTV(X.size(), 4 == X.size());
+
+        mX.insert(4, 4);        // 0 and 1 get a second chance, 2 is evicted
+        ASSERTV(X.size(), 4 == X.size());
+        ASSERT(true  == contains(mX, 0));
+        ASSERT(true  == contains(mX, 1));
+        ASSERT(false == contains(mX, 2));
+
+        mX.insert(5, 5);        // 3 is evicted
+        ASSERT(false == contains(mX, 3));
+
+        // `tryGetValue` without `modifyEvictionQueue` does not count.
+
+        ASSERT(true == contains(mX, 0));
+
+        mX.insert(6, 6);        // 0 is evicted (its bit was cleared)
+        ASSERT(false == contains(mX, 0));
+
+        bsl::vector<int> keys(&ta);
+        KeyCollector     collector = { &keys };
+        mX.visit(collector);
+
+        ASSERTV(keys.size(), 4 == keys.size());
+        ASSERTV(keys[0], 1 == keys[0]);
+        ASSERTV(keys[1], 4 == keys[1]);
+        ASSERTV(keys[2], 5 == keys[2]);
+        ASSERTV(keys[3], 6 == keys[3]);
+    }
+
+    if (verbose) cout << "\nSIEVE." << endl;
+    {
+        CacheType mX(Policy::e_SIEVE, 4, 4, &ta);  const CacheType& X = mX;
+
+        for (int i = 0; i < 4; ++i) {
+            mX.insert(i, i);
+        }
+        ASSERT(0 == touch(mX, 0));
+        ASSERT(0 == touch(mX, 2));
+
+        mX.insert(4, 4);        // 0 is skipped, 1 is evicted
+        ASSERT(true  == contains(mX, 0));
+        ASSERT(false == contains(mX, 1));
+
+        mX.insert(5, 5);        // hand at 2: 2 is skipped, 3 is evicted
+        ASSERT(true  == contains(mX, 2));
+        ASSERT(false == contains(mX, 3));
+
+        mX.insert(6, 6);        // hand at 4: 4 is evicted
+        ASSERT(false == contains(mX, 4));
+        ASSERTV(X.size(), 4 == X.size());
+
+        // Unlike CLOCK, the surviving items were not moved.
+
+        bsl::vector<int> keys(&ta);
+        KeyCollector     collector = { &keys };
+        mX.visit(collector);
+
+        ASSERTV(keys.size(), 4 == keys.size());
+        ASSERTV(keys[0], 0 == keys[0]);
+        ASSERTV(keys[1], 2 == keys[1]);
+        ASSERTV(keys[2], 5 == keys[2]);
+        ASSERTV(keys[3], 6 == keys[3]);
+
+        ASSERT(0 == mX.popFront());     // hand at 5: 5 is evicted
+        ASSERT(false == contains(mX, 5));
+
+        mX.clear();
+        ASSERT(0 == X.size());
+        mX.insert(7, 7);
+        ASSERT(0 == mX.popFront());
+        ASSERT(1 == mX.popFront());
+    }
+
+    if (verbose) cout << "\nScan resistance." << endl;
+    {
+        const int k_CAPACITY = 100;
+        const int k_NUM_HOT  = 50;
+
+        CacheType mL(Policy::e_LRU,       k_CAPACITY, k_CAPACITY, &ta);
+        CacheType mW(Policy::e_W_TINYLFU, k_CAPACITY, k_CAPACITY, &ta);
+
+        CacheType *caches[] = { &mL, &mW };
+
+        for (int c = 0; c < 2; ++c) {
+            CacheType& mX = *caches[c];
+
+            for (int i = 0; i < k_NUM_HOT; ++i) {
+                mX.insert(i, i);
+            }
+            for (int j = 0; j < 5; ++j) {
+                for (int i = 0; i < k_NUM_HOT; ++i) {
+                    ASSERTV(c, i, 0 == touch(mX, i));
+                }
+            }
+            for (int i = 1000; i < 2000; ++i) {
+                mX.insert(i, i);
+                if (0 == i % 4) {
+                    touch(mX, (i / 4) % k_NUM_HOT);
+                }
+            }
+            ASSERTV(c, mX.size(), k_CAPACITY == static_cast<int>(mX.size()));
+        }
+
+        int numHotL = 0;
+        int numHotW = 0;
+        for (int i = 0; i < k_NUM_HOT; ++i) {
+            numHotL += contains(mL, i);
+            numHotW += contains(mW, i);
+        }
+        if (veryVerbose) { P_(numHotL) P(numHotW) }
+
+        ASSERTV(numHotL, 0 == numHotL);
+        ASSERTV(numHotW, k_NUM_HOT - 5 <= numHotW);
+    }
+
+    if (verbose) cout << "\nW-TinyLFU admission window." << endl;
+    {
+        CacheType mX(Policy::e_W_TINYLFU, 4, 4, &ta);  const CacheType& X = mX;
+
+        // With a high watermark of 4, the window holds 1 item and the main
+        // region 3.
+
+        for (int i = 0; i < 4; ++i) {
+            mX.insert(i, i);
+        }
+        ASSERTV(X.size(), 4 == X.size());
+
+        bsl::vector<int> keys(&ta);
+        KeyCollector     collector = { &keys };
+        mX.visit(collector);
+
+        ASSERTV(keys.size(), 4 == keys.size());
+        for (int i = 0; i < 4; ++i) {
+            ASSERTV(i, keys[i], i == keys[i]);
+        }
+
+        // 4 is as frequent as any item of the main region, and is rejected
+        // when 5 is inserted.
+
+        mX.insert(4, 4);
+        mX.insert(5, 5);
+        ASSERT(false == contains(mX, 4));
+        ASSERT(true  == contains(mX, 5));
+
+        // 6 is accessed before being inserted, and is admitted to the main
+        // region when 7 is inserted.
+
+        for (int j = 0; j < 3; ++j) {
+            ASSERT(1 == touch(mX, 6));
+        }
+        mX.insert(6, 6);
+        mX.insert(7, 7);
+        ASSERT(true == contains(mX, 6));
+        ASSERT(true == contains(mX, 7));
+        ASSERTV(X.size(), 4 == X.size());
+
+        ASSERT(0 == mX.erase(7));       // 7 is in the window
+        ASSERT(0 == mX.erase(6));       // 6 is in the main region
+        ASSERTV(X.size(), 2 == X.size());
+
+        ASSERT(0 == mX.popFront());
+        ASSERT(0 == mX.popFront());
+        ASSERT(1 == mX.popFront());
+
+        mX.insert(8, 8);
+        mX.clear();
+        ASSERT(0 == X.size());
+        ASSERT(1 == mX.popFront());
+    }
+    ASSERT(0 == ta.numBlocksInUse());
+}
+
+/// This struct holds the arguments of `policyWorker`.
+struct PolicyThreadArg {
+    CacheType       *d_cache_p;
+    bsls::AtomicInt *d_stop_p;
+    int              d_seed;
+};
+
+extern "C" void *policyWorker(void *v_arg)
+{
+    PolicyThreadArg *arg  = static_cast<PolicyThreadArg *>(v_arg);
+    int              seed = arg->d_seed;
+
+    while (0 == *arg->d_stop_p) {
+        const int key = bdlb::Random::generate15(&seed) % 256;
+
+        CacheType::ValuePtrType valuePtr;
+        if (0 != arg->d_cache_p->tryGetValue(&valuePtr, key)) {
+            arg->d_cache_p->insert(key, key);
+        }
+        else {
+            ASSERTV(key, *valuePtr, key == *valuePtr);
+        }
+    }
+    return v_arg;
+}
+
+void testPoliciesConcurrently()
+{
+    // ------------------------------------------------------------------------
+    // CONCURRENT ACCESS WITH CLOCK, SIEVE, AND W-TINYLFU
+    //
+    // Concerns:
+    // 1. Setting reference bits and counting accesses under a read lock
+    //    while other threads evict items causes no corruption.
+    //
+    // Plan:
+    // 1. For each of the new policies, run several threads reading random
+    //    keys from a cache much smaller than the key space, inserting the
+    //    keys missed, for a fixed period of time.  Verify the values read,
+    //    and that the size of the cache stays within its watermarks.  (C-1)
+    //
+    // Testing:
+    //   CONCERN: CONCURRENT ACCESS WITH CLOCK, SIEVE, AND W-TINYLFU
+    // ------------------------------------------------------------------------
+
+    const int k_NUM_THREADS = 4;
+
+    const Policy::Enum POLICIES[] = {
+        Policy::e_CLOCK, Policy::e_SIEVE, Policy::e_W_TINYLFU
+    };
+
+    bslma::TestAllocator ta("concurrent", veryVeryVeryVerbose);
+
+    for (int p = 0; p < 3; ++p) {
+        CacheType       mX(POLICIES[p], 48, 64, &ta);
+        bsls::AtomicInt stop(0);
+
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+        PolicyThreadArg           args[k_NUM_THREADS];
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            PolicyThreadArg arg = { &mX, &stop, i * 7 + 1 };
+            args[i] = arg;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                  policyWorker,
+                                                  &args[i]));
+        }
+
+        bslmt::ThreadUtil::microSleep(500000);
+        stop = 1;
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            bslmt::ThreadUtil::join(handles[i]);
+        }
+
+        ASSERTV(p, mX.size(), 64 >= mX.size());
+
+        bsl::vector<int> keys(&ta);
+        KeyCollector     collector = { &keys };
+        mX.visit(collector);
+        ASSERTV(p, keys.size(), mX.size(), keys.size() == mX.size());
+    }
+    ASSERT(0 == ta.numBlocksInUse());
+}
+
+/// This class generates keys following a Zipf distribution, interleaved
+/// with scans over keys that are never repeated, for the hit-rate
+/// benchmark.
+class Workload {
+
+    // DATA
+    bsl::vector<double> d_cdf;          // cumulative distribution of keys
+    unsigned int        d_state;        // linear congruential generator state
+    int                 d_scanPercent;  // percentage of scan accesses
+    int                 d_nextScanKey;  // next key of the current scan
+
+  public:
+    // CREATORS
+
+    /// Create a workload over the specified `numKeys` keys having the
+    /// specified Zipf `skew`, of which the specified `scanPercent` percent
+    /// of accesses are to never-repeated keys, using the specified
+    /// `allocator` to supply memory.
+    Workload(int               numKeys,
+             double            skew,
+             int               scanPercent,
+             bslma::Allocator *allocator)
+    : d_cdf(allocator)
+    , d_state(12345)
+    , d_scanPercent(scanPercent)
+    , d_nextScanKey(numKeys)
+    {
+        d_cdf.reserve(numKeys);
+
+        double sum = 0.0;
+        for (int i = 1; i <= numKeys; ++i) {
+            sum += 1.0 / bsl::pow(static_cast<double>(i), skew);
+            d_cdf.push_back(sum);
+        }
+        for (int i = 0; i < numKeys; ++i) {
+            d_cdf[i] /= sum;
+        }
+    }
+
+    // MANIPULATORS
+
+    /// Return the next key of this workload.
+    int next()
+    {
+        d_state = d_state * 1103515245u + 12345u;
+        const unsigned int r = (d_state >> 8) & 0xffffff;
+
+        if (static_cast<int>(r % 100) < d_scanPercent) {
+            return d_nextScanKey++;                                   // RETURN
+        }
+
+        const double u = static_cast<double>(r) / 16777216.0;
+
+        return static_cast<int>(
+                  bsl::lower_bound(d_cdf.begin(), d_cdf.end(), u) -
+                                                              d_cdf.begin());
+    }
+};
+
+}  // close namespace evictionPolicy
+
 namespace {
 
 class TypeWithAllocatorArg {
@@ -4305,7 +4827,7 @@ int main(int argc, char *argv[])
 
     // BDE_VERIFY pragma: -TP17 These are defined in the various test functions
     switch (test) { case 0:
-      case 20: {
+      case 23: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -4326,6 +4848,15 @@ int main(int argc, char *argv[])
         usageExample1::example1();
         usageExample2::example2();
       } break;
+      case 22: {
+        evictionPolicy::testPoliciesConcurrently();
+      } break;
+      case 21: {
+        evictionPolicy::testPolicies();
+      } break;
+      case 20: {
+        evictionPolicy::testFrequencySketch();
+      } break;
       case 19: {
         // --------------------------------------------------------------------
         // CONCERN: USE `allocator_arg` CONSTRUCTORS
@@ -4637,6 +5168,97 @@ int main(int argc, char *argv[])
         times = cp.runTests(args, cacheperf::CachePerformance::testReadWrite);
         cp.printResult();
       } break;
+      case -5: {
+        // --------------------------------------------------------------------
+        // EVICTION POLICY HIT RATE AND THROUGHPUT
+        //   Compares the hit rate and the throughput of all the eviction
+        //   policies on a skewed workload: a cache is read, and each miss is
+        //   followed by an insert (i.e., the cache-aside pattern).  To provide
+        //   control over the test, command line parameters are used.
+        //   2nd parameter: number of operations.
+        //   3rd parameter: high (and low) watermark of the cache.
+        //   4th parameter: percentage of accesses that are part of a scan
+        //   (i.e., to keys accessed only once).
+        //   5th parameter: Zipf skew of the other accesses, in percents.
+        //
+        // Concerns:
+        // 1. Reports the hit rate and the number of operations per second of
+        //    each eviction policy for the same sequence of keys.
+        //
+        // Plan:
+        // 1. Generate a sequence of keys drawn from a Zipf distribution over
+        //    100 times as many keys as fit in the cache, interleaved with
+        //    never-repeated keys.  For each eviction policy, replay the
+        //    sequence against a cache, counting hits, and time the run.
+        //    (C-1)
+        //
+        // Testing:
+        //   EVICTION POLICY HIT RATE AND THROUGHPUT
+        // --------------------------------------------------------------------
+        bslma::TestAllocator talloc("ptm5", veryVeryVeryVerbose);
+
+        int numOps      = argc > 2 ? atoi(argv[2]) : 2000000;
+        int capacity    = argc > 3 ? atoi(argv[3]) : 1000;
+        int scanPercent = argc > 4 ? atoi(argv[4]) : 10;
+        int skew        = argc > 5 ? atoi(argv[5]) : 90;
+
+        if (verbose) {
+            P_(numOps) P_(capacity) P_(scanPercent) P(skew)
+        }
+
+        bsl::vector<int> keys(&talloc);
+        keys.reserve(numOps);
+        {
+            evictionPolicy::Workload workload(capacity * 100,
+                                              skew / 100.0,
+                                              scanPercent,
+                                              &talloc);
+            for (int i = 0; i < numOps; ++i) {
+                keys.push_back(workload.next());
+            }
+        }
+
+        const struct {
+            bdlcc::CacheEvictionPolicy::Enum  d_policy;
+            const char                       *d_name;
+        } POLICIES[] = {
+            { bdlcc::CacheEvictionPolicy::e_LRU,       "LRU"       },
+            { bdlcc::CacheEvictionPolicy::e_FIFO,      "FIFO"      },
+            { bdlcc::CacheEvictionPolicy::e_CLOCK,     "CLOCK"     },
+            { bdlcc::CacheEvictionPolicy::e_SIEVE,     "SIEVE"     },
+            { bdlcc::CacheEvictionPolicy::e_W_TINYLFU, "W-TinyLFU" }
+        };
+        const int NUM_POLICIES = sizeof POLICIES / sizeof *POLICIES;
+
+        cout << bsl::fixed << bsl::setprecision(2);
+        for (int p = 0; p < NUM_POLICIES; ++p) {
+            evictionPolicy::CacheType cache(POLICIES[p].d_policy,
+                                            capacity,
+                                            capacity,
+                                            &talloc);
+            int numHits = 0;
+
+            const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+            for (int i = 0; i < numOps; ++i) {
+                evictionPolicy::CacheType::ValuePtrType valuePtr;
+                if (0 == cache.tryGetValue(&valuePtr, keys[i])) {
+                    ++numHits;
+                }
+                else {
+                    cache.insert(keys[i], keys[i]);
+                }
+            }
+            const bsls::Types::Int64 elapsed =
+                                         bsls::TimeUtil::getTimer() - start;
+
+            cout << bsl::setw(10) << POLICIES[p].d_name
+                 << ": hit rate = "
+                 << 100.0 * numHits / numOps << "%, ops/sec = "
+                 << static_cast<double>(numOps) * 1e9 /
+                                           static_cast<double>(elapsed)
+                 << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
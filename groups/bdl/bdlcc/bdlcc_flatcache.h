@@ -0,0 +1,1011 @@
+// bdlcc_flatcache.h                                                  -*-C++-*-
+#ifndef INCLUDED_BDLCC_FLATCACHE
+#define INCLUDED_BDLCC_FLATCACHE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an in-process cache with contiguous, node-free storage.
+//
+//@CLASSES:
+//  bdlcc::FlatCache: in-process key-value cache with flat storage
+//
+//@SEE_ALSO: bdlcc_cache, bdlc_flathashmap
+//
+//@DESCRIPTION: This component defines a single class template,
+// `bdlcc::FlatCache`, implementing a thread-safe in-memory key-value cache
+// with an LRU or FIFO eviction policy.  `bdlcc::FlatCache` provides the same
+// watermark-based eviction and locking behavior as `bdlcc::Cache`, but it
+// trades the flexibility of shared values for a more compact representation
+// intended for small, cheaply copyable keys and values.
+//
+///Storage
+///-------
+// `bdlcc::Cache` stores each value in a `bsl::shared_ptr`, each entry in a
+// node of a `bsl::unordered_map`, and each key in a node of a `bsl::list`
+// representing the eviction queue, so that every insertion performs several
+// allocations, and every lookup follows several pointers.
+//
+// `bdlcc::FlatCache` instead stores keys and values by value, in two
+// contiguous arrays, and maintains the eviction queue as a doubly-linked list
+// threaded through a third array of pairs of 32-bit indices.  A
+// `bdlc::FlatHashMap` maps each key to the index of its entry in the arrays.
+// When an item is removed, the last entry of the arrays is moved into the
+// hole it leaves, so that the arrays remain dense.  Consequently:
+//
+// * Inserting an item performs no allocation once the arrays and the hash
+//   map have grown to their working size (see `reserve`).
+//
+// * A lookup probes the open-addressed hash map and then reads a single
+//   array element.
+//
+// * The memory used per item is roughly twice the size of the key, plus the
+//   size of the value, plus 9 bytes, plus the unused capacity of the hash
+//   map.
+//
+// On the other hand, `tryGetValue` copies the value (rather than sharing
+// it), and the post-eviction callback is invoked with a reference to the
+// value just before its destruction; `bdlcc::Cache` is preferable for values
+// that are large or expensive to copy.  The number of items in a
+// `bdlcc::FlatCache` is limited to `2^32 - 1`.
+//
+// The `HASH` parameter defaults to
+// `bslh::FibonacciBadHashWrapper<bsl::hash<KEY> >`, as for
+// `bdlc::FlatHashMap`, whose probing relies on all the bits of the hash
+// value.
+//
+///Eviction Policies
+///-----------------
+// The LRU and FIFO eviction policies of `bdlcc::CacheEvictionPolicy` are
+// supported, with the same semantics as for `bdlcc::Cache`.  The other
+// policies are not supported by `bdlcc::FlatCache`.
+//
+///Thread Safety
+///-------------
+// `bdlcc::FlatCache` is fully thread-safe, and uses the same locking scheme
+// as `bdlcc::Cache`: a read lock is acquired by the accessors and by
+// `tryGetValue` unless the eviction policy is LRU and `modifyEvictionQueue`
+// is `true`, in which case, as for every other manipulator, a write lock is
+// acquired.
+//
+// The post-eviction callback is invoked while the write lock is held; it must
+// not call any method of the cache.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Caching Prices by Instrument Identifier
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a pricing service looks up the last traded price of
+// instruments identified by integral identifiers, and wants to keep the
+// prices of the most recently requested instruments in memory.  Both the key
+// and the value are small, so `bdlcc::FlatCache` is appropriate.
+//
+// First, we define a cache holding at most 3 prices:
+// ```
+// bdlcc::FlatCache<int, double> prices(bdlcc::CacheEvictionPolicy::e_LRU,
+//                                      3,
+//                                      3,
+//                                      &talloc);
+// ```
+// Then, we insert the prices of three instruments:
+// ```
+// prices.insert(101, 12.5);
+// prices.insert(102, 99.25);
+// prices.insert(103, 7.0);
+// assert(3 == prices.size());
+// ```
+// Next, we look up the price of instrument 101, which makes it the most
+// recently used item:
+// ```
+// double price;
+// int    rc = prices.tryGetValue(&price, 101);
+// assert(0    == rc);
+// assert(12.5 == price);
+// ```
+// Now, we insert a fourth price, which evicts the least recently used item,
+// instrument 102:
+// ```
+// prices.insert(104, 51.75);
+// assert(3 == prices.size());
+// assert(1 == prices.tryGetValue(&price, 102));
+// assert(0 == prices.tryGetValue(&price, 101));
+// ```
+// Finally, we update the price of instrument 103 in place:
+// ```
+// prices.insert(103, 7.5);
+// rc = prices.tryGetValue(&price, 103);
+// assert(0   == rc);
+// assert(7.5 == price);
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdlcc_cache.h>
+
+#include <bdlc_flathashmap.h>
+
+#include <bslh_fibonaccibadhashwrapper.h>
+
+#include <bslmt_readerwritermutex.h>
+#include <bslmt_readlockguard.h>
+#include <bslmt_writelockguard.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_allocatorargt.h>
+#include <bslmf_integralconstant.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_functional.h>
+#include <bsl_limits.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                          // =====================
+                          // struct FlatCache_Link
+                          // =====================
+
+/// This `struct` holds the links of an entry of `FlatCache` in the eviction
+/// queue, as indices of the neighboring entries.
+struct FlatCache_Link {
+
+    // PUBLIC DATA
+    bsl::uint32_t d_prev;  // index of the previous entry, or null
+    bsl::uint32_t d_next;  // index of the next entry, or null
+};
+
+                     // ===============================
+                     // class FlatCache_PopBackProctor
+                     // ===============================
+
+/// This class implements a proctor that, unless released, removes the last
+/// element of a vector on destruction.  `FlatCache` uses it to keep its
+/// arrays consistent if an insertion throws.
+template <class VECTOR>
+class FlatCache_PopBackProctor {
+
+    // DATA
+    VECTOR *d_vector_p;  // managed vector, or 0 if released
+
+  private:
+    // NOT IMPLEMENTED
+    FlatCache_PopBackProctor(const FlatCache_PopBackProctor&);
+    FlatCache_PopBackProctor& operator=(const FlatCache_PopBackProctor&);
+
+  public:
+    // CREATORS
+
+    /// Create a proctor managing the last element of the specified `vector`.
+    explicit FlatCache_PopBackProctor(VECTOR *vector);
+
+    /// Remove the last element of the managed vector, if any.
+    ~FlatCache_PopBackProctor();
+
+    // MANIPULATORS
+
+    /// Release the managed vector from management by this proctor.
+    void release();
+};
+
+                              // ===============
+                              // class FlatCache
+                              // ===============
+
+/// This class represents an in-process key-value store with LRU or FIFO
+/// eviction, storing its items in contiguous arrays.
+template <class KEY,
+          class VALUE,
+          class HASH  = bslh::FibonacciBadHashWrapper<bsl::hash<KEY> >,
+          class EQUAL = bsl::equal_to<KEY> >
+class FlatCache {
+
+  public:
+    // PUBLIC TYPES
+
+    /// Type of function to call before an item is removed from the cache.
+    typedef bsl::function<void(const VALUE&)>       PostEvictionCallback;
+
+    /// Value type of a bulk insert entry.
+    typedef bsl::pair<KEY, VALUE>                   KVType;
+
+  private:
+    // PRIVATE TYPES
+
+    /// Index of an entry in the arrays of this cache.
+    typedef bsl::uint32_t                                  IndexType;
+
+    /// Hash map type, mapping each key to the index of its entry.
+    typedef bdlc::FlatHashMap<KEY, IndexType, HASH, EQUAL> MapType;
+
+    typedef bsl::vector<KEY>                               KeyArray;
+    typedef bsl::vector<VALUE>                             ValueArray;
+    typedef bsl::vector<FlatCache_Link>                    LinkArray;
+
+    typedef bslmt::ReaderWriterMutex                       LockType;
+
+    // PRIVATE CLASS DATA
+    static const IndexType k_NULL_INDEX =
+                                       bsl::numeric_limits<IndexType>::max();
+
+    // DATA
+    bslma::Allocator          *d_allocator_p;          // memory allocator
+                                                       // (held, not owned)
+
+    mutable LockType           d_rwlock;               // reader-writer lock
+
+    MapType                    d_map;                  // key to entry index
+
+    KeyArray                   d_keys;                 // key of each entry
+
+    ValueArray                 d_values;               // value of each entry
+
+    LinkArray                  d_links;                // eviction queue links
+                                                       // of each entry
+
+    IndexType                  d_head;                 // first entry to be
+                                                       // evicted, or null
+
+    IndexType                  d_tail;                 // last entry to be
+                                                       // evicted, or null
+
+    CacheEvictionPolicy::Enum  d_evictionPolicy;       // eviction policy
+
+    bsl::size_t                d_lowWatermark;         // the size of this
+                                                       // cache when eviction
+                                                       // stops
+
+    bsl::size_t                d_highWatermark;        // the size of this
+                                                       // cache when eviction
+                                                       // starts after an
+                                                       // insert
+
+    PostEvictionCallback       d_postEvictionCallback; // the function to call
+                                                       // before a value is
+                                                       // removed from the
+                                                       // cache
+
+    // PRIVATE MANIPULATORS
+
+    /// Evict items from this cache if `size() >= highWatermark()` until
+    /// `size() < lowWatermark()` beginning from the front of the eviction
+    /// queue.  Invoke the post-eviction callback for each item evicted.
+    void enforceHighWatermark();
+
+    /// Invoke the post-eviction callback for the entry at the specified
+    /// `index`, and remove it from this cache.
+    void evictItem(IndexType index);
+
+    /// Insert the specified `key` and `*value_p` into this cache, or replace
+    /// the value of `key` if it is already in this cache.  If the specified
+    /// `moveValue` is `true`, move `*value_p`, and copy it otherwise.  Return
+    /// `true` if `key` was inserted, and `false` otherwise.
+    bool insertImp(const KEY& key, VALUE *value_p, bool moveValue);
+
+    /// Append the entry at the specified `index` to the back of the eviction
+    /// queue.
+    void linkBack(IndexType index);
+
+    /// Move the entry at the specified `index` to the back of the eviction
+    /// queue.
+    void moveToBack(IndexType index);
+
+    /// Remove the entry at the specified `index` from this cache, moving the
+    /// last entry of the arrays into its place.
+    void removeEntry(IndexType index);
+
+    /// Remove the entry at the specified `index` from the eviction queue.
+    void unlink(IndexType index);
+
+  private:
+    // NOT IMPLEMENTED
+    FlatCache(const FlatCache&);
+    FlatCache& operator=(const FlatCache&);
+
+  public:
+    // CREATORS
+
+    /// Create an empty LRU cache having no size limit.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0, the
+    /// currently installed default allocator is used.
+    explicit FlatCache(bslma::Allocator *basicAllocator = 0);
+
+    /// Create an empty cache using the specified `evictionPolicy` and the
+    /// specified `lowWatermark` and `highWatermark`.  Optionally specify the
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0, the
+    /// currently installed default allocator is used.  The behavior is
+    /// undefined unless `evictionPolicy` is `CacheEvictionPolicy::e_LRU` or
+    /// `CacheEvictionPolicy::e_FIFO`, `lowWatermark <= highWatermark`,
+    /// `1 <= lowWatermark`, and `1 <= highWatermark`.
+    FlatCache(CacheEvictionPolicy::Enum  evictionPolicy,
+              bsl::size_t                lowWatermark,
+              bsl::size_t                highWatermark,
+              bslma::Allocator          *basicAllocator = 0);
+
+    /// Create an empty cache using the specified `evictionPolicy`,
+    /// `lowWatermark`, and `highWatermark`.  The specified `hashFunction` is
+    /// used to generate the hash values for a given key, and the specified
+    /// `equalFunction` is used to determine whether two keys have the same
+    /// value.  Optionally specify the `basicAllocator` used to supply memory.
+    /// If `basicAllocator` is 0, the currently installed default allocator is
+    /// used.  The behavior is undefined unless `evictionPolicy` is
+    /// `CacheEvictionPolicy::e_LRU` or `CacheEvictionPolicy::e_FIFO`,
+    /// `lowWatermark <= highWatermark`, `1 <= lowWatermark`, and
+    /// `1 <= highWatermark`.
+    FlatCache(CacheEvictionPolicy::Enum  evictionPolicy,
+              bsl::size_t                lowWatermark,
+              bsl::size_t                highWatermark,
+              const HASH&                hashFunction,
+              const EQUAL&               equalFunction,
+              bslma::Allocator          *basicAllocator = 0);
+
+    /// Destroy this object.
+    //! ~FlatCache() = default;
+
+    // MANIPULATORS
+
+    /// Remove all items from this cache.  Do *not* invoke the post-eviction
+    /// callback.  Note that the memory used by the arrays and the hash map
+    /// is retained.
+    void clear();
+
+    /// Remove the item having the specified `key` from this cache.  Invoke the
+    /// post-eviction callback for the removed item.  Return 0 on success and 1
+    /// if `key` does not exist.
+    int erase(const KEY& key);
+
+    /// Remove the items having the keys in the specified range
+    /// `[ begin, end )`, from this cache.  Invoke the post-eviction
+    /// callback for each removed item.  Return the number of items
+    /// successfully removed.
+    template <class INPUT_ITERATOR>
+    int eraseBulk(INPUT_ITERATOR begin, INPUT_ITERATOR end);
+
+    /// Remove the items having the specified `keys` from this cache.
+    /// Invoke the post-eviction callback for each removed item.  Return the
+    /// number of items successfully removed.
+    int eraseBulk(const bsl::vector<KEY>& keys);
+
+    /// Insert the specified `key` and its associated `value` into this cache.
+    /// If `key` already exists, then its value will be replaced with `value`.
+    /// Note that the method taking a moved `value` provides the `basic` but
+    /// not the `strong` exception guarantee.
+    void insert(const KEY& key, const VALUE& value);
+    void insert(const KEY& key, bslmf::MovableRef<VALUE> value);
+
+    /// Insert the specified range of Key-Value pairs specified by
+    /// `[ begin, end )` into this cache.  If a key already exists, then its
+    /// value will be replaced with the value.  Return the number of items
+    /// successfully inserted.
+    template <class INPUT_ITERATOR>
+    int insertBulk(INPUT_ITERATOR begin, INPUT_ITERATOR end);
+
+    /// Insert the specified `data` (composed of Key-Value pairs) into this
+    /// cache.  If a key already exists, then its value will be replaced
+    /// with the value.  Return the number of items successfully inserted.
+    int insertBulk(const bsl::vector<KVType>& data);
+
+    /// Remove the item at the front of the eviction queue.  Invoke the
+    /// post-eviction callback for the removed item.  Return 0 on success, and
+    /// 1 if this cache is empty.
+    int popFront();
+
+    /// Allocate the memory needed to hold at least the specified `numItems`
+    /// items without further allocation.  The behavior is undefined unless
+    /// `numItems < 2^32`.
+    void reserve(bsl::size_t numItems);
+
+    /// Set the post-eviction callback to the specified
+    /// `postEvictionCallback`.  The post-eviction callback is invoked for
+    /// each item evicted or removed from this cache, before the item is
+    /// destroyed.
+    void setPostEvictionCallback(
+                             const PostEvictionCallback& postEvictionCallback);
+
+    /// Load, into the specified `value`, a copy of the value associated with
+    /// the specified `key` in this cache.  If the optionally specified
+    /// `modifyEvictionQueue` is `true` and the eviction policy is LRU, then
+    /// move the cached item to the back of the eviction queue.  Return 0 on
+    /// success, and 1 if `key` does not exist in this cache.  Note that a
+    /// write lock is acquired only if the eviction queue is modified.
+    int tryGetValue(VALUE      *value,
+                    const KEY&  key,
+                    bool        modifyEvictionQueue = true);
+
+    // ACCESSORS
+
+    /// Return (a copy of) the key-equality functor used by this cache that
+    /// returns `true` if two `KEY` objects have the same value, and `false`
+    /// otherwise.
+    EQUAL equalFunction() const;
+
+    /// Return the eviction policy used by this cache.
+    CacheEvictionPolicy::Enum evictionPolicy() const;
+
+    /// Return (a copy of) the unary hash functor used by this cache to
+    /// generate a hash value (of type `std::size_t`) for a `KEY` object.
+    HASH hashFunction() const;
+
+    /// Return the high watermark of this cache, which is the size at which
+    /// eviction of existing items begins.
+    bsl::size_t highWatermark() const;
+
+    /// Return the low watermark of this cache, which is the size at which
+    /// eviction of existing items ends.
+    bsl::size_t lowWatermark() const;
+
+    /// Return the current size of this cache.
+    bsl::size_t size() const;
+
+    /// Call the specified `visitor` for every item stored in this cache in
+    /// the order of the eviction queue until `visitor` returns `false`.
+    /// The `VISITOR` type must be a callable object that can be invoked in
+    /// the same way as the function `bool (const KEY&, const VALUE&)`
+    template <class VISITOR>
+    void visit(VISITOR& visitor) const;
+
+                                  // Aspects
+
+    /// Return the allocator used by this cache to supply memory.
+    bslma::Allocator *allocator() const;
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                     // -------------------------------
+                     // class FlatCache_PopBackProctor
+                     // -------------------------------
+
+// CREATORS
+template <class VECTOR>
+inline
+FlatCache_PopBackProctor<VECTOR>::FlatCache_PopBackProctor(VECTOR *vector)
+: d_vector_p(vector)
+{
+}
+
+template <class VECTOR>
+inline
+FlatCache_PopBackProctor<VECTOR>::~FlatCache_PopBackProctor()
+{
+    if (d_vector_p) {
+        d_vector_p->pop_back();
+    }
+}
+
+// MANIPULATORS
+template <class VECTOR>
+inline
+void FlatCache_PopBackProctor<VECTOR>::release()
+{
+    d_vector_p = 0;
+}
+
+                              // ---------------
+                              // class FlatCache
+                              // ---------------
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+FlatCache<KEY, VALUE, HASH, EQUAL>::FlatCache(bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_map(d_allocator_p)
+, d_keys(d_allocator_p)
+, d_values(d_allocator_p)
+, d_links(d_allocator_p)
+, d_head(k_NULL_INDEX)
+, d_tail(k_NULL_INDEX)
+, d_evictionPolicy(CacheEvictionPolicy::e_LRU)
+, d_lowWatermark(bsl::numeric_limits<bsl::size_t>::max())
+, d_highWatermark(bsl::numeric_limits<bsl::size_t>::max())
+, d_postEvictionCallback(bsl::allocator_arg, d_allocator_p)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+FlatCache<KEY, VALUE, HASH, EQUAL>::FlatCache(
+                             CacheEvictionPolicy::Enum  evictionPolicy,
+                             bsl::size_t                lowWatermark,
+                             bsl::size_t                highWatermark,
+                             bslma::Allocator          *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_map(d_allocator_p)
+, d_keys(d_allocator_p)
+, d_values(d_allocator_p)
+, d_links(d_allocator_p)
+, d_head(k_NULL_INDEX)
+, d_tail(k_NULL_INDEX)
+, d_evictionPolicy(evictionPolicy)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+, d_postEvictionCallback(bsl::allocator_arg, d_allocator_p)
+{
+    BSLS_ASSERT(CacheEvictionPolicy::e_LRU  == evictionPolicy ||
+                CacheEvictionPolicy::e_FIFO == evictionPolicy);
+    BSLS_REVIEW(lowWatermark <= highWatermark);
+    BSLS_REVIEW(1 <= lowWatermark);
+    BSLS_REVIEW(1 <= highWatermark);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+FlatCache<KEY, VALUE, HASH, EQUAL>::FlatCache(
+                             CacheEvictionPolicy::Enum  evictionPolicy,
+                             bsl::size_t                lowWatermark,
+                             bsl::size_t                highWatermark,
+                             const HASH&                hashFunction,
+                             const EQUAL&               equalFunction,
+                             bslma::Allocator          *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_map(0, hashFunction, equalFunction, d_allocator_p)
+, d_keys(d_allocator_p)
+, d_values(d_allocator_p)
+, d_links(d_allocator_p)
+, d_head(k_NULL_INDEX)
+, d_tail(k_NULL_INDEX)
+, d_evictionPolicy(evictionPolicy)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+, d_postEvictionCallback(bsl::allocator_arg, d_allocator_p)
+{
+    BSLS_ASSERT(CacheEvictionPolicy::e_LRU  == evictionPolicy ||
+                CacheEvictionPolicy::e_FIFO == evictionPolicy);
+    BSLS_REVIEW(lowWatermark <= highWatermark);
+    BSLS_REVIEW(1 <= lowWatermark);
+    BSLS_REVIEW(1 <= highWatermark);
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void FlatCache<KEY, VALUE, HASH, EQUAL>::enforceHighWatermark()
+{
+    if (d_keys.size() < d_highWatermark) {
+        return;                                                       // RETURN
+    }
+
+    while (d_keys.size() >= d_lowWatermark && d_keys.size() > 0) {
+        evictItem(d_head);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void FlatCache<KEY, VALUE, HASH, EQUAL>::evictItem(IndexType index)
+{
+    if (d_postEvictionCallback) {
+        d_postEvictionCallback(d_values[index]);
+    }
+    removeEntry(index);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool FlatCache<KEY, VALUE, HASH, EQUAL>::insertImp(const KEY&  key,
+                                                   VALUE      *value_p,
+                                                   bool        moveValue)
+{
+    enforceHighWatermark();
+
+    VALUE& value = *value_p;
+
+    typename MapType::iterator mapIt = d_map.find(key);
+    if (mapIt != d_map.end()) {
+        if (moveValue) {
+            d_values[mapIt->second] = bslmf::MovableRefUtil::move(value);
+        }
+        else {
+            d_values[mapIt->second] = value;
+        }
+        moveToBack(mapIt->second);
+        return false;                                                 // RETURN
+    }
+
+    BSLS_ASSERT(d_keys.size() < k_NULL_INDEX);
+
+    const IndexType index = static_cast<IndexType>(d_keys.size());
+
+    d_keys.push_back(key);
+    FlatCache_PopBackProctor<KeyArray> keysProctor(&d_keys);
+
+    if (moveValue) {
+        d_values.push_back(bslmf::MovableRefUtil::move(value));
+    }
+    else {
+        d_values.push_back(value);
+    }
+    FlatCache_PopBackProctor<ValueArray> valuesProctor(&d_values);
+
+    const FlatCache_Link link = { k_NULL_INDEX, k_NULL_INDEX };
+    d_links.push_back(link);
+    FlatCache_PopBackProctor<LinkArray> linksProctor(&d_links);
+
+    d_map.try_emplace(key, index);
+
+    linksProctor.release();
+    valuesProctor.release();
+    keysProctor.release();
+
+    linkBack(index);
+
+    return true;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatCache<KEY, VALUE, HASH, EQUAL>::linkBack(IndexType index)
+{
+    FlatCache_Link& link = d_links[index];
+
+    link.d_prev = d_tail;
+    link.d_next = k_NULL_INDEX;
+
+    if (k_NULL_INDEX == d_tail) {
+        d_head = index;
+    }
+    else {
+        d_links[d_tail].d_next = index;
+    }
+    d_tail = index;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatCache<KEY, VALUE, HASH, EQUAL>::moveToBack(IndexType index)
+{
+    if (d_tail != index) {
+        unlink(index);
+        linkBack(index);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void FlatCache<KEY, VALUE, HASH, EQUAL>::removeEntry(IndexType index)
+{
+    unlink(index);
+    d_map.erase(d_keys[index]);
+
+    const IndexType last = static_cast<IndexType>(d_keys.size() - 1);
+
+    if (index != last) {
+        // Move the last entry into the hole, and update the hash map and the
+        // eviction queue to refer to its new position.
+
+        d_keys[index]   = bslmf::MovableRefUtil::move(d_keys[last]);
+        d_values[index] = bslmf::MovableRefUtil::move(d_values[last]);
+        d_links[index]  = d_links[last];
+
+        const FlatCache_Link& link = d_links[index];
+
+        if (k_NULL_INDEX == link.d_prev) {
+            d_head = index;
+        }
+        else {
+            d_links[link.d_prev].d_next = index;
+        }
+
+        if (k_NULL_INDEX == link.d_next) {
+            d_tail = index;
+        }
+        else {
+            d_links[link.d_next].d_prev = index;
+        }
+
+        const typename MapType::iterator mapIt = d_map.find(d_keys[index]);
+        BSLS_ASSERT(mapIt != d_map.end());
+        mapIt->second = index;
+    }
+
+    d_keys.pop_back();
+    d_values.pop_back();
+    d_links.pop_back();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatCache<KEY, VALUE, HASH, EQUAL>::unlink(IndexType index)
+{
+    const FlatCache_Link& link = d_links[index];
+
+    if (k_NULL_INDEX == link.d_prev) {
+        d_head = link.d_next;
+    }
+    else {
+        d_links[link.d_prev].d_next = link.d_next;
+    }
+
+    if (k_NULL_INDEX == link.d_next) {
+        d_tail = link.d_prev;
+    }
+    else {
+        d_links[link.d_next].d_prev = link.d_prev;
+    }
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void FlatCache<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
+
+    d_map.clear();
+    d_keys.clear();
+    d_values.clear();
+    d_links.clear();
+    d_head = k_NULL_INDEX;
+    d_tail = k_NULL_INDEX;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int FlatCache<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
+
+    const typename MapType::iterator mapIt = d_map.find(key);
+    if (mapIt == d_map.end()) {
+        return 1;                                                     // RETURN
+    }
+
+    evictItem(mapIt->second);
+    return 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+int FlatCache<KEY, VALUE, HASH, EQUAL>::eraseBulk(INPUT_ITERATOR begin,
+                                                  INPUT_ITERATOR end)
+{
+    int count = 0;
+
+    bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
+
+    for (; begin != end; ++begin) {
+        const typename MapType::iterator mapIt = d_map.find(*begin);
+        if (mapIt == d_map.end()) {
+            continue;
+        }
+        ++count;
+        evictItem(mapIt->second);
+    }
+
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int FlatCache<KEY, VALUE, HASH, EQUAL>::eraseBulk(
+                                                const bsl::vector<KEY>& keys)
+{
+    return eraseBulk(keys.begin(), keys.end());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void FlatCache<KEY, VALUE, HASH, EQUAL>::insert(const KEY&   key,
+                                                const VALUE& value)
+{
+    bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
+
+    // `value` is not modified, since it is not moved.
+
+    insertImp(key, const_cast<VALUE *>(&value), false);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void FlatCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                             const KEY&               key,
+                                             bslmf::MovableRef<VALUE> value)
+{
+    bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
+
+    insertImp(key, &bslmf::MovableRefUtil::access(value), true);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+int FlatCache<KEY, VALUE, HASH, EQUAL>::insertBulk(INPUT_ITERATOR begin,
+                                                   INPUT_ITERATOR end)
+{
+    int count = 0;
+
+    bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
+
+    for (; begin != end; ++begin) {
+        count += insertImp(begin->first,
+                           const_cast<VALUE *>(&begin->second),
+                           false);
+    }
+
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int FlatCache<KEY, VALUE, HASH, EQUAL>::insertBulk(
+                                             const bsl::vector<KVType>& data)
+{
+    return insertBulk(data.begin(), data.end());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int FlatCache<KEY, VALUE, HASH, EQUAL>::popFront()
+{
+    bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
+
+    if (k_NULL_INDEX == d_head) {
+        return 1;                                                     // RETURN
+    }
+
+    evictItem(d_head);
+    return 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void FlatCache<KEY, VALUE, HASH, EQUAL>::reserve(bsl::size_t numItems)
+{
+    BSLS_ASSERT(numItems < k_NULL_INDEX);
+
+    bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
+
+    d_map.reserve(numItems);
+    d_keys.reserve(numItems);
+    d_values.reserve(numItems);
+    d_links.reserve(numItems);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void FlatCache<KEY, VALUE, HASH, EQUAL>::setPostEvictionCallback(
+                              const PostEvictionCallback& postEvictionCallback)
+{
+    bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
+
+    d_postEvictionCallback = postEvictionCallback;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int FlatCache<KEY, VALUE, HASH, EQUAL>::tryGetValue(
+                                              VALUE      *value,
+                                              const KEY&  key,
+                                              bool        modifyEvictionQueue)
+{
+    BSLS_ASSERT(value);
+
+    const bool writeLock = CacheEvictionPolicy::e_LRU == d_evictionPolicy &&
+                                                           modifyEvictionQueue;
+
+    if (writeLock) {
+        d_rwlock.lockWrite();
+    }
+    else {
+        d_rwlock.lockRead();
+    }
+
+    // Since the guard is constructed with a locked synchronization object, the
+    // guard's call to 'unlock' correctly handles both read and write
+    // scenarios.
+
+    bslmt::ReadLockGuard<LockType> guard(&d_rwlock, true);
+
+    const typename MapType::iterator mapIt = d_map.find(key);
+    if (mapIt == d_map.end()) {
+        return 1;                                                     // RETURN
+    }
+
+    *value = d_values[mapIt->second];
+
+    if (writeLock) {
+        moveToBack(mapIt->second);
+    }
+
+    return 0;
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL FlatCache<KEY, VALUE, HASH, EQUAL>::equalFunction() const
+{
+    return d_map.key_eq();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+CacheEvictionPolicy::Enum
+FlatCache<KEY, VALUE, HASH, EQUAL>::evictionPolicy() const
+{
+    return d_evictionPolicy;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH FlatCache<KEY, VALUE, HASH, EQUAL>::hashFunction() const
+{
+    return d_map.hash_function();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatCache<KEY, VALUE, HASH, EQUAL>::highWatermark() const
+{
+    return d_highWatermark;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatCache<KEY, VALUE, HASH, EQUAL>::lowWatermark() const
+{
+    return d_lowWatermark;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatCache<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    bslmt::ReadLockGuard<LockType> guard(&d_rwlock);
+
+    return d_keys.size();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class VISITOR>
+void FlatCache<KEY, VALUE, HASH, EQUAL>::visit(VISITOR& visitor) const
+{
+    bslmt::ReadLockGuard<LockType> guard(&d_rwlock);
+
+    for (IndexType index = d_head; k_NULL_INDEX != index;
+                                             index = d_links[index].d_next) {
+        if (!visitor(d_keys[index], d_values[index])) {
+            break;
+        }
+    }
+}
+
+                                  // Aspects
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bslma::Allocator *FlatCache<KEY, VALUE, HASH, EQUAL>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+
+// TRAITS
+
+namespace bslma {
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+struct UsesBslmaAllocator<bdlcc::FlatCache<KEY, VALUE, HASH, EQUAL> >
+    : bsl::true_type
+{
+};
+
+}  // close namespace bslma
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1287 @@
+// bdlcc_flatcache.t.cpp                                              -*-C++-*-
+
+#include <bdlcc_flatcache.h>
+
+#include <bdlcc_cache.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bslmt_threadutil.h>
+#include <bslmt_timedcompletionguard.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_review.h>
+#include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_format.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a mechanism, `bdlcc::FlatCache`, that
+// provides an in-memory key-value cache storing its items in contiguous
+// arrays threaded by an index-linked eviction queue.  The observable behavior
+// of `bdlcc::FlatCache` is that of `bdlcc::Cache` restricted to the LRU and
+// FIFO eviction policies, with values returned by copy.  We therefore verify
+// the basic manipulators directly, and then use `bdlcc::Cache` as an oracle
+// for long random sequences of operations, which exercise the relocation of
+// entries when items are removed.  Thread safety is provided by a
+// reader-writer lock, so only a stress test is required.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit FlatCache(bslma::Allocator *basicAllocator);
+// [ 2] FlatCache(policy, lowWat, highWat, alloc);
+// [ 2] FlatCache(policy, lowWat, highWat, hash, equal, alloc);
+//
+// MANIPULATORS
+// [ 3] void insert(const KEY& key, const VALUE& value);
+// [ 3] void insert(const KEY& key, MovableRef<VALUE> value);
+// [ 3] int tryGetValue(VALUE *value, key, modifyEvictionQueue);
+// [ 3] int erase(const KEY& key);
+// [ 3] int popFront();
+// [ 3] void clear();
+// [ 5] int insertBulk(INPUT_ITERATOR begin, INPUT_ITERATOR end);
+// [ 5] int insertBulk(const bsl::vector<KVType>& data);
+// [ 5] int eraseBulk(INPUT_ITERATOR begin, INPUT_ITERATOR end);
+// [ 5] int eraseBulk(const bsl::vector<KEY>& keys);
+// [ 5] void reserve(bsl::size_t numItems);
+// [ 5] void setPostEvictionCallback(postEvictionCallback);
+//
+// ACCESSORS
+// [ 2] EQUAL equalFunction() const;
+// [ 2] CacheEvictionPolicy::Enum evictionPolicy() const;
+// [ 2] HASH hashFunction() const;
+// [ 2] bsl::size_t highWatermark() const;
+// [ 2] bsl::size_t lowWatermark() const;
+// [ 2] bslma::Allocator *allocator() const;
+// [ 3] bsl::size_t size() const;
+// [ 3] void visit(VISITOR& visitor) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: BEHAVES AS `bdlcc::Cache`
+// [ 6] CONCERN: EXCEPTION SAFETY
+// [ 7] CONCERN: TYPE TRAITS
+// [ 8] CONCERN: THREAD SAFETY
+// [ 9] USAGE EXAMPLE
+// [-1] PERFORMANCE: `bdlcc::Cache` VS. `bdlcc::FlatCache`
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+
+typedef bdlcc::FlatCache<int, int>    Obj;
+typedef bdlcc::CacheEvictionPolicy    Policy;
+
+// ============================================================================
+//                       HELPER CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// Hash functor returning the key itself, offset by `d_offset`, so that
+/// distinct functor objects can be distinguished.
+class TestHash {
+
+    int d_offset;
+
+  public:
+    explicit TestHash(int offset = 0)
+    : d_offset(offset)
+    {
+    }
+
+    bsl::size_t operator()(int key) const
+    {
+        return static_cast<bsl::size_t>(key + d_offset) *
+                                                     0x9E3779B97F4A7C15ULL;
+    }
+
+    int offset() const
+    {
+        return d_offset;
+    }
+};
+
+/// Equality functor that can be distinguished by its `d_id`.
+class TestEqual {
+
+    int d_id;
+
+  public:
+    explicit TestEqual(int id = 0)
+    : d_id(id)
+    {
+    }
+
+    bool operator()(int lhs, int rhs) const
+    {
+        return lhs == rhs;
+    }
+
+    int id() const
+    {
+        return d_id;
+    }
+};
+
+/// Visitor collecting the visited keys and values, and stopping after
+/// `d_limit` items.
+template <class VALUE>
+struct CollectVisitor {
+
+    bsl::vector<int>   *d_keys_p;
+    bsl::vector<VALUE> *d_values_p;
+    bsl::size_t         d_limit;
+
+    bool operator()(int key, const VALUE& value)
+    {
+        d_keys_p->push_back(key);
+        if (d_values_p) {
+            d_values_p->push_back(value);
+        }
+        return d_keys_p->size() < d_limit;
+    }
+};
+
+/// Visitor collecting the visited `bsl::string` keys.
+struct StringKeyVisitor {
+
+    bsl::vector<bsl::string> *d_keys_p;
+
+    bool operator()(const bsl::string& key, const bsl::string&)
+    {
+        d_keys_p->push_back(key);
+        return true;
+    }
+};
+
+/// Load, into the specified `keys` and `values`, the items of the specified
+/// `cache` in eviction order.
+template <class CACHE, class VALUE>
+void collect(bsl::vector<int>   *keys,
+             bsl::vector<VALUE> *values,
+             const CACHE&        cache)
+{
+    keys->clear();
+    values->clear();
+
+    CollectVisitor<VALUE> visitor = { keys, values, ~bsl::size_t(0) };
+    cache.visit(visitor);
+}
+
+/// Post-eviction callback state.
+bsls::AtomicInt evictionCount(0);
+bsls::AtomicInt evictionSum(0);
+
+void countingCallback(const int& value)
+{
+    ++evictionCount;
+    evictionSum += value;
+}
+
+/// Return the next value of the specified linear congruential generator
+/// `state`, in the range `[0 .. 2^24)`.
+int nextRandom(unsigned int *state)
+{
+    *state = *state * 1103515245u + 12345u;
+    return static_cast<int>((*state >> 8) & 0xffffff);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                          MULTI-THREADED TESTING
+// ----------------------------------------------------------------------------
+
+namespace threaded {
+
+struct ThreadArg {
+    Obj             *d_cache_p;
+    bsls::AtomicInt *d_stop_p;
+    int              d_numItems;
+    int              d_workerId;
+};
+
+extern "C" void *workerThread(void *v_arg)
+{
+    ThreadArg    *arg   = static_cast<ThreadArg *>(v_arg);
+    unsigned int  state = 7919u * (arg->d_workerId + 1);
+
+    while (0 == *arg->d_stop_p) {
+        const int key = nextRandom(&state) % arg->d_numItems;
+        const int op  = nextRandom(&state) % 16;
+
+        int value;
+        if (op < 10) {
+            if (0 == arg->d_cache_p->tryGetValue(&value, key)) {
+                ASSERTV(key, value, key * 3 == value);
+            }
+            else {
+                arg->d_cache_p->insert(key, key * 3);
+            }
+        }
+        else if (op < 14) {
+            arg->d_cache_p->insert(key, key * 3);
+        }
+        else if (op < 15) {
+            arg->d_cache_p->erase(key);
+        }
+        else {
+            arg->d_cache_p->popFront();
+        }
+    }
+    return v_arg;
+}
+
+}  // close namespace threaded
+
+// ============================================================================
+//                          PERFORMANCE TESTING
+// ----------------------------------------------------------------------------
+
+namespace perf {
+
+/// Return the number of nanoseconds taken to look up the specified
+/// `numReads` keys in `[0 .. numItems)` in the specified `cache`, using
+/// the specified `valueOf` to dereference the value loaded by `tryGetValue`.
+template <class CACHE, class VALUE_HOLDER>
+bsls::Types::Int64 timeReads(CACHE         *cache,
+                             VALUE_HOLDER  *holder,
+                             int            numItems,
+                             int            numReads,
+                             int           *checksum)
+{
+    unsigned int state = 31337;
+
+    const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+    for (int i = 0; i < numReads; ++i) {
+        const int key = nextRandom(&state) % numItems;
+        if (0 == cache->tryGetValue(holder, key)) {
+            ++*checksum;
+        }
+    }
+    return bsls::TimeUtil::getTimer() - start;
+}
+
+}  // close namespace perf
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+void example1(bslma::Allocator *allocator)
+{
+    bslma::Allocator& talloc = *allocator;
+
+///Example 1: Caching Prices by Instrument Identifier
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a pricing service looks up the last traded price of
+// instruments identified by integral identifiers, and wants to keep the
+// prices of the most recently requested instruments in memory.  Both the key
+// and the value are small, so `bdlcc::FlatCache` is appropriate.
+//
+// First, we define a cache holding at most 3 prices:
+// ```
+    bdlcc::FlatCache<int, double> prices(bdlcc::CacheEvictionPolicy::e_LRU,
+                                         3,
+                                         3,
+                                         &talloc);
+// ```
+// Then, we insert the prices of three instruments:
+// ```
+    prices.insert(101, 12.5);
+    prices.insert(102, 99.25);
+    prices.insert(103, 7.0);
+    ASSERT(3 == prices.size());
+// ```
+// Next, we look up the price of instrument 101, which makes it the most
+// recently used item:
+// ```
+    double price;
+    int    rc = prices.tryGetValue(&price, 101);
+    ASSERT(0    == rc);
+    ASSERT(12.5 == price);
+// ```
+// Now, we insert a fourth price, which evicts the least recently used item,
+// instrument 102:
+// ```
+    prices.insert(104, 51.75);
+    ASSERT(3 == prices.size());
+    ASSERT(1 == prices.tryGetValue(&price, 102));
+    ASSERT(0 == prices.tryGetValue(&price, 101));
+// ```
+// Finally, we update the price of instrument 103 in place:
+// ```
+    prices.insert(103, 7.5);
+    rc = prices.tryGetValue(&price, 103);
+    ASSERT(0   == rc);
+    ASSERT(7.5 == price);
+// ```
+}
+
+}  // close namespace usage
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: `BSLS_REVIEW` failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+    bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+    bslma::TestAllocatorMonitor gam(&globalAllocator);
+
+    bslmt::TimedCompletionGuard completionGuard(&defaultAllocator);
+    ASSERT(0 == completionGuard.guard(bsls::TimeInterval(90, 0),
+                                      bsl::format("case {}", test)));
+
+    switch (test) { case 0:
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+        bslma::TestAllocator ta("usage", veryVeryVeryVerbose);
+
+        usage::example1(&ta);
+
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // CONCERN: THREAD SAFETY
+        //
+        // Concerns:
+        // 1. Concurrent lookups, insertions, and removals, including those
+        //    relocating entries, neither corrupt the cache nor return values
+        //    associated with other keys.
+        //
+        // Plan:
+        // 1. Run several threads performing a random mix of `tryGetValue`,
+        //    `insert`, `erase`, and `popFront` on a small cache for a fixed
+        //    period of time, verifying every value read.  Then verify the
+        //    consistency of the cache with `visit`.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: THREAD SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONCERN: THREAD SAFETY" << endl
+                                  << "======================" << endl;
+
+        const int k_NUM_THREADS = 8;
+        const int k_NUM_ITEMS   = 512;
+
+        const Policy::Enum POLICIES[] = { Policy::e_LRU, Policy::e_FIFO };
+
+        bslma::TestAllocator ta("threaded", veryVeryVeryVerbose);
+
+        for (int p = 0; p < 2; ++p) {
+            Obj             mX(POLICIES[p], 100, 128, &ta);
+            bsls::AtomicInt stop(0);
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            threaded::ThreadArg       args[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                threaded::ThreadArg arg = { &mX, &stop, k_NUM_ITEMS, i };
+                args[i] = arg;
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      threaded::workerThread,
+                                                      &args[i]));
+            }
+
+            bslmt::ThreadUtil::microSleep(0, 1);
+            stop = 1;
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                bslmt::ThreadUtil::join(handles[i]);
+            }
+
+            bsl::vector<int> keys(&ta);
+            bsl::vector<int> values(&ta);
+            collect(&keys, &values, mX);
+
+            ASSERTV(p, mX.size(), 128 >= mX.size());
+            ASSERTV(p, keys.size(), mX.size(), keys.size() == mX.size());
+            for (bsl::size_t i = 0; i < keys.size(); ++i) {
+                ASSERTV(p, keys[i], values[i], keys[i] * 3 == values[i]);
+
+                int value;
+                ASSERTV(p, keys[i], 0 == mX.tryGetValue(&value,
+                                                        keys[i],
+                                                        false));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCERN: TYPE TRAITS
+        //
+        // Concerns:
+        // 1. `bdlcc::FlatCache` declares the `bslma::UsesBslmaAllocator`
+        //    trait.
+        //
+        // 2. Values and keys that allocate memory use the allocator of the
+        //    cache.
+        //
+        // Plan:
+        // 1. Assert the trait for a few instantiations.  (C-1)
+        //
+        // 2. Insert `bsl::string` keys and values too long for the small
+        //    string optimization, and verify that no memory is taken from the
+        //    default allocator.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: TYPE TRAITS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONCERN: TYPE TRAITS" << endl
+                                  << "====================" << endl;
+
+        ASSERT((bslma::UsesBslmaAllocator<Obj>::value));
+        ASSERT((bslma::UsesBslmaAllocator<
+                      bdlcc::FlatCache<bsl::string, bsl::string> >::value));
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        typedef bdlcc::FlatCache<bsl::string, bsl::string> StringCache;
+        {
+            StringCache mX(Policy::e_LRU, 2, 2, &ta);
+
+            const bsl::string K1("a key too long for the short buffer 1", &ta);
+            const bsl::string K2("a key too long for the short buffer 2", &ta);
+            const bsl::string K3("a key too long for the short buffer 3", &ta);
+            const bsl::string V("a value too long for the short buffer", &ta);
+
+            mX.insert(K1, V);
+            mX.insert(K2, V);
+            mX.insert(K3, V);       // evicts `K1`, relocating `K3`
+
+            bsl::string value(&ta);
+            ASSERT(1 == mX.tryGetValue(&value, K1));
+            ASSERT(0 == mX.tryGetValue(&value, K3));
+            ASSERT(V == value);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCERN: EXCEPTION SAFETY
+        //
+        // Concerns:
+        // 1. If an insertion throws, the cache is left in a consistent state,
+        //    and no memory is leaked.
+        //
+        // Plan:
+        // 1. Using the `BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*` macros, insert
+        //    items having allocating keys and values into a cache, and verify
+        //    that after each exception, every item visited can be looked up
+        //    and the size is consistent.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: EXCEPTION SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONCERN: EXCEPTION SAFETY" << endl
+                                  << "=========================" << endl;
+
+        typedef bdlcc::FlatCache<bsl::string, bsl::string> StringCache;
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bslma::TestAllocator ta("object",  veryVeryVeryVerbose);
+
+        const char *KEYS[] = {
+            "first key, too long for the short string buffer",
+            "second key, too long for the short string buffer",
+            "third key, too long for the short string buffer",
+            "fourth key, too long for the short string buffer",
+            "fifth key, too long for the short string buffer"
+        };
+        const int NUM_KEYS = static_cast<int>(sizeof KEYS / sizeof *KEYS);
+
+        {
+            StringCache mX(Policy::e_LRU, 3, 3, &ta);
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                const bsl::string KEY(KEYS[i], &sa);
+                const bsl::string VALUE(KEYS[NUM_KEYS - 1 - i], &sa);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                    mX.insert(KEY, VALUE);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                bsl::vector<bsl::string> keys(&sa);
+                StringKeyVisitor         visitor = { &keys };
+                mX.visit(visitor);
+
+                ASSERTV(i, keys.size(), mX.size(), keys.size() == mX.size());
+                for (bsl::size_t j = 0; j < keys.size(); ++j) {
+                    bsl::string value(&sa);
+                    ASSERTV(i, j, 0 == mX.tryGetValue(&value, keys[j], false));
+                }
+
+                bsl::string value(&sa);
+                ASSERTV(i, 0 == mX.tryGetValue(&value, KEY, false));
+                ASSERTV(i, VALUE == value);
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // BULK OPERATIONS, `reserve`, AND THE POST-EVICTION CALLBACK
+        //
+        // Concerns:
+        // 1. `insertBulk` inserts or replaces every item, and returns the
+        //    number of new items.
+        //
+        // 2. `eraseBulk` removes every item present, and returns their
+        //    number.
+        //
+        // 3. The post-eviction callback is invoked for every item evicted or
+        //    removed (but not cleared) with the value of that item.
+        //
+        // 4. After `reserve(n)`, inserting up to `n` items allocates no
+        //    memory.
+        //
+        // Plan:
+        // 1. Exercise the bulk operations and verify the return values and
+        //    the contents of the cache.  (C-1..2)
+        //
+        // 2. Install a callback counting and summing the evicted values, and
+        //    verify its state after evictions, `erase`, `popFront`, and
+        //    `clear`.  (C-3)
+        //
+        // 3. Reserve capacity, then insert items and verify, using a
+        //    `bslma::TestAllocatorMonitor`, that no allocation occurs.  (C-4)
+        //
+        // Testing:
+        //   int insertBulk(INPUT_ITERATOR begin, INPUT_ITERATOR end);
+        //   int insertBulk(const bsl::vector<KVType>& data);
+        //   int eraseBulk(INPUT_ITERATOR begin, INPUT_ITERATOR end);
+        //   int eraseBulk(const bsl::vector<KEY>& keys);
+        //   void reserve(bsl::size_t numItems);
+        //   void setPostEvictionCallback(postEvictionCallback);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BULK OPERATIONS, `reserve`, AND THE CALLBACK"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\nBulk operations." << endl;
+        {
+            Obj mX(Policy::e_FIFO, 100, 100, &ta);  const Obj& X = mX;
+
+            bsl::vector<Obj::KVType> data(&ta);
+            for (int i = 0; i < 10; ++i) {
+                data.push_back(Obj::KVType(i, i * 10));
+            }
+            ASSERT(10 == mX.insertBulk(data));
+            ASSERT(10 == X.size());
+
+            data.clear();
+            data.push_back(Obj::KVType(5, 55));
+            data.push_back(Obj::KVType(20, 200));
+            ASSERT(1 == mX.insertBulk(data.begin(), data.end()));
+            ASSERT(11 == X.size());
+
+            int value;
+            ASSERT(0 == mX.tryGetValue(&value, 5));
+            ASSERTV(value, 55 == value);
+
+            bsl::vector<int> keys(&ta);
+            keys.push_back(0);
+            keys.push_back(5);
+            keys.push_back(99);
+            keys.push_back(20);
+            ASSERT(3 == mX.eraseBulk(keys));
+            ASSERT(8 == X.size());
+            ASSERT(0 == mX.eraseBulk(keys.begin(), keys.begin() + 1));
+
+            keys.clear();
+            keys.push_back(1);
+            keys.push_back(2);
+            ASSERT(2 == mX.eraseBulk(keys.begin(), keys.end()));
+            ASSERT(6 == X.size());
+        }
+
+        if (verbose) cout << "\nPost-eviction callback." << endl;
+        {
+            Obj mX(Policy::e_LRU, 3, 5, &ta);  const Obj& X = mX;
+
+            evictionCount = 0;
+            evictionSum   = 0;
+            mX.setPostEvictionCallback(&countingCallback);
+
+            for (int i = 1; i <= 5; ++i) {
+                mX.insert(i, i);
+            }
+            ASSERT(0 == evictionCount);
+
+            mX.insert(6, 6);    // evicts 1, 2, and 3
+            ASSERTV(evictionCount, 3 == evictionCount);
+            ASSERTV(evictionSum,   6 == evictionSum);
+            ASSERT(3 == X.size());
+
+            ASSERT(0 == mX.erase(5));
+            ASSERT(1 == mX.erase(5));
+            ASSERT(0 == mX.popFront());     // removes 4
+            ASSERTV(evictionCount, 5  == evictionCount);
+            ASSERTV(evictionSum,   15 == evictionSum);
+
+            mX.clear();
+            ASSERT(0 == X.size());
+            ASSERTV(evictionCount, 5 == evictionCount);
+        }
+
+        if (verbose) cout << "\n`reserve`." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            mX.reserve(1000);
+
+            bslma::TestAllocatorMonitor tam(&ta);
+
+            for (int i = 0; i < 1000; ++i) {
+                mX.insert(i, i);
+            }
+            for (int i = 0; i < 1000; i += 2) {
+                ASSERT(0 == mX.erase(i));
+            }
+            for (int i = 1000; i < 1500; ++i) {
+                mX.insert(i, i);
+            }
+            ASSERT(1000 == X.size());
+            ASSERT(tam.isTotalSame());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: BEHAVES AS `bdlcc::Cache`
+        //
+        // Concerns:
+        // 1. For the LRU and FIFO eviction policies, any sequence of
+        //    operations leaves a `bdlcc::FlatCache` holding the same items,
+        //    in the same eviction order, as a `bdlcc::Cache`.
+        //
+        // 2. Relocating the last entry of the arrays when an item is removed
+        //    preserves the eviction order and the association between keys
+        //    and values, including when the relocated entry is the head or
+        //    the tail of the eviction queue.
+        //
+        // Plan:
+        // 1. For each eviction policy and a few watermark configurations,
+        //    apply the same long pseudo-random sequence of `insert`,
+        //    `tryGetValue` (with and without `modifyEvictionQueue`), `erase`,
+        //    `popFront`, and occasional `clear` to a `bdlcc::FlatCache` and a
+        //    `bdlcc::Cache`, comparing the results of each operation, and the
+        //    items visited in both caches at regular intervals.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: BEHAVES AS `bdlcc::Cache`
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONCERN: BEHAVES AS `bdlcc::Cache`"
+                          << endl << "=================================="
+                          << endl;
+
+        typedef bdlcc::Cache<int, int> Oracle;
+
+        static const struct {
+            int d_line;
+            int d_low;
+            int d_high;
+            int d_numKeys;
+        } DATA[] = {
+            //LINE  LOW  HIGH  KEYS
+            //----  ---  ----  ----
+            { L_,     1,    1,    4 },
+            { L_,     3,    5,    8 },
+            { L_,    10,   10,   16 },
+            { L_,    20,   40,  100 },
+            { L_,   100,  200,  150 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        const Policy::Enum POLICIES[] = { Policy::e_LRU, Policy::e_FIFO };
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        for (int p = 0; p < 2; ++p) {
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE     = DATA[ti].d_line;
+                const int LOW      = DATA[ti].d_low;
+                const int HIGH     = DATA[ti].d_high;
+                const int NUM_KEYS = DATA[ti].d_numKeys;
+
+                Obj    mX(POLICIES[p], LOW, HIGH, &ta);  const Obj& X = mX;
+                Oracle mY(POLICIES[p], LOW, HIGH, &ta);
+
+                bsl::vector<int> xKeys(&ta), xValues(&ta);
+                bsl::vector<int> yKeys(&ta), yValues(&ta);
+
+                unsigned int state = 17u * (ti + 1) + p;
+
+                for (int i = 0; i < 20000; ++i) {
+                    const int op  = nextRandom(&state) % 100;
+                    const int key = nextRandom(&state) % NUM_KEYS;
+
+                    if (op < 40) {
+                        mX.insert(key, i);
+                        mY.insert(key, i);
+                    }
+                    else if (op < 70) {
+                        const bool modify = op < 60;
+
+                        int                     xValue = -1;
+                        bsl::shared_ptr<int>    yValue;
+                        const int xRc = mX.tryGetValue(&xValue, key, modify);
+                        const int yRc = mY.tryGetValue(&yValue, key, modify);
+                        ASSERTV(LINE, p, i, xRc, yRc, xRc == yRc);
+                        if (0 == xRc && 0 == yRc) {
+                            ASSERTV(LINE, p, i, xValue, *yValue,
+                                    xValue == *yValue);
+                        }
+                    }
+                    else if (op < 90) {
+                        ASSERTV(LINE, p, i, mY.erase(key) == mX.erase(key));
+                    }
+                    else if (op < 99) {
+                        ASSERTV(LINE, p, i, mY.popFront() == mX.popFront());
+                    }
+                    else if (0 == i % 7) {
+                        mX.clear();
+                        mY.clear();
+                    }
+
+                    if (0 == i % 97) {
+                        collect(&xKeys, &xValues, X);
+
+                        yKeys.clear();
+                        yValues.clear();
+                        CollectVisitor<int> visitor = {
+                                        &yKeys, &yValues, ~bsl::size_t(0) };
+                        mY.visit(visitor);
+
+                        ASSERTV(LINE, p, i, X.size(), mY.size(),
+                                X.size() == mY.size());
+                        ASSERTV(LINE, p, i, xKeys == yKeys);
+                        ASSERTV(LINE, p, i, xValues == yValues);
+                    }
+                }
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // BASIC MANIPULATORS
+        //
+        // Concerns:
+        // 1. `insert` adds new items at the back of the eviction queue, and
+        //    replaces the value of existing items, moving them to the back.
+        //
+        // 2. `tryGetValue` loads the value of existing keys, returns 1 for
+        //    missing keys, and, for LRU only and only if
+        //    `modifyEvictionQueue` is `true`, moves the item to the back of
+        //    the eviction queue.
+        //
+        // 3. Eviction starts when `size() >= highWatermark()` on insertion,
+        //    and stops when `size() < lowWatermark()`.
+        //
+        // 4. `erase`, `popFront`, and `clear` remove the expected items and
+        //    return the expected status.
+        //
+        // 5. `visit` visits the items in eviction order, and stops when the
+        //    visitor returns `false`.
+        //
+        // 6. Moving a value into the cache leaves it in a valid state.
+        //
+        // 7. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Perform sequences of operations on LRU and FIFO caches, and
+        //    verify the eviction order using `visit`.  (C-1..6)
+        //
+        // 2. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   void insert(const KEY& key, const VALUE& value);
+        //   void insert(const KEY& key, MovableRef<VALUE> value);
+        //   int tryGetValue(VALUE *value, key, modifyEvictionQueue);
+        //   int erase(const KEY& key);
+        //   int popFront();
+        //   void clear();
+        //   bsl::size_t size() const;
+        //   void visit(VISITOR& visitor) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BASIC MANIPULATORS" << endl
+                                  << "==================" << endl;
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bslma::TestAllocator ta("object",  veryVeryVeryVerbose);
+
+        bsl::vector<int> keys(&sa);
+        bsl::vector<int> values(&sa);
+
+        if (verbose) cout << "\nLRU." << endl;
+        {
+            Obj mX(Policy::e_LRU, 4, 4, &ta);  const Obj& X = mX;
+
+            for (int i = 0; i < 4; ++i) {
+                mX.insert(i, i * 10);
+            }
+            ASSERT(4 == X.size());
+
+            int value = -1;
+            ASSERT(0 == mX.tryGetValue(&value, 0));         // 1 2 3 0
+            ASSERTV(value, 0 == value);
+            ASSERT(0 == mX.tryGetValue(&value, 1, false));  // 1 2 3 0
+            ASSERTV(value, 10 == value);
+            ASSERT(1 == mX.tryGetValue(&value, 9));
+            ASSERTV(value, 10 == value);
+
+            mX.insert(2, 21);                               // 1 3 0 2
+            mX.insert(4, 40);                               // 3 0 2 4
+
+            collect(&keys, &values, X);
+            ASSERTV(keys.size(), 4 == keys.size());
+            ASSERT(3 == keys[0] && 30 == values[0]);
+            ASSERT(0 == keys[1] &&  0 == values[1]);
+            ASSERT(2 == keys[2] && 21 == values[2]);
+            ASSERT(4 == keys[3] && 40 == values[3]);
+
+            CollectVisitor<int> limited = { &keys, 0, 2 };
+            keys.clear();
+            mX.visit(limited);
+            ASSERTV(keys.size(), 2 == keys.size());
+
+            ASSERT(0 == mX.erase(0));                       // 3 2 4
+            ASSERT(1 == mX.erase(0));
+            ASSERT(0 == mX.popFront());                     // 2 4
+            ASSERT(2 == X.size());
+
+            int movedValue = 50;
+            mX.insert(5, bslmf::MovableRefUtil::move(movedValue));
+            ASSERT(0 == mX.tryGetValue(&value, 5));
+            ASSERTV(value, 50 == value);
+
+            collect(&keys, &values, X);
+            ASSERTV(keys.size(), 3 == keys.size());
+            ASSERT(2 == keys[0] && 4 == keys[1] && 5 == keys[2]);
+
+            mX.clear();
+            ASSERT(0 == X.size());
+            ASSERT(1 == mX.popFront());
+            ASSERT(1 == mX.tryGetValue(&value, 2));
+
+            mX.insert(7, 70);
+            ASSERT(0 == mX.tryGetValue(&value, 7));
+            ASSERTV(value, 70 == value);
+        }
+
+        if (verbose) cout << "\nFIFO and watermarks." << endl;
+        {
+            Obj mX(Policy::e_FIFO, 2, 4, &ta);  const Obj& X = mX;
+
+            for (int i = 0; i < 4; ++i) {
+                mX.insert(i, i);
+            }
+            int value;
+            ASSERT(0 == mX.tryGetValue(&value, 0));     // no effect in FIFO
+
+            mX.insert(4, 4);    // evicts 0, 1, 2 (size was 4, evict to < 2)
+            ASSERTV(X.size(), 2 == X.size());
+
+            collect(&keys, &values, X);
+            ASSERTV(keys.size(), 2 == keys.size());
+            ASSERT(3 == keys[0] && 4 == keys[1]);
+        }
+
+        if (verbose) cout << "\nNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&ta);
+
+            int value;
+            ASSERT_PASS(mX.tryGetValue(&value, 0));
+            ASSERT_FAIL(mX.tryGetValue(0, 0));
+
+            ASSERT_PASS(Obj(Policy::e_LRU,   1, 1, &ta));
+            ASSERT_PASS(Obj(Policy::e_FIFO,  1, 1, &ta));
+            ASSERT_FAIL(Obj(Policy::e_CLOCK, 1, 1, &ta));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND ACCESSORS
+        //
+        // Concerns:
+        // 1. Each constructor creates an empty cache having the specified
+        //    attributes (or the defaults).
+        //
+        // 2. The hash and equality functors supplied at construction are
+        //    used.
+        //
+        // 3. The object allocator is used, and the default allocator is used
+        //    when no allocator is supplied.
+        //
+        // 4. Constructing a cache allocates no memory.
+        //
+        // Plan:
+        // 1. Construct caches using each constructor, with and without an
+        //    allocator, and verify the accessors and the allocators used.
+        //    (C-1..4)
+        //
+        // Testing:
+        //   explicit FlatCache(bslma::Allocator *basicAllocator);
+        //   FlatCache(policy, lowWat, highWat, alloc);
+        //   FlatCache(policy, lowWat, highWat, hash, equal, alloc);
+        //   EQUAL equalFunction() const;
+        //   CacheEvictionPolicy::Enum evictionPolicy() const;
+        //   HASH hashFunction() const;
+        //   bsl::size_t highWatermark() const;
+        //   bsl::size_t lowWatermark() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CREATORS AND ACCESSORS" << endl
+                                  << "======================" << endl;
+
+        bslma::TestAllocator ta("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(Policy::e_LRU == X.evictionPolicy());
+            ASSERT(bsl::numeric_limits<bsl::size_t>::max() ==
+                                                          X.lowWatermark());
+            ASSERT(bsl::numeric_limits<bsl::size_t>::max() ==
+                                                         X.highWatermark());
+            ASSERT(0   == X.size());
+            ASSERT(&ta == X.allocator());
+            ASSERT(0   == ta.numBlocksTotal());
+
+            mX.insert(1, 1);
+            ASSERT(0 <  ta.numBlocksInUse());
+            ASSERT(0 == da.numBlocksTotal());
+        }
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(&da == X.allocator());
+            mX.insert(1, 1);
+            ASSERT(0 < da.numBlocksInUse());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+        {
+            Obj mX(Policy::e_FIFO, 10, 20, &ta);  const Obj& X = mX;
+
+            ASSERT(Policy::e_FIFO == X.evictionPolicy());
+            ASSERT(10             == X.lowWatermark());
+            ASSERT(20             == X.highWatermark());
+            ASSERT(&ta            == X.allocator());
+        }
+        {
+            typedef bdlcc::FlatCache<int, int, TestHash, TestEqual> TestObj;
+
+            TestObj mX(Policy::e_LRU, 5, 6, TestHash(7), TestEqual(9), &ta);
+            const TestObj& X = mX;
+
+            ASSERT(Policy::e_LRU == X.evictionPolicy());
+            ASSERT(5             == X.lowWatermark());
+            ASSERT(6             == X.highWatermark());
+            ASSERT(7             == X.hashFunction().offset());
+            ASSERT(9             == X.equalFunction().id());
+
+            mX.insert(3, 30);
+
+            int value;
+            ASSERT(0 == mX.tryGetValue(&value, 3));
+            ASSERT(30 == value);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == da.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Create a cache, insert, look up, and evict a few items.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        {
+            Obj mX(Policy::e_LRU, 2, 3, &ta);  const Obj& X = mX;
+
+            mX.insert(1, 10);
+            mX.insert(2, 20);
+            mX.insert(3, 30);
+            ASSERT(3 == X.size());
+
+            int value;
+            ASSERT(0 == mX.tryGetValue(&value, 1));
+            ASSERT(10 == value);
+
+            mX.insert(4, 40);   // evicts 2 and 3
+            ASSERT(2 == X.size());
+            ASSERT(1 == mX.tryGetValue(&value, 2));
+            ASSERT(1 == mX.tryGetValue(&value, 3));
+            ASSERT(0 == mX.tryGetValue(&value, 4));
+            ASSERT(40 == value);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: `bdlcc::Cache` VS. `bdlcc::FlatCache`
+        //   To provide control over the test, command line parameters are
+        //   used.
+        //   2nd parameter: number of items.
+        //   3rd parameter: number of lookups.
+        //
+        // Concerns:
+        // 1. Report the memory used per item, the number of allocations per
+        //    item, and the lookup throughput of `bdlcc::Cache` and
+        //    `bdlcc::FlatCache` with `int` keys and values.
+        //
+        // Plan:
+        // 1. Populate each cache, recording the memory in use, and then time
+        //    random lookups of keys, half of which are present.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: `bdlcc::Cache` VS. `bdlcc::FlatCache`
+        // --------------------------------------------------------------------
+
+        const int numItems = argc > 2 ? atoi(argv[2]) : 100000;
+        const int numReads = argc > 3 ? atoi(argv[3]) : 5000000;
+
+        bslma::TestAllocator ta("perf", false);
+
+        int                checksum = 0;
+        double             cacheNs, flatNs;
+        bsls::Types::Int64 cacheBytes, flatBytes, cacheBlocks, flatBlocks;
+        {
+            bdlcc::Cache<int, int> cache(Policy::e_LRU,
+                                         numItems * 2,
+                                         numItems * 2,
+                                         &ta);
+            for (int i = 0; i < numItems; ++i) {
+                cache.insert(i * 2, i);
+            }
+            cacheBytes  = ta.numBytesInUse();
+            cacheBlocks = ta.numBlocksInUse();
+
+            bsl::shared_ptr<int> value;
+            cacheNs = static_cast<double>(perf::timeReads(&cache,
+                                                          &value,
+                                                          numItems * 2,
+                                                          numReads,
+                                                          &checksum));
+        }
+        {
+            bdlcc::FlatCache<int, int> cache(Policy::e_LRU,
+                                             numItems * 2,
+                                             numItems * 2,
+                                             &ta);
+            for (int i = 0; i < numItems; ++i) {
+                cache.insert(i * 2, i);
+            }
+            flatBytes  = ta.numBytesInUse();
+            flatBlocks = ta.numBlocksInUse();
+
+            int value;
+            flatNs = static_cast<double>(perf::timeReads(&cache,
+                                                         &value,
+                                                         numItems * 2,
+                                                         numReads,
+                                                         &checksum));
+        }
+
+        cout << "items: " << numItems << ", lookups: " << numReads << endl
+             << "bdlcc::Cache     : "
+             << static_cast<double>(cacheBytes) / numItems << " bytes/item, "
+             << static_cast<double>(cacheBlocks) / numItems
+             << " blocks/item, "
+             << numReads / cacheNs * 1e3 << " Mops/s" << endl
+             << "bdlcc::FlatCache : "
+             << static_cast<double>(flatBytes) / numItems << " bytes/item, "
+             << static_cast<double>(flatBlocks) / numItems
+             << " blocks/item, "
+             << numReads / flatNs * 1e3 << " Mops/s" << endl;
+
+        if (veryVerbose) {
+            P(checksum);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    ASSERT(dam.isTotalSame());
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERT(gam.isTotalSame());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,148 @@
+// bdlcc_flathashmap.cpp                                              -*-C++-*-
+#include <bdlcc_flathashmap.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_flathashmap_cpp,"$Id$ $CSID$")
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+
+// IMPLEMENTATION NOTES
+// --------------------
+// Readers register in the counter, of the parity of the current epoch, of a
+// stripe selected by their thread identifier.  To reclaim retired objects,
+// the epoch is advanced, so that new readers register with the other parity,
+// and the counters of the previous parity are awaited to drop to zero.  At
+// that point, every reader that could have obtained a reference to a retired
+// object (i.e., every reader that entered before the objects were retired,
+// and therefore before the epoch was advanced) has left.
+//
+// A reader that loads the epoch, and then increments the counter of its
+// parity after the epoch was advanced (and possibly after the counters of
+// that parity were found to be zero), would escape the wait.  Therefore,
+// `enter` loads the epoch again after incrementing the counter, and retries
+// if it changed.  Since both the increment and the loads are sequentially
+// consistent, either the reclaiming thread observes the increment, or the
+// reader observes the new epoch.
+//
+// Each reclamation waits for the readers of the parity of the epoch being
+// left, so that when the epoch is next advanced (back to that parity), the
+// counters of the other parity only count readers that entered in the
+// current epoch.
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                       // ------------------------------
+                       // class FlatHashMap_EpochManager
+                       // ------------------------------
+
+// PRIVATE MANIPULATORS
+void FlatHashMap_EpochManager::reclaimImp()
+{
+    const unsigned int parity = (d_epoch.add(1) - 1) & 1;
+
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        while (0 != d_stripes[i].d_count[parity].load()) {
+            bslmt::ThreadUtil::yield();
+        }
+    }
+
+    for (bsl::size_t i = 0; i < d_retired.size(); ++i) {
+        const Retired& retired = d_retired[i];
+        retired.d_deleter(retired.d_object_p, retired.d_context_p);
+    }
+    d_retired.clear();
+}
+
+// CREATORS
+FlatHashMap_EpochManager::FlatHashMap_EpochManager(
+                                              bslma::Allocator *basicAllocator)
+: d_epoch(0)
+, d_mutex()
+, d_retired(basicAllocator)
+{
+    // Reserve the capacity needed between two reclamations, so that `retire`
+    // does not allocate, and therefore cannot fail, once the retired object
+    // has been removed from the map.
+
+    d_retired.reserve(k_RECLAIM_THRESHOLD);
+}
+
+FlatHashMap_EpochManager::~FlatHashMap_EpochManager()
+{
+    for (bsl::size_t i = 0; i < d_retired.size(); ++i) {
+        const Retired& retired = d_retired[i];
+        retired.d_deleter(retired.d_object_p, retired.d_context_p);
+    }
+}
+
+// MANIPULATORS
+int FlatHashMap_EpochManager::enter()
+{
+    // Select the stripe from the high-order bits of a multiplicative hash of
+    // the thread identifier, whose low-order bits are often all zero.
+
+    const int stripe = static_cast<int>(
+                        (bslmt::ThreadUtil::selfIdAsUint64() *
+                                                     0x9E3779B97F4A7C15ULL) >>
+                        (64 - k_LOG2_NUM_STRIPES));
+
+    bsls::AtomicInt64 *counts = d_stripes[stripe].d_count;
+
+    while (true) {
+        const unsigned int epoch  = d_epoch.load();
+        const int          parity = static_cast<int>(epoch & 1);
+
+        counts[parity].add(1);
+        if (d_epoch.load() == epoch) {
+            return stripe * 2 + parity;                               // RETURN
+        }
+        counts[parity].add(-1);
+    }
+}
+
+void FlatHashMap_EpochManager::reclaim()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    reclaimImp();
+}
+
+void FlatHashMap_EpochManager::retire(void    *object,
+                                      Deleter  deleter,
+                                      void    *context)
+{
+    BSLS_ASSERT(object);
+    BSLS_ASSERT(deleter);
+
+    Retired retired = { object, deleter, context };
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_retired.push_back(retired);
+
+    if (d_retired.size() >= k_RECLAIM_THRESHOLD) {
+        reclaimImp();
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1240 @@
+// bdlcc_flathashmap.h                                                -*-C++-*-
+#ifndef INCLUDED_BDLCC_FLATHASHMAP
+#define INCLUDED_BDLCC_FLATHASHMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a thread-safe open-addressing map with lock-free lookups.
+//
+//@CLASSES:
+//  bdlcc::FlatHashMap: thread-safe flat hash map with lock-free lookups
+//  bdlcc::FlatHashMap_EpochManager: deferred reclamation for `FlatHashMap`
+//
+//@SEE_ALSO: bdlc_flathashmap, bdlcc_stripedunorderedmap
+//
+//@DESCRIPTION: This component defines a single class template,
+// `bdlcc::FlatHashMap`, implementing a thread-safe, unordered associative
+// container of unique keys mapped to values, intended for *read-mostly*
+// tables (e.g., symbol or instrument tables) that are looked up from many
+// threads and modified comparatively rarely.  Lookups (`getValue`) neither
+// take a lock nor write to any shared memory location other than a
+// per-thread-stripe counter, so that they scale with the number of threads
+// reading the map.
+//
+// Like `bdlc::FlatHashMap`, the map is an open-addressing hash table whose
+// slots are arranged in groups described by the control values inquired by
+// `bdlc::FlatHashTable_GroupControl`: a lookup inspects the control values of
+// a whole group at once to find the candidate slots for a key.  Unlike
+// `bdlc::FlatHashMap`, each slot holds a pointer to an immutable, separately
+// allocated (key, value) node, so that the node can be replaced or removed
+// atomically while other threads read it.
+//
+///Lock-Free Lookups and Memory Reclamation
+///----------------------------------------
+// A lookup brackets its accesses to the table and to the nodes it contains
+// with an *epoch* (see `bdlcc::FlatHashMap_EpochManager`), without taking any
+// lock.  A writer that replaces or removes a node, or that replaces the whole
+// table when the map grows, does not free the memory immediately; it
+// *retires* it, and retired memory is reclaimed only after every lookup that
+// might still reference it has completed.  Reclamation is performed by
+// writers, in batches, and a writer performing it waits (without holding any
+// lock of the map) for the lookups in progress to complete.
+//
+// Because nodes are immutable, a value is never modified in place:
+// `insert` of an existing key allocates a new node and retires the old one.
+// `getValue` loads a copy of the value found.
+//
+///Writers and Locking
+///-------------------
+// Manipulators lock the *home group* of the key (i.e., the first group of its
+// probe sequence) with a spin lock, so that two threads modifying keys having
+// different home groups proceed concurrently.  A slot of another group is
+// claimed with an atomic compare-and-swap on its node pointer.  Because the
+// probe sequence of a key may compare the keys of nodes homed in other groups,
+// which the writers locking those groups may retire concurrently, a writer
+// also brackets its probe with an epoch, exactly like a lookup.  Growing the
+// table (which also removes the tombstones left by `erase`) is performed by a
+// single writer, excluding all other writers with a reader-writer lock that
+// writers otherwise hold in shared mode; lookups proceed on the previous table
+// while the new one is built.
+//
+///Thread Safety
+///-------------
+// `bdlcc::FlatHashMap` is fully thread-safe (see `bsldoc_glossary`), provided
+// that the allocator supplied at construction is fully thread-safe and that
+// the hash and equality functors are safe to invoke concurrently.  The
+// thread-safety of the container does not extend to thread-safety of the
+// contained objects.
+//
+// A lookup is *linearizable* with respect to modifications of the same key:
+// it reflects either the state before or the state after each concurrent
+// modification.  Accessors describing the map as a whole (`size`, `empty`,
+// `capacity`) return values that may be obsolete by the time they are
+// returned.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Shared Instrument Table
+/// - - - - - - - - - - - - - - - - - -
+// Suppose a trading system maps instrument identifiers to their tick sizes,
+// and every worker thread looks up instruments while a single thread
+// occasionally adds or updates instruments.
+//
+// First, we create a map and populate it:
+// ```
+// bdlcc::FlatHashMap<int, double> tickSizes(&talloc);
+//
+// assert(1 == tickSizes.insert(101, 0.01));
+// assert(1 == tickSizes.insert(102, 0.05));
+// assert(1 == tickSizes.insert(103, 0.25));
+// assert(3 == tickSizes.size());
+// ```
+// Then, any thread can look up a tick size without taking a lock:
+// ```
+// double tickSize;
+// assert(1    == tickSizes.getValue(&tickSize, 102));
+// assert(0.05 == tickSize);
+// assert(0    == tickSizes.getValue(&tickSize, 999));
+// ```
+// Next, the tick size of an instrument is updated; lookups concurrent with the
+// update see either the old or the new value:
+// ```
+// assert(0    == tickSizes.insert(102, 0.10));
+// assert(1    == tickSizes.getValue(&tickSize, 102));
+// assert(0.10 == tickSize);
+// ```
+// Finally, an instrument is removed:
+// ```
+// assert(1 == tickSizes.erase(101));
+// assert(0 == tickSizes.erase(101));
+// assert(0 == tickSizes.getValue(&tickSize, 101));
+// assert(2 == tickSizes.size());
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bdlc_flathashtable_groupcontrol.h>
+
+#include <bslh_fibonaccibadhashwrapper.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_deleterhelper.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_integralconstant.h>
+#include <bslmf_movableref.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+#include <bslmt_readerwritermutex.h>
+#include <bslmt_readlockguard.h>
+#include <bslmt_writelockguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_byteorder.h>
+#include <bsls_performancehint.h>
+#include <bsls_spinlock.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>
+#include <bsl_functional.h>
+#include <bsl_new.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                       // ==============================
+                       // class FlatHashMap_EpochManager
+                       // ==============================
+
+/// This component-private class implements epoch-based deferred
+/// reclamation.  Readers bracket their accesses to shared memory with
+/// `enter` and `leave`; writers `retire` memory they have made unreachable,
+/// and retired memory is destroyed only after every reader that entered
+/// before it was retired has left.  Readers never block; `retire` may wait
+/// for the readers in progress to leave.
+class FlatHashMap_EpochManager {
+
+  public:
+    // PUBLIC TYPES
+
+    /// Function destroying the specified `object`, using the specified
+    /// `context` supplied to `retire`.
+    typedef void (*Deleter)(void *object, void *context);
+
+  private:
+    // PRIVATE TYPES
+    /// A retired object and the means to destroy it.
+    struct Retired {
+        void    *d_object_p;   // retired object
+        Deleter  d_deleter;    // destroys `d_object_p`
+        void    *d_context_p;  // context for `d_deleter`
+    };
+
+    /// Reader counters of the two epoch parities, padded so that readers
+    /// using different stripes do not share a cache line.
+    struct Stripe {
+        bsls::AtomicInt64 d_count[2];
+        char              d_pad[bslmt::Platform::e_CACHE_LINE_SIZE];
+    };
+
+    enum {
+        k_NUM_STRIPES       = 16,  // number of reader stripes (power of 2)
+        k_LOG2_NUM_STRIPES  = 4,
+        k_RECLAIM_THRESHOLD = 64   // number of retired objects triggering a
+                                   // reclamation
+    };
+
+    // DATA
+    bsls::AtomicUint     d_epoch;                   // current epoch
+
+    Stripe               d_stripes[k_NUM_STRIPES];  // reader counters
+
+    mutable bslmt::Mutex d_mutex;                   // serializes `retire`
+                                                    // and `reclaim`
+
+    bsl::vector<Retired> d_retired;                 // objects awaiting
+                                                    // reclamation
+
+    // PRIVATE MANIPULATORS
+
+    /// Advance the epoch, wait until every reader that entered in the
+    /// previous epoch has left, and destroy all retired objects.  The
+    /// behavior is undefined unless `d_mutex` is locked by the calling
+    /// thread.
+    void reclaimImp();
+
+  private:
+    // NOT IMPLEMENTED
+    FlatHashMap_EpochManager(const FlatHashMap_EpochManager&);
+    FlatHashMap_EpochManager& operator=(const FlatHashMap_EpochManager&);
+
+  public:
+    // CREATORS
+
+    /// Create an epoch manager having no retired objects.  Optionally
+    /// specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.
+    explicit FlatHashMap_EpochManager(bslma::Allocator *basicAllocator = 0);
+
+    /// Destroy all retired objects and this epoch manager.  The behavior is
+    /// undefined unless no reader is between `enter` and `leave`.
+    ~FlatHashMap_EpochManager();
+
+    // MANIPULATORS
+
+    /// Register the calling thread as a reader of the current epoch, and
+    /// return a token to be supplied to `leave`.
+    int enter();
+
+    /// Unregister the reader identified by the specified `token` returned
+    /// by `enter`.
+    void leave(int token);
+
+    /// Destroy, after waiting for the readers in progress to leave, all
+    /// retired objects.
+    void reclaim();
+
+    /// Retire the specified `object`, to be destroyed by invoking the
+    /// specified `deleter` with `object` and the specified `context` once
+    /// no reader that entered before this call is in progress.  Note that
+    /// this method may destroy retired objects, and wait for readers in
+    /// progress to leave in order to do so.
+    void retire(void *object, Deleter deleter, void *context);
+
+    // ACCESSORS
+
+    /// Return the number of retired objects not yet destroyed.
+    bsl::size_t numRetired() const;
+};
+
+                        // ============================
+                        // class FlatHashMap_EpochGuard
+                        // ============================
+
+/// This component-private class is a guard that registers the calling
+/// thread as a reader of an epoch manager for its lifetime.
+class FlatHashMap_EpochGuard {
+
+    // DATA
+    FlatHashMap_EpochManager *d_manager_p;  // epoch manager
+    int                       d_token;      // token returned by `enter`
+
+  private:
+    // NOT IMPLEMENTED
+    FlatHashMap_EpochGuard(const FlatHashMap_EpochGuard&);
+    FlatHashMap_EpochGuard& operator=(const FlatHashMap_EpochGuard&);
+
+  public:
+    // CREATORS
+
+    /// Create a guard registering the calling thread as a reader of the
+    /// specified `manager`.
+    explicit FlatHashMap_EpochGuard(FlatHashMap_EpochManager *manager);
+
+    /// Unregister the calling thread from the epoch manager of this guard,
+    /// and destroy this guard.
+    ~FlatHashMap_EpochGuard();
+};
+
+                             // =================
+                             // class FlatHashMap
+                             // =================
+
+/// This class template provides a thread-safe open-addressing hash map of
+/// unique `KEY` objects to `VALUE` objects, whose lookups take no lock.
+/// `KEY` and `VALUE` must be copy-constructible, and `HASH` and `EQUAL`
+/// must be copy-constructible functors safe to invoke concurrently.
+template <class KEY,
+          class VALUE,
+          class HASH  = bslh::FibonacciBadHashWrapper<bsl::hash<KEY> >,
+          class EQUAL = bsl::equal_to<KEY> >
+class FlatHashMap {
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::pair<KEY, VALUE> KVType;
+
+  private:
+    // PRIVATE TYPES
+    typedef bdlc::FlatHashTable_GroupControl GroupControl;
+    typedef FlatHashMap_EpochManager         EpochManager;
+    typedef FlatHashMap_EpochGuard           EpochGuard;
+    typedef KVType                           Node;
+    typedef bsls::AtomicPointer<Node>        AtomicNodePtr;
+
+    /// This `struct` holds the arrays of a table.  Control values are
+    /// stored 8 to an atomic 64-bit word, the control value of slot `i`
+    /// occupying bits `8 * (i % 8)` to `8 * (i % 8) + 7` of word `i / 8`.
+    struct Table {
+        bsl::size_t                d_capacity;     // number of slots
+        int                        d_groupShift;   // hash shift giving the
+                                                   // home group
+        bsls::AtomicUint64        *d_controls_p;   // control values
+        bsls::AtomicPointer<Node> *d_slots_p;      // node of each slot
+        bsls::SpinLock            *d_locks_p;      // lock of each group
+    };
+
+    // PRIVATE CLASS DATA
+    static const bsl::size_t  k_MIN_CAPACITY = 2 * GroupControl::k_SIZE;
+    static const bsl::uint8_t k_HASHLET_MASK = 0x7f;
+
+    // The maximum fraction of slots, in use or erased, of a table is
+    // `k_MAX_LOAD_NUMERATOR / k_MAX_LOAD_DENOMINATOR`.
+
+    static const bsl::size_t  k_MAX_LOAD_NUMERATOR   = 7;
+    static const bsl::size_t  k_MAX_LOAD_DENOMINATOR = 8;
+
+    // DATA
+    bslma::Allocator           *d_allocator_p;    // memory allocator (held)
+
+    HASH                        d_hasher;         // hash functor
+
+    EQUAL                       d_equal;          // equality functor
+
+    bsls::AtomicPointer<Table>  d_table_p;        // current table
+
+    bsls::AtomicInt64           d_size;           // number of keys
+
+    bsls::AtomicInt64           d_numOccupied;    // number of slots in use
+                                                  // or erased
+
+    bslmt::ReaderWriterMutex    d_resizeLock;     // held in shared mode by
+                                                  // writers, and exclusively
+                                                  // to replace the table
+
+    mutable EpochManager        d_epochManager;   // reclamation of nodes
+                                                  // and tables
+
+    // PRIVATE CLASS METHODS
+
+    /// Return the smallest valid table capacity that is at least the
+    /// specified `minCapacity`.
+    static bsl::size_t adjustedCapacity(bsl::size_t minCapacity);
+
+    /// Create and return a table having the specified `capacity` empty
+    /// slots, using the specified `allocator` to supply memory.
+    static Table *createTable(bsl::size_t       capacity,
+                              bslma::Allocator *allocator);
+
+    /// Destroy the specified `table`, which must be a `Table *`, using the
+    /// specified `allocator`, which must be a `bslma::Allocator *`.
+    static void deleteTable(void *table, void *allocator);
+
+    /// Destroy the specified `table`, which must be a `Table *`, and every
+    /// node it refers to, using the specified `allocator`, which must be a
+    /// `bslma::Allocator *`.
+    static void deleteTableAndNodes(void *table, void *allocator);
+
+    /// Destroy the specified `node`, which must be a `Node *`, using the
+    /// specified `allocator`, which must be a `bslma::Allocator *`.
+    static void deleteNode(void *node, void *allocator);
+
+    /// Load into the specified `controls` the `GroupControl::k_SIZE`
+    /// control values of the group having the specified `groupIndex` in the
+    /// specified `table`.
+    static void loadGroup(bsl::uint8_t *controls,
+                          const Table&  table,
+                          bsl::size_t   groupIndex);
+
+    /// Return the maximum number of slots in use or erased in the specified
+    /// `table`.
+    static bsl::size_t maxOccupied(const Table& table);
+
+    /// Set the control value of the slot having the specified `index` in
+    /// the specified `table` to the specified `value`.
+    static void setControl(Table        *table,
+                           bsl::size_t   index,
+                           bsl::uint8_t  value);
+
+    // PRIVATE MANIPULATORS
+
+    /// Claim an available slot for the specified `node`, whose key has the
+    /// specified `hashValue`, in the specified `table`, and make `node`
+    /// visible to lookups.  Return `true` on success, and `false` if no
+    /// slot is available.  The behavior is undefined unless `d_resizeLock`
+    /// is held in shared mode and the home group of `node` is locked.
+    bool claimSlot(Table *table, Node *node, bsl::size_t hashValue);
+
+    /// Create and return a node holding the specified `key` and `value`.
+    /// If the specified `moveValue` is `true`, `value` is moved into the
+    /// node, and copied otherwise.
+    Node *createNode(const KEY& key, VALUE *value, bool moveValue);
+
+    /// Replace the table of this map with a table having a capacity
+    /// sufficient for `size() + 1` keys and no erased slots, unless another
+    /// thread already did so.  The behavior is undefined unless
+    /// `d_resizeLock` is not held by the calling thread.
+    void grow();
+
+    /// Insert the specified `node`, having the specified `hashValue`,
+    /// into this map, or replace the node of the same key by `node`.
+    /// Return 1 if `node` was inserted, and 0 if it replaced another node.
+    bsl::size_t insertNode(Node *node, bsl::size_t hashValue);
+
+    /// Replace the table of this map with one having at least the specified
+    /// `minCapacity` slots.  The behavior is undefined unless
+    /// `d_resizeLock` is held exclusively by the calling thread.
+    void rehashRaw(bsl::size_t minCapacity);
+
+    // PRIVATE ACCESSORS
+
+    /// Return the node of the specified `table` holding the specified
+    /// `key`, having the specified `hashValue`, and load the index of its
+    /// slot into the specified `index`, or return 0 if `key` is not present.
+    Node *findNode(bsl::size_t  *index,
+                   const Table&  table,
+                   const KEY&    key,
+                   bsl::size_t   hashValue) const;
+
+  private:
+    // NOT IMPLEMENTED
+    FlatHashMap(const FlatHashMap&);
+    FlatHashMap& operator=(const FlatHashMap&);
+
+  public:
+    // CREATORS
+
+    /// Create an empty map.  Optionally specify a `basicAllocator` used to
+    /// supply memory.  If `basicAllocator` is 0, the currently installed
+    /// default allocator is used.
+    explicit FlatHashMap(bslma::Allocator *basicAllocator = 0);
+
+    /// Create an empty map having a capacity of at least the specified
+    /// `capacity` slots.  Optionally specify a `hashFunction` and an
+    /// `equalFunction`.  Optionally specify a `basicAllocator` used to
+    /// supply memory.  If `basicAllocator` is 0, the currently installed
+    /// default allocator is used.
+    explicit FlatHashMap(bsl::size_t       capacity,
+                         bslma::Allocator *basicAllocator = 0);
+    FlatHashMap(bsl::size_t       capacity,
+                const HASH&       hashFunction,
+                bslma::Allocator *basicAllocator = 0);
+    FlatHashMap(bsl::size_t       capacity,
+                const HASH&       hashFunction,
+                const EQUAL&      equalFunction,
+                bslma::Allocator *basicAllocator = 0);
+
+    /// Destroy this map.  The behavior is undefined unless no other thread
+    /// is accessing this map.
+    ~FlatHashMap();
+
+    // MANIPULATORS
+
+    /// Remove all elements from this map.  Lookups concurrent with `clear`
+    /// may observe elements removed by `clear`.
+    void clear();
+
+    /// Remove from this map the element having the specified `key`.  Return
+    /// 1 if an element was removed, and 0 if `key` was not present.
+    bsl::size_t erase(const KEY& key);
+
+    /// Insert into this map an element having the specified `key` and
+    /// `value`, or, if `key` is present, replace its value by `value`.
+    /// Return 1 if an element was inserted, and 0 if a value was replaced.
+    bsl::size_t insert(const KEY& key, const VALUE& value);
+
+    /// Insert into this map an element having the specified `key` and the
+    /// specified move-insertable `value`, or, if `key` is present, replace
+    /// its value by `value`.  Return 1 if an element was inserted, and 0 if
+    /// a value was replaced.  `value` is left in a valid but unspecified
+    /// state.
+    bsl::size_t insert(const KEY& key, bslmf::MovableRef<VALUE> value);
+
+    /// Destroy, after waiting for the lookups in progress to complete, the
+    /// nodes and tables removed from this map and not yet destroyed.  Note
+    /// that memory removed from the map is otherwise reclaimed in batches.
+    void reclaim();
+
+    /// Change the capacity of this map, if needed, so that at least the
+    /// specified `numElements` elements can be held without growing.
+    void reserve(bsl::size_t numElements);
+
+    // ACCESSORS
+
+    /// Return the number of slots of the table of this map.
+    bsl::size_t capacity() const;
+
+    /// Return `true` if this map contains no elements, and `false`
+    /// otherwise.
+    bool empty() const;
+
+    /// Return (a copy of) the key-equality functor used by this map.
+    EQUAL equalFunction() const;
+
+    /// Load, into the specified `value`, the value of the element of this
+    /// map having the specified `key`.  Return 1 on success, and 0 if `key`
+    /// is not present.  This method takes no lock.
+    bsl::size_t getValue(VALUE *value, const KEY& key) const;
+
+    /// Return (a copy of) the hash functor used by this map.
+    HASH hashFunction() const;
+
+    /// Return the number of elements in this map.
+    bsl::size_t size() const;
+
+                               // Aspects
+
+    /// Return the allocator used by this map to supply memory.
+    bslma::Allocator *allocator() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                       // ------------------------------
+                       // class FlatHashMap_EpochManager
+                       // ------------------------------
+
+// MANIPULATORS
+inline
+void FlatHashMap_EpochManager::leave(int token)
+{
+    d_stripes[token >> 1].d_count[token & 1].addAcqRel(-1);
+}
+
+// ACCESSORS
+inline
+bsl::size_t FlatHashMap_EpochManager::numRetired() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_retired.size();
+}
+
+                        // ----------------------------
+                        // class FlatHashMap_EpochGuard
+                        // ----------------------------
+
+// CREATORS
+inline
+FlatHashMap_EpochGuard::FlatHashMap_EpochGuard(
+                                             FlatHashMap_EpochManager *manager)
+: d_manager_p(manager)
+, d_token(manager->enter())
+{
+}
+
+inline
+FlatHashMap_EpochGuard::~FlatHashMap_EpochGuard()
+{
+    d_manager_p->leave(d_token);
+}
+
+                             // -----------------
+                             // class FlatHashMap
+                             // -----------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::adjustedCapacity(
+                                                       bsl::size_t minCapacity)
+{
+    bsl::size_t capacity = k_MIN_CAPACITY;
+    while (capacity < minCapacity) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::Table *
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::createTable(bsl::size_t       capacity,
+                                                  bslma::Allocator *allocator)
+{
+    BSLS_ASSERT(k_MIN_CAPACITY <= capacity);
+    BSLS_ASSERT(0 == (capacity & (capacity - 1)));
+
+    const bsl::size_t numGroups = capacity / GroupControl::k_SIZE;
+    const bsl::size_t numWords  = capacity / 8;
+
+    // The table and its arrays are allocated as a single block.  Each array
+    // of the block is suitably aligned, since the sizes of the preceding
+    // arrays are multiples of 8 bytes.
+
+    const bsl::size_t tableSize   = (sizeof(Table) + 7) & ~bsl::size_t(7);
+    const bsl::size_t controlSize = numWords * sizeof(bsls::AtomicUint64);
+    const bsl::size_t slotSize    = capacity * sizeof(AtomicNodePtr);
+    const bsl::size_t lockSize    = numGroups * sizeof(bsls::SpinLock);
+    const bsl::size_t blockSize   = tableSize + controlSize + slotSize +
+                                                                      lockSize;
+
+    char *block = static_cast<char *>(allocator->allocate(blockSize));
+
+    Table *table = new (block) Table();
+
+    table->d_capacity   = capacity;
+    table->d_groupShift = static_cast<int>(
+                               sizeof(bsl::size_t) * 8
+                             - bdlb::BitUtil::log2(
+                                   static_cast<bsl::uint64_t>(numGroups)));
+
+    table->d_controls_p = reinterpret_cast<bsls::AtomicUint64 *>(
+                                                            block + tableSize);
+    table->d_slots_p    = reinterpret_cast<bsls::AtomicPointer<Node> *>(
+                                              block + tableSize + controlSize);
+    table->d_locks_p    = reinterpret_cast<bsls::SpinLock *>(
+                                   block + tableSize + controlSize + slotSize);
+
+    const bsl::uint64_t k_ALL_EMPTY = 0x0101010101010101ull *
+                                                         GroupControl::k_EMPTY;
+
+    for (bsl::size_t i = 0; i < numWords; ++i) {
+        new (table->d_controls_p + i) bsls::AtomicUint64(k_ALL_EMPTY);
+    }
+    for (bsl::size_t i = 0; i < capacity; ++i) {
+        new (table->d_slots_p + i) bsls::AtomicPointer<Node>(0);
+    }
+    for (bsl::size_t i = 0; i < numGroups; ++i) {
+        new (table->d_locks_p + i) bsls::SpinLock();
+    }
+
+    return table;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::deleteTable(void *table,
+                                                       void *allocator)
+{
+    // The atomic types and `bsls::SpinLock` are trivially destructible.
+
+    static_cast<bslma::Allocator *>(allocator)->deallocate(table);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::deleteTableAndNodes(
+                                                               void *table,
+                                                               void *allocator)
+{
+    Table *t = static_cast<Table *>(table);
+
+    for (bsl::size_t i = 0; i < t->d_capacity; ++i) {
+        Node *node = t->d_slots_p[i].loadRelaxed();
+        if (node) {
+            deleteNode(node, allocator);
+        }
+    }
+    deleteTable(table, allocator);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::deleteNode(void *node,
+                                                      void *allocator)
+{
+    bslma::Allocator *alloc = static_cast<bslma::Allocator *>(allocator);
+
+    bslma::DeleterHelper::deleteObject(static_cast<Node *>(node), alloc);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::loadGroup(
+                                                bsl::uint8_t *controls,
+                                                const Table&  table,
+                                                bsl::size_t   groupIndex)
+{
+    const bsl::size_t         k_NUM_WORDS = GroupControl::k_SIZE / 8;
+    const bsls::AtomicUint64 *words       = table.d_controls_p +
+                                                     groupIndex * k_NUM_WORDS;
+
+    for (bsl::size_t i = 0; i < k_NUM_WORDS; ++i) {
+        const bsl::uint64_t word = BSLS_BYTEORDER_HOST_U64_TO_LE(
+                                                       words[i].loadAcquire());
+        bsl::memcpy(controls + 8 * i, &word, 8);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::maxOccupied(
+                                                            const Table& table)
+{
+    return table.d_capacity / k_MAX_LOAD_DENOMINATOR * k_MAX_LOAD_NUMERATOR;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::setControl(Table        *table,
+                                                      bsl::size_t   index,
+                                                      bsl::uint8_t  value)
+{
+    // Other bytes of the word may be concurrently modified by writers owning
+    // other slots, hence the compare-and-swap loop.
+
+    bsls::AtomicUint64& word  = table->d_controls_p[index / 8];
+    const int           shift = static_cast<int>(index % 8) * 8;
+    const bsl::uint64_t mask  = bsl::uint64_t(0xff) << shift;
+    const bsl::uint64_t bits  = bsl::uint64_t(value) << shift;
+
+    bsl::uint64_t current = word.loadRelaxed();
+    while (true) {
+        const bsl::uint64_t previous = word.testAndSwapAcqRel(
+                                                  current,
+                                                  (current & ~mask) | bits);
+        if (previous == current) {
+            return;                                                   // RETURN
+        }
+        current = previous;
+    }
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool FlatHashMap<KEY, VALUE, HASH, EQUAL>::claimSlot(Table       *table,
+                                                     Node        *node,
+                                                     bsl::size_t  hashValue)
+{
+    const bsl::size_t  numGroups = table->d_capacity / GroupControl::k_SIZE;
+    const bsl::uint8_t hashlet   = static_cast<bsl::uint8_t>(
+                                                  hashValue & k_HASHLET_MASK);
+
+    bsl::size_t group = hashValue >> table->d_groupShift;
+
+    for (bsl::size_t n = 0; n < numGroups; ++n) {
+        bsl::uint8_t controls[GroupControl::k_SIZE];
+        loadGroup(controls, *table, group);
+
+        bsl::uint32_t available = GroupControl(controls).available();
+        while (available) {
+            const int         offset = bdlb::BitUtil::numTrailingUnsetBits(
+                                                                   available);
+            const bsl::size_t index  = group * GroupControl::k_SIZE + offset;
+
+            // A slot is owned by the writer that installs a node in it.  A
+            // slot that is available per its control value may still hold
+            // the node of an `erase` in progress, and a slot whose node was
+            // just installed by another writer may still appear available.
+
+            if (0 == table->d_slots_p[index].testAndSwap(0, node)) {
+                if (GroupControl::k_EMPTY == controls[offset]) {
+                    ++d_numOccupied;
+                }
+                setControl(table, index, hashlet);
+                return true;                                          // RETURN
+            }
+            available = bdlb::BitUtil::withBitCleared(available, offset);
+        }
+
+        group = (group + 1) & (numGroups - 1);
+    }
+    return false;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::Node *
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::createNode(const KEY&  key,
+                                                 VALUE      *value,
+                                                 bool        moveValue)
+{
+    Node *node = static_cast<Node *>(d_allocator_p->allocate(sizeof(Node)));
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(node, d_allocator_p);
+
+    if (moveValue) {
+        bslma::ConstructionUtil::construct(
+                                          node,
+                                          d_allocator_p,
+                                          key,
+                                          bslmf::MovableRefUtil::move(*value));
+    }
+    else {
+        bslma::ConstructionUtil::construct(node,
+                                           d_allocator_p,
+                                           key,
+                                           *value);
+    }
+
+    proctor.release();
+
+    return node;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::grow()
+{
+    Table *previous;
+    {
+        bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> guard(&d_resizeLock);
+
+        previous = d_table_p.loadRelaxed();
+        if (static_cast<bsl::size_t>(d_numOccupied.loadRelaxed()) <
+                                                      maxOccupied(*previous)) {
+            return;                                                   // RETURN
+        }
+
+        // Size the new table so that it is at most half full, which also
+        // discards the erased slots.
+
+        bsl::size_t capacity = previous->d_capacity;
+        while ((static_cast<bsl::size_t>(d_size.loadRelaxed()) + 1) * 2 >
+                                                  capacity /
+                                                  k_MAX_LOAD_DENOMINATOR *
+                                                  k_MAX_LOAD_NUMERATOR) {
+            capacity *= 2;
+        }
+        rehashRaw(capacity);
+    }
+    d_epochManager.retire(previous, &deleteTable, d_allocator_p);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::insertNode(
+                                                        Node        *node,
+                                                        bsl::size_t  hashValue)
+{
+    while (true) {
+        Node *replaced = 0;
+        {
+            bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(
+                                                               &d_resizeLock);
+
+            Table *table = d_table_p.loadRelaxed();
+
+            if (static_cast<bsl::size_t>(d_numOccupied.loadRelaxed()) <
+                                                         maxOccupied(*table)) {
+                bsls::SpinLockGuard groupGuard(
+                        table->d_locks_p + (hashValue >> table->d_groupShift));
+
+                // `findNode` may compare keys of nodes homed in other groups,
+                // which their writers may erase and retire concurrently.
+
+                EpochGuard epochGuard(&d_epochManager);
+
+                bsl::size_t index;
+                replaced = findNode(&index, *table, node->first, hashValue);
+                if (replaced) {
+                    table->d_slots_p[index].storeRelease(node);
+                }
+                else if (claimSlot(table, node, hashValue)) {
+                    ++d_size;
+                    return 1;                                         // RETURN
+                }
+            }
+        }
+
+        if (replaced) {
+            d_epochManager.retire(replaced, &deleteNode, d_allocator_p);
+            return 0;                                                 // RETURN
+        }
+
+        grow();
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::rehashRaw(bsl::size_t minCapacity)
+{
+    const bsl::size_t capacity = adjustedCapacity(minCapacity);
+
+    Table *previous = d_table_p.loadRelaxed();
+    Table *table    = createTable(capacity, d_allocator_p);
+
+    // No other writer is active, so the new table is populated without
+    // synchronization; lookups use `previous` until `table` is published.
+
+    const bsl::size_t mask = capacity - 1;
+
+    for (bsl::size_t i = 0; i < previous->d_capacity; ++i) {
+        Node *node = previous->d_slots_p[i].loadRelaxed();
+        if (!node) {
+            continue;                                               // CONTINUE
+        }
+
+        const bsl::size_t hashValue = d_hasher(node->first);
+
+        // Occupy the first free slot from the start of the home group, so
+        // that every group preceding it in the probe sequence is full.
+
+        bsl::size_t index = (hashValue >> table->d_groupShift) *
+                                                          GroupControl::k_SIZE;
+        while (table->d_slots_p[index].loadRelaxed()) {
+            index = (index + 1) & mask;
+        }
+
+        table->d_slots_p[index].storeRelaxed(node);
+        setControl(table,
+                   index,
+                   static_cast<bsl::uint8_t>(hashValue & k_HASHLET_MASK));
+    }
+
+    d_numOccupied.storeRelaxed(d_size.loadRelaxed());
+    d_table_p.storeRelease(table);
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::Node *
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::findNode(bsl::size_t  *index,
+                                               const Table&  table,
+                                               const KEY&    key,
+                                               bsl::size_t   hashValue) const
+{
+    const bsl::size_t  numGroups = table.d_capacity / GroupControl::k_SIZE;
+    const bsl::uint8_t hashlet   = static_cast<bsl::uint8_t>(
+                                                  hashValue & k_HASHLET_MASK);
+
+    bsl::size_t group = hashValue >> table.d_groupShift;
+
+    for (bsl::size_t n = 0; n < numGroups; ++n) {
+        bsl::uint8_t controls[GroupControl::k_SIZE];
+        loadGroup(controls, table, group);
+
+        GroupControl  groupControl(controls);
+        bsl::uint32_t candidates = groupControl.match(hashlet);
+        while (candidates) {
+            const int         offset = bdlb::BitUtil::numTrailingUnsetBits(
+                                                                  candidates);
+            const bsl::size_t slot   = group * GroupControl::k_SIZE + offset;
+
+            Node *node = table.d_slots_p[slot].loadAcquire();
+            if (node && BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                                  d_equal(node->first, key))) {
+                *index = slot;
+                return node;                                          // RETURN
+            }
+            candidates = bdlb::BitUtil::withBitCleared(candidates, offset);
+        }
+
+        // A group that was never full terminates every probe sequence
+        // passing through it, since slots are never returned to the empty
+        // state (except by replacing the table).
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(groupControl.neverFull())) {
+            break;
+        }
+
+        group = (group + 1) & (numGroups - 1);
+    }
+    return 0;
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_hasher()
+, d_equal()
+, d_table_p(0)
+, d_size(0)
+, d_numOccupied(0)
+, d_resizeLock()
+, d_epochManager(d_allocator_p)
+{
+    d_table_p = createTable(k_MIN_CAPACITY, d_allocator_p);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bsl::size_t       capacity,
+                                              bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_hasher()
+, d_equal()
+, d_table_p(0)
+, d_size(0)
+, d_numOccupied(0)
+, d_resizeLock()
+, d_epochManager(d_allocator_p)
+{
+    d_table_p = createTable(adjustedCapacity(capacity), d_allocator_p);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bsl::size_t       capacity,
+                                              const HASH&       hashFunction,
+                                              bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_hasher(hashFunction)
+, d_equal()
+, d_table_p(0)
+, d_size(0)
+, d_numOccupied(0)
+, d_resizeLock()
+, d_epochManager(d_allocator_p)
+{
+    d_table_p = createTable(adjustedCapacity(capacity), d_allocator_p);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bsl::size_t       capacity,
+                                              const HASH&       hashFunction,
+                                              const EQUAL&      equalFunction,
+                                              bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_hasher(hashFunction)
+, d_equal(equalFunction)
+, d_table_p(0)
+, d_size(0)
+, d_numOccupied(0)
+, d_resizeLock()
+, d_epochManager(d_allocator_p)
+{
+    d_table_p = createTable(adjustedCapacity(capacity), d_allocator_p);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::~FlatHashMap()
+{
+    deleteTableAndNodes(d_table_p.loadRelaxed(), d_allocator_p);
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    Table *previous;
+    {
+        bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> guard(&d_resizeLock);
+
+        previous = d_table_p.loadRelaxed();
+
+        d_table_p.storeRelease(createTable(previous->d_capacity,
+                                           d_allocator_p));
+        d_size.storeRelaxed(0);
+        d_numOccupied.storeRelaxed(0);
+    }
+    d_epochManager.retire(previous, &deleteTableAndNodes, d_allocator_p);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    const bsl::size_t hashValue = d_hasher(key);
+
+    Node *node;
+    {
+        bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_resizeLock);
+
+        Table *table = d_table_p.loadRelaxed();
+
+        bsls::SpinLockGuard groupGuard(
+                        table->d_locks_p + (hashValue >> table->d_groupShift));
+
+        // `findNode` may compare keys of nodes homed in other groups, which
+        // their writers may erase and retire concurrently.
+
+        EpochGuard epochGuard(&d_epochManager);
+
+        bsl::size_t index;
+        node = findNode(&index, *table, key, hashValue);
+        if (!node) {
+            return 0;                                                 // RETURN
+        }
+
+        // Mark the slot erased before releasing it, so that a writer
+        // claiming it sets its control value after this one.
+
+        setControl(table, index, GroupControl::k_ERASED);
+        table->d_slots_p[index].storeRelease(0);
+        --d_size;
+    }
+    d_epochManager.retire(node, &deleteNode, d_allocator_p);
+
+    return 1;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(const KEY&   key,
+                                                         const VALUE& value)
+{
+    Node *node = createNode(key, const_cast<VALUE *>(&value), false);
+
+    return insertNode(node, d_hasher(node->first));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(
+                                               const KEY&                key,
+                                               bslmf::MovableRef<VALUE>  value)
+{
+    Node *node = createNode(key,
+                            &bslmf::MovableRefUtil::access(value),
+                            true);
+
+    return insertNode(node, d_hasher(node->first));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::reclaim()
+{
+    d_epochManager.reclaim();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::reserve(bsl::size_t numElements)
+{
+    Table *previous;
+    {
+        bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> guard(&d_resizeLock);
+
+        previous = d_table_p.loadRelaxed();
+        if (numElements < maxOccupied(*previous)) {
+            return;                                                   // RETURN
+        }
+
+        rehashRaw((numElements / k_MAX_LOAD_NUMERATOR + 1) *
+                                                      k_MAX_LOAD_DENOMINATOR);
+    }
+    d_epochManager.retire(previous, &deleteTable, d_allocator_p);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::capacity() const
+{
+    EpochGuard guard(&d_epochManager);
+
+    return d_table_p.loadAcquire()->d_capacity;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool FlatHashMap<KEY, VALUE, HASH, EQUAL>::empty() const
+{
+    return 0 == d_size.loadRelaxed();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL FlatHashMap<KEY, VALUE, HASH, EQUAL>::equalFunction() const
+{
+    return d_equal;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::getValue(
+                                                        VALUE      *value,
+                                                        const KEY&  key) const
+{
+    BSLS_ASSERT(value);
+
+    const bsl::size_t hashValue = d_hasher(key);
+
+    EpochGuard guard(&d_epochManager);
+
+    const Table *table = d_table_p.loadAcquire();
+
+    bsl::size_t index;
+    const Node *node = findNode(&index, *table, key, hashValue);
+    if (!node) {
+        return 0;                                                     // RETURN
+    }
+
+    *value = node->second;
+    return 1;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH FlatHashMap<KEY, VALUE, HASH, EQUAL>::hashFunction() const
+{
+    return d_hasher;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    return static_cast<bsl::size_t>(d_size.loadRelaxed());
+}
+
+                               // Aspects
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bslma::Allocator *FlatHashMap<KEY, VALUE, HASH, EQUAL>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+
+// TRAITS
+
+namespace bslma {
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+struct UsesBslmaAllocator<bdlcc::FlatHashMap<KEY, VALUE, HASH, EQUAL> >
+    : bsl::true_type
+{
+};
+
+}  // close namespace bslma
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1304 @@
+// bdlcc_flathashmap.t.cpp                                            -*-C++-*-
+
+#include <bdlcc_flathashmap.h>
+
+#include <bdlcc_stripedunorderedmap.h>
+
+#include <bdlf_bind.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+#include <bslmt_timedcompletionguard.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_review.h>
+#include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_format.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a thread-safe hash map,
+// `bdlcc::FlatHashMap`, whose lookups take no lock, and the epoch manager,
+// `bdlcc::FlatHashMap_EpochManager`, deferring the destruction of the memory
+// the map removes until no lookup can reference it.  We first verify the
+// epoch manager directly, including that reclamation waits for a reader that
+// entered before the memory was retired.  The single-threaded behavior of the
+// map is then verified against `bsl::unordered_map` as an oracle for long
+// random sequences of operations, which exercise growth and the reuse of
+// erased slots.  Finally, a stress test verifies that lookups concurrent with
+// insertions, updates, and removals never observe a value of another key.
+// ----------------------------------------------------------------------------
+// FlatHashMap_EpochManager
+// [ 2] explicit FlatHashMap_EpochManager(bslma::Allocator *basicAllocator);
+// [ 2] ~FlatHashMap_EpochManager();
+// [ 2] int enter();
+// [ 2] void leave(int token);
+// [ 2] void reclaim();
+// [ 2] void retire(void *object, Deleter deleter, void *context);
+// [ 2] bsl::size_t numRetired() const;
+//
+// FlatHashMap
+// [ 3] explicit FlatHashMap(bslma::Allocator *basicAllocator);
+// [ 3] explicit FlatHashMap(bsl::size_t capacity, *basicAllocator);
+// [ 3] FlatHashMap(capacity, hashFunction, *basicAllocator);
+// [ 3] FlatHashMap(capacity, hashFunction, equalFunction, *basicAllocator);
+// [ 3] ~FlatHashMap();
+// [ 4] void clear();
+// [ 4] bsl::size_t erase(const KEY& key);
+// [ 4] bsl::size_t insert(const KEY& key, const VALUE& value);
+// [ 4] bsl::size_t insert(const KEY& key, MovableRef<VALUE> value);
+// [ 4] void reclaim();
+// [ 5] void reserve(bsl::size_t numElements);
+// [ 3] bsl::size_t capacity() const;
+// [ 4] bool empty() const;
+// [ 3] EQUAL equalFunction() const;
+// [ 4] bsl::size_t getValue(VALUE *value, const KEY& key) const;
+// [ 3] HASH hashFunction() const;
+// [ 4] bsl::size_t size() const;
+// [ 3] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] CONCERN: THREAD SAFETY
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: LOOKUP THROUGHPUT VS. `bdlcc::StripedUnorderedMap`
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+
+typedef bdlcc::FlatHashMap<int, int>    Obj;
+typedef bdlcc::FlatHashMap_EpochManager EpochManager;
+
+// ============================================================================
+//                       HELPER CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// Hash functor returning a multiple of the key offset by `d_offset`, so that
+/// distinct functor objects can be distinguished.  If `d_bad` is `true`,
+/// every key hashes to one of only 4 values, so that long probe sequences
+/// are exercised.
+class TestHash {
+
+    int  d_offset;
+    bool d_bad;
+
+  public:
+    explicit TestHash(int offset = 0, bool bad = false)
+    : d_offset(offset)
+    , d_bad(bad)
+    {
+    }
+
+    bsl::size_t operator()(int key) const
+    {
+        if (d_bad) {
+            key &= 3;
+        }
+        return static_cast<bsl::size_t>(key + d_offset) *
+                                                     0x9E3779B97F4A7C15ULL;
+    }
+
+    int offset() const
+    {
+        return d_offset;
+    }
+};
+
+/// Equality functor that can be distinguished by its `d_id`.
+class TestEqual {
+
+    int d_id;
+
+  public:
+    explicit TestEqual(int id = 0)
+    : d_id(id)
+    {
+    }
+
+    bool operator()(int lhs, int rhs) const
+    {
+        return lhs == rhs;
+    }
+
+    int id() const
+    {
+        return d_id;
+    }
+};
+
+/// Deleter incrementing the `bsls::AtomicInt` supplied as `context`.
+void countingDeleter(void *, void *context)
+{
+    ++*static_cast<bsls::AtomicInt *>(context);
+}
+
+/// Return the next value of the specified linear congruential generator
+/// `state`, in the range `[0 .. 2^24)`.
+int nextRandom(unsigned int *state)
+{
+    *state = *state * 1103515245u + 12345u;
+    return static_cast<int>((*state >> 8) & 0xffffff);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                          MULTI-THREADED TESTING
+// ----------------------------------------------------------------------------
+
+namespace threaded {
+
+/// Values stored for a key `k` are `k | (version << 20)`, so that a reader
+/// can verify that a value found belongs to the key looked up.
+const int k_KEY_MASK = 0xfffff;
+
+struct ReaderArg {
+    bsls::AtomicInt *d_entered_p;
+    bsls::AtomicInt *d_leave_p;
+    EpochManager    *d_manager_p;
+};
+
+/// Enter an epoch of the epoch manager of the specified `v_arg`, and leave
+/// it once requested.
+extern "C" void *epochReaderThread(void *v_arg)
+{
+    ReaderArg *arg = static_cast<ReaderArg *>(v_arg);
+
+    const int token = arg->d_manager_p->enter();
+    *arg->d_entered_p = 1;
+    while (0 == *arg->d_leave_p) {
+        bslmt::ThreadUtil::yield();
+    }
+    arg->d_manager_p->leave(token);
+    return v_arg;
+}
+
+struct ThreadArg {
+    bdlcc::FlatHashMap<int, int, TestHash> *d_map_p;
+    bsls::AtomicInt                        *d_stop_p;
+    int                                     d_numKeys;
+    int                                     d_threadId;
+    bsls::Types::Int64                      d_numFound;
+};
+
+/// Look up random keys in the map of the specified `v_arg`, verifying every
+/// value found, until requested to stop.
+extern "C" void *readerThread(void *v_arg)
+{
+    ThreadArg    *arg   = static_cast<ThreadArg *>(v_arg);
+    unsigned int  state = 7919u * (arg->d_threadId + 1);
+
+    while (0 == *arg->d_stop_p) {
+        for (int i = 0; i < 256; ++i) {
+            const int key = nextRandom(&state) % arg->d_numKeys;
+
+            int value;
+            if (arg->d_map_p->getValue(&value, key)) {
+                ASSERTV(key, value, key == (value & k_KEY_MASK));
+                ++arg->d_numFound;
+            }
+        }
+    }
+    return v_arg;
+}
+
+/// Insert, update, and erase random keys in the map of the specified
+/// `v_arg` until requested to stop.
+extern "C" void *writerThread(void *v_arg)
+{
+    ThreadArg    *arg     = static_cast<ThreadArg *>(v_arg);
+    unsigned int  state   = 104729u * (arg->d_threadId + 1);
+    int           version = 0;
+
+    while (0 == *arg->d_stop_p) {
+        const int key = nextRandom(&state) % arg->d_numKeys;
+        const int op  = nextRandom(&state) % 4;
+
+        version = (version + 1) & 0x3ff;
+        if (op < 3) {
+            arg->d_map_p->insert(key, key | (version << 20));
+        }
+        else {
+            arg->d_map_p->erase(key);
+        }
+    }
+    return v_arg;
+}
+
+}  // close namespace threaded
+
+// ============================================================================
+//                          PERFORMANCE TESTING
+// ----------------------------------------------------------------------------
+
+namespace perf {
+
+template <class MAP>
+struct ReaderArg {
+    MAP                *d_map_p;
+    bslmt::Barrier     *d_barrier_p;
+    int                 d_numKeys;
+    int                 d_numReads;
+    int                 d_threadId;
+    bsls::Types::Int64  d_numFound;
+};
+
+/// Functor looking up random keys in the map of a `ReaderArg<MAP>`, after
+/// waiting on its barrier.
+template <class MAP>
+struct Reader {
+    ReaderArg<MAP> *d_arg_p;
+
+    void operator()() const
+    {
+        ReaderArg<MAP> *arg   = d_arg_p;
+        unsigned int    state = 31337u * (arg->d_threadId + 1);
+
+        arg->d_barrier_p->wait();
+
+        for (int i = 0; i < arg->d_numReads; ++i) {
+            int value;
+            arg->d_numFound += arg->d_map_p->getValue(
+                                         &value,
+                                         nextRandom(&state) % arg->d_numKeys);
+        }
+    }
+};
+
+/// Return the number of lookups per microsecond achieved by the specified
+/// `numThreads` threads each looking up the specified `numReads` random
+/// keys in `[0 .. 2 * numKeys)` in the specified `map`, holding `numKeys`
+/// keys.  Use the specified `allocator` to supply memory.
+template <class MAP>
+double lookupThroughput(MAP              *map,
+                        int               numKeys,
+                        int               numReads,
+                        int               numThreads,
+                        bslma::Allocator *allocator)
+{
+    bslmt::Barrier                         barrier(numThreads + 1);
+    bsl::vector<ReaderArg<MAP> >           args(numThreads, allocator);
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads, allocator);
+
+    for (int i = 0; i < numThreads; ++i) {
+        ReaderArg<MAP> arg = { map, &barrier, 2 * numKeys, numReads, i, 0 };
+        args[i] = arg;
+
+        Reader<MAP> reader = { &args[i] };
+        bslmt::ThreadUtil::createWithAllocator(&handles[i], reader, allocator);
+    }
+
+    barrier.wait();
+    const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+    const bsls::Types::Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+
+    return static_cast<double>(numReads) * numThreads /
+                                         (static_cast<double>(elapsed) / 1e3);
+}
+
+}  // close namespace perf
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+void example1(bslma::Allocator *allocator)
+{
+    bslma::Allocator& talloc = *allocator;
+
+///Example 1: A Shared Instrument Table
+/// - - - - - - - - - - - - - - - - - -
+// Suppose a trading system maps instrument identifiers to their tick sizes,
+// and every worker thread looks up instruments while a single thread
+// occasionally adds or updates instruments.
+//
+// First, we create a map and populate it:
+// ```
+    bdlcc::FlatHashMap<int, double> tickSizes(&talloc);
+
+    ASSERT(1 == tickSizes.insert(101, 0.01));
+    ASSERT(1 == tickSizes.insert(102, 0.05));
+    ASSERT(1 == tickSizes.insert(103, 0.25));
+    ASSERT(3 == tickSizes.size());
+// ```
+// Then, any thread can look up a tick size without taking a lock:
+// ```
+    double tickSize;
+    ASSERT(1    == tickSizes.getValue(&tickSize, 102));
+    ASSERT(0.05 == tickSize);
+    ASSERT(0    == tickSizes.getValue(&tickSize, 999));
+// ```
+// Next, the tick size of an instrument is updated; lookups concurrent with the
+// update see either the old or the new value:
+// ```
+    ASSERT(0    == tickSizes.insert(102, 0.10));
+    ASSERT(1    == tickSizes.getValue(&tickSize, 102));
+    ASSERT(0.10 == tickSize);
+// ```
+// Finally, an instrument is removed:
+// ```
+    ASSERT(1 == tickSizes.erase(101));
+    ASSERT(0 == tickSizes.erase(101));
+    ASSERT(0 == tickSizes.getValue(&tickSize, 101));
+    ASSERT(2 == tickSizes.size());
+// ```
+}
+
+}  // close namespace usage
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: `BSLS_REVIEW` failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+    bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+    bslma::TestAllocatorMonitor gam(&globalAllocator);
+
+    bslmt::TimedCompletionGuard completionGuard(&defaultAllocator);
+    ASSERT(0 == completionGuard.guard(bsls::TimeInterval(90, 0),
+                                      bsl::format("case {}", test)));
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+        bslma::TestAllocator ta("usage", veryVeryVeryVerbose);
+
+        usage::example1(&ta);
+
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCERN: THREAD SAFETY
+        //
+        // Concerns:
+        // 1. Lookups concurrent with insertions, updates, and removals of the
+        //    same keys, and with the growth of the table, never observe the
+        //    value of another key, nor memory already reclaimed.
+        //
+        // 2. Concurrent writers of keys having the same home group, or whose
+        //    probe sequences are long, do not lose or duplicate keys.
+        //
+        // 3. All memory is reclaimed when the map is destroyed.
+        //
+        // Plan:
+        // 1. Run reader threads looking up random keys, verifying that every
+        //    value found encodes the key looked up, concurrently with writer
+        //    threads inserting, updating, and erasing random keys, starting
+        //    from a minimal capacity so that the table grows.  (C-1)
+        //
+        // 2. Repeat P-1 with a hash functor mapping every key to one of 4
+        //    hash values.  After joining the threads, verify that `size`
+        //    matches the number of keys found.  (C-2)
+        //
+        // 3. Verify that the test allocator has no memory in use after the
+        //    map is destroyed.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: THREAD SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONCERN: THREAD SAFETY" << endl
+                                  << "======================" << endl;
+
+        typedef bdlcc::FlatHashMap<int, int, TestHash> Map;
+
+        const int k_NUM_READERS = 6;
+        const int k_NUM_WRITERS = 3;
+        const int k_NUM_THREADS = k_NUM_READERS + k_NUM_WRITERS;
+
+        bslma::TestAllocator ta("threaded", veryVeryVeryVerbose);
+
+        for (int bad = 0; bad < 2; ++bad) {
+            const int numKeys = bad ? 96 : 4096;
+            {
+                Map             mX(0, TestHash(0, bad), &ta);
+                bsls::AtomicInt stop(0);
+
+                bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+                threaded::ThreadArg       args[k_NUM_THREADS];
+
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    threaded::ThreadArg arg = { &mX, &stop, numKeys, i, 0 };
+                    args[i] = arg;
+                    ASSERT(0 == bslmt::ThreadUtil::create(
+                                               &handles[i],
+                                               i < k_NUM_READERS
+                                               ? threaded::readerThread
+                                               : threaded::writerThread,
+                                               &args[i]));
+                }
+
+                bslmt::ThreadUtil::microSleep(0, 1);
+                stop = 1;
+
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    bslmt::ThreadUtil::join(handles[i]);
+                }
+
+                bsls::Types::Int64 numFound = 0;
+                for (int i = 0; i < k_NUM_READERS; ++i) {
+                    numFound += args[i].d_numFound;
+                }
+                ASSERTV(bad, numFound, 0 < numFound);
+
+                bsl::size_t count = 0;
+                for (int key = 0; key < numKeys; ++key) {
+                    int value;
+                    if (mX.getValue(&value, key)) {
+                        ASSERTV(bad, key, value,
+                                key == (value & threaded::k_KEY_MASK));
+                        ++count;
+                    }
+                }
+                ASSERTV(bad, count, mX.size(), count == mX.size());
+
+                if (veryVerbose) {
+                    P_(bad) P_(numFound) P_(mX.size()) P(mX.capacity());
+                }
+            }
+            ASSERTV(bad, ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING `reserve`
+        //
+        // Concerns:
+        // 1. `reserve` increases the capacity so that the specified number of
+        //    elements can be inserted without further growth.
+        //
+        // 2. `reserve` of a number of elements that already fit does not
+        //    change the capacity, and does not allocate.
+        //
+        // 3. `reserve` preserves the elements of the map.
+        //
+        // Plan:
+        // 1. For a series of element counts, reserve, record the capacity,
+        //    insert as many elements, and verify that the capacity did not
+        //    change, and that all elements are found.  (C-1,3)
+        //
+        // 2. Reserve a smaller number of elements, and verify the capacity
+        //    and the allocator are unchanged.  (C-2)
+        //
+        // Testing:
+        //   void reserve(bsl::size_t numElements);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING `reserve`" << endl
+                                  << "=================" << endl;
+
+        const int COUNTS[] = { 0, 1, 27, 28, 29, 56, 57, 100, 1000, 5000 };
+        const int NUM_COUNTS = static_cast<int>(sizeof COUNTS /
+                                                sizeof *COUNTS);
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_COUNTS; ++ti) {
+            const int N = COUNTS[ti];
+            {
+                Obj mX(&ta);  const Obj& X = mX;
+
+                mX.insert(-1, -1);
+                mX.reserve(N);
+
+                const bsl::size_t capacity = X.capacity();
+                ASSERTV(N, capacity, static_cast<bsl::size_t>(N) <
+                                                         capacity / 8 * 7);
+                int value;
+                ASSERTV(N, 1 == X.getValue(&value, -1));
+                ASSERTV(N, -1 == value);
+
+                for (int i = 0; i < N; ++i) {
+                    mX.insert(i, i * 2);
+                }
+                ASSERTV(N, capacity, X.capacity(), capacity == X.capacity());
+                ASSERTV(N, X.size(), N + 1 == static_cast<int>(X.size()));
+                for (int i = 0; i < N; ++i) {
+                    ASSERTV(N, i, 1 == X.getValue(&value, i));
+                    ASSERTV(N, i, i * 2 == value);
+                }
+
+                bslma::TestAllocatorMonitor tam(&ta);
+
+                mX.reserve(N / 2);
+                ASSERTV(N, capacity == X.capacity());
+                ASSERTV(N, tam.isTotalSame());
+            }
+            ASSERTV(N, 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING BASIC MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        // 1. `insert` inserts a key not present and returns 1, and replaces
+        //    the value of a key present and returns 0.
+        //
+        // 2. `erase` removes a key present and returns 1, and returns 0 if the
+        //    key is not present.
+        //
+        // 3. `getValue` finds exactly the keys present, with their most
+        //    recent values, also after the table grows.
+        //
+        // 4. `clear` removes all elements and keeps the capacity.
+        //
+        // 5. Repeatedly inserting and erasing keys does not grow the table
+        //    without bound, although erased slots are not emptied.
+        //
+        // 6. Replaced and erased nodes are reclaimed in batches, or upon
+        //    `reclaim`, and no memory is leaked.
+        //
+        // 7. The moving overload of `insert` moves the value, and both
+        //    overloads support allocator-aware keys and values.
+        //
+        // Plan:
+        // 1. Insert, update, and erase a few keys, verifying the return
+        //    values, `size`, `empty`, and `getValue`.  (C-1..2)
+        //
+        // 2. Apply a long random sequence of operations on a small key space,
+        //    with a well-distributed and a poor hash functor, to both the map
+        //    and a `bsl::unordered_map`, verifying the return values, and
+        //    periodically verifying that every key of the key space is found
+        //    if and only if it is present in the oracle.  (C-1..3)
+        //
+        // 3. Insert and erase distinct keys many times, keeping the size
+        //    small, and verify the capacity stays bounded.  (C-5)
+        //
+        // 4. Verify `clear`, then that `reclaim` releases every retired
+        //    node, and that all memory is released on destruction.  (C-4,6)
+        //
+        // 5. Use a map of `bsl::string` to `bsl::string`, verifying the
+        //    allocators of the values and that a moved value is moved.  (C-7)
+        //
+        // Testing:
+        //   void clear();
+        //   bsl::size_t erase(const KEY& key);
+        //   bsl::size_t insert(const KEY& key, const VALUE& value);
+        //   bsl::size_t insert(const KEY& key, MovableRef<VALUE> value);
+        //   void reclaim();
+        //   bool empty() const;
+        //   bsl::size_t getValue(VALUE *value, const KEY& key) const;
+        //   bsl::size_t size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BASIC MANIPULATORS AND ACCESSORS" << endl
+                          << "========================================"
+                          << endl;
+
+        bslma::TestAllocator ta("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tDirect verification." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+
+            int value = -7;
+            ASSERT(0  == X.getValue(&value, 1));
+            ASSERT(-7 == value);
+
+            ASSERT(1 == mX.insert(1, 10));
+            ASSERT(1 == mX.insert(2, 20));
+            ASSERT(!X.empty());
+            ASSERT(2 == X.size());
+
+            ASSERT(1  == X.getValue(&value, 1));
+            ASSERT(10 == value);
+
+            ASSERT(0 == mX.insert(1, 11));
+            ASSERT(2 == X.size());
+            ASSERT(1  == X.getValue(&value, 1));
+            ASSERT(11 == value);
+
+            ASSERT(1 == mX.erase(2));
+            ASSERT(0 == mX.erase(2));
+            ASSERT(0 == X.getValue(&value, 2));
+            ASSERT(1 == X.size());
+
+            ASSERT(1 == mX.insert(2, 21));
+            ASSERT(1  == X.getValue(&value, 2));
+            ASSERT(21 == value);
+            ASSERT(2 == X.size());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tOracle verification." << endl;
+
+        for (int bad = 0; bad < 2; ++bad) {
+            typedef bdlcc::FlatHashMap<int, int, TestHash> Map;
+
+            const int k_NUM_KEYS = bad ? 64 : 2048;
+            const int k_NUM_OPS  = 100000;
+
+            {
+                Map                               mX(0, TestHash(0, bad), &ta);
+                const Map&                        X = mX;
+                bsl::unordered_map<int, int>      oracle(&sa);
+                unsigned int                      state = 12345u + bad;
+
+                for (int i = 0; i < k_NUM_OPS; ++i) {
+                    const int key = nextRandom(&state) % k_NUM_KEYS;
+                    const int op  = nextRandom(&state) % 8;
+
+                    if (op < 5) {
+                        const bool inserted = oracle.find(key) ==
+                                                                 oracle.end();
+                        oracle[key] = i;
+                        ASSERTV(bad, i, key,
+                                (inserted ? 1u : 0u) == mX.insert(key, i));
+                    }
+                    else if (op < 7) {
+                        const bsl::size_t erased = oracle.erase(key);
+                        ASSERTV(bad, i, key, erased == mX.erase(key));
+                    }
+                    else {
+                        int                                   value;
+                        bsl::unordered_map<int, int>::iterator it =
+                                                             oracle.find(key);
+                        if (it == oracle.end()) {
+                            ASSERTV(bad, i, key, 0 == X.getValue(&value, key));
+                        }
+                        else {
+                            ASSERTV(bad, i, key, 1 == X.getValue(&value, key));
+                            ASSERTV(bad, i, key, value, it->second == value);
+                        }
+                    }
+                    ASSERTV(bad, i, oracle.size() == X.size());
+
+                    if (0 == i % 10007) {
+                        for (int k = 0; k < k_NUM_KEYS; ++k) {
+                            int        value;
+                            const bool found = 1 == X.getValue(&value, k);
+                            ASSERTV(bad, i, k,
+                                    found == (oracle.find(k) != oracle.end()));
+                        }
+                    }
+                }
+
+                if (veryVerbose) {
+                    P_(bad) P_(X.size()) P(X.capacity());
+                }
+
+                // The table grows to hold at most half its maximum load
+                // factor, and erased slots are discarded when it grows.
+
+                ASSERTV(bad, X.capacity(),
+                        X.capacity() <= static_cast<bsl::size_t>(
+                                                              k_NUM_KEYS * 4));
+            }
+            ASSERTV(bad, 0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tChurn of distinct keys." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            for (int i = 0; i < 100000; ++i) {
+                ASSERTV(i, 1 == mX.insert(i, i));
+                if (i >= 10) {
+                    ASSERTV(i, 1 == mX.erase(i - 10));
+                }
+            }
+            ASSERT(10 == X.size());
+            ASSERTV(X.capacity(), 64 >= X.capacity());
+
+            for (int i = 0; i < 100000; ++i) {
+                int value;
+                ASSERTV(i, (i >= 100000 - 10) == (1 == X.getValue(&value, i)));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\t`clear` and `reclaim`." << endl;
+        {
+            Obj mX(1000, &ta);  const Obj& X = mX;
+
+            const bsl::size_t capacity = X.capacity();
+
+            for (int i = 0; i < 500; ++i) {
+                mX.insert(i, i);
+            }
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(capacity == X.capacity());
+
+            int value;
+            for (int i = 0; i < 500; ++i) {
+                ASSERTV(i, 0 == X.getValue(&value, i));
+            }
+
+            mX.reclaim();
+
+            // Only the table and the epoch manager's reserved array remain.
+
+            ASSERTV(ta.numBlocksInUse(), 2 == ta.numBlocksInUse());
+
+            mX.insert(1, 1);
+            mX.insert(1, 2);
+            ASSERTV(ta.numBlocksInUse(), 4 == ta.numBlocksInUse());
+            mX.reclaim();
+            ASSERTV(ta.numBlocksInUse(), 3 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tAllocator-aware types." << endl;
+        {
+            typedef bdlcc::FlatHashMap<bsl::string, bsl::string> Map;
+
+            const char *LONG = "a string long enough to allocate memory";
+
+            Map mX(&ta);  const Map& X = mX;
+
+            bsl::string value(LONG, &sa);
+            ASSERT(1 == mX.insert(bsl::string("key", &sa), value));
+            ASSERT(LONG == value);
+
+            bsl::string moved(LONG, &ta);
+            ASSERT(0 == mX.insert(bsl::string("key", &sa),
+                                  bslmf::MovableRefUtil::move(moved)));
+            ASSERT(moved.empty());
+
+            bsl::string result(&sa);
+            ASSERT(1 == X.getValue(&result, bsl::string("key", &sa)));
+            ASSERT(LONG == result);
+            ASSERT(&sa == result.get_allocator().mechanism());
+
+            for (int i = 0; i < 200; ++i) {
+                ASSERT(1 == mX.insert(bsl::string(LONG, &sa) +
+                                                       static_cast<char>(i),
+                                      value));
+            }
+            ASSERT(201 == X.size());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        // 1. The capacity is the smallest power of two, not less than twice
+        //    the group size, that is at least the requested capacity.
+        //
+        // 2. The supplied hash and equality functors, and allocator, are
+        //    used; the default allocator is used if none is supplied.
+        //
+        // 3. Memory is allocated from the object allocator only, and is
+        //    released upon destruction.
+        //
+        // Plan:
+        // 1. Create maps using each constructor with a table of requested
+        //    capacities, and verify the capacity, functors, and allocator.
+        //    (C-1..3)
+        //
+        // Testing:
+        //   explicit FlatHashMap(bslma::Allocator *basicAllocator);
+        //   explicit FlatHashMap(bsl::size_t capacity, *basicAllocator);
+        //   FlatHashMap(capacity, hashFunction, *basicAllocator);
+        //   FlatHashMap(capacity, hashFunction, equalFunction, *basicAlloc);
+        //   ~FlatHashMap();
+        //   bsl::size_t capacity() const;
+        //   EQUAL equalFunction() const;
+        //   HASH hashFunction() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CREATORS AND BASIC ACCESSORS" << endl
+                          << "====================================" << endl;
+
+        typedef bdlcc::FlatHashMap<int, int, TestHash, TestEqual> Map;
+
+        const bsl::size_t k_MIN = 2 * bdlc::FlatHashTable_GroupControl::k_SIZE;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(k_MIN == X.capacity());
+            ASSERT(&ta   == X.allocator());
+            ASSERT(0 < ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        {
+            bslma::TestAllocator         da("supplied", veryVeryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+            {
+                Obj mX;  const Obj& X = mX;
+
+                ASSERT(&da == X.allocator());
+                ASSERT(0 < da.numBlocksInUse());
+            }
+            ASSERT(0 == da.numBlocksInUse());
+        }
+
+        const struct {
+            int         d_line;
+            bsl::size_t d_requested;
+            bsl::size_t d_expected;
+        } DATA[] = {
+            { L_,        0,  k_MIN     },
+            { L_,        1,  k_MIN     },
+            { L_,    k_MIN,  k_MIN     },
+            { L_,  k_MIN+1,  k_MIN * 2 },
+            { L_,     1000,  1024      },
+            { L_,     1024,  1024      },
+            { L_,     1025,  2048      },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const bsl::size_t REQ  = DATA[ti].d_requested;
+            const bsl::size_t EXP  = DATA[ti].d_expected;
+
+            {
+                Obj mX(REQ, &ta);  const Obj& X = mX;
+
+                ASSERTV(LINE, X.capacity(), EXP == X.capacity());
+                ASSERTV(LINE, &ta == X.allocator());
+            }
+            {
+                Map mX(REQ, TestHash(5), &ta);  const Map& X = mX;
+
+                ASSERTV(LINE, EXP == X.capacity());
+                ASSERTV(LINE, 5   == X.hashFunction().offset());
+                ASSERTV(LINE, 0   == X.equalFunction().id());
+                ASSERTV(LINE, &ta == X.allocator());
+            }
+            {
+                Map mX(REQ, TestHash(6), TestEqual(7), &ta);
+                const Map& X = mX;
+
+                ASSERTV(LINE, EXP == X.capacity());
+                ASSERTV(LINE, 6   == X.hashFunction().offset());
+                ASSERTV(LINE, 7   == X.equalFunction().id());
+                ASSERTV(LINE, &ta == X.allocator());
+
+                mX.insert(1, 2);
+
+                int value;
+                ASSERTV(LINE, 1 == X.getValue(&value, 1));
+                ASSERTV(LINE, 2 == value);
+            }
+            ASSERTV(LINE, 0 == ta.numBlocksInUse());
+        }
+
+        ASSERT((bslma::UsesBslmaAllocator<Obj>::value));
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING `FlatHashMap_EpochManager`
+        //
+        // Concerns:
+        // 1. Retired objects are destroyed by `reclaim`, upon reaching the
+        //    reclamation threshold, and by the destructor, exactly once.
+        //
+        // 2. `reclaim` waits for readers that entered before the objects were
+        //    retired, and does not wait for readers entering later.
+        //
+        // 3. `enter` and `leave` may be nested and interleaved.
+        //
+        // Plan:
+        // 1. Retire objects with a counting deleter, and verify the counts
+        //    after `reclaim`, after reaching the threshold, and after
+        //    destruction.  (C-1)
+        //
+        // 2. Have a thread enter an epoch, retire an object, and start a
+        //    thread invoking `reclaim`.  Verify the object is not destroyed
+        //    until the reader leaves.  (C-2)
+        //
+        // 3. Enter twice, leave in reverse and in the same order, and verify
+        //    that `reclaim` returns.  (C-3)
+        //
+        // Testing:
+        //   explicit FlatHashMap_EpochManager(bslma::Allocator *);
+        //   ~FlatHashMap_EpochManager();
+        //   int enter();
+        //   void leave(int token);
+        //   void reclaim();
+        //   void retire(void *object, Deleter deleter, void *context);
+        //   bsl::size_t numRetired() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `FlatHashMap_EpochManager`" << endl
+                          << "==================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        int object;  // address used as the retired object
+
+        if (verbose) cout << "\tReclamation points." << endl;
+        {
+            bsls::AtomicInt count(0);
+            {
+                EpochManager mX(&ta);  const EpochManager& X = mX;
+
+                ASSERT(0 == X.numRetired());
+
+                mX.retire(&object, &countingDeleter, &count);
+                mX.retire(&object, &countingDeleter, &count);
+                ASSERT(2 == X.numRetired());
+                ASSERT(0 == count);
+
+                mX.reclaim();
+                ASSERT(0 == X.numRetired());
+                ASSERT(2 == count);
+
+                // Retiring objects until the threshold is reached destroys
+                // them all, without allocating.
+
+                bslma::TestAllocatorMonitor tam(&ta);
+
+                int n = 0;
+                do {
+                    mX.retire(&object, &countingDeleter, &count);
+                    ++n;
+                    ASSERTV(n, 2 == count || 0 == X.numRetired());
+                } while (0 != X.numRetired());
+
+                ASSERTV(n, 1 < n);
+                ASSERTV(n, count, n + 2 == count);
+                ASSERT(tam.isTotalSame());
+
+                mX.retire(&object, &countingDeleter, &count);
+                mX.retire(&object, &countingDeleter, &count);
+                ASSERT(2 == X.numRetired());
+                ASSERTV(n, count, n + 2 == count);
+            }
+            ASSERTV(count, 12 <= count);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tNested readers." << endl;
+        {
+            bsls::AtomicInt count(0);
+            EpochManager    mX(&ta);
+
+            const int t1 = mX.enter();
+            const int t2 = mX.enter();
+            mX.leave(t2);
+            mX.leave(t1);
+            const int t3 = mX.enter();
+            const int t4 = mX.enter();
+            mX.leave(t3);
+            mX.leave(t4);
+
+            mX.retire(&object, &countingDeleter, &count);
+            mX.reclaim();
+            mX.reclaim();
+            ASSERT(1 == count);
+        }
+
+        if (verbose) cout << "\tReclamation waits for readers." << endl;
+        {
+            bsls::AtomicInt count(0);
+            bsls::AtomicInt entered(0);
+            bsls::AtomicInt leave(0);
+            EpochManager    mX(&ta);
+
+            threaded::ReaderArg       arg = { &entered, &leave, &mX };
+            bslmt::ThreadUtil::Handle reader;
+
+            ASSERT(0 == bslmt::ThreadUtil::create(&reader,
+                                                  threaded::epochReaderThread,
+                                                  &arg));
+            while (0 == entered) {
+                bslmt::ThreadUtil::yield();
+            }
+
+            mX.retire(&object, &countingDeleter, &count);
+
+            // A reader entering after the retirement does not delay
+            // reclamation, but the reader thread does.
+
+            const int token = mX.enter();
+
+            bslmt::ThreadUtil::Handle reclaimer;
+            ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(
+                                  &reclaimer,
+                                  bdlf::BindUtil::bind(&EpochManager::reclaim,
+                                                       &mX),
+                                  &ta));
+
+            bslmt::ThreadUtil::microSleep(50000);
+            ASSERT(0 == count);
+
+            mX.leave(token);
+            bslmt::ThreadUtil::microSleep(50000);
+            ASSERT(0 == count);
+
+            leave = 1;
+            bslmt::ThreadUtil::join(reclaimer);
+            bslmt::ThreadUtil::join(reader);
+            ASSERT(1 == count);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Create a map, insert, look up, update, and erase a few keys, and
+        //    grow the table.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(1 == mX.insert(1, 10));
+            ASSERT(1 == mX.insert(2, 20));
+            ASSERT(0 == mX.insert(1, 11));
+            ASSERT(2 == X.size());
+
+            int value;
+            ASSERT(1  == X.getValue(&value, 1));
+            ASSERT(11 == value);
+
+            ASSERT(1 == mX.erase(1));
+            ASSERT(0 == X.getValue(&value, 1));
+
+            const bsl::size_t capacity = X.capacity();
+            for (int i = 0; i < 1000; ++i) {
+                mX.insert(i, i);
+            }
+            ASSERT(capacity < X.capacity());
+            ASSERT(1000 == X.size());
+            ASSERT(1   == X.getValue(&value, 999));
+            ASSERT(999 == value);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: LOOKUP THROUGHPUT VS. `bdlcc::StripedUnorderedMap`
+        //   To provide control over the test, command line parameters are
+        //   used.
+        //   2nd parameter: number of keys.
+        //   3rd parameter: number of lookups per thread.
+        //   4th parameter: maximum number of threads.
+        //
+        // Concerns:
+        // 1. Report the lookup throughput of `bdlcc::FlatHashMap` and
+        //    `bdlcc::StripedUnorderedMap` as the number of reading threads
+        //    increases.
+        //
+        // Plan:
+        // 1. Populate both maps with the same keys, and time random lookups,
+        //    half of which find a key, from 1, 2, 4, ... threads.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: LOOKUP THROUGHPUT VS. `bdlcc::StripedUnorderedMap`
+        // --------------------------------------------------------------------
+
+        const int numKeys    = argc > 2 ? atoi(argv[2]) : 100000;
+        const int numReads   = argc > 3 ? atoi(argv[3]) : 2000000;
+        const int maxThreads = argc > 4 ? atoi(argv[4]) : 8;
+
+        bslma::TestAllocator ta("perf", false);
+
+        bdlcc::FlatHashMap<int, int>         flat(&ta);
+        bdlcc::StripedUnorderedMap<int, int> striped(&ta);
+
+        for (int i = 0; i < numKeys; ++i) {
+            flat.insert(i, i);
+            striped.insert(i, i);
+        }
+
+        cout << "keys: " << numKeys << ", lookups/thread: " << numReads
+             << endl
+             << "threads  StripedUnorderedMap (Mops/s)  "
+             << "FlatHashMap (Mops/s)" << endl;
+
+        for (int numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+            const double stripedRate = perf::lookupThroughput(&striped,
+                                                              numKeys,
+                                                              numReads,
+                                                              numThreads,
+                                                              &ta);
+            const double flatRate    = perf::lookupThroughput(&flat,
+                                                              numKeys,
+                                                              numReads,
+                                                              numThreads,
+                                                              &ta);
+            cout << numThreads << "\t " << stripedRate << "\t\t\t\t"
+                 << flatRate << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    ASSERT(dam.isTotalSame());
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERT(gam.isTotalSame());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
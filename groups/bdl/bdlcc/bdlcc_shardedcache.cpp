@@ -0,0 +1,70 @@
+// bdlcc_shardedcache.cpp                                             -*-C++-*-
+#include <bdlcc_shardedcache.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_shardedcache_cpp,"$Id$ $CSID$")
+
+#include <bsls_assert.h>
+
+#include <bsl_limits.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                        // ------------------------
+                        // struct ShardedCache_Util
+                        // ------------------------
+
+// CLASS METHODS
+bsl::size_t ShardedCache_Util::adjustedNumShards(bsl::size_t numShards)
+{
+    bsl::size_t result = 1;
+    while (result < numShards) {
+        result <<= 1;
+    }
+    return result;
+}
+
+int ShardedCache_Util::log2(bsl::size_t powerOfTwo)
+{
+    BSLS_ASSERT(0 != powerOfTwo);
+    BSLS_ASSERT(0 == (powerOfTwo & (powerOfTwo - 1)));
+
+    int result = 0;
+    while (powerOfTwo > 1) {
+        powerOfTwo >>= 1;
+        ++result;
+    }
+    return result;
+}
+
+bsl::size_t ShardedCache_Util::shardWatermark(bsl::size_t watermark,
+                                              bsl::size_t numShards)
+{
+    BSLS_ASSERT(0 < numShards);
+
+    if (bsl::numeric_limits<bsl::size_t>::max() == watermark) {
+        return watermark;                                             // RETURN
+    }
+
+    return (watermark + numShards - 1) / numShards;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1074 @@
+// bdlcc_shardedcache.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLCC_SHARDEDCACHE
+#define INCLUDED_BDLCC_SHARDEDCACHE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a sharded in-process cache with per-shard eviction.
+//
+//@CLASSES:
+//  bdlcc::ShardedCache: in-process key-value cache partitioned into shards
+//
+//@SEE_ALSO: bdlcc_cache, bdlcc_stripedunorderedmap
+//
+//@DESCRIPTION: This component defines a single class template,
+// `bdlcc::ShardedCache`, implementing a thread-safe in-memory key-value cache
+// with a configurable eviction policy that is partitioned into a fixed number
+// of independent *shards*.  Each shard is a `bdlcc::Cache` having its own
+// hash table, eviction queue, and reader-writer lock, and each key is assigned
+// to exactly one shard based on its hash value.  Operations on keys that map
+// to different shards therefore do not contend on a common lock, allowing the
+// throughput of the cache to scale with the number of threads accessing it.
+//
+// `bdlcc::ShardedCache` uses the same template parameters as `bdlcc::Cache`:
+// the key type (`KEY`), the value type (`VALUE`), the optional hash function
+// (`HASH`), and the optional equal function (`EQUAL`), and provides the same
+// `insert`, `insertBulk`, `erase`, `eraseBulk`, `tryGetValue`, and `visit`
+// methods, so that a `bdlcc::Cache` can be replaced by a `bdlcc::ShardedCache`
+// with few or no changes to client code.
+//
+// The number of shards is supplied at construction and is rounded up to the
+// nearest power of two.  The specified hash function is applied once to each
+// key; the high-order bits of a multiplicative mix of that hash value select
+// the shard, leaving the low-order bits (used by the hash table within each
+// shard) uncorrelated with the shard index.
+//
+///Eviction
+///--------
+// The cache size is controlled by the same low watermark and high watermark
+// attributes as `bdlcc::Cache`.  The watermarks supplied at construction
+// describe the cache as a whole; each shard is configured with an equal share
+// of them (rounded up), and eviction is performed independently in each shard
+// when *that* shard reaches its share of the high watermark.  The total number
+// of items in a `bdlcc::ShardedCache` never exceeds the number of shards times
+// the per-shard high watermark, but because keys are not perfectly evenly
+// distributed among shards, eviction from one shard may begin before the
+// cache as a whole has reached its high watermark.
+//
+// The LRU and FIFO eviction policies are exact within a shard and therefore
+// *approximate* for the cache as a whole: the item evicted from a shard is the
+// least recently used (or first inserted) item of that shard, which is not
+// necessarily the least recently used (or first inserted) item of the cache.
+// For a reasonably uniform hash function and a cache much larger than the
+// number of shards, the difference is negligible in practice.
+//
+///Thread Safety
+///-------------
+// The `bdlcc::ShardedCache` class template is fully thread-safe (see
+// `bsldoc_glossary`) provided that the allocator supplied at construction and
+// the default allocator in effect during the lifetime of cached items are both
+// fully thread-safe.  The thread-safety of the container does not extend to
+// thread-safety of the contained objects.
+//
+///Thread Contention
+///-----------------
+// Each shard is protected by its own reader-writer lock, with the same locking
+// rules as `bdlcc::Cache` (in particular, `tryGetValue` on an LRU cache takes
+// the write lock of the shard containing the key).  Threads accessing keys
+// that map to different shards never block each other.  The shards are padded
+// so that the locks of adjacent shards do not share a cache line.
+//
+// Methods that operate on the cache as a whole (`clear`, `size`, `visit`,
+// `setPostEvictionCallback`, and the bulk methods) lock each shard in turn,
+// one at a time.  Such methods are therefore *not* atomic with respect to the
+// cache as a whole: e.g., the value returned by `size` is the sum of the sizes
+// of the shards, each observed at a slightly different time.
+//
+///Post-eviction Callback and Potential Deadlocks
+///---------------------------------------------
+// The post-eviction callback is invoked with the write lock of the shard from
+// which the item is being removed held.  As with `bdlcc::Cache`, the cache
+// object itself should not be used in a post-eviction callback; otherwise, a
+// deadlock may result.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Lookup-Heavy Quote Cache
+///- - - - - - - - - - - - - - - - - - -
+// Suppose a service caches the most recent quote of a large set of securities,
+// and the cache is read from many worker threads concurrently.  Using a single
+// `bdlcc::Cache` with the LRU policy, every lookup would take the same write
+// lock to update the eviction queue.  We use a `bdlcc::ShardedCache` instead.
+//
+// First, we define the value type stored in the cache:
+// ```
+// struct Quote {
+//     double d_bid;
+//     double d_ask;
+// };
+// ```
+// Then, we create a cache with 8 shards, using the LRU eviction policy, and
+// holding at most 800 items:
+// ```
+// bdlcc::ShardedCache<int, Quote> quoteCache(
+//                                       bdlcc::CacheEvictionPolicy::e_LRU,
+//                                       700,
+//                                       800,
+//                                       8,
+//                                       &talloc);
+// assert(8   == quoteCache.numShards());
+// assert(700 == quoteCache.lowWatermark());
+// assert(800 == quoteCache.highWatermark());
+// ```
+// Next, we populate the cache:
+// ```
+// for (int i = 0; i < 100; ++i) {
+//     Quote quote = { 100.0 + i, 100.5 + i };
+//     quoteCache.insert(i, quote);
+// }
+// assert(100 == quoteCache.size());
+// ```
+// Now, we look up a quote exactly as we would in a `bdlcc::Cache`:
+// ```
+// bsl::shared_ptr<Quote> quote;
+// int rc = quoteCache.tryGetValue(&quote, 42);
+// assert(0     == rc);
+// assert(142.0 == quote->d_bid);
+//
+// rc = quoteCache.tryGetValue(&quote, 1000);
+// assert(1 == rc);
+// ```
+// Finally, we visit every item in the cache to compute the total spread.
+// Note that items are visited shard by shard, in the eviction order of each
+// shard:
+// ```
+// struct SpreadVisitor {
+//     double d_total;
+//     int    d_count;
+//
+//     bool operator()(int, const Quote& quote)
+//     {
+//         d_total += quote.d_ask - quote.d_bid;
+//         ++d_count;
+//         return true;
+//     }
+// };
+//
+// SpreadVisitor visitor = { 0.0, 0 };
+// quoteCache.visit(visitor);
+// assert(100 == visitor.d_count);
+// assert(50.0 == visitor.d_total);
+// ```
+
+#include <bdlcc_cache.h>
+
+#include <bslmt_platform.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_integralconstant.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_limits.h>
+#include <bsl_memory.h>
+#include <bsl_new.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                        // ========================
+                        // struct ShardedCache_Util
+                        // ========================
+
+/// This `struct` provides a namespace for non-template utility functions
+/// used in the implementation of `ShardedCache`.
+struct ShardedCache_Util {
+
+    // CLASS METHODS
+
+    /// Return the smallest power of two that is greater than or equal to the
+    /// specified `numShards`, or 1 if `0 == numShards`.
+    static bsl::size_t adjustedNumShards(bsl::size_t numShards);
+
+    /// Return the base-2 logarithm of the specified `powerOfTwo`.  The
+    /// behavior is undefined unless `powerOfTwo` is a power of two.
+    static int log2(bsl::size_t powerOfTwo);
+
+    /// Return the share of the specified `watermark` to be enforced by each
+    /// of the specified `numShards` shards, i.e., `watermark / numShards`
+    /// rounded up.  If `watermark` is the maximum value of `bsl::size_t`,
+    /// return that value (no limit).  The behavior is undefined unless
+    /// `0 < numShards`.
+    static bsl::size_t shardWatermark(bsl::size_t watermark,
+                                      bsl::size_t numShards);
+
+    /// Return the index of the shard, in the range `[0, 1 << shardBits)`,
+    /// selected by the specified `hashValue` for a cache having
+    /// `1 << shardBits` shards, where `shardBits` is the specified value.
+    static bsl::size_t shardIndex(bsl::size_t hashValue, int shardBits);
+};
+
+                        // ========================
+                        // class ShardedCache_Shard
+                        // ========================
+
+/// This class template holds one shard of a `ShardedCache`, padded so that
+/// the locks of adjacent shards in an array do not share a cache line.
+template <class KEY, class VALUE, class HASH, class EQUAL>
+class ShardedCache_Shard {
+
+  public:
+    // PUBLIC TYPES
+    typedef Cache<KEY, VALUE, HASH, EQUAL> CacheType;
+
+  private:
+    // DATA
+    CacheType d_cache;                                        // shard
+
+    char      d_pad[bslmt::Platform::e_CACHE_LINE_SIZE];      // padding
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCache_Shard(const ShardedCache_Shard&);
+    ShardedCache_Shard& operator=(const ShardedCache_Shard&);
+
+  public:
+    // CREATORS
+
+    /// Create a shard holding an empty cache using the specified
+    /// `evictionPolicy`, `lowWatermark`, `highWatermark`, `hashFunction`,
+    /// and `equalFunction`, and using the specified `basicAllocator` to
+    /// supply memory.
+    ShardedCache_Shard(CacheEvictionPolicy::Enum  evictionPolicy,
+                       bsl::size_t                lowWatermark,
+                       bsl::size_t                highWatermark,
+                       const HASH&                hashFunction,
+                       const EQUAL&               equalFunction,
+                       bslma::Allocator          *basicAllocator);
+
+    // MANIPULATORS
+
+    /// Return a reference providing modifiable access to the cache held by
+    /// this shard.
+    CacheType& cache();
+
+    // ACCESSORS
+
+    /// Return a reference providing non-modifiable access to the cache held
+    /// by this shard.
+    const CacheType& cache() const;
+};
+
+                        // =================================
+                        // class ShardedCache_VisitorAdapter
+                        // =================================
+
+/// This class template adapts a visitor supplied to `ShardedCache::visit`
+/// so that it can be applied to each shard in turn while recording whether
+/// the visitor requested that the visit be stopped.
+template <class KEY, class VALUE, class VISITOR>
+class ShardedCache_VisitorAdapter {
+
+    // DATA
+    VISITOR *d_visitor_p;  // visitor (held, not owned)
+    bool     d_stopped;    // `true` if `*d_visitor_p` has returned `false`
+
+  public:
+    // CREATORS
+
+    /// Create an adapter forwarding to the specified `visitor`.
+    explicit ShardedCache_VisitorAdapter(VISITOR *visitor);
+
+    // MANIPULATORS
+
+    /// Invoke the held visitor with the specified `key` and `value`, and
+    /// return its result.  Record that the visit was stopped if the visitor
+    /// returns `false`.
+    bool operator()(const KEY& key, const VALUE& value);
+
+    // ACCESSORS
+
+    /// Return `true` if the held visitor has returned `false`, and `false`
+    /// otherwise.
+    bool stopped() const;
+};
+
+                        // ==================
+                        // class ShardedCache
+                        // ==================
+
+/// This class represents an in-process key-value store, partitioned into
+/// independently locked shards, supporting a variety of eviction policies.
+template <class KEY,
+          class VALUE,
+          class HASH  = bsl::hash<KEY>,
+          class EQUAL = bsl::equal_to<KEY> >
+class ShardedCache {
+
+  public:
+    // PUBLIC TYPES
+
+    /// Type of each shard.
+    typedef Cache<KEY, VALUE, HASH, EQUAL>             ShardType;
+
+    /// Shared pointer type pointing to value type.
+    typedef typename ShardType::ValuePtrType           ValuePtrType;
+
+    /// Type of function to call after an item has been evicted from the cache.
+    typedef typename ShardType::PostEvictionCallback   PostEvictionCallback;
+
+    /// Value type of a bulk insert entry.
+    typedef typename ShardType::KVType                 KVType;
+
+    enum {
+        k_DEFAULT_NUM_SHARDS = 16  // default number of shards
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef ShardedCache_Shard<KEY, VALUE, HASH, EQUAL> Shard;
+
+    // DATA
+    bslma::Allocator          *d_allocator_p;     // memory allocator (held,
+                                                  // not owned)
+
+    bsl::size_t                d_numShards;       // number of shards, a power
+                                                  // of 2
+
+    int                        d_shardBits;       // log2(d_numShards)
+
+    Shard                     *d_shards_p;        // array of `d_numShards`
+                                                  // shards (owned)
+
+    HASH                       d_hashFunction;    // hash functor used to
+                                                  // select the shard of a key
+
+    CacheEvictionPolicy::Enum  d_evictionPolicy;  // eviction policy
+
+    bsl::size_t                d_lowWatermark;    // low watermark of the
+                                                  // cache as a whole
+
+    bsl::size_t                d_highWatermark;   // high watermark of the
+                                                  // cache as a whole
+
+    // PRIVATE MANIPULATORS
+
+    /// Create the shards of this cache with the specified `hashFunction`
+    /// and `equalFunction`.  The behavior is undefined unless `d_numShards`,
+    /// `d_evictionPolicy`, and the watermarks have been initialized.
+    void createShards(const HASH& hashFunction, const EQUAL& equalFunction);
+
+    /// Return a reference providing modifiable access to the shard in which
+    /// the specified `key` is (or would be) stored.
+    ShardType& shard(const KEY& key);
+
+    // PRIVATE ACCESSORS
+
+    /// Return the index of the shard in which the specified `key` is (or
+    /// would be) stored.
+    bsl::size_t shardIndex(const KEY& key) const;
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCache(const ShardedCache&);
+    ShardedCache& operator=(const ShardedCache&);
+
+  public:
+    // CREATORS
+
+    /// Create an empty LRU cache having no size limit and
+    /// `k_DEFAULT_NUM_SHARDS` shards.  Optionally specify a `basicAllocator`
+    /// used to supply memory.  If `basicAllocator` is 0, the currently
+    /// installed default allocator is used.
+    explicit ShardedCache(bslma::Allocator *basicAllocator = 0);
+
+    /// Create an empty cache using the specified `evictionPolicy`,
+    /// `lowWatermark`, `highWatermark`, and `numShards`.  Optionally specify
+    /// the `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.  `numShards` is
+    /// rounded up to the nearest power of two.  The behavior is undefined
+    /// unless `lowWatermark <= highWatermark`, `1 <= lowWatermark`,
+    /// `1 <= highWatermark`, and `1 <= numShards`.
+    ShardedCache(CacheEvictionPolicy::Enum  evictionPolicy,
+                 bsl::size_t                lowWatermark,
+                 bsl::size_t                highWatermark,
+                 bsl::size_t                numShards,
+                 bslma::Allocator          *basicAllocator = 0);
+
+    /// Create an empty cache using the specified `evictionPolicy`,
+    /// `lowWatermark`, `highWatermark`, and `numShards`.  The specified
+    /// `hashFunction` is used to generate the hash values for a given key,
+    /// and the specified `equalFunction` is used to determine whether two
+    /// keys have the same value.  Optionally specify the `basicAllocator`
+    /// used to supply memory.  If `basicAllocator` is 0, the currently
+    /// installed default allocator is used.  `numShards` is rounded up to the
+    /// nearest power of two.  The behavior is undefined unless
+    /// `lowWatermark <= highWatermark`, `1 <= lowWatermark`,
+    /// `1 <= highWatermark`, and `1 <= numShards`.
+    ShardedCache(CacheEvictionPolicy::Enum  evictionPolicy,
+                 bsl::size_t                lowWatermark,
+                 bsl::size_t                highWatermark,
+                 bsl::size_t                numShards,
+                 const HASH&                hashFunction,
+                 const EQUAL&               equalFunction,
+                 bslma::Allocator          *basicAllocator = 0);
+
+    /// Destroy this object.
+    ~ShardedCache();
+
+    // MANIPULATORS
+
+    /// Remove all items from this cache.  Do *not* invoke the post-eviction
+    /// callback.
+    void clear();
+
+    /// Remove the item having the specified `key` from this cache.  Invoke the
+    /// post-eviction callback for the removed item.  Return 0 on success and 1
+    /// if `key` does not exist.
+    int erase(const KEY& key);
+
+    /// Remove the items having the keys in the specified range
+    /// `[ begin, end )`, from this cache.  Invoke the post-eviction callback
+    /// for each removed item.  Return the number of items successfully
+    /// removed.
+    template <class INPUT_ITERATOR>
+    int eraseBulk(INPUT_ITERATOR begin, INPUT_ITERATOR end);
+
+    /// Remove the items having the specified `keys` from this cache.  Invoke
+    /// the post-eviction callback for each removed item.  Return the number
+    /// of items successfully removed.
+    int eraseBulk(const bsl::vector<KEY>& keys);
+
+    /// Move the specified `key` and its associated `value` into this cache.
+    /// If `key` already exists, then its value will be replaced with `value`.
+    /// Evict items from the shard of `key` if that shard reaches its share of
+    /// the high watermark.  Note that the methods that take moved objects
+    /// provide the same exception guarantees as the corresponding methods of
+    /// `bdlcc::Cache`.
+    void insert(const KEY& key, const VALUE& value);
+    void insert(const KEY& key, bslmf::MovableRef<VALUE> value);
+    void insert(bslmf::MovableRef<KEY> key, const VALUE& value);
+    void insert(bslmf::MovableRef<KEY> key, bslmf::MovableRef<VALUE> value);
+
+    /// Insert the specified `key` and its associated `valuePtr` into this
+    /// cache.  If `key` already exists, then its value will be replaced with
+    /// `value`.
+    void insert(const KEY& key, const ValuePtrType& valuePtr);
+    void insert(bslmf::MovableRef<KEY> key, const ValuePtrType& valuePtr);
+
+    /// Insert the specified range of Key-Value pairs specified by
+    /// `[ begin, end )` into this cache.  If a key already exists, then its
+    /// value will be replaced with the value.  Return the number of items
+    /// successfully inserted.  Note that the items are partitioned by shard
+    /// and each shard is locked once.
+    template <class INPUT_ITERATOR>
+    int insertBulk(INPUT_ITERATOR begin, INPUT_ITERATOR end);
+
+    /// Insert the specified `data` (composed of Key-Value pairs) into this
+    /// cache.  If a key already exists, then its value will be replaced with
+    /// the value.  Return the number of items successfully inserted.
+    int insertBulk(const bsl::vector<KVType>& data);
+
+    /// Insert the specified `data` (composed of Key-Value pairs) into this
+    /// cache.  If a key already exists, then its value will be replaced with
+    /// the value.  Return the number of items successfully inserted.  If an
+    /// exception occurs during this action, we provide only the basic
+    /// guarantee - both this cache and `data` will be in some valid but
+    /// unspecified state.
+    int insertBulk(bslmf::MovableRef<bsl::vector<KVType> > data);
+
+    /// Set the post-eviction callback of every shard to the specified
+    /// `postEvictionCallback`.  The post-eviction callback is invoked for
+    /// each item evicted or removed from this cache.
+    void setPostEvictionCallback(
+                             const PostEvictionCallback& postEvictionCallback);
+
+    /// Load, into the specified `value`, the value associated with the
+    /// specified `key` in this cache.  If the optionally specified
+    /// `modifyEvictionQueue` is `true` and the eviction policy is LRU, then
+    /// move the cached item to the back of the eviction queue of its shard.
+    /// Return 0 on success, and 1 if `key` does not exist in this cache.  Note
+    /// that only the lock of the shard of `key` is acquired, and that it is
+    /// acquired for writing only if the eviction queue is modified.
+    int tryGetValue(bsl::shared_ptr<VALUE> *value,
+                    const KEY&              key,
+                    bool                    modifyEvictionQueue = true);
+
+    // ACCESSORS
+
+    /// Return (a copy of) the key-equality functor used by this cache that
+    /// returns `true` if two `KEY` objects have the same value, and `false`
+    /// otherwise.
+    EQUAL equalFunction() const;
+
+    /// Return the eviction policy used by this cache.
+    CacheEvictionPolicy::Enum evictionPolicy() const;
+
+    /// Return (a copy of) the unary hash functor used by this cache to
+    /// generate a hash value (of type `std::size_t`) for a `KEY` object.
+    HASH hashFunction() const;
+
+    /// Return the high watermark of this cache as a whole, as supplied at
+    /// construction.
+    bsl::size_t highWatermark() const;
+
+    /// Return the low watermark of this cache as a whole, as supplied at
+    /// construction.
+    bsl::size_t lowWatermark() const;
+
+    /// Return the number of shards of this cache.
+    bsl::size_t numShards() const;
+
+    /// Return a reference providing non-modifiable access to the shard at
+    /// the specified `index`.  The behavior is undefined unless
+    /// `index < numShards()`.
+    const ShardType& shardAt(bsl::size_t index) const;
+
+    /// Return the index of the shard in which the specified `key` is (or
+    /// would be) stored.
+    bsl::size_t shardIndexOf(const KEY& key) const;
+
+    /// Return the current size of this cache, i.e., the sum of the sizes of
+    /// its shards.
+    bsl::size_t size() const;
+
+    /// Call the specified `visitor` for every item stored in this cache,
+    /// shard by shard and in the order of the eviction queue of each shard,
+    /// until `visitor` returns `false`.  The `VISITOR` type must be a
+    /// callable object that can be invoked in the same way as the function
+    /// `bool (const KEY&, const VALUE&)`.  Note that only one shard is
+    /// locked at a time.
+    template <class VISITOR>
+    void visit(VISITOR& visitor) const;
+};
+
+// ============================================================================
+//                        INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // ------------------------
+                        // struct ShardedCache_Util
+                        // ------------------------
+
+// CLASS METHODS
+inline
+bsl::size_t ShardedCache_Util::shardIndex(bsl::size_t hashValue,
+                                          int         shardBits)
+{
+    if (0 == shardBits) {
+        return 0;                                                     // RETURN
+    }
+
+    // Fibonacci hashing: the high-order bits of the product are well mixed
+    // even when `hashValue` is, e.g., an identity hash of an integer key.
+
+    const bsls::Types::Uint64 product =
+                 static_cast<bsls::Types::Uint64>(hashValue) *
+                                 static_cast<bsls::Types::Uint64>(
+                                     0x9E3779B97F4A7C15ULL);
+
+    return static_cast<bsl::size_t>(product >> (64 - shardBits));
+}
+
+                        // ------------------------
+                        // class ShardedCache_Shard
+                        // ------------------------
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::ShardedCache_Shard(
+                                     CacheEvictionPolicy::Enum  evictionPolicy,
+                                     bsl::size_t                lowWatermark,
+                                     bsl::size_t                highWatermark,
+                                     const HASH&                hashFunction,
+                                     const EQUAL&               equalFunction,
+                                     bslma::Allocator          *basicAllocator)
+: d_cache(evictionPolicy,
+          lowWatermark,
+          highWatermark,
+          hashFunction,
+          equalFunction,
+          basicAllocator)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::CacheType&
+ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::cache()
+{
+    return d_cache;
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+const typename ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::CacheType&
+ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::cache() const
+{
+    return d_cache;
+}
+
+                        // ---------------------------------
+                        // class ShardedCache_VisitorAdapter
+                        // ---------------------------------
+
+// CREATORS
+template <class KEY, class VALUE, class VISITOR>
+inline
+ShardedCache_VisitorAdapter<KEY, VALUE, VISITOR>::ShardedCache_VisitorAdapter(
+                                                              VISITOR *visitor)
+: d_visitor_p(visitor)
+, d_stopped(false)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class VISITOR>
+inline
+bool ShardedCache_VisitorAdapter<KEY, VALUE, VISITOR>::operator()(
+                                                          const KEY&   key,
+                                                          const VALUE& value)
+{
+    if (!(*d_visitor_p)(key, value)) {
+        d_stopped = true;
+        return false;                                                 // RETURN
+    }
+    return true;
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class VISITOR>
+inline
+bool ShardedCache_VisitorAdapter<KEY, VALUE, VISITOR>::stopped() const
+{
+    return d_stopped;
+}
+
+                        // ------------------
+                        // class ShardedCache
+                        // ------------------
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::createShards(
+                                                   const HASH&  hashFunction,
+                                                   const EQUAL& equalFunction)
+{
+    const bsl::size_t lowWatermark  = ShardedCache_Util::shardWatermark(
+                                                                d_lowWatermark,
+                                                                d_numShards);
+    const bsl::size_t highWatermark = ShardedCache_Util::shardWatermark(
+                                                               d_highWatermark,
+                                                               d_numShards);
+
+    d_shards_p = static_cast<Shard *>(
+                         d_allocator_p->allocate(d_numShards * sizeof(Shard)));
+
+    bsl::size_t i = 0;
+    BSLS_TRY {
+        for (; i < d_numShards; ++i) {
+            ::new (static_cast<void *>(d_shards_p + i)) Shard(d_evictionPolicy,
+                                                              lowWatermark,
+                                                              highWatermark,
+                                                              hashFunction,
+                                                              equalFunction,
+                                                              d_allocator_p);
+        }
+    }
+    BSLS_CATCH(...) {
+        while (i > 0) {
+            --i;
+            d_shards_p[i].~Shard();
+        }
+        d_allocator_p->deallocate(d_shards_p);
+        BSLS_RETHROW;
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardType&
+ShardedCache<KEY, VALUE, HASH, EQUAL>::shard(const KEY& key)
+{
+    return d_shards_p[shardIndex(key)].cache();
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::shardIndex(
+                                                          const KEY& key) const
+{
+    return ShardedCache_Util::shardIndex(d_hashFunction(key), d_shardBits);
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                                              bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_numShards(k_DEFAULT_NUM_SHARDS)
+, d_shardBits(ShardedCache_Util::log2(k_DEFAULT_NUM_SHARDS))
+, d_shards_p(0)
+, d_hashFunction()
+, d_evictionPolicy(CacheEvictionPolicy::e_LRU)
+, d_lowWatermark(bsl::numeric_limits<bsl::size_t>::max())
+, d_highWatermark(bsl::numeric_limits<bsl::size_t>::max())
+{
+    createShards(HASH(), EQUAL());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                                     CacheEvictionPolicy::Enum  evictionPolicy,
+                                     bsl::size_t                lowWatermark,
+                                     bsl::size_t                highWatermark,
+                                     bsl::size_t                numShards,
+                                     bslma::Allocator          *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_numShards(ShardedCache_Util::adjustedNumShards(numShards))
+, d_shardBits(ShardedCache_Util::log2(d_numShards))
+, d_shards_p(0)
+, d_hashFunction()
+, d_evictionPolicy(evictionPolicy)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+{
+    BSLS_REVIEW(lowWatermark <= highWatermark);
+    BSLS_REVIEW(1 <= lowWatermark);
+    BSLS_REVIEW(1 <= highWatermark);
+    BSLS_REVIEW(1 <= numShards);
+
+    createShards(HASH(), EQUAL());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                                     CacheEvictionPolicy::Enum  evictionPolicy,
+                                     bsl::size_t                lowWatermark,
+                                     bsl::size_t                highWatermark,
+                                     bsl::size_t                numShards,
+                                     const HASH&                hashFunction,
+                                     const EQUAL&               equalFunction,
+                                     bslma::Allocator          *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_numShards(ShardedCache_Util::adjustedNumShards(numShards))
+, d_shardBits(ShardedCache_Util::log2(d_numShards))
+, d_shards_p(0)
+, d_hashFunction(hashFunction)
+, d_evictionPolicy(evictionPolicy)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+{
+    BSLS_REVIEW(lowWatermark <= highWatermark);
+    BSLS_REVIEW(1 <= lowWatermark);
+    BSLS_REVIEW(1 <= highWatermark);
+    BSLS_REVIEW(1 <= numShards);
+
+    createShards(hashFunction, equalFunction);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::~ShardedCache()
+{
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        d_shards_p[i].~Shard();
+    }
+    d_allocator_p->deallocate(d_shards_p);
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        d_shards_p[i].cache().clear();
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    return shard(key).erase(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::eraseBulk(INPUT_ITERATOR begin,
+                                                     INPUT_ITERATOR end)
+{
+    bsl::vector<bsl::vector<KEY> > keysByShard(d_numShards, d_allocator_p);
+
+    for (; begin != end; ++begin) {
+        keysByShard[shardIndex(*begin)].push_back(*begin);
+    }
+
+    int count = 0;
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        if (!keysByShard[i].empty()) {
+            count += d_shards_p[i].cache().eraseBulk(keysByShard[i]);
+        }
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::eraseBulk(
+                                                  const bsl::vector<KEY>& keys)
+{
+    return eraseBulk(keys.begin(), keys.end());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(const KEY&   key,
+                                                   const VALUE& value)
+{
+    shard(key).insert(key, value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                              const KEY&               key,
+                                              bslmf::MovableRef<VALUE> value)
+{
+    shard(key).insert(key, bslmf::MovableRefUtil::move(value));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                                bslmf::MovableRef<KEY> key,
+                                                const VALUE&           value)
+{
+    KEY& localKey = key;
+    shard(localKey).insert(bslmf::MovableRefUtil::move(localKey), value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                              bslmf::MovableRef<KEY>   key,
+                                              bslmf::MovableRef<VALUE> value)
+{
+    KEY& localKey = key;
+    shard(localKey).insert(bslmf::MovableRefUtil::move(localKey),
+                           bslmf::MovableRefUtil::move(value));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                                  const KEY&          key,
+                                                  const ValuePtrType& valuePtr)
+{
+    shard(key).insert(key, valuePtr);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                               bslmf::MovableRef<KEY> key,
+                                               const ValuePtrType&    valuePtr)
+{
+    KEY& localKey = key;
+    shard(localKey).insert(bslmf::MovableRefUtil::move(localKey), valuePtr);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::insertBulk(INPUT_ITERATOR begin,
+                                                      INPUT_ITERATOR end)
+{
+    bsl::vector<bsl::vector<KVType> > dataByShard(d_numShards, d_allocator_p);
+
+    for (; begin != end; ++begin) {
+        dataByShard[shardIndex(begin->first)].push_back(
+                                           KVType(begin->first, begin->second));
+    }
+
+    int count = 0;
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        if (!dataByShard[i].empty()) {
+            count += d_shards_p[i].cache().insertBulk(
+                                 bslmf::MovableRefUtil::move(dataByShard[i]));
+        }
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::insertBulk(
+                                               const bsl::vector<KVType>& data)
+{
+    return insertBulk(data.begin(), data.end());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::insertBulk(
+                                  bslmf::MovableRef<bsl::vector<KVType> > data)
+{
+    typedef bsl::vector<KVType> Vec;
+
+    Vec& local = data;
+
+    bsl::vector<Vec> dataByShard(d_numShards, d_allocator_p);
+
+    for (typename Vec::iterator it = local.begin(); it < local.end(); ++it) {
+        dataByShard[shardIndex(it->first)].push_back(
+                                              bslmf::MovableRefUtil::move(*it));
+    }
+
+    int count = 0;
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        if (!dataByShard[i].empty()) {
+            count += d_shards_p[i].cache().insertBulk(
+                                 bslmf::MovableRefUtil::move(dataByShard[i]));
+        }
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::setPostEvictionCallback(
+                              const PostEvictionCallback& postEvictionCallback)
+{
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        d_shards_p[i].cache().setPostEvictionCallback(postEvictionCallback);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::tryGetValue(
+                                   bsl::shared_ptr<VALUE> *value,
+                                   const KEY&              key,
+                                   bool                    modifyEvictionQueue)
+{
+    return shard(key).tryGetValue(value, key, modifyEvictionQueue);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL ShardedCache<KEY, VALUE, HASH, EQUAL>::equalFunction() const
+{
+    return d_shards_p[0].cache().equalFunction();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+CacheEvictionPolicy::Enum
+ShardedCache<KEY, VALUE, HASH, EQUAL>::evictionPolicy() const
+{
+    return d_evictionPolicy;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH ShardedCache<KEY, VALUE, HASH, EQUAL>::hashFunction() const
+{
+    return d_hashFunction;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::highWatermark() const
+{
+    return d_highWatermark;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::lowWatermark() const
+{
+    return d_lowWatermark;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::numShards() const
+{
+    return d_numShards;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+const typename ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardType&
+ShardedCache<KEY, VALUE, HASH, EQUAL>::shardAt(bsl::size_t index) const
+{
+    BSLS_ASSERT(index < d_numShards);
+
+    return d_shards_p[index].cache();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::shardIndexOf(
+                                                          const KEY& key) const
+{
+    return shardIndex(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    bsl::size_t total = 0;
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        total += d_shards_p[i].cache().size();
+    }
+    return total;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class VISITOR>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::visit(VISITOR& visitor) const
+{
+    ShardedCache_VisitorAdapter<KEY, VALUE, VISITOR> adapter(&visitor);
+
+    for (bsl::size_t i = 0; i < d_numShards && !adapter.stopped(); ++i) {
+        d_shards_p[i].cache().visit(adapter);
+    }
+}
+
+}  // close package namespace
+
+namespace bslma {
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+struct UsesBslmaAllocator<bdlcc::ShardedCache<KEY, VALUE, HASH, EQUAL> >
+    : bsl::true_type
+{
+};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1327 @@
+// bdlcc_shardedcache.t.cpp                                           -*-C++-*-
+
+#include <bdlcc_shardedcache.h>
+
+#include <bdlcc_cache.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bslmt_threadutil.h>
+#include <bslmt_timedcompletionguard.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_review.h>
+#include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_format.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a mechanism, `bdlcc::ShardedCache`, that
+// partitions an in-memory key-value cache into independently locked
+// `bdlcc::Cache` shards.  Almost all of the functionality is delegated to the
+// shards, so we verify that each key is consistently routed to one shard,
+// that the watermarks supplied at construction are divided between the
+// shards, and that the "pass-through" of each manipulator and accessor is
+// correct.  Thread safety is provided by the shards, so only a stress test
+// verifying the absence of races between shards is required.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] bsl::size_t ShardedCache_Util::adjustedNumShards(bsl::size_t);
+// [ 2] int ShardedCache_Util::log2(bsl::size_t);
+// [ 2] bsl::size_t ShardedCache_Util::shardWatermark(size_t, size_t);
+// [ 2] bsl::size_t ShardedCache_Util::shardIndex(bsl::size_t, int);
+//
+// CREATORS
+// [ 3] explicit ShardedCache(bslma::Allocator *basicAllocator);
+// [ 3] ShardedCache(policy, lowWat, highWat, numShards, alloc);
+// [ 3] ShardedCache(policy, lowWat, highWat, numShards, hash, equal, alloc);
+// [ 3] ~ShardedCache();
+//
+// MANIPULATORS
+// [ 4] void insert(const KEY& key, const VALUE& value);
+// [ 4] void insert(const KEY& key, MovableRef<VALUE> value);
+// [ 4] void insert(MovableRef<KEY> key, const VALUE& value);
+// [ 4] void insert(MovableRef<KEY> key, MovableRef<VALUE> value);
+// [ 4] void insert(const KEY& key, const ValuePtrType& valuePtr);
+// [ 4] void insert(MovableRef<KEY> key, const ValuePtrType& valuePtr);
+// [ 4] int tryGetValue(value, key, modifyEvictionQueue);
+// [ 4] int erase(const KEY& key);
+// [ 4] void clear();
+// [ 5] int insertBulk(INPUT_ITERATOR begin, INPUT_ITERATOR end);
+// [ 5] int insertBulk(const bsl::vector<KVType>& data);
+// [ 5] int insertBulk(bslmf::MovableRef<bsl::vector<KVType> > data);
+// [ 5] int eraseBulk(INPUT_ITERATOR begin, INPUT_ITERATOR end);
+// [ 5] int eraseBulk(const bsl::vector<KEY>& keys);
+// [ 6] void setPostEvictionCallback(postEvictionCallback);
+//
+// ACCESSORS
+// [ 3] EQUAL equalFunction() const;
+// [ 3] CacheEvictionPolicy::Enum evictionPolicy() const;
+// [ 3] HASH hashFunction() const;
+// [ 3] bsl::size_t highWatermark() const;
+// [ 3] bsl::size_t lowWatermark() const;
+// [ 3] bsl::size_t numShards() const;
+// [ 3] const ShardType& shardAt(bsl::size_t index) const;
+// [ 3] bsl::size_t shardIndexOf(const KEY& key) const;
+// [ 4] bsl::size_t size() const;
+// [ 7] void visit(VISITOR& visitor) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] CONCERN: EVICTION IS PERFORMED PER SHARD
+// [ 8] CONCERN: TYPE TRAITS
+// [ 9] CONCERN: THREAD SAFETY
+// [10] USAGE EXAMPLE
+// [-1] READ PERFORMANCE: `bdlcc::Cache` VS. `bdlcc::ShardedCache`
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+
+typedef bdlcc::ShardedCache_Util                  Util;
+typedef bdlcc::ShardedCache<int, bsl::string>     Obj;
+typedef bdlcc::CacheEvictionPolicy                Policy;
+
+// ============================================================================
+//                       HELPER CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// Hash functor returning the key itself, offset by `d_offset`, so that
+/// distinct functor objects can be distinguished.
+class TestHash {
+
+    int d_offset;
+
+  public:
+    explicit TestHash(int offset = 0)
+    : d_offset(offset)
+    {
+    }
+
+    bsl::size_t operator()(int key) const
+    {
+        return static_cast<bsl::size_t>(key + d_offset);
+    }
+
+    int offset() const
+    {
+        return d_offset;
+    }
+};
+
+/// Equality functor that can be distinguished by its `d_id`.
+class TestEqual {
+
+    int d_id;
+
+  public:
+    explicit TestEqual(int id = 0)
+    : d_id(id)
+    {
+    }
+
+    bool operator()(int lhs, int rhs) const
+    {
+        return lhs == rhs;
+    }
+
+    int id() const
+    {
+        return d_id;
+    }
+};
+
+/// Visitor collecting the visited keys, and stopping after `d_limit` items.
+struct CollectVisitor {
+
+    bsl::vector<int> *d_keys_p;
+    bsl::size_t       d_limit;
+
+    bool operator()(int key, const bsl::string&)
+    {
+        d_keys_p->push_back(key);
+        return d_keys_p->size() < d_limit;
+    }
+};
+
+/// Post-eviction callback state.
+bsls::AtomicInt evictionCount(0);
+
+void countingCallback(const bsl::shared_ptr<bsl::string>&)
+{
+    ++evictionCount;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                          MULTI-THREADED TESTING
+// ----------------------------------------------------------------------------
+
+namespace threaded {
+
+struct ThreadArg {
+    typedef bdlcc::ShardedCache<int, int> CacheType;
+
+    CacheType       *d_cache_p;
+    bsls::AtomicInt *d_stop_p;
+    bsls::AtomicInt *d_writeCounts_p;
+    int              d_numItems;
+    int              d_workerId;
+    int              d_numWorkers;
+};
+
+void worker(ThreadArg *arg)
+{
+    unsigned int seed = 1234567 * (arg->d_workerId + 1);
+
+    while (0 == *arg->d_stop_p) {
+        seed     = seed * 1103515245 + 12345;
+        int key  = static_cast<int>((seed >> 8) %
+                                  static_cast<unsigned int>(arg->d_numItems));
+        if (key % arg->d_numWorkers != arg->d_workerId) {
+            continue;
+        }
+
+        ThreadArg::CacheType::ValuePtrType valuePtr;
+
+        int rc = arg->d_cache_p->tryGetValue(&valuePtr, key, true);
+        if (0 != rc) {
+            arg->d_cache_p->insert(key, 0);
+            arg->d_writeCounts_p[key] = 0;
+        }
+        else {
+            arg->d_cache_p->insert(key, (*valuePtr) + 1);
+            ++arg->d_writeCounts_p[key];
+        }
+    }
+}
+
+extern "C" void *workerThread(void *v_arg)
+{
+    ThreadArg *arg = static_cast<ThreadArg *>(v_arg);
+    worker(arg);
+    return v_arg;
+}
+
+}  // close namespace threaded
+
+// ============================================================================
+//                          PERFORMANCE TESTING
+// ----------------------------------------------------------------------------
+
+namespace perf {
+
+/// Arguments to a reader thread of the read performance test.
+template <class CACHE>
+struct ReaderArg {
+    CACHE *d_cache_p;
+    int    d_numItems;
+    int    d_numReads;
+    int    d_seed;
+};
+
+template <class CACHE>
+void reader(ReaderArg<CACHE> *arg)
+{
+    unsigned int                   seed = arg->d_seed;
+    typename CACHE::ValuePtrType   value;
+    for (int i = 0; i < arg->d_numReads; ++i) {
+        seed = seed * 1103515245 + 12345;
+        arg->d_cache_p->tryGetValue(
+                    &value,
+                    static_cast<int>((seed >> 8) %
+                                   static_cast<unsigned int>(arg->d_numItems)));
+    }
+}
+
+extern "C" void *cacheReaderThread(void *v_arg)
+{
+    reader(static_cast<ReaderArg<bdlcc::Cache<int, int> > *>(v_arg));
+    return 0;
+}
+
+extern "C" void *shardedReaderThread(void *v_arg)
+{
+    reader(static_cast<ReaderArg<bdlcc::ShardedCache<int, int> > *>(v_arg));
+    return 0;
+}
+
+/// Populate the specified `cache` with `numItems` items, then run the
+/// specified `threadFunction` in `numThreads` threads each performing
+/// `numReads` lookups, and return the elapsed wall time in nanoseconds.
+template <class CACHE>
+bsls::Types::Int64 timeReads(CACHE                                *cache,
+                             bslmt::ThreadUtil::ThreadFunction     function,
+                             int                                   numThreads,
+                             int                                   numItems,
+                             int                                   numReads)
+{
+    for (int i = 0; i < numItems; ++i) {
+        cache->insert(i, i);
+    }
+
+    bsl::vector<ReaderArg<CACHE> >          args(numThreads);
+    bsl::vector<bslmt::ThreadUtil::Handle>  handles(numThreads);
+
+    const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+    for (int i = 0; i < numThreads; ++i) {
+        ReaderArg<CACHE> arg = { cache, numItems, numReads, i + 1 };
+        args[i] = arg;
+        bslmt::ThreadUtil::create(&handles[i], function, &args[i]);
+    }
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+    return bsls::TimeUtil::getTimer() - start;
+}
+
+}  // close namespace perf
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usageExample1 {
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Lookup-Heavy Quote Cache
+///- - - - - - - - - - - - - - - - - - -
+// Suppose a service caches the most recent quote of a large set of securities,
+// and the cache is read from many worker threads concurrently.  Using a single
+// `bdlcc::Cache` with the LRU policy, every lookup would take the same write
+// lock to update the eviction queue.  We use a `bdlcc::ShardedCache` instead.
+//
+// First, we define the value type stored in the cache:
+// ```
+    struct Quote {
+        double d_bid;
+        double d_ask;
+    };
+// ```
+
+struct SpreadVisitor {
+    double d_total;
+    int    d_count;
+
+    bool operator()(int, const Quote& quote)
+    {
+        d_total += quote.d_ask - quote.d_bid;
+        ++d_count;
+        return true;
+    }
+};
+
+void example1()
+{
+    bslma::TestAllocator talloc("usage", veryVeryVeryVerbose);
+
+// Then, we create a cache with 8 shards, using the LRU eviction policy, and
+// holding at most 800 items:
+// ```
+    bdlcc::ShardedCache<int, Quote> quoteCache(
+                                          bdlcc::CacheEvictionPolicy::e_LRU,
+                                          700,
+                                          800,
+                                          8,
+                                          &talloc);
+    ASSERT(8   == quoteCache.numShards());
+    ASSERT(700 == quoteCache.lowWatermark());
+    ASSERT(800 == quoteCache.highWatermark());
+// ```
+// Next, we populate the cache:
+// ```
+    for (int i = 0; i < 100; ++i) {
+        Quote quote = { 100.0 + i, 100.5 + i };
+        quoteCache.insert(i, quote);
+    }
+    ASSERT(100 == quoteCache.size());
+// ```
+// Now, we look up a quote exactly as we would in a `bdlcc::Cache`:
+// ```
+    bsl::shared_ptr<Quote> quote;
+    int rc = quoteCache.tryGetValue(&quote, 42);
+    ASSERT(0     == rc);
+    ASSERT(142.0 == quote->d_bid);
+
+    rc = quoteCache.tryGetValue(&quote, 1000);
+    ASSERT(1 == rc);
+// ```
+// Finally, we visit every item in the cache to compute the total spread.
+// Note that items are visited shard by shard, in the eviction order of each
+// shard:
+// ```
+    SpreadVisitor visitor = { 0.0, 0 };
+    quoteCache.visit(visitor);
+    ASSERT(100 == visitor.d_count);
+    ASSERT(50.0 == visitor.d_total);
+// ```
+}
+
+}  // close namespace usageExample1
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: `BSLS_REVIEW` failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+    bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+    bslma::TestAllocatorMonitor gam(&globalAllocator);
+
+    bslmt::TimedCompletionGuard completionGuard(&defaultAllocator);
+    ASSERT(0 == completionGuard.guard(bsls::TimeInterval(90, 0),
+                                      bsl::format("case {}", test)));
+
+    switch (test) { case 0:
+      case 10: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        usageExample1::example1();
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // CONCERN: THREAD SAFETY
+        //
+        // Concerns:
+        // 1. Concurrent reads and writes of keys in different shards contain
+        //    no deadlocks or race conditions.
+        //
+        // Plan:
+        // 1. Run several threads for a fixed period, each responsible for a
+        //    disjoint set of keys, incrementing the value associated with a
+        //    key through `tryGetValue` and `insert` and counting the
+        //    increments in an atomic counter.  Verify the final values
+        //    against the counters.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: THREAD SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: THREAD SAFETY" << endl
+                          << "======================" << endl;
+
+        using namespace threaded;
+
+        enum { k_NUM_WORKERS = 8, k_NUM_ITEMS = 256 };
+
+        bslma::TestAllocator  ta("test", veryVeryVeryVerbose);
+        ThreadArg::CacheType  cache(Policy::e_LRU,
+                                    k_NUM_ITEMS * 2,
+                                    k_NUM_ITEMS * 2,
+                                    4,
+                                    &ta);
+        bsls::AtomicInt       writeCounts[k_NUM_ITEMS];
+        bsls::AtomicInt       stop(0);
+
+        bslmt::ThreadUtil::Handle handles[k_NUM_WORKERS];
+        ThreadArg                 args[k_NUM_WORKERS];
+
+        for (int i = 0; i < k_NUM_WORKERS; ++i) {
+            ThreadArg arg = { &cache, &stop, writeCounts,
+                              k_NUM_ITEMS, i, k_NUM_WORKERS };
+            args[i] = arg;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                  workerThread,
+                                                  &args[i]));
+        }
+
+        bslmt::ThreadUtil::microSleep(0, 1);
+        stop = 1;
+
+        for (int i = 0; i < k_NUM_WORKERS; ++i) {
+            bslmt::ThreadUtil::join(handles[i]);
+        }
+
+        for (int i = 0; i < k_NUM_ITEMS; ++i) {
+            ThreadArg::CacheType::ValuePtrType valuePtr;
+
+            int rc    = cache.tryGetValue(&valuePtr, i, false);
+            int count = 0 != rc ? 0 : *valuePtr;
+
+            ASSERTV(i, count, writeCounts[i], count == writeCounts[i]);
+        }
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // CONCERN: TYPE TRAITS
+        //
+        // Concerns:
+        // 1. The class has the `bslma::UsesBslmaAllocator` trait.
+        //
+        // Plan:
+        // 1. Assert the presence of the trait.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: TYPE TRAITS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: TYPE TRAITS" << endl
+                          << "====================" << endl;
+
+        ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // VISIT
+        //
+        // Concerns:
+        // 1. `visit` calls the visitor exactly once for every item.
+        //
+        // 2. Within a shard, items are visited in eviction-queue order.
+        //
+        // 3. The visit stops, across shards, as soon as the visitor returns
+        //    `false`.
+        //
+        // Plan:
+        // 1. Insert a set of keys, visit the cache, and verify that each key
+        //    is seen once, and that the keys of each shard are seen in
+        //    insertion (FIFO) order.  (C-1..2)
+        //
+        // 2. Visit with a visitor limited to `N` items, for `N` smaller
+        //    than the size of any shard and larger than the size of the
+        //    first shard, and verify exactly `N` items are visited.  (C-3)
+        //
+        // Testing:
+        //   void visit(VISITOR& visitor) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "VISIT" << endl
+                          << "=====" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        enum { k_NUM_ITEMS = 200 };
+
+        Obj mX(Policy::e_FIFO, 1000, 1000, 4, &ta);  const Obj& X = mX;
+
+        for (int i = 0; i < k_NUM_ITEMS; ++i) {
+            mX.insert(i, bsl::string(1, static_cast<char>('a' + i % 26)));
+        }
+
+        bsl::vector<int> keys(&ta);
+        CollectVisitor   visitor = { &keys, 100000 };
+        X.visit(visitor);
+
+        ASSERTV(keys.size(), k_NUM_ITEMS == keys.size());
+
+        bsl::vector<int> seen(k_NUM_ITEMS, 0, &ta);
+        bsl::vector<int> lastKeyOfShard(X.numShards(), -1, &ta);
+        bsl::size_t      lastShard = 0;
+        for (bsl::size_t i = 0; i < keys.size(); ++i) {
+            const int         key   = keys[i];
+            const bsl::size_t shard = X.shardIndexOf(key);
+
+            ASSERTV(key, 0 <= key && key < k_NUM_ITEMS);
+            ++seen[key];
+
+            ASSERTV(key, lastKeyOfShard[shard], lastKeyOfShard[shard] < key);
+            lastKeyOfShard[shard] = key;
+
+            ASSERTV(lastShard, shard, lastShard <= shard);
+            lastShard = shard;
+        }
+        for (int i = 0; i < k_NUM_ITEMS; ++i) {
+            ASSERTV(i, seen[i], 1 == seen[i]);
+        }
+
+        const bsl::size_t firstShardSize = X.shardAt(0).size();
+        const bsl::size_t limit          = firstShardSize + 3;
+
+        keys.clear();
+        CollectVisitor limitedVisitor = { &keys, limit };
+        X.visit(limitedVisitor);
+
+        ASSERTV(limit, keys.size(), limit == keys.size());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // EVICTION AND POST-EVICTION CALLBACK
+        //
+        // Concerns:
+        // 1. Each shard evicts, from the front of its own eviction queue,
+        //    when it reaches its share of the high watermark, down to its
+        //    share of the low watermark.
+        //
+        // 2. The total size never exceeds `numShards()` times the per-shard
+        //    high watermark.
+        //
+        // 3. The post-eviction callback is invoked for every evicted or
+        //    erased item, regardless of the shard.
+        //
+        // 4. With LRU, an item accessed through `tryGetValue` is not the
+        //    next item evicted from its shard.
+        //
+        // Plan:
+        // 1. Insert many more keys than the high watermark and verify the
+        //    per-shard and total sizes, and the count of callbacks.
+        //    (C-1..3)
+        //
+        // 2. Fill one shard to just below its high watermark, access its
+        //    oldest key, trigger an eviction, and verify the accessed key
+        //    survived.  (C-4)
+        //
+        // Testing:
+        //   void setPostEvictionCallback(postEvictionCallback);
+        //   CONCERN: EVICTION IS PERFORMED PER SHARD
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EVICTION AND POST-EVICTION CALLBACK" << endl
+                          << "===================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        {
+            Obj mX(Policy::e_FIFO, 30, 40, 4, &ta);  const Obj& X = mX;
+
+            ASSERT(8  == X.shardAt(0).lowWatermark());
+            ASSERT(10 == X.shardAt(0).highWatermark());
+
+            evictionCount = 0;
+            mX.setPostEvictionCallback(&countingCallback);
+
+            enum { k_NUM_INSERTS = 1000 };
+            for (int i = 0; i < k_NUM_INSERTS; ++i) {
+                mX.insert(i, "x");
+                for (bsl::size_t s = 0; s < X.numShards(); ++s) {
+                    ASSERTV(i, s, X.shardAt(s).size() < 11);
+                }
+                ASSERTV(i, X.size() <= 40);
+            }
+
+            ASSERTV(evictionCount,
+                    k_NUM_INSERTS == evictionCount + static_cast<int>(
+                                                                    X.size()));
+
+            const int before = evictionCount;
+            ASSERT(0 == mX.erase(k_NUM_INSERTS - 1));
+            ASSERT(before + 1 == evictionCount);
+        }
+
+        {
+            Obj mX(Policy::e_LRU, 4, 4, 1, &ta);  const Obj& X = mX;
+
+            ASSERT(1 == X.numShards());
+
+            mX.insert(0, "zero");
+            mX.insert(1, "one");
+            mX.insert(2, "two");
+
+            bsl::shared_ptr<bsl::string> value;
+            ASSERT(0 == mX.tryGetValue(&value, 0));
+
+            mX.insert(3, "three");
+            mX.insert(4, "four");   // evicts 1, the least recently used
+
+            ASSERT(0 == mX.tryGetValue(&value, 0, false));
+            ASSERT(1 == mX.tryGetValue(&value, 1, false));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // BULK MANIPULATORS
+        //
+        // Concerns:
+        // 1. `insertBulk` inserts every item into the shard of its key and
+        //    returns the number of newly inserted items.
+        //
+        // 2. The moving `insertBulk` moves the values.
+        //
+        // 3. `eraseBulk` removes every existing key and returns the number of
+        //    removed items.
+        //
+        // 4. No memory is allocated from the default allocator.
+        //
+        // Plan:
+        // 1. Bulk insert a vector of items, some of which are duplicates of
+        //    existing keys, and verify the return value and contents.
+        //    (C-1..2, 4)
+        //
+        // 2. Bulk erase a vector of keys, some of which do not exist, and
+        //    verify the return value and contents.  (C-3..4)
+        //
+        // Testing:
+        //   int insertBulk(INPUT_ITERATOR begin, INPUT_ITERATOR end);
+        //   int insertBulk(const bsl::vector<KVType>& data);
+        //   int insertBulk(bslmf::MovableRef<bsl::vector<KVType> > data);
+        //   int eraseBulk(INPUT_ITERATOR begin, INPUT_ITERATOR end);
+        //   int eraseBulk(const bsl::vector<KEY>& keys);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BULK MANIPULATORS" << endl
+                          << "=================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        Obj mX(&ta);  const Obj& X = mX;
+
+        mX.insert(5, "five");
+
+        bsl::vector<Obj::KVType> data(&ta);
+        for (int i = 0; i < 50; ++i) {
+            data.push_back(Obj::KVType(
+                              i,
+                              bsl::allocate_shared<bsl::string>(&ta, "v")));
+        }
+
+        ASSERT(49 == mX.insertBulk(data));
+        ASSERT(50 == X.size());
+        ASSERT(50 == data.size());
+
+        bsl::vector<Obj::KVType> moved(&ta);
+        for (int i = 50; i < 60; ++i) {
+            moved.push_back(Obj::KVType(
+                              i,
+                              bsl::allocate_shared<bsl::string>(&ta, "m")));
+        }
+
+        ASSERT(10 == mX.insertBulk(bslmf::MovableRefUtil::move(moved)));
+        ASSERT(60 == X.size());
+
+        for (int i = 0; i < 60; ++i) {
+            bsl::shared_ptr<bsl::string> value;
+            ASSERTV(i, 0 == mX.tryGetValue(&value, i));
+            ASSERTV(i, *value, (i < 50 ? "v" : "m") == *value);
+            ASSERTV(i, mX.shardAt(mX.shardIndexOf(i)).size() > 0);
+        }
+
+        bsl::vector<int> keys(&ta);
+        for (int i = 40; i < 80; ++i) {
+            keys.push_back(i);
+        }
+        ASSERT(20 == mX.eraseBulk(keys));
+        ASSERT(40 == X.size());
+
+        ASSERT( 0 == mX.eraseBulk(keys.begin(), keys.end()));
+        ASSERT(40 == X.size());
+
+        const int KEYS[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 100 };
+        ASSERT(10 == mX.eraseBulk(KEYS, KEYS + sizeof KEYS / sizeof *KEYS));
+        ASSERT(30 == X.size());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // BASIC MANIPULATORS
+        //
+        // Concerns:
+        // 1. Each `insert` overload stores the item in the shard selected by
+        //    its key, and replaces the value of an existing key.
+        //
+        // 2. `tryGetValue` finds exactly the inserted items.
+        //
+        // 3. `erase` removes only the specified key; `clear` removes all
+        //    items.
+        //
+        // 4. `size` is the sum of the sizes of the shards.
+        //
+        // Plan:
+        // 1. Using each `insert` overload, insert keys and verify them with
+        //    `tryGetValue`, `size`, and the size of the shard reported by
+        //    `shardIndexOf`.  (C-1..2, 4)
+        //
+        // 2. Erase and clear, and verify the contents.  (C-3..4)
+        //
+        // Testing:
+        //   void insert(const KEY& key, const VALUE& value);
+        //   void insert(const KEY& key, MovableRef<VALUE> value);
+        //   void insert(MovableRef<KEY> key, const VALUE& value);
+        //   void insert(MovableRef<KEY> key, MovableRef<VALUE> value);
+        //   void insert(const KEY& key, const ValuePtrType& valuePtr);
+        //   void insert(MovableRef<KEY> key, const ValuePtrType& valuePtr);
+        //   int tryGetValue(value, key, modifyEvictionQueue);
+        //   int erase(const KEY& key);
+        //   void clear();
+        //   bsl::size_t size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BASIC MANIPULATORS" << endl
+                          << "==================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        Obj mX(Policy::e_LRU, 100, 100, 8, &ta);  const Obj& X = mX;
+
+        bsl::shared_ptr<bsl::string> value;
+
+        {
+            const bsl::string v("a long string that will allocate memory",
+                                &ta);
+            mX.insert(1, v);
+        }
+        {
+            bsl::string v("another long string that will allocate", &ta);
+            mX.insert(2, bslmf::MovableRefUtil::move(v));
+        }
+        {
+            int k = 3;
+            mX.insert(bslmf::MovableRefUtil::move(k), bsl::string("c", &ta));
+        }
+        {
+            int         k = 4;
+            bsl::string v("d", &ta);
+            mX.insert(bslmf::MovableRefUtil::move(k),
+                      bslmf::MovableRefUtil::move(v));
+        }
+        {
+            mX.insert(5, bsl::allocate_shared<bsl::string>(&ta, "e"));
+        }
+        {
+            int k = 6;
+            mX.insert(bslmf::MovableRefUtil::move(k),
+                      bsl::allocate_shared<bsl::string>(&ta, "f"));
+        }
+
+        ASSERT(6 == X.size());
+
+        bsl::size_t sum = 0;
+        for (bsl::size_t s = 0; s < X.numShards(); ++s) {
+            sum += X.shardAt(s).size();
+        }
+        ASSERT(6 == sum);
+
+        const char *EXP[] = { 0,
+                              "a long string that will allocate memory",
+                              "another long string that will allocate",
+                              "c", "d", "e", "f" };
+        for (int k = 1; k <= 6; ++k) {
+            ASSERTV(k, 0 == mX.tryGetValue(&value, k));
+            ASSERTV(k, EXP[k] == *value);
+
+            const Obj::ShardType& shard = X.shardAt(X.shardIndexOf(k));
+            bsl::shared_ptr<bsl::string> shardValue;
+            ASSERTV(k, 0 == const_cast<Obj::ShardType&>(shard).tryGetValue(
+                                                        &shardValue, k, false));
+            ASSERTV(k, value == shardValue);
+        }
+        ASSERT(1 == mX.tryGetValue(&value, 7));
+
+        mX.insert(1, "replaced");
+        ASSERT(6 == X.size());
+        ASSERT(0 == mX.tryGetValue(&value, 1));
+        ASSERT("replaced" == *value);
+
+        ASSERT(0 == mX.erase(3));
+        ASSERT(1 == mX.erase(3));
+        ASSERT(5 == X.size());
+        ASSERT(1 == mX.tryGetValue(&value, 3));
+
+        mX.clear();
+        ASSERT(0 == X.size());
+        for (int k = 1; k <= 6; ++k) {
+            ASSERTV(k, 1 == mX.tryGetValue(&value, k));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        // 1. Each constructor creates an empty cache with the specified
+        //    policy, watermarks, and (rounded-up) number of shards.
+        //
+        // 2. The default constructor creates an LRU cache with no size limit
+        //    and `k_DEFAULT_NUM_SHARDS` shards.
+        //
+        // 3. The hash and equality functors are those supplied, and are
+        //    passed to each shard.
+        //
+        // 4. Each shard receives its share of the watermarks.
+        //
+        // 5. All memory comes from the supplied allocator, and is released
+        //    on destruction.
+        //
+        // 6. `shardIndexOf` is consistent with `ShardedCache_Util::shardIndex`
+        //    and the hash functor.
+        //
+        // 7. QoI: Asserted precondition violations are detected.
+        //
+        // Plan:
+        // 1. Create objects with each constructor and verify the accessors
+        //    and the shards.  (C-1..6)
+        //
+        // 2. Use `BSLS_ASSERTTEST_*` to verify that `shardAt` detects an
+        //    out-of-range index.  (C-7)
+        //
+        // Testing:
+        //   explicit ShardedCache(bslma::Allocator *basicAllocator);
+        //   ShardedCache(policy, lowWat, highWat, numShards, alloc);
+        //   ShardedCache(policy, lowWat, highWat, numShards, hash, equal, al);
+        //   ~ShardedCache();
+        //   EQUAL equalFunction() const;
+        //   CacheEvictionPolicy::Enum evictionPolicy() const;
+        //   HASH hashFunction() const;
+        //   bsl::size_t highWatermark() const;
+        //   bsl::size_t lowWatermark() const;
+        //   bsl::size_t numShards() const;
+        //   const ShardType& shardAt(bsl::size_t index) const;
+        //   bsl::size_t shardIndexOf(const KEY& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        const bsl::size_t k_MAX = bsl::numeric_limits<bsl::size_t>::max();
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(Obj::k_DEFAULT_NUM_SHARDS == X.numShards());
+            ASSERT(Policy::e_LRU == X.evictionPolicy());
+            ASSERT(k_MAX == X.lowWatermark());
+            ASSERT(k_MAX == X.highWatermark());
+            ASSERT(0 == X.size());
+            for (bsl::size_t s = 0; s < X.numShards(); ++s) {
+                ASSERTV(s, k_MAX == X.shardAt(s).lowWatermark());
+                ASSERTV(s, k_MAX == X.shardAt(s).highWatermark());
+                ASSERTV(s, Policy::e_LRU == X.shardAt(s).evictionPolicy());
+            }
+            ASSERT(0 < ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        static const struct {
+            int         d_line;
+            int         d_policy;
+            bsl::size_t d_low;
+            bsl::size_t d_high;
+            bsl::size_t d_numShards;
+            bsl::size_t d_expNumShards;
+            bsl::size_t d_expShardLow;
+            bsl::size_t d_expShardHigh;
+        } DATA[] = {
+            //LINE  POLICY         LOW   HIGH  NUM  EXP_NUM  EXP_L  EXP_H
+            //----  -------------  ----  ----  ---  -------  -----  -----
+            { L_,   Policy::e_LRU,    1,    1,   1,       1,     1,     1 },
+            { L_,   Policy::e_FIFO,  10,   20,   1,       1,    10,    20 },
+            { L_,   Policy::e_LRU,   10,   20,   2,       2,     5,    10 },
+            { L_,   Policy::e_FIFO,  10,   20,   3,       4,     3,     5 },
+            { L_,   Policy::e_LRU,  100,  101,   8,       8,    13,    13 },
+            { L_,   Policy::e_LRU,    1,    1,  16,      16,     1,     1 },
+            { L_,   Policy::e_FIFO, 700,  800,  17,      32,    22,    25 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int                LINE   = DATA[ti].d_line;
+            const Policy::Enum       POLICY =
+                                    static_cast<Policy::Enum>(DATA[ti].d_policy);
+            const bsl::size_t        LOW    = DATA[ti].d_low;
+            const bsl::size_t        HIGH   = DATA[ti].d_high;
+            const bsl::size_t        NUM    = DATA[ti].d_numShards;
+
+            {
+                Obj mX(POLICY, LOW, HIGH, NUM, &ta);  const Obj& X = mX;
+
+                ASSERTV(LINE, DATA[ti].d_expNumShards == X.numShards());
+                ASSERTV(LINE, POLICY == X.evictionPolicy());
+                ASSERTV(LINE, LOW    == X.lowWatermark());
+                ASSERTV(LINE, HIGH   == X.highWatermark());
+                ASSERTV(LINE, 0      == X.size());
+
+                for (bsl::size_t s = 0; s < X.numShards(); ++s) {
+                    ASSERTV(LINE, s, DATA[ti].d_expShardLow ==
+                                                   X.shardAt(s).lowWatermark());
+                    ASSERTV(LINE, s, DATA[ti].d_expShardHigh ==
+                                                  X.shardAt(s).highWatermark());
+                    ASSERTV(LINE, s, POLICY == X.shardAt(s).evictionPolicy());
+                }
+            }
+            ASSERTV(LINE, 0 == ta.numBlocksInUse());
+
+            {
+                typedef bdlcc::ShardedCache<int, int, TestHash, TestEqual>
+                                                                           ObjH;
+
+                ObjH mX(POLICY, LOW, HIGH, NUM, TestHash(3), TestEqual(7),
+                        &ta);
+                const ObjH& X = mX;
+
+                ASSERTV(LINE, DATA[ti].d_expNumShards == X.numShards());
+                ASSERTV(LINE, 3 == X.hashFunction().offset());
+                ASSERTV(LINE, 7 == X.equalFunction().id());
+
+                int shardBits = 0;
+                while ((bsl::size_t(1) << shardBits) < X.numShards()) {
+                    ++shardBits;
+                }
+
+                for (bsl::size_t s = 0; s < X.numShards(); ++s) {
+                    ASSERTV(LINE, s,
+                            3 == X.shardAt(s).hashFunction().offset());
+                    ASSERTV(LINE, s, 7 == X.shardAt(s).equalFunction().id());
+                }
+
+                for (int k = 0; k < 100; ++k) {
+                    ASSERTV(LINE, k, Util::shardIndex(k + 3, shardBits) ==
+                                                           X.shardIndexOf(k));
+                }
+            }
+            ASSERTV(LINE, 0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(Policy::e_LRU, 10, 20, 4, &ta);  const Obj& X = mX;
+
+            ASSERT_PASS(X.shardAt(0));
+            ASSERT_PASS(X.shardAt(3));
+            ASSERT_FAIL(X.shardAt(4));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // `ShardedCache_Util`
+        //
+        // Concerns:
+        // 1. `adjustedNumShards` returns the smallest power of two not less
+        //    than its argument, and 1 for 0.
+        //
+        // 2. `log2` returns the exponent of a power of two.
+        //
+        // 3. `shardWatermark` divides a watermark between shards, rounding
+        //    up, and preserves the "no limit" value.
+        //
+        // 4. `shardIndex` returns an index in range, and distributes
+        //    consecutive integers (i.e., identity hash values) evenly.
+        //
+        // Plan:
+        // 1. Use tables of inputs and expected results.  (C-1..3)
+        //
+        // 2. Hash a range of consecutive integers into each shard count and
+        //    verify each shard receives within 25% of its fair share.  (C-4)
+        //
+        // Testing:
+        //   bsl::size_t ShardedCache_Util::adjustedNumShards(bsl::size_t);
+        //   int ShardedCache_Util::log2(bsl::size_t);
+        //   bsl::size_t ShardedCache_Util::shardWatermark(size_t, size_t);
+        //   bsl::size_t ShardedCache_Util::shardIndex(bsl::size_t, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "`ShardedCache_Util`" << endl
+                          << "===================" << endl;
+
+        const bsl::size_t k_MAX = bsl::numeric_limits<bsl::size_t>::max();
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        ASSERT( 1 == Util::adjustedNumShards(0));
+        ASSERT( 1 == Util::adjustedNumShards(1));
+        ASSERT( 2 == Util::adjustedNumShards(2));
+        ASSERT( 4 == Util::adjustedNumShards(3));
+        ASSERT( 8 == Util::adjustedNumShards(5));
+        ASSERT(16 == Util::adjustedNumShards(16));
+        ASSERT(32 == Util::adjustedNumShards(17));
+
+        for (int i = 0; i < 20; ++i) {
+            ASSERTV(i, i == Util::log2(bsl::size_t(1) << i));
+        }
+
+        ASSERT(    1 == Util::shardWatermark(1, 1));
+        ASSERT(    1 == Util::shardWatermark(1, 16));
+        ASSERT(    5 == Util::shardWatermark(10, 2));
+        ASSERT(    4 == Util::shardWatermark(10, 3));
+        ASSERT(k_MAX == Util::shardWatermark(k_MAX, 8));
+
+        for (int bits = 0; bits <= 6; ++bits) {
+            const bsl::size_t numShards = bsl::size_t(1) << bits;
+            const int         k_NUM     = 64 * 1024;
+
+            bsl::vector<int> counts(numShards, 0, &ta);
+            for (int i = 0; i < k_NUM; ++i) {
+                const bsl::size_t idx = Util::shardIndex(i, bits);
+                ASSERTV(bits, i, idx, idx < numShards);
+                if (idx < numShards) {
+                    ++counts[idx];
+                }
+            }
+
+            const int fair = static_cast<int>(k_NUM / numShards);
+            for (bsl::size_t s = 0; s < numShards; ++s) {
+                ASSERTV(bits, s, counts[s], fair,
+                        counts[s] * 4 >= fair * 3 &&
+                                                 counts[s] * 4 <= fair * 5);
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Util::log2(4));
+            ASSERT_FAIL(Util::log2(0));
+            ASSERT_FAIL(Util::log2(6));
+            ASSERT_FAIL(Util::shardWatermark(10, 0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Create a cache, insert, look up, erase, and evict items.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        Obj mX(Policy::e_LRU, 8, 16, 4, &ta);  const Obj& X = mX;
+
+        ASSERT(4 == X.numShards());
+        ASSERT(0 == X.size());
+
+        mX.insert(1, "one");
+        mX.insert(2, "two");
+        ASSERT(2 == X.size());
+
+        bsl::shared_ptr<bsl::string> value;
+        ASSERT(0 == mX.tryGetValue(&value, 1));
+        ASSERT("one" == *value);
+        ASSERT(1 == mX.tryGetValue(&value, 3));
+
+        ASSERT(0 == mX.erase(1));
+        ASSERT(1 == X.size());
+
+        for (int i = 0; i < 100; ++i) {
+            mX.insert(i, "x");
+        }
+        ASSERTV(X.size(), X.size() <= 16);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // READ PERFORMANCE: `bdlcc::Cache` VS. `bdlcc::ShardedCache`
+        //   Compare the wall time of concurrent LRU lookups against a single
+        //   `bdlcc::Cache` and a `bdlcc::ShardedCache`.
+        //   2nd parameter: number of threads (default 8).
+        //   3rd parameter: number of lookups per thread (default 1000000).
+        //   4th parameter: number of shards (default 16).
+        //
+        // Concerns:
+        // 1. Report the throughput of each cache.
+        //
+        // Plan:
+        // 1. Pre-populate each cache, and time the lookups.  (C-1)
+        //
+        // Testing:
+        //   READ PERFORMANCE: `bdlcc::Cache` VS. `bdlcc::ShardedCache`
+        // --------------------------------------------------------------------
+
+        const int numThreads = argc > 2 ? atoi(argv[2]) : 8;
+        const int numReads   = argc > 3 ? atoi(argv[3]) : 1000000;
+        const int numShards  = argc > 4 ? atoi(argv[4]) : 16;
+        const int numItems   = 100000;
+
+        bslma::TestAllocator ta("perf", false);
+
+        bslma::DefaultAllocatorGuard guard(&ta);
+
+        double cacheNs, shardedNs;
+        {
+            bdlcc::Cache<int, int> cache(Policy::e_LRU,
+                                         numItems * 2,
+                                         numItems * 2,
+                                         &ta);
+            cacheNs = static_cast<double>(perf::timeReads(
+                                                  &cache,
+                                                  perf::cacheReaderThread,
+                                                  numThreads,
+                                                  numItems,
+                                                  numReads));
+        }
+        {
+            bdlcc::ShardedCache<int, int> cache(Policy::e_LRU,
+                                                numItems * 2,
+                                                numItems * 2,
+                                                numShards,
+                                                &ta);
+            shardedNs = static_cast<double>(perf::timeReads(
+                                                  &cache,
+                                                  perf::shardedReaderThread,
+                                                  numThreads,
+                                                  numItems,
+                                                  numReads));
+        }
+
+        const double totalReads = static_cast<double>(numThreads) * numReads;
+        cout << "threads: "        << numThreads
+             << ", reads/thread: " << numReads
+             << ", shards: "       << numShards << endl
+             << "bdlcc::Cache        : "
+             << totalReads / cacheNs * 1e3 << " Mops/s" << endl
+             << "bdlcc::ShardedCache : "
+             << totalReads / shardedNs * 1e3 << " Mops/s" << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    ASSERT(dam.isTotalSame());
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERT(gam.isTotalSame());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
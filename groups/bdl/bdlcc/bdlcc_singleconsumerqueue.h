@@ -29,6 +29,10 @@ BSLS_IDENT("$Id: $")
 // provided.  The `tryPopFront` method fails immediately, returning a non-zero
 // value, if the queue is empty.
 //
+// Batch methods, `pushBackBatch`, `tryPushBackBatch`, `popFrontBatch`, and
+// `tryPopFrontBatch`, transfer a contiguous array of elements, amortizing the
+// queue's internal synchronization over the elements of the batch.
+//
 // The queue may be placed into a "enqueue disabled" state using the
 // `disablePushBack` method.  When disabled, `pushBack` and `tryPushBack` fail
 // immediately and return an error code.  The queue may be restored to normal
@@ -241,6 +245,22 @@ class SingleConsumerQueue {
     /// undefined unless the invoker of this method is the single consumer.
     int popFront(TYPE* value);
 
+    /// Remove up to the specified `maxNumValues` elements from the front of
+    /// this queue, load them, in order, into the array starting at the
+    /// specified `values`, and load into the specified `numPopped` the number
+    /// of elements removed.  If the queue is empty, block until it is not
+    /// empty.  Return 0 on success, and a non-zero value otherwise.
+    /// Specifically, return `e_DISABLED` if `isPopFrontDisabled()`.  On
+    /// success, `*numPopped` is in the range `[1 .. maxNumValues]`; on
+    /// failure, `*numPopped` is 0 and `values` is not changed.  Threads
+    /// blocked due to the queue being empty will return `e_DISABLED` if
+    /// `disablePopFront` is invoked.  The behavior is undefined unless the
+    /// invoker of this method is the single consumer, `values` refers to an
+    /// array of at least `maxNumValues` elements, and `0 < maxNumValues`.
+    int popFrontBatch(TYPE        *values,
+                      bsl::size_t  maxNumValues,
+                      bsl::size_t *numPopped);
+
     /// Append the specified `value` to the back of this queue.  Return 0 on
     /// success, and a non-zero value otherwise.  Specifically, return
     /// `e_DISABLED` if `isPushBackDisabled()`.
@@ -253,6 +273,18 @@ class SingleConsumerQueue {
     /// changed.
     int pushBack(bslmf::MovableRef<TYPE> value);
 
+    /// Append, in order, the specified `numValues` elements of the array
+    /// starting at the specified `values` to the back of this queue.
+    /// Optionally specify `numPushed`, into which the number of appended
+    /// elements is loaded.  Return 0 on success, and a non-zero value
+    /// otherwise.  Specifically, return `e_DISABLED` if
+    /// `isPushBackDisabled()`.  On failure, a (possibly empty) prefix of
+    /// `values` may have been appended.  The behavior is undefined unless
+    /// `values` refers to an array of at least `numValues` elements.
+    int pushBackBatch(const TYPE  *values,
+                      bsl::size_t  numValues,
+                      bsl::size_t *numPushed = 0);
+
     /// Remove all items currently in this queue.  Note that this operation
     /// is not atomic; if other threads are concurrently pushing items into
     /// the queue the result of `numElements()` after this function returns
@@ -270,6 +302,21 @@ class SingleConsumerQueue {
     /// single consumer.
     int tryPopFront(TYPE *value);
 
+    /// Attempt to remove up to the specified `maxNumValues` elements from the
+    /// front of this queue without blocking, load them, in order, into the
+    /// array starting at the specified `values`, and load into the specified
+    /// `numPopped` the number of elements removed.  Return 0 on success, and
+    /// a non-zero value otherwise.  Specifically, return `e_DISABLED` if
+    /// `isPopFrontDisabled()`, and `e_EMPTY` if `!isPopFrontDisabled()` and
+    /// the queue was empty.  On success, `*numPopped` is in the range
+    /// `[1 .. maxNumValues]`; on failure, `*numPopped` is 0 and `values` is
+    /// not changed.  The behavior is undefined unless the invoker of this
+    /// method is the single consumer, `values` refers to an array of at least
+    /// `maxNumValues` elements, and `0 < maxNumValues`.
+    int tryPopFrontBatch(TYPE        *values,
+                         bsl::size_t  maxNumValues,
+                         bsl::size_t *numPopped);
+
     /// Append the specified `value` to the back of this queue.  Return 0 on
     /// success, and a non-zero value otherwise.  Specifically, return
     /// `e_DISABLED` if `isPushBackDisabled()`.
@@ -282,6 +329,18 @@ class SingleConsumerQueue {
     /// changed.
     int tryPushBack(bslmf::MovableRef<TYPE> value);
 
+    /// Append, in order, the specified `numValues` elements of the array
+    /// starting at the specified `values` to the back of this queue, and load
+    /// into the specified `numPushed` the number of elements appended.
+    /// Return 0 on success, and a non-zero value otherwise.  Specifically,
+    /// return `e_DISABLED` if `isPushBackDisabled()`.  On failure, a
+    /// (possibly empty) prefix of `values` may have been appended.  The
+    /// behavior is undefined unless `values` refers to an array of at least
+    /// `numValues` elements.
+    int tryPushBackBatch(const TYPE  *values,
+                         bsl::size_t  numValues,
+                         bsl::size_t *numPushed);
+
                        // Enqueue/Dequeue State
 
     /// Disable dequeueing from this queue.  All subsequent invocations of
@@ -373,6 +432,14 @@ int SingleConsumerQueue<TYPE>::popFront(TYPE *value)
     return d_impl.popFront(value);
 }
 
+template <class TYPE>
+int SingleConsumerQueue<TYPE>::popFrontBatch(TYPE        *values,
+                                             bsl::size_t  maxNumValues,
+                                             bsl::size_t *numPopped)
+{
+    return d_impl.popFrontBatch(values, maxNumValues, numPopped);
+}
+
 template <class TYPE>
 int SingleConsumerQueue<TYPE>::pushBack(const TYPE& value)
 {
@@ -385,6 +452,14 @@ int SingleConsumerQueue<TYPE>::pushBack(bslmf::MovableRef<TYPE> value)
     return d_impl.pushBack(bslmf::MovableRefUtil::move(value));
 }
 
+template <class TYPE>
+int SingleConsumerQueue<TYPE>::pushBackBatch(const TYPE  *values,
+                                             bsl::size_t  numValues,
+                                             bsl::size_t *numPushed)
+{
+    return d_impl.pushBackBatch(values, numValues, numPushed);
+}
+
 template <class TYPE>
 void SingleConsumerQueue<TYPE>::removeAll()
 {
@@ -397,6 +472,14 @@ int SingleConsumerQueue<TYPE>::tryPopFront(TYPE *value)
     return d_impl.tryPopFront(value);
 }
 
+template <class TYPE>
+int SingleConsumerQueue<TYPE>::tryPopFrontBatch(TYPE        *values,
+                                                bsl::size_t  maxNumValues,
+                                                bsl::size_t *numPopped)
+{
+    return d_impl.tryPopFrontBatch(values, maxNumValues, numPopped);
+}
+
 template <class TYPE>
 int SingleConsumerQueue<TYPE>::tryPushBack(const TYPE& value)
 {
@@ -409,6 +492,14 @@ int SingleConsumerQueue<TYPE>::tryPushBack(bslmf::MovableRef<TYPE> value)
     return d_impl.tryPushBack(bslmf::MovableRefUtil::move(value));
 }
 
+template <class TYPE>
+int SingleConsumerQueue<TYPE>::tryPushBackBatch(const TYPE  *values,
+                                                bsl::size_t  numValues,
+                                                bsl::size_t *numPushed)
+{
+    return d_impl.tryPushBackBatch(values, numValues, numPushed);
+}
+
                        // Enqueue/Dequeue State
 
 template <class TYPE>
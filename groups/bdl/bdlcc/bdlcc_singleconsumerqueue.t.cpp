@@ -81,12 +81,16 @@ using namespace bsl;
 // [ 5] SingleConsumerQueue(capacity, *bA = 0);
 // [ 2] ~SingleConsumerQueue();
 // [ 2] int popFront(TYPE *value);
+// [13] int popFrontBatch(TYPE *, size_t, size_t *);
 // [ 2] int pushBack(const TYPE& value);
 // [10] int pushBack(bslmf::MovableRef<TYPE> value);
+// [13] int pushBackBatch(const TYPE *, size_t, size_t * = 0);
 // [ 2] void removeAll();
 // [ 8] int tryPopFront(TYPE *value);
+// [13] int tryPopFrontBatch(TYPE *, size_t, size_t *);
 // [ 7] int tryPushBack(const TYPE& value);
 // [10] int tryPushBack(bslmf::MovableRef<TYPE> value);
+// [13] int tryPushBackBatch(const TYPE *, size_t, size_t *);
 // [ 6] void disablePopFront();
 // [ 6] void disablePushBack();
 // [ 6] void enablePopFront();
@@ -100,7 +104,7 @@ using namespace bsl;
 // [ 4] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [13] USAGE EXAMPLE
+// [14] USAGE EXAMPLE
 // [ 3] Obj& gg(Obj *object, const char *spec);
 // [ 3] int ggg(Obj *object, const char *spec);
 // [ 2] CONCERN: 0 == e_SUCCESS
@@ -843,7 +847,7 @@ int main(int argc, char *argv[])
                                       bsl::format("case {}", test)));
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 13: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -868,6 +872,77 @@ int main(int argc, char *argv[])
 
         myConsumer(k_NUM_THREADS);
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // BATCH OPERATIONS
+        //   The batch methods are thoroughly tested in the implementation
+        //   component; only the forwarding needs to be verified here.
+        //
+        // Concerns:
+        // 1. The batch methods forward their arguments to, and return the
+        //    result of, the corresponding implementation method.
+        //
+        // Plan:
+        // 1. Push and pop batches, using each of the batch methods, and verify
+        //    the return values, output counts, and values.  Disable the queue
+        //    and verify the return values.  (C-1)
+        //
+        // Testing:
+        //   int popFrontBatch(TYPE *, size_t, size_t *);
+        //   int pushBackBatch(const TYPE *, size_t, size_t * = 0);
+        //   int tryPopFrontBatch(TYPE *, size_t, size_t *);
+        //   int tryPushBackBatch(const TYPE *, size_t, size_t *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCH OPERATIONS" << endl
+                          << "================" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        AllocObj mX(&sa);  const AllocObj& X = mX;
+
+        const bsl::string VALUES[] = { "a",
+                                       "b",
+                                       "a string long enough to allocate",
+                                       "d",
+                                       "e" };
+
+        bsl::string results[5];
+        bsl::size_t num;
+
+        ASSERT(e_SUCCESS == mX.pushBackBatch(VALUES, 2));
+        ASSERT(e_SUCCESS == mX.tryPushBackBatch(VALUES + 2, 3, &num));
+        ASSERT(3 == num);
+        ASSERT(5 == X.numElements());
+
+        ASSERT(e_SUCCESS == mX.tryPopFrontBatch(results, 2, &num));
+        ASSERT(2 == num);
+        ASSERT(e_SUCCESS == mX.popFrontBatch(results + 2, 5, &num));
+        ASSERT(3 == num);
+        ASSERT(X.isEmpty());
+
+        for (int i = 0; i < 5; ++i) {
+            ASSERTV(i, results[i], VALUES[i] == results[i]);
+        }
+
+        ASSERT(e_EMPTY == mX.tryPopFrontBatch(results, 5, &num));
+        ASSERT(0 == num);
+
+        mX.disablePushBack();
+
+        ASSERT(e_DISABLED == mX.pushBackBatch(VALUES, 5, &num));
+        ASSERT(0 == num);
+        ASSERT(e_DISABLED == mX.tryPushBackBatch(VALUES, 5, &num));
+        ASSERT(0 == num);
+
+        mX.disablePopFront();
+
+        ASSERT(e_DISABLED == mX.popFrontBatch(results, 5, &num));
+        ASSERT(0 == num);
+        ASSERT(e_DISABLED == mX.tryPopFrontBatch(results, 5, &num));
+        ASSERT(0 == num);
+      } break;
       case 12: {
         // ---------------------------------------------------------
         // Ordering Guarantee Test
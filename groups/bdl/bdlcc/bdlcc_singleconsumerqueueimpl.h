@@ -29,6 +29,14 @@ BSLS_IDENT("$Id: $")
 // provided.  The `tryPopFront` method fails immediately, returning a non-zero
 // value, if the queue is empty.
 //
+// Batch methods, `pushBackBatch`, `tryPushBackBatch`, `popFrontBatch`, and
+// `tryPopFrontBatch`, transfer a contiguous array of elements.  A producer
+// invoking `pushBackBatch` reserves as many of the required nodes as are
+// available with a single update of the queue's shared state, and the consumer
+// invoking `popFrontBatch` returns all of the nodes it read to the producers
+// with a single update of the queue's shared state and a single check of the
+// "empty" condition.
+//
 // The queue may be placed into a "enqueue disabled" state using the
 // `disablePushBack` method.  When disabled, `pushBack` and `tryPushBack` fail
 // immediately and return an error code.  The queue may be restored to normal
@@ -53,6 +61,11 @@ BSLS_IDENT("$Id: $")
 // A `bdlcc::SingleConsumerQueueImpl` is exception neutral, and all of the
 // methods of `bdlcc::SingleConsumerQueueImpl` provide the basic exception
 // safety guarantee (see `bsldoc_glossary`).
+// If an exception occurs while writing the elements of a batch, the element
+// being written and all subsequent elements of the batch are not added to the
+// queue, and the preceding elements of the batch remain in the queue.  If an
+// exception occurs while reading the elements of a batch, the element being
+// read is removed from the queue and destroyed.
 //
 ///Move Semantics in C++03
 ///-----------------------
@@ -153,6 +166,53 @@ class SingleConsumerQueueImpl_MarkReclaimProctor {
     void release();
 };
 
+          // =====================================================
+          // class SingleConsumerQueueImpl_MarkReclaimBatchProctor
+          // =====================================================
+
+/// This class implements a proctor that automatically invokes `markReclaim`
+/// upon destruction on the `NODE`s, of a contiguous range of nodes reserved by
+/// a batch "push" operation, that have not been released from management by
+/// `advance`.
+template <class TYPE, class NODE>
+class SingleConsumerQueueImpl_MarkReclaimBatchProctor {
+
+    // DATA
+    TYPE        *d_queue_p;   // managed queue owning the managed nodes
+    NODE        *d_node_p;    // first managed node
+    bsl::size_t  d_numNodes;  // number of managed nodes
+
+  private:
+    // NOT IMPLEMENTED
+    SingleConsumerQueueImpl_MarkReclaimBatchProctor();
+    SingleConsumerQueueImpl_MarkReclaimBatchProctor(
+                       const SingleConsumerQueueImpl_MarkReclaimBatchProctor&);
+    SingleConsumerQueueImpl_MarkReclaimBatchProctor& operator=(
+                       const SingleConsumerQueueImpl_MarkReclaimBatchProctor&);
+
+  public:
+    // CREATORS
+
+    /// Create a `markReclaim` proctor managing the specified `numNodes`
+    /// contiguous nodes of the specified `queue` starting at the specified
+    /// `node`.
+    SingleConsumerQueueImpl_MarkReclaimBatchProctor(TYPE        *queue,
+                                                    NODE        *node,
+                                                    bsl::size_t  numNodes);
+
+    /// Destroy this object and invoke the `markReclaim` method of the managed
+    /// queue on each of the managed nodes.
+    ~SingleConsumerQueueImpl_MarkReclaimBatchProctor();
+
+    // MANIPULATORS
+
+    /// Release the first managed node from management, and manage the
+    /// remaining nodes starting at the specified `next` node.  The behavior
+    /// is undefined unless at least one node is managed, and `next` is the
+    /// node following the first managed node.
+    void advance(NODE *next);
+};
+
               // ==============================================
               // class SingleConsumerQueueImpl_PopCompleteGuard
               // ==============================================
@@ -185,6 +245,59 @@ class SingleConsumerQueueImpl_PopCompleteGuard {
     ~SingleConsumerQueueImpl_PopCompleteGuard();
 };
 
+           // ===================================================
+           // class SingleConsumerQueueImpl_PopBatchCompleteGuard
+           // ===================================================
+
+/// This class implements a guard that completes a batch "pop" operation on
+/// the managed queue upon destruction: if a node is being read, the guard
+/// invokes `popNodeComplete` on it, and the guard then invokes
+/// `popBatchComplete` with the number of nodes removed from the queue.
+template <class TYPE>
+class SingleConsumerQueueImpl_PopBatchCompleteGuard {
+
+    // DATA
+    TYPE        *d_queue_p;      // managed queue
+
+    bsl::size_t  d_numNodes;     // number of nodes removed
+
+    bool         d_readingFlag;  // 'true' if the front node is being read
+
+  private:
+    // NOT IMPLEMENTED
+    SingleConsumerQueueImpl_PopBatchCompleteGuard();
+    SingleConsumerQueueImpl_PopBatchCompleteGuard(
+                         const SingleConsumerQueueImpl_PopBatchCompleteGuard&);
+    SingleConsumerQueueImpl_PopBatchCompleteGuard& operator=(
+                         const SingleConsumerQueueImpl_PopBatchCompleteGuard&);
+
+  public:
+    // CREATORS
+
+    /// Create a batch "pop" guard managing the specified `queue`.
+    explicit
+    SingleConsumerQueueImpl_PopBatchCompleteGuard(TYPE *queue);
+
+    /// Destroy this object, invoke `popNodeComplete(true)` on the managed
+    /// queue if a node is being read, and then invoke `popBatchComplete` on
+    /// the managed queue with the number of removed nodes.
+    ~SingleConsumerQueueImpl_PopBatchCompleteGuard();
+
+    // MANIPULATORS
+
+    /// Indicate the front node of the managed queue is being read.
+    void beginRead();
+
+    /// Invoke `popNodeComplete` on the managed queue with the specified
+    /// `destruct`, and count the front node as removed.
+    void complete(bool destruct);
+
+    // ACCESSORS
+
+    /// Return the number of nodes removed.
+    bsl::size_t numNodes() const;
+};
+
              // ===============================================
              // class SingleConsumerQueueImpl_AllocateLockGuard
              // ===============================================
@@ -346,12 +459,28 @@ class SingleConsumerQueueImpl {
                                                             MUTEX,
                                                             CONDITION>::Node >;
 
+    friend class SingleConsumerQueueImpl_MarkReclaimBatchProctor<
+                           SingleConsumerQueueImpl<TYPE,
+                                                   ATOMIC_OP,
+                                                   MUTEX,
+                                                   CONDITION>,
+                           typename SingleConsumerQueueImpl<TYPE,
+                                                            ATOMIC_OP,
+                                                            MUTEX,
+                                                            CONDITION>::Node >;
+
     friend class SingleConsumerQueueImpl_PopCompleteGuard<
                                           SingleConsumerQueueImpl<TYPE,
                                                                   ATOMIC_OP,
                                                                   MUTEX,
                                                                   CONDITION> >;
 
+    friend class SingleConsumerQueueImpl_PopBatchCompleteGuard<
+                                          SingleConsumerQueueImpl<TYPE,
+                                                                  ATOMIC_OP,
+                                                                  MUTEX,
+                                                                  CONDITION> >;
+
     friend class SingleConsumerQueueImpl_AllocateLockGuard<
                                           SingleConsumerQueueImpl<TYPE,
                                                                   ATOMIC_OP,
@@ -375,12 +504,34 @@ class SingleConsumerQueueImpl {
     /// Mark the specified `node` as a node to be reclaimed.
     void markReclaim(Node *node);
 
+    /// Mark the specified `numNodes` contiguous nodes starting at the
+    /// specified `node` as nodes to be reclaimed.
+    void markReclaim(Node *node, bsl::size_t numNodes);
+
+    /// Make the specified `numNodes` nodes, previously removed from the front
+    /// of this queue by `popNodeComplete`, available to producers, and if the
+    /// queue is empty then signal the queue empty condition.
+    void popBatchComplete(bsl::size_t numNodes);
+
     /// If the specified `destruct` is true, destruct the value stored in
     /// `d_nextRead`.  Mark `d_nextRead` writable, and if the queue is empty
     /// then signal the queue empty condition.  This method is used to
     /// complete the reclamation of a node in the presence of an exception.
     void popComplete(bool destruct);
 
+    /// If the specified `destruct` is true, destruct the value stored in
+    /// `d_nextRead`.  Mark `d_nextRead` writable and advance `d_nextRead`.
+    /// Note that the node is not made available to producers until
+    /// `popBatchComplete` is invoked.
+    void popNodeComplete(bool destruct);
+
+    /// Return a pointer to the first of at least one and at most the number
+    /// of contiguous nodes specified by `numNodes` to assign the values being
+    /// pushed into this queue, and load into `numNodes` the number of nodes
+    /// reserved, or return 0 if `isPushBackDisabled()`.  The behavior is
+    /// undefined unless `0 < *numNodes`.
+    Node *pushBackBatchHelper(bsl::size_t *numNodes);
+
     /// Return a pointer to the node to assign the value being pushed into
     /// this queue, or 0 if `isPushBackDisabled()`.
     Node *pushBackHelper();
@@ -443,6 +594,22 @@ class SingleConsumerQueueImpl {
     /// undefined unless the invoker of this method is the single consumer.
     int popFront(TYPE *value);
 
+    /// Remove up to the specified `maxNumValues` elements from the front of
+    /// this queue, load them, in order, into the array starting at the
+    /// specified `values`, and load into the specified `numPopped` the number
+    /// of elements removed.  If the queue is empty, block until it is not
+    /// empty.  Return 0 on success, and a non-zero value otherwise.
+    /// Specifically, return `e_DISABLED` if `isPopFrontDisabled()`.  On
+    /// success, `*numPopped` is in the range `[1 .. maxNumValues]`; on
+    /// failure, `*numPopped` is 0 and `values` is not changed.  Threads
+    /// blocked due to the queue being empty will return `e_DISABLED` if
+    /// `disablePopFront` is invoked.  The behavior is undefined unless the
+    /// invoker of this method is the single consumer, `values` refers to an
+    /// array of at least `maxNumValues` elements, and `0 < maxNumValues`.
+    int popFrontBatch(TYPE        *values,
+                      bsl::size_t  maxNumValues,
+                      bsl::size_t *numPopped);
+
     /// Append the specified `value` to the back of this queue.  Return 0 on
     /// success, and a non-zero value otherwise.  Specifically, return
     /// `e_DISABLED` if `isPushBackDisabled()`.
@@ -455,6 +622,18 @@ class SingleConsumerQueueImpl {
     /// changed.
     int pushBack(bslmf::MovableRef<TYPE> value);
 
+    /// Append, in order, the specified `numValues` elements of the array
+    /// starting at the specified `values` to the back of this queue.
+    /// Optionally specify `numPushed`, into which the number of appended
+    /// elements is loaded.  Return 0 on success, and a non-zero value
+    /// otherwise.  Specifically, return `e_DISABLED` if
+    /// `isPushBackDisabled()`.  On failure, a (possibly empty) prefix of
+    /// `values` may have been appended.  The behavior is undefined unless
+    /// `values` refers to an array of at least `numValues` elements.
+    int pushBackBatch(const TYPE  *values,
+                      bsl::size_t  numValues,
+                      bsl::size_t *numPushed = 0);
+
     /// Remove all items currently in this queue.  Note that this operation
     /// is not atomic; if other threads are concurrently pushing items into
     /// the queue the result of `numElements()` after this function returns
@@ -472,6 +651,21 @@ class SingleConsumerQueueImpl {
     /// single consumer.
     int tryPopFront(TYPE *value);
 
+    /// Attempt to remove up to the specified `maxNumValues` elements from the
+    /// front of this queue without blocking, load them, in order, into the
+    /// array starting at the specified `values`, and load into the specified
+    /// `numPopped` the number of elements removed.  Return 0 on success, and
+    /// a non-zero value otherwise.  Specifically, return `e_DISABLED` if
+    /// `isPopFrontDisabled()`, and `e_EMPTY` if `!isPopFrontDisabled()` and
+    /// the queue was empty.  On success, `*numPopped` is in the range
+    /// `[1 .. maxNumValues]`; on failure, `*numPopped` is 0 and `values` is
+    /// not changed.  The behavior is undefined unless the invoker of this
+    /// method is the single consumer, `values` refers to an array of at least
+    /// `maxNumValues` elements, and `0 < maxNumValues`.
+    int tryPopFrontBatch(TYPE        *values,
+                         bsl::size_t  maxNumValues,
+                         bsl::size_t *numPopped);
+
     /// Append the specified `value` to the back of this queue.  Return 0 on
     /// success, and a non-zero value otherwise.  Specifically, retun
     /// `e_DISABLED` if `isPushBackDisabled()`.
@@ -484,6 +678,18 @@ class SingleConsumerQueueImpl {
     /// changed.
     int tryPushBack(bslmf::MovableRef<TYPE> value);
 
+    /// Append, in order, the specified `numValues` elements of the array
+    /// starting at the specified `values` to the back of this queue, and load
+    /// into the specified `numPushed` the number of elements appended.
+    /// Return 0 on success, and a non-zero value otherwise.  Specifically,
+    /// return `e_DISABLED` if `isPushBackDisabled()`.  On failure, a
+    /// (possibly empty) prefix of `values` may have been appended.  The
+    /// behavior is undefined unless `values` refers to an array of at least
+    /// `numValues` elements.
+    int tryPushBackBatch(const TYPE  *values,
+                         bsl::size_t  numValues,
+                         bsl::size_t *numPushed);
+
                        // Enqueue/Dequeue State
 
     /// Disable dequeueing from this queue.  All subsequent invocations of
@@ -577,6 +783,43 @@ void SingleConsumerQueueImpl_MarkReclaimProctor<TYPE, NODE>::release()
     d_queue_p = 0;
 }
 
+          // -----------------------------------------------------
+          // class SingleConsumerQueueImpl_MarkReclaimBatchProctor
+          // -----------------------------------------------------
+
+// CREATORS
+template <class TYPE, class NODE>
+SingleConsumerQueueImpl_MarkReclaimBatchProctor<TYPE, NODE>::
+                       SingleConsumerQueueImpl_MarkReclaimBatchProctor(
+                                                         TYPE        *queue,
+                                                         NODE        *node,
+                                                         bsl::size_t  numNodes)
+: d_queue_p(queue)
+, d_node_p(node)
+, d_numNodes(numNodes)
+{
+}
+
+template <class TYPE, class NODE>
+SingleConsumerQueueImpl_MarkReclaimBatchProctor<TYPE, NODE>::
+                             ~SingleConsumerQueueImpl_MarkReclaimBatchProctor()
+{
+    if (d_numNodes) {
+        d_queue_p->markReclaim(d_node_p, d_numNodes);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE, class NODE>
+void SingleConsumerQueueImpl_MarkReclaimBatchProctor<TYPE, NODE>::advance(
+                                                                    NODE *next)
+{
+    BSLS_ASSERT(0 < d_numNodes);
+
+    d_node_p = next;
+    --d_numNodes;
+}
+
               // ----------------------------------------------
               // class SingleConsumerQueueImpl_PopCompleteGuard
               // ----------------------------------------------
@@ -596,6 +839,60 @@ SingleConsumerQueueImpl_PopCompleteGuard<TYPE>::
     d_queue_p->popComplete(true);
 }
 
+           // ---------------------------------------------------
+           // class SingleConsumerQueueImpl_PopBatchCompleteGuard
+           // ---------------------------------------------------
+
+// CREATORS
+template <class TYPE>
+SingleConsumerQueueImpl_PopBatchCompleteGuard<TYPE>::
+                     SingleConsumerQueueImpl_PopBatchCompleteGuard(TYPE *queue)
+: d_queue_p(queue)
+, d_numNodes(0)
+, d_readingFlag(false)
+{
+}
+
+template <class TYPE>
+SingleConsumerQueueImpl_PopBatchCompleteGuard<TYPE>::
+                               ~SingleConsumerQueueImpl_PopBatchCompleteGuard()
+{
+    if (d_readingFlag) {
+        d_queue_p->popNodeComplete(true);
+        ++d_numNodes;
+    }
+    if (d_numNodes) {
+        d_queue_p->popBatchComplete(d_numNodes);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void SingleConsumerQueueImpl_PopBatchCompleteGuard<TYPE>::beginRead()
+{
+    d_readingFlag = true;
+}
+
+template <class TYPE>
+inline
+void SingleConsumerQueueImpl_PopBatchCompleteGuard<TYPE>::complete(
+                                                                 bool destruct)
+{
+    d_queue_p->popNodeComplete(destruct);
+    d_readingFlag = false;
+    ++d_numNodes;
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+bsl::size_t SingleConsumerQueueImpl_PopBatchCompleteGuard<TYPE>::numNodes()
+                                                                          const
+{
+    return d_numNodes;
+}
+
           // ------------------------------------------------------
           // class SingleConsumerQueueImpl_AllocateLockGuardProctor
           // ------------------------------------------------------
@@ -664,9 +961,49 @@ void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
     }
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                                ::markReclaim(Node *node, bsl::size_t numNodes)
+{
+    for (; numNodes; --numNodes) {
+        // Obtain the following node before 'node' is made visible to the
+        // consumer.
+
+        Node *next = static_cast<Node *>(ATOMIC_OP::getPtrAcquire(
+                                                               &node->d_next));
+        markReclaim(node);
+        node = next;
+    }
+}
+
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                                      ::popBatchComplete(bsl::size_t numNodes)
+{
+    bsls::Types::Int64 state = ATOMIC_OP::addInt64NvAcqRel(
+                                   &d_state,
+                                   k_AVAILABLE_INC
+                                 * static_cast<bsls::Types::Int64>(numNodes));
+
+    if (ATOMIC_OP::getInt64Acquire(&d_capacity) == available(state)) {
+        {
+            bslmt::LockGuard<MUTEX> guard(&d_emptyMutex);
+        }
+        d_emptyCondition.broadcast();
+    }
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
                                                    ::popComplete(bool destruct)
+{
+    popNodeComplete(destruct);
+    popBatchComplete(1);
+}
+
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                                               ::popNodeComplete(bool destruct)
 {
     Node *nextRead =
                     static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextRead));
@@ -679,16 +1016,78 @@ void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
 
     ATOMIC_OP::setPtrRelease(&d_nextRead,
                              ATOMIC_OP::getPtrAcquire(&nextRead->d_next));
+}
 
-    bsls::Types::Int64 state = ATOMIC_OP::addInt64NvAcqRel(&d_state,
-                                                           k_AVAILABLE_INC);
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+typename SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::Node *
+                     SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                                 ::pushBackBatchHelper(bsl::size_t *numNodes)
+{
+    BSLS_ASSERT(0 < *numNodes);
 
-    if (ATOMIC_OP::getInt64Acquire(&d_capacity) == available(state)) {
-        {
-            bslmt::LockGuard<MUTEX> guard(&d_emptyMutex);
-        }
-        d_emptyCondition.broadcast();
+    if (1 == (ATOMIC_OP::getUintAcquire(&d_pushBackDisabled) & 1)) {
+        return 0;                                                     // RETURN
     }
+
+    // Unlike the fast path of 'pushBackHelper', the reservation of several
+    // nodes is made with a compare-and-swap so that 'd_state' never reflects
+    // a reservation of more nodes than are available; the allocation logic
+    // in 'pushBackHelper' relies on each thread that has not yet undone a
+    // premature reservation having reserved exactly one node.  When no node
+    // is available (or an allocation is in progress), a single node is
+    // obtained from 'pushBackHelper', which performs any needed allocation.
+
+    bsls::Types::Int64 state = ATOMIC_OP::getInt64Acquire(&d_state);
+    bsls::Types::Int64 num;
+    bsls::Types::Int64 expState;
+
+    do {
+        const bsls::Types::Int64 avail = available(state);
+
+        if (avail <= 0 || 0 != (state & k_ALLOCATE_MASK)) {
+            *numNodes = 1;
+            return pushBackHelper();                                  // RETURN
+        }
+
+        num = static_cast<bsls::Types::Int64>(*numNodes) < avail
+              ? static_cast<bsls::Types::Int64>(*numNodes)
+              : avail;
+
+        expState = state;
+        state    = ATOMIC_OP::testAndSwapInt64AcqRel(
+                                    &d_state,
+                                    state,
+                                    state + k_USE_INC - k_AVAILABLE_INC * num);
+    } while (state != expState);
+
+    // Advance 'd_nextWrite' past the 'num' reserved nodes.  Allocation, the
+    // only modification of the node links, can not occur while this thread is
+    // counted in the use attribute of 'd_state'.
+
+    Node *nextWrite =
+                   static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextWrite));
+
+    Node *expNextWrite;
+    do {
+        expNextWrite = nextWrite;
+
+        Node *next = nextWrite;
+        for (bsls::Types::Int64 i = 0; i < num; ++i) {
+            next = static_cast<Node *>(
+                                      ATOMIC_OP::getPtrAcquire(&next->d_next));
+        }
+
+        nextWrite = static_cast<Node *>(ATOMIC_OP::testAndSwapPtrAcqRel(
+                                                                  &d_nextWrite,
+                                                                  nextWrite,
+                                                                  next));
+    } while (nextWrite != expNextWrite);
+
+    ATOMIC_OP::addInt64AcqRel(&d_state, -k_USE_INC);
+
+    *numNodes = static_cast<bsl::size_t>(num);
+
+    return nextWrite;
 }
 
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
@@ -1003,6 +1402,35 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::popFront(
     return 0;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::popFrontBatch(
+                                                     TYPE        *values,
+                                                     bsl::size_t  maxNumValues,
+                                                     bsl::size_t *numPopped)
+{
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 < maxNumValues);
+    BSLS_ASSERT(numPopped);
+
+    int rv = tryPopFrontBatch(values, maxNumValues, numPopped);
+    if (e_EMPTY != rv) {
+        return rv;                                                    // RETURN
+    }
+
+    rv = popFront(values);
+    if (rv) {
+        return rv;                                                    // RETURN
+    }
+
+    if (1 < maxNumValues) {
+        tryPopFrontBatch(values + 1, maxNumValues - 1, numPopped);
+    }
+
+    ++*numPopped;
+
+    return 0;
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::pushBack(
                                                              const TYPE& value)
@@ -1072,6 +1500,68 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::pushBack(
     return 0;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::pushBackBatch(
+                                                        const TYPE  *values,
+                                                        bsl::size_t  numValues,
+                                                        bsl::size_t *numPushed)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    bsl::size_t pushed = 0;
+    int         result = 0;
+
+    while (pushed < numValues) {
+        bsl::size_t  num    = numValues - pushed;
+        Node        *target = pushBackBatchHelper(&num);
+
+        if (0 == target) {
+            result = e_DISABLED;
+            break;                                                     // BREAK
+        }
+
+        SingleConsumerQueueImpl_MarkReclaimBatchProctor<
+                                            SingleConsumerQueueImpl<TYPE,
+                                                                    ATOMIC_OP,
+                                                                    MUTEX,
+                                                                    CONDITION>,
+                                            Node> proctor(this, target, num);
+
+        for (bsl::size_t i = 0; i < num; ++i) {
+            bslalg::ScalarPrimitives::copyConstruct(target->d_value.address(),
+                                                    values[pushed + i],
+                                                    allocator());
+
+            // Obtain the following node before 'target' is made visible to
+            // the consumer.
+
+            Node *next = static_cast<Node *>(ATOMIC_OP::getPtrAcquire(
+                                                             &target->d_next));
+
+            proctor.advance(next);
+
+            int nodeState = ATOMIC_OP::swapIntAcqRel(&target->d_state,
+                                                     e_READABLE);
+            if (e_WRITABLE_AND_BLOCKED == nodeState) {
+                {
+                    bslmt::LockGuard<MUTEX> guard(&d_readMutex);
+                }
+                d_readCondition.signal();
+            }
+
+            target = next;
+        }
+
+        pushed += num;
+    }
+
+    if (numPushed) {
+        *numPushed = pushed;
+    }
+
+    return result;
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::removeAll()
 {
@@ -1145,6 +1635,74 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPopFront(
     return 0;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                             ::tryPopFrontBatch(TYPE        *values,
+                                                bsl::size_t  maxNumValues,
+                                                bsl::size_t *numPopped)
+{
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 < maxNumValues);
+    BSLS_ASSERT(numPopped);
+
+    *numPopped = 0;
+
+    unsigned int generation = ATOMIC_OP::getUintAcquire(&d_popFrontDisabled);
+    if (1 == (generation & 1)) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    bsl::size_t numLoaded = 0;
+
+    {
+        // The nodes removed by this loop are made available to producers,
+        // and the queue empty condition is checked, once, by the guard.
+
+        SingleConsumerQueueImpl_PopBatchCompleteGuard<
+                              SingleConsumerQueueImpl<TYPE,
+                                                      ATOMIC_OP,
+                                                      MUTEX,
+                                                      CONDITION> > guard(this);
+
+        Node *nextRead =
+                    static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextRead));
+        int nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
+
+        while (numLoaded < maxNumValues
+            && (e_READABLE == nodeState || e_RECLAIM == nodeState)) {
+            if (e_RECLAIM == nodeState) {
+                ATOMIC_OP::addInt64AcqRel(&d_capacity, 1);
+                guard.complete(false);
+            }
+            else {
+                guard.beginRead();
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+                values[numLoaded] = bslmf::MovableRefUtil::move(
+                                                  nextRead->d_value.object());
+#else
+                values[numLoaded] = nextRead->d_value.object();
+#endif
+
+                ++numLoaded;
+                guard.complete(true);
+            }
+
+            nextRead =
+                    static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextRead));
+            nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
+        }
+    }
+
+    if (0 == numLoaded) {
+        return e_EMPTY;                                               // RETURN
+    }
+
+    *numPopped = numLoaded;
+
+    return 0;
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPushBack(
                                                              const TYPE& value)
@@ -1159,6 +1717,17 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPushBack(
     return pushBack(bslmf::MovableRefUtil::move(value));
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                             ::tryPushBackBatch(const TYPE  *values,
+                                                bsl::size_t  numValues,
+                                                bsl::size_t *numPushed)
+{
+    BSLS_ASSERT(numPushed);
+
+    return pushBackBatch(values, numValues, numPushed);
+}
+
                        // Enqueue/Dequeue State
 
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
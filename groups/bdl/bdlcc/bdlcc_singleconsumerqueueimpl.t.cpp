@@ -81,12 +81,16 @@ using namespace bsl;
 // [ 5] SingleConsumerQueueImpl(capacity, *bA = 0);
 // [ 2] ~SingleConsumerQueueImpl();
 // [ 2] int popFront(TYPE *value);
+// [15] int popFrontBatch(TYPE *, size_t, size_t *);
 // [ 2] int pushBack(const TYPE& value);
 // [10] int pushBack(bslmf::MovableRef<TYPE> value);
+// [15] int pushBackBatch(const TYPE *, size_t, size_t * = 0);
 // [ 2] void removeAll();
 // [ 8] int tryPopFront(TYPE *value);
+// [15] int tryPopFrontBatch(TYPE *, size_t, size_t *);
 // [ 7] int tryPushBack(const TYPE& value);
 // [10] int tryPushBack(bslmf::MovableRef<TYPE> value);
+// [15] int tryPushBackBatch(const TYPE *, size_t, size_t *);
 // [ 6] void disablePopFront();
 // [ 6] void disablePushBack();
 // [ 6] void enablePopFront();
@@ -150,6 +154,13 @@ void aSsErT(int c, const char *s, int i)
 #define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
 #define L_           BSLIM_TESTUTIL_L_  // current Line number
 
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
 // ============================================================================
 //                        GLOBAL MACROS FOR TESTING
 // ----------------------------------------------------------------------------
@@ -675,6 +686,62 @@ extern "C" void *deferredPopFront(void *arg)
     return 0;
 }
 
+extern "C" void *deferredPushBackBatch(void *arg)
+{
+    Obj& mX = *static_cast<Obj *>(arg);
+
+    bslmt::ThreadUtil::microSleep(100000);
+
+    const int values[3] = { 1, 2, 3 };
+
+    mX.pushBackBatch(values, 3);
+
+    return 0;
+}
+
+const int k_BATCH_NUM_PUSH_THREADS = 3;
+const int k_BATCH_NUM_PER_THREAD   = 20000;
+
+struct BatchData {
+    Obj *d_obj_p;
+    int  d_threadIndex;  // index of pushing thread
+};
+
+/// Push, using batches of varying size, `k_BATCH_NUM_PER_THREAD` values
+/// encoding the thread index and a sequence number to the queue of the
+/// specified `arg`, which refers to a `BatchData`.
+extern "C" void *batchPush(void *arg)
+{
+    BatchData& data = *static_cast<BatchData *>(arg);
+    Obj&       mX   = *data.d_obj_p;
+
+    int values[11];
+    int sequence = 0;
+    int size     = 1;
+
+    while (sequence < k_BATCH_NUM_PER_THREAD) {
+        int num = k_BATCH_NUM_PER_THREAD - sequence < size
+                  ? k_BATCH_NUM_PER_THREAD - sequence
+                  : size;
+
+        for (int i = 0; i < num; ++i) {
+            values[i] = data.d_threadIndex * k_BATCH_NUM_PER_THREAD
+                      + sequence
+                      + i;
+        }
+
+        bsl::size_t numPushed = 0;
+
+        ASSERT(e_SUCCESS == mX.pushBackBatch(values, num, &numPushed));
+        ASSERTV(num, numPushed, static_cast<bsl::size_t>(num) == numPushed);
+
+        sequence += num;
+        size      = size % 11 + 1;
+    }
+
+    return 0;
+}
+
 struct OrderingValue {
     bsls::Types::Uint64 d_pushThreadId;
     bsls::Types::Uint64 d_sequenceNumber;
@@ -954,6 +1021,345 @@ int main(int argc, char *argv[])
                                       bsl::format("case {}", test)));
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 15: {
+        // --------------------------------------------------------------------
+        // BATCH OPERATIONS
+        //
+        // Concerns:
+        // 1. `pushBackBatch` and `tryPushBackBatch` append all the supplied
+        //    elements, in order, allocating nodes as needed.
+        //
+        // 2. `popFrontBatch` and `tryPopFrontBatch` remove up to the
+        //    requested number of elements, in order; `tryPopFrontBatch`
+        //    returns `e_EMPTY` if the queue is empty, and `popFrontBatch`
+        //    blocks until the queue is not empty.
+        //
+        // 3. The batch methods return `e_DISABLED` when the queue is
+        //    disabled.
+        //
+        // 4. If the copy of an element of a batch throws, the preceding
+        //    elements remain in the queue, and the remaining elements are not
+        //    added.
+        //
+        // 5. Batch operations interoperate with concurrent batch operations,
+        //    preserving the order of the elements pushed by each thread.
+        //
+        // 6. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Push and pop batches of various sizes on queues with and without
+        //    pre-allocated capacity and verify the return values, output
+        //    counts, and values.  Block a `popFrontBatch` on an empty queue
+        //    until another thread pushes a batch.  (C-1..2)
+        //
+        // 2. Disable the queue and verify the return values.  (C-3)
+        //
+        // 3. Using a test allocator with an allocation limit, cause the copy
+        //    of the second element of a batch to throw and verify the state
+        //    of the queue.  (C-4)
+        //
+        // 4. Run several threads invoking `pushBackBatch` concurrently with
+        //    the consumer invoking `popFrontBatch` and verify the number and
+        //    ordering of the popped values.  (C-5)
+        //
+        // 5. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   int popFrontBatch(TYPE *, size_t, size_t *);
+        //   int pushBackBatch(const TYPE *, size_t, size_t * = 0);
+        //   int tryPopFrontBatch(TYPE *, size_t, size_t *);
+        //   int tryPushBackBatch(const TYPE *, size_t, size_t *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCH OPERATIONS" << endl
+                          << "================" << endl;
+
+        if (verbose) cout << "\nSingle-threaded batch operations." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            int         values[12] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+            int         results[12];
+            bsl::size_t num;
+
+            ASSERT(e_SUCCESS == mX.pushBackBatch(values, 5, &num));
+            ASSERT(5 == num);
+            ASSERT(5 == X.numElements());
+
+            ASSERT(e_SUCCESS == mX.tryPushBackBatch(values + 5, 7, &num));
+            ASSERT(7 == num);
+            ASSERT(12 == X.numElements());
+
+            ASSERT(e_SUCCESS == mX.tryPopFrontBatch(results, 3, &num));
+            ASSERT(3 == num);
+            for (int i = 0; i < 3; ++i) {
+                ASSERTV(i, results[i], i + 1 == results[i]);
+            }
+
+            ASSERT(e_SUCCESS == mX.popFrontBatch(results, 12, &num));
+            ASSERT(9 == num);
+            for (int i = 0; i < 9; ++i) {
+                ASSERTV(i, results[i], i + 4 == results[i]);
+            }
+            ASSERT(X.isEmpty());
+
+            num = 99;
+            ASSERT(e_EMPTY == mX.tryPopFrontBatch(results, 12, &num));
+            ASSERT(0 == num);
+
+            ASSERT(e_SUCCESS == mX.pushBackBatch(values, 0, &num));
+            ASSERT(0 == num);
+            ASSERT(X.isEmpty());
+        }
+
+        if (verbose) cout << "\nBatches with node allocation." << endl;
+        {
+            for (int capacity = 0; capacity < 12; capacity += 3) {
+                Obj mX(capacity);  const Obj& X = mX;
+
+                int next     = 0;
+                int expected = 0;
+
+                for (int iteration = 0; iteration < 50; ++iteration) {
+                    const int pushSize = iteration % 17 + 1;
+                    const int popSize  = (iteration * 3) % 8 + 1;
+
+                    int         values[17];
+                    bsl::size_t num;
+
+                    for (int i = 0; i < pushSize; ++i) {
+                        values[i] = next++;
+                    }
+
+                    ASSERT(e_SUCCESS == mX.pushBackBatch(values,
+                                                         pushSize,
+                                                         &num));
+                    ASSERTV(capacity, iteration, num,
+                            pushSize == static_cast<int>(num));
+
+                    // Leave some elements in the queue on even iterations.
+
+                    while (X.numElements() > (iteration % 2 ? 0u : 3u)) {
+                        ASSERT(e_SUCCESS == mX.tryPopFrontBatch(values,
+                                                                popSize,
+                                                                &num));
+                        ASSERT(0 < num && popSize >= static_cast<int>(num));
+
+                        for (bsl::size_t i = 0; i < num; ++i) {
+                            ASSERTV(capacity, iteration, values[i], expected,
+                                    expected == values[i]);
+                            ++expected;
+                        }
+                    }
+                }
+                ASSERTV(capacity, next, expected, next == expected);
+            }
+        }
+
+        if (verbose) cout << "\nBlocking `popFrontBatch`." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            bslmt::ThreadUtil::Handle handle;
+            bslmt::ThreadUtil::create(&handle, deferredPushBackBatch, &mX);
+
+            int         results[5];
+            bsl::size_t num;
+            bsl::size_t total = 0;
+
+            while (total < 3) {
+                ASSERT(e_SUCCESS == mX.popFrontBatch(results + total,
+                                                     5 - total,
+                                                     &num));
+                ASSERT(0 < num);
+                total += num;
+            }
+
+            ASSERT(3 == total);
+            ASSERT(1 == results[0]);
+            ASSERT(2 == results[1]);
+            ASSERT(3 == results[2]);
+            ASSERT(X.isEmpty());
+
+            bslmt::ThreadUtil::join(handle);
+        }
+
+        if (verbose) cout << "\nBatch operations and disablement." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            int         values[4] = { 1, 2, 3, 4 };
+            bsl::size_t num;
+
+            mX.disablePushBack();
+
+            num = 99;
+            ASSERT(e_DISABLED == mX.pushBackBatch(values, 4, &num));
+            ASSERT(0 == num);
+            num = 99;
+            ASSERT(e_DISABLED == mX.tryPushBackBatch(values, 4, &num));
+            ASSERT(0 == num);
+            ASSERT(X.isEmpty());
+
+            mX.enablePushBack();
+
+            ASSERT(e_SUCCESS == mX.pushBackBatch(values, 4));
+
+            mX.disablePopFront();
+
+            num = 99;
+            ASSERT(e_DISABLED == mX.popFrontBatch(values, 4, &num));
+            ASSERT(0 == num);
+            num = 99;
+            ASSERT(e_DISABLED == mX.tryPopFrontBatch(values, 4, &num));
+            ASSERT(0 == num);
+            ASSERT(4 == X.numElements());
+
+            mX.enablePopFront();
+            mX.removeAll();
+
+            // A `popFrontBatch` on an empty queue blocks, and returns when pop
+            // is disabled.
+
+            bslmt::ThreadUtil::Handle handle;
+            bslmt::ThreadUtil::create(&handle, deferredDisablePopFront, &mX);
+
+            num = 99;
+            ASSERT(e_DISABLED == mX.popFrontBatch(values, 4, &num));
+            ASSERT(0 == num);
+
+            bslmt::ThreadUtil::join(handle);
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) cout << "\nException during `pushBackBatch`." << endl;
+        {
+            // white-box test for when the element copy throws
+
+            typedef bdlcc::SingleConsumerQueueImpl<AllocExceptionHelper,
+                                                   bsls::AtomicOperations,
+                                                   bslmt::Mutex,
+                                                   bslmt::Condition> ExcObj;
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            ExcObj mX(4, &sa);  const ExcObj& X = mX;
+
+            AllocExceptionHelper              value(&sa);
+            bsl::vector<AllocExceptionHelper> values(4, value, &sa);
+            bsl::vector<AllocExceptionHelper> results(4, value, &sa);
+            bsl::size_t                       num;
+
+            int numException = 0;
+
+            sa.setAllocationLimit(1);
+            try {
+                mX.pushBackBatch(values.data(), 3);
+            } catch (BloombergLP::bslma::TestAllocatorException& e) {
+                ++numException;
+            }
+            sa.setAllocationLimit(-1);
+
+            ASSERT(1 == numException);
+            ASSERT(1 == X.numElements());
+
+            ASSERT(e_SUCCESS == mX.tryPopFrontBatch(results.data(), 4, &num));
+            ASSERT(1 == num);
+            ASSERT(X.isEmpty());
+
+            ASSERT(e_SUCCESS == mX.pushBackBatch(values.data(), 4, &num));
+            ASSERT(4 == num);
+            ASSERT(4 == X.numElements());
+
+            // The failed elements are skipped (and reclaimed) by the consumer.
+
+            ASSERT(e_SUCCESS == mX.popFrontBatch(results.data(), 4, &num));
+            ASSERT(4 == num);
+            ASSERT(X.isEmpty());
+        }
+#endif
+
+        if (verbose) cout << "\nConcurrent batch operations." << endl;
+        {
+            Obj mX;
+
+            BatchData                 pushData[k_BATCH_NUM_PUSH_THREADS];
+            bslmt::ThreadUtil::Handle pushHandle[k_BATCH_NUM_PUSH_THREADS];
+
+            for (int i = 0; i < k_BATCH_NUM_PUSH_THREADS; ++i) {
+                pushData[i].d_obj_p       = &mX;
+                pushData[i].d_threadIndex = i;
+
+                bslmt::ThreadUtil::create(&pushHandle[i],
+                                          batchPush,
+                                          &pushData[i]);
+            }
+
+            int last[k_BATCH_NUM_PUSH_THREADS];
+            for (int i = 0; i < k_BATCH_NUM_PUSH_THREADS; ++i) {
+                last[i] = -1;
+            }
+
+            int         values[7];
+            bsl::size_t num;
+            int         numPopped = 0;
+
+            while (numPopped <
+                          k_BATCH_NUM_PUSH_THREADS * k_BATCH_NUM_PER_THREAD) {
+                ASSERT(e_SUCCESS == mX.popFrontBatch(values, 7, &num));
+                ASSERT(0 < num && 7 >= num);
+
+                for (bsl::size_t i = 0; i < num; ++i) {
+                    int thread   = values[i] / k_BATCH_NUM_PER_THREAD;
+                    int sequence = values[i] % k_BATCH_NUM_PER_THREAD;
+
+                    ASSERTV(thread,
+                            0 <= thread && k_BATCH_NUM_PUSH_THREADS > thread);
+                    ASSERTV(thread, last[thread], sequence,
+                            last[thread] + 1 == sequence);
+
+                    last[thread] = sequence;
+                }
+
+                numPopped += static_cast<int>(num);
+            }
+
+            for (int i = 0; i < k_BATCH_NUM_PUSH_THREADS; ++i) {
+                bslmt::ThreadUtil::join(pushHandle[i]);
+            }
+
+            ASSERT(mX.isEmpty());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX;
+
+            int         values[4] = { 1, 2, 3, 4 };
+            bsl::size_t num;
+
+            ASSERT_PASS(mX.pushBackBatch(values, 2, &num));
+            ASSERT_PASS(mX.pushBackBatch(0, 0, &num));
+            ASSERT_FAIL(mX.pushBackBatch(0, 2, &num));
+
+            ASSERT_PASS(mX.tryPushBackBatch(values, 2, &num));
+            ASSERT_FAIL(mX.tryPushBackBatch(values, 2, 0));
+
+            ASSERT_PASS(mX.tryPopFrontBatch(values, 2, &num));
+            ASSERT_FAIL(mX.tryPopFrontBatch(0, 2, &num));
+            ASSERT_FAIL(mX.tryPopFrontBatch(values, 0, &num));
+            ASSERT_FAIL(mX.tryPopFrontBatch(values, 2, 0));
+
+            ASSERT_PASS(mX.popFrontBatch(values, 2, &num));
+            ASSERT_FAIL(mX.popFrontBatch(0, 2, &num));
+            ASSERT_FAIL(mX.popFrontBatch(values, 0, &num));
+            ASSERT_FAIL(mX.popFrontBatch(values, 2, 0));
+        }
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // DRQS 176476958: `disablePopFront` races with `popFront`
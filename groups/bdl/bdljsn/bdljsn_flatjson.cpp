@@ -0,0 +1,612 @@
+// bdljsn_flatjson.cpp                                                -*-C++-*-
+#include <bdljsn_flatjson.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdljsn_flatjson_cpp, "$Id$ $CSID$")
+
+#include <bdljsn_json.h>
+#include <bdljsn_jsonnumber.h>
+#include <bdljsn_location.h>
+#include <bdljsn_scanutil.h>
+#include <bdljsn_stringutil.h>
+
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_limits.h>
+
+///Implementation Notes
+///--------------------
+// The parser works directly on `d_text`, the (modifiable) copy of the input,
+// rather than through a `Tokenizer`: the text of strings, keys, and numbers
+// is referred to in place, and strings having escape sequences are decoded
+// in place, which is possible because decoding never lengthens a string.
+// The text is validated as UTF-8 as a whole before parsing, as the
+// `e_STRICT_20240119` mode of `Tokenizer` validates all of its input.
+//
+// The parser is iterative.  A stack of open arrays and objects, and a stack
+// of the (node indices of the) children found so far for each of them, are
+// maintained; when an array or object is closed, its children are appended
+// to `d_children`, the keys of an object being sorted (by a stable sort, so
+// that the first of duplicate keys is kept) and deduplicated.  The nesting
+// depth is limited as by `JsonUtil::read`: the number of nested arrays and
+// objects must not exceed `ReadOptions::maxNestedDepth`.
+
+namespace BloombergLP {
+namespace bdljsn {
+namespace {
+namespace u {
+
+/// Load into the specified `error`, if not 0, an `Error` having the
+/// specified `message` and the location of the specified `position` in the
+/// text starting at the specified `begin`.  Return -1.
+int setError(Error                   *error,
+             const char              *begin,
+             const char              *position,
+             const bsl::string_view&  message)
+{
+    if (error) {
+        error->setMessage(message);
+        error->setLocation(Location(position - begin));
+    }
+    return -1;
+}
+
+/// This class provides a functor ordering the indices of key nodes (of the
+/// template parameter `NODE` type) by the text of the keys.
+template <class NODE>
+class KeyLess {
+
+    // DATA
+    const char *d_text_p;   // text of the document
+    const NODE *d_nodes_p;  // nodes of the document
+
+    // PRIVATE ACCESSORS
+
+    /// Return the text of the key at the specified `index`.
+    bsl::string_view key(bsl::uint32_t index) const
+    {
+        return bsl::string_view(d_text_p + d_nodes_p[index].d_offset,
+                                d_nodes_p[index].d_size);
+    }
+
+  public:
+    // CREATORS
+
+    /// Create a functor comparing the keys described by the specified
+    /// `nodes` in the specified `text`.
+    KeyLess(const char *text, const NODE *nodes)
+    : d_text_p(text)
+    , d_nodes_p(nodes)
+    {
+    }
+
+    // ACCESSORS
+
+    /// Return `true` if the key at the specified `lhs` index is less than
+    /// the key at the specified `rhs` index, and `false` otherwise.
+    bool operator()(bsl::uint32_t lhs, bsl::uint32_t rhs) const
+    {
+        return key(lhs) < key(rhs);
+    }
+};
+
+/// Load into the specified `result` the whole contents of the specified
+/// `input`.
+void readAll(bsl::string *result, bsl::streambuf *input)
+{
+    char            buffer[8 * 1024];
+    bsl::streamsize numRead;
+    while (0 < (numRead = input->sgetn(buffer, sizeof buffer))) {
+        result->append(buffer, static_cast<bsl::size_t>(numRead));
+    }
+}
+
+/// This `struct` describes an open array or object.
+struct Frame {
+    // DATA
+    bsl::uint32_t d_node;           // index of the node of the container
+    bsl::size_t   d_firstPending;   // index in the pending children of the
+                                    // first child of the container
+};
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                               // --------------
+                               // class FlatJson
+                               // --------------
+
+// CLASS DATA
+const FlatJson::Node FlatJson::s_nullNode = { JsonType::e_NULL, 0, 0 };
+
+// PRIVATE MANIPULATORS
+int FlatJson::parse(Error *error, const ReadOptions& options)
+{
+    BSLS_ASSERT(d_nodes.empty());
+    BSLS_ASSERT(d_children.empty());
+
+    if (d_text.size() >= bsl::numeric_limits<bsl::uint32_t>::max()) {
+        return u::setError(error,                                     // RETURN
+                           d_text.data(),
+                           d_text.data(),
+                           "Document too large");
+    }
+
+    char       *const base = d_text.empty() ? 0 : &d_text[0];
+    const char *const end  = base + d_text.size();
+
+    int         status;
+    const char *valid = ScanUtil::validateUtf8(&status, base, end);
+    if (0 != status) {
+        return u::setError(error, base, valid, "Invalid UTF-8");      // RETURN
+    }
+
+    // Typical documents have a value or key per 8 to 16 characters.
+
+    d_nodes.reserve(d_text.size() / 16 + 1);
+
+    bslma::Allocator *allocator = this->allocator();
+
+    bsl::vector<u::Frame>      stack(allocator);
+    bsl::vector<bsl::uint32_t> pending(allocator);
+    bsl::string                scratch(allocator);
+
+    const bsl::size_t maxDepth = options.maxNestedDepth();
+
+    const char *p = ScanUtil::skipWhitespace(base, end, false);
+
+    enum { e_VALUE, e_KEY, e_AFTER_VALUE, e_DONE } state = e_VALUE;
+
+    while (e_DONE != state) {
+        switch (state) {
+          case e_KEY:
+          case e_VALUE: {
+            if (p == end) {
+                return u::setError(error,                             // RETURN
+                                   base,
+                                   p,
+                                   "Unexpected end of input");
+            }
+
+            const bool isKey = e_KEY == state;
+
+            if (isKey && '"' != *p) {
+                return u::setError(error,                             // RETURN
+                                   base,
+                                   p,
+                                   "Expected a member name");
+            }
+
+            const bsl::uint32_t index =
+                                 static_cast<bsl::uint32_t>(d_nodes.size());
+
+            Node entry = { JsonType::e_NULL, 0, 0 };
+
+            if ('{' == *p || '[' == *p) {
+                if (stack.size() >= maxDepth) {
+                    return u::setError(error,                         // RETURN
+                                       base,
+                                       p,
+                                       "Maximum nesting depth exceeded");
+                }
+                const bool isObject = '{' == *p;
+
+                entry.d_type = isObject ? JsonType::e_OBJECT
+                                       : JsonType::e_ARRAY;
+
+                if (!stack.empty() &&
+                    JsonType::e_ARRAY == d_nodes[stack.back().d_node].d_type) {
+                    pending.push_back(index);
+                }
+                d_nodes.push_back(entry);
+
+                u::Frame frame = { index, pending.size() };
+                stack.push_back(frame);
+
+                p = ScanUtil::skipWhitespace(p + 1, end, false);
+                if (p != end && (isObject ? '}' : ']') == *p) {
+
+                    // The container is empty: close it now.
+
+                    ++p;
+                    d_nodes[index].d_offset =
+                                 static_cast<bsl::uint32_t>(d_children.size());
+                    stack.pop_back();
+                    state = e_AFTER_VALUE;
+                }
+                else {
+                    state = isObject ? e_KEY : e_VALUE;
+                }
+                break;
+            }
+
+            if ('"' == *p) {
+                char       *begin   = base + (p + 1 - base);
+                const char *q       = begin;
+                bool        escaped = false;
+
+                for (;;) {
+                    q = ScanUtil::findStringSpecial(q, end);
+                    if (q == end) {
+                        return u::setError(error,                     // RETURN
+                                           base,
+                                           p,
+                                           "Unterminated string");
+                    }
+                    if ('"' == *q) {
+                        break;
+                    }
+                    if ('\\' != *q) {
+                        return u::setError(error,                     // RETURN
+                                           base,
+                                           q,
+                                           "Unescaped control character");
+                    }
+                    escaped = true;
+                    if (end - q < 2) {
+                        return u::setError(error,                     // RETURN
+                                           base,
+                                           p,
+                                           "Unterminated string");
+                    }
+                    q += 2;
+                }
+
+                bsl::size_t length = q - begin;
+                if (escaped) {
+                    if (0 != StringUtil::readUnquotedString(
+                                         &scratch,
+                                         bsl::string_view(begin, length))) {
+                        return u::setError(error,                     // RETURN
+                                           base,
+                                           p,
+                                           "Invalid escape sequence");
+                    }
+                    BSLS_ASSERT(scratch.size() <= length);
+
+                    length = scratch.size();
+                    bsl::memcpy(begin, scratch.data(), length);
+                }
+
+                entry.d_type   = JsonType::e_STRING;
+                entry.d_size   = static_cast<bsl::uint32_t>(length);
+                entry.d_offset = static_cast<bsl::uint32_t>(begin - base);
+
+                p = q + 1;
+            }
+            else {
+                const char *q = ScanUtil::findValueEnd(p, end);
+
+                const bsl::string_view token(p, q - p);
+                if (token.empty()) {
+                    return u::setError(error,                         // RETURN
+                                       base,
+                                       p,
+                                       "Unexpected character");
+                }
+
+                if ("true" == token || "false" == token) {
+                    entry.d_type = JsonType::e_BOOLEAN;
+                    entry.d_size = 't' == *p;
+                }
+                else if ("null" == token) {
+                    entry.d_type = JsonType::e_NULL;
+                }
+                else if (NumberUtil::isValidNumber(token)) {
+                    entry.d_type   = JsonType::e_NUMBER;
+                    entry.d_size   = static_cast<bsl::uint32_t>(token.size());
+                    entry.d_offset = static_cast<bsl::uint32_t>(p - base);
+                }
+                else {
+                    return u::setError(error,                         // RETURN
+                                       base,
+                                       p,
+                                       "Invalid JSON value");
+                }
+                p = q;
+            }
+
+            if (isKey ||
+                (!stack.empty() &&
+                 JsonType::e_ARRAY == d_nodes[stack.back().d_node].d_type)) {
+                pending.push_back(index);
+            }
+            d_nodes.push_back(entry);
+
+            if (isKey) {
+                p = ScanUtil::skipWhitespace(p, end, false);
+                if (p == end || ':' != *p) {
+                    return u::setError(error,                         // RETURN
+                                       base,
+                                       p,
+                                       "Expected ':' after member name");
+                }
+                p     = ScanUtil::skipWhitespace(p + 1, end, false);
+                state = e_VALUE;
+            }
+            else {
+                state = e_AFTER_VALUE;
+            }
+          } break;
+          case e_AFTER_VALUE: {
+            if (stack.empty()) {
+                state = e_DONE;
+                break;
+            }
+
+            p = ScanUtil::skipWhitespace(p, end, false);
+            if (p == end) {
+                return u::setError(error,                             // RETURN
+                                   base,
+                                   p,
+                                   "Unexpected end of input");
+            }
+
+            const u::Frame frame     = stack.back();
+            Node&          container = d_nodes[frame.d_node];
+            const bool     isObject  = JsonType::e_OBJECT == container.d_type;
+
+            if (',' == *p) {
+                p     = ScanUtil::skipWhitespace(p + 1, end, false);
+                state = isObject ? e_KEY : e_VALUE;
+                break;
+            }
+
+            if ((isObject ? '}' : ']') != *p) {
+                return u::setError(error,                             // RETURN
+                                   base,
+                                   p,
+                                   isObject ? "Expected ',' or '}'"
+                                            : "Expected ',' or ']'");
+            }
+            ++p;
+
+            // Close the container, moving its children from 'pending' to
+            // 'd_children'.
+
+            typedef bsl::vector<bsl::uint32_t>::iterator Iterator;
+
+            const Iterator first = pending.begin() + frame.d_firstPending;
+
+            if (isObject) {
+                const u::KeyLess<Node> less(base, d_nodes.data());
+
+                bsl::stable_sort(first, pending.end(), less);
+
+                // Remove duplicate keys, keeping the first.
+
+                Iterator out = first;
+                for (Iterator it = first; it != pending.end(); ++it) {
+                    if (out == first || less(*(out - 1), *it)) {
+                        *out++ = *it;
+                    }
+                }
+                pending.erase(out, pending.end());
+            }
+
+            container.d_size   = static_cast<bsl::uint32_t>(pending.end() -
+                                                                first);
+            container.d_offset =
+                                 static_cast<bsl::uint32_t>(d_children.size());
+            d_children.insert(d_children.end(), first, pending.end());
+            pending.erase(first, pending.end());
+            stack.pop_back();
+          } break;
+          default: {
+            BSLS_ASSERT(false && "unreachable");
+          } break;
+        }
+    }
+
+    if (!options.allowTrailingText()) {
+        p = ScanUtil::skipWhitespace(p, end, false);
+        if (p != end) {
+            return u::setError(error,                                 // RETURN
+                               base,
+                               p,
+                               "Additional text found after document");
+        }
+    }
+
+    return 0;
+}
+
+int FlatJson::readImp(Error                   *error,
+                      const bsl::string_view&  input,
+                      const ReadOptions&       options)
+{
+    FlatJson document(allocator());
+
+    document.d_text.assign(input.data(), input.size());
+
+    const int rc = document.parse(error, options);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    swap(document);
+    return 0;
+}
+
+// CREATORS
+FlatJson::FlatJson()
+: d_text()
+, d_nodes()
+, d_children()
+{
+}
+
+FlatJson::FlatJson(bslma::Allocator *basicAllocator)
+: d_text(basicAllocator)
+, d_nodes(basicAllocator)
+, d_children(basicAllocator)
+{
+}
+
+FlatJson::FlatJson(const FlatJson& original, bslma::Allocator *basicAllocator)
+: d_text(original.d_text, basicAllocator)
+, d_nodes(original.d_nodes, basicAllocator)
+, d_children(original.d_children, basicAllocator)
+{
+}
+
+FlatJson::~FlatJson()
+{
+}
+
+// MANIPULATORS
+FlatJson& FlatJson::operator=(const FlatJson& rhs)
+{
+    FlatJson(rhs, allocator()).swap(*this);
+    return *this;
+}
+
+int FlatJson::read(bsl::streambuf *input, const ReadOptions& options)
+{
+    BSLS_ASSERT(input);
+
+    bsl::string text(allocator());
+    u::readAll(&text, input);
+
+    return readImp(0, text, options);
+}
+
+int FlatJson::read(Error              *error,
+                   bsl::streambuf     *input,
+                   const ReadOptions&  options)
+{
+    BSLS_ASSERT(error);
+    BSLS_ASSERT(input);
+
+    bsl::string text(allocator());
+    u::readAll(&text, input);
+
+    return readImp(error, text, options);
+}
+
+void FlatJson::reset()
+{
+    d_text.clear();
+    d_nodes.clear();
+    d_children.clear();
+}
+
+void FlatJson::swap(FlatJson& other)
+{
+    BSLS_ASSERT(allocator() == other.allocator());
+
+    d_text.swap(other.d_text);
+    d_nodes.swap(other.d_nodes);
+    d_children.swap(other.d_children);
+}
+
+                            // -------------------
+                            // class FlatJsonValue
+                            // -------------------
+
+// ACCESSORS
+void FlatJsonValue::toJson(Json *result) const
+{
+    BSLS_ASSERT(result);
+
+    switch (type()) {
+      case JsonType::e_OBJECT: {
+        const FlatJsonObject object = theObject();
+
+        JsonObject& resultObject = result->makeObject();
+        for (bsl::size_t i = 0; i < object.size(); ++i) {
+            object.value(i).toJson(&resultObject[object.key(i)]);
+        }
+      } break;
+      case JsonType::e_ARRAY: {
+        const FlatJsonArray array = theArray();
+
+        JsonArray& resultArray = result->makeArray();
+        resultArray.resize(array.size());
+        for (bsl::size_t i = 0; i < array.size(); ++i) {
+            array[i].toJson(&resultArray[i]);
+        }
+      } break;
+      case JsonType::e_STRING: {
+        result->makeString(theString());
+      } break;
+      case JsonType::e_NUMBER: {
+        result->makeNumber(JsonNumber(theNumber().value(),
+                                      result->allocator()));
+      } break;
+      case JsonType::e_BOOLEAN: {
+        result->makeBoolean(theBoolean());
+      } break;
+      default: {
+        BSLS_ASSERT(isNull());
+
+        result->makeNull();
+      } break;
+    }
+}
+
+                           // --------------------
+                           // class FlatJsonObject
+                           // --------------------
+
+// ACCESSORS
+bsl::size_t FlatJsonObject::find(const bsl::string_view& key) const
+{
+    bsl::size_t low  = 0;
+    bsl::size_t high = size();
+
+    while (low < high) {
+        const bsl::size_t middle = low + (high - low) / 2;
+        const int         cmp    = this->key(middle).compare(key);
+
+        if (0 == cmp) {
+            return middle;                                            // RETURN
+        }
+        if (cmp < 0) {
+            low = middle + 1;
+        }
+        else {
+            high = middle;
+        }
+    }
+    return size();
+}
+
+}  // close package namespace
+
+// FREE FUNCTIONS
+void bdljsn::swap(FlatJson& a, FlatJson& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    FlatJson futureA(b, a.allocator());
+    FlatJson futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
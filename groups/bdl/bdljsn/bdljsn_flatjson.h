@@ -0,0 +1,1063 @@
+// bdljsn_flatjson.h                                                  -*-C++-*-
+#ifndef INCLUDED_BDLJSN_FLATJSON
+#define INCLUDED_BDLJSN_FLATJSON
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an immutable JSON document stored in flat arrays.
+//
+//@CLASSES:
+//  bdljsn::FlatJson:       immutable JSON document in contiguous storage
+//  bdljsn::FlatJsonValue:  reference to a value of a `FlatJson` document
+//  bdljsn::FlatJsonArray:  reference to an array of a `FlatJson` document
+//  bdljsn::FlatJsonObject: reference to an object of a `FlatJson` document
+//  bdljsn::FlatJsonNumber: reference to a number of a `FlatJson` document
+//
+//@SEE_ALSO: bdljsn_json, bdljsn_jsonutil
+//
+//@DESCRIPTION: This component provides a class, `bdljsn::FlatJson`, that
+// holds an immutable JSON document read from JSON text, and the reference
+// types `bdljsn::FlatJsonValue`, `bdljsn::FlatJsonArray`,
+// `bdljsn::FlatJsonObject`, and `bdljsn::FlatJsonNumber` that provide
+// read-only access to the values of the document, through an interface
+// modeled on that of `bdljsn::Json` (i.e., `type`, `isObject`, `theObject`,
+// `operator[]`, `contains`, `visit`, etc.).
+//
+// `bdljsn::Json` is a general-purpose, modifiable representation in which
+// each object is a hash table and each value, key, and string is separately
+// allocated.  Reading a document into a `bdljsn::Json` with
+// `bdljsn::JsonUtil::read` therefore costs at least one allocation per value
+// and a hash computation per key.  For documents that are read far more
+// often than they are modified (e.g., the payload of a request), a
+// `bdljsn::FlatJson` provides the same read access at a fraction of the cost
+// of reading and of the memory.
+//
+///Representation
+///--------------
+// A `bdljsn::FlatJson` keeps a copy of the JSON text of the document, and
+// describes the values of the document in two arrays:
+//
+// * An array of fixed-size *nodes*, one per value and per key, in document
+//   order.  The node of a string, number, or key refers to its text by offset
+//   and length; the node of an array or object refers to its children in the
+//   child array.
+//
+// * An array of *children*, in which the node indices of the elements of each
+//   array, and of the keys of each object, are stored contiguously.  The keys
+//   of each object are sorted, so that a member is found by binary search
+//   (for small objects, a handful of comparisons), and its value is the node
+//   following that of its key.
+//
+// Strings are not copied: the node of a string having no escape sequence
+// refers to the text of the document directly, and a string having escape
+// sequences is decoded in place (a decoded string is never longer than its
+// encoding).  Therefore, reading a document costs a small, fixed number of
+// allocations irrespective of the number of values it has, and the memory
+// used is about the length of the text plus 12 bytes per value and 4 bytes
+// per element or member.
+//
+// A `bdljsn::FlatJson` cannot be modified, other than by reading another
+// document.  Note that the reference types returned by the accessors of a
+// `bdljsn::FlatJson` are valid only as long as the document is neither
+// modified nor destroyed.  A `bdljsn::FlatJsonValue` can be converted to a
+// (modifiable) `bdljsn::Json` by its `toJson` method.
+//
+///Reading JSON Text
+///-----------------
+// `bdljsn::FlatJson::read` accepts exactly the JSON text accepted by
+// `bdljsn::JsonUtil::read` (i.e., RFC 8259 JSON, as for the
+// `e_STRICT_20240119` mode of `bdljsn::Tokenizer`), and honors the same
+// `bdljsn::ReadOptions`.  As for `bdljsn::JsonUtil::read`, if an object has
+// duplicate keys, the value of the FIRST instance of the key is kept.  On
+// failure, an optionally supplied `bdljsn::Error` is loaded with a
+// description of the error, and the location of the character at which it
+// was detected.  Note that when reading from a `bsl::streambuf`, the whole of
+// its contents is consumed, even if `allowTrailingText` is `true`.
+//
+///Order of Object Members
+///-----------------------
+// The members of a `bdljsn::FlatJsonObject` are ordered by key (i.e., by
+// `bsl::string_view` comparison), not in document order.  Note that the
+// members of a `bdljsn::JsonObject` have no particular order either.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reading a Request Payload
+///- - - - - - - - - - - - - - - - - - -
+// Suppose we receive requests having a JSON payload, from which we need a few
+// fields.
+//
+// First, we define the payload of a request:
+// ```
+// const char *PAYLOAD = "{\n"
+//                       "    \"user\": \"jsmith\",\n"
+//                       "    \"limit\": 25,\n"
+//                       "    \"tickers\": [\"IBM\", \"AAPL\", \"MSFT\"],\n"
+//                       "    \"note\": \"caf\\u00e9\"\n"
+//                       "}";
+// ```
+// Then, we read the payload into a `bdljsn::FlatJson`:
+// ```
+// bdljsn::FlatJson document;
+// bdljsn::Error    error;
+//
+// int rc = document.read(&error, PAYLOAD);
+// assert(0 == rc);
+// ```
+// Next, we access the fields of the request, through the same interface that
+// a `bdljsn::Json` provides:
+// ```
+// bdljsn::FlatJsonValue request = document.root();
+// assert(request.isObject());
+// assert(4 == request.size());
+//
+// assert("jsmith" == request["user"].theString());
+//
+// int limit;
+// rc = request["limit"].theNumber().asInt(&limit);
+// assert(0  == rc);
+// assert(25 == limit);
+//
+// bdljsn::FlatJsonArray tickers = request["tickers"].theArray();
+// assert(3      == tickers.size());
+// assert("AAPL" == tickers[1].theString());
+//
+// assert(!request.contains("account"));
+// ```
+// Notice that escape sequences have been decoded:
+// ```
+// assert("caf\xc3\xa9" == request["note"].theString());
+// ```
+// Finally, if we need a modifiable copy of (part of) the document, we convert
+// it to a `bdljsn::Json`:
+// ```
+// bdljsn::Json json;
+// request["tickers"].toJson(&json);
+// assert(json.isArray());
+// assert(3 == json.size());
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdljsn_error.h>
+#include <bdljsn_jsonnull.h>
+#include <bdljsn_jsontype.h>
+#include <bdljsn_numberutil.h>
+#include <bdljsn_readoptions.h>
+
+#include <bdldfp_decimal.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_streambuf.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdljsn {
+
+class FlatJsonArray;
+class FlatJsonNumber;
+class FlatJsonObject;
+class FlatJsonValue;
+class Json;
+
+                               // ==============
+                               // class FlatJson
+                               // ==============
+
+/// This class holds an immutable JSON document, read from JSON text, in
+/// contiguous storage (see [](#Representation)).  The values of the document
+/// are accessed through the reference returned by `root`.  A
+/// default-constructed `FlatJson` holds a document whose only value is
+/// `null`.
+class FlatJson {
+
+    // PRIVATE TYPES
+
+    /// This `struct` describes a value or key of the document.
+    struct Node {
+        // DATA
+        bsl::uint32_t d_type;    // `JsonType::Enum` of the value
+
+        bsl::uint32_t d_size;    // length of a string, number, or key;
+                                 // number of elements or members of an array
+                                 // or object; 1 for `true`
+
+        bsl::uint32_t d_offset;  // offset of the text of a string, number, or
+                                 // key in `d_text`; offset of the children of
+                                 // an array or object in `d_children`
+    };
+
+    // CLASS DATA
+    static const Node s_nullNode;  // root of an empty document
+
+    // DATA
+    bsl::string                d_text;      // JSON text of the document,
+                                            // with strings decoded in place
+
+    bsl::vector<Node>          d_nodes;     // values and keys, in document
+                                            // order
+
+    bsl::vector<bsl::uint32_t> d_children;  // node indices of the elements
+                                            // of arrays and of the keys of
+                                            // objects (sorted)
+
+    // FRIENDS
+    friend class FlatJsonArray;
+    friend class FlatJsonNumber;
+    friend class FlatJsonObject;
+    friend class FlatJsonValue;
+
+    // PRIVATE MANIPULATORS
+
+    /// Parse the JSON text in `d_text` (already loaded) into `d_nodes` and
+    /// `d_children` according to the specified `options`.  Return 0 on
+    /// success, and a non-zero value, loading a description of the error
+    /// into the specified `error`, otherwise.
+    int parse(Error *error, const ReadOptions& options);
+
+    /// Read into this object the JSON text in the specified `input`
+    /// according to the specified `options`.  Return 0 on success, and a
+    /// non-zero value, loading a description of the error into the
+    /// specified `error` if `error` is not 0, otherwise.  This object is
+    /// unchanged on failure.
+    int readImp(Error                   *error,
+                const bsl::string_view&  input,
+                const ReadOptions&       options);
+
+    // PRIVATE ACCESSORS
+
+    /// Return a reference to the node at the specified `index`.
+    const Node& node(bsl::uint32_t index) const;
+
+    /// Return the text of the specified `node`.
+    bsl::string_view text(const Node& node) const;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatJson, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+
+    /// Create a `FlatJson` object holding a document whose only value is
+    /// `null`.  Optionally specify a `basicAllocator` used to supply
+    /// memory.  If `basicAllocator` is 0, the currently installed default
+    /// allocator is used.
+    FlatJson();
+    explicit FlatJson(bslma::Allocator *basicAllocator);
+
+    /// Create a `FlatJson` object holding a copy of the document held by
+    /// the specified `original` object.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.  Note that
+    /// references obtained from `original` continue to refer to
+    /// `original`.
+    FlatJson(const FlatJson& original, bslma::Allocator *basicAllocator = 0);
+
+    /// Destroy this object.
+    ~FlatJson();
+
+    // MANIPULATORS
+
+    /// Assign to this object a copy of the document held by the specified
+    /// `rhs` object, and return a reference providing modifiable access to
+    /// this object.
+    FlatJson& operator=(const FlatJson& rhs);
+
+    /// Read into this object the JSON document in the specified `input`.
+    /// Optionally specify `options` to configure the reading (see
+    /// `bdljsn_readoptions`).  Optionally specify `error`, loaded with a
+    /// description of the error on failure.  Return 0 on success, and a
+    /// non-zero value otherwise.  This object is unchanged on failure.  If
+    /// `input` is a `bsl::streambuf`, its whole contents are consumed.
+    int read(const bsl::string_view& input);
+    int read(const bsl::string_view& input, const ReadOptions& options);
+    int read(Error *error, const bsl::string_view& input);
+    int read(Error                   *error,
+             const bsl::string_view&  input,
+             const ReadOptions&       options);
+    int read(bsl::streambuf *input);
+    int read(bsl::streambuf *input, const ReadOptions& options);
+    int read(Error *error, bsl::streambuf *input);
+    int read(Error              *error,
+             bsl::streambuf     *input,
+             const ReadOptions&  options);
+
+    /// Reset this object to hold a document whose only value is `null`.
+    void reset();
+
+    /// Efficiently exchange the value of this object with the value of the
+    /// specified `other` object.  This method provides the no-throw
+    /// exception-safety guarantee.  The behavior is undefined unless this
+    /// object was created with the same allocator as `other`.
+    void swap(FlatJson& other);
+
+    // ACCESSORS
+
+    /// Return a reference to the root value of the document held by this
+    /// object.
+    FlatJsonValue root() const;
+
+    /// Return the number of values in the document held by this object,
+    /// including the keys of its objects.
+    bsl::size_t numNodes() const;
+
+                                  // Aspects
+
+    /// Return the allocator used by this object to supply memory.
+    bslma::Allocator *allocator() const;
+};
+
+                            // ===================
+                            // class FlatJsonValue
+                            // ===================
+
+/// This class provides a reference to a value of a `FlatJson` document.
+/// The reference is valid as long as the document is neither modified nor
+/// destroyed.
+class FlatJsonValue {
+
+    // DATA
+    const FlatJson       *d_document_p;  // document holding the value
+    const FlatJson::Node *d_node_p;      // node of the value
+
+    // FRIENDS
+    friend class FlatJson;
+    friend class FlatJsonArray;
+    friend class FlatJsonObject;
+
+    // PRIVATE CREATORS
+
+    /// Create a reference to the value described by the specified `node`
+    /// of the specified `document`.
+    FlatJsonValue(const FlatJson *document, const FlatJson::Node *node);
+
+  public:
+    // ACCESSORS
+
+    /// Return the type of the referenced value.
+    JsonType::Enum type() const;
+
+    /// Return `true` if the referenced value is an array, and `false`
+    /// otherwise.
+    bool isArray() const;
+
+    /// Return `true` if the referenced value is `true` or `false`, and
+    /// `false` otherwise.
+    bool isBoolean() const;
+
+    /// Return `true` if the referenced value is `null`, and `false`
+    /// otherwise.
+    bool isNull() const;
+
+    /// Return `true` if the referenced value is a number, and `false`
+    /// otherwise.
+    bool isNumber() const;
+
+    /// Return `true` if the referenced value is an object, and `false`
+    /// otherwise.
+    bool isObject() const;
+
+    /// Return `true` if the referenced value is a string, and `false`
+    /// otherwise.
+    bool isString() const;
+
+    /// Return a reference to the referenced array.  The behavior is
+    /// undefined unless `isArray()`.
+    FlatJsonArray theArray() const;
+
+    /// Return the referenced boolean.  The behavior is undefined unless
+    /// `isBoolean()`.
+    bool theBoolean() const;
+
+    /// Return a `JsonNull` object.  The behavior is undefined unless
+    /// `isNull()`.
+    JsonNull theNull() const;
+
+    /// Return a reference to the referenced number.  The behavior is
+    /// undefined unless `isNumber()`.
+    FlatJsonNumber theNumber() const;
+
+    /// Return a reference to the referenced object.  The behavior is
+    /// undefined unless `isObject()`.
+    FlatJsonObject theObject() const;
+
+    /// Return the (decoded) referenced string.  The behavior is undefined
+    /// unless `isString()`.
+    bsl::string_view theString() const;
+
+    /// Return a reference to the value of the member of the referenced
+    /// object having the specified `key`.  The behavior is undefined unless
+    /// `isObject()` and `contains(key)`.
+    FlatJsonValue operator[](const bsl::string_view& key) const;
+
+    /// Return a reference to the element at the specified `index` of the
+    /// referenced array.  The behavior is undefined unless `isArray()` and
+    /// `index < size()`.
+    FlatJsonValue operator[](bsl::size_t index) const;
+
+    /// Return `true` if the referenced object has a member having the
+    /// specified `key`, and `false` otherwise.  The behavior is undefined
+    /// unless `isObject()`.
+    bool contains(const bsl::string_view& key) const;
+
+    /// Return the number of members of the referenced object, or of
+    /// elements of the referenced array.  The behavior is undefined unless
+    /// `isObject()` or `isArray()`.
+    bsl::size_t size() const;
+
+    /// Load into the specified `result` a `Json` having the referenced
+    /// value.
+    void toJson(Json *result) const;
+
+    /// Invoke the specified `visitor` with the referenced value, as a
+    /// `FlatJsonObject`, `FlatJsonArray`, `bsl::string_view`,
+    /// `FlatJsonNumber`, `bool`, or `JsonNull` according to `type()`, and
+    /// return the value it returns.
+    template <class RETURN_TYPE, class VISITOR>
+    RETURN_TYPE visit(VISITOR& visitor) const;
+    template <class RETURN_TYPE, class VISITOR>
+    RETURN_TYPE visit(const VISITOR& visitor) const;
+};
+
+                            // ===================
+                            // class FlatJsonArray
+                            // ===================
+
+/// This class provides a reference to an array of a `FlatJson` document.
+/// The reference is valid as long as the document is neither modified nor
+/// destroyed.
+class FlatJsonArray {
+
+    // DATA
+    const FlatJson       *d_document_p;  // document holding the array
+    const FlatJson::Node *d_node_p;      // node of the array
+
+    // FRIENDS
+    friend class FlatJsonValue;
+
+    // PRIVATE CREATORS
+
+    /// Create a reference to the array described by the specified `node`
+    /// of the specified `document`.
+    FlatJsonArray(const FlatJson *document, const FlatJson::Node *node);
+
+  public:
+    // ACCESSORS
+
+    /// Return a reference to the element at the specified `index` of the
+    /// referenced array.  The behavior is undefined unless
+    /// `index < size()`.
+    FlatJsonValue operator[](bsl::size_t index) const;
+
+    /// Return `true` if the referenced array has no elements, and `false`
+    /// otherwise.
+    bool empty() const;
+
+    /// Return the number of elements of the referenced array.
+    bsl::size_t size() const;
+};
+
+                           // ====================
+                           // class FlatJsonObject
+                           // ====================
+
+/// This class provides a reference to an object of a `FlatJson` document.
+/// The members of the object are ordered by key.  The reference is valid as
+/// long as the document is neither modified nor destroyed.
+class FlatJsonObject {
+
+    // DATA
+    const FlatJson       *d_document_p;  // document holding the object
+    const FlatJson::Node *d_node_p;      // node of the object
+
+    // FRIENDS
+    friend class FlatJsonValue;
+
+    // PRIVATE CREATORS
+
+    /// Create a reference to the object described by the specified `node`
+    /// of the specified `document`.
+    FlatJsonObject(const FlatJson *document, const FlatJson::Node *node);
+
+    // PRIVATE ACCESSORS
+
+    /// Return the index of the node of the key at the specified `position`.
+    bsl::uint32_t keyNode(bsl::size_t position) const;
+
+  public:
+    // ACCESSORS
+
+    /// Return a reference to the value of the member having the specified
+    /// `key`.  The behavior is undefined unless `contains(key)`.
+    FlatJsonValue operator[](const bsl::string_view& key) const;
+
+    /// Return `true` if the referenced object has a member having the
+    /// specified `key`, and `false` otherwise.
+    bool contains(const bsl::string_view& key) const;
+
+    /// Return `true` if the referenced object has no members, and `false`
+    /// otherwise.
+    bool empty() const;
+
+    /// Return the position of the member having the specified `key`, and
+    /// `size()` if there is no such member.
+    bsl::size_t find(const bsl::string_view& key) const;
+
+    /// Return the (decoded) key of the member at the specified `position`.
+    /// The behavior is undefined unless `position < size()`.
+    bsl::string_view key(bsl::size_t position) const;
+
+    /// Return the number of members of the referenced object.
+    bsl::size_t size() const;
+
+    /// Return a reference to the value of the member at the specified
+    /// `position`.  The behavior is undefined unless `position < size()`.
+    FlatJsonValue value(bsl::size_t position) const;
+};
+
+                           // ====================
+                           // class FlatJsonNumber
+                           // ====================
+
+/// This class provides a reference to a number of a `FlatJson` document,
+/// providing the conversions of `JsonNumber`.  The reference is valid as
+/// long as the document is neither modified nor destroyed.
+class FlatJsonNumber {
+
+    // DATA
+    bsl::string_view d_value;  // text of the number
+
+    // FRIENDS
+    friend class FlatJsonValue;
+
+    // PRIVATE CREATORS
+
+    /// Create a reference to the number having the specified `value` text.
+    explicit FlatJsonNumber(const bsl::string_view& value);
+
+  public:
+    // ACCESSORS
+
+    /// Return `true` if the referenced number is an integer, and `false`
+    /// otherwise.  Note that a number having a fraction or exponent may be
+    /// an integer (e.g., "1.0" and "1e2").
+    bool isIntegral() const;
+
+    /// Return the text of the referenced number.
+    bsl::string_view value() const;
+
+    /// Load into the specified `result` the integer value of the referenced
+    /// number.  Return 0 on success, `NumberUtil::k_OVERFLOW` if the number
+    /// is larger than can be represented by `result`,
+    /// `NumberUtil::k_UNDERFLOW` if it is smaller, and
+    /// `NumberUtil::k_NOT_INTEGRAL` if it is not an integer (in which case
+    /// `result` is loaded with the truncated value).  See `JsonNumber`.
+    int asInt   (int                 *result) const;
+    int asInt64 (bsls::Types::Int64  *result) const;
+    int asUint  (unsigned int        *result) const;
+    int asUint64(bsls::Types::Uint64 *result) const;
+
+    /// Return the closest floating-point value to the referenced number.
+    float             asFloat()     const;
+    double            asDouble()    const;
+    bdldfp::Decimal64 asDecimal64() const;
+
+    /// Load into the specified `result` the closest `Decimal64` value to
+    /// the referenced number.  Return 0 if the conversion is exact, and
+    /// `NumberUtil::k_INEXACT` otherwise.
+    int asDecimal64Exact(bdldfp::Decimal64 *result) const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                               // --------------
+                               // class FlatJson
+                               // --------------
+
+// PRIVATE ACCESSORS
+inline
+const FlatJson::Node& FlatJson::node(bsl::uint32_t index) const
+{
+    BSLS_ASSERT(index < d_nodes.size());
+
+    return d_nodes[index];
+}
+
+inline
+bsl::string_view FlatJson::text(const Node& node) const
+{
+    BSLS_ASSERT(node.d_offset + node.d_size <= d_text.size());
+
+    return bsl::string_view(d_text.data() + node.d_offset, node.d_size);
+}
+
+// MANIPULATORS
+inline
+int FlatJson::read(const bsl::string_view& input)
+{
+    return readImp(0, input, ReadOptions());
+}
+
+inline
+int FlatJson::read(const bsl::string_view& input, const ReadOptions& options)
+{
+    return readImp(0, input, options);
+}
+
+inline
+int FlatJson::read(Error *error, const bsl::string_view& input)
+{
+    BSLS_ASSERT(error);
+
+    return readImp(error, input, ReadOptions());
+}
+
+inline
+int FlatJson::read(Error                   *error,
+                   const bsl::string_view&  input,
+                   const ReadOptions&       options)
+{
+    BSLS_ASSERT(error);
+
+    return readImp(error, input, options);
+}
+
+inline
+int FlatJson::read(bsl::streambuf *input)
+{
+    return read(input, ReadOptions());
+}
+
+inline
+int FlatJson::read(Error *error, bsl::streambuf *input)
+{
+    BSLS_ASSERT(error);
+
+    return read(error, input, ReadOptions());
+}
+
+// ACCESSORS
+inline
+FlatJsonValue FlatJson::root() const
+{
+    return FlatJsonValue(this, d_nodes.empty() ? &s_nullNode : &d_nodes[0]);
+}
+
+inline
+bsl::size_t FlatJson::numNodes() const
+{
+    return d_nodes.empty() ? 1 : d_nodes.size();
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *FlatJson::allocator() const
+{
+    return d_text.get_allocator().mechanism();
+}
+
+                            // -------------------
+                            // class FlatJsonValue
+                            // -------------------
+
+// PRIVATE CREATORS
+inline
+FlatJsonValue::FlatJsonValue(const FlatJson       *document,
+                             const FlatJson::Node *node)
+: d_document_p(document)
+, d_node_p(node)
+{
+    BSLS_ASSERT(document);
+    BSLS_ASSERT(node);
+}
+
+// ACCESSORS
+inline
+JsonType::Enum FlatJsonValue::type() const
+{
+    return static_cast<JsonType::Enum>(d_node_p->d_type);
+}
+
+inline
+bool FlatJsonValue::isArray() const
+{
+    return JsonType::e_ARRAY == type();
+}
+
+inline
+bool FlatJsonValue::isBoolean() const
+{
+    return JsonType::e_BOOLEAN == type();
+}
+
+inline
+bool FlatJsonValue::isNull() const
+{
+    return JsonType::e_NULL == type();
+}
+
+inline
+bool FlatJsonValue::isNumber() const
+{
+    return JsonType::e_NUMBER == type();
+}
+
+inline
+bool FlatJsonValue::isObject() const
+{
+    return JsonType::e_OBJECT == type();
+}
+
+inline
+bool FlatJsonValue::isString() const
+{
+    return JsonType::e_STRING == type();
+}
+
+inline
+FlatJsonArray FlatJsonValue::theArray() const
+{
+    BSLS_ASSERT(isArray());
+
+    return FlatJsonArray(d_document_p, d_node_p);
+}
+
+inline
+bool FlatJsonValue::theBoolean() const
+{
+    BSLS_ASSERT(isBoolean());
+
+    return 0 != d_node_p->d_size;
+}
+
+inline
+JsonNull FlatJsonValue::theNull() const
+{
+    BSLS_ASSERT(isNull());
+
+    return JsonNull();
+}
+
+inline
+FlatJsonNumber FlatJsonValue::theNumber() const
+{
+    BSLS_ASSERT(isNumber());
+
+    return FlatJsonNumber(d_document_p->text(*d_node_p));
+}
+
+inline
+FlatJsonObject FlatJsonValue::theObject() const
+{
+    BSLS_ASSERT(isObject());
+
+    return FlatJsonObject(d_document_p, d_node_p);
+}
+
+inline
+bsl::string_view FlatJsonValue::theString() const
+{
+    BSLS_ASSERT(isString());
+
+    return d_document_p->text(*d_node_p);
+}
+
+inline
+FlatJsonValue FlatJsonValue::operator[](const bsl::string_view& key) const
+{
+    return theObject()[key];
+}
+
+inline
+FlatJsonValue FlatJsonValue::operator[](bsl::size_t index) const
+{
+    return theArray()[index];
+}
+
+inline
+bool FlatJsonValue::contains(const bsl::string_view& key) const
+{
+    return theObject().contains(key);
+}
+
+inline
+bsl::size_t FlatJsonValue::size() const
+{
+    BSLS_ASSERT(isObject() || isArray());
+
+    return d_node_p->d_size;
+}
+
+template <class RETURN_TYPE, class VISITOR>
+RETURN_TYPE FlatJsonValue::visit(VISITOR& visitor) const
+{
+    switch (type()) {
+      case JsonType::e_OBJECT: {
+        return visitor(theObject());                                  // RETURN
+      } break;
+      case JsonType::e_ARRAY: {
+        return visitor(theArray());                                   // RETURN
+      } break;
+      case JsonType::e_STRING: {
+        return visitor(theString());                                  // RETURN
+      } break;
+      case JsonType::e_NUMBER: {
+        return visitor(theNumber());                                  // RETURN
+      } break;
+      case JsonType::e_BOOLEAN: {
+        return visitor(theBoolean());                                 // RETURN
+      } break;
+      default: {
+        BSLS_ASSERT(isNull());
+      } break;
+    }
+    return visitor(theNull());
+}
+
+template <class RETURN_TYPE, class VISITOR>
+RETURN_TYPE FlatJsonValue::visit(const VISITOR& visitor) const
+{
+    switch (type()) {
+      case JsonType::e_OBJECT: {
+        return visitor(theObject());                                  // RETURN
+      } break;
+      case JsonType::e_ARRAY: {
+        return visitor(theArray());                                   // RETURN
+      } break;
+      case JsonType::e_STRING: {
+        return visitor(theString());                                  // RETURN
+      } break;
+      case JsonType::e_NUMBER: {
+        return visitor(theNumber());                                  // RETURN
+      } break;
+      case JsonType::e_BOOLEAN: {
+        return visitor(theBoolean());                                 // RETURN
+      } break;
+      default: {
+        BSLS_ASSERT(isNull());
+      } break;
+    }
+    return visitor(theNull());
+}
+
+                            // -------------------
+                            // class FlatJsonArray
+                            // -------------------
+
+// PRIVATE CREATORS
+inline
+FlatJsonArray::FlatJsonArray(const FlatJson       *document,
+                             const FlatJson::Node *node)
+: d_document_p(document)
+, d_node_p(node)
+{
+    BSLS_ASSERT(document);
+    BSLS_ASSERT(node);
+}
+
+// ACCESSORS
+inline
+FlatJsonValue FlatJsonArray::operator[](bsl::size_t index) const
+{
+    BSLS_ASSERT(index < size());
+
+    const bsl::uint32_t element =
+                         d_document_p->d_children[d_node_p->d_offset + index];
+
+    return FlatJsonValue(d_document_p, &d_document_p->node(element));
+}
+
+inline
+bool FlatJsonArray::empty() const
+{
+    return 0 == d_node_p->d_size;
+}
+
+inline
+bsl::size_t FlatJsonArray::size() const
+{
+    return d_node_p->d_size;
+}
+
+                           // --------------------
+                           // class FlatJsonObject
+                           // --------------------
+
+// PRIVATE CREATORS
+inline
+FlatJsonObject::FlatJsonObject(const FlatJson       *document,
+                               const FlatJson::Node *node)
+: d_document_p(document)
+, d_node_p(node)
+{
+    BSLS_ASSERT(document);
+    BSLS_ASSERT(node);
+}
+
+// PRIVATE ACCESSORS
+inline
+bsl::uint32_t FlatJsonObject::keyNode(bsl::size_t position) const
+{
+    BSLS_ASSERT(position < size());
+
+    return d_document_p->d_children[d_node_p->d_offset + position];
+}
+
+// ACCESSORS
+inline
+FlatJsonValue FlatJsonObject::operator[](const bsl::string_view& key) const
+{
+    const bsl::size_t position = find(key);
+
+    BSLS_ASSERT(position < size());
+
+    return value(position);
+}
+
+inline
+bool FlatJsonObject::contains(const bsl::string_view& key) const
+{
+    return find(key) < size();
+}
+
+inline
+bool FlatJsonObject::empty() const
+{
+    return 0 == d_node_p->d_size;
+}
+
+inline
+bsl::string_view FlatJsonObject::key(bsl::size_t position) const
+{
+    return d_document_p->text(d_document_p->node(keyNode(position)));
+}
+
+inline
+bsl::size_t FlatJsonObject::size() const
+{
+    return d_node_p->d_size;
+}
+
+inline
+FlatJsonValue FlatJsonObject::value(bsl::size_t position) const
+{
+    return FlatJsonValue(d_document_p,
+                         &d_document_p->node(keyNode(position) + 1));
+}
+
+                           // --------------------
+                           // class FlatJsonNumber
+                           // --------------------
+
+// PRIVATE CREATORS
+inline
+FlatJsonNumber::FlatJsonNumber(const bsl::string_view& value)
+: d_value(value)
+{
+}
+
+// ACCESSORS
+inline
+bool FlatJsonNumber::isIntegral() const
+{
+    return NumberUtil::isIntegralNumber(d_value);
+}
+
+inline
+bsl::string_view FlatJsonNumber::value() const
+{
+    return d_value;
+}
+
+inline
+int FlatJsonNumber::asInt(int *result) const
+{
+    return NumberUtil::asInt(result, d_value);
+}
+
+inline
+int FlatJsonNumber::asInt64(bsls::Types::Int64 *result) const
+{
+    return NumberUtil::asInt64(result, d_value);
+}
+
+inline
+int FlatJsonNumber::asUint(unsigned int *result) const
+{
+    return NumberUtil::asUint(result, d_value);
+}
+
+inline
+int FlatJsonNumber::asUint64(bsls::Types::Uint64 *result) const
+{
+    return NumberUtil::asUint64(result, d_value);
+}
+
+inline
+float FlatJsonNumber::asFloat() const
+{
+    return NumberUtil::asFloat(d_value);
+}
+
+inline
+double FlatJsonNumber::asDouble() const
+{
+    return NumberUtil::asDouble(d_value);
+}
+
+inline
+bdldfp::Decimal64 FlatJsonNumber::asDecimal64() const
+{
+    return NumberUtil::asDecimal64(d_value);
+}
+
+inline
+int FlatJsonNumber::asDecimal64Exact(bdldfp::Decimal64 *result) const
+{
+    return NumberUtil::asDecimal64Exact(result, d_value);
+}
+
+// FREE FUNCTIONS
+
+/// Exchange the values of the specified `a` and `b` objects.  This function
+/// provides the no-throw exception-safety guarantee if the two objects were
+/// created with the same allocator and the basic guarantee otherwise.
+void swap(FlatJson& a, FlatJson& b);
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1619 @@
+// bdljsn_flatjson.t.cpp                                              -*-C++-*-
+#include <bdljsn_flatjson.h>
+
+#include <bdljsn_error.h>
+#include <bdljsn_json.h>
+#include <bdljsn_jsontestsuiteutil.h>
+#include <bdljsn_jsonutil.h>
+#include <bdljsn_location.h>
+#include <bdljsn_readoptions.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides an immutable JSON document,
+// `bdljsn::FlatJson`, and reference types providing access to its values.
+// The document is required to accept exactly the JSON text accepted by
+// `bdljsn::JsonUtil::read`, and to represent the same values: this is tested
+// against `bdljsn::JsonUtil::read` on the JSON Test Suite and on documents
+// exercising `bdljsn::ReadOptions`, converting the values of the document
+// with `toJson`.  The accessors of the reference types are tested on
+// table-driven documents, and the number of allocations made by `read` is
+// verified to be independent of the size of the document.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatJson();
+// [ 2] explicit FlatJson(bslma::Allocator *basicAllocator);
+// [ 7] FlatJson(const FlatJson& original, bslma::Allocator *ba = 0);
+// [ 2] ~FlatJson();
+//
+// MANIPULATORS
+// [ 7] FlatJson& operator=(const FlatJson& rhs);
+// [ 2] int read(const bsl::string_view& input);
+// [ 5] int read(const bsl::string_view& input, const ReadOptions& options);
+// [ 6] int read(Error *error, const bsl::string_view& input);
+// [ 5] int read(Error *, const bsl::string_view&, const ReadOptions&);
+// [ 7] int read(bsl::streambuf *input);
+// [ 7] int read(bsl::streambuf *input, const ReadOptions& options);
+// [ 7] int read(Error *error, bsl::streambuf *input);
+// [ 7] int read(Error *, bsl::streambuf *, const ReadOptions&);
+// [ 7] void reset();
+// [ 7] void swap(FlatJson& other);
+//
+// ACCESSORS
+// [ 2] FlatJsonValue root() const;
+// [ 2] bsl::size_t numNodes() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FlatJsonValue
+// [ 2] JsonType::Enum type() const;
+// [ 2] bool isArray() const;
+// [ 2] bool isBoolean() const;
+// [ 2] bool isNull() const;
+// [ 2] bool isNumber() const;
+// [ 2] bool isObject() const;
+// [ 2] bool isString() const;
+// [ 4] FlatJsonArray theArray() const;
+// [ 2] bool theBoolean() const;
+// [ 2] JsonNull theNull() const;
+// [ 2] FlatJsonNumber theNumber() const;
+// [ 3] FlatJsonObject theObject() const;
+// [ 2] bsl::string_view theString() const;
+// [ 3] FlatJsonValue operator[](const bsl::string_view& key) const;
+// [ 4] FlatJsonValue operator[](bsl::size_t index) const;
+// [ 3] bool contains(const bsl::string_view& key) const;
+// [ 3] bsl::size_t size() const;
+// [ 5] void toJson(Json *result) const;
+// [ 8] RETURN_TYPE visit(VISITOR& visitor) const;
+// [ 8] RETURN_TYPE visit(const VISITOR& visitor) const;
+//
+// FlatJsonArray
+// [ 4] FlatJsonValue operator[](bsl::size_t index) const;
+// [ 4] bool empty() const;
+// [ 4] bsl::size_t size() const;
+//
+// FlatJsonObject
+// [ 3] FlatJsonValue operator[](const bsl::string_view& key) const;
+// [ 3] bool contains(const bsl::string_view& key) const;
+// [ 3] bool empty() const;
+// [ 3] bsl::size_t find(const bsl::string_view& key) const;
+// [ 3] bsl::string_view key(bsl::size_t position) const;
+// [ 3] bsl::size_t size() const;
+// [ 3] FlatJsonValue value(bsl::size_t position) const;
+//
+// FlatJsonNumber
+// [ 2] bool isIntegral() const;
+// [ 2] bsl::string_view value() const;
+// [ 2] int asInt(int *result) const;
+// [ 2] int asInt64(bsls::Types::Int64 *result) const;
+// [ 2] int asUint(unsigned int *result) const;
+// [ 2] int asUint64(bsls::Types::Uint64 *result) const;
+// [ 2] float asFloat() const;
+// [ 2] double asDouble() const;
+// [ 2] bdldfp::Decimal64 asDecimal64() const;
+// [ 2] int asDecimal64Exact(bdldfp::Decimal64 *result) const;
+//
+// FREE FUNCTIONS
+// [ 7] void swap(FlatJson& a, FlatJson& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONFORMANCE WITH `JsonUtil::read`
+// [ 6] ERROR REPORTING
+// [ 9] ALLOCATION
+// [10] USAGE EXAMPLE
+// [-1] PERFORMANCE: COMPARISON WITH `JsonUtil::read`
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdljsn::FlatJson          Obj;
+typedef bdljsn::FlatJsonValue     Value;
+typedef bdljsn::FlatJsonArray     Array;
+typedef bdljsn::FlatJsonObject    Object;
+typedef bdljsn::FlatJsonNumber    Number;
+typedef bdljsn::JsonType          JsonType;
+typedef bdljsn::JsonTestSuiteUtil JTSU;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// This class provides a visitor tallying the values of a document by type,
+/// visiting the elements of arrays and the values of objects.
+class TallyVisitor {
+
+    // DATA
+    int *d_tally_p;  // array of 6 counts, indexed by `JsonType::Enum`
+
+  public:
+    // CREATORS
+
+    /// Create a visitor incrementing the elements of the specified `tally`.
+    explicit TallyVisitor(int *tally)
+    : d_tally_p(tally)
+    {
+    }
+
+    // ACCESSORS
+
+    /// Tally the specified `object` and visit the values of its members.
+    int operator()(const Object& object) const
+    {
+        ++d_tally_p[JsonType::e_OBJECT];
+        for (bsl::size_t i = 0; i < object.size(); ++i) {
+            object.value(i).visit<int>(*this);
+        }
+        return JsonType::e_OBJECT;
+    }
+
+    /// Tally the specified `array` and visit its elements.
+    int operator()(const Array& array) const
+    {
+        ++d_tally_p[JsonType::e_ARRAY];
+        for (bsl::size_t i = 0; i < array.size(); ++i) {
+            array[i].visit<int>(*this);
+        }
+        return JsonType::e_ARRAY;
+    }
+
+    /// Tally a string.
+    int operator()(const bsl::string_view&) const
+    {
+        ++d_tally_p[JsonType::e_STRING];
+        return JsonType::e_STRING;
+    }
+
+    /// Tally a number.
+    int operator()(const Number&) const
+    {
+        ++d_tally_p[JsonType::e_NUMBER];
+        return JsonType::e_NUMBER;
+    }
+
+    /// Tally a boolean.
+    int operator()(bool) const
+    {
+        ++d_tally_p[JsonType::e_BOOLEAN];
+        return JsonType::e_BOOLEAN;
+    }
+
+    /// Tally a null.
+    int operator()(const bdljsn::JsonNull&) const
+    {
+        ++d_tally_p[JsonType::e_NULL];
+        return JsonType::e_NULL;
+    }
+};
+
+/// This class provides a (non-`const`) visitor counting the strings of a
+/// document.
+class StringCounter {
+
+    // DATA
+    int d_count;  // number of strings seen
+
+  public:
+    // CREATORS
+
+    /// Create a visitor having seen no strings.
+    StringCounter()
+    : d_count(0)
+    {
+    }
+
+    // MANIPULATORS
+
+    /// Visit the values of the specified `object`.
+    void operator()(const Object& object)
+    {
+        for (bsl::size_t i = 0; i < object.size(); ++i) {
+            object.value(i).visit<void>(*this);
+        }
+    }
+
+    /// Visit the elements of the specified `array`.
+    void operator()(const Array& array)
+    {
+        for (bsl::size_t i = 0; i < array.size(); ++i) {
+            array[i].visit<void>(*this);
+        }
+    }
+
+    /// Count a string.
+    void operator()(const bsl::string_view&)
+    {
+        ++d_count;
+    }
+
+    /// Ignore a number.
+    void operator()(const Number&)
+    {
+    }
+
+    /// Ignore a boolean.
+    void operator()(bool)
+    {
+    }
+
+    /// Ignore a null.
+    void operator()(const bdljsn::JsonNull&)
+    {
+    }
+
+    // ACCESSORS
+
+    /// Return the number of strings seen.
+    int count() const
+    {
+        return d_count;
+    }
+};
+
+/// Return a JSON document of the specified `numRecords` records, each
+/// having several members of each type.
+bsl::string makeRecords(int numRecords)
+{
+    bsl::ostringstream os;
+    os << "[";
+    for (int i = 0; i < numRecords; ++i) {
+        os << (i ? ",\n" : "\n")
+           << "  {\"id\": " << i
+           << ", \"name\": \"record " << i << "\""
+           << ", \"price\": " << i << "." << (i * 7) % 100
+           << ", \"active\": " << (i % 2 ? "true" : "false")
+           << ", \"parent\": null"
+           << ", \"tags\": [\"alpha\", \"beta\\tgamma\", \"caf\\u00e9\"]"
+           << ", \"location\": {\"x\": " << i * 3 << ", \"y\": -" << i
+           << ", \"label\": \"row " << i % 17 << "\"}}";
+    }
+    os << "\n]\n";
+    return os.str();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 10: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reading a Request Payload
+///- - - - - - - - - - - - - - - - - - -
+// Suppose we receive requests having a JSON payload, from which we need a few
+// fields.
+//
+// First, we define the payload of a request:
+// ```
+    const char *PAYLOAD = "{\n"
+                          "    \"user\": \"jsmith\",\n"
+                          "    \"limit\": 25,\n"
+                          "    \"tickers\": [\"IBM\", \"AAPL\", \"MSFT\"],\n"
+                          "    \"note\": \"caf\\u00e9\"\n"
+                          "}";
+// ```
+// Then, we read the payload into a `bdljsn::FlatJson`:
+// ```
+    bdljsn::FlatJson document;
+    bdljsn::Error    error;
+
+    int rc = document.read(&error, PAYLOAD);
+    ASSERT(0 == rc);
+// ```
+// Next, we access the fields of the request, through the same interface that
+// a `bdljsn::Json` provides:
+// ```
+    bdljsn::FlatJsonValue request = document.root();
+    ASSERT(request.isObject());
+    ASSERT(4 == request.size());
+
+    ASSERT("jsmith" == request["user"].theString());
+
+    int limit;
+    rc = request["limit"].theNumber().asInt(&limit);
+    ASSERT(0  == rc);
+    ASSERT(25 == limit);
+
+    bdljsn::FlatJsonArray tickers = request["tickers"].theArray();
+    ASSERT(3      == tickers.size());
+    ASSERT("AAPL" == tickers[1].theString());
+
+    ASSERT(!request.contains("account"));
+// ```
+// Notice that escape sequences have been decoded:
+// ```
+    ASSERT("caf\xc3\xa9" == request["note"].theString());
+// ```
+// Finally, if we need a modifiable copy of (part of) the document, we convert
+// it to a `bdljsn::Json`:
+// ```
+    bdljsn::Json json;
+    request["tickers"].toJson(&json);
+    ASSERT(json.isArray());
+    ASSERT(3 == json.size());
+// ```
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // ALLOCATION
+        //
+        // Concerns:
+        // 1. Reading a document allocates memory from the allocator supplied
+        //    at construction only.
+        //
+        // 2. The number of allocations made by `read` does not depend on the
+        //    number of values of the document, but only (logarithmically) on
+        //    its size.
+        //
+        // 3. Accessing the values of a document does not allocate.
+        //
+        // Plan:
+        // 1. Read documents of increasing numbers of records into a `FlatJson`
+        //    using a test allocator, and verify that the default allocator is
+        //    not used, and that the number of allocations is small and grows
+        //    at most logarithmically.  (C-1..2)
+        //
+        // 2. Visit the whole document and verify that no memory is allocated.
+        //    (C-3)
+        //
+        // Testing:
+        //   ALLOCATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ALLOCATION" << endl
+                          << "==========" << endl;
+
+        bsls::Types::Int64 previousAllocations = 0;
+
+        for (int numRecords = 1; numRecords <= 4096; numRecords *= 4) {
+            const bsl::string TEXT = makeRecords(numRecords);
+
+            bslma::TestAllocator         oa("object", veryVeryVerbose);
+            bslma::TestAllocatorMonitor  dam(&defaultAllocator);
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERTV(numRecords, 0 == mX.read(TEXT));
+            ASSERTV(numRecords, dam.isTotalSame());
+
+            const bsls::Types::Int64 numAllocations = oa.numAllocations();
+
+            if (veryVerbose) {
+                P_(numRecords) P_(TEXT.size()) P_(X.numNodes())
+                P_(numAllocations) P(oa.numBytesInUse())
+            }
+
+            ASSERTV(numRecords, numAllocations, numAllocations < 64);
+            ASSERTV(numRecords, numAllocations, previousAllocations,
+                    1 == numRecords ||
+                              numAllocations <= previousAllocations + 12);
+            previousAllocations = numAllocations;
+
+            // Memory in use: the text and about 16 bytes per node.
+
+            ASSERTV(numRecords, oa.numBytesInUse(),
+                    static_cast<bsls::Types::Int64>(TEXT.size() +
+                                                    32 * X.numNodes()) >
+                                                          oa.numBytesInUse());
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            int tally[6] = { 0, 0, 0, 0, 0, 0 };
+            X.root().visit<int>(TallyVisitor(tally));
+
+            ASSERTV(numRecords, oam.isTotalSame());
+            ASSERTV(numRecords, tally[JsonType::e_OBJECT],
+                    2 * numRecords == tally[JsonType::e_OBJECT]);
+            ASSERTV(numRecords, tally[JsonType::e_STRING],
+                    5 * numRecords == tally[JsonType::e_STRING]);
+        }
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING `visit`
+        //
+        // Concerns:
+        // 1. `visit` invokes the visitor with the reference type
+        //    corresponding to the type of the value, and returns the value
+        //    returned by the visitor.
+        //
+        // 2. `visit` accepts both modifiable and non-modifiable visitors.
+        //
+        // Plan:
+        // 1. Tally the values of a document by type using a `const` visitor,
+        //    and verify the tally and the values returned.  (C-1..2)
+        //
+        // 2. Count the strings of a document using a modifiable visitor.
+        //    (C-2)
+        //
+        // Testing:
+        //   RETURN_TYPE visit(VISITOR& visitor) const;
+        //   RETURN_TYPE visit(const VISITOR& visitor) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `visit`" << endl
+                          << "===============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        ASSERT(0 == mX.read("{\"a\": [1, \"x\", true, null, {}],"
+                            " \"b\": \"y\", \"c\": [[], 2.5, false]}"));
+
+        int                 tally[6] = { 0, 0, 0, 0, 0, 0 };
+        const TallyVisitor  visitor(tally);
+
+        ASSERT(JsonType::e_OBJECT == X.root().visit<int>(visitor));
+
+        ASSERTV(tally[JsonType::e_OBJECT],  2 == tally[JsonType::e_OBJECT]);
+        ASSERTV(tally[JsonType::e_ARRAY],   3 == tally[JsonType::e_ARRAY]);
+        ASSERTV(tally[JsonType::e_STRING],  2 == tally[JsonType::e_STRING]);
+        ASSERTV(tally[JsonType::e_NUMBER],  2 == tally[JsonType::e_NUMBER]);
+        ASSERTV(tally[JsonType::e_BOOLEAN], 2 == tally[JsonType::e_BOOLEAN]);
+        ASSERTV(tally[JsonType::e_NULL],    1 == tally[JsonType::e_NULL]);
+
+        ASSERT(JsonType::e_STRING == X.root()["b"].visit<int>(visitor));
+        ASSERT(JsonType::e_NUMBER ==
+                                  X.root()["c"][1].visit<int>(visitor));
+        ASSERT(JsonType::e_NULL   == X.root()["a"][3].visit<int>(visitor));
+
+        StringCounter counter;
+        X.root().visit<void>(counter);
+        ASSERTV(counter.count(), 2 == counter.count());
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP, RESET, AND STREAMBUF INPUT
+        //
+        // Concerns:
+        // 1. A copy holds the same document, using the allocator supplied at
+        //    its construction, and is independent of the original.
+        //
+        // 2. Assignment, `swap`, and `reset` have the expected effect.
+        //
+        // 3. Reading from a `bsl::streambuf` is equivalent to reading its
+        //    contents as a `bsl::string_view`, and consumes all of the
+        //    contents.
+        //
+        // Plan:
+        // 1. Copy, assign, swap, and reset documents, and verify their
+        //    values.  (C-1..2)
+        //
+        // 2. Read documents from a `bdlsb::FixedMemInStreamBuf`, and verify
+        //    their values and the position of the stream buffer.  (C-3)
+        //
+        // Testing:
+        //   FlatJson(const FlatJson& original, bslma::Allocator *ba = 0);
+        //   FlatJson& operator=(const FlatJson& rhs);
+        //   int read(bsl::streambuf *input);
+        //   int read(bsl::streambuf *input, const ReadOptions& options);
+        //   int read(Error *error, bsl::streambuf *input);
+        //   int read(Error *, bsl::streambuf *, const ReadOptions&);
+        //   void reset();
+        //   void swap(FlatJson& other);
+        //   void swap(FlatJson& a, FlatJson& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                     << endl
+                     << "COPY, ASSIGNMENT, SWAP, RESET, AND STREAMBUF INPUT"
+                     << endl
+                     << "=================================================="
+                     << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVerbose);
+
+        const char *const TEXT_A = "{\"k\": [\"a\\nb\", 1, 2]}";
+        const char *const TEXT_B = "[true, {\"x\": null}]";
+
+        if (verbose) cout << "\tCopy construction and assignment." << endl;
+        {
+            Obj mA(&oa);  const Obj& A = mA;
+            ASSERT(0 == mA.read(TEXT_A));
+
+            Obj mC(A, &za);  const Obj& C = mC;
+            ASSERT(&za == C.allocator());
+            ASSERT("a\nb" == C.root()["k"][0].theString());
+            ASSERT(A.numNodes() == C.numNodes());
+
+            mA.reset();
+            ASSERT(A.root().isNull());
+            ASSERT(1 == A.numNodes());
+            ASSERT("a\nb" == C.root()["k"][0].theString());
+
+            Obj mD(&oa);  const Obj& D = mD;
+            ASSERT(0 == mD.read(TEXT_B));
+
+            mD = C;
+            ASSERT(&oa == D.allocator());
+            ASSERT(D.root().isObject());
+            ASSERT(3 == D.root()["k"].size());
+
+            mD = D;
+            ASSERT(3 == D.root()["k"].size());
+        }
+
+        if (verbose) cout << "\tSwap." << endl;
+        {
+            Obj mA(&oa);  const Obj& A = mA;
+            Obj mB(&oa);  const Obj& B = mB;
+            ASSERT(0 == mA.read(TEXT_A));
+            ASSERT(0 == mB.read(TEXT_B));
+
+            mA.swap(mB);
+            ASSERT(A.root().isArray());
+            ASSERT(B.root().isObject());
+
+            swap(mA, mB);
+            ASSERT(A.root().isObject());
+            ASSERT(B.root().isArray());
+
+            Obj mZ(&za);  const Obj& Z = mZ;
+            swap(mA, mZ);
+            ASSERT(A.root().isNull());
+            ASSERT(Z.root().isObject());
+            ASSERT(&oa == A.allocator());
+            ASSERT(&za == Z.allocator());
+        }
+
+        if (verbose) cout << "\tStreambuf input." << endl;
+        {
+            const bsl::string TEXT = bsl::string(TEXT_B) + "  trailing";
+
+            bdljsn::ReadOptions options;
+            options.setAllowTrailingText(true);
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            {
+                bdlsb::FixedMemInStreamBuf sb(TEXT.data(), TEXT.size());
+                ASSERT(0 != mX.read(&sb));
+                ASSERT(X.root().isNull());
+            }
+            {
+                bdlsb::FixedMemInStreamBuf sb(TEXT.data(), TEXT.size());
+                bdljsn::Error              error;
+                ASSERT(0 != mX.read(&error, &sb));
+                ASSERT(bdljsn::Location(bsl::strlen(TEXT_B) + 2) ==
+                                                             error.location());
+            }
+            {
+                bdlsb::FixedMemInStreamBuf sb(TEXT.data(), TEXT.size());
+                ASSERT(0 == mX.read(&sb, options));
+                ASSERT(X.root().isArray());
+                ASSERT(bsl::streambuf::traits_type::eof() == sb.sgetc());
+            }
+            {
+                mX.reset();
+                bdlsb::FixedMemInStreamBuf sb(TEXT.data(), TEXT.size());
+                bdljsn::Error              error;
+                ASSERT(0 == mX.read(&error, &sb, options));
+                ASSERT(X.root().isArray());
+                ASSERT(X.root()[1].contains("x"));
+            }
+
+            // A document larger than the internal buffer.
+
+            const bsl::string LARGE = makeRecords(500);
+            {
+                bdlsb::FixedMemInStreamBuf sb(LARGE.data(), LARGE.size());
+                ASSERT(0 == mX.read(&sb));
+                ASSERT(500 == X.root().size());
+                ASSERT("record 499" == X.root()[499]["name"].theString());
+            }
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // ERROR REPORTING
+        //
+        // Concerns:
+        // 1. On failure, `read` returns a non-zero value, and loads the
+        //    supplied `Error` with a message and the location of the
+        //    offending character.
+        //
+        // 2. On failure, the document is unchanged.
+        //
+        // Plan:
+        // 1. For a table of invalid documents, verify the status returned,
+        //    the location of the error, and that the message is not empty.
+        //    Verify that the document is unchanged.  (C-1..2)
+        //
+        // Testing:
+        //   int read(Error *error, const bsl::string_view& input);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ERROR REPORTING" << endl
+                          << "===============" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_text_p;
+            int         d_offset;   // expected location of the error
+        } DATA[] = {
+            // LINE  TEXT                          OFFSET
+            // ----  ----------------------------  ------
+            { L_,    "",                           0      },
+            { L_,    "   ",                        3      },
+            { L_,    "[1, 2",                      5      },
+            { L_,    "[1 2]",                      3      },
+            { L_,    "[1,]",                       3      },
+            { L_,    "{\"a\" 1}",                  5      },
+            { L_,    "{\"a\": 1,}",                8      },
+            { L_,    "{1: 2}",                     1      },
+            { L_,    "[\"abc]",                    1      },
+            { L_,    "[\"a\tb\"]",                 3      },
+            { L_,    "[\"a\\x\"]",                 1      },
+            { L_,    "[tru]",                      1      },
+            { L_,    "[01]",                       1      },
+            { L_,    "[1] x",                      4      },
+            { L_,    "[\"\xC3\"]",                 2      },
+            { L_,    "{\"a\": [}",                 7      },
+            { L_,    "]",                          0      },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const TEXT   = DATA[ti].d_text_p;
+            const int         OFFSET = DATA[ti].d_offset;
+
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 == mX.read("[42]"));
+
+            bdljsn::Error error;
+
+            ASSERTV(LINE, 0 != mX.read(&error, TEXT));
+            ASSERTV(LINE, OFFSET, error.location().offset(),
+                    bdljsn::Location(OFFSET) == error.location());
+            ASSERTV(LINE, !error.message().empty());
+
+            if (veryVerbose) {
+                P_(LINE) P_(error.location().offset()) P(error.message())
+            }
+
+            ASSERTV(LINE, X.root().isArray());
+            ASSERTV(LINE, "42" == X.root()[0].theNumber().value());
+
+            // `JsonUtil::read` rejects the same text.
+
+            bdljsn::Json json;
+            ASSERTV(LINE, 0 != bdljsn::JsonUtil::read(&json, &error, TEXT));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONFORMANCE WITH `JsonUtil::read`
+        //
+        // Concerns:
+        // 1. `read` accepts the documents that `JsonUtil::read` accepts, and
+        //    rejects the others.
+        //
+        // 2. The values of an accepted document are those read by
+        //    `JsonUtil::read`.
+        //
+        // 3. `read` honors `ReadOptions` as `JsonUtil::read` does.
+        //
+        // Plan:
+        // 1. For each document of the JSON Test Suite, read the document with
+        //    `read` and `JsonUtil::read`, and compare the status returned.
+        //    If the document is accepted, compare the `Json` returned by
+        //    `toJson` with that read by `JsonUtil::read`.  (C-1..2)
+        //
+        // 2. Repeat P-1 for documents nested at various depths, with various
+        //    `maxNestedDepth` values, and for documents followed by text, with
+        //    `allowTrailingText` `true` and `false`.  (C-3)
+        //
+        // Testing:
+        //   int read(const bsl::string_view& input, const ReadOptions& opt);
+        //   int read(Error *, const bsl::string_view&, const ReadOptions&);
+        //   void toJson(Json *result) const;
+        //   CONFORMANCE WITH `JsonUtil::read`
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONFORMANCE WITH `JsonUtil::read`" << endl
+                          << "=================================" << endl;
+
+        if (verbose) cout << "\tJSON Test Suite." << endl;
+
+        for (bsl::size_t ti = 0; ti < JTSU::numData(); ++ti) {
+            const int               LINE      = JTSU::data(ti)->d_line;
+            const char *const       TEST_NAME = JTSU::data(ti)->d_testName_p;
+            const char *const       JSON      = JTSU::data(ti)->d_JSON_p;
+            const bsl::size_t       LENGTH    = JTSU::data(ti)->d_length;
+            const JTSU::Expected    EXPECTED  = JTSU::data(ti)->d_expected;
+            const bsl::string_view  TEXT(JSON, LENGTH);
+
+            if (veryVerbose) {
+                P_(ti) P_(LINE) P_(EXPECTED) P(TEST_NAME)
+            }
+
+            bdljsn::Error error;
+            bdljsn::Json  expected;
+            const int     expectedRc = bdljsn::JsonUtil::read(&expected,
+                                                              &error,
+                                                              TEXT);
+
+            Obj mX;  const Obj& X = mX;
+            const int rc = mX.read(&error, TEXT);
+
+            ASSERTV(LINE, TEST_NAME, rc, expectedRc,
+                    (0 == rc) == (0 == expectedRc));
+
+            if (JTSU::e_EITHER != EXPECTED) {
+                ASSERTV(LINE, TEST_NAME, rc,
+                        (0 == rc) == (JTSU::e_ACCEPT == EXPECTED));
+            }
+
+            if (0 == rc && 0 == expectedRc) {
+                bdljsn::Json json;
+                X.root().toJson(&json);
+                ASSERTV(LINE, TEST_NAME, expected, json, expected == json);
+            }
+        }
+
+        if (verbose) cout << "\tNesting depth." << endl;
+
+        for (int depth = 1; depth <= 10; ++depth) {
+            bsl::string array(depth, '[');
+            array.append(depth, ']');
+
+            bsl::string object;
+            for (int i = 0; i < depth; ++i) {
+                object += "{\"a\":";
+            }
+            object += "1";
+            object.append(depth, '}');
+
+            for (int maxDepth = 1; maxDepth <= 10; ++maxDepth) {
+                bdljsn::ReadOptions options;
+                options.setMaxNestedDepth(maxDepth);
+
+                const bsl::string *TEXTS[] = { &array, &object };
+
+                for (int i = 0; i < 2; ++i) {
+                    const bsl::string& TEXT = *TEXTS[i];
+
+                    bdljsn::Error error;
+                    bdljsn::Json  expected;
+                    const int     expectedRc = bdljsn::JsonUtil::read(
+                                                                    &expected,
+                                                                    &error,
+                                                                    TEXT,
+                                                                    options);
+
+                    Obj mX;  const Obj& X = mX;
+                    const int rc = mX.read(TEXT, options);
+
+                    ASSERTV(depth, maxDepth, i, rc, expectedRc,
+                            (0 == rc) == (0 == expectedRc));
+                    ASSERTV(depth, maxDepth, i, rc,
+                            (0 == rc) == (depth <= maxDepth));
+
+                    if (0 == rc) {
+                        bdljsn::Json json;
+                        X.root().toJson(&json);
+                        ASSERTV(depth, maxDepth, expected == json);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\tTrailing text." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_text_p;
+            } DATA[] = {
+                { L_, "[1]"          },
+                { L_, "[1]   "       },
+                { L_, "[1] [2]"      },
+                { L_, "[1],"         },
+                { L_, "1 2"          },
+                { L_, "\"a\"x"       },
+                { L_, "{} garbage"   },
+                { L_, "null\n"       },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE = DATA[ti].d_line;
+                const char *const TEXT = DATA[ti].d_text_p;
+
+                for (int allow = 0; allow < 2; ++allow) {
+                    bdljsn::ReadOptions options;
+                    options.setAllowTrailingText(allow);
+
+                    bdljsn::Error error;
+                    bdljsn::Json  expected;
+                    const int     expectedRc = bdljsn::JsonUtil::read(
+                                                                    &expected,
+                                                                    &error,
+                                                                    TEXT,
+                                                                    options);
+
+                    Obj mX;  const Obj& X = mX;
+                    const int rc = mX.read(&error, TEXT, options);
+
+                    ASSERTV(LINE, allow, rc, expectedRc,
+                            (0 == rc) == (0 == expectedRc));
+
+                    if (0 == rc && 0 == expectedRc) {
+                        bdljsn::Json json;
+                        X.root().toJson(&json);
+                        ASSERTV(LINE, allow, expected == json);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\tGenerated records." << endl;
+        {
+            const bsl::string TEXT = makeRecords(100);
+
+            bdljsn::Json expected;
+            ASSERT(0 == bdljsn::JsonUtil::read(&expected, TEXT));
+
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 == mX.read(TEXT));
+
+            bdljsn::Json json;
+            X.root().toJson(&json);
+            ASSERT(expected == json);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING ARRAYS
+        //
+        // Concerns:
+        // 1. The elements of an array are accessible in document order, in
+        //    constant time, through `FlatJsonValue` and `FlatJsonArray`.
+        //
+        // 2. Nested arrays and objects are correctly delimited.
+        //
+        // Plan:
+        // 1. Read arrays of various lengths, of values of each type and of
+        //    nested arrays and objects, and verify each element.  (C-1..2)
+        //
+        // Testing:
+        //   FlatJsonArray theArray() const;
+        //   FlatJsonValue operator[](bsl::size_t index) const;
+        //   FlatJsonValue FlatJsonArray::operator[](bsl::size_t index) const;
+        //   bool FlatJsonArray::empty() const;
+        //   bsl::size_t FlatJsonArray::size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING ARRAYS" << endl
+                          << "==============" << endl;
+
+        for (int length = 0; length < 40; ++length) {
+            bsl::ostringstream os;
+            os << "[";
+            for (int i = 0; i < length; ++i) {
+                os << (i ? "," : "") << i;
+            }
+            os << "]";
+
+            Obj mX;  const Obj& X = mX;
+            ASSERTV(length, 0 == mX.read(os.str()));
+
+            const Array array = X.root().theArray();
+            ASSERTV(length, length == static_cast<int>(array.size()));
+            ASSERTV(length, (0 == length) == array.empty());
+            ASSERTV(length, length == static_cast<int>(X.root().size()));
+
+            for (int i = 0; i < length; ++i) {
+                int value;
+                ASSERTV(length, i, 0 == array[i].theNumber().asInt(&value));
+                ASSERTV(length, i, value, i == value);
+                ASSERTV(length, i,
+                        array[i].theNumber().value() ==
+                                       X.root()[i].theNumber().value());
+            }
+        }
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(0 == mX.read(" [ [ ] , [ [ 1 ] , { } ] ,"
+                            " { \"a\" : [ 2 , 3 ] } ,"
+                            " \"s\" , true , null , [ ] ] "));
+
+        const Value ROOT = X.root();
+        ASSERT(7 == ROOT.size());
+        ASSERT(ROOT[0].isArray());
+        ASSERT(ROOT[0].theArray().empty());
+        ASSERT(2 == ROOT[1].size());
+        ASSERT(1 == ROOT[1][0].size());
+        ASSERT("1" == ROOT[1][0][0].theNumber().value());
+        ASSERT(ROOT[1][1].isObject());
+        ASSERT(ROOT[1][1].theObject().empty());
+        ASSERT(2 == ROOT[2]["a"].size());
+        ASSERT("3" == ROOT[2]["a"][1].theNumber().value());
+        ASSERT("s" == ROOT[3].theString());
+        ASSERT(ROOT[4].theBoolean());
+        ASSERT(ROOT[5].isNull());
+        ASSERT(ROOT[6].theArray().empty());
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(ROOT[6]);
+            ASSERT_FAIL(ROOT[7]);
+            ASSERT_FAIL(ROOT[3][0]);
+            ASSERT_PASS(ROOT[3].theString());
+            ASSERT_FAIL(ROOT[3].theArray());
+            ASSERT_FAIL(ROOT[3].size());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING OBJECTS
+        //
+        // Concerns:
+        // 1. The members of an object are accessible by key, and by position
+        //    in key order.
+        //
+        // 2. Of duplicate keys, the value of the first is kept.
+        //
+        // 3. Keys having escape sequences are decoded, and compared by their
+        //    decoded value.
+        //
+        // 4. Absent keys are reported as such, for keys ordered before,
+        //    between, and after the keys of the object.
+        //
+        // Plan:
+        // 1. Read objects of various numbers of members, having their keys in
+        //    various orders, and look up each key and absent keys.  (C-1, 4)
+        //
+        // 2. Read objects having duplicate and escaped keys, and verify their
+        //    members.  (C-2..3)
+        //
+        // Testing:
+        //   FlatJsonObject theObject() const;
+        //   FlatJsonValue operator[](const bsl::string_view& key) const;
+        //   bool contains(const bsl::string_view& key) const;
+        //   bsl::size_t size() const;
+        //   FlatJsonValue FlatJsonObject::operator[](const string_view&);
+        //   bool FlatJsonObject::contains(const bsl::string_view& key) const;
+        //   bool FlatJsonObject::empty() const;
+        //   bsl::size_t FlatJsonObject::find(const bsl::string_view&) const;
+        //   bsl::string_view FlatJsonObject::key(bsl::size_t) const;
+        //   bsl::size_t FlatJsonObject::size() const;
+        //   FlatJsonValue FlatJsonObject::value(bsl::size_t) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING OBJECTS" << endl
+                          << "===============" << endl;
+
+        if (verbose) cout << "\tLookup." << endl;
+
+        for (int numMembers = 0; numMembers < 30; ++numMembers) {
+            for (int order = 0; order < 3; ++order) {
+                // Keys are "k1", "k3", ..., with value the index of the key.
+
+                bsl::ostringstream os;
+                os << "{";
+                for (int i = 0; i < numMembers; ++i) {
+                    const int k = 0 == order ? i
+                                : 1 == order ? numMembers - 1 - i
+                                :              (i * 7) % numMembers;
+                    os << (i ? ", " : "")
+                       << "\"k" << (2 * k + 1 + 100) << "\": " << k;
+                }
+                os << "}";
+
+                if (2 == order && 0 == numMembers % 7) {
+                    continue;  // not a permutation
+                }
+
+                Obj mX;  const Obj& X = mX;
+                ASSERTV(numMembers, order, 0 == mX.read(os.str()));
+
+                const Object object = X.root().theObject();
+                ASSERTV(numMembers, numMembers == (int)object.size());
+                ASSERTV(numMembers, (0 == numMembers) == object.empty());
+
+                for (int k = 0; k < numMembers; ++k) {
+                    bsl::ostringstream key;
+                    key << "k" << (2 * k + 1 + 100);
+
+                    ASSERTV(numMembers, order, k, object.contains(key.str()));
+                    ASSERTV(numMembers, order, k,
+                            X.root().contains(key.str()));
+
+                    const bsl::size_t position = object.find(key.str());
+                    ASSERTV(numMembers, order, k, position,
+                            k == static_cast<int>(position));
+                    ASSERTV(numMembers, order, k,
+                            key.str() == object.key(position));
+
+                    int value;
+                    ASSERT(0 == object[key.str()].theNumber().asInt(&value));
+                    ASSERTV(numMembers, order, k, value, k == value);
+                    ASSERT(0 == object.value(position).theNumber().asInt(
+                                                                     &value));
+                    ASSERTV(numMembers, order, k, value, k == value);
+                    ASSERT(0 == X.root()[key.str()].theNumber().asInt(
+                                                                     &value));
+                    ASSERTV(numMembers, order, k, value, k == value);
+
+                    // Absent keys: before and after each key.
+
+                    bsl::ostringstream before;
+                    before << "k" << (2 * k + 100);
+                    bsl::ostringstream after;
+                    after << "k" << (2 * k + 2 + 100);
+
+                    ASSERTV(numMembers, k, !object.contains(before.str()));
+                    ASSERTV(numMembers, k, !object.contains(after.str()));
+                    ASSERTV(numMembers, k,
+                            object.size() == object.find(after.str()));
+                }
+                ASSERTV(numMembers, !object.contains(""));
+                ASSERTV(numMembers, !object.contains("k"));
+                ASSERTV(numMembers, !object.contains("z"));
+            }
+        }
+
+        if (verbose) cout << "\tDuplicate and escaped keys." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 == mX.read("{\"b\": 1, \"a\": 2, \"b\": 3,"
+                                " \"\\u0061\": 4, \"c\\n\": 5, \"b\": 6,"
+                                " \"\": 7}"));
+
+            const Value ROOT = X.root();
+            ASSERTV(ROOT.size(), 4 == ROOT.size());
+            ASSERT("2" == ROOT["a"].theNumber().value());
+            ASSERT("1" == ROOT["b"].theNumber().value());
+            ASSERT("5" == ROOT["c\n"].theNumber().value());
+            ASSERT("7" == ROOT[""].theNumber().value());
+
+            const Object object = ROOT.theObject();
+            ASSERT(""    == object.key(0));
+            ASSERT("a"   == object.key(1));
+            ASSERT("b"   == object.key(2));
+            ASSERT("c\n" == object.key(3));
+        }
+
+        if (verbose) cout << "\tNested objects." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 == mX.read("{\"z\": {\"y\": {\"x\": [1, {\"w\": 2}]}},"
+                                " \"a\": {}}"));
+
+            const Value ROOT = X.root();
+            ASSERT(2 == ROOT.size());
+            ASSERT(ROOT["a"].theObject().empty());
+            ASSERT("2" == ROOT["z"]["y"]["x"][1]["w"].theNumber().value());
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 == mX.read("{\"a\": 1}"));
+
+            const Value ROOT = X.root();
+
+            ASSERT_PASS(ROOT["a"]);
+            ASSERT_FAIL(ROOT["b"]);
+            ASSERT_FAIL(ROOT["a"]["a"]);
+            ASSERT_PASS(ROOT.theObject().key(0));
+            ASSERT_FAIL(ROOT.theObject().key(1));
+            ASSERT_FAIL(ROOT.theObject().value(1));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING SCALAR VALUES
+        //
+        // Concerns:
+        // 1. A default-constructed document holds `null`, and does not
+        //    allocate.
+        //
+        // 2. The allocator supplied at construction, or else the default
+        //    allocator, is used.
+        //
+        // 3. Each type of scalar value is read, with its value, at the top
+        //    level and as an element.
+        //
+        // 4. Strings are decoded, and refer to the text of the document.
+        //
+        // 5. The numeric conversions of `FlatJsonNumber` are those of
+        //    `JsonNumber`.
+        //
+        // Plan:
+        // 1. Create documents with and without an allocator, and verify their
+        //    value and allocator.  (C-1..2)
+        //
+        // 2. For a table of scalar values, read the value at the top level
+        //    and in an array, and verify its type and value.  (C-3..4)
+        //
+        // 3. For a table of numbers, compare the conversions of
+        //    `FlatJsonNumber` with those of `JsonNumber`.  (C-5)
+        //
+        // Testing:
+        //   FlatJson();
+        //   explicit FlatJson(bslma::Allocator *basicAllocator);
+        //   ~FlatJson();
+        //   int read(const bsl::string_view& input);
+        //   FlatJsonValue root() const;
+        //   bsl::size_t numNodes() const;
+        //   bslma::Allocator *allocator() const;
+        //   JsonType::Enum type() const;
+        //   bool isArray() const;
+        //   bool isBoolean() const;
+        //   bool isNull() const;
+        //   bool isNumber() const;
+        //   bool isObject() const;
+        //   bool isString() const;
+        //   bool theBoolean() const;
+        //   JsonNull theNull() const;
+        //   FlatJsonNumber theNumber() const;
+        //   bsl::string_view theString() const;
+        //   bool isIntegral() const;
+        //   bsl::string_view value() const;
+        //   int asInt(int *result) const;
+        //   int asInt64(bsls::Types::Int64 *result) const;
+        //   int asUint(unsigned int *result) const;
+        //   int asUint64(bsls::Types::Uint64 *result) const;
+        //   float asFloat() const;
+        //   double asDouble() const;
+        //   bdldfp::Decimal64 asDecimal64() const;
+        //   int asDecimal64Exact(bdldfp::Decimal64 *result) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING SCALAR VALUES" << endl
+                          << "=====================" << endl;
+
+        if (verbose) cout << "\tDefault construction." << endl;
+        {
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+            Obj mX;  const Obj& X = mX;
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(X.root().isNull());
+            ASSERT(JsonType::e_NULL == X.root().type());
+            ASSERT(1 == X.numNodes());
+            ASSERT(dam.isTotalSame());
+
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            Obj mY(&oa);  const Obj& Y = mY;
+            ASSERT(&oa == Y.allocator());
+            ASSERT(Y.root().isNull());
+            ASSERT(0 == oa.numAllocations());
+
+            ASSERT(0 == mY.read("[1, 2]"));
+            ASSERT(0 <  oa.numAllocations());
+            ASSERT(dam.isTotalSame());
+        }
+
+        if (verbose) cout << "\tScalar values." << endl;
+
+        static const struct {
+            int             d_line;
+            const char     *d_text_p;
+            JsonType::Enum  d_type;
+            const char     *d_value_p;  // string or number text, or 0
+            bool            d_boolean;
+        } DATA[] = {
+            // LINE TEXT               TYPE                 VALUE      BOOLEAN
+            // ---- -----------------  -------------------  ---------  -------
+            { L_,   "null",            JsonType::e_NULL,    0,         false },
+            { L_,   "true",            JsonType::e_BOOLEAN, 0,         true  },
+            { L_,   "false",           JsonType::e_BOOLEAN, 0,         false },
+            { L_,   "0",               JsonType::e_NUMBER,  "0",       false },
+            { L_,   "-12.5e3",         JsonType::e_NUMBER,  "-12.5e3", false },
+            { L_,   "\"\"",            JsonType::e_STRING,  "",        false },
+            { L_,   "\"abc\"",         JsonType::e_STRING,  "abc",     false },
+            { L_,   "\"a\\\"b\"",      JsonType::e_STRING,  "a\"b",    false },
+            { L_,   "\"\\\\\\/\"",     JsonType::e_STRING,  "\\/",     false },
+            { L_,   "\"\\b\\f\\n\\r\\t\"",
+                                       JsonType::e_STRING,  "\b\f\n\r\t",
+                                                                       false },
+            { L_,   "\"\\u00e9\\u4e16\"",
+                                       JsonType::e_STRING,  "\xC3\xA9"
+                                                            "\xE4\xB8\x96",
+                                                                       false },
+            { L_,   "\"\\ud83d\\ude00!\"",
+                                       JsonType::e_STRING,  "\xF0\x9F\x98\x80"
+                                                            "!",       false },
+            { L_,   "\"caf\xC3\xA9\"", JsonType::e_STRING,  "caf\xC3\xA9",
+                                                                       false },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int            LINE    = DATA[ti].d_line;
+            const bsl::string    TEXT    = DATA[ti].d_text_p;
+            const JsonType::Enum TYPE    = DATA[ti].d_type;
+            const char *const    VALUE   = DATA[ti].d_value_p;
+            const bool           BOOLEAN = DATA[ti].d_boolean;
+
+            const bsl::string TEXTS[] = { TEXT,
+                                          " \t\r\n" + TEXT + " \n",
+                                          "[" + TEXT + "]",
+                                          "[null, " + TEXT + ", 1]" };
+
+            for (int i = 0; i < 4; ++i) {
+                Obj mX;  const Obj& X = mX;
+                ASSERTV(LINE, i, 0 == mX.read(TEXTS[i]));
+
+                const Value V = 2 == i ? X.root()[0]
+                              : 3 == i ? X.root()[1]
+                              :          X.root();
+
+                ASSERTV(LINE, i, TYPE == V.type());
+                ASSERTV(LINE, i, (JsonType::e_NULL    == TYPE) == V.isNull());
+                ASSERTV(LINE, i, (JsonType::e_BOOLEAN == TYPE) ==
+                                                               V.isBoolean());
+                ASSERTV(LINE, i, (JsonType::e_NUMBER  == TYPE) ==
+                                                                V.isNumber());
+                ASSERTV(LINE, i, (JsonType::e_STRING  == TYPE) ==
+                                                                V.isString());
+                ASSERTV(LINE, i, !V.isArray());
+                ASSERTV(LINE, i, !V.isObject());
+
+                switch (TYPE) {
+                  case JsonType::e_NULL: {
+                    ASSERTV(LINE, i, bdljsn::JsonNull() == V.theNull());
+                  } break;
+                  case JsonType::e_BOOLEAN: {
+                    ASSERTV(LINE, i, BOOLEAN == V.theBoolean());
+                  } break;
+                  case JsonType::e_NUMBER: {
+                    ASSERTV(LINE, i, VALUE == V.theNumber().value());
+                  } break;
+                  case JsonType::e_STRING: {
+                    const bsl::string_view STRING = V.theString();
+                    ASSERTV(LINE, i, STRING, VALUE == STRING);
+                  } break;
+                  default: {
+                    ASSERTV(LINE, "unexpected type", false);
+                  } break;
+                }
+            }
+        }
+
+        if (verbose) cout << "\tNumeric conversions." << endl;
+
+        static const char *const NUMBERS[] = {
+            "0", "1", "-1", "42", "1.5", "-2.75", "1e2", "1.0",
+            "2147483647", "2147483648", "-2147483648", "-2147483649",
+            "4294967295", "4294967296", "9223372036854775807",
+            "9223372036854775808", "18446744073709551615",
+            "18446744073709551616", "0.1", "1e400", "-1e-400",
+            "123456789012345678901234567890",
+        };
+        const int NUM_NUMBERS = sizeof NUMBERS / sizeof *NUMBERS;
+
+        for (int ti = 0; ti < NUM_NUMBERS; ++ti) {
+            const char *const NUMBER = NUMBERS[ti];
+
+            Obj mX;  const Obj& X = mX;
+            ASSERTV(NUMBER, 0 == mX.read(NUMBER));
+
+            const Number             N = X.root().theNumber();
+            const bdljsn::JsonNumber EXP(NUMBER);
+
+            ASSERTV(NUMBER, EXP.isIntegral() == N.isIntegral());
+
+            int                 i,   expI;
+            bsls::Types::Int64  i64, expI64;
+            unsigned int        u,   expU;
+            bsls::Types::Uint64 u64, expU64;
+            bdldfp::Decimal64   d,   expD;
+
+            ASSERTV(NUMBER, EXP.asInt(&expI) == N.asInt(&i));
+            ASSERTV(NUMBER, expI == i);
+            ASSERTV(NUMBER, EXP.asInt64(&expI64) == N.asInt64(&i64));
+            ASSERTV(NUMBER, expI64 == i64);
+            ASSERTV(NUMBER, EXP.asUint(&expU) == N.asUint(&u));
+            ASSERTV(NUMBER, expU == u);
+            ASSERTV(NUMBER, EXP.asUint64(&expU64) == N.asUint64(&u64));
+            ASSERTV(NUMBER, expU64 == u64);
+            ASSERTV(NUMBER, EXP.asDecimal64Exact(&expD) ==
+                                                       N.asDecimal64Exact(&d));
+            ASSERTV(NUMBER, expD == d);
+            ASSERTV(NUMBER, EXP.asDecimal64() == N.asDecimal64());
+            ASSERTV(NUMBER, EXP.asDouble()    == N.asDouble());
+            ASSERTV(NUMBER, EXP.asFloat()     == N.asFloat());
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 == mX.read("[\"s\", 1, true, null]"));
+
+            const Value ROOT = X.root();
+
+            ASSERT_PASS(ROOT[0].theString());
+            ASSERT_FAIL(ROOT[0].theNumber());
+            ASSERT_PASS(ROOT[1].theNumber());
+            ASSERT_FAIL(ROOT[1].theBoolean());
+            ASSERT_PASS(ROOT[2].theBoolean());
+            ASSERT_FAIL(ROOT[2].theNull());
+            ASSERT_PASS(ROOT[3].theNull());
+            ASSERT_FAIL(ROOT[3].theString());
+            ASSERT_FAIL(ROOT[3].theObject());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Read a small document and access each of its values.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        ASSERT(X.root().isNull());
+
+        const int rc = mX.read("{\"name\": \"a\\tb\", \"values\": [1, 2.5],"
+                               " \"ok\": true, \"none\": null}");
+        ASSERT(0 == rc);
+
+        const Value ROOT = X.root();
+        ASSERT(ROOT.isObject());
+        ASSERT(4 == ROOT.size());
+        ASSERT(ROOT.contains("name"));
+        ASSERT(!ROOT.contains("nope"));
+        ASSERT("a\tb" == ROOT["name"].theString());
+        ASSERT(2 == ROOT["values"].size());
+        ASSERT("2.5" == ROOT["values"][1].theNumber().value());
+        ASSERT(ROOT["ok"].theBoolean());
+        ASSERT(ROOT["none"].isNull());
+
+        bdljsn::Json json;
+        ROOT.toJson(&json);
+        ASSERT(json.isObject());
+        ASSERT(4 == json.size());
+        ASSERT("a\tb" == json["name"].theString());
+
+        bdljsn::Error error;
+        ASSERT(0 != mX.read(&error, "{\"name\": }"));
+        ASSERT(ROOT.isObject());
+        ASSERT(bdljsn::Location(9) == error.location());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COMPARISON WITH `JsonUtil::read`
+        //
+        // Concerns:
+        // 1. Reading a document into a `FlatJson` is substantially faster, and
+        //    uses substantially less memory and fewer allocations, than
+        //    reading it into a `Json`.
+        //
+        // Plan:
+        // 1. Read a document of records repeatedly with `JsonUtil::read` and
+        //    with `FlatJson::read`, and report the throughput, the number of
+        //    allocations per read, and the memory in use after reading.  The
+        //    number of iterations is given by the second command-line
+        //    argument (default: 20).
+        //
+        // Testing:
+        //   PERFORMANCE: COMPARISON WITH `JsonUtil::read`
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: COMPARISON WITH `JsonUtil::read`" << endl
+             << "=============================================" << endl;
+
+        const int NUM_ITERATIONS = argc > 2 && bsl::atoi(argv[2]) > 0
+                                 ? bsl::atoi(argv[2])
+                                 : 20;
+
+        const bsl::string TEXT = makeRecords(10000);
+        const double      MB   = static_cast<double>(TEXT.size()) / 1e6;
+
+        cout << "Document: " << TEXT.size() << " bytes" << endl;
+
+        {
+            bslma::TestAllocator ta("json");
+            bsls::Stopwatch      timer;
+
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                bdljsn::Json json(&ta);
+                ASSERT(0 == bdljsn::JsonUtil::read(&json, TEXT));
+            }
+            timer.stop();
+
+            bdljsn::Json json(&ta);
+            const bsls::Types::Int64 before = ta.numAllocations();
+            ASSERT(0 == bdljsn::JsonUtil::read(&json, TEXT));
+
+            cout << "JsonUtil::read: "
+                 << MB * NUM_ITERATIONS / timer.elapsedTime() << " MB/s, "
+                 << ta.numAllocations() - before << " allocations, "
+                 << ta.numBytesInUse() << " bytes in use" << endl;
+        }
+        {
+            bslma::TestAllocator ta("flat");
+            bsls::Stopwatch      timer;
+
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                Obj mX(&ta);
+                ASSERT(0 == mX.read(TEXT));
+            }
+            timer.stop();
+
+            Obj mX(&ta);
+            const bsls::Types::Int64 before = ta.numAllocations();
+            ASSERT(0 == mX.read(TEXT));
+
+            cout << "FlatJson::read: "
+                 << MB * NUM_ITERATIONS / timer.elapsedTime() << " MB/s, "
+                 << ta.numAllocations() - before << " allocations, "
+                 << ta.numBytesInUse() << " bytes in use" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
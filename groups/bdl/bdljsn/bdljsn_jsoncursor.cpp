@@ -0,0 +1,728 @@
+// bdljsn_jsoncursor.cpp                                              -*-C++-*-
+#include <bdljsn_jsoncursor.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdljsn_jsoncursor_cpp, "$Id$ $CSID$")
+
+#include <bdljsn_json.h>
+#include <bdljsn_jsonnumber.h>
+#include <bdljsn_numberutil.h>
+#include <bdljsn_readoptions.h>
+#include <bdljsn_stringutil.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstring.h>
+#include <bsl_limits.h>
+
+///Implementation Notes
+///--------------------
+// The position of the cursor is described by the stack of the containers
+// enclosing the current value (`d_frames`, with the name of the current
+// member of each object in `d_keys`), and by whether the current value has
+// been read (`d_consumed`): if not, the tokenizer is on the first token of
+// the current value (`e_START_OBJECT`, `e_START_ARRAY`, or
+// `e_ELEMENT_VALUE`), and otherwise on its last token (`e_END_OBJECT`,
+// `e_END_ARRAY`, or `e_ELEMENT_VALUE`).  Entering a container pushes a frame
+// having no current child, its (notional) current child being read, so that
+// moving to the next child is, in all cases, advancing the tokenizer.
+//
+// A value is passed over by tracking the nesting of the containers until the
+// end of the value.  The tokenizer checks the syntax of the text, except that
+// it does not check that a container is closed by a bracket of its own kind,
+// nor the syntax of scalar values, which are therefore checked here.  Member
+// names, and strings passed over, are decoded only if they have escape
+// sequences.
+//
+// `find` first determines the longest common prefix of the position of the
+// cursor and of the pointer.  If the current value is on the path of the
+// pointer and has not been read, the pointer is resolved from the current
+// value.  Otherwise, the enclosing containers are passed over up to the
+// container at the end of the common prefix, and the pointer is resolved
+// from the remaining children of that container, if the child sought can
+// follow the current child (which is always the case for an object, as the
+// order of its members is not known).  If the value is not found, and the
+// search did not start from the beginning of the document, the document is
+// read again from the beginning.
+
+namespace BloombergLP {
+namespace bdljsn {
+namespace {
+namespace u {
+
+/// Load into the specified `result` the value on the first token of which
+/// the specified `tokenizer` is, not exceeding the specified
+/// `maxNestedDepth`, and leave `tokenizer` on the last token of the value.
+/// Return 0 on success, and a non-zero value otherwise.
+int readValue(Json *result, Tokenizer *tokenizer, int maxNestedDepth);
+
+/// Load into the specified `result` the object on the `e_START_OBJECT` token
+/// of which the specified `tokenizer` is, not exceeding the specified
+/// `maxNestedDepth`, and leave `tokenizer` on its `e_END_OBJECT` token.
+/// Return 0 on success, and a non-zero value otherwise.  Of duplicate
+/// members, the first is kept.
+int readObject(JsonObject *result, Tokenizer *tokenizer, int maxNestedDepth)
+{
+    if (maxNestedDepth < 0) {
+        return -1;                                                    // RETURN
+    }
+
+    bsl::string key;
+    while (true) {
+        if (0 != tokenizer->advanceToNextToken()) {
+            return -1;                                                // RETURN
+        }
+        if (Tokenizer::e_END_OBJECT == tokenizer->tokenType()) {
+            return 0;                                                 // RETURN
+        }
+        if (Tokenizer::e_ELEMENT_NAME != tokenizer->tokenType()) {
+            return -1;                                                // RETURN
+        }
+
+        bsl::string_view name;
+        tokenizer->value(&name);
+        if (0 != StringUtil::readUnquotedString(&key, name)
+         || 0 != tokenizer->advanceToNextToken()) {
+            return -1;                                                // RETURN
+        }
+
+        int rc;
+        if (result->contains(key)) {
+            Json temp;
+            rc = readValue(&temp, tokenizer, maxNestedDepth);
+        }
+        else {
+            rc = readValue(&(*result)[key], tokenizer, maxNestedDepth);
+        }
+        if (0 != rc) {
+            return rc;                                                // RETURN
+        }
+    }
+}
+
+/// Load into the specified `result` the array on the `e_START_ARRAY` token of
+/// which the specified `tokenizer` is, not exceeding the specified
+/// `maxNestedDepth`, and leave `tokenizer` on its `e_END_ARRAY` token.
+/// Return 0 on success, and a non-zero value otherwise.
+int readArray(JsonArray *result, Tokenizer *tokenizer, int maxNestedDepth)
+{
+    if (maxNestedDepth < 0) {
+        return -1;                                                    // RETURN
+    }
+
+    while (true) {
+        if (0 != tokenizer->advanceToNextToken()) {
+            return -1;                                                // RETURN
+        }
+        if (Tokenizer::e_END_ARRAY == tokenizer->tokenType()) {
+            return 0;                                                 // RETURN
+        }
+
+        result->pushBack(Json());
+        int rc = readValue(&result->back(), tokenizer, maxNestedDepth);
+        if (0 != rc) {
+            return rc;                                                // RETURN
+        }
+    }
+}
+
+int readValue(Json *result, Tokenizer *tokenizer, int maxNestedDepth)
+{
+    switch (tokenizer->tokenType()) {
+      case Tokenizer::e_START_OBJECT: {
+        return readObject(&result->makeObject(),
+                          tokenizer,
+                          maxNestedDepth - 1);                        // RETURN
+      }
+      case Tokenizer::e_START_ARRAY: {
+        return readArray(&result->makeArray(),
+                         tokenizer,
+                         maxNestedDepth - 1);                         // RETURN
+      }
+      case Tokenizer::e_ELEMENT_VALUE: {
+        bsl::string_view value;
+        tokenizer->value(&value);
+
+        if ("null" == value) {
+            result->makeNull();
+        }
+        else if ("true" == value || "false" == value) {
+            result->makeBoolean("true" == value);
+        }
+        else if ('"' == value[0]) {
+            bsl::string string(result->allocator());
+            if (0 != StringUtil::readString(&string, value)) {
+                return -1;                                            // RETURN
+            }
+            result->makeString(bslmf::MovableRefUtil::move(string));
+        }
+        else if (NumberUtil::isValidNumber(value)) {
+            result->makeNumber(JsonNumber(value));
+        }
+        else {
+            return -1;                                                // RETURN
+        }
+        return 0;                                                     // RETURN
+      }
+      default: {
+        return -1;                                                    // RETURN
+      }
+    }
+}
+
+/// Load into the specified `result` the array index denoted by the specified
+/// `token`.  Return 0 on success, and a non-zero value if `token` is not a
+/// decimal number without leading zeros that fits in a `bsl::size_t`.
+int parseIndex(bsl::size_t *result, const bsl::string_view& token)
+{
+    if (token.empty() || ('0' == token[0] && 1 < token.size())) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsl::size_t k_MAX = bsl::numeric_limits<bsl::size_t>::max();
+
+    bsl::size_t index = 0;
+    for (bsl::size_t i = 0; i < token.size(); ++i) {
+        const unsigned digit = static_cast<unsigned char>(token[i]) - '0';
+        if (9 < digit || (k_MAX - digit) / 10 < index) {
+            return -1;                                                // RETURN
+        }
+        index = index * 10 + digit;
+    }
+    *result = index;
+    return 0;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                              // ----------------
+                              // class JsonCursor
+                              // ----------------
+
+// PRIVATE MANIPULATORS
+int JsonCursor::advance()
+{
+    if (0 != d_tokenizer.advanceToNextToken()
+     || Tokenizer::e_ERROR == d_tokenizer.tokenType()) {
+        d_status = k_INVALID_JSON;
+        return d_status;                                              // RETURN
+    }
+
+    if (Tokenizer::e_ELEMENT_NAME == d_tokenizer.tokenType()) {
+        // Decode escaped names even if they are skipped, so that a bad escape
+        // is rejected as `JsonUtil::read` rejects it.
+
+        bsl::string_view name;
+        d_tokenizer.value(&name);
+
+        if (bsl::string_view::npos != name.find('\\')
+         && 0 != StringUtil::readUnquotedString(&d_scratch, name)) {
+            d_status = k_INVALID_JSON;
+        }
+        return d_status;                                              // RETURN
+    }
+
+    if (Tokenizer::e_ELEMENT_VALUE != d_tokenizer.tokenType()) {
+        return 0;                                                     // RETURN
+    }
+
+    bsl::string_view value;
+    d_tokenizer.value(&value);
+
+    bool isValid;
+    switch (value[0]) {
+      case '"': {
+        isValid = bsl::string_view::npos == value.find('\\')
+               || 0 == StringUtil::readString(&d_scratch, value);
+      } break;
+      case 't': {
+        isValid = "true" == value;
+      } break;
+      case 'f': {
+        isValid = "false" == value;
+      } break;
+      case 'n': {
+        isValid = "null" == value;
+      } break;
+      default: {
+        isValid = NumberUtil::isValidNumber(value);
+      } break;
+    }
+
+    if (!isValid) {
+        d_status = k_INVALID_JSON;
+    }
+    return d_status;
+}
+
+int JsonCursor::findForward()
+{
+    const bsl::size_t numTargets = d_targets.size();
+
+    // Determine the longest common prefix of the position and the pointer.
+
+    bsl::size_t level = 0;
+    while (level < d_depth && level < numTargets) {
+        const Frame& frame = d_frames[level];
+        if (0 == frame.d_count) {
+            break;
+        }
+        if (frame.d_isObject) {
+            if (d_names[level] != d_keys[level]) {
+                break;
+            }
+        }
+        else if (!d_targets[level].d_isIndex
+              || d_targets[level].d_index != frame.d_count - 1) {
+            break;
+        }
+        ++level;
+    }
+
+    if (level == d_depth) {
+        if (d_consumed) {
+            return k_NOT_FOUND;                                       // RETURN
+        }
+    }
+    else {
+        int rc = finishCurrent();
+        if (0 != rc) {
+            return rc;                                                // RETURN
+        }
+        if (level == numTargets) {
+            // The value sought encloses the current position.
+
+            return k_NOT_FOUND;                                       // RETURN
+        }
+        while (level + 1 < d_depth) {
+            do {
+                rc = moveToNextChild();
+                if (0 == rc) {
+                    rc = finishCurrent();
+                }
+            } while (0 == rc);
+            if (rc < 0) {
+                return rc;                                            // RETURN
+            }
+        }
+
+        const Frame& frame = d_frames[level];
+        if (!frame.d_isObject
+         && (!d_targets[level].d_isIndex
+          || d_targets[level].d_index < frame.d_count)) {
+            // The element sought precedes the current one.
+
+            return k_NOT_FOUND;                                       // RETURN
+        }
+
+        rc = findChild(level);
+        if (0 != rc) {
+            return rc;                                                // RETURN
+        }
+        ++level;
+    }
+
+    for (; level < numTargets; ++level) {
+        const Tokenizer::TokenType token = d_tokenizer.tokenType();
+
+        bool isContainer = Tokenizer::e_START_OBJECT == token
+                        || (Tokenizer::e_START_ARRAY == token
+                         && d_targets[level].d_isIndex);
+        if (!isContainer) {
+            int rc = finishCurrent();
+            return 0 == rc ? k_NOT_FOUND : rc;                        // RETURN
+        }
+
+        if (d_frames.size() == d_depth) {
+            d_frames.emplace_back();
+            d_keys.emplace_back();
+        }
+        d_frames[d_depth].d_isObject = Tokenizer::e_START_OBJECT == token;
+        d_frames[d_depth].d_count    = 0;
+        ++d_depth;
+        d_consumed = true;
+
+        int rc = findChild(level);
+        if (0 != rc) {
+            return rc;                                                // RETURN
+        }
+    }
+    return 0;
+}
+
+int JsonCursor::findChild(bsl::size_t level)
+{
+    BSLS_ASSERT(0 < d_depth);
+    BSLS_ASSERT(d_consumed);
+
+    const bsl::size_t depth    = d_depth;
+    const bool        isObject = d_frames[depth - 1].d_isObject;
+
+    while (true) {
+        int rc = moveToNextChild();
+        if (0 != rc) {
+            return rc < 0 ? rc : k_NOT_FOUND;                         // RETURN
+        }
+
+        if (isObject ? d_names[level] == d_keys[depth - 1]
+                     : d_targets[level].d_index
+                                            == d_frames[depth - 1].d_count - 1)
+        {
+            return 0;                                                 // RETURN
+        }
+
+        rc = finishCurrent();
+        if (0 != rc) {
+            return rc;                                                // RETURN
+        }
+    }
+}
+
+int JsonCursor::finishCurrent()
+{
+    if (d_consumed) {
+        return 0;                                                     // RETURN
+    }
+
+    const Tokenizer::TokenType token = d_tokenizer.tokenType();
+    if (Tokenizer::e_START_OBJECT == token
+     || Tokenizer::e_START_ARRAY  == token) {
+        d_nesting.clear();
+        d_nesting.push_back(static_cast<char>(token));
+        do {
+            if (0 != advance()) {
+                return d_status;                                      // RETURN
+            }
+            switch (d_tokenizer.tokenType()) {
+              case Tokenizer::e_START_OBJECT:
+              case Tokenizer::e_START_ARRAY: {
+                d_nesting.push_back(static_cast<char>(
+                                                    d_tokenizer.tokenType()));
+              } break;
+              case Tokenizer::e_END_OBJECT: {
+                if (Tokenizer::e_START_OBJECT != d_nesting.back()) {
+                    d_status = k_INVALID_JSON;
+                    return d_status;                                  // RETURN
+                }
+                d_nesting.pop_back();
+              } break;
+              case Tokenizer::e_END_ARRAY: {
+                if (Tokenizer::e_START_ARRAY != d_nesting.back()) {
+                    d_status = k_INVALID_JSON;
+                    return d_status;                                  // RETURN
+                }
+                d_nesting.pop_back();
+              } break;
+              default: {
+              } break;
+            }
+        } while (!d_nesting.empty());
+    }
+    d_consumed = true;
+    return 0;
+}
+
+int JsonCursor::moveToNextChild()
+{
+    BSLS_ASSERT(0 < d_depth);
+    BSLS_ASSERT(d_consumed);
+
+    if (0 != advance()) {
+        return d_status;                                              // RETURN
+    }
+
+    Frame& frame = d_frames[d_depth - 1];
+    switch (d_tokenizer.tokenType()) {
+      case Tokenizer::e_END_OBJECT:
+      case Tokenizer::e_END_ARRAY: {
+        const bool isEndObject =
+                           Tokenizer::e_END_OBJECT == d_tokenizer.tokenType();
+        if (frame.d_isObject != isEndObject) {
+            d_status = k_INVALID_JSON;
+            return d_status;                                          // RETURN
+        }
+        --d_depth;
+        return 1;                                                     // RETURN
+      }
+      case Tokenizer::e_ELEMENT_NAME: {
+        bsl::string_view name;
+        d_tokenizer.value(&name);
+
+        bsl::string& key = d_keys[d_depth - 1];
+        if (bsl::string_view::npos == name.find('\\')) {
+            key.assign(name.data(), name.size());
+        }
+        else if (0 != StringUtil::readUnquotedString(&key, name)) {
+            d_status = k_INVALID_JSON;
+            return d_status;                                          // RETURN
+        }
+        if (0 != advance()) {
+            return d_status;                                          // RETURN
+        }
+      } break;
+      default: {
+      } break;
+    }
+
+    ++frame.d_count;
+    d_consumed = false;
+    return 0;
+}
+
+int JsonCursor::parsePointer(const bsl::string_view& pointer)
+{
+    d_targets.clear();
+
+    if (pointer.empty()) {
+        return 0;                                                     // RETURN
+    }
+    if ('/' != pointer[0]) {
+        return -1;                                                    // RETURN
+    }
+
+    bsl::size_t begin = 1;
+    while (true) {
+        bsl::size_t end = pointer.find('/', begin);
+        if (bsl::string_view::npos == end) {
+            end = pointer.size();
+        }
+
+        const bsl::size_t level = d_targets.size();
+        if (d_names.size() == level) {
+            d_names.emplace_back();
+        }
+        bsl::string& name = d_names[level];
+        name.clear();
+
+        for (bsl::size_t i = begin; i < end; ++i) {
+            if ('~' != pointer[i]) {
+                name.push_back(pointer[i]);
+            }
+            else if (i + 1 < end && '0' == pointer[i + 1]) {
+                name.push_back('~');
+                ++i;
+            }
+            else if (i + 1 < end && '1' == pointer[i + 1]) {
+                name.push_back('/');
+                ++i;
+            }
+            else {
+                return -1;                                            // RETURN
+            }
+        }
+
+        Target target;
+        target.d_isIndex = 0 == u::parseIndex(&target.d_index, name);
+        d_targets.push_back(target);
+
+        if (end == pointer.size()) {
+            return 0;                                                 // RETURN
+        }
+        begin = end + 1;
+    }
+}
+
+int JsonCursor::rewind()
+{
+    if (bsl::streampos(-1) == d_start
+     || d_start != d_input_p->pubseekpos(d_start, bsl::ios_base::in)) {
+        return k_NOT_FOUND;                                           // RETURN
+    }
+    start();
+    return d_status;
+}
+
+void JsonCursor::start()
+{
+    d_tokenizer.reset(d_input_p);
+    d_depth    = 0;
+    d_consumed = false;
+    d_status   = 0;
+    advance();
+}
+
+// CREATORS
+JsonCursor::JsonCursor(bslma::Allocator *basicAllocator)
+: d_buffer(0, 0)
+, d_input_p(0)
+, d_start(-1)
+, d_tokenizer(basicAllocator)
+, d_frames(basicAllocator)
+, d_keys(basicAllocator)
+, d_depth(0)
+, d_consumed(true)
+, d_status(0)
+, d_targets(basicAllocator)
+, d_names(basicAllocator)
+, d_nesting(basicAllocator)
+, d_scratch(basicAllocator)
+{
+    d_tokenizer.setConformanceMode(Tokenizer::e_STRICT_20240119);
+}
+
+JsonCursor::~JsonCursor()
+{
+}
+
+// MANIPULATORS
+int JsonCursor::find(const bsl::string_view& pointer)
+{
+    BSLS_ASSERT(d_input_p);
+
+    if (0 != d_status) {
+        return d_status;                                              // RETURN
+    }
+    if (0 != parsePointer(pointer)) {
+        return k_INVALID_POINTER;                                     // RETURN
+    }
+
+    const bool fromBeginning = 0 == d_depth && !d_consumed;
+
+    int rc = findForward();
+    if (k_NOT_FOUND == rc && !fromBeginning) {
+        rc = rewind();
+        if (0 == rc) {
+            rc = findForward();
+        }
+    }
+    return rc;
+}
+
+int JsonCursor::read(Json *result)
+{
+    BSLS_ASSERT(result);
+
+    if (!hasValue()) {
+        return -1;                                                    // RETURN
+    }
+
+    Json value(result->allocator());
+    if (0 != u::readValue(&value,
+                          &d_tokenizer,
+                          ReadOptions().maxNestedDepth())) {
+        d_status = k_INVALID_JSON;
+        return d_status;                                              // RETURN
+    }
+    d_consumed = true;
+    result->swap(value);
+    return 0;
+}
+
+int JsonCursor::read(bsl::string *result)
+{
+    BSLS_ASSERT(result);
+
+    if (!hasValue() || JsonType::e_STRING != type()) {
+        return -1;                                                    // RETURN
+    }
+
+    bsl::string_view value;
+    d_tokenizer.value(&value);
+
+    bsl::string string(result->get_allocator());
+    if (0 != StringUtil::readString(&string, value)) {
+        d_status = k_INVALID_JSON;
+        return d_status;                                              // RETURN
+    }
+    d_consumed = true;
+    result->swap(string);
+    return 0;
+}
+
+int JsonCursor::read(JsonNumber *result)
+{
+    BSLS_ASSERT(result);
+
+    if (!hasValue() || JsonType::e_NUMBER != type()) {
+        return -1;                                                    // RETURN
+    }
+
+    bsl::string_view value;
+    d_tokenizer.value(&value);
+
+    d_consumed = true;
+    *result    = JsonNumber(value);
+    return 0;
+}
+
+int JsonCursor::read(bool *result)
+{
+    BSLS_ASSERT(result);
+
+    if (!hasValue() || JsonType::e_BOOLEAN != type()) {
+        return -1;                                                    // RETURN
+    }
+
+    bsl::string_view value;
+    d_tokenizer.value(&value);
+
+    d_consumed = true;
+    *result    = 't' == value[0];
+    return 0;
+}
+
+void JsonCursor::reset(bsl::streambuf *input)
+{
+    BSLS_ASSERT(input);
+
+    d_input_p = input;
+    d_start   = input->pubseekoff(0, bsl::ios_base::cur, bsl::ios_base::in);
+    start();
+}
+
+void JsonCursor::reset(const bsl::string_view& text)
+{
+    d_buffer.pubsetbuf(text.data(), static_cast<bsl::streamsize>(text.size()));
+    reset(&d_buffer);
+}
+
+// ACCESSORS
+JsonType::Enum JsonCursor::type() const
+{
+    BSLS_ASSERT(hasValue());
+
+    switch (d_tokenizer.tokenType()) {
+      case Tokenizer::e_START_OBJECT: {
+        return JsonType::e_OBJECT;                                    // RETURN
+      }
+      case Tokenizer::e_START_ARRAY: {
+        return JsonType::e_ARRAY;                                     // RETURN
+      }
+      default: {
+      } break;
+    }
+
+    bsl::string_view value;
+    d_tokenizer.value(&value);
+    BSLS_ASSERT(!value.empty());
+
+    switch (value[0]) {
+      case '"': return JsonType::e_STRING;                            // RETURN
+      case 't':
+      case 'f': return JsonType::e_BOOLEAN;                           // RETURN
+      case 'n': return JsonType::e_NULL;                              // RETURN
+      default:  return JsonType::e_NUMBER;                            // RETURN
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
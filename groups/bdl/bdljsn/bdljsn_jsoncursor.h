@@ -0,0 +1,445 @@
+// bdljsn_jsoncursor.h                                                -*-C++-*-
+#ifndef INCLUDED_BDLJSN_JSONCURSOR
+#define INCLUDED_BDLJSN_JSONCURSOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a cursor for on-demand navigation of JSON text.
+//
+//@CLASSES:
+//  bdljsn::JsonCursor: forward cursor locating values of JSON text by pointer
+//
+//@SEE_ALSO: bdljsn_tokenizer, bdljsn_jsonutil, bdljsn_flatjson
+//
+//@DESCRIPTION: This component provides a class, `bdljsn::JsonCursor`, that
+// locates values of a JSON document, identified by JSON pointers (RFC 6901),
+// directly in its JSON text, and reads only the values that are located.
+//
+// Reading a document with `bdljsn::JsonUtil::read` (or `bdljsn::FlatJson`)
+// represents every value of the document, whether or not it is needed.  When
+// only a few values of a large document are of interest (e.g., the routing
+// fields of a message, or one record of a large array), a
+// `bdljsn::JsonCursor` avoids most of that work: it reads the text with a
+// `bdljsn::Tokenizer`, passes over the values preceding the one located
+// without representing them (i.e., without allocating memory for, or
+// decoding, their strings, keys, and numbers), and stops reading as soon as
+// the value is found.  The value located can then be read as a `bsl::string`,
+// a `bdljsn::JsonNumber`, a `bool`, or (for any type of value) a
+// `bdljsn::Json`.
+//
+///JSON Pointers
+///-------------
+// The values of the document are identified by JSON pointers as specified by
+// RFC 6901: a pointer is either empty (identifying the whole document), or a
+// sequence of reference tokens each preceded by `/`, in which `~1` denotes
+// `/` and `~0` denotes `~`.  A reference token identifies, in an object, the
+// member having that name, and, in an array, the element having that index
+// (a decimal number without leading zeros).  For example, in:
+// ```
+// { "a": { "b/c": [ 10, 20 ] } }
+// ```
+// the pointer `/a/b~1c/1` identifies the number 20.  Pointers are always
+// resolved from the root of the document, irrespective of the current
+// position of the cursor.  If an object has duplicate member names, the
+// member located is the first having the name that follows the current
+// position; in particular, the first of the object (as for
+// `bdljsn::JsonUtil::read`) if the object has not been entered yet.
+//
+///Order of Access
+///---------------
+// The JSON text is read forward, so that values are best located in
+// document order.  A value that follows the current position of the cursor
+// (e.g., a later member of the object of the current value, or the next
+// element of an array, as when iterating over an array by successive
+// indices) is located by reading on from that position.  A value that
+// precedes the current position is located by reading the text again from
+// the beginning, provided that the input can be repositioned (i.e., its
+// `pubseekpos` succeeds, as for an input specified as a `bsl::string_view`);
+// otherwise, such a value is not found.
+//
+///Validation
+///----------
+// The JSON text is read in the `e_STRICT_20240119` mode of
+// `bdljsn::Tokenizer`, as by `bdljsn::JsonUtil::read`, but only the text
+// actually read, up to the end of the last value located or read, is
+// validated.  In particular, invalid JSON text following the values of
+// interest is not detected.  Note that the values passed over are validated
+// as by `bdljsn::JsonUtil::read` (in particular, the escape sequences of their
+// strings), even though they are not represented.  Once invalid JSON text is
+// detected, all subsequent operations fail until the cursor is `reset`.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reading a Few Fields of a Large Message
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we receive messages having a small header followed by a large
+// body, and we need only the routing information of each message.
+//
+// First, we define a message:
+// ```
+// const char *MESSAGE = "{\n"
+//                       "    \"header\": {\n"
+//                       "        \"id\": 1729,\n"
+//                       "        \"to\": \"pricing\",\n"
+//                       "        \"urgent\": true\n"
+//                       "    },\n"
+//                       "    \"body\": {\n"
+//                       "        \"rows\": [\n"
+//                       "            {\"ticker\": \"IBM\", \"px\": 181.2},\n"
+//                       "            {\"ticker\": \"AAPL\", \"px\": 227.5}\n"
+//                       "        ]\n"
+//                       "    }\n"
+//                       "}";
+// ```
+// Then, we create a cursor over the message:
+// ```
+// bdljsn::JsonCursor cursor;
+// cursor.reset(MESSAGE);
+// ```
+// Next, we locate and read the fields of the header that we need.  Notice
+// that the body of the message is never read:
+// ```
+// int rc = cursor.find("/header/to");
+// assert(0 == rc);
+// assert(bdljsn::JsonType::e_STRING == cursor.type());
+//
+// bsl::string destination;
+// rc = cursor.read(&destination);
+// assert(0         == rc);
+// assert("pricing" == destination);
+//
+// bool urgent;
+// rc = cursor.find("/header/urgent");
+// assert(0 == rc);
+// rc = cursor.read(&urgent);
+// assert(0    == rc);
+// assert(true == urgent);
+// ```
+// Then, we iterate over the rows of the body by successive indices; each row
+// is located by reading on from the previous one:
+// ```
+// bsl::vector<bsl::string> tickers;
+// for (int i = 0; ; ++i) {
+//     bsl::string pointer = "/body/rows/" + bsl::to_string(i) + "/ticker";
+//     if (0 != cursor.find(pointer)) {
+//         break;
+//     }
+//     tickers.emplace_back();
+//     cursor.read(&tickers.back());
+// }
+// assert(2      == tickers.size());
+// assert("AAPL" == tickers[1]);
+// ```
+// Next, we locate a value that precedes the current position; the message is
+// read again from the beginning:
+// ```
+// rc = cursor.find("/header/id");
+// assert(0 == rc);
+//
+// bdljsn::JsonNumber id;
+// rc = cursor.read(&id);
+// assert(0      == rc);
+// assert("1729" == id.value());
+// ```
+// Finally, we read a whole value as a `bdljsn::Json`, and observe that a
+// pointer that does not identify a value is not found:
+// ```
+// bdljsn::Json row;
+// rc = cursor.find("/body/rows/0");
+// assert(0 == rc);
+// rc = cursor.read(&row);
+// assert(0 == rc);
+// assert(row.isObject());
+// assert("IBM" == row["ticker"].theString());
+//
+// rc = cursor.find("/header/from");
+// assert(bdljsn::JsonCursor::k_NOT_FOUND == rc);
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdljsn_jsontype.h>
+#include <bdljsn_tokenizer.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_ios.h>
+#include <bsl_streambuf.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdljsn {
+
+class Json;
+class JsonNumber;
+
+                              // ================
+                              // class JsonCursor
+                              // ================
+
+/// This class provides a cursor over the JSON text supplied to `reset` that
+/// locates values of the document by JSON pointer (see `find`), reading the
+/// text only as far as needed, and reads the value located on request.
+class JsonCursor {
+
+    // PRIVATE TYPES
+
+    /// This `struct` describes an open array or object enclosing the current
+    /// value.
+    struct Frame {
+        // DATA
+        bool        d_isObject;  // `true` for an object, `false` for an array
+        bsl::size_t d_count;     // number of children reached, the last of
+                                 // which is the current child
+    };
+
+    /// This `struct` describes a reference token of a JSON pointer.
+    struct Target {
+        // DATA
+        bsl::size_t d_index;    // index, if `d_isIndex`
+        bool        d_isIndex;  // `true` if the token is an array index
+    };
+
+    // DATA
+    bdlsb::FixedMemInStreamBuf d_buffer;     // input specified as a string
+
+    bsl::streambuf            *d_input_p;    // input (held, not owned)
+
+    bsl::streampos             d_start;      // initial position of the input,
+                                             // or -1 if it cannot be
+                                             // repositioned
+
+    Tokenizer                  d_tokenizer;  // tokenizer reading the input
+
+    bsl::vector<Frame>         d_frames;     // enclosing containers, of which
+                                             // the first `d_depth` are in use
+
+    bsl::vector<bsl::string>   d_keys;       // name of the current child of
+                                             // each enclosing object
+
+    bsl::size_t                d_depth;      // number of enclosing containers
+
+    bool                       d_consumed;   // `true` if the current value has
+                                             // been read (the tokenizer is on
+                                             // its last token), `false` if not
+                                             // (on its first token)
+
+    int                        d_status;     // 0, or error status of invalid
+                                             // JSON text
+
+    bsl::vector<Target>        d_targets;    // parsed reference tokens
+
+    bsl::vector<bsl::string>   d_names;      // unescaped reference tokens
+
+    bsl::vector<char>          d_nesting;    // containers open while passing
+                                             // over a value
+
+    bsl::string                d_scratch;    // decoded string validated
+
+    // PRIVATE MANIPULATORS
+
+    /// Advance the tokenizer to the next token, and validate it if it is a
+    /// scalar value or a member name.  Return 0 on success, and
+    /// `k_INVALID_JSON` (recording the error) otherwise.
+    int advance();
+
+    /// Locate, starting from the current value, the value identified by the
+    /// reference tokens in `d_targets` and `d_names` and make it the current
+    /// value.  Return 0 on success, `k_NOT_FOUND` if the value is not found
+    /// after the current position, and a negative value if invalid JSON text
+    /// is encountered.
+    int findForward();
+
+    /// Locate, among the remaining children of the innermost enclosing
+    /// container, the child identified by the reference token at the
+    /// specified `level` and make it the current value.  Return 0 on
+    /// success, `k_NOT_FOUND` (leaving the container read) if there is no
+    /// such child, and a negative value if invalid JSON text is encountered.
+    /// The behavior is undefined unless `0 < d_depth` and the current value
+    /// has been read.
+    int findChild(bsl::size_t level);
+
+    /// Read to the end of the current value, if it has not been read.
+    /// Return 0 on success, and a negative value if invalid JSON text is
+    /// encountered.
+    int finishCurrent();
+
+    /// Move to the next child of the innermost enclosing container.  Return
+    /// 0 if the next child is the current value, 1 if the end of the
+    /// container has been reached (the container being the current value,
+    /// read), and a negative value if invalid JSON text is encountered.  The
+    /// behavior is undefined unless `0 < d_depth` and the current value has
+    /// been read.
+    int moveToNextChild();
+
+    /// Parse the specified JSON `pointer` into `d_targets` and `d_names`.
+    /// Return 0 on success, and a non-zero value if `pointer` is not a valid
+    /// JSON pointer.
+    int parsePointer(const bsl::string_view& pointer);
+
+    /// Start reading the input from the initial position.  Return 0 on
+    /// success, `k_NOT_FOUND` if the input cannot be repositioned, and a
+    /// negative value if invalid JSON text is encountered.
+    int rewind();
+
+    /// Start reading the input from its current position.
+    void start();
+
+  private:
+    // NOT IMPLEMENTED
+    JsonCursor(const JsonCursor&);
+    JsonCursor& operator=(const JsonCursor&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(JsonCursor, bslma::UsesBslmaAllocator);
+
+    // PUBLIC TYPES
+    enum {
+        k_NOT_FOUND       =  1,  // no value is identified by the pointer
+        k_INVALID_JSON    = -1,  // the JSON text read is not valid JSON
+        k_INVALID_POINTER = -2   // the pointer is not a valid JSON pointer
+    };
+
+    // CREATORS
+
+    /// Create a cursor having no input.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.  Note that `reset`
+    /// must be called before any other manipulator.
+    explicit JsonCursor(bslma::Allocator *basicAllocator = 0);
+
+    /// Destroy this object.
+    ~JsonCursor();
+
+    // MANIPULATORS
+
+    /// Locate the value identified by the specified JSON `pointer` in the
+    /// document and make it the current value.  Return 0 on success,
+    /// `k_NOT_FOUND` if the document has no such value (or if the value
+    /// precedes the current position and the input cannot be repositioned),
+    /// `k_INVALID_POINTER` if `pointer` is not a valid JSON pointer, and
+    /// `k_INVALID_JSON` if invalid JSON text is encountered.  If
+    /// `k_NOT_FOUND` is returned, there is no current value.  The behavior
+    /// is undefined unless `reset` has been called.
+    int find(const bsl::string_view& pointer);
+
+    /// Load into the specified `result` the current value, and pass over it.
+    /// Return 0 on success, and a non-zero value, with no effect on
+    /// `result`, if there is no current value or if it is not valid JSON.
+    /// Arrays and objects nested more than
+    /// `ReadOptions().maxNestedDepth()` deep are considered invalid, as for
+    /// `JsonUtil::read`.
+    int read(Json *result);
+
+    /// Load into the specified `result` the current value, and pass over it.
+    /// Return 0 on success, and a non-zero value, with no effect on
+    /// `result` or on the current value, if there is no current value or if
+    /// it is not a string.
+    int read(bsl::string *result);
+
+    /// Load into the specified `result` the current value, and pass over it.
+    /// Return 0 on success, and a non-zero value, with no effect on
+    /// `result` or on the current value, if there is no current value or if
+    /// it is not a number.
+    int read(JsonNumber *result);
+
+    /// Load into the specified `result` the current value, and pass over it.
+    /// Return 0 on success, and a non-zero value, with no effect on
+    /// `result` or on the current value, if there is no current value or if
+    /// it is not a boolean.
+    int read(bool *result);
+
+    /// Read JSON text from the specified `input`, the whole document being
+    /// the current value.  The `input` is read only on demand, and is
+    /// repositioned (if it can be) to its current position to locate a
+    /// value preceding the current position.  The behavior is undefined
+    /// unless `input` remains valid, and is not otherwise read, until this
+    /// cursor is `reset` again or destroyed.
+    void reset(bsl::streambuf *input);
+
+    /// Read the specified JSON `text`, the whole document being the current
+    /// value.  The behavior is undefined unless the characters of `text`
+    /// remain valid until this cursor is `reset` again or destroyed.
+    void reset(const bsl::string_view& text);
+
+    // ACCESSORS
+
+    /// Return `true` if this cursor has a current value, i.e., if it has
+    /// located a value that has not been read since, and `false` otherwise.
+    bool hasValue() const;
+
+    /// Return 0 if no invalid JSON text has been encountered since the last
+    /// call to `reset`, and `k_INVALID_JSON` otherwise.
+    int status() const;
+
+    /// Return the type of the current value.  The behavior is undefined
+    /// unless `hasValue()`.
+    JsonType::Enum type() const;
+
+                                  // Aspects
+
+    /// Return the allocator used by this object to supply memory.
+    bslma::Allocator *allocator() const;
+};
+
+// ============================================================================
+//                          INLINE DEFINITIONS
+// ============================================================================
+
+                              // ----------------
+                              // class JsonCursor
+                              // ----------------
+
+// ACCESSORS
+inline
+bool JsonCursor::hasValue() const
+{
+    return 0 != d_input_p && 0 == d_status && !d_consumed;
+}
+
+inline
+int JsonCursor::status() const
+{
+    return d_status;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *JsonCursor::allocator() const
+{
+    return d_frames.get_allocator().mechanism();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1490 @@
+// bdljsn_jsoncursor.t.cpp                                            -*-C++-*-
+#include <bdljsn_jsoncursor.h>
+
+#include <bdljsn_flatjson.h>
+#include <bdljsn_json.h>
+#include <bdljsn_jsonnumber.h>
+#include <bdljsn_jsonutil.h>
+#include <bdljsn_jsontype.h>
+#include <bdljsn_readoptions.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_streambuf.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides a cursor locating the values of a JSON
+// document by JSON pointer.  The values located are required to be those
+// found by resolving the pointers on the document read by
+// `bdljsn::JsonUtil::read`, whatever the order in which they are sought: this
+// is tested on generated documents, for each of their values, in document
+// order, in reverse order, and in a scrambled order, and with an input that
+// cannot be repositioned.  Pointer syntax, the `read` overloads, and the
+// detection of invalid JSON text are tested on table-driven data.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit JsonCursor(bslma::Allocator *basicAllocator = 0);
+// [ 2] ~JsonCursor();
+//
+// MANIPULATORS
+// [ 3] int find(const bsl::string_view& pointer);
+// [ 5] int read(Json *result);
+// [ 5] int read(bsl::string *result);
+// [ 5] int read(JsonNumber *result);
+// [ 5] int read(bool *result);
+// [ 7] void reset(bsl::streambuf *input);
+// [ 2] void reset(const bsl::string_view& text);
+//
+// ACCESSORS
+// [ 2] bool hasValue() const;
+// [ 6] int status() const;
+// [ 2] JsonType::Enum type() const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONFORMANCE WITH `JsonUtil::read`
+// [ 6] INVALID JSON TEXT
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE: COMPARISON WITH `JsonUtil::read` AND `FlatJson`
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdljsn::JsonCursor Obj;
+typedef bdljsn::JsonType   JsonType;
+
+const int NOT_FOUND       = Obj::k_NOT_FOUND;
+const int INVALID_JSON    = Obj::k_INVALID_JSON;
+const int INVALID_POINTER = Obj::k_INVALID_POINTER;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// This class provides a stream buffer over a string that cannot be
+/// repositioned.
+class ForwardStreamBuf : public bsl::streambuf {
+
+    // DATA
+    bsl::string d_text;  // contents
+
+  public:
+    // CREATORS
+
+    /// Create a stream buffer having the specified `text` as contents.
+    explicit ForwardStreamBuf(const bsl::string_view& text)
+    : d_text(text)
+    {
+        char *begin = d_text.empty() ? 0 : &d_text[0];
+        setg(begin, begin, begin + d_text.size());
+    }
+};
+
+/// Return the value of `json` identified by the specified JSON `pointer`,
+/// or 0 if there is no such value.  The behavior is undefined unless
+/// `pointer` is a valid JSON pointer.
+const bdljsn::Json *resolve(const bdljsn::Json&     json,
+                            const bsl::string_view& pointer)
+{
+    const bdljsn::Json *value = &json;
+
+    bsl::size_t position = 0;
+    while (position < pointer.size()) {
+        bsl::size_t end = pointer.find('/', position + 1);
+        if (bsl::string_view::npos == end) {
+            end = pointer.size();
+        }
+
+        bsl::string name;
+        for (bsl::size_t i = position + 1; i < end; ++i) {
+            if ('~' == pointer[i]) {
+                name.push_back('0' == pointer[++i] ? '~' : '/');
+            }
+            else {
+                name.push_back(pointer[i]);
+            }
+        }
+        position = end;
+
+        if (value->isObject()) {
+            bdljsn::JsonObject::ConstIterator it =
+                                               value->theObject().find(name);
+            if (value->theObject().end() == it) {
+                return 0;                                             // RETURN
+            }
+            value = &it->second;
+        }
+        else if (value->isArray()) {
+            if (name.empty()
+             || name.size() > 9
+             || ('0' == name[0] && 1 < name.size())
+             || bsl::string::npos != name.find_first_not_of("0123456789")) {
+                return 0;                                             // RETURN
+            }
+            bsl::size_t index = bsl::atoi(name.c_str());
+            if (index >= value->theArray().size()) {
+                return 0;                                             // RETURN
+            }
+            value = &value->theArray()[index];
+        }
+        else {
+            return 0;                                                 // RETURN
+        }
+    }
+    return value;
+}
+
+/// This class provides a generator of JSON documents, listing the pointers
+/// of their values in document order.
+class Generator {
+
+    // DATA
+    unsigned                 d_seed;      // state of the pseudo-random
+                                          // sequence
+    bsl::string              d_text;      // JSON text generated
+    bsl::vector<bsl::string> d_pointers;  // pointers of the values generated
+
+    // PRIVATE MANIPULATORS
+
+    /// Return the next value of the pseudo-random sequence, in `[0, range)`.
+    unsigned next(unsigned range)
+    {
+        d_seed = d_seed * 1103515245u + 12345u;
+        return (d_seed >> 16) % range;
+    }
+
+    /// Generate a value identified by the specified `pointer` at the
+    /// specified `depth`.
+    void generate(const bsl::string& pointer, int depth)
+    {
+        static const char *const NUMBERS[] = {
+            "0", "-1", "17", "2.5", "-0.125e3", "1E+2", "123456789012345678"
+        };
+        static const char *const STRINGS[] = {
+            "\"\"", "\"x\"", "\"a\\\"b\"", "\"caf\\u00e9\"",
+            "\"\\ud83d\\ude00\"",
+            "\"tab\\there\"", "\"[not {an} array]\""
+        };
+        struct Key {
+            const char *d_json;     // key as JSON text
+            const char *d_pointer;  // reference token of the key
+        };
+        static const Key KEYS[] = {
+            { "\"a\"",         "a"       },
+            { "\"b\"",         "b"       },
+            { "\"0\"",         "0"       },
+            { "\"01\"",        "01"      },
+            { "\"c~d\"",       "c~0d"    },
+            { "\"e/f\"",       "e~1f"    },
+            { "\"a\\u0062\"",  "ab"      },
+            { "\"\"",          ""        },
+            { "\"s p\\\"q\"",  "s p\"q"  },
+            { "\"caf\\u00e9\"", "caf\xc3\xa9" },
+        };
+        const unsigned NUM_KEYS = sizeof KEYS / sizeof *KEYS;
+
+        d_pointers.push_back(pointer);
+
+        switch (next(depth < 5 ? 9 : 5)) {
+          case 0: {
+            d_text += "null";
+          } break;
+          case 1: {
+            d_text += next(2) ? "true" : "false";
+          } break;
+          case 2: {
+            d_text += NUMBERS[next(sizeof NUMBERS / sizeof *NUMBERS)];
+          } break;
+          case 3:
+          case 4: {
+            d_text += STRINGS[next(sizeof STRINGS / sizeof *STRINGS)];
+          } break;
+          case 5:
+          case 6: {
+            const unsigned numElements = next(5);
+            d_text += "[";
+            for (unsigned i = 0; i < numElements; ++i) {
+                d_text += i ? ", " : "";
+                generate(pointer + "/" + bsl::to_string(i), depth + 1);
+            }
+            d_text += "]";
+          } break;
+          default: {
+            const unsigned numMembers = next(6);
+            unsigned       first      = next(NUM_KEYS);
+            d_text += "{";
+            for (unsigned i = 0; i < numMembers; ++i) {
+                const Key& key = KEYS[(first + i * 3) % NUM_KEYS];
+                d_text += i ? ", " : "";
+                d_text += key.d_json;
+                d_text += ": ";
+                generate(pointer + "/" + key.d_pointer, depth + 1);
+            }
+            d_text += "}";
+          } break;
+        }
+    }
+
+  public:
+    // CREATORS
+
+    /// Create a generator of the document having the specified `seed`.
+    explicit Generator(unsigned seed)
+    : d_seed(seed)
+    {
+        generate("", 0);
+    }
+
+    // ACCESSORS
+
+    /// Return the pointers of the values of the document, in document order.
+    const bsl::vector<bsl::string>& pointers() const
+    {
+        return d_pointers;
+    }
+
+    /// Return the JSON text of the document.
+    const bsl::string& text() const
+    {
+        return d_text;
+    }
+};
+
+/// Return a JSON message having a small header followed by a body of the
+/// specified `numRecords` records.
+bsl::string makeMessage(int numRecords)
+{
+    bsl::ostringstream os;
+    os << "{\"header\": {\"id\": 1729, \"to\": \"pricing\", \"urgent\": true},"
+       << "\n \"records\": [";
+    for (int i = 0; i < numRecords; ++i) {
+        os << (i ? ",\n" : "\n")
+           << "  {\"id\": " << i
+           << ", \"name\": \"record " << i << "\""
+           << ", \"price\": " << i << "." << (i * 7) % 100
+           << ", \"active\": " << (i % 2 ? "true" : "false")
+           << ", \"tags\": [\"alpha\", \"beta\\tgamma\", \"caf\\u00e9\"]"
+           << ", \"location\": {\"x\": " << i * 3 << ", \"y\": -" << i
+           << "}}";
+    }
+    os << "\n]}\n";
+    return os.str();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reading a Few Fields of a Large Message
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we receive messages having a small header followed by a large
+// body, and we need only the routing information of each message.
+//
+// First, we define a message:
+// ```
+    const char *MESSAGE = "{\n"
+                          "    \"header\": {\n"
+                          "        \"id\": 1729,\n"
+                          "        \"to\": \"pricing\",\n"
+                          "        \"urgent\": true\n"
+                          "    },\n"
+                          "    \"body\": {\n"
+                          "        \"rows\": [\n"
+                          "            {\"ticker\": \"IBM\", \"px\": 181.2},\n"
+                          "            {\"ticker\": \"AAPL\", \"px\": 227.5}\n"
+                          "        ]\n"
+                          "    }\n"
+                          "}";
+// ```
+// Then, we create a cursor over the message:
+// ```
+    bdljsn::JsonCursor cursor;
+    cursor.reset(MESSAGE);
+// ```
+// Next, we locate and read the fields of the header that we need.  Notice
+// that the body of the message is never read:
+// ```
+    int rc = cursor.find("/header/to");
+    ASSERT(0 == rc);
+    ASSERT(bdljsn::JsonType::e_STRING == cursor.type());
+
+    bsl::string destination;
+    rc = cursor.read(&destination);
+    ASSERT(0         == rc);
+    ASSERT("pricing" == destination);
+
+    bool urgent;
+    rc = cursor.find("/header/urgent");
+    ASSERT(0 == rc);
+    rc = cursor.read(&urgent);
+    ASSERT(0    == rc);
+    ASSERT(true == urgent);
+// ```
+// Then, we iterate over the rows of the body by successive indices; each row
+// is located by reading on from the previous one:
+// ```
+    bsl::vector<bsl::string> tickers;
+    for (int i = 0; ; ++i) {
+        bsl::string pointer = "/body/rows/" + bsl::to_string(i) + "/ticker";
+        if (0 != cursor.find(pointer)) {
+            break;
+        }
+        tickers.emplace_back();
+        cursor.read(&tickers.back());
+    }
+    ASSERT(2      == tickers.size());
+    ASSERT("AAPL" == tickers[1]);
+// ```
+// Next, we locate a value that precedes the current position; the message is
+// read again from the beginning:
+// ```
+    rc = cursor.find("/header/id");
+    ASSERT(0 == rc);
+
+    bdljsn::JsonNumber id;
+    rc = cursor.read(&id);
+    ASSERT(0      == rc);
+    ASSERT("1729" == id.value());
+// ```
+// Finally, we read a whole value as a `bdljsn::Json`, and observe that a
+// pointer that does not identify a value is not found:
+// ```
+    bdljsn::Json row;
+    rc = cursor.find("/body/rows/0");
+    ASSERT(0 == rc);
+    rc = cursor.read(&row);
+    ASSERT(0 == rc);
+    ASSERT(row.isObject());
+    ASSERT("IBM" == row["ticker"].theString());
+
+    rc = cursor.find("/header/from");
+    ASSERT(bdljsn::JsonCursor::k_NOT_FOUND == rc);
+// ```
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // STREAM BUFFER INPUT
+        //
+        // Concerns:
+        // 1. The input is read from the position of the stream buffer when
+        //    `reset` is called, and is repositioned to that position to find
+        //    a value preceding the current position.
+        //
+        // 2. If the input cannot be repositioned, values following the
+        //    current position are found, and values preceding it are not.
+        //
+        // 3. The input is read only as far as needed.
+        //
+        // Plan:
+        // 1. Read a document following some text from a stream buffer that
+        //    has been read up to the document, and find values in and out of
+        //    document order.  (C-1)
+        //
+        // 2. Repeat P-1 with a stream buffer that cannot be repositioned.
+        //    (C-2)
+        //
+        // 3. Find a value at the start of a document followed by a large
+        //    amount of text, and verify that the stream buffer has not been
+        //    read to its end.  (C-3)
+        //
+        // Testing:
+        //   void reset(bsl::streambuf *input);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "STREAM BUFFER INPUT" << endl
+                          << "===================" << endl;
+
+        const bsl::string_view TEXT = "prefix{\"a\": [1, 2, {\"b\": 3}],"
+                                      " \"c\": \"d\"}";
+
+        if (verbose) cout << "\tRepositionable input." << endl;
+        {
+            bdlsb::FixedMemInStreamBuf sb(TEXT.data(), TEXT.size());
+            sb.pubseekpos(6);
+
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            Obj                  mX(&ta);
+            mX.reset(&sb);
+
+            bsl::string          s;
+            bdljsn::JsonNumber   n;
+
+            ASSERT(0 == mX.find("/c"));
+            ASSERT(0 == mX.read(&s));
+            ASSERT("d" == s);
+
+            ASSERT(0 == mX.find("/a/2/b"));
+            ASSERT(0 == mX.read(&n));
+            ASSERT("3" == n.value());
+
+            ASSERT(0 == mX.find("/a/0"));
+            ASSERT(0 == mX.read(&n));
+            ASSERT("1" == n.value());
+
+            ASSERT(NOT_FOUND == mX.find("/a/3"));
+            ASSERT(!mX.hasValue());
+            ASSERT(0 == mX.find(""));
+            ASSERT(JsonType::e_OBJECT == mX.type());
+        }
+
+        if (verbose) cout << "\tNon-repositionable input." << endl;
+        {
+            ForwardStreamBuf sb(TEXT);
+            char             prefix[6];
+            ASSERT(6 == sb.sgetn(prefix, 6));
+
+            Obj mX;
+            mX.reset(&sb);
+
+            bdljsn::JsonNumber n;
+
+            ASSERT(0 == mX.find("/a/1"));
+            ASSERT(0 == mX.read(&n));
+            ASSERT("2" == n.value());
+
+            ASSERT(NOT_FOUND == mX.find("/a/0"));
+            ASSERT(!mX.hasValue());
+
+            ASSERT(0 == mX.find("/c"));
+            ASSERT(JsonType::e_STRING == mX.type());
+
+            ASSERT(NOT_FOUND == mX.find("/a"));
+            ASSERT(0         == mX.status());
+        }
+
+        if (verbose) cout << "\tReading on demand." << endl;
+        {
+            bsl::string text = "[\"first\", [";
+            for (int i = 0; i < 100000; ++i) {
+                text += "1, ";
+            }
+            text += "2]]";
+
+            bdlsb::FixedMemInStreamBuf sb(text.data(), text.size());
+
+            Obj mX;
+            mX.reset(&sb);
+
+            bsl::string s;
+            ASSERT(0 == mX.find("/0"));
+            ASSERT(0 == mX.read(&s));
+            ASSERT("first" == s);
+
+            const bsl::streampos position =
+                     sb.pubseekoff(0, bsl::ios_base::cur, bsl::ios_base::in);
+            ASSERTV(position, position < bsl::streampos(text.size() / 2));
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // INVALID JSON TEXT
+        //
+        // Concerns:
+        // 1. Invalid JSON text read while locating a value is detected, and
+        //    reported by `find` and `status` as `k_INVALID_JSON`.
+        //
+        // 2. Invalid JSON text within a value read is detected.
+        //
+        // 3. Invalid JSON text that is not read is not detected.
+        //
+        // 4. A member name having an invalid escape sequence is detected
+        //    even if the member is passed over.
+        //
+        // 5. Once invalid JSON text is detected, all operations fail until
+        //    `reset` is called.
+        //
+        // Plan:
+        // 1. Using a table of documents and pointers, find the pointer (and
+        //    read the value found as a `Json`) and verify the result.
+        //    (C-1..4)
+        //
+        // 2. After an error, verify that `find` and `read` fail, and that
+        //    `reset` restores the cursor.  (C-5)
+        //
+        // Testing:
+        //   int status() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "INVALID JSON TEXT" << endl
+                          << "=================" << endl;
+
+        static const struct {
+            int         d_line;     // source line number
+            const char *d_text_p;   // JSON text
+            const char *d_pointer;  // pointer to find
+            int         d_find;     // expected result of `find`
+            bool        d_read;     // expected success of `read`
+        } DATA[] = {
+            //LINE TEXT                         POINTER FIND          READ
+            //---- ---------------------------  ------- ------------  ----
+            { L_,  "",                          "",     INVALID_JSON, 0  },
+            { L_,  "   ",                       "",     INVALID_JSON, 0  },
+            { L_,  "x",                         "",     INVALID_JSON, 0  },
+            { L_,  "[1, 2}",                    "/5",   INVALID_JSON, 0  },
+            { L_,  "[1, 2}",                    "/0",   0,            1  },
+            { L_,  "[1, 2}",                    "",     0,            0  },
+            { L_,  "{\"a\" 1, \"b\": 2}",       "/b",   INVALID_JSON, 0  },
+            { L_,  "{\"a\": [}, \"b\": 2}",     "/b",   INVALID_JSON, 0  },
+            { L_,  "{\"a\": 01, \"b\": 2}",     "/b",   INVALID_JSON, 0  },
+            { L_,  "{\"a\": tru, \"b\": 2}",    "/b",   INVALID_JSON, 0  },
+            { L_,  "{\"a\": \"\xff\", \"b\": 2}", "/b",   INVALID_JSON, 0  },
+            { L_,  "{\"a\\x\": 1, \"b\": 2}",   "/b",   INVALID_JSON, 0  },
+            { L_,  "{\"a\": {\"\\u00zz\": 1}, \"b\": 2}",
+                                                "/b",   INVALID_JSON, 0  },
+            { L_,  "{\"a\": {\"\\u00zz\": 1}, \"b\": 2}",
+                                                "/a",   0,            0  },
+            { L_,  "[{\"\\u12\": 1}, 2]",       "/1",   INVALID_JSON, 0  },
+            { L_,  "[{\"\\u0041\": 1}, 2]",     "/1",   0,            1  },
+            { L_,  "{\"a\": [1, 2], \"b\": ]",  "/a",   0,            1  },
+            { L_,  "{\"a\": [1, 2], \"b\": ]",  "/b",   INVALID_JSON, 0  },
+            { L_,  "{\"a\": [1, 2], \"b\": ]",  "",     0,            0  },
+            { L_,  "{\"a\": 1} trailing",       "/a",   0,            1  },
+            { L_,  "{\"a\": 1} trailing",       "/b",   NOT_FOUND,    0  },
+            { L_,  "{\"a\": 1,}",               "/a",   0,            1  },
+            { L_,  "{\"a\": 1,}",               "/b",   INVALID_JSON, 0  },
+            { L_,  "[[[[1]]]",                  "/0/0/0/0",
+                                                        0,            1  },
+            { L_,  "[[[[1]]]",                  "",     0,            0  },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE    = DATA[ti].d_line;
+            const char *const TEXT    = DATA[ti].d_text_p;
+            const char *const POINTER = DATA[ti].d_pointer;
+            const int         FIND    = DATA[ti].d_find;
+            const bool        READ    = DATA[ti].d_read;
+
+            // An error is detected either by `find`, or by `read` of the
+            // value found.
+
+            const bool INVALID = INVALID_JSON == FIND || (0 == FIND && !READ);
+
+            if (veryVerbose) {
+                T_ P_(LINE) P_(TEXT) P(POINTER)
+            }
+
+            Obj mX;  const Obj& X = mX;
+            mX.reset(TEXT);
+
+            int rc = mX.find(POINTER);
+            ASSERTV(LINE, rc, FIND == rc);
+
+            bdljsn::Json json;
+            rc = mX.read(&json);
+            ASSERTV(LINE, rc, READ == (0 == rc));
+            ASSERTV(LINE, X.status(), (INVALID ? INVALID_JSON : 0)
+                                                                == X.status());
+
+            if (INVALID) {
+                ASSERTV(LINE, INVALID_JSON == mX.find(""));
+                ASSERTV(LINE, !X.hasValue());
+                ASSERTV(LINE, 0 != mX.read(&json));
+
+                mX.reset("[7]");
+                ASSERTV(LINE, 0 == X.status());
+                ASSERTV(LINE, 0 == mX.find("/0"));
+                ASSERTV(LINE, 0 == mX.read(&json));
+                ASSERTV(LINE, 7 == json);
+            }
+        }
+
+        if (verbose) cout << "\tNesting depth." << endl;
+        {
+            const int   DEPTH = bdljsn::ReadOptions().maxNestedDepth();
+            bsl::string text;
+            for (int depth = 1; depth <= DEPTH + 1; ++depth) {
+                text = bsl::string(depth, '[') + bsl::string(depth, ']');
+
+                bdljsn::Json json;
+                Obj          mX;
+                mX.reset(text);
+                ASSERTV(depth, 0 == mX.find(""));
+                ASSERTV(depth, (depth <= DEPTH) == (0 == mX.read(&json)));
+
+                bsl::string pointer;
+                for (int i = 1; i < depth; ++i) {
+                    pointer += "/0";
+                }
+                mX.reset(text);
+                ASSERTV(depth, 0 == mX.find(pointer));
+                ASSERTV(depth, JsonType::e_ARRAY == mX.type());
+            }
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // READING VALUES
+        //
+        // Concerns:
+        // 1. Each `read` overload loads the current value (decoding strings),
+        //    and passes over it.
+        //
+        // 2. A `read` overload for a type other than that of the current
+        //    value fails with no effect.
+        //
+        // 3. `read` fails if there is no current value.
+        //
+        // 4. `read` of a `Json` materializes the current value, keeping the
+        //    first of duplicate member names.
+        //
+        // 5. Memory is supplied by the allocator of the result.
+        //
+        // Plan:
+        // 1. Using a table of documents, find the root, and attempt to read
+        //    it with each overload.  (C-1..3, 5)
+        //
+        // 2. Read objects having duplicate members as `Json`.  (C-4)
+        //
+        // Testing:
+        //   int read(Json *result);
+        //   int read(bsl::string *result);
+        //   int read(JsonNumber *result);
+        //   int read(bool *result);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "READING VALUES" << endl
+                          << "==============" << endl;
+
+        static const struct {
+            int         d_line;     // source line number
+            const char *d_text_p;   // JSON text
+            char        d_type;     // 'S'tring, 'N'umber, 'B'oolean, or 0
+            const char *d_value_p;  // expected value, as text
+        } DATA[] = {
+            //LINE TEXT                           TYPE VALUE
+            //---- ------------------------------ ---- -----------------------
+            { L_,  "\"\"",                        'S', ""                   },
+            { L_,  "\"abc\"",                     'S', "abc"                },
+            { L_,  "\"a\\\"b\\\\c\\/d\"",         'S', "a\"b\\c/d"          },
+            { L_,  "\"\\u00e9\\ud83d\\ude00\"",   'S', "\xc3\xa9"
+                                                       "\xf0\x9f\x98\x80"  },
+            { L_,  "\"line\\nfeed\\ttab\"",       'S', "line\nfeed\ttab"    },
+            { L_,  "0",                           'N', "0"                  },
+            { L_,  "-12.5e-3",                    'N', "-12.5e-3"           },
+            { L_,  "123456789012345678901234",    'N', "1234567890"
+                                                       "12345678901234"     },
+            { L_,  "true",                        'B', "true"               },
+            { L_,  "false",                       'B', "false"              },
+            { L_,  "null",                        0,   "null"               },
+            { L_,  "[1, \"a\"]",                  0,   "[1,\"a\"]"          },
+            { L_,  "{\"a\": {}}",                 0,   "{\"a\":{}}"         },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE  = DATA[ti].d_line;
+            const char *const TEXT  = DATA[ti].d_text_p;
+            const char        TYPE  = DATA[ti].d_type;
+            const char *const VALUE = DATA[ti].d_value_p;
+
+            if (veryVerbose) {
+                T_ P_(LINE) P(TEXT)
+            }
+
+            bdljsn::Json expected;
+            ASSERTV(LINE, 0 == bdljsn::JsonUtil::read(&expected, TEXT));
+
+            for (int overload = 0; overload < 4; ++overload) {
+                bslma::TestAllocator         ta("result", veryVeryVerbose);
+                bslma::TestAllocator         da("default", veryVeryVerbose);
+                bslma::DefaultAllocatorGuard dag(&da);
+
+                Obj mX;  const Obj& X = mX;
+                mX.reset(TEXT);
+                ASSERTV(LINE, 0 == mX.find(""));
+
+                int rc = 0;
+                switch (overload) {
+                  case 0: {
+                    bsl::string s("unchanged", &ta);
+                    rc = mX.read(&s);
+                    ASSERTV(LINE, rc, ('S' == TYPE) == (0 == rc));
+                    ASSERTV(LINE, s, s == ('S' == TYPE ? VALUE : "unchanged"));
+                    ASSERTV(LINE, &ta == s.get_allocator().mechanism());
+                  } break;
+                  case 1: {
+                    bdljsn::JsonNumber n("999", &ta);
+                    rc = mX.read(&n);
+                    ASSERTV(LINE, rc, ('N' == TYPE) == (0 == rc));
+                    ASSERTV(LINE, n.value(),
+                            n.value() == ('N' == TYPE ? VALUE : "999"));
+                  } break;
+                  case 2: {
+                    bool b = false;
+                    if (0 == bsl::strcmp(VALUE, "false")) {
+                        b = true;
+                    }
+                    const bool ORIGINAL = b;
+                    rc = mX.read(&b);
+                    ASSERTV(LINE, rc, ('B' == TYPE) == (0 == rc));
+                    ASSERTV(LINE, 'B' == TYPE ? b == (0 == bsl::strcmp(VALUE,
+                                                                     "true"))
+                                              : b == ORIGINAL);
+                  } break;
+                  case 3: {
+                    bdljsn::Json json(&ta);
+                    rc = mX.read(&json);
+                    ASSERTV(LINE, rc, 0 == rc);
+                    ASSERTV(LINE, expected == json);
+                    ASSERTV(LINE, &ta == json.allocator());
+                  } break;
+                }
+
+                ASSERTV(LINE, overload, (0 == rc) == !X.hasValue());
+                ASSERTV(LINE, overload, 0 == X.status());
+                if (0 == rc) {
+                    bsl::string s;
+                    bdljsn::Json json;
+                    ASSERTV(LINE, 0 != mX.read(&s));
+                    ASSERTV(LINE, 0 != mX.read(&json));
+                }
+                ASSERTV(LINE, da.numBlocksInUse(), 0 == da.numBlocksInUse());
+            }
+        }
+
+        if (verbose) cout << "\tDuplicate member names." << endl;
+        {
+            Obj mX;
+            mX.reset("{\"a\": 1, \"b\": {\"c\": 2, \"c\": 3}, \"a\": 4}");
+
+            bdljsn::Json json;
+            ASSERT(0 == mX.find(""));
+            ASSERT(0 == mX.read(&json));
+            ASSERT(1 == json["a"]);
+            ASSERT(2 == json["b"]["c"]);
+
+            bdljsn::JsonNumber n;
+            ASSERT(0 == mX.find("/a"));
+            ASSERT(0 == mX.read(&n));
+            ASSERT("1" == n.value());
+
+            ASSERT(0 == mX.find("/b/c"));
+            ASSERT(0 == mX.read(&n));
+            ASSERT("2" == n.value());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONFORMANCE WITH `JsonUtil::read`
+        //
+        // Concerns:
+        // 1. Each value of a document is located by its pointer, and is read
+        //    as the value resolved from the document read by
+        //    `JsonUtil::read`.
+        //
+        // 2. Values are located whatever the order in which they are sought,
+        //    whether or not the values found are read.
+        //
+        // 3. If the input cannot be repositioned, values sought in document
+        //    order (and not read) are located.
+        //
+        // 4. Pointers that do not identify a value are not found.
+        //
+        // Plan:
+        // 1. For generated documents, find the pointer of each value, and
+        //    read it as a `Json`, with a cursor per pointer, and with one
+        //    cursor for the pointers in document order, in reverse order, and
+        //    in a scrambled order.  (C-1..2)
+        //
+        // 2. With an input that cannot be repositioned, find the pointers in
+        //    document order and verify the type of each value.  (C-3)
+        //
+        // 3. Find pointers derived from those of the document that identify
+        //    no value, interleaved with those that do.  (C-4)
+        //
+        // Testing:
+        //   CONFORMANCE WITH `JsonUtil::read`
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONFORMANCE WITH `JsonUtil::read`" << endl
+                          << "=================================" << endl;
+
+        const unsigned NUM_DOCUMENTS = 300;
+
+        bsl::size_t numValues = 0;
+        for (unsigned seed = 1; seed <= NUM_DOCUMENTS; ++seed) {
+            const Generator                 GENERATOR(seed);
+            const bsl::string&              TEXT     = GENERATOR.text();
+            const bsl::vector<bsl::string>& POINTERS = GENERATOR.pointers();
+            const bsl::size_t               NUM      = POINTERS.size();
+
+            if (veryVerbose) {
+                T_ P_(seed) P(TEXT)
+            }
+
+            numValues += NUM;
+
+            bdljsn::Json document;
+            ASSERTV(seed, TEXT, 0 == bdljsn::JsonUtil::read(&document, TEXT));
+
+            // Each order is a permutation of the indices of the pointers.
+
+            bsl::vector<bsl::vector<bsl::size_t> > orders(3);
+            for (bsl::size_t i = 0; i < NUM; ++i) {
+                orders[0].push_back(i);
+                orders[1].push_back(NUM - 1 - i);
+                orders[2].push_back((i * 7 + seed) % NUM);
+            }
+            if (0 == NUM % 7) {
+                orders[2] = orders[1];
+            }
+
+            for (bsl::size_t i = 0; i < NUM; ++i) {
+                const bdljsn::Json *expected = resolve(document, POINTERS[i]);
+                ASSERTV(seed, POINTERS[i], expected);
+
+                Obj mX;
+                mX.reset(TEXT);
+                ASSERTV(seed, POINTERS[i], 0 == mX.find(POINTERS[i]));
+
+                bdljsn::Json json;
+                ASSERTV(seed, POINTERS[i], 0 == mX.read(&json));
+                ASSERTV(seed, POINTERS[i], expected && *expected == json);
+            }
+
+            for (bsl::size_t oi = 0; oi < orders.size(); ++oi) {
+                for (int reading = 0; reading < 2; ++reading) {
+                    Obj mX;  const Obj& X = mX;
+                    mX.reset(TEXT);
+
+                    for (bsl::size_t j = 0; j < NUM; ++j) {
+                        const bsl::string&  POINTER  = POINTERS[orders[oi][j]];
+                        const bdljsn::Json& EXPECTED =
+                                                 *resolve(document, POINTER);
+
+                        int rc = mX.find(POINTER);
+                        ASSERTV(seed, oi, POINTER, rc, 0 == rc);
+                        ASSERTV(seed, oi, POINTER,
+                                EXPECTED.type() == X.type());
+
+                        if (reading) {
+                            bdljsn::Json json;
+                            ASSERTV(seed, oi, POINTER, 0 == mX.read(&json));
+                            ASSERTV(seed, oi, POINTER, EXPECTED == json);
+                        }
+
+                        // Interleave pointers identifying no value.
+
+                        const bsl::string MISSING[] = {
+                            POINTER + "/z",
+                            POINTER + "/99",
+                            POINTER + "/0/z",
+                        };
+                        for (int k = 0; k < 3; ++k) {
+                            if (0 == j % 5 && !resolve(document, MISSING[k])) {
+                                ASSERTV(seed, MISSING[k],
+                                        NOT_FOUND == mX.find(MISSING[k]));
+                                ASSERTV(seed, MISSING[k], !X.hasValue());
+                            }
+                        }
+                    }
+                }
+            }
+
+            {
+                ForwardStreamBuf sb(TEXT);
+
+                Obj mX;  const Obj& X = mX;
+                mX.reset(&sb);
+
+                for (bsl::size_t i = 0; i < NUM; ++i) {
+                    const bdljsn::Json& EXPECTED =
+                                               *resolve(document, POINTERS[i]);
+
+                    int rc = mX.find(POINTERS[i]);
+                    ASSERTV(seed, POINTERS[i], rc, 0 == rc);
+                    ASSERTV(seed, POINTERS[i], EXPECTED.type() == X.type());
+                    if (EXPECTED.isString()) {
+                        bsl::string s;
+                        ASSERTV(seed, POINTERS[i], 0 == mX.read(&s));
+                        ASSERTV(seed, POINTERS[i], EXPECTED.theString() == s);
+                    }
+                }
+                ASSERTV(seed, 0 == X.status());
+            }
+        }
+        if (verbose) {
+            P(numValues)
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // JSON POINTERS
+        //
+        // Concerns:
+        // 1. The empty pointer identifies the whole document.
+        //
+        // 2. `~0` and `~1` denote `~` and `/` in reference tokens, and other
+        //    uses of `~`, and pointers not starting with `/`, are invalid.
+        //
+        // 3. A reference token identifies a member of an object by name, and
+        //    an element of an array by an index without leading zeros.
+        //
+        // 4. A pointer traversing a scalar, or naming a missing member or
+        //    element, is not found.
+        //
+        // Plan:
+        // 1. Using a table of pointers on a document, find each pointer,
+        //    with a fresh cursor and after finding the previous pointer, and
+        //    verify the result and the value found.  (C-1..4)
+        //
+        // Testing:
+        //   int find(const bsl::string_view& pointer);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "JSON POINTERS" << endl
+                          << "=============" << endl;
+
+        const char *TEXT = "{\"a\": [10, 20, {\"b\": 30}],"
+                           " \"c/d\": 40, \"e~f\": 50, \"~1\": 60,"
+                           " \"\": 70, \"0\": 80, \"01\": 90, \"g\": null,"
+                           " \"caf\\u00e9\": 100, \"h\\/i\": 110,"
+                           " \" \": 120}";
+
+        static const struct {
+            int         d_line;     // source line number
+            const char *d_pointer;  // pointer to find
+            int         d_result;   // expected result of `find`
+            const char *d_value_p;  // expected value, as JSON text
+        } DATA[] = {
+            //LINE POINTER       RESULT           VALUE
+            //---- ------------  ---------------  -----
+            { L_,  "/a/0",       0,               "10"  },
+            { L_,  "/a/1",       0,               "20"  },
+            { L_,  "/a/2/b",     0,               "30"  },
+            { L_,  "/a/3",       NOT_FOUND,       0     },
+            { L_,  "/a/01",      NOT_FOUND,       0     },
+            { L_,  "/a/-",       NOT_FOUND,       0     },
+            { L_,  "/a/b",       NOT_FOUND,       0     },
+            { L_,  "/a/+1",      NOT_FOUND,       0     },
+            { L_,  "/a/",        NOT_FOUND,       0     },
+            { L_,  "/a/99999999999999999999999",
+                                 NOT_FOUND,       0     },
+            { L_,  "/a/0/0",     NOT_FOUND,       0     },
+            { L_,  "/c~1d",      0,               "40"  },
+            { L_,  "/e~0f",      0,               "50"  },
+            { L_,  "/~01",       0,               "60"  },
+            { L_,  "/c/d",       NOT_FOUND,       0     },
+            { L_,  "/",          0,               "70"  },
+            { L_,  "/0",         0,               "80"  },
+            { L_,  "/01",        0,               "90"  },
+            { L_,  "/g",         0,               "null" },
+            { L_,  "/g/x",       NOT_FOUND,       0     },
+            { L_,  "/caf\xc3\xa9",
+                                 0,               "100" },
+            { L_,  "/h~1i",      0,               "110" },
+            { L_,  "/ ",         0,               "120" },
+            { L_,  "/A",         NOT_FOUND,       0     },
+            { L_,  "/a~",        INVALID_POINTER, 0     },
+            { L_,  "/a~2",       INVALID_POINTER, 0     },
+            { L_,  "/~",         INVALID_POINTER, 0     },
+            { L_,  "a",          INVALID_POINTER, 0     },
+            { L_,  "#/a",        INVALID_POINTER, 0     },
+            { L_,  "",           0,               0     },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bdljsn::Json document;
+        ASSERT(0 == bdljsn::JsonUtil::read(&document, TEXT));
+
+        Obj mY;  const Obj& Y = mY;
+        mY.reset(TEXT);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE    = DATA[ti].d_line;
+            const char *const POINTER = DATA[ti].d_pointer;
+            const int         RESULT  = DATA[ti].d_result;
+            const char *const VALUE   = DATA[ti].d_value_p;
+
+            if (veryVerbose) {
+                T_ P_(LINE) P(POINTER)
+            }
+
+            bdljsn::Json expected;
+            if (VALUE) {
+                ASSERTV(LINE, 0 == bdljsn::JsonUtil::read(&expected, VALUE));
+            }
+            else {
+                expected = document;
+            }
+
+            Obj mX;  const Obj& X = mX;
+            mX.reset(TEXT);
+
+            int rc = mX.find(POINTER);
+            ASSERTV(LINE, rc, RESULT == rc);
+            ASSERTV(LINE, (0 == rc || INVALID_POINTER == rc) == X.hasValue());
+
+            rc = mY.find(POINTER);
+            ASSERTV(LINE, rc, RESULT == rc);
+
+            if (0 == RESULT) {
+                bdljsn::Json json;
+                ASSERTV(LINE, 0 == mX.read(&json));
+                ASSERTV(LINE, expected == json);
+                ASSERTV(LINE, expected.type() == Y.type());
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        // 1. A default-constructed cursor has no current value.
+        //
+        // 2. After `reset`, the whole document is the current value, and its
+        //    type is reported by `type`.
+        //
+        // 3. Memory is supplied by the allocator specified at construction,
+        //    or by the default allocator.
+        //
+        // 4. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Create cursors with and without an allocator, `reset` them to
+        //    documents of each type, and verify the accessors, and the
+        //    allocators used.  (C-1..3)
+        //
+        // 2. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for argument values.  (C-4)
+        //
+        // Testing:
+        //   explicit JsonCursor(bslma::Allocator *basicAllocator = 0);
+        //   ~JsonCursor();
+        //   void reset(const bsl::string_view& text);
+        //   bool hasValue() const;
+        //   JsonType::Enum type() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "PRIMARY MANIPULATORS AND BASIC ACCESSORS" << endl
+                 << "========================================" << endl;
+
+        static const struct {
+            int             d_line;    // source line number
+            const char     *d_text_p;  // JSON text
+            JsonType::Enum  d_type;    // expected type
+        } DATA[] = {
+            //LINE TEXT                   TYPE
+            //---- ---------------------  ------------------
+            { L_,  "{}",                  JsonType::e_OBJECT  },
+            { L_,  " {\"a\": [1]} ",      JsonType::e_OBJECT  },
+            { L_,  "[]",                  JsonType::e_ARRAY   },
+            { L_,  "\t[{}, []]\n",        JsonType::e_ARRAY   },
+            { L_,  "\"text\"",            JsonType::e_STRING  },
+            { L_,  "-1.5e10",             JsonType::e_NUMBER  },
+            { L_,  "0",                   JsonType::e_NUMBER  },
+            { L_,  "true",                JsonType::e_BOOLEAN },
+            { L_,  "false",               JsonType::e_BOOLEAN },
+            { L_,  "null",                JsonType::e_NULL    },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int            LINE = DATA[ti].d_line;
+            const char *const    TEXT = DATA[ti].d_text_p;
+            const JsonType::Enum TYPE = DATA[ti].d_type;
+
+            for (char cfg = 'a'; cfg <= 'b'; ++cfg) {
+                bslma::TestAllocator         sa("supplied", veryVeryVerbose);
+                bslma::TestAllocator         da("default", veryVeryVerbose);
+                bslma::DefaultAllocatorGuard dag(&da);
+
+                Obj                  *objPtr = 'a' == cfg ? new (sa) Obj()
+                                                          : new (sa) Obj(&sa);
+                Obj&                  mX     = *objPtr;
+                const Obj&            X      = mX;
+                bslma::TestAllocator& oa     = 'a' == cfg ? da : sa;
+
+                ASSERTV(LINE, cfg, &oa == X.allocator());
+                ASSERTV(LINE, cfg, !X.hasValue());
+                ASSERTV(LINE, cfg, 0 == X.status());
+
+                mX.reset(TEXT);
+                ASSERTV(LINE, cfg, X.hasValue());
+                ASSERTV(LINE, cfg, TYPE == X.type());
+                ASSERTV(LINE, cfg, 0 == X.status());
+
+                ASSERTV(LINE, cfg, 0 == mX.find(""));
+                ASSERTV(LINE, cfg, TYPE == X.type());
+
+                if ('b' == cfg) {
+                    ASSERTV(LINE, 0 == da.numBlocksTotal());
+                }
+
+                sa.deleteObject(objPtr);
+                ASSERTV(LINE, 0 == da.numBlocksInUse());
+                ASSERTV(LINE, 0 == sa.numBlocksInUse());
+            }
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX;  const Obj& X = mX;
+
+            bsl::string s;
+            ASSERT_SAFE_FAIL(mX.find(""));
+            ASSERT_SAFE_FAIL(X.type());
+
+            mX.reset("\"a\"");
+            ASSERT_SAFE_PASS(X.type());
+            ASSERT_SAFE_FAIL(mX.read(static_cast<bsl::string *>(0)));
+            ASSERT_SAFE_PASS(mX.read(&s));
+            ASSERT_SAFE_FAIL(X.type());
+            ASSERT_SAFE_FAIL(mX.reset(static_cast<bsl::streambuf *>(0)));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Locate and read values of a small document.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        Obj mX(&ta);  const Obj& X = mX;
+        mX.reset("{\"a\": [1, true, \"x\"], \"b\": {\"c\": null}}");
+
+        ASSERT(X.hasValue());
+        ASSERT(JsonType::e_OBJECT == X.type());
+
+        ASSERT(0 == mX.find("/b/c"));
+        ASSERT(JsonType::e_NULL == X.type());
+
+        ASSERT(0 == mX.find("/a/1"));
+        ASSERT(JsonType::e_BOOLEAN == X.type());
+
+        bool b = false;
+        ASSERT(0 == mX.read(&b));
+        ASSERT(b);
+        ASSERT(!X.hasValue());
+
+        bsl::string s;
+        ASSERT(0 == mX.find("/a/2"));
+        ASSERT(0 == mX.read(&s));
+        ASSERT("x" == s);
+
+        ASSERT(NOT_FOUND == mX.find("/a/3"));
+        ASSERT(NOT_FOUND == mX.find("/d"));
+
+        bdljsn::Json json;
+        ASSERT(0 == mX.find("/b"));
+        ASSERT(0 == mX.read(&json));
+        ASSERT(json.isObject());
+        ASSERT(json["c"].isNull());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COMPARISON WITH `JsonUtil::read` AND `FlatJson`
+        //
+        // Concerns:
+        // 1. Locating a few values of a large document with a `JsonCursor` is
+        //    substantially faster, and allocates substantially less memory,
+        //    than reading the whole document.
+        //
+        // Plan:
+        // 1. For a message having a small header and a large body, read a
+        //    field of the header and two fields of the body, with a
+        //    `JsonCursor`, with `JsonUtil::read`, and with `FlatJson::read`,
+        //    repeatedly, and report the throughput and the number of
+        //    allocations per message.  The number of iterations is given by
+        //    the second command-line argument (default: 20).
+        //
+        // Testing:
+        //   PERFORMANCE: COMPARISON WITH `JsonUtil::read` AND `FlatJson`
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: COMPARISON WITH `JsonUtil::read` AND `FlatJson`"
+             << endl
+             << "============================================================"
+             << endl;
+
+        const int NUM_ITERATIONS = argc > 2 && bsl::atoi(argv[2]) > 0
+                                 ? bsl::atoi(argv[2])
+                                 : 20;
+
+        const bsl::string TEXT = makeMessage(2000);
+        const double      MB   = static_cast<double>(TEXT.size()) / 1e6;
+
+        cout << "Message: " << TEXT.size() << " bytes" << endl;
+
+        struct Fields {
+            bsl::string d_to;     // `/header/to`
+            bsl::string d_name;   // `/records/1000/name`
+            bool        d_active; // `/records/1999/active`
+        };
+
+        const char *TO     = "/header/to";
+        const char *NAME   = "/records/1000/name";
+        const char *ACTIVE = "/records/1999/active";
+
+        {
+            bslma::TestAllocator ta("cursor");
+            bsls::Stopwatch      timer;
+            bsls::Types::Int64   numAllocations = 0;
+
+            Fields fields;
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                const bsls::Types::Int64 before = ta.numAllocations();
+
+                Obj mX(&ta);
+                mX.reset(TEXT);
+                ASSERT(0 == mX.find(TO));
+                ASSERT(0 == mX.read(&fields.d_to));
+                ASSERT(0 == mX.find(NAME));
+                ASSERT(0 == mX.read(&fields.d_name));
+                ASSERT(0 == mX.find(ACTIVE));
+                ASSERT(0 == mX.read(&fields.d_active));
+
+                numAllocations = ta.numAllocations() - before;
+            }
+            timer.stop();
+
+            ASSERT("pricing"     == fields.d_to);
+            ASSERT("record 1000" == fields.d_name);
+            ASSERT(true          == fields.d_active);
+
+            cout << "JsonCursor:     "
+                 << MB * NUM_ITERATIONS / timer.elapsedTime() << " MB/s, "
+                 << numAllocations << " allocations" << endl;
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                Obj mX(&ta);
+                mX.reset(TEXT);
+                ASSERT(0 == mX.find(TO));
+                ASSERT(0 == mX.read(&fields.d_to));
+            }
+            timer.stop();
+
+            cout << "JsonCursor (header only): "
+                 << MB * NUM_ITERATIONS / timer.elapsedTime()
+                 << " MB/s (of message)" << endl;
+        }
+        {
+            bslma::TestAllocator ta("json");
+            bsls::Stopwatch      timer;
+            bsls::Types::Int64   numAllocations = 0;
+
+            Fields fields;
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                const bsls::Types::Int64 before = ta.numAllocations();
+
+                bdljsn::Json json(&ta);
+                ASSERT(0 == bdljsn::JsonUtil::read(&json, TEXT));
+                fields.d_to     = json["header"]["to"].theString();
+                fields.d_name   = json["records"][1000]["name"].theString();
+                fields.d_active = json["records"][1999]["active"].theBoolean();
+
+                numAllocations = ta.numAllocations() - before;
+            }
+            timer.stop();
+
+            ASSERT("record 1000" == fields.d_name);
+
+            cout << "JsonUtil::read: "
+                 << MB * NUM_ITERATIONS / timer.elapsedTime() << " MB/s, "
+                 << numAllocations << " allocations" << endl;
+        }
+        {
+            bslma::TestAllocator ta("flat");
+            bsls::Stopwatch      timer;
+            bsls::Types::Int64   numAllocations = 0;
+
+            Fields fields;
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                const bsls::Types::Int64 before = ta.numAllocations();
+
+                bdljsn::FlatJson document(&ta);
+                ASSERT(0 == document.read(TEXT));
+
+                bdljsn::FlatJsonValue root = document.root();
+                fields.d_to     = root["header"]["to"].theString();
+                fields.d_name   = root["records"][1000]["name"].theString();
+                fields.d_active = root["records"][1999]["active"].theBoolean();
+
+                numAllocations = ta.numAllocations() - before;
+            }
+            timer.stop();
+
+            ASSERT("record 1000" == fields.d_name);
+
+            cout << "FlatJson::read: "
+                 << MB * NUM_ITERATIONS / timer.elapsedTime() << " MB/s, "
+                 << numAllocations << " allocations" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
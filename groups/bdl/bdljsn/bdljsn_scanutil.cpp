@@ -0,0 +1,554 @@
+// bdljsn_scanutil.cpp                                                -*-C++-*-
+#include <bdljsn_scanutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdljsn_scanutil_cpp, "$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+#include <bdlde_utf8util.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdint.h>
+
+// IMPLEMENTATION NOTES
+// --------------------
+// Each search is expressed as a "matcher" providing a scalar predicate
+// (`isMatch`) and, on platforms having SIMD support, a vector predicate
+// (`match`) computing, for each byte of a vector, whether it matches.  The
+// `scan` function template applies the vector predicate to each full vector
+// of the range, and the scalar predicate to the remaining bytes, so that no
+// byte outside of the range is ever read.
+//
+// The character classes are computed with byte-wise comparisons only:
+//
+// * A byte `c` is a control character if `c <= 0x1F` (unsigned), computed
+//   as `max(c, 0x1F) == 0x1F` on x86 (which lacks unsigned byte
+//   comparisons).
+//
+// * A byte `c` is one of `\t`, `\n`, `\v`, `\f`, and `\r` (0x09..0x0D) if
+//   `c - 0x09 <= 0x04` (unsigned, wrapping).
+//
+// * A byte `c` is one of `{`, `}`, `[`, and `]` if `(c | 0x20)` is `{` or
+//   `}`, as `[` and `]` differ from `{` and `}` only by the bit 0x20.
+//
+// SSE4.2 string instructions (e.g., `pcmpistri`) are not used: for the
+// small character classes needed here, they are slower than the sequences
+// of byte-wise comparisons above, which need only SSE2.
+
+#if defined(BSLS_PLATFORM_CPU_AVX2)
+#define BDLJSN_SCANUTIL_USE_AVX2 1
+#elif defined(BSLS_PLATFORM_CPU_SSE2)
+#define BDLJSN_SCANUTIL_USE_SSE2 1
+#elif defined(BSLS_PLATFORM_CPU_ARM)                                          \
+   && defined(BSLS_PLATFORM_CPU_64_BIT)                                       \
+   && defined(__ARM_NEON)
+#define BDLJSN_SCANUTIL_USE_NEON 1
+#endif
+
+#if defined(BDLJSN_SCANUTIL_USE_AVX2) || defined(BDLJSN_SCANUTIL_USE_SSE2)
+#include <immintrin.h>
+#include <emmintrin.h>
+#elif defined(BDLJSN_SCANUTIL_USE_NEON)
+#include <arm_neon.h>
+#endif
+
+#if defined(BDLJSN_SCANUTIL_USE_AVX2)                                         \
+ || defined(BDLJSN_SCANUTIL_USE_SSE2)                                         \
+ || defined(BDLJSN_SCANUTIL_USE_NEON)
+#define BDLJSN_SCANUTIL_USE_SIMD 1
+#endif
+
+namespace BloombergLP {
+namespace {
+namespace u {
+
+/// The maximum number of code points validated by a single call to
+/// `bdlde::Utf8Util::advanceIfValid` before resuming the search for
+/// non-ASCII bytes.
+const bdlde::Utf8Util::IntPtr k_MAX_CODE_POINTS_PER_CALL = 32;
+
+#if defined(BDLJSN_SCANUTIL_USE_SIMD)
+
+                               // =============
+                               // struct Vector
+                               // =============
+
+/// This `struct` provides a namespace for the SIMD operations on vectors of
+/// bytes used by the matchers.
+struct Vector {
+
+    // TYPES
+#if defined(BDLJSN_SCANUTIL_USE_AVX2)
+    typedef __m256i    Type;
+    enum { k_WIDTH = 32 };
+#elif defined(BDLJSN_SCANUTIL_USE_SSE2)
+    typedef __m128i    Type;
+    enum { k_WIDTH = 16 };
+#else
+    typedef uint8x16_t Type;
+    enum { k_WIDTH = 16 };
+#endif
+
+    // CLASS METHODS
+
+    /// Return the vector of the `k_WIDTH` bytes at the specified `address`,
+    /// which need not be aligned.
+    static Type load(const char *address);
+
+    /// Return a vector each byte of which has the specified `value`.
+    static Type splat(unsigned char value);
+
+    /// Return a vector each byte of which is 0xFF if the corresponding
+    /// bytes of the specified `lhs` and `rhs` are equal, and 0 otherwise.
+    static Type eq(Type lhs, Type rhs);
+
+    /// Return a vector each byte of which is 0xFF if the corresponding byte
+    /// of the specified `value` is less than or equal to the specified
+    /// `limit` (as unsigned values), and 0 otherwise.
+    static Type le(Type value, unsigned char limit);
+
+    /// Return the bitwise OR of the specified `lhs` and `rhs`.
+    static Type bitOr(Type lhs, Type rhs);
+
+    /// Return the bitwise AND of the specified `lhs` and the complement of
+    /// the specified `rhs`.
+    static Type andNot(Type lhs, Type rhs);
+
+    /// Return the bitwise complement of the specified `value`.
+    static Type bitNot(Type value);
+
+    /// Return the byte-wise (wrapping) difference of the specified `lhs`
+    /// and `rhs`.
+    static Type sub(Type lhs, Type rhs);
+
+    /// Return the index of the first byte of the specified `matches` that
+    /// is 0xFF, and `k_WIDTH` if there is none.  The behavior is undefined
+    /// unless each byte of `matches` is either 0 or 0xFF.
+    static int firstMatch(Type matches);
+};
+
+#if defined(BDLJSN_SCANUTIL_USE_AVX2)
+
+inline
+Vector::Type Vector::load(const char *address)
+{
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(address));
+}
+
+inline
+Vector::Type Vector::splat(unsigned char value)
+{
+    return _mm256_set1_epi8(static_cast<char>(value));
+}
+
+inline
+Vector::Type Vector::eq(Type lhs, Type rhs)
+{
+    return _mm256_cmpeq_epi8(lhs, rhs);
+}
+
+inline
+Vector::Type Vector::le(Type value, unsigned char limit)
+{
+    const Type limits = splat(limit);
+    return _mm256_cmpeq_epi8(_mm256_max_epu8(value, limits), limits);
+}
+
+inline
+Vector::Type Vector::bitOr(Type lhs, Type rhs)
+{
+    return _mm256_or_si256(lhs, rhs);
+}
+
+inline
+Vector::Type Vector::andNot(Type lhs, Type rhs)
+{
+    return _mm256_andnot_si256(rhs, lhs);
+}
+
+inline
+Vector::Type Vector::bitNot(Type value)
+{
+    return _mm256_xor_si256(value, _mm256_set1_epi8(-1));
+}
+
+inline
+Vector::Type Vector::sub(Type lhs, Type rhs)
+{
+    return _mm256_sub_epi8(lhs, rhs);
+}
+
+inline
+int Vector::firstMatch(Type matches)
+{
+    const unsigned int bits = static_cast<unsigned int>(
+                                                _mm256_movemask_epi8(matches));
+    return bits ? bdlb::BitUtil::numTrailingUnsetBits(bits) : k_WIDTH;
+}
+
+#elif defined(BDLJSN_SCANUTIL_USE_SSE2)
+
+inline
+Vector::Type Vector::load(const char *address)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(address));
+}
+
+inline
+Vector::Type Vector::splat(unsigned char value)
+{
+    return _mm_set1_epi8(static_cast<char>(value));
+}
+
+inline
+Vector::Type Vector::eq(Type lhs, Type rhs)
+{
+    return _mm_cmpeq_epi8(lhs, rhs);
+}
+
+inline
+Vector::Type Vector::le(Type value, unsigned char limit)
+{
+    const Type limits = splat(limit);
+    return _mm_cmpeq_epi8(_mm_max_epu8(value, limits), limits);
+}
+
+inline
+Vector::Type Vector::bitOr(Type lhs, Type rhs)
+{
+    return _mm_or_si128(lhs, rhs);
+}
+
+inline
+Vector::Type Vector::andNot(Type lhs, Type rhs)
+{
+    return _mm_andnot_si128(rhs, lhs);
+}
+
+inline
+Vector::Type Vector::bitNot(Type value)
+{
+    return _mm_xor_si128(value, _mm_set1_epi8(-1));
+}
+
+inline
+Vector::Type Vector::sub(Type lhs, Type rhs)
+{
+    return _mm_sub_epi8(lhs, rhs);
+}
+
+inline
+int Vector::firstMatch(Type matches)
+{
+    const unsigned int bits = static_cast<unsigned int>(
+                                                   _mm_movemask_epi8(matches));
+    return bits ? bdlb::BitUtil::numTrailingUnsetBits(bits) : k_WIDTH;
+}
+
+#else  // NEON
+
+inline
+Vector::Type Vector::load(const char *address)
+{
+    return vld1q_u8(reinterpret_cast<const bsl::uint8_t *>(address));
+}
+
+inline
+Vector::Type Vector::splat(unsigned char value)
+{
+    return vdupq_n_u8(value);
+}
+
+inline
+Vector::Type Vector::eq(Type lhs, Type rhs)
+{
+    return vceqq_u8(lhs, rhs);
+}
+
+inline
+Vector::Type Vector::le(Type value, unsigned char limit)
+{
+    return vcleq_u8(value, vdupq_n_u8(limit));
+}
+
+inline
+Vector::Type Vector::bitOr(Type lhs, Type rhs)
+{
+    return vorrq_u8(lhs, rhs);
+}
+
+inline
+Vector::Type Vector::andNot(Type lhs, Type rhs)
+{
+    return vbicq_u8(lhs, rhs);
+}
+
+inline
+Vector::Type Vector::bitNot(Type value)
+{
+    return vmvnq_u8(value);
+}
+
+inline
+Vector::Type Vector::sub(Type lhs, Type rhs)
+{
+    return vsubq_u8(lhs, rhs);
+}
+
+inline
+int Vector::firstMatch(Type matches)
+{
+    // Narrow each byte to a nibble, so that the 16 results fit in 64 bits.
+
+    const uint8x8_t     nibbles = vshrn_n_u16(vreinterpretq_u16_u8(matches),
+                                          4);
+    const bsl::uint64_t bits    = vget_lane_u64(vreinterpret_u64_u8(nibbles),
+                                                0);
+    return bits
+         ? bdlb::BitUtil::numTrailingUnsetBits(
+                               static_cast<unsigned long long>(bits)) / 4
+         : k_WIDTH;
+}
+
+#endif
+
+#endif  // BDLJSN_SCANUTIL_USE_SIMD
+
+                        // ===========================
+                        // struct StringSpecialMatcher
+                        // ===========================
+
+/// This `struct` matches the characters ending the content of a string.
+struct StringSpecialMatcher {
+
+    // ACCESSORS
+    bool isMatch(char character) const
+    {
+        const unsigned char c = static_cast<unsigned char>(character);
+        return '"' == c || '\\' == c || c <= 0x1F;
+    }
+
+#if defined(BDLJSN_SCANUTIL_USE_SIMD)
+    Vector::Type match(Vector::Type v) const
+    {
+        return Vector::bitOr(
+                     Vector::bitOr(Vector::eq(v, Vector::splat('"')),
+                                   Vector::eq(v, Vector::splat('\\'))),
+                     Vector::le(v, 0x1F));
+    }
+#endif
+};
+
+                           // ======================
+                           // struct NonAsciiMatcher
+                           // ======================
+
+/// This `struct` matches the bytes having their most-significant bit set.
+struct NonAsciiMatcher {
+
+    // ACCESSORS
+    bool isMatch(char character) const
+    {
+        return 0x7F < static_cast<unsigned char>(character);
+    }
+
+#if defined(BDLJSN_SCANUTIL_USE_SIMD)
+    Vector::Type match(Vector::Type v) const
+    {
+        return Vector::bitNot(Vector::le(v, 0x7F));
+    }
+#endif
+};
+
+                           // ======================
+                           // struct ValueEndMatcher
+                           // ======================
+
+/// This `struct` matches whitespace and the structural characters.
+struct ValueEndMatcher {
+
+    // ACCESSORS
+    bool isMatch(char character) const
+    {
+        const unsigned char c = static_cast<unsigned char>(character);
+        return ' '  == c
+            || static_cast<unsigned char>(c - 0x09) <= 0x04
+            || '{'  == (c | 0x20)
+            || '}'  == (c | 0x20)
+            || ':'  == c
+            || ','  == c
+            || '"'  == c;
+    }
+
+#if defined(BDLJSN_SCANUTIL_USE_SIMD)
+    Vector::Type match(Vector::Type v) const
+    {
+        const Vector::Type folded = Vector::bitOr(v, Vector::splat(0x20));
+
+        const Vector::Type space = Vector::bitOr(
+                       Vector::eq(v, Vector::splat(' ')),
+                       Vector::le(Vector::sub(v, Vector::splat(0x09)), 0x04));
+
+        const Vector::Type brackets = Vector::bitOr(
+                                     Vector::eq(folded, Vector::splat('{')),
+                                     Vector::eq(folded, Vector::splat('}')));
+
+        const Vector::Type separators = Vector::bitOr(
+                          Vector::bitOr(Vector::eq(v, Vector::splat(':')),
+                                        Vector::eq(v, Vector::splat(','))),
+                          Vector::eq(v, Vector::splat('"')));
+
+        return Vector::bitOr(Vector::bitOr(space, brackets), separators);
+    }
+#endif
+};
+
+                        // ===========================
+                        // struct NonWhitespaceMatcher
+                        // ===========================
+
+/// This `struct` matches the characters that are not JSON whitespace.
+struct NonWhitespaceMatcher {
+
+    // DATA
+    bool d_allowFormFeed;  // `true` if '\f' is whitespace
+
+    // ACCESSORS
+    bool isMatch(char character) const
+    {
+        const unsigned char c = static_cast<unsigned char>(character);
+        const bool isWhitespace = ' ' == c
+                               || static_cast<unsigned char>(c - 0x09) <= 0x04;
+        return !isWhitespace || ('\f' == c && !d_allowFormFeed);
+    }
+
+#if defined(BDLJSN_SCANUTIL_USE_SIMD)
+    Vector::Type match(Vector::Type v) const
+    {
+        Vector::Type whitespace = Vector::bitOr(
+                       Vector::eq(v, Vector::splat(' ')),
+                       Vector::le(Vector::sub(v, Vector::splat(0x09)), 0x04));
+
+        if (!d_allowFormFeed) {
+            whitespace = Vector::andNot(whitespace,
+                                        Vector::eq(v, Vector::splat('\f')));
+        }
+
+        return Vector::bitNot(whitespace);
+    }
+#endif
+};
+
+/// Return the address of the first character in the specified range
+/// `[begin .. end)` matched by the specified `matcher`, and `end` if there
+/// is no such character.
+template <class MATCHER>
+inline
+const char *scan(const char *begin, const char *end, const MATCHER& matcher)
+{
+    BSLS_ASSERT(begin <= end);
+
+#if defined(BDLJSN_SCANUTIL_USE_SIMD)
+    while (end - begin >= Vector::k_WIDTH) {
+        const int index = Vector::firstMatch(
+                                        matcher.match(Vector::load(begin)));
+        if (index < Vector::k_WIDTH) {
+            return begin + index;                                     // RETURN
+        }
+        begin += Vector::k_WIDTH;
+    }
+#endif
+
+    while (begin != end && !matcher.isMatch(*begin)) {
+        ++begin;
+    }
+    return begin;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+namespace bdljsn {
+
+                              // ---------------
+                              // struct ScanUtil
+                              // ---------------
+
+// CLASS METHODS
+const char *ScanUtil::findStringSpecial(const char *begin, const char *end)
+{
+    return u::scan(begin, end, u::StringSpecialMatcher());
+}
+
+const char *ScanUtil::findNonAscii(const char *begin, const char *end)
+{
+    return u::scan(begin, end, u::NonAsciiMatcher());
+}
+
+const char *ScanUtil::findValueEnd(const char *begin, const char *end)
+{
+    return u::scan(begin, end, u::ValueEndMatcher());
+}
+
+const char *ScanUtil::skipWhitespace(const char *begin,
+                                     const char *end,
+                                     bool        allowFormFeed)
+{
+    const u::NonWhitespaceMatcher matcher = { allowFormFeed };
+    return u::scan(begin, end, matcher);
+}
+
+const char *ScanUtil::validateUtf8(int        *status,
+                                   const char *begin,
+                                   const char *end)
+{
+    BSLS_ASSERT(status);
+    BSLS_ASSERT(begin <= end);
+
+    while (true) {
+        begin = findNonAscii(begin, end);
+        if (begin == end) {
+            *status = 0;
+            return end;                                               // RETURN
+        }
+
+        // Validate the non-ASCII sequence (and possibly some ASCII following
+        // it) before resuming the vectorized search.
+
+        const char *next;
+        int         rc;
+        bdlde::Utf8Util::advanceIfValid(
+                    &rc,
+                    &next,
+                    begin,
+                    static_cast<bdlde::Utf8Util::size_type>(end - begin),
+                    u::k_MAX_CODE_POINTS_PER_CALL);
+        if (0 != rc) {
+            *status = rc;
+            return next;                                              // RETURN
+        }
+        begin = next;
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
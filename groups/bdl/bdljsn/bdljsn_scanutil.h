@@ -0,0 +1,157 @@
+// bdljsn_scanutil.h                                                  -*-C++-*-
+#ifndef INCLUDED_BDLJSN_SCANUTIL
+#define INCLUDED_BDLJSN_SCANUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide bulk scanning of JSON text for structural characters.
+//
+//@CLASSES:
+//  bdljsn::ScanUtil: namespace for vectorized JSON scanning functions
+//
+//@SEE_ALSO: bdljsn_tokenizer
+//
+//@DESCRIPTION: This component provides a utility `struct`,
+// `bdljsn::ScanUtil`, that is a namespace for functions searching a
+// contiguous range of JSON text for the first character of a class that is
+// significant to a JSON tokenizer: the end of the content of a string (a
+// quote, an escape, or a control character), the end of a number or literal
+// value (whitespace or a structural character), the end of a run of
+// whitespace, and the end of valid UTF-8.
+//
+// On platforms supporting them, the functions examine 16 (SSE2, NEON) or 32
+// (AVX2) bytes at a time using SIMD instructions, and fall back on a scalar
+// loop for the remainder of the range, and on platforms lacking them.  The
+// instruction set is selected at compile time (e.g., AVX2 is used only if
+// the translation unit is compiled for a CPU supporting it).  No function
+// reads outside of the range it is given.
+//
+///Character Classes
+///-----------------
+// The character classes searched for are:
+// ```
+// Function              Stops at
+// --------------------  ---------------------------------------------------
+// findStringSpecial     '"', '\\', and the control characters U+0000..U+001F
+// findValueEnd          ' ', '\t', '\n', '\v', '\f', '\r', and the
+//                       structural characters '{', '}', '[', ']', ':', ',',
+//                       and '"'
+// skipWhitespace        any character other than ' ', '\t', '\n', '\v',
+//                       '\r', and (optionally) '\f'
+// findNonAscii          any byte having its most-significant bit set
+// ```
+// Note that `findValueEnd` stops at the same characters as
+// `bdlb::CharType::isSpace` (in addition to the structural characters), and
+// that the whitespace skipped by `skipWhitespace` is that accepted by
+// `bdljsn::Tokenizer` in relaxed (with form-feed) and strict (without
+// form-feed) modes.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Finding the End of a JSON String
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have the text of a JSON string, following its opening quote,
+// and we want to find its closing quote, skipping escaped characters.
+//
+// First, we define the text:
+// ```
+// const char  text[] = "a \\\"quoted\\\" word\", 1]";
+// const char *end    = text + sizeof text - 1;
+// ```
+// Then, we search for the special characters of a string, skipping the
+// character following each escape:
+// ```
+// const char *p = bdljsn::ScanUtil::findStringSpecial(text, end);
+// while (p != end && '\\' == *p) {
+//     p = bdljsn::ScanUtil::findStringSpecial(p + 2, end);
+// }
+// ```
+// Finally, we verify that we found the closing quote:
+// ```
+// assert(p != end);
+// assert('"' == *p);
+// assert(bsl::string_view("a \\\"quoted\\\" word") ==
+//                                           bsl::string_view(text, p - text));
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace bdljsn {
+
+                              // ===============
+                              // struct ScanUtil
+                              // ===============
+
+/// This `struct` provides a namespace for functions searching contiguous
+/// JSON text for characters significant to a JSON tokenizer.
+struct ScanUtil {
+
+    // CLASS METHODS
+
+    /// Return the address of the first character in the specified range
+    /// `[begin .. end)` that is a quote (`"`), a backslash (`\`), or a
+    /// control character (U+0000..U+001F), and `end` if there is no such
+    /// character.  The behavior is undefined unless `[begin .. end)` is a
+    /// valid range.
+    static const char *findStringSpecial(const char *begin, const char *end);
+
+    /// Return the address of the first byte in the specified range
+    /// `[begin .. end)` having its most-significant bit set (i.e., that is
+    /// not ASCII), and `end` if there is no such byte.  The behavior is
+    /// undefined unless `[begin .. end)` is a valid range.
+    static const char *findNonAscii(const char *begin, const char *end);
+
+    /// Return the address of the first character in the specified range
+    /// `[begin .. end)` that is whitespace (as defined by
+    /// `bdlb::CharType::isSpace`) or one of the characters `{`, `}`, `[`,
+    /// `]`, `:`, `,`, and `"`, and `end` if there is no such character.  The
+    /// behavior is undefined unless `[begin .. end)` is a valid range.
+    static const char *findValueEnd(const char *begin, const char *end);
+
+    /// Return the address of the first character in the specified range
+    /// `[begin .. end)` that is not one of ` `, `\t`, `\n`, `\v`, and `\r`,
+    /// nor `\f` if the specified `allowFormFeed` is `true`, and `end` if
+    /// there is no such character.  The behavior is undefined unless
+    /// `[begin .. end)` is a valid range.
+    static const char *skipWhitespace(const char *begin,
+                                      const char *end,
+                                      bool        allowFormFeed);
+
+    /// Return the address of the byte following the longest prefix of the
+    /// specified range `[begin .. end)` that is valid UTF-8, and load into
+    /// the specified `status` 0 if the whole range is valid, and a value
+    /// from the `bdlde::Utf8Util::ErrorStatus` `enum` describing the
+    /// invalid sequence found at the returned address otherwise.  Note that
+    /// `bdlde::Utf8Util::k_END_OF_INPUT_TRUNCATION` is loaded if the range
+    /// ends with the (valid) beginning of a multi-byte sequence.
+    static const char *validateUtf8(int        *status,
+                                    const char *begin,
+                                    const char *end);
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
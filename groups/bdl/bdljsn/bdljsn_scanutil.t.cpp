@@ -0,0 +1,703 @@
+// bdljsn_scanutil.t.cpp                                              -*-C++-*-
+#include <bdljsn_scanutil.h>
+
+#include <bdlb_chartype.h>
+#include <bdlde_utf8util.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides functions searching a range of bytes for
+// the first byte of a character class, using SIMD instructions for whole
+// vectors and a scalar loop for the remainder.  The functions are tested
+// against straightforward reference implementations, for each byte value at
+// each position of ranges of each length up to several vector widths, and at
+// each alignment, so that both the vectorized and the scalar paths are
+// exercised.  `validateUtf8` is tested against `bdlde::Utf8Util`.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] const char *findStringSpecial(const char *begin, const char *end);
+// [ 2] const char *findNonAscii(const char *begin, const char *end);
+// [ 2] const char *findValueEnd(const char *begin, const char *end);
+// [ 2] const char *skipWhitespace(const char *, const char *, bool);
+// [ 3] const char *validateUtf8(int *, const char *, const char *);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdljsn::ScanUtil  Util;
+typedef bdlde::Utf8Util   Utf8Util;
+
+typedef const char *(*Function)(const char *, const char *);
+
+/// The maximum length of the ranges tested exhaustively; several times the
+/// widest vector.
+const int k_MAX_LENGTH = 100;
+
+// ============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// Return `true` if the specified `c` ends the content of a JSON string.
+bool isStringSpecial(unsigned char c)
+{
+    return '"' == c || '\\' == c || c < 0x20;
+}
+
+/// Return `true` if the specified `c` is not ASCII.
+bool isNonAscii(unsigned char c)
+{
+    return 0x80 <= c;
+}
+
+/// Return `true` if the specified `c` ends a number or literal value.
+bool isValueEnd(unsigned char c)
+{
+    return bdlb::CharType::isSpace(static_cast<char>(c))
+        || (0 != c && bsl::strchr("{}[]:,\"", c));
+}
+
+/// Return `true` if the specified `c` is not whitespace, where `\f` is
+/// whitespace only if `ALLOW_FORM_FEED` is `true`.
+template <bool ALLOW_FORM_FEED>
+bool isNonWhitespace(unsigned char c)
+{
+    const char *whitespace = ALLOW_FORM_FEED ? " \n\t\v\r\f" : " \n\t\v\r";
+    return 0 == c || 0 == bsl::strchr(whitespace, c);
+}
+
+const char *skipWhitespaceWithFormFeed(const char *begin, const char *end)
+{
+    return Util::skipWhitespace(begin, end, true);
+}
+
+const char *skipWhitespaceWithoutFormFeed(const char *begin, const char *end)
+{
+    return Util::skipWhitespace(begin, end, false);
+}
+
+/// Return the address of the first byte of the specified range
+/// `[begin .. end)` for which the specified `predicate` is `true`, and `end`
+/// if there is none.
+const char *referenceFind(const char  *begin,
+                          const char  *end,
+                          bool       (*predicate)(unsigned char))
+{
+    while (begin != end && !predicate(static_cast<unsigned char>(*begin))) {
+        ++begin;
+    }
+    return begin;
+}
+
+/// Return a pseudo-random number, updating the specified `seed`.
+unsigned int nextRandom(unsigned int *seed)
+{
+    *seed = *seed * 1103515245 + 12345;
+    return (*seed >> 16) & 0x7FFF;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Finding the End of a JSON String
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have the text of a JSON string, following its opening quote,
+// and we want to find its closing quote, skipping escaped characters.
+//
+// First, we define the text:
+// ```
+    const char  text[] = "a \\\"quoted\\\" word\", 1]";
+    const char *end    = text + sizeof text - 1;
+// ```
+// Then, we search for the special characters of a string, skipping the
+// character following each escape:
+// ```
+    const char *p = bdljsn::ScanUtil::findStringSpecial(text, end);
+    while (p != end && '\\' == *p) {
+        p = bdljsn::ScanUtil::findStringSpecial(p + 2, end);
+    }
+// ```
+// Finally, we verify that we found the closing quote:
+// ```
+    ASSERT(p != end);
+    ASSERT('"' == *p);
+    ASSERT(bsl::string_view("a \\\"quoted\\\" word") ==
+                                           bsl::string_view(text, p - text));
+// ```
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING `validateUtf8`
+        //
+        // Concerns:
+        // 1. `validateUtf8` returns `end`, and loads 0, for valid UTF-8.
+        //
+        // 2. For invalid UTF-8, `validateUtf8` returns the address of the
+        //    first invalid sequence, and loads the status that
+        //    `bdlde::Utf8Util` reports for that sequence.
+        //
+        // 3. A range ending with the valid beginning of a multi-byte sequence
+        //    is reported as `k_END_OF_INPUT_TRUNCATION`.
+        //
+        // 4. Invalid sequences are found at any position, in particular
+        //    after a long ASCII prefix.
+        //
+        // Plan:
+        // 1. For a table of valid and invalid sequences, embed each sequence
+        //    at each position of ASCII text, and compare the results of
+        //    `validateUtf8` with those of `bdlde::Utf8Util::isValid`.
+        //    (C-1..4)
+        //
+        // 2. Compare the results of `validateUtf8` with those of
+        //    `bdlde::Utf8Util::isValid` for random byte sequences, mostly
+        //    ASCII.  (C-1..2, 4)
+        //
+        // 3. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.
+        //
+        // Testing:
+        //   const char *validateUtf8(int *, const char *, const char *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `validateUtf8`" << endl
+                          << "======================" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_sequence_p;
+            int         d_status;
+        } DATA[] = {
+            // LINE  SEQUENCE      STATUS
+            // ----  ------------  ---------------------------------------
+            { L_,    "",           0                                       },
+            { L_,    "a",          0                                       },
+            { L_,    "\xC3\xA9",   0                                       },
+            { L_,    "\xE4\xB8\x96",
+                                   0                                       },
+            { L_,    "\xF0\x9F\x98\x80",
+                                   0                                       },
+            { L_,    "\xEF\xBF\xBF",
+                                   0                                       },
+            { L_,    "\xF4\x8F\xBF\xBF",
+                                   0                                       },
+            { L_,    "\xC3",       Utf8Util::k_END_OF_INPUT_TRUNCATION     },
+            { L_,    "\xE4\xB8",   Utf8Util::k_END_OF_INPUT_TRUNCATION     },
+            { L_,    "\xF0\x9F\x98",
+                                   Utf8Util::k_END_OF_INPUT_TRUNCATION     },
+            { L_,    "\x80",       Utf8Util::k_UNEXPECTED_CONTINUATION_OCTET },
+            { L_,    "\xBF",       Utf8Util::k_UNEXPECTED_CONTINUATION_OCTET },
+            { L_,    "\xC3" "a",   Utf8Util::k_NON_CONTINUATION_OCTET      },
+            { L_,    "\xE4\xB8" "a",
+                                   Utf8Util::k_NON_CONTINUATION_OCTET      },
+            { L_,    "\xC0\x80",   Utf8Util::k_OVERLONG_ENCODING           },
+            { L_,    "\xE0\x80\x80",
+                                   Utf8Util::k_OVERLONG_ENCODING           },
+            { L_,    "\xED\xA0\x80",
+                                   Utf8Util::k_SURROGATE                   },
+            { L_,    "\xF4\x90\x80\x80",
+                                   Utf8Util::k_VALUE_LARGER_THAN_0X10FFFF  },
+            { L_,    "\xF8\x88\x80\x80\x80",
+                                   Utf8Util::k_INVALID_INITIAL_OCTET       },
+            { L_,    "\xFF",       Utf8Util::k_INVALID_INITIAL_OCTET       },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        if (verbose) cout << "\tTable-driven sequences." << endl;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int          LINE   = DATA[ti].d_line;
+            const bsl::string  SEQ    = DATA[ti].d_sequence_p;
+            const int          STATUS = DATA[ti].d_status;
+
+            for (int prefix = 0; prefix < k_MAX_LENGTH; ++prefix) {
+                for (int suffix = 0; suffix < 3; ++suffix) {
+
+                    // A truncated sequence is truncated only at the end.
+
+                    if (Utf8Util::k_END_OF_INPUT_TRUNCATION == STATUS &&
+                        suffix) {
+                        continue;
+                    }
+
+                    bsl::string text(prefix, 'p');
+                    text += SEQ;
+                    text.append(suffix, 's');
+
+                    const char *begin = text.data();
+                    const char *end   = begin + text.length();
+
+                    int         status = 99;
+                    const char *result = Util::validateUtf8(&status,
+                                                            begin,
+                                                            end);
+
+                    ASSERTV(LINE, prefix, suffix, STATUS, status,
+                            STATUS == status);
+                    if (0 == STATUS) {
+                        ASSERTV(LINE, prefix, suffix, end == result);
+                    }
+                    else {
+                        ASSERTV(LINE, prefix, suffix, result - begin,
+                                begin + prefix == result);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\tRandom sequences." << endl;
+
+        unsigned int seed = 12345;
+        for (int i = 0; i < 20000; ++i) {
+            const int   length = static_cast<int>(nextRandom(&seed) % 200);
+            bsl::string text;
+            for (int j = 0; j < length; ++j) {
+                const unsigned int r = nextRandom(&seed);
+                text += r % 16
+                      ? static_cast<char>(0x20 + r % 0x5F)
+                      : static_cast<char>(0x80 + r % 0x80);
+            }
+
+            const char *begin = text.data();
+            const char *end   = begin + text.length();
+
+            const char *invalid  = 0;
+            const bool  isValid  = Utf8Util::isValid(&invalid,
+                                                     begin,
+                                                     text.length());
+            int         status   = 99;
+            const char *result   = Util::validateUtf8(&status, begin, end);
+
+            ASSERTV(i, isValid == (0 == status));
+            ASSERTV(i, isValid ? end == result : invalid == result);
+            if (veryVerbose && !isValid) {
+                P_(i) P_(result - begin) P(status);
+            }
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const char *p = "abc";
+            int         status;
+
+            ASSERT_PASS(Util::validateUtf8(&status, p, p + 3));
+            ASSERT_FAIL(Util::validateUtf8(0, p, p + 3));
+            ASSERT_FAIL(Util::validateUtf8(&status, p + 3, p));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING SCANNING FUNCTIONS
+        //
+        // Concerns:
+        // 1. Each function returns the address of the first byte of the range
+        //    in its character class, and `end` if there is none.
+        //
+        // 2. Each byte value is correctly classified.
+        //
+        // 3. The results are correct at each position of ranges of each
+        //    length (exercising the vectorized and scalar paths), and for
+        //    each alignment of the range.
+        //
+        // 4. No byte outside of the range is examined.
+        //
+        // Plan:
+        // 1. For each function, for each byte value, for each length up to
+        //    several vector widths, for each position in the range, and for
+        //    several alignments, fill the range with a byte outside of the
+        //    class, place the byte value at the position, and compare the
+        //    result with that of a reference implementation.  Surround the
+        //    range with bytes in the class.  (C-1..4)
+        //
+        // 2. Compare the results of each function with those of a reference
+        //    implementation for random ranges.  (C-1, 3)
+        //
+        // 3. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.
+        //
+        // Testing:
+        //   const char *findStringSpecial(const char *begin, const char *end);
+        //   const char *findNonAscii(const char *begin, const char *end);
+        //   const char *findValueEnd(const char *begin, const char *end);
+        //   const char *skipWhitespace(const char *, const char *, bool);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING SCANNING FUNCTIONS" << endl
+                          << "==========================" << endl;
+
+        static const struct {
+            int          d_line;
+            const char  *d_name_p;
+            Function     d_function;
+            bool       (*d_predicate)(unsigned char);
+            char         d_filler;      // byte not in the class
+            char         d_guard;       // byte in the class
+        } DATA[] = {
+            { L_, "findStringSpecial", &Util::findStringSpecial,
+                                       &isStringSpecial,      'a', '"'  },
+            { L_, "findNonAscii",      &Util::findNonAscii,
+                                       &isNonAscii,           'a', '\x80' },
+            { L_, "findValueEnd",      &Util::findValueEnd,
+                                       &isValueEnd,           '1', ','  },
+            { L_, "skipWhitespace(t)", &skipWhitespaceWithFormFeed,
+                                       &isNonWhitespace<true>,
+                                                              ' ', 'x'  },
+            { L_, "skipWhitespace(f)", &skipWhitespaceWithoutFormFeed,
+                                       &isNonWhitespace<false>,
+                                                              '\t', 'x' },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        char buffer[k_MAX_LENGTH + 64];
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int      LINE      = DATA[ti].d_line;
+            const char    *NAME      = DATA[ti].d_name_p;
+            const Function FUNCTION  = DATA[ti].d_function;
+            bool         (*PREDICATE)(unsigned char) = DATA[ti].d_predicate;
+            const char     FILLER    = DATA[ti].d_filler;
+            const char     GUARD     = DATA[ti].d_guard;
+
+            if (verbose) { T_ P(NAME) }
+
+            ASSERTV(LINE, !PREDICATE(static_cast<unsigned char>(FILLER)));
+            ASSERTV(LINE,  PREDICATE(static_cast<unsigned char>(GUARD)));
+
+            for (int offset = 0; offset < 4; ++offset) {
+            for (int length = 0; length <= k_MAX_LENGTH; ++length) {
+                bsl::memset(buffer, GUARD, sizeof buffer);
+
+                char       *begin = buffer + 16 + offset;
+                const char *end   = begin + length;
+
+                bsl::memset(begin, FILLER, length);
+
+                ASSERTV(LINE, offset, length,
+                        end == FUNCTION(begin, end));
+
+                for (int pos = 0; pos < length; ++pos) {
+                    for (int c = 0; c < 256; ++c) {
+                        begin[pos] = static_cast<char>(c);
+
+                        const char *EXP = referenceFind(begin, end, PREDICATE);
+                        const char *result = FUNCTION(begin, end);
+
+                        ASSERTV(LINE, offset, length, pos, c,
+                                result - begin, EXP - begin,
+                                EXP == result);
+                    }
+                    begin[pos] = FILLER;
+                }
+            }
+            }
+
+            unsigned int seed = 54321;
+            for (int i = 0; i < 20000; ++i) {
+                const int length = static_cast<int>(nextRandom(&seed) %
+                                                                k_MAX_LENGTH);
+                const int density = 1 + static_cast<int>(
+                                                     nextRandom(&seed) % 64);
+
+                for (int j = 0; j < length; ++j) {
+                    const unsigned int r = nextRandom(&seed);
+                    buffer[j] = 0 == r % density
+                              ? static_cast<char>(r >> 7)
+                              : FILLER;
+                }
+
+                const char *EXP    = referenceFind(buffer,
+                                                   buffer + length,
+                                                   PREDICATE);
+                const char *result = FUNCTION(buffer, buffer + length);
+
+                ASSERTV(LINE, i, result - buffer, EXP - buffer,
+                        EXP == result);
+            }
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const char *p = "abc";
+
+            ASSERT_PASS(Util::findStringSpecial(p, p));
+            ASSERT_FAIL(Util::findStringSpecial(p + 1, p));
+            ASSERT_PASS(Util::findNonAscii(p, p));
+            ASSERT_FAIL(Util::findNonAscii(p + 1, p));
+            ASSERT_PASS(Util::findValueEnd(p, p));
+            ASSERT_FAIL(Util::findValueEnd(p + 1, p));
+            ASSERT_PASS(Util::skipWhitespace(p, p, true));
+            ASSERT_FAIL(Util::skipWhitespace(p + 1, p, true));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The functions are sufficiently functional to enable
+        //    comprehensive testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Scan a short JSON document with each function.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const char  DOC[] = "  \t{\"name\": \"caf\xC3\xA9 \\\"x\\\"\", "
+                            "\"value\": 1234567890123456789012345678901234}";
+        const char *end   = DOC + sizeof DOC - 1;
+
+        const char *p = Util::skipWhitespace(DOC, end, true);
+        ASSERT(DOC + 3 == p);
+        ASSERT('{' == *p);
+
+        p = Util::findStringSpecial(p + 2, end);
+        ASSERT('"' == *p);
+        ASSERT(DOC + 9 == p);
+
+        p = Util::findNonAscii(DOC, end);
+        ASSERT(DOC + 16 == p);
+
+        p = Util::findStringSpecial(p, end);
+        ASSERT('\\' == *p);
+
+        const char *number = bsl::strstr(DOC, "1234");
+        p = Util::findValueEnd(number, end);
+        ASSERT('}' == *p);
+        ASSERT(end - 1 == p);
+
+        int status = 99;
+        ASSERT(end == Util::validateUtf8(&status, DOC, end));
+        ASSERT(0 == status);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        // 1. The throughput of each function on long ranges is reported.
+        //
+        // Plan:
+        // 1. Apply each function to a 1 MB range having no byte in its class
+        //    repeatedly, and report the throughput in GB/s.  The number of
+        //    iterations is given by the second command-line argument
+        //    (default: 1000).
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE TEST" << endl
+             << "================" << endl;
+
+        const int NUM_ITERATIONS = argc > 2 && bsl::atoi(argv[2]) > 0
+                                 ? bsl::atoi(argv[2])
+                                 : 1000;
+
+        const bsl::size_t k_LENGTH = 1024 * 1024;
+
+        const bsl::string letters(k_LENGTH, 'a');
+        const bsl::string spaces(k_LENGTH, ' ');
+
+        const struct {
+            const char  *d_name_p;
+            Function     d_function;
+            const char  *d_text_p;
+        } DATA[] = {
+            { "findStringSpecial", &Util::findStringSpecial, letters.c_str() },
+            { "findNonAscii",      &Util::findNonAscii,      letters.c_str() },
+            { "findValueEnd",      &Util::findValueEnd,      letters.c_str() },
+            { "skipWhitespace",    &skipWhitespaceWithFormFeed,
+                                                             spaces.c_str()  },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const char *begin = DATA[ti].d_text_p;
+            const char *end   = begin + k_LENGTH;
+
+            bsls::Stopwatch timer;
+            bsl::size_t     total = 0;
+
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                total += DATA[ti].d_function(begin, end) - begin;
+            }
+            timer.stop();
+
+            ASSERT(total == k_LENGTH * NUM_ITERATIONS);
+
+            cout << DATA[ti].d_name_p << ": "
+                 << static_cast<double>(total) / timer.elapsedTime() / 1e9
+                 << " GB/s" << endl;
+        }
+
+        {
+            const char *begin = letters.c_str();
+            const char *end   = begin + k_LENGTH;
+
+            bsls::Stopwatch timer;
+            int             status;
+
+            timer.start();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                ASSERT(end == Util::validateUtf8(&status, begin, end));
+            }
+            timer.stop();
+
+            cout << "validateUtf8: "
+                 << static_cast<double>(k_LENGTH) * NUM_ITERATIONS /
+                                                      timer.elapsedTime() / 1e9
+                 << " GB/s" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
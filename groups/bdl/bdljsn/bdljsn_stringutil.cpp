@@ -184,7 +184,16 @@ int readUnquotedStringImp(STRING                  *value,
             return -1;                                                // RETURN
         }
         else {
-            *value += *iter;
+            // Append, in bulk, the run of characters preceding the next
+            // escape or quote.
+
+            const char *runEnd = iter + 1;
+            while (runEnd < end && '\\' != *runEnd && '"' != *runEnd) {
+                ++runEnd;
+            }
+
+            value->append(iter, runEnd - iter);
+            iter = runEnd - 1;
         }
     }
 
@@ -5,14 +5,15 @@
 BSLS_IDENT_RCSID(bdljsn_tokenizer_cpp, "$Id$ $CSID$")
 
 #include <bdljsn_numberutil.h>  // for testing only
+#include <bdljsn_scanutil.h>
 #include <bdljsn_stringutil.h>  // for testing only
 
-#include <bdlb_chartype.h>
 #include <bdlde_utf8util.h>
 #include <bdlsb_fixedmemoutstreambuf.h>
 
-#include <bsl_cstring.h>
+#include <bsl_cstddef.h>
 #include <bsl_ios.h>
+#include <bsl_string.h>
 
 // IMPLEMENTATION NOTES
 // --------------------
@@ -61,14 +62,6 @@ BSLS_IDENT_RCSID(bdljsn_tokenizer_cpp, "$Id$ $CSID$")
 // illegal with others.
 
 namespace BloombergLP {
-namespace {
-
-static const char *g_WHITESPACE_DEFAULT = " \n\t\v\r\f";
-static const char *g_WHITESPACE_STRICT  = " \n\t\v\r";  // no form-feed
-static const char *g_TOKENS             = "{}[]:,\"";
-
-}  // close unnamed namespace
-
 namespace bdljsn {
 
                               // ---------------
@@ -78,110 +71,151 @@ namespace bdljsn {
 // PRIVATE MANIPULATORS
 int Tokenizer::expandBufferForLargeValue()
 {
-    const bsl::string::size_type currLength = d_stringBuffer.length();
-    d_stringBuffer.resize(currLength + k_MAX_STRING_SIZE);
-
-    bsl::size_t numRead;
-    if (d_readStatus || d_bufEndStatus) {
-        numRead = 0;
-    }
-    else if (d_allowNonUtf8StringLiterals) {
-        numRead = static_cast<bsl::size_t>(d_streambuf_p->sgetn(
-                                                  &d_stringBuffer[d_valueIter],
-                                                  k_MAX_STRING_SIZE));
+    if (d_input_p) {
+        readInput(0, 0);
+        return -1;                                                    // RETURN
     }
-    else {
-        int sts = 0;
-        numRead = bdlde::Utf8Util::readIfValid(&sts,
-                                               &d_stringBuffer[d_valueIter],
-                                               k_MAX_STRING_SIZE,
-                                               d_streambuf_p);
-        if (sts < 0) {
-            d_bufEndStatus = sts;
-        }
-        else {
-            // should be success or buffer full
 
-            BSLS_ASSERT(0 == sts || k_MAX_STRING_SIZE < numRead + 4);
-        }
-    }
+    const bsl::string::size_type currLength = d_stringBuffer.length();
+    d_stringBuffer.resize(currLength + k_MAX_STRING_SIZE);
 
-    if (0 == d_readStatus && 0 == numRead) {
-        d_readStatus = 0 == d_bufEndStatus ? k_EOF : d_bufEndStatus;
-    }
+    const bsl::size_t numRead = readInput(&d_stringBuffer[d_valueIter],
+                                          k_MAX_STRING_SIZE);
 
-    d_readOffset += numRead;
     d_stringBuffer.resize(currLength + numRead);
     return numRead ? 0 : -1;
 }
 
 int Tokenizer::extractStringValue()
 {
-    bool firstTime    = true;
-    char previousChar = 0;
+    bool firstTime = true;
+    bool escaped   = false;  // 'true' if the previous character is an
+                             // unescaped '\'
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length() &&
-               '"' != d_stringBuffer[d_valueIter]) {
-            if ('\\' == d_stringBuffer[d_valueIter] && '\\' == previousChar) {
-                previousChar = 0;
-            }
-            else {
-                previousChar = d_stringBuffer[d_valueIter];
+        const char *begin = bufferData();
+        const char *end   = begin + bufferLength();
+
+        while (d_valueIter < bufferLength()) {
+            if (escaped) {
+                const char ch = begin[d_valueIter];
 
                 if (false == d_allowUnescapedControlCharacters
-                 && 0x00  <= previousChar
-                 &&          previousChar <= 0x1F) {
+                 && 0x00  <= ch
+                 &&          ch <= 0x1F) {
                     return -2;                                        // RETURN
                 }
+
+                escaped = false;
+                ++d_valueIter;
+                continue;
             }
 
-            ++d_valueIter;
-        }
+            // Skip, in bulk, the characters that are neither a quote, an
+            // escape, nor a control character.
 
-        if (d_valueIter >= d_stringBuffer.length()) {
-            // There isn't enough room in the internal buffer to hold the
-            // value.  If this is the first time through the loop, we move the
-            // current sequence of characters being processed to the front of
-            // the internal buffer, otherwise we must expand the internal
-            // buffer to hold additional characters.  If we are at the
-            // beginning of the string buffer then we don't need to move any
-            // characters and we simply expand the string buffer.
-
-            if (0 == d_valueBegin) {
-                firstTime = false;
+            const char *special = ScanUtil::findStringSpecial(
+                                                         begin + d_valueIter,
+                                                         end);
+            d_valueIter = special - begin;
+            if (special == end) {
+                break;
             }
 
-            if (firstTime) {
-                const int numRead = moveValueCharsToStartAndReloadBuffer();
-                if (0 == numRead) {
-                    return -1;                                        // RETURN
-                }
+            if ('"' == *special) {
+                d_valueEnd = d_valueIter;
+                return 0;                                             // RETURN
+            }
 
-                firstTime = false;
+            if ('\\' == *special) {
+                escaped = true;
             }
-            else {
-                const int rc = expandBufferForLargeValue();
-                if (rc) {
-                    return rc;                                        // RETURN
-                }
+            else if (false == d_allowUnescapedControlCharacters) {
+                return -2;                                            // RETURN
             }
+
+            ++d_valueIter;
+        }
+
+        // There isn't enough room in the internal buffer to hold the value.
+        // If this is the first time through the loop, we move the current
+        // sequence of characters being processed to the front of the
+        // internal buffer, otherwise we must expand the internal buffer to
+        // hold additional characters.  If we are at the beginning of the
+        // string buffer then we don't need to move any characters and we
+        // simply expand the string buffer.
+
+        if (0 == d_valueBegin) {
+            firstTime = false;
+        }
+
+        if (firstTime) {
+            const int numRead = moveValueCharsToStartAndReloadBuffer();
+            if (0 == numRead) {
+                return -1;                                            // RETURN
+            }
+
+            firstTime = false;
         }
         else {
-            if ('\\' == previousChar) {
-                ++d_valueIter;
-                previousChar = 0;
-                continue;
+            const int rc = expandBufferForLargeValue();
+            if (rc) {
+                return rc;                                            // RETURN
             }
-            d_valueEnd = d_valueIter;
-            return 0;                                                 // RETURN
         }
     }
     return 0;
 }
 
+bool Tokenizer::loadContiguousInput()
+{
+    if (&d_contiguousStreamBuf != d_streambuf_p) {
+        return false;                                                 // RETURN
+    }
+
+    bdlsb::FixedMemInStreamBuf *streambuf = &d_contiguousStreamBuf;
+
+    // Note that `length` is the number of characters following the get
+    // pointer, and `data` the address of the start of the buffer.
+
+    const bsl::streamoff position = streambuf->pubseekoff(0,
+                                                          bsl::ios_base::cur,
+                                                          bsl::ios_base::in);
+    if (0 > position || 0 == streambuf->length()) {
+        return false;                                                 // RETURN
+    }
+
+    const char *begin = streambuf->data() + position;
+    const char *end   = begin + streambuf->length();
+
+    if (!d_allowNonUtf8StringLiterals) {
+        int status;
+        end = ScanUtil::validateUtf8(&status, begin, end);
+        if (status < 0) {
+            d_bufEndStatus = status;
+        }
+    }
+
+    if (begin == end) {
+        return false;                                                 // RETURN
+    }
+
+    d_input_p     = begin;
+    d_inputLength = end - begin;
+    d_readOffset += d_inputLength;
+
+    streambuf->pubseekoff(static_cast<bsl::streamoff>(d_inputLength),
+                          bsl::ios_base::cur,
+                          bsl::ios_base::in);
+    return true;
+}
+
 int Tokenizer::moveValueCharsToStartAndReloadBuffer()
 {
+    if (d_input_p) {
+        return static_cast<int>(readInput(0, 0));                     // RETURN
+    }
+
     d_stringBuffer.erase(d_stringBuffer.begin(),
                          d_stringBuffer.begin() + d_valueBegin);
     d_stringBuffer.resize(k_MAX_STRING_SIZE);
@@ -189,30 +223,27 @@ int Tokenizer::moveValueCharsToStartAndReloadBuffer()
     d_valueIter  = d_valueIter - d_valueBegin;
     d_valueBegin = 0;
 
+    const bsl::size_t numRead = readInput(&d_stringBuffer[d_valueIter],
+                                          k_MAX_STRING_SIZE - d_valueIter);
+
+    d_stringBuffer.resize(d_valueIter + numRead);
+
+    return static_cast<int>(numRead);
+}
+
+bsl::size_t Tokenizer::readInput(char *buffer, bsl::size_t length)
+{
     bsl::size_t numRead;
-    if (d_readStatus || d_bufEndStatus) {
+    if (d_readStatus || d_bufEndStatus || d_input_p) {
         numRead = 0;
     }
     else if (d_allowNonUtf8StringLiterals) {
-        numRead = static_cast<bsl::size_t>(d_streambuf_p->sgetn(
-                                             &d_stringBuffer[d_valueIter],
-                                             k_MAX_STRING_SIZE - d_valueIter));
+        numRead = static_cast<bsl::size_t>(
+                 d_streambuf_p->sgetn(buffer,
+                                      static_cast<bsl::streamsize>(length)));
     }
     else {
-        int sts = 0;
-        numRead = bdlde::Utf8Util::readIfValid(&sts,
-                                               &d_stringBuffer[d_valueIter],
-                                               k_MAX_STRING_SIZE - d_valueIter,
-                                               d_streambuf_p);
-        if (sts < 0) {
-            d_bufEndStatus = sts;
-        }
-        else {
-            // should be success or buffer full
-
-            BSLS_ASSERT(0 == sts || k_MAX_STRING_SIZE - d_valueIter < numRead +
-                                                                          4);
-        }
+        numRead = readValidUtf8(buffer, length);
     }
 
     if (0 == d_readStatus && 0 == numRead) {
@@ -220,45 +251,76 @@ int Tokenizer::moveValueCharsToStartAndReloadBuffer()
     }
 
     d_readOffset += numRead;
-    d_stringBuffer.resize(d_valueIter + numRead);
-
-    return static_cast<int>(numRead);
+    return numRead;
 }
 
-int Tokenizer::reloadStringBuffer()
+bsl::size_t Tokenizer::readValidUtf8(char *buffer, bsl::size_t length)
 {
-    d_stringBuffer.resize(k_MAX_STRING_SIZE);
+    BSLS_ASSERT(4 <= length);
 
-    bsl::size_t numRead;
-    if (d_readStatus || d_bufEndStatus) {
-        numRead = 0;
+    typedef bsl::char_traits<char> Traits;
+
+    // Read all but the last 3 bytes of 'buffer', so that a multi-byte
+    // sequence truncated by the end of the read can be completed, then
+    // validate what was read in bulk.
+
+    char *end = buffer +
+                d_streambuf_p->sgetn(buffer,
+                                     static_cast<bsl::streamsize>(length - 3));
+
+    int         status;
+    const char *validEnd = ScanUtil::validateUtf8(&status, buffer, end);
+
+    if (bdlde::Utf8Util::k_END_OF_INPUT_TRUNCATION == status) {
+        const unsigned char lead = static_cast<unsigned char>(*validEnd);
+        const bsl::ptrdiff_t sequenceLength = 0xF0 == (lead & 0xF8)
+                                            ? 4
+                                            : 0xE0 == (lead & 0xF0)
+                                            ? 3
+                                            : 2;
+
+        while (end - validEnd < sequenceLength) {
+            const Traits::int_type c = d_streambuf_p->sbumpc();
+            if (Traits::eq_int_type(Traits::eof(), c)) {
+                break;
+            }
+            *end++ = Traits::to_char_type(c);
+        }
+
+        validEnd = ScanUtil::validateUtf8(&status, validEnd, end);
     }
-    else if (d_allowNonUtf8StringLiterals) {
-        numRead = static_cast<bsl::size_t>(
-                  d_streambuf_p->sgetn(&d_stringBuffer[0], k_MAX_STRING_SIZE));
+
+    if (status < 0) {
+        d_bufEndStatus = status;
+
+        // Leave the 'streambuf' positioned on the invalid sequence, as
+        // 'bdlde::Utf8Util::readIfValid' does.  Note that some 'streambuf's
+        // are not seekable, so the return value is not checked.
+
+        d_streambuf_p->pubseekoff(validEnd - end,
+                                  bsl::ios_base::cur,
+                                  bsl::ios_base::in);
     }
-    else {
-        int sts = 0;
-        numRead = bdlde::Utf8Util::readIfValid(&sts,
-                                               &d_stringBuffer[0],
-                                               k_MAX_STRING_SIZE,
-                                               d_streambuf_p);
-
-        if (sts < 0) {
-            d_bufEndStatus = sts;
-        }
-        else {
-            // should be success or buffer full
 
-            BSLS_ASSERT(0 == sts || k_MAX_STRING_SIZE < numRead + 4);
-        }
+    return static_cast<bsl::size_t>(validEnd - buffer);
+}
+
+int Tokenizer::reloadStringBuffer()
+{
+    if (d_input_p) {
+        return static_cast<int>(readInput(0, 0));                     // RETURN
     }
 
-    if (0 == d_readStatus && 0 == numRead) {
-        d_readStatus = 0 == d_bufEndStatus ? k_EOF : d_bufEndStatus;
+    if (0 == d_readOffset && loadContiguousInput()) {
+        d_cursor = 0;
+        return static_cast<int>(d_inputLength);                       // RETURN
     }
 
-    d_readOffset += numRead;
+    d_stringBuffer.resize(k_MAX_STRING_SIZE);
+
+    const bsl::size_t numRead = readInput(&d_stringBuffer[0],
+                                          k_MAX_STRING_SIZE);
+
     d_cursor = 0;
     d_stringBuffer.resize(numRead);
     return static_cast<int>(numRead);
@@ -269,13 +331,12 @@ int Tokenizer::skipNonWhitespaceOrTillToken()
     bool firstTime = true;
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length() &&
-               !bdlb::CharType::isSpace(d_stringBuffer[d_valueIter]) &&
-               !bsl::strchr(g_TOKENS, d_stringBuffer[d_valueIter])) {
-            ++d_valueIter;
-        }
+        const char *begin = bufferData();
+        const char *end   = begin + bufferLength();
+
+        d_valueIter = ScanUtil::findValueEnd(begin + d_valueIter, end) - begin;
 
-        if (d_valueIter >= d_stringBuffer.length()) {
+        if (d_valueIter >= bufferLength()) {
             // There isn't enough room in the internal buffer to hold the
             // value.  If this is the first time through the loop, we move the
             // current sequence of characters being processed to the front of
@@ -311,14 +372,15 @@ int Tokenizer::skipNonWhitespaceOrTillToken()
 
 int Tokenizer::skipWhitespace()
 {
-    const char *k_WHITESPACE = d_allowFormFeedAsWhitespace
-                             ? g_WHITESPACE_DEFAULT
-                             : g_WHITESPACE_STRICT;
     while (true) {
-        bsl::size_t pos = d_stringBuffer.find_first_not_of(k_WHITESPACE,
-                                                           d_cursor);
-        if (bsl::string::npos != pos) {
-            d_cursor = pos;
+        const char *begin = bufferData();
+        const char *end   = begin + bufferLength();
+        const char *next  = ScanUtil::skipWhitespace(
+                                                  begin + d_cursor,
+                                                  end,
+                                                  d_allowFormFeedAsWhitespace);
+        if (next != end) {
+            d_cursor = next - begin;
             break;
         }
 
@@ -339,7 +401,7 @@ int Tokenizer::advanceToNextToken()
         return -1;                                                    // RETURN
     }
 
-    if (d_cursor >= d_stringBuffer.size()) {
+    if (d_cursor >= bufferLength()) {
         const int numRead = reloadStringBuffer();
         if (0 == numRead) {
             d_tokenType = e_ERROR;
@@ -358,7 +420,7 @@ int Tokenizer::advanceToNextToken()
             return -1;                                                // RETURN
         }
 
-        const char  ch = d_stringBuffer[d_cursor];
+        const char  ch = bufferData()[d_cursor];
         switch (ch) {
 
           case '{': {
@@ -701,12 +763,11 @@ int Tokenizer::resetStreamBufGetPointer()
 {
     BSLS_ASSERT(d_streambuf_p);
 
-    if (d_cursor >= d_stringBuffer.size()) {
+    if (d_cursor >= bufferLength()) {
         return 0;                                                     // RETURN
     }
 
-    const int numExtraCharsRead = static_cast<int>(d_stringBuffer.size()
-                                                                   - d_cursor);
+    const int numExtraCharsRead = static_cast<int>(bufferLength() - d_cursor);
     const bsl::streamoff newPos = d_streambuf_p->pubseekoff(-numExtraCharsRead,
                                                             bsl::ios_base::cur,
                                                             bsl::ios_base::in);
@@ -724,9 +785,8 @@ int Tokenizer::value(bsl::string_view *data) const
     if ((e_ELEMENT_NAME == d_tokenType || e_ELEMENT_VALUE == d_tokenType) &&
         d_valueBegin != d_valueEnd) {
 
-        *data = bsl::string_view(d_stringBuffer).substr(
-                                                    d_valueBegin,
-                                                    d_valueEnd - d_valueBegin);
+        *data = bsl::string_view(bufferData() + d_valueBegin,
+                                 d_valueEnd - d_valueBegin);
 
         return 0;                                                     // RETURN
     }
@@ -167,6 +167,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlma_bufferedsequentialallocator.h>
 
+#include <bdlsb_fixedmeminstreambuf.h>
+
 #include <bsls_alignedbuffer.h>
 #include <bsls_assert.h>
 #include <bsls_types.h>
@@ -262,6 +264,20 @@ class Tokenizer {
 
     bsl::streambuf     *d_streambuf_p;      // streambuf (held, not owned)
 
+    bdlsb::FixedMemInStreamBuf
+                        d_contiguousStreamBuf;
+                                            // streambuf over the input
+                                            // supplied to the 'reset'
+                                            // overload taking a character
+                                            // array
+
+    const char         *d_input_p;          // contiguous input tokenized in
+                                            // place, or 0 if tokenizing
+                                            // from 'd_stringBuffer' (held,
+                                            // not owned)
+
+    bsl::size_t         d_inputLength;      // length of 'd_input_p'
+
     bsl::size_t         d_cursor;           // current cursor
 
     bsl::size_t         d_valueBegin;       // cursor for beginning of value
@@ -332,6 +348,16 @@ class Tokenizer {
     /// value otherwise.
     int extractStringValue();
 
+    /// If the held `streambuf` is `d_contiguousStreamBuf` (i.e., the input
+    /// was supplied as a character array) and has characters available,
+    /// make the available characters (or, unless
+    /// `allowNonUtf8StringLiterals` is `true`, their longest valid UTF-8
+    /// prefix) the characters being tokenized, in place, advance the get
+    /// pointer of the `streambuf` past them, and return `true`; otherwise
+    /// return `false` with no effect other than, on invalid UTF-8 at the
+    /// get pointer, loading the error status into `d_bufEndStatus`.
+    bool loadContiguousInput();
+
     /// Move the current sequence of characters being tokenized to the front
     /// of the internal string buffer, `d_stringBuffer`, and then append
     /// additional characters, from the internally-held `streambuf`
@@ -349,6 +375,24 @@ class Tokenizer {
     /// Push the specified `context` onto the `d_contextStack` stack.
     void pushContext(ContextType context);
 
+    /// Read at most the specified `length` characters from the underlying
+    /// `streambuf` into the specified `buffer`, validating them as UTF-8
+    /// unless `allowNonUtf8StringLiterals` is `true`, and update the read
+    /// offset and statuses of this tokenizer accordingly.  Return the
+    /// number of (valid) characters loaded into `buffer`.  Note that 0 is
+    /// returned once end of input or invalid UTF-8 has been reached.
+    bsl::size_t readInput(char *buffer, bsl::size_t length);
+
+    /// Read at most the specified `length` characters from the underlying
+    /// `streambuf` into the specified `buffer`, and return the length of
+    /// the longest prefix of the characters read that is valid UTF-8.  If
+    /// invalid UTF-8 is encountered, load the error status into
+    /// `d_bufEndStatus`.  The behavior is undefined unless `4 <= length`.
+    /// Note that the characters are read in bulk and then validated in a
+    /// single pass, reading at most 3 additional characters to complete a
+    /// multi-byte sequence split by the end of the bulk read.
+    bsl::size_t readValidUtf8(char *buffer, bsl::size_t length);
+
     /// Reload the string buffer with new data read from the underlying
     /// `streambuf` and overwriting the current buffer.  After reading
     /// update the cursor to the new read location.  Return the number of
@@ -367,6 +411,14 @@ class Tokenizer {
 
     // PRIVATE ACCESSOR
 
+    /// Return the address of the first of the characters currently
+    /// available for tokenizing: the contiguous input, if any, and
+    /// `d_stringBuffer` otherwise.
+    const char *bufferData() const;
+
+    /// Return the number of characters currently available for tokenizing.
+    bsl::size_t bufferLength() const;
+
     /// If the `d_contextStack` is empty, return `e_NO_CONTEXT`, otherwise
     /// return the top context from the `d_contextStack` stack without
     /// popping.
@@ -427,10 +479,26 @@ class Tokenizer {
     /// * `allowUnescapedControlCharacters`
     void reset(bsl::streambuf *streambuf);
 
+    /// Reset this tokenizer to read the specified `length` characters
+    /// starting at the specified `data`.  The characters are tokenized in
+    /// place, without being copied into an internal buffer, and the values
+    /// returned by `value` refer directly to `data`.  Note that the reader
+    /// will not be on a valid node until `advanceToNextToken` is called.
+    /// Also note that, as for the `streambuf` overload, this function does
+    /// not change the `conformanceMode` nor the values of any of the
+    /// individual token options.  The behavior is undefined unless `data`
+    /// remains valid and unmodified until this tokenizer is next `reset`
+    /// or destroyed, and `data` refers to at least `length` characters
+    /// (`data` may be 0 if `length` is 0).
+    void reset(const char *data, bsl::size_t length);
+
     /// Reset the get pointer of the `streambuf` held by this object to
     /// refer to the byte following the last processed byte, if the held
     /// `streambuf` supports seeking, and return an error otherwise leaving
-    /// this object unchanged.  Return 0 on success, and a non-zero value
+    /// this object unchanged.  Note that, if the input was supplied as a
+    /// character array, the held `streambuf` is internal to this object,
+    /// and the offset of the byte following the last processed byte is
+    /// given by `currentPosition`.  Return 0 on success, and a non-zero value
     /// otherwise.  The behavior is undefined unless `reset` has been
     /// called.  Note that after a successful function return users can read
     /// data from the `streambuf` that was specified during `reset` from
@@ -659,6 +727,18 @@ void Tokenizer::pushContext(ContextType context)
 }
 
 // PRIVATE ACCESSOR
+inline
+const char *Tokenizer::bufferData() const
+{
+    return d_input_p ? d_input_p : d_stringBuffer.data();
+}
+
+inline
+bsl::size_t Tokenizer::bufferLength() const
+{
+    return d_input_p ? d_inputLength : d_stringBuffer.length();
+}
+
 inline
 Tokenizer::ContextType Tokenizer::context() const
 {
@@ -676,6 +756,9 @@ Tokenizer::Tokenizer(bslma::Allocator *basicAllocator)
                    basicAllocator)
 , d_stringBuffer(&d_allocator)
 , d_streambuf_p(0)
+, d_contiguousStreamBuf(0, 0)
+, d_input_p(0)
+, d_inputLength(0)
 , d_cursor(0)
 , d_valueBegin(0)
 , d_valueEnd(0)
@@ -710,6 +793,8 @@ void Tokenizer::reset(bsl::streambuf *streambuf)
 {
     d_streambuf_p  = streambuf;
     d_stringBuffer.clear();
+    d_input_p      = 0;
+    d_inputLength  = 0;
     d_cursor       = 0;
     d_valueBegin   = 0;
     d_valueEnd     = 0;
@@ -723,6 +808,16 @@ void Tokenizer::reset(bsl::streambuf *streambuf)
     pushContext(e_NO_CONTEXT);
 }
 
+inline
+void Tokenizer::reset(const char *data, bsl::size_t length)
+{
+    BSLS_ASSERT(data || 0 == length);
+
+    d_contiguousStreamBuf.pubsetbuf(data,
+                                    static_cast<bsl::streamsize>(length));
+    reset(&d_contiguousStreamBuf);
+}
+
 inline
 Tokenizer& Tokenizer::setAllowConsecutiveSeparators(bool value)
 {
@@ -862,7 +957,7 @@ Tokenizer::ConformanceMode Tokenizer::conformanceMode() const
 inline
 bsls::Types::Uint64 Tokenizer::currentPosition() const
 {
-    return d_readOffset - d_stringBuffer.size() + d_cursor;
+    return d_readOffset - bufferLength() + d_cursor;
 }
 
 inline
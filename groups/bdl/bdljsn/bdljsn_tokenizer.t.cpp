@@ -25,6 +25,7 @@
 #include <bsls_asserttest.h>
 #include <bsls_keyword.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 
 #include <bsl_algorithm.h>
 #include <bsl_cfloat.h>
@@ -66,6 +67,7 @@ using bsl::endl;
 // MANIPULATORS
 // [ 9] int advanceToNextToken();
 // [10] void reset(bsl::streambuf &streamBuf);
+// [24] void reset(const char *data, bsl::size_t length);
 // [13] int resetStreamBufGetPointer();
 // [20] Tokenizer& setAllowConsecutiveSeparators(bool value);
 // [15] Tokenizer& setAllowHeterogenousArrays(bool value);
@@ -90,7 +92,7 @@ using bsl::endl;
 // [ 4] int value(bslstl::StringRef *data) const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [24] USAGE EXAMPLE
+// [25] USAGE EXAMPLE
 // [ 2] CONCERN: `advanceToNextToken` FIRST CHARACTER
 // [ 4] CONCERN: `advanceToNextToken` TO `e_START_OBJECT`
 // [ 5] CONCERN: `advanceToNextToken` TO `e_NAME`
@@ -98,6 +100,7 @@ using bsl::endl;
 // [ 7] CONCERN: `advanceToNextToken` TO `e_END_OBJECT`
 // [ 8] CONCERN: `advanceToNextToken` TO `e_START_ARRAY`
 // [ 9] CONCERN: `advanceToNextToken` TO `e_END_ARRAY`
+// [-1] PERFORMANCE: TOKENIZING THROUGHPUT
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -370,6 +373,37 @@ void confirmStreamBufReset(bsl::streambuf     *sb,
     }
 }
 
+/// Tokenize the whole of the input of the specified `tokenizer`, which has
+/// just been `reset`, validating UTF-8 if the specified `checkUtf8` is
+/// `true`, and load into the specified `tokens` a description of each token
+/// (its type, value, and the current position after it), and into the
+/// specified `readStatus` the read status of `tokenizer` after the last
+/// token.
+void tokenizeAll(bsl::vector<bsl::string> *tokens,
+                 int                      *readStatus,
+                 Obj                      *tokenizer,
+                 bool                      checkUtf8)
+{
+    tokens->clear();
+
+    tokenizer->setAllowNonUtf8StringLiterals(!checkUtf8);
+
+    while (0 == tokenizer->advanceToNextToken()) {
+        bsl::ostringstream oss;
+        oss << tokenizer->tokenType();
+
+        bsl::string_view value;
+        if (0 == tokenizer->value(&value)) {
+            oss << ':' << value;
+        }
+        oss << '@' << tokenizer->currentPosition();
+
+        tokens->push_back(oss.str());
+    }
+
+    *readStatus = tokenizer->readStatus();
+}
+
 const Utf8Util::ErrorStatus EIT = Utf8Util::k_END_OF_INPUT_TRUNCATION;
 const Utf8Util::ErrorStatus UCO = Utf8Util::k_UNEXPECTED_CONTINUATION_OCTET;
 const Utf8Util::ErrorStatus NCO = Utf8Util::k_NON_CONTINUATION_OCTET;
@@ -533,7 +567,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 24: {
+      case 25: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -665,6 +699,234 @@ int main(int argc, char *argv[])
     ASSERT(55              == address.d_floorCount);
 // ```
       } break;
+      case 24: {
+        // --------------------------------------------------------------------
+        // TESTING `reset(const char *, bsl::size_t)`
+        //
+        // Concerns:
+        // 1. Input supplied as a character array is tokenized exactly as the
+        //    same input supplied by a `streambuf`: the same tokens, values,
+        //    positions, and read status, with or without UTF-8 validation.
+        //
+        // 2. The values of the tokens of input supplied as a character array
+        //    refer directly to that array.
+        //
+        // 3. Tokenizing input supplied as a character array allocates no
+        //    memory, even for values larger than the internal buffer.
+        //
+        // 4. Input supplied by a `streambuf` is read through the `streambuf`
+        //    interface, whatever the dynamic type of the `streambuf`.
+        //
+        // 5. A tokenizer can be reset from a character array to a
+        //    `streambuf` and back.
+        //
+        // 6. QoI: Asserted precondition violations are detected when
+        //    enabled.
+        //
+        // Plan:
+        // 1. For a table of documents, including values longer than the
+        //    internal buffer, invalid UTF-8, and invalid JSON, tokenize each
+        //    document from a `bsl::stringbuf` and from a character array, and
+        //    compare the results.  (C-1)
+        //
+        // 2. Tokenize a document holding a long string from a character
+        //    array using a tokenizer supplied with a test allocator, and
+        //    verify that the string value refers to the input and that no
+        //    memory is allocated.  (C-2..3)
+        //
+        // 3. Tokenize the same document from a `bdlsb::FixedMemInStreamBuf`,
+        //    and verify that the string value does not refer to the input.
+        //    (C-4)
+        //
+        // 4. Using one tokenizer, tokenize documents alternately from a
+        //    character array and from a `streambuf`, and verify the tokens
+        //    and positions.  (C-5)
+        //
+        // 5. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for a null `data` having a non-zero `length`.  (C-6)
+        //
+        // Testing:
+        //   void reset(const char *data, bsl::size_t length);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `reset(const char *, bsl::size_t)`"
+                          << endl
+                          << "=========================================="
+                          << endl;
+
+        const bsl::string LONG_STRING(3 * 8192 + 17, 'x');
+        const bsl::string LONG_SPACE(2 * 8192 + 5, ' ');
+
+        const struct {
+            int         d_line;
+            bsl::string d_input;
+        } DATA[] = {
+            //LINE  INPUT
+            //----  -----------------------------------------------------
+            { L_,   ""                                                    },
+            { L_,   "   "                                                 },
+            { L_,   "null"                                                },
+            { L_,   " 123 "                                               },
+            { L_,   "{\"a\":\"b\",\"c\":[1,2.5,true,null]}"              },
+            { L_,   "[\"esc\\\"aped\", \"\\u00e9\"]  "                     },
+            { L_,   "{\"a\":\"\xc3\xa9\"}"                                 },
+            { L_,   "{\"a\":\"\xc3\"}"                                      },
+            { L_,   "{\"a\":\"b\" \xff}"                                    },
+            { L_,   "\xff"                                                 },
+            { L_,   "{\"a\":\"unterminated"                                },
+            { L_,   "{\"a\" 1}"                                            },
+            { L_,   "[\"" + LONG_STRING + "\"]"                            },
+            { L_,   "[" + LONG_SPACE + "1," + LONG_SPACE + "2]"           },
+            { L_,   "[1" + LONG_STRING + "]"                              },
+            { L_,   "[\"" + LONG_STRING + "\xff\"]"                        },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        if (verbose) cout << "\nCompare with `streambuf` input." << endl;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int          LINE  = DATA[ti].d_line;
+            const bsl::string& INPUT = DATA[ti].d_input;
+
+            for (int checkUtf8 = 0; checkUtf8 < 2; ++checkUtf8) {
+                if (veryVerbose) { T_ P_(LINE) P(checkUtf8) }
+
+                bsl::vector<bsl::string> expTokens;
+                int                      expStatus;
+                {
+                    bsl::stringbuf sb(INPUT);
+                    Obj            mX;
+
+                    mX.reset(&sb);
+                    tokenizeAll(&expTokens, &expStatus, &mX, checkUtf8);
+                }
+
+                bsl::vector<bsl::string> tokens;
+                int                      status;
+                {
+                    Obj mX;
+
+                    mX.reset(INPUT.data(), INPUT.length());
+                    tokenizeAll(&tokens, &status, &mX, checkUtf8);
+                }
+
+                ASSERTV(LINE, checkUtf8, expStatus, status,
+                        expStatus == status);
+                ASSERTV(LINE, checkUtf8, expTokens.size(), tokens.size(),
+                        expTokens == tokens);
+            }
+        }
+
+        if (verbose) cout << "\nValues refer to the input." << endl;
+        {
+            const bsl::string INPUT = "{\"name\":\"" + LONG_STRING + "\"}";
+
+            bslma::TestAllocator ta("tokenizer", veryVeryVeryVerbose);
+            Obj                  mX(&ta);  const Obj& X = mX;
+
+            mX.reset(INPUT.data(), INPUT.length());
+
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(Obj::e_ELEMENT_NAME == X.tokenType());
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(Obj::e_ELEMENT_VALUE == X.tokenType());
+
+            bsl::string_view value;
+            ASSERT(0 == X.value(&value));
+            ASSERTV(value.length(),
+                    LONG_STRING.length() + 2 == value.length());
+            ASSERT(INPUT.data() + 8 == value.data());
+
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(Obj::e_END_OBJECT == X.tokenType());
+            ASSERTV(X.currentPosition(),
+                    INPUT.length() == X.currentPosition());
+            ASSERT(0 != mX.advanceToNextToken());
+            ASSERTV(X.readStatus(), Obj::k_EOF == X.readStatus());
+            ASSERT(0 == mX.resetStreamBufGetPointer());
+
+            ASSERTV(ta.numBlocksTotal(), 0 == ta.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\nA `streambuf` is read as a `streambuf`."
+                          << endl;
+        {
+            const bsl::string INPUT = "{\"name\":\"value\"}";
+
+            bdlsb::FixedMemInStreamBuf sb(INPUT.data(), INPUT.length());
+            Obj                        mX;  const Obj& X = mX;
+
+            mX.reset(&sb);
+
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(Obj::e_ELEMENT_VALUE == X.tokenType());
+
+            bsl::string_view value;
+            ASSERT(0 == X.value(&value));
+            ASSERTV(value, "\"value\"" == value);
+            ASSERT(value.data() <  INPUT.data()
+                || value.data() >= INPUT.data() + INPUT.length());
+        }
+
+        if (verbose) cout << "\nAlternate between input kinds." << endl;
+        {
+            const bsl::string INPUT1 = "[1, 2]  TRAILING";
+            const bsl::string INPUT2 = "  [3]";
+
+            Obj mX;  const Obj& X = mX;
+
+            for (int ri = 0; ri < 4; ++ri) {
+                const bool         FROM_ARRAY = 0 == ri % 2;
+                const bsl::string& INPUT      = ri < 2 ? INPUT1 : INPUT2;
+
+                if (veryVerbose) { T_ P_(ri) P(FROM_ARRAY) }
+
+                bsl::stringbuf sb(INPUT);
+                if (FROM_ARRAY) {
+                    mX.reset(INPUT.data(), INPUT.length());
+                }
+                else {
+                    mX.reset(&sb);
+                }
+
+                ASSERTV(ri, 0 == mX.advanceToNextToken());
+                ASSERTV(ri, Obj::e_START_ARRAY == X.tokenType());
+
+                while (0 == mX.advanceToNextToken()
+                    && Obj::e_END_ARRAY != X.tokenType()) {
+                }
+
+                ASSERTV(ri, Obj::e_END_ARRAY == X.tokenType());
+                ASSERTV(ri, X.currentPosition(),
+                        INPUT.find(']') + 1 == X.currentPosition());
+
+                ASSERTV(ri, 0 == mX.resetStreamBufGetPointer());
+                if (!FROM_ARRAY) {
+                    const bsl::streamsize EXP = static_cast<bsl::streamsize>(
+                                         INPUT.length() - X.currentPosition());
+
+                    ASSERTV(ri, EXP, sb.in_avail(), EXP == sb.in_avail());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const char *INPUT = "[]";
+            Obj         mX;
+
+            ASSERT_PASS(mX.reset(INPUT, 2));
+            ASSERT_PASS(mX.reset(INPUT, 0));
+            ASSERT_PASS(mX.reset(0,    0));
+            ASSERT_FAIL(mX.reset(0,    1));
+        }
+      } break;
       case 23: {
         // --------------------------------------------------------------------
         // TESTING `conformanceMode`
@@ -8508,6 +8770,133 @@ int main(int argc, char *argv[])
         Obj mX;  const Obj& X = mX;
         ASSERTV(X.tokenType(), Obj::e_BEGIN == X.tokenType());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: TOKENIZING THROUGHPUT
+        //
+        // Concerns:
+        // 1. The throughput of tokenization of representative documents is
+        //    reported, in relaxed and strict conformance modes.
+        //
+        // Plan:
+        // 1. Generate documents made mostly of records (short names, strings
+        //    and numbers), of long strings having escapes, of indented
+        //    (whitespace-heavy) records, and of non-ASCII strings.  Tokenize
+        //    each document repeatedly, both from a
+        //    `bdlsb::FixedMemInStreamBuf` and in place (as a character
+        //    array), and report the throughput in MB/s.  The number of
+        //    iterations is given by the second command-line argument
+        //    (default: 100).
+        //
+        // Testing:
+        //   PERFORMANCE: TOKENIZING THROUGHPUT
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: TOKENIZING THROUGHPUT" << endl
+             << "==================================" << endl;
+
+        const int NUM_ITERATIONS = argc > 2 && atoi(argv[2]) > 0
+                                 ? atoi(argv[2])
+                                 : 100;
+
+        enum { k_NUM_RECORDS = 10000 };
+
+        bsl::string records, text, pretty, unicode;
+
+        records += '[';
+        pretty  += "[\n";
+        text    += '[';
+        unicode += '[';
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            bsl::ostringstream record;
+            record << "{\"id\":" << i
+                   << ",\"name\":\"customer " << i << "\""
+                   << ",\"balance\":" << i * 17 << "." << i % 100
+                   << ",\"active\":" << (i % 2 ? "true" : "false")
+                   << ",\"tags\":[\"retail\",\"priority\"]}";
+
+            bsl::ostringstream indented;
+            indented << "    {\n"
+                     << "        \"id\": " << i << ",\n"
+                     << "        \"name\": \"customer " << i << "\",\n"
+                     << "        \"active\": true\n"
+                     << "    }";
+
+            const char *sep = i ? "," : "";
+
+            records += sep;
+            records += record.str();
+            pretty  += i ? ",\n" : "";
+            pretty  += indented.str();
+            text    += sep;
+            text    += "\"The \\\"quick\\\" brown fox jumps over the lazy "
+                       "dog, and then keeps on running through the meadow "
+                       "until the end of a long line of text.\\n\"";
+            unicode += sep;
+            unicode += "\"\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5"
+                       "\xD1\x82 \xE4\xB8\x96\xE7\x95\x8C, caf\xC3\xA9 "
+                       "na\xC3\xAFve \xF0\x9F\x98\x80\"";
+        }
+        records += ']';
+        pretty  += "\n]";
+        text    += ']';
+        unicode += ']';
+
+        const struct {
+            const char        *d_name_p;
+            const bsl::string *d_document_p;
+        } DOCUMENTS[] = {
+            { "records", &records },
+            { "text",    &text    },
+            { "pretty",  &pretty  },
+            { "unicode", &unicode },
+        };
+        const int NUM_DOCUMENTS = sizeof DOCUMENTS / sizeof *DOCUMENTS;
+
+        for (int ti = 0; ti < NUM_DOCUMENTS; ++ti) {
+            const bsl::string& DOC = *DOCUMENTS[ti].d_document_p;
+
+            for (int mode = 0; mode < 4; ++mode) {
+                const bool strict  = mode & 1;
+                const bool inPlace = mode & 2;
+
+                bsls::Stopwatch timer;
+                bsl::size_t     numTokens = 0;
+
+                timer.start();
+                for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                    bdlsb::FixedMemInStreamBuf isb(DOC.data(), DOC.length());
+
+                    Obj mX;
+                    if (strict) {
+                        mX.setConformanceMode(Obj::e_STRICT_20240119);
+                    }
+                    if (inPlace) {
+                        mX.reset(DOC.data(), DOC.length());
+                    }
+                    else {
+                        mX.reset(&isb);
+                    }
+
+                    while (0 == mX.advanceToNextToken()) {
+                        ++numTokens;
+                    }
+                    ASSERTV(mX.readStatus(), Obj::k_EOF == mX.readStatus());
+                }
+                timer.stop();
+
+                const double megabytes = static_cast<double>(DOC.length()) *
+                                         NUM_ITERATIONS / (1024 * 1024);
+
+                cout << DOCUMENTS[ti].d_name_p
+                     << (inPlace ? " in place" : " streamed")
+                     << (strict ? " (strict):  " : " (relaxed): ")
+                     << megabytes / timer.elapsedTime() << " MB/s, "
+                     << numTokens / NUM_ITERATIONS << " tokens" << endl;
+            }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -18,6 +18,7 @@ BSLS_IDENT_RCSID(bdlmt_fixedthreadpool_cpp,"$Id$ $CSID$")
 
 #include <bsl_functional.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #if defined(BSLS_PLATFORM_OS_UNIX)
 #include <bsl_c_signal.h>              // sigfillset
@@ -152,7 +153,8 @@ void FixedThreadPool::workerThread()
     } while (d_drainFlag);
 }
 
-int FixedThreadPool::startNewThread()
+int FixedThreadPool::startNewThread(
+                                    const bslmt::ThreadAttributes& attributes)
 {
 #if defined(BSLS_PLATFORM_OS_UNIX)
     // Block all asynchronous signals.
@@ -164,7 +166,7 @@ int FixedThreadPool::startNewThread()
     bsl::function<void()> workerThreadFunc =
                   bdlf::MemFnUtil::memFn(&FixedThreadPool::workerThread, this);
 
-    int rc = d_threadGroup.addThread(workerThreadFunc, d_threadAttributes);
+    int rc = d_threadGroup.addThread(workerThreadFunc, attributes);
 
 #if defined(BSLS_PLATFORM_OS_UNIX)
     // Restore the mask.
@@ -188,6 +190,7 @@ FixedThreadPool::FixedThreadPool(
 , d_threadGroup(basicAllocator)
 , d_threadAttributes(threadAttributes, basicAllocator)
 , d_numThreads(numThreads)
+, d_workerPinningFlag(false)
 {
     BSLS_ASSERT_OPT(1 <= numThreads);
 
@@ -212,6 +215,7 @@ FixedThreadPool::FixedThreadPool(
 , d_threadGroup(basicAllocator)
 , d_threadAttributes(threadAttributes, basicAllocator)
 , d_numThreads(numThreads)
+, d_workerPinningFlag(false)
 {
     BSLS_ASSERT_OPT(1 <= numThreads);
 
@@ -232,6 +236,7 @@ FixedThreadPool::FixedThreadPool(int               numThreads,
 , d_threadGroup(basicAllocator)
 , d_threadAttributes(basicAllocator)
 , d_numThreads(numThreads)
+, d_workerPinningFlag(false)
 {
     BSLS_ASSERT_OPT(1 <= numThreads);
 
@@ -252,6 +257,7 @@ FixedThreadPool::FixedThreadPool(int                      numThreads,
 , d_threadGroup(basicAllocator)
 , d_threadAttributes(basicAllocator)
 , d_numThreads(numThreads)
+, d_workerPinningFlag(false)
 {
     BSLS_ASSERT_OPT(1 <= numThreads);
 
@@ -274,8 +280,24 @@ int FixedThreadPool::start()
         return 0;                                                     // RETURN
     }
 
+    bslma::Allocator *allocator = d_threadAttributes.allocator();
+
+    bsl::vector<int> cpus(allocator);
+    if (d_workerPinningFlag
+     && 0 != bslmt::ThreadUtil::getCpuAffinity(&cpus, d_threadAttributes)) {
+        cpus.clear();
+    }
+
+    bslmt::ThreadAttributes attributes(d_threadAttributes, allocator);
+    bsl::vector<int>        workerCpu(1, 0, allocator);
+
     for (int i = 0; i < d_numThreads; ++i)  {
-        if (0 != startNewThread()) {
+        if (!cpus.empty()) {
+            workerCpu[0] = cpus[i % cpus.size()];
+            attributes.setCpuAffinity(workerCpu);
+        }
+
+        if (0 != startNewThread(attributes)) {
             // Submit a sufficient number of arrivals to the barrier to release
             // all threads ('d_numThreads + 1');
 
@@ -70,6 +70,30 @@ BSLS_IDENT("$Id: $")
 // pool, enqueue a series of jobs to be executed, and wait until all the jobs
 // have executed.
 //
+///Processor Affinity
+///------------------
+// The `cpuAffinity` and `numaNode` attributes of the `bslmt::ThreadAttributes`
+// object supplied at construction restrict all the threads of the pool to the
+// processors listed, or to the processors of the specified NUMA node,
+// respectively.  As the queue of jobs is shared by all the threads of a pool,
+// an application keeping the processing of a set of jobs on one NUMA node
+// submits them to a pool whose `numaNode` attribute designates that node.
+//
+// In addition, a pool can be configured (see `setWorkerPinning`) to pin each
+// of its threads to a single processor when it is started, so that the
+// operating system never migrates a thread, and the caches of each processor
+// remain warm with the data of the jobs executed on it.  The threads are
+// distributed, round-robin, over the processors selected by the thread
+// attributes supplied at construction or, if none is selected, over the
+// processors on which the thread invoking `start` may execute (see
+// `bslmt::ThreadUtil::getCpuAffinity`).  The state of a thread (i.e., its
+// stack) is first touched by the thread itself, on its processor, and is
+// therefore local to the node of that processor with operating systems that
+// place memory on the node of the thread first touching it.  Note that
+// affinity is only effective on platforms supporting it (see
+// `bslmt_threadutil`), and that pinning is a poor choice when the processors
+// are shared with other busy processes.
+//
 ///Thread Safety
 ///-------------
 // The `bdlmt::FixedThreadPool` class is both *fully thread-safe* (i.e., all
@@ -423,6 +447,10 @@ class FixedThreadPool {
     const int               d_numThreads;         // number of configured
                                                   // processing threads.
 
+    bsls::AtomicBool        d_workerPinningFlag;  // `true` if the threads are
+                                                  // pinned to processors when
+                                                  // the pool is started
+
 #if defined(BSLS_PLATFORM_OS_UNIX)
     sigset_t                d_blockSet;           // set of signals to be
                                                   // blocked in managed threads
@@ -448,10 +476,10 @@ class FixedThreadPool {
     /// The main function executed by each worker thread.
     void workerThread();
 
-    /// Internal method to spawn a new processing thread and increment the
-    /// current count.  Note that this method must be called with
-    /// `d_metaMutex` locked.
-    int startNewThread();
+    /// Internal method to spawn a new processing thread having the
+    /// specified `attributes` and increment the current count.  Note that
+    /// this method must be called with `d_metaMutex` locked.
+    int startNewThread(const bslmt::ThreadAttributes& attributes);
 
   private:
     // NOT IMPLEMENTED
@@ -610,6 +638,12 @@ class FixedThreadPool {
     /// method, `false == isStarted()`.
     void shutdown();
 
+    /// Set whether the threads of this pool are pinned to processors to the
+    /// specified `value` (see {Processor Affinity}).  The new value takes
+    /// effect the next time this pool is started.  By default, threads are
+    /// not pinned.
+    void setWorkerPinning(bool value);
+
     /// Spawn threads until there are `numThreads()` processing threads.  On
     /// success, enable enqueuing and return 0.  Otherwise, join all threads
     /// (ensuring `false == isStarted()`) and return -1.  If the thread pool
@@ -654,6 +688,10 @@ class FixedThreadPool {
     /// Return the capacity of the queue used to enqueue jobs by this thread
     /// pool.
     int queueCapacity() const;
+
+    /// Return `true` if the threads of this pool are pinned to processors
+    /// when it is started, and `false` otherwise.
+    bool workerPinning() const;
 };
 
 // ============================================================================
@@ -758,6 +796,12 @@ void FixedThreadPool::shutdown()
     }
 }
 
+inline
+void FixedThreadPool::setWorkerPinning(bool value)
+{
+    d_workerPinningFlag = value;
+}
+
 inline
 void FixedThreadPool::stop()
 {
@@ -814,6 +858,12 @@ int FixedThreadPool::queueCapacity() const
     return static_cast<int>(d_queue.capacity());
 }
 
+inline
+bool FixedThreadPool::workerPinning() const
+{
+    return d_workerPinningFlag;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -15,6 +15,7 @@
 
 #include <bslmt_barrier.h>
 #include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
 #include <bslmt_testutil.h>
 #include <bslmt_threadutil.h>
 #include <bslmt_throughputbenchmark.h>
@@ -110,6 +111,8 @@ using bsl::flush;
 // [18] DRQS 167232024: `drain` FAILS TO WAIT FOR ALL JOBS TO FINISH
 // [19] CONCERN: POOL OBJECT CAN OUTLIVE USED `MetricsRegistry`
 // [20] THREAD NAMES
+// [21] void setWorkerPinning(bool value);
+// [21] bool workerPinning() const;
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -366,6 +369,27 @@ void threadNameCheckJob(void *arg)
 
 }  // close namespace THREAD_NAMES_TEST
 
+namespace PINNED_WORKERS_TEST {
+
+/// Wait on the specified `barrier`, so that, when as many such jobs as the
+/// threads of a pool are enqueued, each thread of the pool executes exactly
+/// one of them, and then append the affinity of the calling thread to the
+/// specified `affinities` under the lock of the specified `mutex`.
+void recordAffinity(bslmt::Barrier                  *barrier,
+                    bsl::vector<bsl::vector<int> >  *affinities,
+                    bslmt::Mutex                    *mutex)
+{
+    barrier->wait();
+
+    bsl::vector<int> cpus;
+    ASSERT(0 == bslmt::ThreadUtil::getCpuAffinity(&cpus));
+
+    bslmt::LockGuard<bslmt::Mutex> guard(mutex);
+    affinities->push_back(cpus);
+}
+
+}  // close namespace PINNED_WORKERS_TEST
+
 /// This function does nothing.
 void noop(void *)
 {
@@ -1114,6 +1138,154 @@ int main(int argc, char *argv[])
                                       bsl::format("case {}", test)));
 
     switch (test) { case 0:  // case 0 is always the first case
+      case 21: {
+        // --------------------------------------------------------------------
+        // TESTING PINNED WORKERS
+        //
+        // Concerns:
+        // 1. Threads are not pinned by default.
+        //
+        // 2. When pinning is requested, each thread executes on a single
+        //    processor, the threads being distributed round-robin over the
+        //    processors on which the thread invoking `start` may execute, or
+        //    over the processors of the `cpuAffinity` attribute if set.
+        //
+        // 3. Pinning takes effect at the next `start`.
+        //
+        // Plan:
+        // 1. Verify the default value of `workerPinning`.  (C-1)
+        //
+        // 2. Start pools with pinning enabled, and record the affinity of
+        //    each thread by enqueuing one job per thread, the jobs waiting on
+        //    a common barrier.  (C-2)
+        //
+        // 3. Disable pinning on a stopped pool, restart it, and verify the
+        //    threads are not restricted.  (C-3)
+        //
+        // Testing:
+        //   void setWorkerPinning(bool value);
+        //   bool workerPinning() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING PINNED WORKERS\n"
+                             "======================\n";
+
+        namespace TC = PINNED_WORKERS_TEST;
+
+        typedef bsl::vector<bsl::vector<int> > Affinities;
+
+        bsl::vector<int> allowed;
+        if (0 != bslmt::ThreadUtil::getCpuAffinity(&allowed)) {
+            if (verbose) cout << "Affinity not supported." << endl;
+            break;
+        }
+
+        const int k_NUM_THREADS = 4;
+        const int k_MAX_PENDING = 8;
+
+        const bsl::size_t k_NUM_CPUS =
+                  bsl::min(static_cast<bsl::size_t>(k_NUM_THREADS),
+                           allowed.size());
+
+        if (verbose) cout << "\nPinning to the allowed processors." << endl;
+        {
+            Obj mX(k_NUM_THREADS, k_MAX_PENDING, &testAllocator);
+            const Obj& X = mX;
+
+            ASSERT(false == X.workerPinning());
+
+            mX.setWorkerPinning(true);
+            ASSERT(true  == X.workerPinning());
+
+            for (int iteration = 0; iteration < 2; ++iteration) {
+                bslmt::Barrier barrier(k_NUM_THREADS);
+                Affinities     affinities;
+                bslmt::Mutex   mutex;
+
+                ASSERT(0 == mX.start());
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(
+                                                          &TC::recordAffinity,
+                                                          &barrier,
+                                                          &affinities,
+                                                          &mutex)));
+                }
+                mX.stop();
+
+                ASSERT(k_NUM_THREADS == static_cast<int>(affinities.size()));
+
+                bsl::set<int> cpus;
+                for (bsl::size_t i = 0; i < affinities.size(); ++i) {
+                    ASSERTV(i, affinities[i].size(),
+                            1 == affinities[i].size());
+                    ASSERT(bsl::binary_search(allowed.begin(),
+                                              allowed.end(),
+                                              affinities[i].front()));
+                    cpus.insert(affinities[i].front());
+                }
+                ASSERTV(cpus.size(), k_NUM_CPUS == cpus.size());
+            }
+
+            if (verbose) cout << "\nDisabling pinning." << endl;
+
+            mX.setWorkerPinning(false);
+            ASSERT(false == X.workerPinning());
+
+            bslmt::Barrier barrier(k_NUM_THREADS);
+            Affinities     affinities;
+            bslmt::Mutex   mutex;
+
+            ASSERT(0 == mX.start());
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(
+                                                          &TC::recordAffinity,
+                                                          &barrier,
+                                                          &affinities,
+                                                          &mutex)));
+            }
+            mX.stop();
+
+            ASSERT(k_NUM_THREADS == static_cast<int>(affinities.size()));
+            for (bsl::size_t i = 0; i < affinities.size(); ++i) {
+                ASSERTV(i, allowed == affinities[i]);
+            }
+        }
+
+        if (verbose) cout << "\nPinning to the `cpuAffinity` attribute."
+                          << endl;
+        {
+            bsl::vector<int> last(1, allowed.back());
+
+            bslmt::ThreadAttributes attributes;
+            attributes.setCpuAffinity(last);
+
+            Obj mX(attributes, k_NUM_THREADS, k_MAX_PENDING, &testAllocator);
+
+            mX.setWorkerPinning(true);
+
+            bslmt::Barrier barrier(k_NUM_THREADS);
+            Affinities     affinities;
+            bslmt::Mutex   mutex;
+
+            ASSERT(0 == mX.start());
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(
+                                                          &TC::recordAffinity,
+                                                          &barrier,
+                                                          &affinities,
+                                                          &mutex)));
+            }
+            mX.drain();
+            mX.shutdown();
+
+            ASSERT(k_NUM_THREADS == static_cast<int>(affinities.size()));
+            for (bsl::size_t i = 0; i < affinities.size(); ++i) {
+                ASSERTV(i, last == affinities[i]);
+            }
+        }
+
+        ASSERT(0 == testAllocator.numBlocksInUse());
+      } break;
       case 20: {
         // --------------------------------------------------------------------
         // TESTING THREAD NAMES
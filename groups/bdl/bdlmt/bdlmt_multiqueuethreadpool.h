@@ -70,6 +70,21 @@ BSLS_IDENT("$Id: $")
 // encouraged to use benchmarks to guide their decision when setting this
 // option.
 //
+///Processor Affinity
+///------------------
+// The `cpuAffinity` and `numaNode` attributes of the `bslmt::ThreadAttributes`
+// object supplied at construction restrict all the threads of the
+// `bdlmt::ThreadPool` created by a `bdlmt::MultiQueueThreadPool` to the
+// processors listed, or to the processors of the specified NUMA node,
+// respectively.  As the jobs of a queue may be executed by any thread of the
+// pool, an application keeping the processing of a queue on one NUMA node
+// creates one multi-queue thread pool per node, each having the `numaNode`
+// attribute designating its node, and creates the queue in the pool of that
+// node.  The threads of a multi-queue thread pool are not pinned to individual
+// processors, as the underlying `bdlmt::ThreadPool` creates and destroys them
+// as the load varies, and no queue is bound to a thread (see
+// `bdlmt::FixedThreadPool` for a pool whose threads can be pinned).
+//
 ///Thread Names for Sub-Threads
 ///----------------------------
 // To facilitate debugging, users can provide a thread name as the `threadName`
@@ -13,6 +13,7 @@
 
 #include <bslmt_barrier.h>
 #include <bslmt_latch.h>
+#include <bslmt_lockguard.h>
 #include <bslmt_mutex.h>
 #include <bslmt_semaphore.h>
 #include <bslmt_testutil.h>
@@ -126,7 +127,8 @@ using namespace BloombergLP;
 // [34] DRQS 176332566: external threadpool shutdown race
 // [35] MOVING JOBS
 // [36] DRQS 176750534: destroy each job before starting the next
-// [37] USAGE EXAMPLE 1
+// [37] PROCESSOR AFFINITY
+// [38] USAGE EXAMPLE 1
 // [-2] PERFORMANCE TEST
 // ----------------------------------------------------------------------------
 
@@ -1807,6 +1809,22 @@ struct DoNothing {
     void operator()() const {}
 };
 
+namespace PROCESSOR_AFFINITY_TEST {
+
+/// Append the affinity of the calling thread to the specified `affinities`
+/// under the lock of the specified `mutex`.
+void recordAffinity(bsl::vector<bsl::vector<int> > *affinities,
+                    bslmt::Mutex                   *mutex)
+{
+    bsl::vector<int> cpus;
+    ASSERT(0 == bslmt::ThreadUtil::getCpuAffinity(&cpus));
+
+    bslmt::LockGuard<bslmt::Mutex> guard(mutex);
+    affinities->push_back(cpus);
+}
+
+}  // close namespace PROCESSOR_AFFINITY_TEST
+
 // ============================================================================
 //                              MAIN PROGRAM
 
@@ -1828,7 +1846,7 @@ int main(int argc, char *argv[]) {
                                       bsl::format("case {}", test)));
 
     switch (test) { case 0:
-      case 37: {
+      case 38: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 1
         //
@@ -1909,6 +1927,105 @@ int main(int argc, char *argv[]) {
         ASSERT(0 <  ta.numAllocations());
         ASSERT(0 == ta.numBytesInUse());
       } break;
+      case 37: {
+        // --------------------------------------------------------------------
+        // PROCESSOR AFFINITY
+        //
+        // Concerns:
+        // 1. The `cpuAffinity` attribute of the thread attributes supplied at
+        //    construction restricts the threads executing the jobs of every
+        //    queue to the specified processors.
+        //
+        // 2. The `numaNode` attribute of those thread attributes restricts
+        //    these threads to the processors of the specified node.
+        //
+        // Plan:
+        // 1. Create pools with each attribute set, enqueue jobs recording the
+        //    affinity of the executing thread to several queues, and verify
+        //    the recorded affinities.  (C-1..2)
+        //
+        // Testing:
+        //   PROCESSOR AFFINITY
+        // --------------------------------------------------------------------
+
+        if (verbose) {
+            cout << "PROCESSOR AFFINITY" << endl
+                 << "==================" << endl;
+        }
+
+        namespace TC = PROCESSOR_AFFINITY_TEST;
+
+        typedef bsl::vector<bsl::vector<int> > Affinities;
+
+        bsl::vector<int> allowed;
+        if (0 != bslmt::ThreadUtil::getCpuAffinity(&allowed)) {
+            if (verbose) cout << "Affinity not supported." << endl;
+            break;
+        }
+
+        bsl::vector<int> nodeCpus;
+        ASSERT(0 == bslmt::ThreadUtil::getNumaNodeCpus(&nodeCpus, 0));
+
+        const int k_NUM_QUEUES = 4;
+        const int k_NUM_JOBS   = 8;
+
+        for (int mode = 0; mode < 2; ++mode) {
+            bslmt::ThreadAttributes attributes;
+            bsl::vector<int>        expected(1, allowed.back());
+
+            if (0 == mode) {
+                if (verbose) cout << "\nTesting `cpuAffinity`." << endl;
+
+                attributes.setCpuAffinity(expected);
+            }
+            else {
+                if (verbose) cout << "\nTesting `numaNode`." << endl;
+
+                attributes.setNumaNode(0);
+                expected = nodeCpus;
+            }
+
+            Affinities   affinities;
+            bslmt::Mutex mutex;
+            {
+                Obj mX(attributes, 2, 4, 1000, &ta);
+
+                ASSERT(0 == mX.start());
+
+                for (int i = 0; i < k_NUM_QUEUES; ++i) {
+                    const int id = mX.createQueue();
+                    ASSERT(0 != id);
+
+                    for (int j = 0; j < k_NUM_JOBS; ++j) {
+                        ASSERT(0 == mX.enqueueJob(
+                                          id,
+                                          bdlf::BindUtil::bind(
+                                                          &TC::recordAffinity,
+                                                          &affinities,
+                                                          &mutex)));
+                    }
+                }
+
+                mX.drain();
+                mX.stop();
+            }
+
+            ASSERT(k_NUM_QUEUES * k_NUM_JOBS ==
+                                          static_cast<int>(affinities.size()));
+
+            // The affinity of the threads may be further restricted, e.g., by
+            // the cpuset of the process.
+
+            for (bsl::size_t i = 0; i < affinities.size(); ++i) {
+                ASSERTV(mode, i, !affinities[i].empty());
+                ASSERTV(mode, i, bsl::includes(expected.begin(),
+                                               expected.end(),
+                                               affinities[i].begin(),
+                                               affinities[i].end()));
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
       case 36: {
         // --------------------------------------------------------------------
         // DRQS 176750534: destroy each job before starting the next
@@ -0,0 +1,138 @@
+// bdlmt_parallelutil.cpp                                             -*-C++-*-
+#include <bdlmt_parallelutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_parallelutil_cpp,"$Id$ $CSID$")
+
+#include <bslmt_lockguard.h>
+
+namespace BloombergLP {
+namespace bdlmt {
+
+namespace {
+
+/// The number of chunks per participating thread into which a range is
+/// divided.  Having more chunks than threads balances the load when the
+/// cost of processing the elements varies, or when not all threads of the
+/// pool are available.
+const bsl::size_t k_CHUNKS_PER_THREAD = 8;
+
+}  // close unnamed namespace
+
+                       // ----------------------------
+                       // class ParallelUtil_Operation
+                       // ----------------------------
+
+// CLASS METHODS
+void ParallelUtil_Operation::help(
+                   const bsl::shared_ptr<ParallelUtil_Operation>& operation)
+{
+    operation->work();
+}
+
+// CREATORS
+ParallelUtil_Operation::ParallelUtil_Operation(
+                                      bsl::size_t           numChunks,
+                                      const ChunkFunction&  chunkFunction,
+                                      bslma::Allocator     *basicAllocator)
+: d_mutex()
+, d_condition()
+, d_ranges(basicAllocator)
+, d_numOutstanding(1)
+, d_chunkFunction_p(&chunkFunction)
+{
+    BSLS_ASSERT(0 < numChunks);
+
+    d_ranges.push_back(Range(0, numChunks));
+}
+
+// MANIPULATORS
+void ParallelUtil_Operation::wait()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    while (0 != d_numOutstanding) {
+        d_condition.wait(&d_mutex);
+    }
+}
+
+void ParallelUtil_Operation::work()
+{
+    while (true) {
+        Range range;
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            if (d_ranges.empty()) {
+                return;                                               // RETURN
+            }
+
+            // Take the oldest, hence largest, range, leaving the smaller
+            // ones to be split further by their owners.
+
+            range = d_ranges.front();
+            d_ranges.pop_front();
+        }
+
+        // Fork: make the upper half available until a single chunk remains.
+
+        while (range.second - range.first > 1) {
+            const bsl::size_t middle =
+                            range.first + (range.second - range.first) / 2;
+            {
+                bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+                d_ranges.push_back(Range(middle, range.second));
+                ++d_numOutstanding;
+            }
+            range.second = middle;
+        }
+
+        (*d_chunkFunction_p)(range.first);
+
+        // Join: signal the waiting thread when the last chunk completes.
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        if (0 == --d_numOutstanding) {
+            d_condition.broadcast();
+        }
+    }
+}
+
+                         // -----------------------
+                         // struct ParallelUtil_Imp
+                         // -----------------------
+
+// CLASS METHODS
+bsl::size_t ParallelUtil_Imp::chunkLength(bsl::size_t length,
+                                          int         concurrency)
+{
+    BSLS_ASSERT(0 < length);
+
+    const bsl::size_t numThreads = concurrency > 0
+                                 ? static_cast<bsl::size_t>(concurrency) + 1
+                                 : 1;
+    const bsl::size_t numChunks  = numThreads * k_CHUNKS_PER_THREAD;
+
+    return (length + numChunks - 1) / numChunks;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1090 @@
+// bdlmt_parallelutil.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLMT_PARALLELUTIL
+#define INCLUDED_BDLMT_PARALLELUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide parallel algorithms executing on a thread pool.
+//
+//@CLASSES:
+//  bdlmt::ParallelUtil: namespace for parallel `forEach`, `transform`, etc.
+//
+//@SEE_ALSO: bdlmt_fixedthreadpool, bdlmt_threadpool,
+//           bdlmt_workstealingthreadpool
+//
+//@DESCRIPTION: This component provides a `struct`, `bdlmt::ParallelUtil`,
+// that serves as a namespace for parallel versions of common algorithms on
+// random-access ranges -- `forEach`, `transform`, `reduce`, and `sort` --
+// that divide the work among the threads of an existing thread pool, which
+// may be a `bdlmt::FixedThreadPool`, a `bdlmt::ThreadPool`, or a
+// `bdlmt::WorkStealingThreadPool`.
+//
+///Execution Model
+///---------------
+// Each algorithm divides its range into a number of contiguous "chunks" of
+// approximately equal length, the number of chunks being a small multiple of
+// the number of threads of the pool (and no more than the number of
+// elements).  The chunks are then processed using recursive fork-join: the
+// range of chunks is recursively split in halves, one half being made
+// available to the other participating threads, and the other half being
+// split further, until a single chunk remains, which is processed.
+//
+// The calling thread participates in the computation, and a number of
+// "helper" jobs, one fewer than the number of chunks but no more than the
+// number of threads of the pool, are enqueued onto the pool, each helper
+// processing halves made available until none remain.  The calling thread
+// then blocks until the chunks being processed by the helpers are complete.
+// Since a thread blocks only once no unprocessed chunk remains, a parallel
+// algorithm can be invoked from a job executing on the same pool (e.g., to
+// implement nested parallelism) without deadlock: if no thread of the pool is
+// available, the calling thread processes every chunk itself.  Similarly, if
+// the pool is not started, or is disabled, the calling thread processes every
+// chunk.
+//
+// `sort` sorts each chunk independently, and then merges adjacent sorted runs
+// pairwise, in parallel, until a single run remains; each round of merges
+// completes before the next starts.  The merges use a temporary buffer, the
+// size of the range, whose memory is supplied by the optionally specified
+// allocator, as is all other temporary memory used by the algorithms, except
+// for the small object shared with the helper jobs: since a helper may be
+// dequeued by the pool after the algorithm has returned (finding no work
+// left), that object is supplied by the currently installed default
+// allocator.
+//
+///Requirements on Functors
+///------------------------
+// The functors supplied to the algorithms are invoked concurrently, from
+// several threads, on different elements, and must therefore be safe to
+// invoke concurrently.  The functors must not throw exceptions.  The order in
+// which the elements are visited is unspecified.  The binary operation
+// supplied to `reduce` must be associative; it is applied to the elements in
+// an unspecified grouping, but the order of the operands is preserved (i.e.,
+// the operation need not be commutative).
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recomputing and Summing Values in Parallel
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a large collection of positions and want to compute the
+// value of each of them, and then the total value, using all the threads of
+// a pool.
+//
+// First, we define the positions and a function object valuing one:
+// ```
+//  struct Position {
+//      double d_quantity;
+//      double d_price;
+//  };
+//
+//  struct ValuePosition {
+//      double operator()(const Position& position) const
+//      {
+//          return position.d_quantity * position.d_price;
+//      }
+//  };
+// ```
+// Then, we create and start a thread pool:
+// ```
+//  bdlmt::FixedThreadPool pool(4, 100);
+//  int rc = pool.start();
+//  assert(0 == rc);
+// ```
+// Next, we create the positions:
+// ```
+//  bsl::vector<Position> positions(100000);
+//  for (bsl::size_t i = 0; i < positions.size(); ++i) {
+//      positions[i].d_quantity = static_cast<double>(i % 10);
+//      positions[i].d_price    = 2.0;
+//  }
+// ```
+// Now, we compute the value of each position in parallel, and sum the values
+// in parallel:
+// ```
+//  bsl::vector<double> values(positions.size());
+//
+//  bdlmt::ParallelUtil::transform(&pool,
+//                                 positions.begin(),
+//                                 positions.end(),
+//                                 values.begin(),
+//                                 ValuePosition());
+//
+//  double total = bdlmt::ParallelUtil::reduce(&pool,
+//                                             values.begin(),
+//                                             values.end(),
+//                                             0.0,
+//                                             bsl::plus<double>());
+//  assert(900000.0 == total);
+// ```
+// Finally, we sort the values in parallel:
+// ```
+//  bdlmt::ParallelUtil::sort(&pool, values.begin(), values.end());
+//  assert(0.0  == values.front());
+//  assert(18.0 == values.back());
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdlmt_fixedthreadpool.h>
+#include <bdlmt_threadpool.h>
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_deque.h>
+#include <bsl_functional.h>
+#include <bsl_iterator.h>
+#include <bsl_memory.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlmt {
+
+                       // ============================
+                       // class ParallelUtil_Operation
+                       // ============================
+
+/// This component-private class implements the state, shared by the
+/// calling thread and the helper jobs, of a parallel operation processing a
+/// number of chunks by recursive fork-join.  See {Execution Model}.
+class ParallelUtil_Operation {
+
+  public:
+    // TYPES
+
+    /// The type of the function processing the chunk having the specified
+    /// index.
+    typedef bsl::function<void(bsl::size_t)> ChunkFunction;
+
+  private:
+    // PRIVATE TYPES
+    typedef bsl::pair<bsl::size_t, bsl::size_t> Range;
+
+    // DATA
+    bslmt::Mutex         d_mutex;             // protects the data below
+
+    bslmt::Condition     d_condition;         // signaled when the last range
+                                              // completes
+
+    bsl::deque<Range>    d_ranges;            // ranges of chunk indices made
+                                              // available and not yet taken
+
+    bsl::size_t          d_numOutstanding;    // number of ranges made
+                                              // available and not yet
+                                              // completed
+
+    const ChunkFunction *d_chunkFunction_p;   // function processing a chunk
+                                              // (held, not owned)
+
+    // NOT IMPLEMENTED
+    ParallelUtil_Operation(const ParallelUtil_Operation&);
+    ParallelUtil_Operation& operator=(const ParallelUtil_Operation&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ParallelUtil_Operation,
+                                   bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+
+    /// Invoke `work` on the specified `operation`.  Note that this function
+    /// is the body of the helper jobs, which share ownership of the
+    /// operation so that a helper executing after the operation has
+    /// completed has no effect.
+    static void help(
+                  const bsl::shared_ptr<ParallelUtil_Operation>& operation);
+
+    // CREATORS
+
+    /// Create an operation processing, using the specified
+    /// `chunkFunction`, the chunks having indices in `[0 .. numChunks)`.
+    /// Optionally specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.  The behavior is undefined unless `chunkFunction` remains valid
+    /// until `wait` returns.
+    ParallelUtil_Operation(bsl::size_t           numChunks,
+                           const ChunkFunction&  chunkFunction,
+                           bslma::Allocator     *basicAllocator = 0);
+
+    // MANIPULATORS
+
+    /// Block until every chunk has been processed.
+    void wait();
+
+    /// Take available ranges of chunks, splitting each, making one half
+    /// available and processing the other, until a single chunk remains,
+    /// which is then processed, until no range is available.
+    void work();
+};
+
+                         // =======================
+                         // struct ParallelUtil_Imp
+                         // =======================
+
+/// This component-private `struct` provides a namespace for utility
+/// functions used in the implementation of `ParallelUtil`.
+struct ParallelUtil_Imp {
+
+    // CLASS METHODS
+
+    /// Return the maximum number of threads of the specified `pool`.
+    static int concurrency(const FixedThreadPool&        pool);
+    static int concurrency(const ThreadPool&             pool);
+    static int concurrency(const WorkStealingThreadPool& pool);
+
+    /// Return the length of the chunks into which a range of the specified
+    /// `length` is divided for processing by the specified `concurrency`
+    /// number of threads.  The behavior is undefined unless `0 < length`.
+    static bsl::size_t chunkLength(bsl::size_t length, int concurrency);
+
+    /// Process, using the specified `chunkFunction`, the chunks having
+    /// indices in `[0 .. numChunks)` on the specified `pool` and the calling
+    /// thread.  See {Execution Model}.  Note that the state shared with the
+    /// helper jobs is allocated from the currently installed default
+    /// allocator, since a helper may be dequeued after this function
+    /// returns.
+    template <class POOL>
+    static void forEachChunk(
+                  POOL                                         *pool,
+                  bsl::size_t                                   numChunks,
+                  const ParallelUtil_Operation::ChunkFunction&  chunkFunction);
+};
+
+                     // ==================================
+                     // class ParallelUtil_ForEachFunction
+                     // ==================================
+
+/// This component-private class template provides a function object
+/// applying a function object of (template parameter) `FUNCTION` type to
+/// each element of a chunk of a range of (template parameter) `ITERATOR`
+/// type.
+template <class ITERATOR, class FUNCTION>
+class ParallelUtil_ForEachFunction {
+
+    // DATA
+    ITERATOR     d_first;         // beginning of the range
+    bsl::size_t  d_length;        // length of the range
+    bsl::size_t  d_chunkLength;   // length of a chunk
+    FUNCTION    *d_function_p;    // function to apply (held, not owned)
+
+  public:
+    // CREATORS
+
+    /// Create a function object applying the specified `function` to the
+    /// elements of the chunks, of the specified `chunkLength`, of the range
+    /// starting at the specified `first` and having the specified `length`.
+    ParallelUtil_ForEachFunction(ITERATOR     first,
+                                 bsl::size_t  length,
+                                 bsl::size_t  chunkLength,
+                                 FUNCTION    *function);
+
+    // ACCESSORS
+
+    /// Apply the function to each element of the chunk having the specified
+    /// `chunk` index.
+    void operator()(bsl::size_t chunk) const;
+};
+
+                    // ====================================
+                    // class ParallelUtil_TransformFunction
+                    // ====================================
+
+/// This component-private class template provides a function object
+/// storing the result of applying a function object of (template parameter)
+/// `FUNCTION` type to each element of a chunk of a range of (template
+/// parameter) `INPUT_ITERATOR` type at the corresponding position of a
+/// range of (template parameter) `OUTPUT_ITERATOR` type.
+template <class INPUT_ITERATOR, class OUTPUT_ITERATOR, class FUNCTION>
+class ParallelUtil_TransformFunction {
+
+    // DATA
+    INPUT_ITERATOR   d_first;         // beginning of the input range
+    OUTPUT_ITERATOR  d_result;        // beginning of the output range
+    bsl::size_t      d_length;        // length of the ranges
+    bsl::size_t      d_chunkLength;   // length of a chunk
+    FUNCTION        *d_function_p;    // function to apply (held, not owned)
+
+  public:
+    // CREATORS
+
+    /// Create a function object storing at the corresponding position of
+    /// the range starting at the specified `result` the result of applying
+    /// the specified `function` to the elements of the chunks, of the
+    /// specified `chunkLength`, of the range starting at the specified
+    /// `first` and having the specified `length`.
+    ParallelUtil_TransformFunction(INPUT_ITERATOR   first,
+                                   OUTPUT_ITERATOR  result,
+                                   bsl::size_t      length,
+                                   bsl::size_t      chunkLength,
+                                   FUNCTION        *function);
+
+    // ACCESSORS
+
+    /// Transform the elements of the chunk having the specified `chunk`
+    /// index.
+    void operator()(bsl::size_t chunk) const;
+};
+
+                     // =================================
+                     // class ParallelUtil_ReduceFunction
+                     // =================================
+
+/// This component-private class template provides a function object
+/// storing the reduction, using a binary operation of (template parameter)
+/// `OPERATION` type, of the elements of a chunk of a range of (template
+/// parameter) `ITERATOR` type into an element of an array of (template
+/// parameter) `TYPE`.
+template <class ITERATOR, class TYPE, class OPERATION>
+class ParallelUtil_ReduceFunction {
+
+    // DATA
+    ITERATOR     d_first;         // beginning of the range
+    bsl::size_t  d_length;        // length of the range
+    bsl::size_t  d_chunkLength;   // length of a chunk
+    TYPE        *d_results_p;     // result of each chunk (held, not owned)
+    OPERATION   *d_operation_p;   // operation (held, not owned)
+
+  public:
+    // CREATORS
+
+    /// Create a function object storing into the element of the specified
+    /// `results` array corresponding to a chunk, of the specified
+    /// `chunkLength`, of the range starting at the specified `first` and
+    /// having the specified `length`, the reduction of the elements of
+    /// that chunk using the specified `operation`.
+    ParallelUtil_ReduceFunction(ITERATOR     first,
+                                bsl::size_t  length,
+                                bsl::size_t  chunkLength,
+                                TYPE        *results,
+                                OPERATION   *operation);
+
+    // ACCESSORS
+
+    /// Reduce the elements of the chunk having the specified `chunk` index.
+    void operator()(bsl::size_t chunk) const;
+};
+
+                      // ===============================
+                      // class ParallelUtil_SortFunction
+                      // ===============================
+
+/// This component-private class template provides a function object
+/// sorting, using a comparator of (template parameter) `COMPARATOR` type,
+/// a chunk of a range of (template parameter) `ITERATOR` type.
+template <class ITERATOR, class COMPARATOR>
+class ParallelUtil_SortFunction {
+
+    // DATA
+    ITERATOR     d_first;         // beginning of the range
+    bsl::size_t  d_length;        // length of the range
+    bsl::size_t  d_chunkLength;   // length of a chunk
+    COMPARATOR  *d_comparator_p;  // comparator (held, not owned)
+
+  public:
+    // CREATORS
+
+    /// Create a function object sorting, using the specified `comparator`,
+    /// the chunks, of the specified `chunkLength`, of the range starting at
+    /// the specified `first` and having the specified `length`.
+    ParallelUtil_SortFunction(ITERATOR     first,
+                              bsl::size_t  length,
+                              bsl::size_t  chunkLength,
+                              COMPARATOR  *comparator);
+
+    // ACCESSORS
+
+    /// Sort the chunk having the specified `chunk` index.
+    void operator()(bsl::size_t chunk) const;
+};
+
+                      // ================================
+                      // class ParallelUtil_MergeFunction
+                      // ================================
+
+/// This component-private class template provides a function object
+/// merging, using a comparator of (template parameter) `COMPARATOR` type,
+/// a pair of adjacent sorted runs of a range of (template parameter)
+/// `SOURCE_ITERATOR` type into the corresponding positions of a range of
+/// (template parameter) `DESTINATION_ITERATOR` type, moving the elements.
+template <class SOURCE_ITERATOR, class DESTINATION_ITERATOR, class COMPARATOR>
+class ParallelUtil_MergeFunction {
+
+    // DATA
+    SOURCE_ITERATOR       d_source;       // beginning of the source range
+    DESTINATION_ITERATOR  d_destination;  // beginning of the destination
+    bsl::size_t           d_length;       // length of the ranges
+    bsl::size_t           d_runLength;    // length of a sorted run
+    COMPARATOR           *d_comparator_p; // comparator (held, not owned)
+
+  public:
+    // CREATORS
+
+    /// Create a function object merging, using the specified `comparator`,
+    /// pairs of adjacent sorted runs, of the specified `runLength`, of the
+    /// range starting at the specified `source` and having the specified
+    /// `length` into the corresponding positions of the range starting at
+    /// the specified `destination`.
+    ParallelUtil_MergeFunction(SOURCE_ITERATOR       source,
+                               DESTINATION_ITERATOR  destination,
+                               bsl::size_t           length,
+                               bsl::size_t           runLength,
+                               COMPARATOR           *comparator);
+
+    // ACCESSORS
+
+    /// Merge the pair of runs having the specified `pair` index.
+    void operator()(bsl::size_t pair) const;
+};
+
+                            // ===================
+                            // struct ParallelUtil
+                            // ===================
+
+/// This `struct` provides a namespace for parallel algorithms executing on
+/// a thread pool.  In each function, the (template parameter) `POOL` type
+/// must be `bdlmt::FixedThreadPool`, `bdlmt::ThreadPool`, or
+/// `bdlmt::WorkStealingThreadPool`, and the iterators must be random-access
+/// iterators.  See {Execution Model} and {Requirements on Functors}.
+struct ParallelUtil {
+
+    // CLASS METHODS
+
+    /// Apply the specified `function` to each element of the range
+    /// `[first .. last)`, using the threads of the specified `pool` and the
+    /// calling thread.  Optionally specify an `allocator` used to supply
+    /// temporary memory.  If `allocator` is 0, the currently installed
+    /// default allocator is used.  The behavior is undefined unless
+    /// `[first .. last)` is a valid range.
+    template <class POOL, class RANDOM_ITERATOR, class FUNCTION>
+    static void forEach(POOL             *pool,
+                        RANDOM_ITERATOR   first,
+                        RANDOM_ITERATOR   last,
+                        FUNCTION          function,
+                        bslma::Allocator *allocator = 0);
+
+    /// Return the result of the reduction of the elements of the range
+    /// `[first .. last)`, and of the specified `init` value, using the
+    /// specified associative binary `operation`, i.e., a value equal to
+    /// `operation(...operation(operation(init, *first), *(first + 1))...)`
+    /// up to the associativity of `operation`, using the threads of the
+    /// specified `pool` and the calling thread.  Optionally specify an
+    /// `allocator` used to supply temporary memory.  If `allocator` is 0,
+    /// the currently installed default allocator is used.  The behavior is
+    /// undefined unless `[first .. last)` is a valid range.
+    template <class POOL, class RANDOM_ITERATOR, class TYPE, class OPERATION>
+    static TYPE reduce(POOL             *pool,
+                       RANDOM_ITERATOR   first,
+                       RANDOM_ITERATOR   last,
+                       TYPE              init,
+                       OPERATION         operation,
+                       bslma::Allocator *allocator = 0);
+
+    /// Sort the elements of the range `[first .. last)` in non-descending
+    /// order, using `operator<` or the optionally specified `comparator`,
+    /// using the threads of the specified `pool` and the calling thread.
+    /// Optionally specify an `allocator` used to supply temporary memory,
+    /// including a buffer of `last - first` elements.  If `allocator` is 0,
+    /// the currently installed default allocator is used.  The behavior is
+    /// undefined unless `[first .. last)` is a valid range.  Note that the
+    /// sort is not stable, and that the overload taking a comparator does
+    /// not participate in overload resolution if `COMPARATOR` is convertible
+    /// to `bslma::Allocator *`.
+    template <class POOL, class RANDOM_ITERATOR>
+    static void sort(POOL             *pool,
+                     RANDOM_ITERATOR   first,
+                     RANDOM_ITERATOR   last,
+                     bslma::Allocator *allocator = 0);
+    template <class POOL, class RANDOM_ITERATOR, class COMPARATOR>
+    static typename bsl::enable_if<
+        !bsl::is_convertible<COMPARATOR, bslma::Allocator *>::value>::type
+    sort(POOL             *pool,
+         RANDOM_ITERATOR   first,
+         RANDOM_ITERATOR   last,
+         COMPARATOR        comparator,
+         bslma::Allocator *allocator = 0);
+
+    /// Store into each position of the range starting at the specified
+    /// `result` the result of applying the specified `function` to the
+    /// corresponding element of the range `[first .. last)`, using the
+    /// threads of the specified `pool` and the calling thread, and return
+    /// an iterator to the position following the last element stored.
+    /// Optionally specify an `allocator` used to supply temporary memory.
+    /// If `allocator` is 0, the currently installed default allocator is
+    /// used.  The behavior is undefined unless `[first .. last)` is a valid
+    /// range, and the range starting at `result` has at least
+    /// `last - first` elements.  Note that the ranges may be the same, but
+    /// must not otherwise overlap.
+    template <class POOL,
+              class RANDOM_ITERATOR,
+              class RANDOM_OUTPUT_ITERATOR,
+              class FUNCTION>
+    static RANDOM_OUTPUT_ITERATOR transform(
+                                       POOL                   *pool,
+                                       RANDOM_ITERATOR         first,
+                                       RANDOM_ITERATOR         last,
+                                       RANDOM_OUTPUT_ITERATOR  result,
+                                       FUNCTION                function,
+                                       bslma::Allocator       *allocator = 0);
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                         // -----------------------
+                         // struct ParallelUtil_Imp
+                         // -----------------------
+
+// CLASS METHODS
+inline
+int ParallelUtil_Imp::concurrency(const FixedThreadPool& pool)
+{
+    return pool.numThreads();
+}
+
+inline
+int ParallelUtil_Imp::concurrency(const ThreadPool& pool)
+{
+    return pool.maxThreads();
+}
+
+inline
+int ParallelUtil_Imp::concurrency(const WorkStealingThreadPool& pool)
+{
+    return pool.numThreads();
+}
+
+template <class POOL>
+void ParallelUtil_Imp::forEachChunk(
+                  POOL                                         *pool,
+                  bsl::size_t                                   numChunks,
+                  const ParallelUtil_Operation::ChunkFunction&  chunkFunction)
+{
+    BSLS_ASSERT(pool);
+
+    if (numChunks <= 1) {
+        if (1 == numChunks) {
+            chunkFunction(0);
+        }
+        return;                                                       // RETURN
+    }
+
+    bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+
+    bsl::shared_ptr<ParallelUtil_Operation> operation(
+                    new (*allocator) ParallelUtil_Operation(numChunks,
+                                                            chunkFunction,
+                                                            allocator),
+                    allocator);
+
+    // Enqueue the helpers.  A helper that cannot be enqueued (e.g., if the
+    // pool is disabled) is omitted: its share of the work is done by the
+    // other participants.
+
+    bsl::size_t numHelpers = static_cast<bsl::size_t>(concurrency(*pool));
+    if (numHelpers > numChunks - 1) {
+        numHelpers = numChunks - 1;
+    }
+
+    for (bsl::size_t i = 0; i < numHelpers; ++i) {
+        typename POOL::Job job(bsl::allocator_arg,
+                               allocator,
+                               bdlf::BindUtil::bindS(
+                                               allocator,
+                                               &ParallelUtil_Operation::help,
+                                               operation));
+        if (0 != pool->enqueueJob(bslmf::MovableRefUtil::move(job))) {
+            break;
+        }
+    }
+
+    operation->work();
+    operation->wait();
+}
+
+                     // ----------------------------------
+                     // class ParallelUtil_ForEachFunction
+                     // ----------------------------------
+
+// CREATORS
+template <class ITERATOR, class FUNCTION>
+inline
+ParallelUtil_ForEachFunction<ITERATOR, FUNCTION>::ParallelUtil_ForEachFunction(
+                                                  ITERATOR     first,
+                                                  bsl::size_t  length,
+                                                  bsl::size_t  chunkLength,
+                                                  FUNCTION    *function)
+: d_first(first)
+, d_length(length)
+, d_chunkLength(chunkLength)
+, d_function_p(function)
+{
+}
+
+// ACCESSORS
+template <class ITERATOR, class FUNCTION>
+void ParallelUtil_ForEachFunction<ITERATOR, FUNCTION>::operator()(
+                                                       bsl::size_t chunk) const
+{
+    const bsl::size_t begin = chunk * d_chunkLength;
+    const bsl::size_t end   = bsl::min(begin + d_chunkLength, d_length);
+
+    ITERATOR it = d_first;
+    bsl::advance(it, begin);
+    for (bsl::size_t i = begin; i < end; ++i, ++it) {
+        (*d_function_p)(*it);
+    }
+}
+
+                    // ------------------------------------
+                    // class ParallelUtil_TransformFunction
+                    // ------------------------------------
+
+// CREATORS
+template <class INPUT_ITERATOR, class OUTPUT_ITERATOR, class FUNCTION>
+inline
+ParallelUtil_TransformFunction<INPUT_ITERATOR, OUTPUT_ITERATOR, FUNCTION>::
+ParallelUtil_TransformFunction(INPUT_ITERATOR   first,
+                               OUTPUT_ITERATOR  result,
+                               bsl::size_t      length,
+                               bsl::size_t      chunkLength,
+                               FUNCTION        *function)
+: d_first(first)
+, d_result(result)
+, d_length(length)
+, d_chunkLength(chunkLength)
+, d_function_p(function)
+{
+}
+
+// ACCESSORS
+template <class INPUT_ITERATOR, class OUTPUT_ITERATOR, class FUNCTION>
+void
+ParallelUtil_TransformFunction<INPUT_ITERATOR, OUTPUT_ITERATOR, FUNCTION>::
+operator()(bsl::size_t chunk) const
+{
+    const bsl::size_t begin = chunk * d_chunkLength;
+    const bsl::size_t end   = bsl::min(begin + d_chunkLength, d_length);
+
+    INPUT_ITERATOR  in  = d_first;
+    OUTPUT_ITERATOR out = d_result;
+    bsl::advance(in,  begin);
+    bsl::advance(out, begin);
+    for (bsl::size_t i = begin; i < end; ++i, ++in, ++out) {
+        *out = (*d_function_p)(*in);
+    }
+}
+
+                     // ---------------------------------
+                     // class ParallelUtil_ReduceFunction
+                     // ---------------------------------
+
+// CREATORS
+template <class ITERATOR, class TYPE, class OPERATION>
+inline
+ParallelUtil_ReduceFunction<ITERATOR, TYPE, OPERATION>::
+ParallelUtil_ReduceFunction(ITERATOR     first,
+                            bsl::size_t  length,
+                            bsl::size_t  chunkLength,
+                            TYPE        *results,
+                            OPERATION   *operation)
+: d_first(first)
+, d_length(length)
+, d_chunkLength(chunkLength)
+, d_results_p(results)
+, d_operation_p(operation)
+{
+}
+
+// ACCESSORS
+template <class ITERATOR, class TYPE, class OPERATION>
+void ParallelUtil_ReduceFunction<ITERATOR, TYPE, OPERATION>::operator()(
+                                                       bsl::size_t chunk) const
+{
+    const bsl::size_t begin = chunk * d_chunkLength;
+    const bsl::size_t end   = bsl::min(begin + d_chunkLength, d_length);
+
+    ITERATOR it = d_first;
+    bsl::advance(it, begin);
+
+    TYPE& result = d_results_p[chunk];
+
+    result = *it;
+    ++it;
+    for (bsl::size_t i = begin + 1; i < end; ++i, ++it) {
+        result = (*d_operation_p)(result, *it);
+    }
+}
+
+                      // -------------------------------
+                      // class ParallelUtil_SortFunction
+                      // -------------------------------
+
+// CREATORS
+template <class ITERATOR, class COMPARATOR>
+inline
+ParallelUtil_SortFunction<ITERATOR, COMPARATOR>::ParallelUtil_SortFunction(
+                                                  ITERATOR     first,
+                                                  bsl::size_t  length,
+                                                  bsl::size_t  chunkLength,
+                                                  COMPARATOR  *comparator)
+: d_first(first)
+, d_length(length)
+, d_chunkLength(chunkLength)
+, d_comparator_p(comparator)
+{
+}
+
+// ACCESSORS
+template <class ITERATOR, class COMPARATOR>
+void ParallelUtil_SortFunction<ITERATOR, COMPARATOR>::operator()(
+                                                       bsl::size_t chunk) const
+{
+    const bsl::size_t begin = chunk * d_chunkLength;
+    const bsl::size_t end   = bsl::min(begin + d_chunkLength, d_length);
+
+    ITERATOR first = d_first;
+    bsl::advance(first, begin);
+    ITERATOR last  = first;
+    bsl::advance(last, end - begin);
+
+    bsl::sort(first, last, *d_comparator_p);
+}
+
+                      // --------------------------------
+                      // class ParallelUtil_MergeFunction
+                      // --------------------------------
+
+// CREATORS
+template <class SOURCE_ITERATOR, class DESTINATION_ITERATOR, class COMPARATOR>
+inline
+ParallelUtil_MergeFunction<SOURCE_ITERATOR, DESTINATION_ITERATOR, COMPARATOR>::
+ParallelUtil_MergeFunction(SOURCE_ITERATOR       source,
+                           DESTINATION_ITERATOR  destination,
+                           bsl::size_t           length,
+                           bsl::size_t           runLength,
+                           COMPARATOR           *comparator)
+: d_source(source)
+, d_destination(destination)
+, d_length(length)
+, d_runLength(runLength)
+, d_comparator_p(comparator)
+{
+}
+
+// ACCESSORS
+template <class SOURCE_ITERATOR, class DESTINATION_ITERATOR, class COMPARATOR>
+void
+ParallelUtil_MergeFunction<SOURCE_ITERATOR, DESTINATION_ITERATOR, COMPARATOR>::
+operator()(bsl::size_t pair) const
+{
+    const bsl::size_t begin  = pair * 2 * d_runLength;
+    const bsl::size_t middle = bsl::min(begin + d_runLength,     d_length);
+    const bsl::size_t end    = bsl::min(begin + 2 * d_runLength, d_length);
+
+    SOURCE_ITERATOR left = d_source;
+    bsl::advance(left, begin);
+    SOURCE_ITERATOR leftEnd = d_source;
+    bsl::advance(leftEnd, middle);
+    SOURCE_ITERATOR right = leftEnd;
+    SOURCE_ITERATOR rightEnd = d_source;
+    bsl::advance(rightEnd, end);
+
+    DESTINATION_ITERATOR out = d_destination;
+    bsl::advance(out, begin);
+
+    while (left != leftEnd && right != rightEnd) {
+        if ((*d_comparator_p)(*right, *left)) {
+            *out = bslmf::MovableRefUtil::move(*right);
+            ++right;
+        }
+        else {
+            *out = bslmf::MovableRefUtil::move(*left);
+            ++left;
+        }
+        ++out;
+    }
+    for (; left != leftEnd; ++left, ++out) {
+        *out = bslmf::MovableRefUtil::move(*left);
+    }
+    for (; right != rightEnd; ++right, ++out) {
+        *out = bslmf::MovableRefUtil::move(*right);
+    }
+}
+
+                            // -------------------
+                            // struct ParallelUtil
+                            // -------------------
+
+// CLASS METHODS
+template <class POOL, class RANDOM_ITERATOR, class FUNCTION>
+void ParallelUtil::forEach(POOL             *pool,
+                           RANDOM_ITERATOR   first,
+                           RANDOM_ITERATOR   last,
+                           FUNCTION          function,
+                           bslma::Allocator *allocator)
+{
+    BSLS_ASSERT(pool);
+
+    if (first == last) {
+        return;                                                       // RETURN
+    }
+
+    allocator = bslma::Default::allocator(allocator);
+
+    const bsl::size_t length      = static_cast<bsl::size_t>(last - first);
+    const bsl::size_t chunkLength = ParallelUtil_Imp::chunkLength(
+                                       length,
+                                       ParallelUtil_Imp::concurrency(*pool));
+
+    ParallelUtil_Operation::ChunkFunction chunkFunction(
+            bsl::allocator_arg,
+            allocator,
+            ParallelUtil_ForEachFunction<RANDOM_ITERATOR, FUNCTION>(
+                                                                 first,
+                                                                 length,
+                                                                 chunkLength,
+                                                                 &function));
+
+    ParallelUtil_Imp::forEachChunk(pool,
+                                   (length + chunkLength - 1) / chunkLength,
+                                   chunkFunction);
+}
+
+template <class POOL, class RANDOM_ITERATOR, class TYPE, class OPERATION>
+TYPE ParallelUtil::reduce(POOL             *pool,
+                          RANDOM_ITERATOR   first,
+                          RANDOM_ITERATOR   last,
+                          TYPE              init,
+                          OPERATION         operation,
+                          bslma::Allocator *allocator)
+{
+    BSLS_ASSERT(pool);
+
+    if (first == last) {
+        return init;                                                  // RETURN
+    }
+
+    allocator = bslma::Default::allocator(allocator);
+
+    const bsl::size_t length      = static_cast<bsl::size_t>(last - first);
+    const bsl::size_t chunkLength = ParallelUtil_Imp::chunkLength(
+                                       length,
+                                       ParallelUtil_Imp::concurrency(*pool));
+    const bsl::size_t numChunks   = (length + chunkLength - 1) / chunkLength;
+
+    bsl::vector<TYPE> results(numChunks, init, allocator);
+
+    ParallelUtil_Operation::ChunkFunction chunkFunction(
+            bsl::allocator_arg,
+            allocator,
+            ParallelUtil_ReduceFunction<RANDOM_ITERATOR, TYPE, OPERATION>(
+                                                               first,
+                                                               length,
+                                                               chunkLength,
+                                                               results.data(),
+                                                               &operation));
+
+    ParallelUtil_Imp::forEachChunk(pool, numChunks, chunkFunction);
+
+    for (bsl::size_t i = 0; i < numChunks; ++i) {
+        init = operation(init, results[i]);
+    }
+
+    return init;
+}
+
+template <class POOL, class RANDOM_ITERATOR>
+inline
+void ParallelUtil::sort(POOL             *pool,
+                        RANDOM_ITERATOR   first,
+                        RANDOM_ITERATOR   last,
+                        bslma::Allocator *allocator)
+{
+    typedef typename bsl::iterator_traits<RANDOM_ITERATOR>::value_type
+                                                                     ValueType;
+
+    sort(pool, first, last, bsl::less<ValueType>(), allocator);
+}
+
+template <class POOL, class RANDOM_ITERATOR, class COMPARATOR>
+typename bsl::enable_if<
+    !bsl::is_convertible<COMPARATOR, bslma::Allocator *>::value>::type
+ParallelUtil::sort(POOL             *pool,
+                   RANDOM_ITERATOR   first,
+                   RANDOM_ITERATOR   last,
+                   COMPARATOR        comparator,
+                   bslma::Allocator *allocator)
+{
+    BSLS_ASSERT(pool);
+
+    typedef typename bsl::iterator_traits<RANDOM_ITERATOR>::value_type
+                                                                     ValueType;
+    typedef typename bsl::vector<ValueType>::iterator BufferIterator;
+
+    if (first == last) {
+        return;                                                       // RETURN
+    }
+
+    allocator = bslma::Default::allocator(allocator);
+
+    const bsl::size_t length      = static_cast<bsl::size_t>(last - first);
+    const bsl::size_t chunkLength = ParallelUtil_Imp::chunkLength(
+                                       length,
+                                       ParallelUtil_Imp::concurrency(*pool));
+    const bsl::size_t numChunks   = (length + chunkLength - 1) / chunkLength;
+
+    // Sort each chunk.
+
+    ParallelUtil_Imp::forEachChunk(
+                pool,
+                numChunks,
+                ParallelUtil_Operation::ChunkFunction(
+                    bsl::allocator_arg,
+                    allocator,
+                    ParallelUtil_SortFunction<RANDOM_ITERATOR, COMPARATOR>(
+                                                              first,
+                                                              length,
+                                                              chunkLength,
+                                                              &comparator)));
+
+    if (1 == numChunks) {
+        return;                                                       // RETURN
+    }
+
+    // Merge adjacent runs pairwise, alternating between the range and the
+    // buffer, until a single run remains.
+
+    bsl::vector<ValueType> buffer(first, last, allocator);
+
+    bool inBuffer = false;
+    for (bsl::size_t runLength = chunkLength;
+         runLength < length;
+         runLength *= 2) {
+        const bsl::size_t numPairs = (length + 2 * runLength - 1)
+                                                             / (2 * runLength);
+
+        if (inBuffer) {
+            ParallelUtil_Imp::forEachChunk(
+                pool,
+                numPairs,
+                ParallelUtil_Operation::ChunkFunction(
+                    bsl::allocator_arg,
+                    allocator,
+                    ParallelUtil_MergeFunction<BufferIterator,
+                                               RANDOM_ITERATOR,
+                                               COMPARATOR>(buffer.begin(),
+                                                           first,
+                                                           length,
+                                                           runLength,
+                                                           &comparator)));
+        }
+        else {
+            ParallelUtil_Imp::forEachChunk(
+                pool,
+                numPairs,
+                ParallelUtil_Operation::ChunkFunction(
+                    bsl::allocator_arg,
+                    allocator,
+                    ParallelUtil_MergeFunction<RANDOM_ITERATOR,
+                                               BufferIterator,
+                                               COMPARATOR>(first,
+                                                           buffer.begin(),
+                                                           length,
+                                                           runLength,
+                                                           &comparator)));
+        }
+        inBuffer = !inBuffer;
+    }
+
+    if (inBuffer) {
+        for (BufferIterator it = buffer.begin(); it != buffer.end();
+                                                               ++it, ++first) {
+            *first = bslmf::MovableRefUtil::move(*it);
+        }
+    }
+}
+
+template <class POOL,
+          class RANDOM_ITERATOR,
+          class RANDOM_OUTPUT_ITERATOR,
+          class FUNCTION>
+RANDOM_OUTPUT_ITERATOR ParallelUtil::transform(
+                                       POOL                   *pool,
+                                       RANDOM_ITERATOR         first,
+                                       RANDOM_ITERATOR         last,
+                                       RANDOM_OUTPUT_ITERATOR  result,
+                                       FUNCTION                function,
+                                       bslma::Allocator       *allocator)
+{
+    BSLS_ASSERT(pool);
+
+    if (first == last) {
+        return result;                                                // RETURN
+    }
+
+    allocator = bslma::Default::allocator(allocator);
+
+    const bsl::size_t length      = static_cast<bsl::size_t>(last - first);
+    const bsl::size_t chunkLength = ParallelUtil_Imp::chunkLength(
+                                       length,
+                                       ParallelUtil_Imp::concurrency(*pool));
+
+    ParallelUtil_Operation::ChunkFunction chunkFunction(
+            bsl::allocator_arg,
+            allocator,
+            ParallelUtil_TransformFunction<RANDOM_ITERATOR,
+                                           RANDOM_OUTPUT_ITERATOR,
+                                           FUNCTION>(first,
+                                                     result,
+                                                     length,
+                                                     chunkLength,
+                                                     &function));
+
+    ParallelUtil_Imp::forEachChunk(pool,
+                                   (length + chunkLength - 1) / chunkLength,
+                                   chunkFunction);
+
+    bsl::advance(result, length);
+    return result;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,954 @@
+// bdlmt_parallelutil.t.cpp                                           -*-C++-*-
+#include <bdlmt_parallelutil.h>
+
+#include <bdlmt_fixedthreadpool.h>
+#include <bdlmt_threadpool.h>
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bdlm_metricsregistry.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_testutil.h>
+#include <bslmt_timedcompletionguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_timeinterval.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_format.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              OVERVIEW
+// The component under test provides parallel algorithms executing on a
+// thread pool.  We first test the component-private fork-join operation,
+// verifying that every chunk is processed exactly once whatever the number
+// of participating threads.  We then test each algorithm, on each kind of
+// pool, for a range of lengths, against its sequential counterpart, and
+// verify that the algorithms complete when the pool is not started, and when
+// invoked from a job executing on the same pool.
+//
+// A negative test case -1 compares `sort` with `bsl::sort`.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] void forEach(POOL *, RI first, RI last, FUNCTION, *a);
+// [ 3] RO transform(POOL *, RI first, RI last, RO result, FUNCTION, *a);
+// [ 4] TYPE reduce(POOL *, RI first, RI last, TYPE init, OPERATION, *a);
+// [ 5] void sort(POOL *, RI first, RI last, *a);
+// [ 5] void sort(POOL *, RI first, RI last, COMPARATOR, *a);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] ParallelUtil_Operation
+// [ 2] ParallelUtil_Imp::chunkLength(length, concurrency);
+// [ 6] CONCERN: algorithms can be invoked from a job on the same pool
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: `sort` VS. `bsl::sort`
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT                   BSLMT_TESTUTIL_ASSERT
+#define ASSERTV                  BSLMT_TESTUTIL_ASSERTV
+
+#define Q                        BSLMT_TESTUTIL_Q
+#define P                        BSLMT_TESTUTIL_P
+#define P_                       BSLMT_TESTUTIL_P_
+#define T_                       BSLMT_TESTUTIL_T_
+#define L_                       BSLMT_TESTUTIL_L_
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::ParallelUtil           Util;
+typedef bdlmt::ParallelUtil_Operation Operation;
+
+/// Lengths of the ranges on which the algorithms are tested.
+const bsl::size_t LENGTHS[] = { 0, 1, 2, 3, 7, 8, 9, 63, 64, 65, 1000, 65537 };
+const int         NUM_LENGTHS = static_cast<int>(sizeof LENGTHS
+                                                 / sizeof *LENGTHS);
+
+// ============================================================================
+//                           GLOBAL VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+int test;
+int verbose;
+int veryVerbose;
+int veryVeryVerbose;
+
+// ============================================================================
+//                             DEFAULT ALLOCATOR
+// ----------------------------------------------------------------------------
+
+bslma::TestAllocator taDefault;
+
+// ============================================================================
+//                       GLOBAL CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+/// This function object increments its argument.
+struct Increment {
+    void operator()(bsls::AtomicInt& value) const
+    {
+        ++value;
+    }
+};
+
+/// This function object returns the square of its argument.
+struct Square {
+    bsls::Types::Int64 operator()(int value) const
+    {
+        return static_cast<bsls::Types::Int64>(value) * value;
+    }
+};
+
+/// This function object returns the concatenation of its arguments, an
+/// associative but not commutative operation.
+struct Concatenate {
+    bsl::string operator()(const bsl::string& lhs,
+                           const bsl::string& rhs) const
+    {
+        return lhs + rhs;
+    }
+};
+
+/// This function object increments the element of an array of counters
+/// having the index with which it is invoked.
+struct CountChunk {
+    bsls::AtomicInt *d_counters_p;
+
+    void operator()(bsl::size_t chunk) const
+    {
+        ++d_counters_p[chunk];
+    }
+};
+
+/// This function object invokes `Operation::help` on an operation.
+struct Help {
+    bsl::shared_ptr<Operation> d_operation;
+
+    void operator()() const
+    {
+        Operation::help(d_operation);
+    }
+};
+
+/// This function object sums, using `ParallelUtil::reduce` on a pool, a
+/// range of integers of length equal to its argument, and stores the result
+/// in its argument.
+template <class POOL>
+struct NestedReduce {
+    POOL *d_pool_p;
+
+    void operator()(bsls::Types::Int64& value) const
+    {
+        bsl::vector<int> data(static_cast<bsl::size_t>(value), 1);
+
+        value = Util::reduce(d_pool_p,
+                             data.begin(),
+                             data.end(),
+                             bsls::Types::Int64(0),
+                             bsl::plus<bsls::Types::Int64>());
+    }
+};
+
+// ============================================================================
+//                       GLOBAL FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+/// Return a pseudo-random value derived from the specified `seed`.
+unsigned int scramble(unsigned int seed)
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+/// Test `forEach` and `transform` on the specified `pool`.
+template <class POOL>
+void testForEachAndTransform(POOL *pool)
+{
+    bslma::TestAllocator ta(veryVeryVerbose);
+
+    for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+        const bsl::size_t LENGTH = LENGTHS[ti];
+
+        if (veryVerbose) { T_; P(LENGTH); }
+
+        // `forEach`
+
+        bsl::vector<bsls::AtomicInt> counters(LENGTH);
+
+        Util::forEach(pool,
+                      counters.begin(),
+                      counters.end(),
+                      Increment(),
+                      &ta);
+        Util::forEach(pool,
+                      counters.data(),
+                      counters.data() + LENGTH,
+                      Increment(),
+                      &ta);
+
+        for (bsl::size_t i = 0; i < LENGTH; ++i) {
+            ASSERTV(LENGTH, i, counters[i], 2 == counters[i]);
+        }
+
+        // `transform`
+
+        bsl::vector<int> input(LENGTH);
+        for (bsl::size_t i = 0; i < LENGTH; ++i) {
+            input[i] = static_cast<int>(scramble(static_cast<unsigned>(i + 1))
+                                                                      % 10000);
+        }
+        bsl::vector<bsls::Types::Int64> output(LENGTH + 1, -1);
+
+        bsl::vector<bsls::Types::Int64>::iterator end =
+                          Util::transform(pool,
+                                          input.begin(),
+                                          input.end(),
+                                          output.begin(),
+                                          Square(),
+                                          &ta);
+
+        ASSERTV(LENGTH, output.begin() + LENGTH == end);
+        for (bsl::size_t i = 0; i < LENGTH; ++i) {
+            ASSERTV(LENGTH, i, Square()(input[i]) == output[i]);
+        }
+        ASSERTV(LENGTH, -1 == output[LENGTH]);
+    }
+
+    ASSERTV(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+}
+
+/// Test `reduce` on the specified `pool`.
+template <class POOL>
+void testReduce(POOL *pool)
+{
+    bslma::TestAllocator ta(veryVeryVerbose);
+
+    for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+        const bsl::size_t LENGTH = LENGTHS[ti];
+
+        if (veryVerbose) { T_; P(LENGTH); }
+
+        bsl::vector<int> data(LENGTH);
+        for (bsl::size_t i = 0; i < LENGTH; ++i) {
+            data[i] = static_cast<int>(scramble(static_cast<unsigned>(i + 1))
+                                                                      % 1000);
+        }
+
+        bsls::Types::Int64 expected = 17;
+        for (bsl::size_t i = 0; i < LENGTH; ++i) {
+            expected += data[i];
+        }
+
+        ASSERTV(LENGTH, expected == Util::reduce(
+                                           pool,
+                                           data.begin(),
+                                           data.end(),
+                                           bsls::Types::Int64(17),
+                                           bsl::plus<bsls::Types::Int64>(),
+                                           &ta));
+
+        // Verify that the order of the operands is preserved.
+
+        if (LENGTH > 4096) {
+            continue;
+        }
+
+        bsl::vector<bsl::string> strings(LENGTH);
+        bsl::string              expectedString("init");
+        for (bsl::size_t i = 0; i < LENGTH; ++i) {
+            strings[i].assign(1, static_cast<char>('a' + data[i] % 26));
+            expectedString += strings[i];
+        }
+
+        ASSERTV(LENGTH, expectedString == Util::reduce(pool,
+                                                      strings.begin(),
+                                                      strings.end(),
+                                                      bsl::string("init"),
+                                                      Concatenate(),
+                                                      &ta));
+    }
+
+    ASSERTV(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+}
+
+/// Test `sort` on the specified `pool`.
+template <class POOL>
+void testSort(POOL *pool)
+{
+    bslma::TestAllocator ta(veryVeryVerbose);
+
+    for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+        const bsl::size_t LENGTH = LENGTHS[ti];
+
+        if (veryVerbose) { T_; P(LENGTH); }
+
+        bsl::vector<int> data(LENGTH);
+        for (bsl::size_t i = 0; i < LENGTH; ++i) {
+            data[i] = static_cast<int>(scramble(static_cast<unsigned>(i + 1))
+                                                                       % 997);
+        }
+
+        bsl::vector<int> expected(data);
+        bsl::sort(expected.begin(), expected.end());
+
+        bsl::vector<int> mX(data);
+        Util::sort(pool, mX.begin(), mX.end(), &ta);
+        ASSERTV(LENGTH, expected == mX);
+
+        // Sort again the sorted data.
+
+        Util::sort(pool, mX.begin(), mX.end(), &ta);
+        ASSERTV(LENGTH, expected == mX);
+
+        // Sort in descending order, using pointers.
+
+        mX = data;
+        Util::sort(pool,
+                   mX.data(),
+                   mX.data() + LENGTH,
+                   bsl::greater<int>(),
+                   &ta);
+        bsl::reverse(expected.begin(), expected.end());
+        ASSERTV(LENGTH, expected == mX);
+
+        // Sort strings, which are allocator-aware and not trivially copyable.
+
+        if (LENGTH > 4096) {
+            continue;
+        }
+
+        bsl::vector<bsl::string> strings(&ta);
+        for (bsl::size_t i = 0; i < LENGTH; ++i) {
+            strings.push_back(bsl::string(
+                               "a string too long for the short buffer #")
+                              + static_cast<char>('a' + data[i] % 26));
+        }
+        bsl::vector<bsl::string> expectedStrings(strings);
+        bsl::sort(expectedStrings.begin(), expectedStrings.end());
+
+        Util::sort(pool, strings.begin(), strings.end(), &ta);
+        ASSERTV(LENGTH, expectedStrings == strings);
+    }
+
+    ASSERTV(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+}
+
+/// Test the invocation of the algorithms from a job executing on the
+/// specified `pool`.
+template <class POOL>
+void testNested(POOL *pool)
+{
+    const int NUM_RANGES = 100;
+
+    bsl::vector<bsls::Types::Int64> lengths(NUM_RANGES);
+    for (int i = 0; i < NUM_RANGES; ++i) {
+        lengths[i] = i * 37;
+    }
+
+    NestedReduce<POOL> nested = { pool };
+    Util::forEach(pool, lengths.begin(), lengths.end(), nested);
+
+    for (int i = 0; i < NUM_RANGES; ++i) {
+        ASSERTV(i, lengths[i], i * 37 == lengths[i]);
+    }
+}
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recomputing and Summing Values in Parallel
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a large collection of positions and want to compute the
+// value of each of them, and then the total value, using all the threads of
+// a pool.
+//
+// First, we define the positions and a function object valuing one:
+// ```
+    struct Position {
+        double d_quantity;
+        double d_price;
+    };
+
+    struct ValuePosition {
+        double operator()(const Position& position) const
+        {
+            return position.d_quantity * position.d_price;
+        }
+    };
+// ```
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    // access the metrics registry default instance before assign the global
+    // allocator
+
+    bdlm::MetricsRegistry::defaultInstance();
+
+    bslma::DefaultAllocatorGuard guard(&taDefault);
+    bslma::TestAllocator  testAllocator(veryVeryVerbose);
+
+    bslma::TestAllocator  globalAllocator;
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslmt::TimedCompletionGuard completionGuard(&taDefault);
+    ASSERT(0 == completionGuard.guard(bsls::TimeInterval(90, 0),
+                                      bsl::format("case {}", test)));
+
+    switch (test) { case 0:  // case 0 is always the first case
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::DefaultAllocatorGuard dag(&testAllocator);
+
+// Then, we create and start a thread pool:
+// ```
+    bdlmt::FixedThreadPool pool(4, 100);
+    int rc = pool.start();
+    ASSERT(0 == rc);
+// ```
+// Next, we create the positions:
+// ```
+    bsl::vector<Position> positions(100000);
+    for (bsl::size_t i = 0; i < positions.size(); ++i) {
+        positions[i].d_quantity = static_cast<double>(i % 10);
+        positions[i].d_price    = 2.0;
+    }
+// ```
+// Now, we compute the value of each position in parallel, and sum the values
+// in parallel:
+// ```
+    bsl::vector<double> values(positions.size());
+
+    bdlmt::ParallelUtil::transform(&pool,
+                                   positions.begin(),
+                                   positions.end(),
+                                   values.begin(),
+                                   ValuePosition());
+
+    double total = bdlmt::ParallelUtil::reduce(&pool,
+                                               values.begin(),
+                                               values.end(),
+                                               0.0,
+                                               bsl::plus<double>());
+    ASSERT(900000.0 == total);
+// ```
+// Finally, we sort the values in parallel:
+// ```
+    bdlmt::ParallelUtil::sort(&pool, values.begin(), values.end());
+    ASSERT(0.0  == values.front());
+    ASSERT(18.0 == values.back());
+// ```
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCERN: ALGORITHMS CAN BE INVOKED FROM A JOB ON THE SAME POOL
+        //
+        // Concerns:
+        // 1. An algorithm invoked from a job executing on the pool on which
+        //    it executes completes, even if every thread of the pool is
+        //    executing such a job.
+        //
+        // Plan:
+        // 1. For each kind of pool, with 1 and 4 threads, invoke `forEach`
+        //    with a function invoking `reduce` on the same pool, and verify
+        //    the results.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: algorithms can be invoked from a job on the same pool
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: ALGORITHMS CAN BE INVOKED FROM A JOB"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        for (int numThreads = 1; numThreads <= 4; numThreads *= 4) {
+            if (veryVerbose) { P(numThreads); }
+
+            bdlmt::FixedThreadPool fixedPool(numThreads, 1000);
+            ASSERT(0 == fixedPool.start());
+            testNested(&fixedPool);
+
+            bdlmt::ThreadPool threadPool(bslmt::ThreadAttributes(),
+                                         0,
+                                         numThreads,
+                                         1000);
+            ASSERT(0 == threadPool.start());
+            testNested(&threadPool);
+
+            bdlmt::WorkStealingThreadPool workStealingPool(numThreads);
+            ASSERT(0 == workStealingPool.start());
+            testNested(&workStealingPool);
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING `sort`
+        //
+        // Concerns:
+        // 1. `sort` sorts the range using `operator<`, or the supplied
+        //    comparator.
+        //
+        // 2. `sort` supports elements that allocate memory.
+        //
+        // 3. All temporary memory is supplied by the supplied allocator, and
+        //    is released.
+        //
+        // 4. `sort` completes if the pool is not started.
+        //
+        // Plan:
+        // 1. For each kind of pool, started and not started, for a set of
+        //    lengths, sort pseudo-random integers and strings, and compare
+        //    with the result of `bsl::sort`; sort again the sorted range; sort
+        //    in descending order using `bsl::greater`.  (C-1..2, 4)
+        //
+        // 2. Supply a test allocator and verify that no memory remains in
+        //    use.  (C-3)
+        //
+        // Testing:
+        //   void sort(POOL *, RI first, RI last, *a);
+        //   void sort(POOL *, RI first, RI last, COMPARATOR, *a);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `sort`" << endl
+                          << "==============" << endl;
+
+        bdlmt::FixedThreadPool fixedPool(4, 1000);
+        testSort(&fixedPool);
+        ASSERT(0 == fixedPool.start());
+        testSort(&fixedPool);
+
+        bdlmt::ThreadPool threadPool(bslmt::ThreadAttributes(), 0, 4, 1000);
+        ASSERT(0 == threadPool.start());
+        testSort(&threadPool);
+
+        bdlmt::WorkStealingThreadPool workStealingPool(4);
+        testSort(&workStealingPool);
+        ASSERT(0 == workStealingPool.start());
+        testSort(&workStealingPool);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING `reduce`
+        //
+        // Concerns:
+        // 1. `reduce` returns the reduction of the range and of the initial
+        //    value, which is returned for an empty range.
+        //
+        // 2. The order of the operands is preserved.
+        //
+        // 3. All temporary memory is supplied by the supplied allocator, and
+        //    is released.
+        //
+        // 4. `reduce` completes if the pool is not started.
+        //
+        // Plan:
+        // 1. For each kind of pool, started and not started, for a set of
+        //    lengths, sum pseudo-random integers, and concatenate strings,
+        //    and compare with the sequential result.  (C-1..2, 4)
+        //
+        // 2. Supply a test allocator and verify that no memory remains in
+        //    use.  (C-3)
+        //
+        // Testing:
+        //   TYPE reduce(POOL *, RI first, RI last, TYPE init, OPERATION, *a);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `reduce`" << endl
+                          << "================" << endl;
+
+        bdlmt::FixedThreadPool fixedPool(4, 1000);
+        testReduce(&fixedPool);
+        ASSERT(0 == fixedPool.start());
+        testReduce(&fixedPool);
+
+        bdlmt::ThreadPool threadPool(bslmt::ThreadAttributes(), 0, 4, 1000);
+        ASSERT(0 == threadPool.start());
+        testReduce(&threadPool);
+
+        bdlmt::WorkStealingThreadPool workStealingPool(4);
+        testReduce(&workStealingPool);
+        ASSERT(0 == workStealingPool.start());
+        testReduce(&workStealingPool);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING `forEach` AND `transform`
+        //
+        // Concerns:
+        // 1. `forEach` applies the function exactly once to each element.
+        //
+        // 2. `transform` stores the result of the function for each element
+        //    at the corresponding position, does not write past the end of
+        //    the output range, and returns the end of the output range.
+        //
+        // 3. All temporary memory is supplied by the supplied allocator, and
+        //    is released.
+        //
+        // 4. The algorithms complete if the pool is not started.
+        //
+        // Plan:
+        // 1. For each kind of pool, started and not started, for a set of
+        //    lengths, increment a range of counters twice using `forEach`,
+        //    with iterators and with pointers, and verify each counter is 2.
+        //    (C-1, 4)
+        //
+        // 2. Using the same pools and lengths, square a range of integers
+        //    into a range one element longer, and verify the results, the
+        //    returned iterator, and the last element.  (C-2, 4)
+        //
+        // 3. Supply a test allocator and verify that no memory remains in
+        //    use.  (C-3)
+        //
+        // Testing:
+        //   void forEach(POOL *, RI first, RI last, FUNCTION, *a);
+        //   RO transform(POOL *, RI first, RI last, RO result, FUNCTION, *a);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `forEach` AND `transform`" << endl
+                          << "=================================" << endl;
+
+        bdlmt::FixedThreadPool fixedPool(4, 1000);
+        testForEachAndTransform(&fixedPool);
+        ASSERT(0 == fixedPool.start());
+        testForEachAndTransform(&fixedPool);
+
+        bdlmt::ThreadPool threadPool(bslmt::ThreadAttributes(), 0, 4, 1000);
+        ASSERT(0 == threadPool.start());
+        testForEachAndTransform(&threadPool);
+
+        bdlmt::WorkStealingThreadPool workStealingPool(4);
+        testForEachAndTransform(&workStealingPool);
+        ASSERT(0 == workStealingPool.start());
+        testForEachAndTransform(&workStealingPool);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING `ParallelUtil_Operation`
+        //
+        // Concerns:
+        // 1. An operation processes each chunk exactly once, whatever the
+        //    number of threads invoking `work`, including none but the one
+        //    invoking `wait`.
+        //
+        // 2. `help` may be invoked after the operation completes.
+        //
+        // 3. `chunkLength` divides a range into at most a few chunks per
+        //    thread, and chunks are not empty.
+        //
+        // Plan:
+        // 1. For a set of numbers of chunks and of helper threads, create an
+        //    operation counting the invocations of each chunk, invoke `help`
+        //    from the helper threads and `work` and `wait` from the main
+        //    thread, and verify each chunk is processed once.  Invoke `help`
+        //    again after `wait` returns.  (C-1..2)
+        //
+        // 2. For a set of lengths and concurrencies, verify the length of the
+        //    chunks.  (C-3)
+        //
+        // Testing:
+        //   ParallelUtil_Operation
+        //   ParallelUtil_Imp::chunkLength(length, concurrency);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `ParallelUtil_Operation`" << endl
+                          << "================================" << endl;
+
+        const bsl::size_t NUM_CHUNKS[] = { 1, 2, 3, 5, 16, 17, 1000 };
+        const int         NUM_NUM_CHUNKS = static_cast<int>(
+                                     sizeof NUM_CHUNKS / sizeof *NUM_CHUNKS);
+
+        for (int ti = 0; ti < NUM_NUM_CHUNKS; ++ti) {
+            const bsl::size_t NC = NUM_CHUNKS[ti];
+
+            for (int numHelpers = 0; numHelpers <= 4; ++numHelpers) {
+                if (veryVerbose) { T_; P_(NC); P(numHelpers); }
+
+                bslma::TestAllocator ta(veryVeryVerbose);
+
+                bsl::vector<bsls::AtomicInt> counters(NC);
+                CountChunk                   countChunk = { counters.data() };
+                Operation::ChunkFunction     chunkFunction(countChunk);
+
+                bsl::shared_ptr<Operation> operation(
+                                  new (ta) Operation(NC, chunkFunction, &ta),
+                                  &ta);
+
+                bslmt::ThreadUtil::Handle handles[4];
+                Help                      help = { operation };
+                for (int i = 0; i < numHelpers; ++i) {
+                    ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(
+                                                                &handles[i],
+                                                                help,
+                                                                &ta));
+                }
+
+                operation->work();
+                operation->wait();
+
+                for (bsl::size_t i = 0; i < NC; ++i) {
+                    ASSERTV(NC, numHelpers, i, 1 == counters[i]);
+                }
+
+                for (int i = 0; i < numHelpers; ++i) {
+                    ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+                }
+
+                Operation::help(operation);
+                for (bsl::size_t i = 0; i < NC; ++i) {
+                    ASSERTV(NC, numHelpers, i, 1 == counters[i]);
+                }
+            }
+        }
+
+        for (bsl::size_t length = 1; length <= 10000; length = 3*length + 1) {
+            for (int concurrency = 0; concurrency <= 8; ++concurrency) {
+                const bsl::size_t CHUNK_LENGTH =
+                    bdlmt::ParallelUtil_Imp::chunkLength(length, concurrency);
+                const bsl::size_t NC = (length + CHUNK_LENGTH - 1)
+                                                                / CHUNK_LENGTH;
+
+                ASSERTV(length, concurrency, CHUNK_LENGTH, 0 < CHUNK_LENGTH);
+                ASSERTV(length, concurrency, NC,
+                        NC <= 8 * static_cast<bsl::size_t>(concurrency + 1));
+                ASSERTV(length, concurrency, NC,
+                        NC * 2 > bsl::min(
+                              length,
+                              8 * static_cast<bsl::size_t>(concurrency + 1)));
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Create and start a pool, and invoke each algorithm on a small
+        //    range.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bdlmt::FixedThreadPool pool(2, 100);
+        ASSERT(0 == pool.start());
+
+        int data[] = { 5, 3, 9, 1, 7, 2, 8, 4, 6, 0 };
+        const int N = static_cast<int>(sizeof data / sizeof *data);
+
+        bsl::vector<bsls::AtomicInt> counters(N);
+        Util::forEach(&pool, counters.begin(), counters.end(), Increment());
+        for (int i = 0; i < N; ++i) {
+            ASSERTV(i, 1 == counters[i]);
+        }
+
+        bsls::Types::Int64 squares[N];
+        Util::transform(&pool, data, data + N, squares, Square());
+        for (int i = 0; i < N; ++i) {
+            ASSERTV(i, data[i] * data[i] == squares[i]);
+        }
+
+        ASSERT(45 == Util::reduce(&pool, data, data + N, 0, bsl::plus<int>()));
+
+        Util::sort(&pool, data, data + N);
+        for (int i = 0; i < N; ++i) {
+            ASSERTV(i, data[i], i == data[i]);
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: `sort` VS. `bsl::sort`
+        //
+        // Concerns:
+        // 1. `sort` is faster than `bsl::sort` on a large range when several
+        //    threads are available.
+        //
+        // Plan:
+        // 1. Sort the same pseudo-random integers using `bsl::sort` and using
+        //    `sort` on pools of 1, 2, 4, and 8 threads, and report the
+        //    times.  The number of elements is 2 to the power of the value of
+        //    the optional second command-line argument (default 24).
+        //
+        // Testing:
+        //   PERFORMANCE: `sort` VS. `bsl::sort`
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: `sort` VS. `bsl::sort`" << endl
+             << "===================================" << endl;
+
+        const int         LOG2_LENGTH = argc > 2 ? atoi(argv[2]) : 24;
+        const bsl::size_t LENGTH      = bsl::size_t(1) << LOG2_LENGTH;
+
+        bsl::vector<int> data(LENGTH);
+        for (bsl::size_t i = 0; i < LENGTH; ++i) {
+            data[i] = static_cast<int>(scramble(static_cast<unsigned>(i + 1)));
+        }
+
+        bsls::Stopwatch timer;
+
+        {
+            bsl::vector<int> mX(data);
+
+            timer.start();
+            bsl::sort(mX.begin(), mX.end());
+            timer.stop();
+
+            cout << "bsl::sort:                  " << LENGTH
+                 << " elements in " << timer.elapsedTime() << "s\n";
+        }
+
+        for (int numThreads = 1; numThreads <= 8; numThreads *= 2) {
+            bdlmt::WorkStealingThreadPool pool(numThreads);
+            ASSERT(0 == pool.start());
+
+            bsl::vector<int> mX(data);
+
+            timer.reset();
+            timer.start();
+            Util::sort(&pool, mX.begin(), mX.end());
+            timer.stop();
+
+            ASSERT(bsl::is_sorted(mX.begin(), mX.end()));
+
+            cout << "ParallelUtil::sort (" << numThreads << " + 1): "
+                 << LENGTH << " elements in " << timer.elapsedTime()
+                 << "s\n";
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    ASSERT(0 == globalAllocator.numAllocations());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,642 @@
+// bdlmt_workstealingthreadpool.cpp                                   -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_workstealingthreadpool_cpp,"$Id$ $CSID$")
+
+#include <bdlf_bind.h>
+
+#include <bdlm_instancecount.h>
+#include <bdlm_metric.h>
+#include <bdlm_metricdescriptor.h>
+
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_threadlocalvariable.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_performancehint.h>
+
+#include <bsl_functional.h>
+
+namespace {
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+void initBlockSet(sigset_t *blockSet)
+{
+    sigfillset(blockSet);
+
+    const int synchronousSignals[] = {
+      SIGBUS,
+      SIGFPE,
+      SIGILL,
+      SIGSEGV,
+      SIGSYS,
+      SIGABRT,
+      SIGTRAP,
+     #if !defined(BSLS_PLATFORM_OS_CYGWIN) || defined(SIGIOT)
+      SIGIOT
+     #endif
+    };
+
+    const int SIZE = sizeof synchronousSignals / sizeof *synchronousSignals;
+
+    for (int i=0; i < SIZE; ++i) {
+        sigdelset(blockSet, synchronousSignals[i]);
+    }
+}
+#endif
+
+void backlogMetric(BloombergLP::bdlm::Metric                        *value,
+                   const BloombergLP::bdlmt::WorkStealingThreadPool *object)
+{
+    *value = BloombergLP::bdlm::Metric::Gauge(  object->numPendingJobs()
+                                              + object->numActiveThreads()
+                                              - object->numThreadsStarted());
+}
+
+/// Return the next value of the pseudo-random sequence having the specified
+/// `state`, and update `state`.
+unsigned int nextRandom(unsigned int *state)
+{
+    // xorshift32
+
+    unsigned int x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+// The pool the calling thread is a worker of, if any, and the index of that
+// worker within the pool.
+
+BSLMT_THREAD_LOCAL_VARIABLE(const void *, t_currentPool,        0);
+BSLMT_THREAD_LOCAL_VARIABLE(int,          t_currentWorkerIndex, -1);
+
+}  // close unnamed namespace
+
+namespace BloombergLP {
+namespace bdlmt {
+
+                    // -----------------------------------
+                    // class WorkStealingThreadPool_Deque
+                    // -----------------------------------
+
+// CREATORS
+WorkStealingThreadPool_Deque::WorkStealingThreadPool_Deque(
+                                              int               capacity,
+                                              bslma::Allocator *basicAllocator)
+: d_top(0)
+, d_bottom(0)
+, d_buffer_p(0)
+, d_capacity(capacity)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < capacity);
+    BSLS_ASSERT(0 == (capacity & (capacity - 1)));
+
+    const bsl::size_t size = sizeof(bsls::AtomicPointer<Job>)
+                                         * static_cast<bsl::size_t>(capacity);
+
+    d_buffer_p = static_cast<bsls::AtomicPointer<Job> *>(
+                                              d_allocator_p->allocate(size));
+
+    for (int i = 0; i < capacity; ++i) {
+        new (d_buffer_p + i) bsls::AtomicPointer<Job>(0);
+    }
+}
+
+WorkStealingThreadPool_Deque::~WorkStealingThreadPool_Deque()
+{
+    d_allocator_p->deallocate(d_buffer_p);
+}
+
+                       // ----------------------------
+                       // class WorkStealingThreadPool
+                       // ----------------------------
+
+// PRIVATE CLASS DATA
+const char WorkStealingThreadPool::s_defaultThreadName[16] = { "bdl.WSPool" };
+
+// PRIVATE MANIPULATORS
+WorkStealingThreadPool::Job *WorkStealingThreadPool::findJob(
+                                                     int           index,
+                                                     unsigned int *randomState)
+{
+    // First, take the newest job of the deque of this worker.
+
+    Job *job = d_deques[index]->popBottom();
+    if (job) {
+        return job;                                                   // RETURN
+    }
+
+    // Then, take the oldest external submission.
+
+    if (0 < d_numExternalJobs.loadAcquire()) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_externalMutex);
+
+        if (!d_externalQueue.empty()) {
+            job = d_externalQueue.front();
+            d_externalQueue.pop_front();
+            d_numExternalJobs.addRelaxed(-1);
+            return job;                                               // RETURN
+        }
+    }
+
+    // Finally, try to steal from every other worker, starting at a random
+    // victim.
+
+    const int start = static_cast<int>(nextRandom(randomState)
+                                  % static_cast<unsigned int>(d_numThreads));
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        int victim = start + i;
+        if (victim >= d_numThreads) {
+            victim -= d_numThreads;
+        }
+        if (victim == index) {
+            continue;
+        }
+
+        job = d_deques[victim]->steal();
+        if (job) {
+            return job;                                               // RETURN
+        }
+    }
+
+    return 0;
+}
+
+void WorkStealingThreadPool::initialize(
+                                 bdlm::MetricsRegistry   *metricsRegistry,
+                                 const bsl::string_view&  threadPoolName)
+{
+    if (d_threadAttributes.threadName().empty()) {
+        d_threadAttributes.setThreadName(s_defaultThreadName);
+    }
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    initBlockSet(&d_blockSet);
+#endif
+
+    d_deques.reserve(d_numThreads);
+    for (int i = 0; i < d_numThreads; ++i) {
+        d_deques.push_back(new (*d_allocator_p) Deque(k_LOCAL_QUEUE_CAPACITY,
+                                                      d_allocator_p));
+    }
+
+    bdlm::MetricsRegistry *registry = metricsRegistry
+                                   ? metricsRegistry
+                                   : &bdlm::MetricsRegistry::defaultInstance();
+
+    bdlm::InstanceCount::Value instanceNumber =
+             bdlm::InstanceCount::nextInstanceNumber<WorkStealingThreadPool>();
+
+    bdlm::MetricDescriptor mdBacklog(
+             bdlm::MetricDescriptor::k_USE_METRICS_ADAPTER_NAMESPACE_SELECTION,
+             "bde.backlog",
+             instanceNumber,
+             "bdlmt.workstealingthreadpool",
+             "wstp",
+             threadPoolName);
+
+    registry->registerCollectionCallback(
+                                &d_backlogHandle,
+                                mdBacklog,
+                                bdlf::BindUtil::bind(&backlogMetric,
+                                                     bdlf::PlaceHolders::_1,
+                                                     this));
+}
+
+int WorkStealingThreadPool::pushJob(Job *job)
+{
+    // The counts are incremented before the job is visible to the workers so
+    // that they never underflow, and so that a worker that is about to block
+    // observes the job (see `workerThread`).
+
+    if (this == t_currentPool) {
+        d_numIncompleteJobs.addAcqRel(1);
+        d_numPendingJobs.add(1);
+
+        Deque *deque = d_deques[t_currentWorkerIndex];
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                               0 != deque->pushBottom(job))) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_externalMutex);
+
+            d_externalQueue.push_back(job);
+            d_numExternalJobs.addAcqRel(1);
+        }
+    }
+    else {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_externalMutex);
+
+        if (!d_enabledFlag) {
+            d_jobPool.deleteObject(job);
+            return e_DISABLED;                                        // RETURN
+        }
+
+        d_numIncompleteJobs.addAcqRel(1);
+        d_numPendingJobs.add(1);
+
+        d_externalQueue.push_back(job);
+        d_numExternalJobs.addAcqRel(1);
+    }
+
+    if (0 < d_numIdleThreads.load()) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        d_workCondition.signal();
+    }
+
+    return e_SUCCESS;
+}
+
+void WorkStealingThreadPool::removeAll()
+{
+    for (int i = 0; i < d_numThreads; ++i) {
+        while (Job *job = d_deques[i]->steal()) {
+            d_jobPool.deleteObject(job);
+            d_numPendingJobs.addRelaxed(-1);
+            d_numIncompleteJobs.addRelaxed(-1);
+        }
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_externalMutex);
+
+    while (!d_externalQueue.empty()) {
+        d_jobPool.deleteObject(d_externalQueue.front());
+        d_externalQueue.pop_front();
+        d_numExternalJobs.addRelaxed(-1);
+        d_numPendingJobs.addRelaxed(-1);
+        d_numIncompleteJobs.addRelaxed(-1);
+    }
+}
+
+int WorkStealingThreadPool::startNewThread(
+                             int                                   index,
+                             const bslmt::ThreadAttributes&        attributes,
+                             const bsl::shared_ptr<bslmt::Latch>&  latch)
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Block all asynchronous signals.
+
+    sigset_t oldset;
+    pthread_sigmask(SIG_BLOCK, &d_blockSet, &oldset);
+#endif
+
+    bsl::function<void()> workerThreadFunc = bdlf::BindUtil::bind(
+                                         &WorkStealingThreadPool::workerThread,
+                                         this,
+                                         index,
+                                         latch);
+
+    int rc = d_threadGroup.addThread(workerThreadFunc, attributes);
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Restore the mask.
+
+    pthread_sigmask(SIG_SETMASK, &oldset, &d_blockSet);
+#endif
+
+    return rc;
+}
+
+void WorkStealingThreadPool::waitUntilEmpty()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    while (0 < d_numIncompleteJobs.load()) {
+        d_drainCondition.wait(&d_mutex);
+    }
+}
+
+void WorkStealingThreadPool::workerThread(
+                                    int                                  index,
+                                    const bsl::shared_ptr<bslmt::Latch>& latch)
+{
+    if (latch) {
+        // This worker executes on its processor: allocate its deque here so
+        // that the memory is first touched on the node of the processor.
+        // No other thread accesses the deque until all workers arrive.
+
+        Deque *deque = new (*d_allocator_p) Deque(k_LOCAL_QUEUE_CAPACITY,
+                                                  d_allocator_p);
+        d_allocator_p->deleteObject(d_deques[index]);
+        d_deques[index] = deque;
+
+        latch->arriveAndWait();
+    }
+
+    t_currentPool        = this;
+    t_currentWorkerIndex = index;
+
+    unsigned int randomState = static_cast<unsigned int>(index) * 2654435761u
+                                                                          + 1u;
+
+    while (!d_exitFlag) {
+        Job *job = findJob(index, &randomState);
+
+        if (job) {
+            d_numPendingJobs.addRelaxed(-1);
+            d_numActiveThreads.addAcqRel(1);
+
+            (*job)();
+            d_jobPool.deleteObject(job);
+
+            d_numActiveThreads.addAcqRel(-1);
+
+            if (0 == d_numIncompleteJobs.addAcqRel(-1)) {
+                bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+                d_drainCondition.broadcast();
+            }
+            continue;
+        }
+
+        if (0 < d_numPendingJobs.load()) {
+            // A job is pending, but was not found (e.g., a steal lost a race,
+            // or the job is not yet visible): retry.
+
+            bslmt::ThreadUtil::yield();
+            continue;
+        }
+
+        // Block until a job is enqueued.  Incrementing `d_numIdleThreads`
+        // before reading `d_numPendingJobs` (while `pushJob` does the
+        // converse) ensures that either this thread observes the new job, or
+        // the enqueuing thread observes this thread and signals it.
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        d_numIdleThreads.add(1);
+        while (0 == d_numPendingJobs.load() && !d_exitFlag) {
+            d_workCondition.wait(&d_mutex);
+        }
+        d_numIdleThreads.add(-1);
+    }
+
+    t_currentPool        = 0;
+    t_currentWorkerIndex = -1;
+}
+
+// CREATORS
+WorkStealingThreadPool::WorkStealingThreadPool(
+                                              int               numThreads,
+                                              bslma::Allocator *basicAllocator)
+: d_jobPool(sizeof(Job), basicAllocator)
+, d_deques(basicAllocator)
+, d_externalQueue(basicAllocator)
+, d_numExternalJobs(0)
+, d_numPendingJobs(0)
+, d_numIncompleteJobs(0)
+, d_numActiveThreads(0)
+, d_numIdleThreads(0)
+, d_enabledFlag(false)
+, d_exitFlag(false)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(basicAllocator)
+, d_numThreads(numThreads)
+, d_workerPinningFlag(false)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT_OPT(1 <= numThreads);
+
+    initialize(
+            0,
+            bdlm::MetricDescriptor::k_USE_METRICS_ADAPTER_OBJECT_ID_SELECTION);
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+                                      int                      numThreads,
+                                      const bsl::string_view&  threadPoolName,
+                                      bdlm::MetricsRegistry   *metricsRegistry,
+                                      bslma::Allocator        *basicAllocator)
+: d_jobPool(sizeof(Job), basicAllocator)
+, d_deques(basicAllocator)
+, d_externalQueue(basicAllocator)
+, d_numExternalJobs(0)
+, d_numPendingJobs(0)
+, d_numIncompleteJobs(0)
+, d_numActiveThreads(0)
+, d_numIdleThreads(0)
+, d_enabledFlag(false)
+, d_exitFlag(false)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(basicAllocator)
+, d_numThreads(numThreads)
+, d_workerPinningFlag(false)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT_OPT(1 <= numThreads);
+
+    d_threadAttributes.setThreadName(threadPoolName);
+
+    initialize(metricsRegistry, threadPoolName);
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+                             const bslmt::ThreadAttributes&  threadAttributes,
+                             int                             numThreads,
+                             bslma::Allocator               *basicAllocator)
+: d_jobPool(sizeof(Job), basicAllocator)
+, d_deques(basicAllocator)
+, d_externalQueue(basicAllocator)
+, d_numExternalJobs(0)
+, d_numPendingJobs(0)
+, d_numIncompleteJobs(0)
+, d_numActiveThreads(0)
+, d_numIdleThreads(0)
+, d_enabledFlag(false)
+, d_exitFlag(false)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(threadAttributes, basicAllocator)
+, d_numThreads(numThreads)
+, d_workerPinningFlag(false)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT_OPT(1 <= numThreads);
+
+    initialize(
+        0,
+        (!d_threadAttributes.threadName().empty()
+         ? d_threadAttributes.threadName()
+         : bdlm::MetricDescriptor::k_USE_METRICS_ADAPTER_OBJECT_ID_SELECTION));
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+                             const bslmt::ThreadAttributes&  threadAttributes,
+                             int                             numThreads,
+                             const bsl::string_view&         threadPoolName,
+                             bdlm::MetricsRegistry          *metricsRegistry,
+                             bslma::Allocator               *basicAllocator)
+: d_jobPool(sizeof(Job), basicAllocator)
+, d_deques(basicAllocator)
+, d_externalQueue(basicAllocator)
+, d_numExternalJobs(0)
+, d_numPendingJobs(0)
+, d_numIncompleteJobs(0)
+, d_numActiveThreads(0)
+, d_numIdleThreads(0)
+, d_enabledFlag(false)
+, d_exitFlag(false)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(threadAttributes, basicAllocator)
+, d_numThreads(numThreads)
+, d_workerPinningFlag(false)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT_OPT(1 <= numThreads);
+
+    if (d_threadAttributes.threadName().empty()) {
+        d_threadAttributes.setThreadName(threadPoolName);
+    }
+
+    initialize(metricsRegistry, threadPoolName);
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    shutdown();
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        d_allocator_p->deleteObject(d_deques[i]);
+    }
+}
+
+// MANIPULATORS
+void WorkStealingThreadPool::drain()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (isStarted()) {
+        waitUntilEmpty();
+    }
+}
+
+void WorkStealingThreadPool::shutdown()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (isStarted()) {
+        disable();
+
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            d_exitFlag = true;
+            d_workCondition.broadcast();
+        }
+
+        d_threadGroup.joinAll();
+
+        removeAll();
+    }
+}
+
+int WorkStealingThreadPool::start()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (isStarted()) {
+        return 0;                                                     // RETURN
+    }
+
+    d_exitFlag = false;
+
+    bsl::vector<int> cpus(d_allocator_p);
+    if (d_workerPinningFlag
+     && 0 != bslmt::ThreadUtil::getCpuAffinity(&cpus, d_threadAttributes)) {
+        cpus.clear();
+    }
+
+    bsl::shared_ptr<bslmt::Latch> latch;
+    if (!cpus.empty()) {
+        latch = bsl::allocate_shared<bslmt::Latch>(d_allocator_p,
+                                                   d_numThreads);
+    }
+
+    bslmt::ThreadAttributes attributes(d_threadAttributes, d_allocator_p);
+    bsl::vector<int>        workerCpu(1, 0, d_allocator_p);
+
+    for (int i = 0; i < d_numThreads; ++i)  {
+        if (latch) {
+            workerCpu[0] = cpus[i % cpus.size()];
+            attributes.setCpuAffinity(workerCpu);
+        }
+
+        if (0 != startNewThread(i, attributes, latch)) {
+            {
+                bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+                d_exitFlag = true;
+                d_workCondition.broadcast();
+            }
+
+            if (latch) {
+                latch->countDown(d_numThreads - i);
+            }
+
+            d_threadGroup.joinAll();
+            return -1;                                                // RETURN
+        }
+    }
+
+    if (latch) {
+        latch->wait();
+    }
+
+    enable();
+
+    return 0;
+}
+
+void WorkStealingThreadPool::stop()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (isStarted()) {
+        disable();
+
+        waitUntilEmpty();
+
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            d_exitFlag = true;
+            d_workCondition.broadcast();
+        }
+
+        d_threadGroup.joinAll();
+    }
+}
+
+// ACCESSORS
+bool WorkStealingThreadPool::isWorkerThread() const
+{
+    return this == t_currentPool;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
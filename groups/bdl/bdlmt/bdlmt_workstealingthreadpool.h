@@ -0,0 +1,862 @@
+// bdlmt_workstealingthreadpool.h                                     -*-C++-*-
+#ifndef INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+#define INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fixed-size pool of threads with work-stealing queues.
+//
+//@CLASSES:
+//   bdlmt::WorkStealingThreadPool: fixed-size thread pool with work stealing
+//
+//@METRICS:
+//
+// * `bde.backlog`
+//   > number of pending jobs minus number of "idle" threads in the thread pool
+//   > (may be negative)
+//
+// Associated Metric Attributes:
+//  * object type name: "bdlmt.workstealingthreadpool"
+//  * object type abbreviation: "wstp"
+//
+//@SEE_ALSO: bdlmt_fixedthreadpool, bdlmt_threadpool
+//
+//@DESCRIPTION: This component defines a thread pool,
+// `bdlmt::WorkStealingThreadPool`, that executes user-defined functions
+// ("jobs") on a fixed number of processing threads, and that, unlike
+// `bdlmt::FixedThreadPool` and `bdlmt::ThreadPool`, does not dispatch all jobs
+// through a single shared queue.  Instead, each processing thread ("worker")
+// owns a double-ended queue of jobs (a "Chase-Lev" deque):
+//
+// * A job enqueued by a job executing on a worker of the pool (a "local
+//   submission") is pushed onto the deque of that worker without acquiring a
+//   lock.
+// * A worker takes its next job from its own deque, in last-in, first-out
+//   order, without acquiring a lock (unless a single job remains).
+// * A worker whose deque is empty takes the oldest job enqueued by a thread
+//   that is not a worker of the pool (an "external submission"), and, if
+//   there is none, "steals" the oldest job from the deque of another worker,
+//   chosen at random.
+// * A worker that finds no job to execute blocks until a job is enqueued.
+//
+// Consequently, when jobs are short-lived and enqueue further jobs (e.g.,
+// recursive divide-and-conquer algorithms), workers rarely contend with one
+// another, and the pool scales far better than pools having a single shared
+// queue.  When all jobs are submitted by threads that are not workers of the
+// pool, jobs are distributed from a single queue protected by a mutex, and the
+// pool behaves much like a `bdlmt::FixedThreadPool`.
+//
+// Note that jobs are not executed in the order in which they are enqueued:
+// jobs enqueued by a job are, in general, executed before jobs enqueued
+// earlier by other threads.  Clients requiring first-in, first-out execution
+// should use `bdlmt::FixedThreadPool`.
+//
+// The capacity of the deque of each worker is fixed (see
+// `k_LOCAL_QUEUE_CAPACITY`); a local submission to a worker whose deque is
+// full is enqueued as an external submission.  The number of pending jobs is
+// not bounded, and enqueuing a job never blocks.
+//
+// As with the other thread pools in `bdlmt`, jobs can be specified using the
+// "void function/void pointer" interface or the functor-based interface, and
+// the pool is started by `start`, and is drained, stopped, or shut down by
+// `drain`, `stop`, or `shutdown`, respectively.  An application can specify
+// the attributes of the threads in the pool (e.g., stack size or thread name)
+// by providing a `bslmt::ThreadAttributes` object.  If no thread name is
+// specified, "bdl.WSPool" is used.
+//
+///Pinned Workers
+///--------------
+// A pool can be configured (see `setWorkerPinning`) to pin each of its workers
+// to a single processor when it is started, so that the operating system never
+// migrates a worker, and the caches of each processor remain warm with the
+// data of the jobs executed on it.  The workers are distributed, round-robin,
+// over the processors:
+//
+// * listed by the `cpuAffinity` attribute of the thread attributes supplied at
+//   construction, if not empty, otherwise
+// * of the NUMA node specified by the `numaNode` attribute of those thread
+//   attributes, if set, otherwise
+// * on which the thread invoking `start` may execute.
+//
+// In addition, each pinned worker allocates its own deque once it executes on
+// its processor, so that, with allocators and operating systems that place
+// memory on the node of the thread first touching it, the state accessed most
+// frequently by a worker is local to its node.  Note that pinning is only
+// effective on platforms supporting processor affinity (see
+// `bslmt_threadutil`), and is a poor choice when the processors are shared
+// with other busy processes.
+//
+///Enqueuing While Disabled
+///------------------------
+// `disable` (and `stop`) prevent threads that are not workers of the pool from
+// enqueuing jobs, but a job executing on a started pool can always enqueue
+// further jobs.  This ensures that `drain` and `stop` wait until the work
+// represented by the jobs already enqueued, including the jobs they enqueue
+// recursively, has completed.
+//
+///Thread Safety
+///-------------
+// The `bdlmt::WorkStealingThreadPool` class is both *fully thread-safe* (i.e.,
+// all non-creator methods can correctly execute concurrently), and is
+// *thread-enabled* (i.e., the class does not function correctly in a
+// non-multi-threading environment).  See `bsldoc_glossary` for complete
+// definitions of *fully thread-safe* and *thread-enabled*.
+//
+///Synchronous Signals on Unix
+///---------------------------
+// As with `bdlmt::FixedThreadPool`, on unix platforms, all the threads in the
+// pool block all asynchronous signals, i.e., all signals except `SIGBUS`,
+// `SIGFPE`, `SIGILL`, `SIGSEGV`, `SIGSYS`, `SIGABRT`, `SIGTRAP`, and `SIGIOT`.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recursive Summation
+/// - - - - - - - - - - - - - - -
+// In this example we use a `bdlmt::WorkStealingThreadPool` to sum the elements
+// of an array by recursively splitting the array in halves, each half being
+// summed by a separate job.  Such fine-grained jobs are a poor fit for a pool
+// having a single shared queue, as the cost of the queue operations dominates
+// the cost of the jobs.
+//
+// First, we define a structure describing the summation of a range, and the
+// function summing it.  Ranges longer than a threshold are split, one half
+// being summed by a job enqueued on the pool, and the other by the current
+// job.  The partial sums are accumulated atomically:
+// ```
+//  struct SumJob {
+//      bdlmt::WorkStealingThreadPool *d_pool_p;    // pool executing the job
+//      const int                     *d_begin_p;   // first element to sum
+//      const int                     *d_end_p;     // one past the last
+//      bsls::AtomicInt64             *d_sum_p;     // accumulated sum
+//
+//      void operator()() const
+//      {
+//          const int *begin = d_begin_p;
+//          const int *end   = d_end_p;
+//
+//          while (end - begin > 1024) {
+//              const int *middle = begin + (end - begin) / 2;
+//
+//              SumJob job = { d_pool_p, middle, end, d_sum_p };
+//              d_pool_p->enqueueJob(job);
+//
+//              end = middle;
+//          }
+//
+//          bsls::Types::Int64 sum = 0;
+//          for (; begin != end; ++begin) {
+//              sum += *begin;
+//          }
+//          d_sum_p->add(sum);
+//      }
+//  };
+// ```
+// Then, we create and start a pool:
+// ```
+//  bdlmt::WorkStealingThreadPool pool(4);
+//  int rc = pool.start();
+//  assert(0 == rc);
+// ```
+// Next, we create the data to sum:
+// ```
+//  bsl::vector<int> data(1000000);
+//  for (bsl::size_t i = 0; i < data.size(); ++i) {
+//      data[i] = static_cast<int>(i % 100);
+//  }
+// ```
+// Now, we enqueue a single job summing the whole array, and wait for the pool
+// to be drained.  Note that `drain` waits for all the jobs enqueued by the
+// initial job as well:
+// ```
+//  bsls::AtomicInt64 sum(0);
+//
+//  SumJob job = { &pool, data.data(), data.data() + data.size(), &sum };
+//  pool.enqueueJob(job);
+//  pool.drain();
+// ```
+// Finally, we verify the result:
+// ```
+//  assert(49500000 == sum);
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdlf_bind.h>
+
+#include <bdlm_metricsregistry.h>
+
+#include <bdlma_concurrentpool.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_latch.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_deque.h>
+#include <bsl_functional.h>
+#include <bsl_memory.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <bsl_c_signal.h>              // sigset_t
+#endif
+
+namespace BloombergLP {
+namespace bdlmt {
+
+/// This type declares the prototype for functions that are suitable to be
+/// specified `bdlmt::WorkStealingThreadPool::enqueueJob`.
+extern "C" typedef void (*WorkStealingThreadPoolJobFunc)(void *);
+
+                    // ===================================
+                    // class WorkStealingThreadPool_Deque
+                    // ===================================
+
+/// This component-private class implements a fixed-capacity Chase-Lev
+/// work-stealing deque of pointers to `bsl::function<void()>` objects.  A
+/// single thread, the owner, may invoke `pushBottom` and `popBottom`; any
+/// thread may invoke `steal`, and the accessors.  The deque does not own the
+/// pointed-to objects.
+class WorkStealingThreadPool_Deque {
+
+  public:
+    // TYPES
+    typedef bsl::function<void()> Job;
+
+  private:
+    // DATA
+    bsls::AtomicInt64             d_top;         // index of the oldest
+                                                 // element; incremented by
+                                                 // `steal`
+
+    char                          d_pad[bslmt::Platform::e_CACHE_LINE_SIZE];
+                                                 // separates `d_top` and
+                                                 // `d_bottom` to avoid false
+                                                 // sharing
+
+    bsls::AtomicInt64             d_bottom;      // index one past the newest
+                                                 // element; modified only by
+                                                 // the owner
+
+    bsls::AtomicPointer<Job>     *d_buffer_p;    // circular buffer of
+                                                 // `d_capacity` elements
+
+    const bsls::Types::Int64      d_capacity;    // capacity of `d_buffer_p`,
+                                                 // a power of 2
+
+    bslma::Allocator             *d_allocator_p; // memory allocator (held,
+                                                 // not owned)
+
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool_Deque(const WorkStealingThreadPool_Deque&);
+    WorkStealingThreadPool_Deque& operator=(
+                                          const WorkStealingThreadPool_Deque&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(WorkStealingThreadPool_Deque,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+
+    /// Create an empty deque having the specified `capacity`.  Optionally
+    /// specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.  The behavior is undefined unless `capacity` is a positive
+    /// power of 2.
+    explicit WorkStealingThreadPool_Deque(
+                                        int               capacity,
+                                        bslma::Allocator *basicAllocator = 0);
+
+    /// Destroy this object.
+    ~WorkStealingThreadPool_Deque();
+
+    // MANIPULATORS
+
+    /// Remove the newest element from this deque, and return it, or return
+    /// 0 if this deque is empty.  The behavior is undefined unless this
+    /// method is invoked by the owner of this deque.
+    Job *popBottom();
+
+    /// Append the specified `job` as the newest element of this deque.
+    /// Return 0 on success, and a non-zero value, with no effect, if this
+    /// deque is full.  The behavior is undefined unless this method is
+    /// invoked by the owner of this deque and `0 != job`.
+    int pushBottom(Job *job);
+
+    /// Remove the oldest element from this deque, and return it, or return
+    /// 0 if this deque is empty or the element was concurrently removed by
+    /// another thread.
+    Job *steal();
+
+    // ACCESSORS
+
+    /// Return the capacity of this deque.
+    int capacity() const;
+
+    /// Return a snapshot of the number of elements in this deque.
+    int numElements() const;
+};
+
+                       // ============================
+                       // class WorkStealingThreadPool
+                       // ============================
+
+/// This class implements a thread pool, having a fixed number of threads,
+/// in which each thread owns a work-stealing deque of jobs.
+class WorkStealingThreadPool {
+
+  public:
+    // TYPES
+    typedef bsl::function<void()> Job;
+
+    // PUBLIC CONSTANTS
+    enum {
+        e_SUCCESS  =  0,
+        e_DISABLED = -3,
+        e_FAILED   = -4
+    };
+
+    enum {
+        k_LOCAL_QUEUE_CAPACITY = 4096  // capacity of the deque of a worker
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef WorkStealingThreadPool_Deque Deque;
+
+    // PRIVATE CLASS DATA
+    static const char       s_defaultThreadName[16];  // Thread name to use
+                                                      // when none is
+                                                      // specified.
+
+    // PRIVATE DATA
+    bdlma::ConcurrentPool   d_jobPool;            // pool supplying the
+                                                  // memory of enqueued jobs
+
+    bsl::vector<Deque *>    d_deques;             // deque of each worker
+                                                  // (owned)
+
+    bsl::deque<Job *>       d_externalQueue;      // jobs enqueued by threads
+                                                  // that are not workers
+
+    mutable bslmt::Mutex    d_externalMutex;      // protects
+                                                  // `d_externalQueue` and
+                                                  // `d_enabledFlag`
+
+    bsls::AtomicInt         d_numExternalJobs;    // number of elements of
+                                                  // `d_externalQueue`
+
+    bsls::AtomicInt         d_numPendingJobs;     // number of jobs enqueued
+                                                  // and not yet started
+
+    bsls::AtomicInt         d_numIncompleteJobs;  // number of jobs enqueued
+                                                  // and not yet completed
+
+    bsls::AtomicInt         d_numActiveThreads;   // number of threads
+                                                  // processing jobs
+
+    bsls::AtomicInt         d_numIdleThreads;     // number of threads
+                                                  // blocked waiting for jobs
+
+    bool                    d_enabledFlag;        // `true` if threads that
+                                                  // are not workers may
+                                                  // enqueue (protected by
+                                                  // `d_externalMutex`)
+
+    bsls::AtomicBool        d_exitFlag;           // set to make the workers
+                                                  // exit
+
+    bslmt::Mutex            d_mutex;              // protects the waiting on
+                                                  // `d_workCondition` and
+                                                  // `d_drainCondition`
+
+    bslmt::Condition        d_workCondition;      // signaled when a job is
+                                                  // enqueued
+
+    bslmt::Condition        d_drainCondition;     // signaled when the last
+                                                  // incomplete job completes
+
+    bslmt::Mutex            d_metaMutex;          // mutex to ensure that there
+                                                  // is only one controlling
+                                                  // thread at any time
+
+    bslmt::ThreadGroup      d_threadGroup;        // threads used by this pool
+
+    bslmt::ThreadAttributes d_threadAttributes;   // thread attributes to be
+                                                  // used when constructing
+                                                  // processing threads
+
+    const int               d_numThreads;         // number of configured
+                                                  // processing threads
+
+    bsls::AtomicBool        d_workerPinningFlag;  // `true` if the workers are
+                                                  // pinned to processors when
+                                                  // the pool is started
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    sigset_t                d_blockSet;           // set of signals to be
+                                                  // blocked in managed threads
+#endif
+
+    bslma::Allocator       *d_allocator_p;        // memory allocator (held,
+                                                  // not owned)
+
+    bdlm::MetricsRegistryRegistrationHandle
+                            d_backlogHandle;      // backlog metric handle
+
+    // PRIVATE MANIPULATORS
+
+    /// Return a job to be executed by the worker having the specified
+    /// `index`, removing it from the deque of that worker, from the queue of
+    /// external submissions, or from the deque of another worker, chosen
+    /// using the specified `randomState`, or return 0 if no job was found.
+    Job *findJob(int index, unsigned int *randomState);
+
+    /// Initialize this thread pool using the stored attributes and the
+    /// specified `metricsRegistry` and `threadPoolName`.  If
+    /// `metricsRegistry` is 0, `bdlm::MetricsRegistry::defaultInstance()` is
+    /// used.
+    void initialize(bdlm::MetricsRegistry   *metricsRegistry,
+                    const bsl::string_view&  threadPoolName);
+
+    /// Enqueue the specified `job`, allocated from `d_jobPool`, onto the
+    /// deque of the calling thread if it is a worker of this pool, and onto
+    /// the queue of external submissions otherwise.  Return 0 on success,
+    /// and `e_DISABLED`, destroying `job`, if the calling thread is not a
+    /// worker of this pool and `!isEnabled()`.
+    int pushJob(Job *job);
+
+    /// Remove and destroy every pending job.  The behavior is undefined
+    /// unless no worker is running.
+    void removeAll();
+
+    /// Internal method to spawn a new processing thread having the
+    /// specified `index` and `attributes`, and the specified `latch` (see
+    /// `workerThread`).  Note that this method must be called with
+    /// `d_metaMutex` locked.
+    int startNewThread(int                                   index,
+                       const bslmt::ThreadAttributes&        attributes,
+                       const bsl::shared_ptr<bslmt::Latch>&  latch);
+
+    /// The main function executed by the worker having the specified
+    /// `index`.  If the specified `latch` is not empty, replace the deque of
+    /// the worker with one allocated by the worker, then arrive at `latch`
+    /// and wait for all the workers before executing any job.  Note that
+    /// `latch` is shared so that it outlives the workers waiting on it.
+    void workerThread(int                                  index,
+                      const bsl::shared_ptr<bslmt::Latch>& latch);
+
+    /// Block until there are no incomplete jobs.
+    void waitUntilEmpty();
+
+  private:
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool(const WorkStealingThreadPool&);
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&);
+
+  public:
+    // CREATORS
+
+    /// Construct a thread pool with the specified `numThreads` number of
+    /// threads.  Optionally specify a `basicAllocator` used to supply
+    /// memory.  If `basicAllocator` is 0, the currently installed default
+    /// allocator is used.  The name used for created threads is
+    /// "bdl.WSPool".  The behavior is undefined unless `1 <= numThreads`.
+    explicit WorkStealingThreadPool(int               numThreads,
+                                    bslma::Allocator *basicAllocator = 0);
+
+    /// Construct a thread pool with the specified `numThreads` number of
+    /// threads, the specified `threadPoolName` to be used to identify this
+    /// thread pool, and the specified `metricsRegistry` to be used for
+    /// reporting metrics.  If `metricsRegistry` is 0,
+    /// `bdlm::MetricsRegistry::defaultInstance()` is used.  Optionally
+    /// specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.  The name used for created threads is `threadPoolName` if not
+    /// empty, otherwise "bdl.WSPool".  The behavior is undefined unless
+    /// `1 <= numThreads`.
+    WorkStealingThreadPool(int                      numThreads,
+                           const bsl::string_view&  threadPoolName,
+                           bdlm::MetricsRegistry   *metricsRegistry,
+                           bslma::Allocator        *basicAllocator = 0);
+
+    /// Construct a thread pool with the specified `threadAttributes` and
+    /// `numThreads` number of threads.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.  The name used for
+    /// created threads is `threadAttributes.threadName()` if not empty,
+    /// otherwise "bdl.WSPool".  The detached state of `threadAttributes` is
+    /// ignored, and `e_CREATE_JOINABLE` is used in all cases.  The behavior
+    /// is undefined unless `1 <= numThreads`.
+    WorkStealingThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
+                           int                             numThreads,
+                           bslma::Allocator               *basicAllocator = 0);
+
+    /// Construct a thread pool with the specified `threadAttributes`,
+    /// `numThreads` number of threads, the specified `threadPoolName` to be
+    /// used to identify this thread pool, and the specified
+    /// `metricsRegistry` to be used for reporting metrics.  If
+    /// `metricsRegistry` is 0, `bdlm::MetricsRegistry::defaultInstance()` is
+    /// used.  Optionally specify a `basicAllocator` used to supply memory.
+    /// If `basicAllocator` is 0, the currently installed default allocator
+    /// is used.  The name used for created threads is
+    /// `threadAttributes.threadName()` if not empty, otherwise
+    /// `threadPoolName` if not empty, otherwise "bdl.WSPool".  The detached
+    /// state of `threadAttributes` is ignored, and `e_CREATE_JOINABLE` is
+    /// used in all cases.  The behavior is undefined unless
+    /// `1 <= numThreads`.
+    WorkStealingThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
+                           int                             numThreads,
+                           const bsl::string_view&         threadPoolName,
+                           bdlm::MetricsRegistry          *metricsRegistry,
+                           bslma::Allocator               *basicAllocator = 0);
+
+    /// Remove all pending jobs without executing them, block until all
+    /// currently running jobs complete, and then destroy this thread pool.
+    ~WorkStealingThreadPool();
+
+    // MANIPULATORS
+
+    /// Disable enqueueing into this pool by threads that are not workers of
+    /// this pool.  All subsequent invocations of `enqueueJob` from such
+    /// threads will fail immediately.  If the pool is already enqueue
+    /// disabled, this method has no effect.  Note that this method has no
+    /// effect on jobs currently in the pool, nor on jobs enqueued by jobs
+    /// executing on this pool.  See {Enqueuing While Disabled}.
+    void disable();
+
+    /// Enable queuing into this pool.  If the pool is not enqueue disabled,
+    /// this call has no effect.
+    void enable();
+
+    /// Enqueue the specified `functor` to be executed by a thread of this
+    /// pool.  If the calling thread is a worker of this pool, `functor` is
+    /// enqueued onto the deque of that worker.  Return 0 on success, and a
+    /// non-zero value otherwise.  Specifically, return `e_SUCCESS` on
+    /// success, `e_DISABLED` if the calling thread is not a worker of this
+    /// pool and `!isEnabled()`, and `e_FAILED` if an error occurs.  This
+    /// method never blocks.  The behavior is undefined unless `functor` is
+    /// not null.
+    int enqueueJob(const Job& functor);
+    int enqueueJob(bslmf::MovableRef<Job> functor);
+
+    /// Enqueue the specified `function` to be executed by a thread of this
+    /// pool.  The specified `userData` pointer will be passed to the
+    /// function by the processing thread.  Return 0 on success, and a
+    /// non-zero value otherwise.  Specifically, return `e_SUCCESS` on
+    /// success, `e_DISABLED` if the calling thread is not a worker of this
+    /// pool and `!isEnabled()`, and `e_FAILED` if an error occurs.  This
+    /// method never blocks.  The behavior is undefined unless `function` is
+    /// not null.
+    int enqueueJob(WorkStealingThreadPoolJobFunc function, void *userData);
+
+    /// Wait until all enqueued jobs, including the jobs they enqueue, have
+    /// completed, without disabling this pool (and may thus wait
+    /// indefinitely).  If the thread pool was not already started
+    /// (`isStarted()` is `false`), this method has no effect.  The behavior
+    /// is undefined if this method is invoked by a job executing on this
+    /// pool.  Note that if any jobs are submitted concurrently with this
+    /// method by threads that are not workers of this pool, this method may
+    /// or may not wait until they have also completed.
+    void drain();
+
+    /// Set whether the workers of this pool are pinned to processors to the
+    /// specified `value` (see {Pinned Workers}).  The new value takes effect
+    /// the next time this pool is started.  By default, workers are not
+    /// pinned.
+    void setWorkerPinning(bool value);
+
+    /// Disable enqueuing jobs on this thread pool, cancel all pending jobs,
+    /// wait until all active jobs complete, and join all processing
+    /// threads.  If the thread pool was not already started (`isStarted()`
+    /// is `false`), this method has no effect.  At the completion of this
+    /// method, `false == isStarted()`.  The behavior is undefined if this
+    /// method is invoked by a job executing on this pool.
+    void shutdown();
+
+    /// Spawn threads until there are `numThreads()` processing threads.  On
+    /// success, enable enqueuing and return 0.  Otherwise, join all threads
+    /// (ensuring `false == isStarted()`) and return -1.  If the thread pool
+    /// was already started (`isStarted()` is `true`), this method has no
+    /// effect.
+    int start();
+
+    /// Disable enqueuing jobs on this thread pool, wait until all active
+    /// and pending jobs, including the jobs they enqueue, complete, and join
+    /// all processing threads.  If the thread pool was not already started
+    /// (`isStarted()` is `false`), this method has no effect.  At the
+    /// completion of this method, `false == isStarted()`.  The behavior is
+    /// undefined if this method is invoked by a job executing on this pool.
+    void stop();
+
+    // ACCESSORS
+
+    /// Return `true` if enqueuing jobs by threads that are not workers of
+    /// this pool is enabled, and `false` otherwise.
+    bool isEnabled() const;
+
+    /// Return `true` if `numThreads()` are started on this threadpool and
+    /// `false` otherwise (indicating that 0 threads are started on this
+    /// thread pool.)
+    bool isStarted() const;
+
+    /// Return `true` if the calling thread is a worker of this thread pool,
+    /// and `false` otherwise.
+    bool isWorkerThread() const;
+
+    /// Return a snapshot of the number of threads that are currently
+    /// processing a job for this threadpool.
+    int numActiveThreads() const;
+
+    /// Return a snapshot of the number of jobs currently enqueued to be
+    /// processed by thread pool.
+    int numPendingJobs() const;
+
+    /// Return the number of threads passed to this thread pool at
+    /// construction.
+    int numThreads() const;
+
+    /// Return a snapshot of the number of threads currently started by this
+    /// thread pool.
+    int numThreadsStarted() const;
+
+    /// Return `true` if the workers of this pool are pinned to processors
+    /// when it is started, and `false` otherwise.
+    bool workerPinning() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                    // -----------------------------------
+                    // class WorkStealingThreadPool_Deque
+                    // -----------------------------------
+
+// MANIPULATORS
+inline
+WorkStealingThreadPool_Deque::Job *WorkStealingThreadPool_Deque::popBottom()
+{
+    // Reserve the newest element by decrementing `d_bottom` before reading
+    // `d_top`; the sequentially consistent operations ensure that a
+    // concurrent `steal` either observes the decrement or is observed here.
+
+    const bsls::Types::Int64 bottom = d_bottom.loadRelaxed() - 1;
+    d_bottom.store(bottom);
+
+    bsls::Types::Int64 top = d_top.load();
+
+    if (top > bottom) {
+        // The deque was empty.
+
+        d_bottom.storeRelaxed(bottom + 1);
+        return 0;                                                     // RETURN
+    }
+
+    Job *job = d_buffer_p[bottom & (d_capacity - 1)].loadRelaxed();
+
+    if (top == bottom) {
+        // This is the last element; race with `steal` to claim it.
+
+        if (top != d_top.testAndSwap(top, top + 1)) {
+            job = 0;
+        }
+        d_bottom.storeRelaxed(bottom + 1);
+    }
+
+    return job;
+}
+
+inline
+int WorkStealingThreadPool_Deque::pushBottom(Job *job)
+{
+    BSLS_ASSERT(job);
+
+    const bsls::Types::Int64 bottom = d_bottom.loadRelaxed();
+    const bsls::Types::Int64 top    = d_top.loadAcquire();
+
+    if (bottom - top >= d_capacity) {
+        return -1;                                                    // RETURN
+    }
+
+    d_buffer_p[bottom & (d_capacity - 1)].storeRelaxed(job);
+    d_bottom.storeRelease(bottom + 1);
+
+    return 0;
+}
+
+inline
+WorkStealingThreadPool_Deque::Job *WorkStealingThreadPool_Deque::steal()
+{
+    const bsls::Types::Int64 top    = d_top.load();
+    const bsls::Types::Int64 bottom = d_bottom.load();
+
+    if (top >= bottom) {
+        return 0;                                                     // RETURN
+    }
+
+    Job *job = d_buffer_p[top & (d_capacity - 1)].loadRelaxed();
+
+    if (top != d_top.testAndSwap(top, top + 1)) {
+        return 0;                                                     // RETURN
+    }
+
+    return job;
+}
+
+// ACCESSORS
+inline
+int WorkStealingThreadPool_Deque::capacity() const
+{
+    return static_cast<int>(d_capacity);
+}
+
+inline
+int WorkStealingThreadPool_Deque::numElements() const
+{
+    const bsls::Types::Int64 top    = d_top.loadAcquire();
+    const bsls::Types::Int64 bottom = d_bottom.loadAcquire();
+
+    return bottom > top ? static_cast<int>(bottom - top) : 0;
+}
+
+                       // ----------------------------
+                       // class WorkStealingThreadPool
+                       // ----------------------------
+
+// MANIPULATORS
+inline
+void WorkStealingThreadPool::disable()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_externalMutex);
+
+    d_enabledFlag = false;
+}
+
+inline
+void WorkStealingThreadPool::enable()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_externalMutex);
+
+    d_enabledFlag = true;
+}
+
+inline
+void WorkStealingThreadPool::setWorkerPinning(bool value)
+{
+    d_workerPinningFlag = value;
+}
+
+inline
+int WorkStealingThreadPool::enqueueJob(const Job& functor)
+{
+    BSLS_ASSERT(functor);
+
+    return pushJob(new (d_jobPool) Job(bsl::allocator_arg,
+                                       d_allocator_p,
+                                       functor));
+}
+
+inline
+int WorkStealingThreadPool::enqueueJob(bslmf::MovableRef<Job> functor)
+{
+    BSLS_ASSERT(bslmf::MovableRefUtil::access(functor));
+
+    return pushJob(new (d_jobPool) Job(bsl::allocator_arg,
+                                       d_allocator_p,
+                                       bslmf::MovableRefUtil::move(functor)));
+}
+
+inline
+int WorkStealingThreadPool::enqueueJob(WorkStealingThreadPoolJobFunc  function,
+                                       void                          *userData)
+{
+    BSLS_ASSERT(0 != function);
+
+    return enqueueJob(bdlf::BindUtil::bindR<void>(function, userData));
+}
+
+// ACCESSORS
+inline
+bool WorkStealingThreadPool::isEnabled() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_externalMutex);
+
+    return d_enabledFlag;
+}
+
+inline
+bool WorkStealingThreadPool::isStarted() const
+{
+    return d_numThreads == d_threadGroup.numThreads();
+}
+
+inline
+int WorkStealingThreadPool::numActiveThreads() const
+{
+    return d_numActiveThreads.loadAcquire();
+}
+
+inline
+int WorkStealingThreadPool::numPendingJobs() const
+{
+    return d_numPendingJobs.loadAcquire();
+}
+
+inline
+int WorkStealingThreadPool::numThreads() const
+{
+    return d_numThreads;
+}
+
+inline
+int WorkStealingThreadPool::numThreadsStarted() const
+{
+    return d_threadGroup.numThreads();
+}
+
+inline
+bool WorkStealingThreadPool::workerPinning() const
+{
+    return d_workerPinningFlag;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
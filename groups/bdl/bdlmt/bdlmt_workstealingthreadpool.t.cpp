@@ -0,0 +1,1515 @@
+// bdlmt_workstealingthreadpool.t.cpp                                 -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bdlmt_fixedthreadpool.h>
+
+#include <bdlm_instancecount.h>
+#include <bdlm_metricdescriptor.h>
+#include <bdlm_metricsadapter.h>
+#include <bdlm_metricsregistry.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_latch.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_testutil.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+#include <bslmt_timedcompletionguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_format.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              OVERVIEW
+// A work-stealing thread pool dispatches jobs onto a fixed number of threads,
+// each owning a Chase-Lev deque.  We first test the component-private deque,
+// single-threaded and then with concurrent thieves, verifying that every
+// element is removed exactly once.  We then test that the pool can be
+// started, stopped, drained, and shut down, that jobs enqueued by threads
+// that are not workers, and jobs enqueued recursively by jobs, are all
+// executed, that `drain` and `stop` wait for recursively enqueued jobs, and
+// that the metrics and thread names are set as for `bdlmt::FixedThreadPool`.
+//
+// A negative test case -1 compares the throughput of this pool with that of
+// `bdlmt::FixedThreadPool` for fine-grained recursive jobs.
+// ----------------------------------------------------------------------------
+// WorkStealingThreadPool_Deque
+// [ 2] WorkStealingThreadPool_Deque(int capacity, *bA);
+// [ 2] Job *popBottom();
+// [ 2] int pushBottom(Job *job);
+// [ 2] Job *steal();
+// [ 2] int capacity() const;
+// [ 2] int numElements() const;
+//
+// WorkStealingThreadPool
+// [ 4] WorkStealingThreadPool(numThreads, *bA);
+// [ 4] WorkStealingThreadPool(nT, name, *mR, *bA);
+// [ 4] WorkStealingThreadPool(attributes, nT, *bA);
+// [ 4] WorkStealingThreadPool(attributes, nT, name, *mR, *bA);
+// [ 4] ~WorkStealingThreadPool();
+// [ 5] void disable();
+// [ 5] void enable();
+// [ 5] int enqueueJob(const Job&);
+// [ 5] int enqueueJob(bslmf::MovableRef<Job>);
+// [ 5] int enqueueJob(WorkStealingThreadPoolJobFunc, void *);
+// [ 5] int start();
+// [ 5] void drain();
+// [ 7] void shutdown();
+// [ 6] void stop();
+// [ 5] bool isEnabled() const;
+// [ 5] bool isStarted() const;
+// [ 6] bool isWorkerThread() const;
+// [ 7] int numActiveThreads() const;
+// [ 7] int numPendingJobs() const;
+// [ 4] int numThreads() const;
+// [ 5] int numThreadsStarted() const;
+// [ 9] void setWorkerPinning(bool value);
+// [ 9] bool workerPinning() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCURRENT `steal` AND `popBottom`
+// [ 6] CONCERN: `drain` and `stop` wait for recursively enqueued jobs
+// [ 8] THREAD NAMES
+// [ 9] PINNED WORKERS
+// [10] USAGE EXAMPLE
+// [-1] PERFORMANCE: FINE-GRAINED RECURSIVE JOBS
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT                   BSLMT_TESTUTIL_ASSERT
+#define ASSERTV                  BSLMT_TESTUTIL_ASSERTV
+
+#define Q                        BSLMT_TESTUTIL_Q
+#define P                        BSLMT_TESTUTIL_P
+#define P_                       BSLMT_TESTUTIL_P_
+#define T_                       BSLMT_TESTUTIL_T_
+#define L_                       BSLMT_TESTUTIL_L_
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::WorkStealingThreadPool       Obj;
+typedef bdlmt::WorkStealingThreadPool_Deque Deque;
+typedef Obj::Job                            Job;
+
+// ============================================================================
+//                           GLOBAL VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+int test;
+int verbose;
+int veryVerbose;
+int veryVeryVerbose;
+
+// ============================================================================
+//                             DEFAULT ALLOCATOR
+// ----------------------------------------------------------------------------
+
+bslma::TestAllocator taDefault;
+
+// ============================================================================
+//                       GLOBAL CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+                         // ========================
+                         // class TestMetricsAdapter
+                         // ========================
+
+/// This class implements a pure abstract interface for clients and
+/// suppliers of metrics adapters.  The implementation does not register
+/// callbacks with any monitoring system, but does track registrations to
+/// enable testing of thread-enabled objects metric registration.
+class TestMetricsAdapter : public bdlm::MetricsAdapter {
+
+    // DATA
+    bsl::vector<bdlm::MetricDescriptor> d_descriptors;
+    bsl::set<int>                       d_handles;
+
+  public:
+    // CREATORS
+
+    /// Create a `TestMetricsAdapter`.
+    TestMetricsAdapter();
+
+    /// Destroy this object.
+    ~TestMetricsAdapter() BSLS_KEYWORD_OVERRIDE;
+
+    // MANIPULATORS
+
+    /// Do nothing with the specified `metricsDescriptor` and `callback`.
+    /// Return a callback handle that will be verified in
+    /// `removeCollectionCallback`.
+    CallbackHandle registerCollectionCallback(
+                 const bdlm::MetricDescriptor& metricDescriptor,
+                 const Callback&               callback) BSLS_KEYWORD_OVERRIDE;
+
+    /// Do nothing with the specified `handle`.  Assert the supplied
+    /// `handle` matches what was provided by `registerCollectionCallback`.
+    /// Return 0.
+    int removeCollectionCallback(const CallbackHandle& handle)
+                                                         BSLS_KEYWORD_OVERRIDE;
+
+    /// Return this object to its constructed state.
+    void reset();
+
+    // ACCESSORS
+
+    /// Return `true` if the registered descriptors match the ones expected
+    /// for the supplied `name` and the provided callback handles were
+    /// removed, and `false` otherwise.
+    bool verify(const bsl::string& name) const;
+};
+
+                         // ------------------------
+                         // class TestMetricsAdapter
+                         // ------------------------
+
+// CREATORS
+TestMetricsAdapter::TestMetricsAdapter()
+{
+}
+
+TestMetricsAdapter::~TestMetricsAdapter()
+{
+}
+
+// MANIPULATORS
+bdlm::MetricsAdapter::CallbackHandle
+                                TestMetricsAdapter::registerCollectionCallback(
+                                const bdlm::MetricDescriptor& metricDescriptor,
+                                const Callback&               /* callback */)
+{
+    d_descriptors.push_back(metricDescriptor);
+
+    int h = 7 + static_cast<int>(d_descriptors.size());
+    d_handles.insert(h);
+
+    return h;
+}
+
+int TestMetricsAdapter::removeCollectionCallback(const CallbackHandle& handle)
+{
+    d_handles.erase(handle);
+    return 0;
+}
+
+void TestMetricsAdapter::reset()
+{
+    d_descriptors.clear();
+    d_handles.clear();
+}
+
+// ACCESSORS
+bool TestMetricsAdapter::verify(const bsl::string& name) const
+{
+    static bdlm::InstanceCount::Value count = 0;
+
+    ++count;
+
+    ASSERT(d_handles.empty());
+    ASSERT(1 == d_descriptors.size());
+
+    return d_handles.empty()
+        && 1 == d_descriptors.size()
+        && d_descriptors[0].metricNamespace()        == ""
+        && d_descriptors[0].metricName()             == "bde.backlog"
+        && d_descriptors[0].objectTypeAbbreviation() == "wstp"
+        && d_descriptors[0].objectTypeName()         ==
+                                               "bdlmt.workstealingthreadpool"
+        && d_descriptors[0].instanceNumber()         == count
+        && d_descriptors[0].objectIdentifier()       == name;
+}
+
+namespace THREAD_NAMES_TEST {
+
+/// Check that the name of the current thread matches `expectedThreadName`,
+/// where `expectedThreadName` is the specified `arg`.
+void threadNameCheckJob(void *arg)
+{
+    const char *expectedThreadName = static_cast<const char *>(arg);
+
+    bsl::string name;
+    bslmt::ThreadUtil::getThreadName(&name);
+#if defined(BSLS_PLATFORM_OS_LINUX) ||  defined(BSLS_PLATFORM_OS_DARWIN) ||   \
+    defined(BSLS_PLATFORM_OS_SOLARIS)
+    ASSERTV(expectedThreadName, name, expectedThreadName == name);
+#elif defined(BSLS_PLATFORM_OS_WINDOWS)
+    // The threadname will only be visible if we're running on Windows 10,
+    // version 1607 or later, otherwise it will be empty.
+
+    ASSERTV(expectedThreadName, name, expectedThreadName == name ||
+                                                                 name.empty());
+#else
+    // Platform doesn't support thread names.
+
+    ASSERTV(name, name.empty());
+#endif
+}
+
+}  // close namespace THREAD_NAMES_TEST
+
+namespace PINNED_WORKERS_TEST {
+
+/// Record, in the specified `affinities` protected by the specified
+/// `mutex`, the processor affinity of the calling thread, and enqueue on the
+/// specified `pool` two further recording jobs if the specified `depth` is
+/// positive.
+void recordAffinity(Obj                          *pool,
+                    int                           depth,
+                    bsl::set<bsl::vector<int> >  *affinities,
+                    bslmt::Mutex                 *mutex)
+{
+    bsl::vector<int> cpus;
+    ASSERT(0 == bslmt::ThreadUtil::getCpuAffinity(&cpus));
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(mutex);
+
+        affinities->insert(cpus);
+    }
+
+    if (0 < depth) {
+        for (int i = 0; i < 2; ++i) {
+            ASSERT(0 == pool->enqueueJob(bdlf::BindUtil::bind(&recordAffinity,
+                                                              pool,
+                                                              depth - 1,
+                                                              affinities,
+                                                              mutex)));
+        }
+    }
+}
+
+}  // close namespace PINNED_WORKERS_TEST
+
+/// Increment the `bsls::AtomicInt` addressed by the specified `counter`.
+extern "C" void incrementCounter(void *counter)
+{
+    ++*static_cast<bsls::AtomicInt *>(counter);
+}
+
+/// Increment the specified `counter`.
+void increment(bsls::AtomicInt *counter)
+{
+    ++*counter;
+}
+
+/// Enqueue on the specified `pool` two jobs of the specified `depth - 1`
+/// if `0 < depth`, and increment the specified `counter` in any case, so
+/// that a job of depth `d` results in `2^(d + 1) - 1` increments.  Also
+/// increment the specified `notWorker` if the calling thread is not a worker
+/// of `pool`.
+void recursiveJob(Obj             *pool,
+                  int              depth,
+                  bsls::AtomicInt *counter,
+                  bsls::AtomicInt *notWorker)
+{
+    if (!pool->isWorkerThread()) {
+        ++*notWorker;
+    }
+
+    if (0 < depth) {
+        for (int i = 0; i < 2; ++i) {
+            int rc = pool->enqueueJob(bdlf::BindUtil::bind(&recursiveJob,
+                                                           pool,
+                                                           depth - 1,
+                                                           counter,
+                                                           notWorker));
+            ASSERTV(rc, 0 == rc);
+        }
+    }
+
+    ++*counter;
+}
+
+/// Wait on the specified `latch`.
+void waitOnLatch(bslmt::Latch *latch)
+{
+    latch->wait();
+}
+
+/// Wait until the specified `pool` is disabled, then, after a short delay,
+/// arrive on the specified `latch`.
+void releaseWhenDisabled(const Obj *pool, bslmt::Latch *latch)
+{
+    while (pool->isEnabled()) {
+        bslmt::ThreadUtil::microSleep(1000);
+    }
+    bslmt::ThreadUtil::microSleep(10000);
+    latch->arrive();
+}
+
+/// Enqueue on the specified `pool` the specified `numJobs` jobs, each
+/// incrementing the specified `counter`.
+void submitJobs(Obj *pool, bsls::AtomicInt *counter, int numJobs)
+{
+    for (int i = 0; i < numJobs; ++i) {
+        ASSERT(0 == pool->enqueueJob(&incrementCounter, counter));
+    }
+}
+
+/// Pop elements from the specified `deque`, owned by the calling thread,
+/// until the specified `done` is set and `deque` is empty, recording each
+/// value in the specified `seen`, pushing the values from the specified
+/// `values` of the specified `numValues` elements as the deque drains.
+void dequeOwner(Deque           *deque,
+                Job             *values,
+                int              numValues,
+                bsls::AtomicInt *seen,
+                bsls::AtomicInt *numTaken)
+{
+    int next = 0;
+    while (next < numValues || 0 < deque->numElements()) {
+        // Push a few, pop one.
+
+        for (int i = 0; i < 3 && next < numValues; ++i) {
+            if (0 == deque->pushBottom(values + next)) {
+                ++next;
+            }
+        }
+
+        Job *job = deque->popBottom();
+        if (job) {
+            ++seen[job - values];
+            ++*numTaken;
+        }
+    }
+}
+
+/// Steal elements from the specified `deque` until the specified `numTaken`
+/// reaches the specified `numValues`, recording each element, an offset
+/// from the specified `values`, in the specified `seen`.
+void dequeThief(Deque           *deque,
+                Job             *values,
+                int              numValues,
+                bsls::AtomicInt *seen,
+                bsls::AtomicInt *numTaken)
+{
+    while (*numTaken < numValues) {
+        Job *job = deque->steal();
+        if (job) {
+            ++seen[job - values];
+            ++*numTaken;
+        }
+    }
+}
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recursive Summation
+/// - - - - - - - - - - - - - - -
+// In this example we use a `bdlmt::WorkStealingThreadPool` to sum the elements
+// of an array by recursively splitting the array in halves, each half being
+// summed by a separate job.  Such fine-grained jobs are a poor fit for a pool
+// having a single shared queue, as the cost of the queue operations dominates
+// the cost of the jobs.
+//
+// First, we define a structure describing the summation of a range, and the
+// function summing it.  Ranges longer than a threshold are split, one half
+// being summed by a job enqueued on the pool, and the other by the current
+// job.  The partial sums are accumulated atomically:
+// ```
+    struct SumJob {
+        bdlmt::WorkStealingThreadPool *d_pool_p;    // pool executing the job
+        const int                     *d_begin_p;   // first element to sum
+        const int                     *d_end_p;     // one past the last
+        bsls::AtomicInt64             *d_sum_p;     // accumulated sum
+
+        void operator()() const
+        {
+            const int *begin = d_begin_p;
+            const int *end   = d_end_p;
+
+            while (end - begin > 1024) {
+                const int *middle = begin + (end - begin) / 2;
+
+                SumJob job = { d_pool_p, middle, end, d_sum_p };
+                d_pool_p->enqueueJob(job);
+
+                end = middle;
+            }
+
+            bsls::Types::Int64 sum = 0;
+            for (; begin != end; ++begin) {
+                sum += *begin;
+            }
+            d_sum_p->add(sum);
+        }
+    };
+// ```
+
+                         // ====================
+                         // struct FixedPoolJob
+                         // ====================
+
+/// This function object is the analog of `recursiveJob` for a
+/// `bdlmt::FixedThreadPool`, used by the performance test.
+struct FixedPoolJob {
+    bdlmt::FixedThreadPool *d_pool_p;
+    int                     d_depth;
+    bsls::AtomicInt        *d_counter_p;
+
+    void operator()() const
+    {
+        if (0 < d_depth) {
+            for (int i = 0; i < 2; ++i) {
+                FixedPoolJob job = { d_pool_p, d_depth - 1, d_counter_p };
+                d_pool_p->enqueueJob(job);
+            }
+        }
+        ++*d_counter_p;
+    }
+};
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    // access the metrics registry default instance before assign the global
+    // allocator
+
+    bdlm::MetricsRegistry::defaultInstance();
+
+    bslma::DefaultAllocatorGuard guard(&taDefault);
+    bslma::TestAllocator  testAllocator(veryVeryVerbose);
+
+    bslma::TestAllocator  globalAllocator;
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslmt::TimedCompletionGuard completionGuard(&taDefault);
+    ASSERT(0 == completionGuard.guard(bsls::TimeInterval(90, 0),
+                                      bsl::format("case {}", test)));
+
+    switch (test) { case 0:  // case 0 is always the first case
+      case 10: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::DefaultAllocatorGuard dag(&testAllocator);
+
+// Then, we create and start a pool:
+// ```
+    bdlmt::WorkStealingThreadPool pool(4);
+    int rc = pool.start();
+    ASSERT(0 == rc);
+// ```
+// Next, we create the data to sum:
+// ```
+    bsl::vector<int> data(1000000);
+    for (bsl::size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<int>(i % 100);
+    }
+// ```
+// Now, we enqueue a single job summing the whole array, and wait for the pool
+// to be drained.  Note that `drain` waits for all the jobs enqueued by the
+// initial job as well:
+// ```
+    bsls::AtomicInt64 sum(0);
+
+    SumJob job = { &pool, data.data(), data.data() + data.size(), &sum };
+    pool.enqueueJob(job);
+    pool.drain();
+// ```
+// Finally, we verify the result:
+// ```
+    ASSERT(49500000 == sum);
+// ```
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING PINNED WORKERS
+        //
+        // Concerns:
+        // 1. Workers are not pinned by default.
+        //
+        // 2. When pinning is requested, each worker executes on a single
+        //    processor, chosen among the processors on which the thread
+        //    invoking `start` may execute, or among the processors of the
+        //    `cpuAffinity` attribute if set.
+        //
+        // 3. Pinned workers execute external and local submissions, and the
+        //    pool can be stopped and restarted, without leaking memory.
+        //
+        // 4. Pinning takes effect at the next `start`.
+        //
+        // Plan:
+        // 1. Verify the default value of `workerPinning`.  (C-1)
+        //
+        // 2. Start pools with pinning enabled, and record the affinity of the
+        //    threads executing recursively enqueued jobs.  (C-2..3)
+        //
+        // 3. Disable pinning on a stopped pool, restart it, and verify the
+        //    workers are not restricted.  (C-4)
+        //
+        // Testing:
+        //   void setWorkerPinning(bool value);
+        //   bool workerPinning() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING PINNED WORKERS\n"
+                             "======================\n";
+
+        namespace TC = PINNED_WORKERS_TEST;
+
+        bsl::vector<int> allowed;
+        if (0 != bslmt::ThreadUtil::getCpuAffinity(&allowed)) {
+            if (verbose) cout << "Affinity not supported." << endl;
+            break;
+        }
+
+        const int k_NUM_THREADS = 4;
+        const int k_DEPTH       = 6;
+
+        if (verbose) cout << "\nPinning to the allowed processors." << endl;
+        {
+            Obj mX(k_NUM_THREADS, &testAllocator);  const Obj& X = mX;
+
+            ASSERT(false == X.workerPinning());
+
+            mX.setWorkerPinning(true);
+            ASSERT(true  == X.workerPinning());
+
+            for (int iteration = 0; iteration < 2; ++iteration) {
+                bsl::set<bsl::vector<int> > affinities;
+                bslmt::Mutex                mutex;
+
+                ASSERT(0 == mX.start());
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(
+                                                          &TC::recordAffinity,
+                                                          &mX,
+                                                          k_DEPTH,
+                                                          &affinities,
+                                                          &mutex)));
+                mX.stop();
+
+                ASSERT(!affinities.empty());
+                ASSERT(static_cast<int>(affinities.size()) <= k_NUM_THREADS);
+
+                for (bsl::set<bsl::vector<int> >::const_iterator it =
+                                                          affinities.begin();
+                     it != affinities.end();
+                     ++it) {
+                    ASSERTV(it->size(), 1 == it->size());
+                    ASSERT(bsl::binary_search(allowed.begin(),
+                                              allowed.end(),
+                                              it->front()));
+                }
+            }
+
+            if (verbose) cout << "\nDisabling pinning." << endl;
+
+            mX.setWorkerPinning(false);
+            ASSERT(false == X.workerPinning());
+
+            bsl::set<bsl::vector<int> > affinities;
+            bslmt::Mutex                mutex;
+
+            ASSERT(0 == mX.start());
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(
+                                                          &TC::recordAffinity,
+                                                          &mX,
+                                                          k_DEPTH,
+                                                          &affinities,
+                                                          &mutex)));
+            mX.stop();
+
+            ASSERT(1       == affinities.size());
+            ASSERT(allowed == *affinities.begin());
+        }
+
+        if (verbose) cout << "\nPinning to the `cpuAffinity` attribute."
+                          << endl;
+        {
+            bsl::vector<int> last(1, allowed.back());
+
+            bslmt::ThreadAttributes attributes;
+            attributes.setCpuAffinity(last);
+
+            Obj mX(attributes, k_NUM_THREADS, &testAllocator);
+
+            mX.setWorkerPinning(true);
+
+            bsl::set<bsl::vector<int> > affinities;
+            bslmt::Mutex                mutex;
+
+            ASSERT(0 == mX.start());
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(
+                                                          &TC::recordAffinity,
+                                                          &mX,
+                                                          k_DEPTH,
+                                                          &affinities,
+                                                          &mutex)));
+            mX.drain();
+            mX.shutdown();
+
+            ASSERT(1    == affinities.size());
+            ASSERT(last == *affinities.begin());
+        }
+
+        ASSERT(0 == testAllocator.numBlocksInUse());
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING THREAD NAMES
+        //
+        // Concerns:
+        // 1. On platforms that support thread names, the thread name is set
+        //    correctly.
+        //
+        // Plan:
+        // 1. Verify when `threadAttributes.threadName()` and `threadPoolName`
+        //    are empty, the default "bdl.WSPool" is used.
+        //
+        // 2. Verify when `threadAttributes.threadName()` is empty and
+        //    `threadPoolName` is specified, `threadPoolName` is used.
+        //
+        // 3. Verify when `threadAttributes.threadName()` is specified, it is
+        //    used.
+        //
+        // Testing:
+        //   THREAD NAMES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING THREAD NAMES\n"
+                             "====================\n";
+
+        namespace TC = THREAD_NAMES_TEST;
+
+        const int k_NUM_THREADS = 3;
+
+        char defaultThreadName[]     = { "bdl.WSPool" };
+        char constructorThreadName[] = { "name" };
+        char nonDefaultThreadName[]  = { "bow wow" };
+
+        bslmt::ThreadAttributes attr;
+        bslmt::ThreadAttributes namedAttr;
+        namedAttr.setThreadName(nonDefaultThreadName);
+
+        {
+            Obj mX(k_NUM_THREADS, &testAllocator);
+            ASSERT(0 == mX.start());
+            for (int ii = 0; ii < 10; ++ii) {
+                mX.enqueueJob(&TC::threadNameCheckJob, defaultThreadName);
+            }
+            mX.stop();
+        }
+        {
+            Obj mX(k_NUM_THREADS, "", 0, &testAllocator);
+            ASSERT(0 == mX.start());
+            for (int ii = 0; ii < 10; ++ii) {
+                mX.enqueueJob(&TC::threadNameCheckJob, defaultThreadName);
+            }
+            mX.stop();
+        }
+        {
+            Obj mX(k_NUM_THREADS, constructorThreadName, 0, &testAllocator);
+            ASSERT(0 == mX.start());
+            for (int ii = 0; ii < 10; ++ii) {
+                mX.enqueueJob(&TC::threadNameCheckJob, constructorThreadName);
+            }
+            mX.stop();
+        }
+        {
+            Obj mX(attr, k_NUM_THREADS, constructorThreadName, 0,
+                   &testAllocator);
+            ASSERT(0 == mX.start());
+            for (int ii = 0; ii < 10; ++ii) {
+                mX.enqueueJob(&TC::threadNameCheckJob, constructorThreadName);
+            }
+            mX.stop();
+        }
+        {
+            Obj mX(namedAttr, k_NUM_THREADS, constructorThreadName, 0,
+                   &testAllocator);
+            ASSERT(0 == mX.start());
+            for (int ii = 0; ii < 10; ++ii) {
+                mX.enqueueJob(&TC::threadNameCheckJob, nonDefaultThreadName);
+            }
+            mX.stop();
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING `shutdown` AND THE COUNTS
+        //
+        // Concerns:
+        // 1. `numActiveThreads` and `numPendingJobs` reflect the jobs being
+        //    executed and the jobs waiting.
+        //
+        // 2. `shutdown` discards the pending jobs without executing them,
+        //    waits for the active jobs, and joins the threads.
+        //
+        // 3. No memory is leaked by discarded jobs.
+        //
+        // Plan:
+        // 1. Block every worker of a pool in a job waiting on a latch, enqueue
+        //    further jobs, and verify the counts.  Release the latch from a
+        //    separate thread once `shutdown` has begun, and verify that the
+        //    further jobs were not executed.  (C-1..3)
+        //
+        // Testing:
+        //   void shutdown();
+        //   int numActiveThreads() const;
+        //   int numPendingJobs() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING `shutdown` AND THE COUNTS\n"
+                             "=================================\n";
+
+        const int k_NUM_THREADS = 4;
+        const int k_NUM_JOBS    = 100;
+
+        bslmt::Latch    latch(1);
+        bsls::AtomicInt counter(0);
+
+        {
+            Obj mX(k_NUM_THREADS, &testAllocator);  const Obj& X = mX;
+
+            ASSERT(0 == mX.start());
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&waitOnLatch,
+                                                               &latch)));
+            }
+            while (k_NUM_THREADS != X.numActiveThreads()) {
+                bslmt::ThreadUtil::microSleep(1000);
+            }
+
+            for (int i = 0; i < k_NUM_JOBS; ++i) {
+                ASSERT(0 == mX.enqueueJob(&incrementCounter, &counter));
+            }
+
+            ASSERTV(X.numActiveThreads(),
+                    k_NUM_THREADS == X.numActiveThreads());
+            ASSERTV(X.numPendingJobs(),   k_NUM_JOBS    == X.numPendingJobs());
+
+            // Release the latch once `shutdown` has disabled the pool.
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(
+                                  &handle,
+                                  bdlf::BindUtil::bind(&releaseWhenDisabled,
+                                                       &X,
+                                                       &latch),
+                                  &testAllocator));
+
+            mX.shutdown();
+
+            bslmt::ThreadUtil::join(handle);
+
+            ASSERT(false == X.isStarted());
+            ASSERT(0     == X.numThreadsStarted());
+            ASSERT(0     == X.numPendingJobs());
+            ASSERT(0     == X.numActiveThreads());
+
+            // The workers observe the exit flag before taking another job
+            // once released, but a worker may have been between two jobs.
+
+            ASSERTV(counter, counter < k_NUM_JOBS);
+        }
+        ASSERT(0 == testAllocator.numBytesInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING RECURSIVE JOBS
+        //
+        // Concerns:
+        // 1. Jobs enqueued by jobs are executed by workers of the pool, and
+        //    `isWorkerThread` is `true` only on those workers.
+        //
+        // 2. `drain` and `stop` wait for all the jobs enqueued recursively.
+        //
+        // 3. A job can enqueue jobs while the pool is disabled, and `stop`
+        //    completes the recursive work.
+        //
+        // 4. Local submissions exceeding the capacity of the deque of a worker
+        //    are executed.
+        //
+        // Plan:
+        // 1. For pools of various sizes, enqueue a job of a given depth that
+        //    recursively enqueues a binary tree of jobs, `drain` the pool,
+        //    and verify the number of jobs executed and that each ran on a
+        //    worker.  Repeat, invoking `stop` rather than `drain`.  (C-1..3)
+        //
+        // 2. Use a depth such that a single worker accumulates more jobs than
+        //    `k_LOCAL_QUEUE_CAPACITY`.  (C-4)
+        //
+        // Testing:
+        //   void stop();
+        //   bool isWorkerThread() const;
+        //   CONCERN: `drain` and `stop` wait for recursively enqueued jobs
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING RECURSIVE JOBS\n"
+                             "======================\n";
+
+        const int NUM_THREADS[] = { 1, 2, 4, 8 };
+        const int NUM_CASES     = sizeof NUM_THREADS / sizeof *NUM_THREADS;
+
+        const int DEPTHS[]   = { 0, 1, 5, 14 };
+        const int NUM_DEPTHS = sizeof DEPTHS / sizeof *DEPTHS;
+
+        ASSERT(Obj::k_LOCAL_QUEUE_CAPACITY < (1 << 14));
+
+        for (int ti = 0; ti < NUM_CASES; ++ti) {
+            const int THREADS = NUM_THREADS[ti];
+
+            Obj mX(THREADS, &testAllocator);  const Obj& X = mX;
+
+            ASSERT(false == X.isWorkerThread());
+
+            for (int tj = 0; tj < NUM_DEPTHS; ++tj) {
+                const int DEPTH    = DEPTHS[tj];
+                const int EXPECTED = (1 << (DEPTH + 1)) - 1;
+
+                if (veryVerbose) { T_ P_(THREADS); P(DEPTH); }
+
+                bsls::AtomicInt counter(0);
+                bsls::AtomicInt notWorker(0);
+
+                ASSERT(0 == mX.start());
+
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&recursiveJob,
+                                                               &mX,
+                                                               DEPTH,
+                                                               &counter,
+                                                               &notWorker)));
+                mX.drain();
+
+                ASSERTV(THREADS, DEPTH, counter, EXPECTED == counter);
+                ASSERTV(THREADS, DEPTH, notWorker, 0 == notWorker);
+                ASSERT(0 == X.numPendingJobs());
+
+                counter = 0;
+
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&recursiveJob,
+                                                               &mX,
+                                                               DEPTH,
+                                                               &counter,
+                                                               &notWorker)));
+                mX.stop();
+
+                ASSERTV(THREADS, DEPTH, counter, EXPECTED == counter);
+                ASSERTV(THREADS, DEPTH, notWorker, 0 == notWorker);
+                ASSERT(false == X.isStarted());
+                ASSERT(false == X.isEnabled());
+            }
+        }
+        ASSERT(0 == testAllocator.numBytesInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING `enqueueJob`, `start`, `drain`, `enable`, AND `disable`
+        //
+        // Concerns:
+        // 1. A pool is not started, and is disabled, on construction, and
+        //    `enqueueJob` fails with `e_DISABLED` until `start`.
+        //
+        // 2. `start` starts `numThreads()` threads and enables the pool, and
+        //    has no effect on a started pool.
+        //
+        // 3. Each overload of `enqueueJob` enqueues a job that is executed.
+        //
+        // 4. `disable` makes `enqueueJob` from a thread that is not a worker
+        //    fail, and `enable` restores it.
+        //
+        // 5. Jobs enqueued concurrently by several threads are all executed,
+        //    and `drain` waits for them.
+        //
+        // Plan:
+        // 1. Exercise the methods in sequence and verify the accessors.
+        //    (C-1..4)
+        //
+        // 2. Enqueue jobs from several threads concurrently, `drain`, and
+        //    verify the count.  (C-5)
+        //
+        // Testing:
+        //   void disable();
+        //   void enable();
+        //   int enqueueJob(const Job&);
+        //   int enqueueJob(bslmf::MovableRef<Job>);
+        //   int enqueueJob(WorkStealingThreadPoolJobFunc, void *);
+        //   int start();
+        //   void drain();
+        //   bool isEnabled() const;
+        //   bool isStarted() const;
+        //   int numThreadsStarted() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING `enqueueJob`, `start`, `drain`, "
+                             "`enable`, AND `disable`\n"
+                             "=============================================="
+                             "================\n";
+
+        const int k_NUM_THREADS = 4;
+
+        {
+            bsls::AtomicInt counter(0);
+
+            Obj mX(k_NUM_THREADS, &testAllocator);  const Obj& X = mX;
+
+            ASSERT(false == X.isStarted());
+            ASSERT(false == X.isEnabled());
+            ASSERT(0     == X.numThreadsStarted());
+
+            ASSERT(Obj::e_DISABLED == mX.enqueueJob(&incrementCounter,
+                                                    &counter));
+            ASSERT(0 == X.numPendingJobs());
+
+            mX.drain();  // no effect
+
+            ASSERT(0 == mX.start());
+            ASSERT(true          == X.isStarted());
+            ASSERT(true          == X.isEnabled());
+            ASSERT(k_NUM_THREADS == X.numThreadsStarted());
+
+            ASSERT(0 == mX.start());
+            ASSERT(k_NUM_THREADS == X.numThreadsStarted());
+
+            const Job JOB = bdlf::BindUtil::bind(&increment, &counter);
+            Job       movable(JOB);
+
+            ASSERT(Obj::e_SUCCESS == mX.enqueueJob(JOB));
+            ASSERT(Obj::e_SUCCESS ==
+                     mX.enqueueJob(bslmf::MovableRefUtil::move(movable)));
+            ASSERT(Obj::e_SUCCESS == mX.enqueueJob(&incrementCounter,
+                                                   &counter));
+            mX.drain();
+            ASSERTV(counter, 3 == counter);
+
+            mX.disable();
+            ASSERT(false == X.isEnabled());
+            ASSERT(Obj::e_DISABLED == mX.enqueueJob(JOB));
+            ASSERT(Obj::e_DISABLED == mX.enqueueJob(&incrementCounter,
+                                                    &counter));
+            mX.drain();
+            ASSERTV(counter, 3 == counter);
+
+            mX.enable();
+            ASSERT(true == X.isEnabled());
+            ASSERT(Obj::e_SUCCESS == mX.enqueueJob(JOB));
+            mX.drain();
+            ASSERTV(counter, 4 == counter);
+        }
+
+        if (verbose) cout << "\tConcurrent external submission.\n";
+        {
+            const int k_NUM_SUBMITTERS = 4;
+            const int k_NUM_JOBS       = 10000;
+
+            bsls::AtomicInt counter(0);
+
+            Obj mX(k_NUM_THREADS, &testAllocator);
+
+            ASSERT(0 == mX.start());
+
+            bslmt::ThreadGroup group(&testAllocator);
+            for (int i = 0; i < k_NUM_SUBMITTERS; ++i) {
+                group.addThread(bdlf::BindUtil::bind(&submitJobs,
+                                                     &mX,
+                                                     &counter,
+                                                     k_NUM_JOBS));
+            }
+            group.joinAll();
+
+            mX.drain();
+
+            ASSERTV(counter, k_NUM_SUBMITTERS * k_NUM_JOBS == counter);
+        }
+        ASSERT(0 == testAllocator.numBytesInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING CONSTRUCTORS AND METRICS
+        //
+        // Concerns:
+        // 1. Each constructor creates a pool having the specified number of
+        //    threads, not started.
+        //
+        // 2. Each constructor registers the `bde.backlog` metric with the
+        //    expected registry and identifier, and the destructor removes it.
+        //
+        // 3. All memory is supplied by the specified allocator, and is
+        //    released on destruction.
+        //
+        // 4. `1 <= numThreads` is checked.
+        //
+        // Plan:
+        // 1. Create pools with each constructor, using a test metrics adapter
+        //    installed in the default and in another registry, and verify the
+        //    registrations after each pool is destroyed.  (C-1..3)
+        //
+        // 2. Verify that an invalid number of threads is detected.  (C-4)
+        //
+        // Testing:
+        //   WorkStealingThreadPool(numThreads, *bA);
+        //   WorkStealingThreadPool(nT, name, *mR, *bA);
+        //   WorkStealingThreadPool(attributes, nT, *bA);
+        //   WorkStealingThreadPool(attributes, nT, name, *mR, *bA);
+        //   ~WorkStealingThreadPool();
+        //   int numThreads() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING CONSTRUCTORS AND METRICS\n"
+                             "================================\n";
+
+        TestMetricsAdapter defaultAdapter;
+        TestMetricsAdapter otherAdapter;
+
+        bdlm::MetricsRegistry& defaultRegistry =
+                                      bdlm::MetricsRegistry::defaultInstance();
+        bdlm::MetricsRegistry  otherRegistry;
+
+        defaultRegistry.setMetricsAdapter(&defaultAdapter);
+        otherRegistry.setMetricsAdapter(&otherAdapter);
+
+        bslmt::ThreadAttributes attr;
+        bslmt::ThreadAttributes namedAttr;
+        namedAttr.setThreadName("c");
+
+        const int NUM_THREADS[] = { 1, 2, 7 };
+        const int NUM_CASES     = sizeof NUM_THREADS / sizeof *NUM_THREADS;
+
+        for (int ti = 0; ti < NUM_CASES; ++ti) {
+            const int THREADS = NUM_THREADS[ti];
+
+            {
+                Obj mX(THREADS, &testAllocator);  const Obj& X = mX;
+
+                ASSERTV(ti, THREADS == X.numThreads());
+                ASSERTV(ti, 0       == X.numThreadsStarted());
+                ASSERTV(ti, 0       <  testAllocator.numBytesInUse());
+            }
+            ASSERT(0 == testAllocator.numBytesInUse());
+            ASSERT(defaultAdapter.verify(""));
+            defaultAdapter.reset();
+
+            {
+                Obj mX(THREADS, "a", 0, &testAllocator);  const Obj& X = mX;
+
+                ASSERTV(ti, THREADS == X.numThreads());
+            }
+            ASSERT(defaultAdapter.verify("a"));
+            defaultAdapter.reset();
+
+            {
+                Obj mX(THREADS, "b", &otherRegistry, &testAllocator);
+                const Obj& X = mX;
+
+                ASSERTV(ti, THREADS == X.numThreads());
+            }
+            ASSERT(otherAdapter.verify("b"));
+            otherAdapter.reset();
+
+            {
+                Obj mX(attr, THREADS, &testAllocator);  const Obj& X = mX;
+
+                ASSERTV(ti, THREADS == X.numThreads());
+            }
+            ASSERT(defaultAdapter.verify(""));
+            defaultAdapter.reset();
+
+            {
+                Obj mX(namedAttr, THREADS, &testAllocator);
+                const Obj& X = mX;
+
+                ASSERTV(ti, THREADS == X.numThreads());
+            }
+            ASSERT(defaultAdapter.verify("c"));
+            defaultAdapter.reset();
+
+            {
+                Obj mX(attr, THREADS, "d", &otherRegistry, &testAllocator);
+                const Obj& X = mX;
+
+                ASSERTV(ti, THREADS == X.numThreads());
+            }
+            ASSERT(otherAdapter.verify("d"));
+            otherAdapter.reset();
+
+            ASSERT(0 == testAllocator.numBytesInUse());
+        }
+
+        defaultRegistry.removeMetricsAdapter(&defaultAdapter);
+        otherRegistry.removeMetricsAdapter(&otherAdapter);
+
+        if (verbose) cout << "\tNegative Testing.\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_OPT_FAIL(Obj(0, &testAllocator));
+            ASSERT_OPT_PASS(Obj(1, &testAllocator));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONCURRENT `steal` AND `popBottom`
+        //
+        // Concerns:
+        // 1. When the owner pushes and pops while several threads steal, each
+        //    element is removed exactly once, including when a single element
+        //    remains and `popBottom` races with `steal`.
+        //
+        // Plan:
+        // 1. Let an owner thread push a large number of distinct elements,
+        //    popping some of them, while several thieves steal, and verify
+        //    that each element was removed exactly once.  (C-1)
+        //
+        // Testing:
+        //   CONCURRENT `steal` AND `popBottom`
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "CONCURRENT `steal` AND `popBottom`\n"
+                             "==================================\n";
+
+        const int k_NUM_VALUES  = 200000;
+        const int k_NUM_THIEVES = 3;
+
+        bsl::vector<Job>  values(k_NUM_VALUES, &testAllocator);
+        bsls::AtomicInt  *seen = new bsls::AtomicInt[k_NUM_VALUES];
+        bsls::AtomicInt   numTaken(0);
+
+        Deque mX(64, &testAllocator);
+
+        bslmt::ThreadGroup group(&testAllocator);
+
+        for (int i = 0; i < k_NUM_THIEVES; ++i) {
+            group.addThread(bdlf::BindUtil::bind(&dequeThief,
+                                                 &mX,
+                                                 values.data(),
+                                                 k_NUM_VALUES,
+                                                 seen,
+                                                 &numTaken));
+        }
+        group.addThread(bdlf::BindUtil::bind(&dequeOwner,
+                                             &mX,
+                                             values.data(),
+                                             k_NUM_VALUES,
+                                             seen,
+                                             &numTaken));
+        group.joinAll();
+
+        ASSERTV(numTaken, k_NUM_VALUES == numTaken);
+        for (int i = 0; i < k_NUM_VALUES; ++i) {
+            ASSERTV(i, seen[i], 1 == seen[i]);
+        }
+
+        delete[] seen;
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING `WorkStealingThreadPool_Deque`
+        //
+        // Concerns:
+        // 1. A deque is created empty with the specified capacity.
+        //
+        // 2. `popBottom` removes the newest element, `steal` the oldest, and
+        //    both return 0 on an empty deque.
+        //
+        // 3. `pushBottom` fails, with no effect, on a full deque.
+        //
+        // 4. The indices wrap around the circular buffer.
+        //
+        // 5. The capacity is checked to be a power of 2.
+        //
+        // Plan:
+        // 1. Push, pop, and steal elements in sequence, verifying the results
+        //    and `numElements`, for more elements than the capacity.
+        //    (C-1..4)
+        //
+        // 2. Verify that an invalid capacity is detected.  (C-5)
+        //
+        // Testing:
+        //   WorkStealingThreadPool_Deque(int capacity, *bA);
+        //   Job *popBottom();
+        //   int pushBottom(Job *job);
+        //   Job *steal();
+        //   int capacity() const;
+        //   int numElements() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING `WorkStealingThreadPool_Deque`\n"
+                             "======================================\n";
+
+        Job values[32];
+
+        {
+            Deque mX(8, &testAllocator);  const Deque& X = mX;
+
+            ASSERT(8 == X.capacity());
+            ASSERT(0 == X.numElements());
+            ASSERT(0 == mX.popBottom());
+            ASSERT(0 == mX.steal());
+
+            for (int round = 0; round < 4; ++round) {
+                for (int i = 0; i < 8; ++i) {
+                    ASSERTV(round, i, 0 == mX.pushBottom(values + i));
+                    ASSERTV(round, i, i + 1 == X.numElements());
+                }
+                ASSERT(0 != mX.pushBottom(values + 8));
+                ASSERT(8 == X.numElements());
+
+                ASSERT(values + 0 == mX.steal());
+                ASSERT(values + 7 == mX.popBottom());
+                ASSERT(values + 1 == mX.steal());
+                ASSERT(values + 6 == mX.popBottom());
+                ASSERT(4 == X.numElements());
+
+                ASSERT(0 == mX.pushBottom(values + 9));
+                ASSERT(values + 9 == mX.popBottom());
+
+                ASSERT(values + 2 == mX.steal());
+                ASSERT(values + 5 == mX.popBottom());
+                ASSERT(values + 4 == mX.popBottom());
+                ASSERT(values + 3 == mX.popBottom());
+                ASSERT(0 == mX.popBottom());
+                ASSERT(0 == mX.steal());
+                ASSERT(0 == X.numElements());
+            }
+        }
+        ASSERT(0 == testAllocator.numBytesInUse());
+
+        if (verbose) cout << "\tNegative Testing.\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(Deque(0, &testAllocator));
+            ASSERT_FAIL(Deque(6, &testAllocator));
+            ASSERT_PASS(Deque(1, &testAllocator));
+            ASSERT_PASS(Deque(4, &testAllocator));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Create a pool, start it, enqueue jobs, drain it, and stop it.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "BREATHING TEST\n"
+                             "==============\n";
+
+        bsls::AtomicInt counter(0);
+
+        Obj mX(4, &testAllocator);  const Obj& X = mX;
+
+        ASSERT(4 == X.numThreads());
+        ASSERT(0 == X.numThreadsStarted());
+
+        ASSERT(0 == mX.start());
+        ASSERT(4 == X.numThreadsStarted());
+
+        for (int i = 0; i < 100; ++i) {
+            ASSERT(0 == mX.enqueueJob(&incrementCounter, &counter));
+        }
+        mX.drain();
+        ASSERTV(counter, 100 == counter);
+
+        mX.stop();
+        ASSERT(0 == X.numThreadsStarted());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: FINE-GRAINED RECURSIVE JOBS
+        //   Compare the time taken by a `bdlmt::WorkStealingThreadPool` and a
+        //   `bdlmt::FixedThreadPool` to execute a binary tree of trivial jobs,
+        //   each enqueuing its children.  The optional second argument is the
+        //   number of threads (default 4), and the optional third is the
+        //   depth of the tree (default 18).
+        //
+        // Testing:
+        //   PERFORMANCE: FINE-GRAINED RECURSIVE JOBS
+        // --------------------------------------------------------------------
+
+        cout << "PERFORMANCE: FINE-GRAINED RECURSIVE JOBS\n"
+                "========================================\n";
+
+        const int THREADS = argc > 2 ? atoi(argv[2]) : 4;
+        const int DEPTH   = argc > 3 ? atoi(argv[3]) : 18;
+        const int NUM_JOBS = (1 << (DEPTH + 1)) - 1;
+
+        bslma::TestAllocator da;  // ensure `taDefault` is not used
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            bsls::AtomicInt counter(0);
+            bsls::AtomicInt notWorker(0);
+
+            Obj mX(THREADS);
+            ASSERT(0 == mX.start());
+
+            bsls::Stopwatch timer;
+            timer.start();
+
+            mX.enqueueJob(bdlf::BindUtil::bind(&recursiveJob,
+                                               &mX,
+                                               DEPTH,
+                                               &counter,
+                                               &notWorker));
+            mX.drain();
+
+            timer.stop();
+
+            ASSERT(NUM_JOBS == counter);
+
+            cout << "WorkStealingThreadPool: " << NUM_JOBS << " jobs in "
+                 << timer.elapsedTime() << "s ("
+                 << timer.elapsedTime() * 1e9 / NUM_JOBS << "ns/job)\n";
+        }
+        {
+            bsls::AtomicInt counter(0);
+
+            bdlmt::FixedThreadPool mX(THREADS, NUM_JOBS);
+            ASSERT(0 == mX.start());
+
+            bsls::Stopwatch timer;
+            timer.start();
+
+            FixedPoolJob job = { &mX, DEPTH, &counter };
+            mX.enqueueJob(job);
+
+            // `drain` on a `FixedThreadPool` may return while a job is
+            // enqueuing its children, so wait for the count.
+
+            while (NUM_JOBS != counter) {
+                mX.drain();
+            }
+
+            timer.stop();
+
+            cout << "FixedThreadPool:        " << NUM_JOBS << " jobs in "
+                 << timer.elapsedTime() << "s ("
+                 << timer.elapsedTime() * 1e9 / NUM_JOBS << "ns/job)\n";
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    ASSERT(0 == globalAllocator.numAllocations());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
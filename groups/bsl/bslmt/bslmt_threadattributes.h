@@ -30,11 +30,15 @@ BSLS_IDENT("$Id: $")
 // schedulingPolicy    enum SchedulingPolicy  e_SCHED_DEFAULT
 // schedulingPriority  int                    e_UNSET_PRIORITY
 // threadName          bsl::string            ""
+// cpuAffinity         bsl::vector<int>       empty
+// numaNode            int                    e_UNSET_NUMA_NODE
 //
 // Name          Constraint
 // ---------     ---------------------------------------------------
 // stackSize     'e_UNSET_STACK_SIZE == stackSize || 0 <= stackSize'
 // guardSize     'e_UNSET_GUARD_SIZE == guardSize || 0 <= guardSize'
+// cpuAffinity   '0 <= cpu' for each 'cpu' in 'cpuAffinity'
+// numaNode      'e_UNSET_NUMA_NODE == numaNode || 0 <= numaNode'
 // ```
 //
 ///`detachedState` Attribute
@@ -123,6 +127,30 @@ BSLS_IDENT("$Id: $")
 // length of 15, while on Windows, the limit is 32767, or `(1 << 15) - 1`
 // characters.
 //
+///`cpuAffinity` Attribute
+///- - - - - - - - - - - -
+// The `cpuAffinity` attribute is the set of the indices of the processors
+// (CPUs) on which the thread may execute, the created thread being "pinned"
+// to those processors.  If `cpuAffinity` is empty (the default), the thread
+// may execute on any processor, unless `numaNode` is set.  The processors
+// are numbered as by the operating system (e.g., as in `/proc/cpuinfo` on
+// Linux), and the order of the indices and duplicate indices are not
+// significant.  On platforms not supporting processor affinity, this
+// attribute is ignored.  See `bslmt_threadutil` for information about
+// support for this attribute.
+//
+///`numaNode` Attribute
+/// - - - - - - - - - -
+// The `numaNode` attribute indicates the NUMA (non-uniform memory access)
+// node on whose processors the thread should execute.  If `numaNode` is
+// `e_UNSET_NUMA_NODE` (the default), the thread may execute on the
+// processors of any node.  This attribute is ignored if `cpuAffinity` is not
+// empty.  Note that, on most platforms, memory is physically allocated on
+// the node of the thread first writing to it, so that a thread restricted to
+// a node, and the memory it allocates and initializes, are local to each
+// other.  See `bslmt_threadutil` for information about support for this
+// attribute.
+//
 ///Fluent Interface
 ///------------------
 // `bslmt::ThreadAttributes` provides manipulators that return a non-`const`
@@ -277,8 +305,10 @@ BSLS_IDENT("$Id: $")
 #include <bsls_platform.h>
 
 #include <bsl_c_limits.h>
+#include <bsl_cstddef.h>
 #include <bsl_iosfwd.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace bslmt {
@@ -340,15 +370,16 @@ class ThreadAttributes {
     };
 
     /// The following constants indicate that the `stackSize`, `guardSize`,
-    /// and `schedulingPriority` attributes, respectively, are unspecified
-    /// and the thread creation routine is use platform-specific defaults.
-    /// These attributes are initialized to these values when a thread
-    /// attributes object is default constructed.
+    /// `schedulingPriority`, and `numaNode` attributes, respectively, are
+    /// unspecified and the thread creation routine is use platform-specific
+    /// defaults.  These attributes are initialized to these values when a
+    /// thread attributes object is default constructed.
     enum {
 
         e_UNSET_STACK_SIZE = -1,
         e_UNSET_GUARD_SIZE = -1,
         e_UNSET_PRIORITY   = INT_MIN,
+        e_UNSET_NUMA_NODE  = -1,
 
         e_SCHED_MIN        = e_SCHED_OTHER,
         e_SCHED_MAX        = e_SCHED_DEFAULT
@@ -384,6 +415,13 @@ class ThreadAttributes {
 
     bsl::string      d_threadName;          // name of the thread
 
+    bsl::vector<int> d_cpuAffinity;         // processors on which the
+                                            // thread may execute (empty if
+                                            // unrestricted)
+
+    int              d_numaNode;            // NUMA node on which the thread
+                                            // should execute
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(ThreadAttributes,
@@ -400,6 +438,8 @@ class ThreadAttributes {
     /// * `schedulingPriority() == e_UNSET_PRIORITY`
     /// * `stackSize()          == e_UNSET_STACK_SIZE`
     /// * `threadName()         == ""`
+    /// * `cpuAffinity()        == bsl::vector<int>()`
+    /// * `numaNode()           == e_UNSET_NUMA_NODE`
     /// Optionally specify a `basicAllocator` used to supply memory.  If
     /// `basicAllocator` is 0, the currently installed default allocator is
     /// used.
@@ -421,6 +461,16 @@ class ThreadAttributes {
 
     // MANIPULATORS
 
+    /// Set the `cpuAffinity` attribute of this object to the specified
+    /// `value`, the set of the indices of the processors on which a thread
+    /// may execute.  Return a non-`const` reference to this object (see
+    /// also {Fluent Interface}).  An empty `value` (the default) indicates
+    /// that the thread may execute on any processor, unless `numaNode` is
+    /// set.  The behavior is undefined unless each element of `value` is
+    /// non-negative.  See `bslmt_threadutil` for information about support
+    /// for this attribute.
+    ThreadAttributes& setCpuAffinity(const bsl::vector<int>& value);
+
     /// Set the `detachedState` attribute of this object to the specified
     /// `value`.  Return a non-`const` reference to this object (see also
     /// {Fluent Interface}).  A value of `e_CREATE_JOINABLE` (the default)
@@ -453,6 +503,16 @@ class ThreadAttributes {
     /// attribute.
     ThreadAttributes& setInheritSchedule(bool value);
 
+    /// Set the `numaNode` attribute of this object to the specified
+    /// `value`.  Return a non-`const` reference to this object (see also
+    /// {Fluent Interface}).  `e_UNSET_NUMA_NODE == value` (the default)
+    /// indicates that the thread may execute on the processors of any node.
+    /// This attribute is ignored if `cpuAffinity` is not empty.  The
+    /// behavior is undefined unless `e_UNSET_NUMA_NODE == value` or
+    /// `0 <= value`.  See `bslmt_threadutil` for information about support
+    /// for this attribute.
+    ThreadAttributes& setNumaNode(int value);
+
     /// Set the value of the `schedulingPolicy` attribute of this object to
     /// the specified `value`.  Return a non-`const` reference to this
     /// object (see also {Fluent Interface}).  This attribute is ignored
@@ -486,6 +546,12 @@ class ThreadAttributes {
 
     // ACCESSORS
 
+    /// Return a reference providing non-modifiable access to the
+    /// `cpuAffinity` attribute of this object, the set of the indices of the
+    /// processors on which a thread may execute, or an empty vector if the
+    /// thread may execute on any processor.
+    const bsl::vector<int>& cpuAffinity() const;
+
     /// Return the value of the `detachedState` attribute of this object.  A
     /// value of `e_CREATE_JOINABLE` indicates that a thread must be joined
     /// after it terminates to clean up its resources; a value of
@@ -511,6 +577,12 @@ class ThreadAttributes {
     /// information about support for this attribute.
     bool inheritSchedule() const;
 
+    /// Return the value of the `numaNode` attribute of this object.  The
+    /// value `e_UNSET_NUMA_NODE` indicates that a thread may execute on the
+    /// processors of any node.  This attribute is ignored if `cpuAffinity`
+    /// is not empty.
+    int numaNode() const;
+
     /// Format this object to the specified output `stream` at the (absolute
     /// value of) the optionally specified indentation `level` and return a
     /// reference to `stream`.  If `level` is specified, optionally specify
@@ -519,7 +591,9 @@ class ThreadAttributes {
     /// suppress indentation of the first line.  If `spacesPerLevel` is
     /// negative format the entire output on one line, suppressing all but
     /// the initial indentation (as governed by `level`).  If `stream` is
-    /// not valid on entry, this operation has no effect.
+    /// not valid on entry, this operation has no effect.  Note that the
+    /// `cpuAffinity` and `numaNode` attributes are printed only if they are
+    /// set.
     bsl::ostream& print(bsl::ostream& stream,
                         int           level          = 0,
                         int           spacesPerLevel = 4) const;
@@ -560,14 +634,16 @@ class ThreadAttributes {
 /// value, and `false` otherwise.  Two `ThreadAttributes` objects have the
 /// same value if the corresponding values of their `detachedState`,
 /// `guardSize`, `inheritSchedule`, `schedulingPolicy`,
-/// `schedulingPriority`, and `stackSize` attributes are the same.
+/// `schedulingPriority`, `stackSize`, `threadName`, `cpuAffinity`, and
+/// `numaNode` attributes are the same.
 bool operator==(const ThreadAttributes& lhs, const ThreadAttributes& rhs);
 
 /// Return `true` if the specified `lhs` and `rhs` objects do not have the
 /// same value, and `false` otherwise.  Two `baltzo::LocalTimeDescriptor`
 /// objects do not have the same value if the corresponding values of their
 /// `detachedState`, `guardSize`, `inheritSchedule`, `schedulingPolicy`,
-/// `schedulingPriority`, and `stackSize` attributes are not the same.
+/// `schedulingPriority`, `stackSize`, `threadName`, `cpuAffinity`, or
+/// `numaNode` attributes are not the same.
 bool operator!=(const ThreadAttributes& lhs, const ThreadAttributes& rhs);
 
 // FREE OPERATORS
@@ -592,6 +668,21 @@ bsl::ostream& operator<<(bsl::ostream&           stream,
                           // ----------------------
 
 // MANIPULATORS
+inline
+ThreadAttributes& ThreadAttributes::setCpuAffinity(
+                                                const bsl::vector<int>& value)
+{
+#ifdef BSLS_ASSERT_SAFE_IS_ACTIVE
+    for (bsl::size_t i = 0; i < value.size(); ++i) {
+        BSLS_ASSERT_SAFE(0 <= value[i]);
+    }
+#endif
+
+    d_cpuAffinity = value;
+
+    return *this;
+}
+
 inline
 ThreadAttributes& ThreadAttributes::setDetachedState(
                                          ThreadAttributes::DetachedState value)
@@ -624,6 +715,18 @@ ThreadAttributes& ThreadAttributes::setInheritSchedule(bool value)
     return *this;
 }
 
+inline
+ThreadAttributes& ThreadAttributes::setNumaNode(int value)
+{
+    BSLMF_ASSERT(-1 == e_UNSET_NUMA_NODE);
+
+    BSLS_ASSERT_SAFE(-1 <= value);
+
+    d_numaNode = value;
+
+    return *this;
+}
+
 inline
 ThreadAttributes& ThreadAttributes::setSchedulingPolicy(
                                       ThreadAttributes::SchedulingPolicy value)
@@ -666,6 +769,12 @@ ThreadAttributes& ThreadAttributes::setThreadName(
 }
 
 // ACCESSORS
+inline
+const bsl::vector<int>& ThreadAttributes::cpuAffinity() const
+{
+    return d_cpuAffinity;
+}
+
 inline
 ThreadAttributes::DetachedState ThreadAttributes::detachedState() const
 {
@@ -684,6 +793,12 @@ bool ThreadAttributes::inheritSchedule() const
     return d_inheritScheduleFlag;
 }
 
+inline
+int ThreadAttributes::numaNode() const
+{
+    return d_numaNode;
+}
+
 inline
 ThreadAttributes::SchedulingPolicy ThreadAttributes::schedulingPolicy() const
 {
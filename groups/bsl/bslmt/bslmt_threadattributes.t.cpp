@@ -19,6 +19,7 @@
 
 #include <bslmf_assert.h>
 
+#include <bsls_asserttest.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
@@ -26,6 +27,8 @@
 #include <bsl_ios.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
 
 #ifdef BSLMT_PLATFORM_POSIX_THREADS
     #include <pthread.h>
@@ -78,6 +81,13 @@ void aSsErT(bool condition, const char *message, int line)
 #define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
 #define L_           BSLIM_TESTUTIL_L_  // current Line number
 
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
 // ============================================================================
 //                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
 // ----------------------------------------------------------------------------
@@ -251,7 +261,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 5: {
+      case 6: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE TEST
         //
@@ -300,6 +310,181 @@ int main(int argc, char *argv[])
 // ```
 
       } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // PROCESSOR AFFINITY ATTRIBUTES
+        //
+        // Concerns:
+        // 1. A default-constructed object has an empty `cpuAffinity` and an
+        //    unset `numaNode`.
+        //
+        // 2. The setters set the value of the attributes, and the value is
+        //    propagated by copy construction and copy assignment, using the
+        //    allocator of the destination object.
+        //
+        // 3. The equality operators compare the new attributes.
+        //
+        // 4. The new attributes are printed only when set, so that the output
+        //    of `print` is unchanged for objects not using them.
+        //
+        // 5. Precondition violations are detected in appropriate build modes.
+        //
+        // Plan:
+        // 1. Verify the default values.  (C-1)
+        //
+        // 2. Set each attribute, then copy and assign the object, verifying
+        //    the value and allocator of the results.  (C-2)
+        //
+        // 3. Compare objects differing only in each new attribute.  (C-3)
+        //
+        // 4. Print objects with and without the attributes set.  (C-4)
+        //
+        // 5. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid attribute values.  (C-5)
+        //
+        // Testing:
+        //   void setCpuAffinity(const bsl::vector<int>& value);
+        //   void setNumaNode(int value);
+        //   const bsl::vector<int>& cpuAffinity() const;
+        //   int numaNode() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "PROCESSOR AFFINITY ATTRIBUTES" << endl
+                                  << "=============================" << endl;
+
+        bslma::TestAllocator da("default",  veryVeryVerbose);
+        bslma::TestAllocator oa("object",   veryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) cout << "\nDefault values." << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(X.cpuAffinity().empty());
+            ASSERT(Obj::e_UNSET_NUMA_NODE == X.numaNode());
+        }
+
+        if (verbose) cout << "\nSetters, copy, and assignment." << endl;
+        {
+            bsl::vector<int> cpus(&sa);
+            cpus.push_back(1);
+            cpus.push_back(3);
+            cpus.push_back(64);
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX.setCpuAffinity(cpus);
+            ASSERT(cpus == X.cpuAffinity());
+            ASSERT(&oa  == X.cpuAffinity().get_allocator().mechanism());
+
+            mX.setNumaNode(1);
+            ASSERT(1 == X.numaNode());
+
+            mX.setNumaNode(Obj::e_UNSET_NUMA_NODE);
+            ASSERT(Obj::e_UNSET_NUMA_NODE == X.numaNode());
+
+            mX.setNumaNode(0);
+            ASSERT(0 == X.numaNode());
+
+            Obj mY(X, &sa);  const Obj& Y = mY;
+
+            ASSERT(cpus == Y.cpuAffinity());
+            ASSERT(0    == Y.numaNode());
+            ASSERT(&sa  == Y.cpuAffinity().get_allocator().mechanism());
+            ASSERT(X    == Y);
+
+            Obj mZ(&sa);  const Obj& Z = mZ;
+
+            mZ = X;
+            ASSERT(cpus == Z.cpuAffinity());
+            ASSERT(0    == Z.numaNode());
+            ASSERT(&sa  == Z.cpuAffinity().get_allocator().mechanism());
+            ASSERT(X    == Z);
+
+            mX.setCpuAffinity(bsl::vector<int>());
+            ASSERT(X.cpuAffinity().empty());
+
+            ASSERT(0 == da.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\nEquality." << endl;
+        {
+            bsl::vector<int> cpus;
+            cpus.push_back(2);
+
+            Obj mX;  const Obj& X = mX;
+            Obj mY;  const Obj& Y = mY;
+
+            ASSERT(  X == Y );
+            ASSERT(!(X != Y));
+
+            mX.setCpuAffinity(cpus);
+            ASSERT(!(X == Y));
+            ASSERT(  X != Y );
+
+            mY.setCpuAffinity(cpus);
+            ASSERT(  X == Y );
+            ASSERT(!(X != Y));
+
+            mX.setNumaNode(0);
+            ASSERT(!(X == Y));
+            ASSERT(  X != Y );
+
+            mY.setNumaNode(0);
+            ASSERT(  X == Y );
+            ASSERT(!(X != Y));
+        }
+
+        if (verbose) cout << "\nPrint." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            bsl::ostringstream unset;
+            X.print(unset, 0, -1);
+
+            ASSERTV(unset.str(),
+                    bsl::string::npos == unset.str().find("cpuAffinity"));
+            ASSERTV(unset.str(),
+                    bsl::string::npos == unset.str().find("numaNode"));
+
+            bsl::vector<int> cpus;
+            cpus.push_back(2);
+            cpus.push_back(5);
+
+            mX.setCpuAffinity(cpus);
+            mX.setNumaNode(1);
+
+            bsl::ostringstream set;
+            X.print(set, 0, -1);
+
+            ASSERTV(set.str(),
+               bsl::string::npos != set.str().find("cpuAffinity = [ 2 5 ]"));
+            ASSERTV(set.str(),
+                    bsl::string::npos != set.str().find("numaNode = 1"));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX;
+
+            bsl::vector<int> cpus;
+            cpus.push_back(0);
+
+            ASSERT_SAFE_PASS(mX.setCpuAffinity(cpus));
+
+            cpus.push_back(-1);
+
+            ASSERT_SAFE_FAIL(mX.setCpuAffinity(cpus));
+
+            ASSERT_SAFE_PASS(mX.setNumaNode(0));
+            ASSERT_SAFE_PASS(mX.setNumaNode(Obj::e_UNSET_NUMA_NODE));
+            ASSERT_SAFE_FAIL(mX.setNumaNode(-2));
+        }
+      } break;
       case 4: {
         // --------------------------------------------------------------------
         // PRINT AND OUTPUT OPERATOR
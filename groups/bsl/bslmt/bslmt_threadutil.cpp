@@ -8,6 +8,7 @@ BSLS_IDENT_RCSID(bslmt_threadutil_cpp,"$Id$ $CSID$")
 #include <bslma_default.h>
 #include <bslma_managedptr.h>
 
+#include <bsls_assert.h>
 #include <bsls_atomic.h>
 #include <bsls_platform.h>
 
@@ -207,6 +208,23 @@ int bslmt::ThreadUtil::createWithAllocator(Handle                  *handle,
     return Imp::create(handle, attributes, function, userData);
 }
 
+int bslmt::ThreadUtil::getCpuAffinity(bsl::vector<int>        *cpus,
+                                      const ThreadAttributes&  attributes)
+{
+    BSLS_ASSERT(cpus);
+
+    if (!attributes.cpuAffinity().empty()) {
+        *cpus = attributes.cpuAffinity();
+        return 0;                                                     // RETURN
+    }
+
+    if (ThreadAttributes::e_UNSET_NUMA_NODE != attributes.numaNode()) {
+        return getNumaNodeCpus(cpus, attributes.numaNode());          // RETURN
+    }
+
+    return getCpuAffinity(cpus);
+}
+
 void bslmt::ThreadUtil::setThreadLimit(unsigned int n) {
     g_threadLimit.store(n);
 }
@@ -98,6 +98,32 @@ BSLS_IDENT("$Id: $")
 //               `inheritSchedule` are ignored for all clients.
 // ```
 //
+///Processor Affinity and NUMA Nodes
+///---------------------------------
+// `bslmt::ThreadUtil` allows clients to restrict the processors on which a
+// newly created thread may execute by setting the `cpuAffinity` or the
+// `numaNode` attribute of the thread attributes object supplied to the
+// `create` method: a thread created with a non-empty `cpuAffinity` executes
+// only on the processors listed, and a thread created with only a `numaNode`
+// executes only on the processors of that node (see `getNumaNodeCpus`).  The
+// affinity of the calling thread can be inspected and changed with
+// `getCpuAffinity` and `setCpuAffinity`, and the processors selected by a
+// thread attributes object can be obtained with the `getCpuAffinity` overload
+// taking one.  Keeping a thread on the processors
+// of a single NUMA node keeps the memory that it allocates and first touches
+// local to that node.  The thread pools of `bdlmt` accept a thread attributes
+// object at construction, so that, e.g., all the workers of a pool can be
+// restricted to a given node.
+//
+// Affinity is supported on Linux (on all the processors) and on Windows (on
+// the processors of the current processor group); the affinity attributes are
+// ignored on other platforms, where `getCpuAffinity` and `setCpuAffinity`
+// fail.  Where affinity is supported, it is applied before the new thread
+// begins to execute, and `create` fails if it cannot be applied (e.g., if
+// none of the specified processors is valid).  On platforms that do not
+// expose their NUMA topology, all the processors are considered to belong to
+// node 0.
+//
 ///Supported Clock-Types
 ///---------------------
 // `bsls::SystemClockType` supplies the enumeration indicating the system clock
@@ -286,6 +312,7 @@ BSLS_IDENT("$Id: $")
 #include <bsls_types.h>
 
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #ifdef BSLS_LIBRARYFEATURES_HAS_CPP11_BASELINE_LIBRARY
 #include <bslmt_chronoutil.h>
@@ -756,6 +783,44 @@ struct ThreadUtil {
     /// has not been deleted.
     static int setSpecific(const Key& key, const void *value);
 
+                        // *** Processor Affinity ***
+
+    /// Load into the specified `cpus` the indices, in increasing order, of
+    /// the processors on which the calling thread may execute.  Return 0 on
+    /// success, and a non-zero value (with no effect on `cpus`) otherwise,
+    /// in particular on platforms not supporting processor affinity.
+    static int getCpuAffinity(bsl::vector<int> *cpus);
+
+    /// Load into the specified `cpus` the indices of the processors on
+    /// which a thread created by the calling thread with the specified
+    /// `attributes` may execute: the `cpuAffinity` attribute of
+    /// `attributes` if not empty, otherwise the processors of its
+    /// `numaNode` attribute if set, and otherwise the processors on which
+    /// the calling thread may execute.  Return 0 on success, and a non-zero
+    /// value (with no effect on `cpus`) if these processors cannot be
+    /// determined.  Note that this method allows a thread pool to
+    /// distribute its workers over the processors selected by the thread
+    /// attributes it is supplied.
+    static int getCpuAffinity(bsl::vector<int>        *cpus,
+                              const ThreadAttributes&  attributes);
+
+    /// Load into the specified `cpus` the indices, in increasing order, of
+    /// the processors of the specified `numaNode`.  Return 0 on success,
+    /// and a non-zero value (with no effect on `cpus`) if `numaNode` is not
+    /// in the range `[0 .. numNumaNodes() - 1]` or its processors cannot be
+    /// determined (e.g., the node has memory but no processors).
+    static int getNumaNodeCpus(bsl::vector<int> *cpus, int numaNode);
+
+    /// Return the number of NUMA nodes of this system, or 1 if this
+    /// platform does not expose its NUMA topology.
+    static int numNumaNodes();
+
+    /// Restrict the calling thread to execute on the processors having the
+    /// specified `cpus` indices.  Return 0 on success, and a non-zero value
+    /// otherwise, in particular if `cpus` contains no valid processor index
+    /// and on platforms not supporting processor affinity.
+    static int setCpuAffinity(const bsl::vector<int>& cpus);
+
     /// Return a *hint* at the number of concurrent threads supported by
     /// this platform on success, and 0 otherwise.
     static unsigned int hardwareConcurrency();
@@ -1126,6 +1191,36 @@ int ThreadUtil::setSpecific(const Key& key, const void *value)
     return Imp::setSpecific(key, value);
 }
 
+                        // *** Processor Affinity ***
+
+inline
+int ThreadUtil::getCpuAffinity(bsl::vector<int> *cpus)
+{
+    BSLS_ASSERT(cpus);
+
+    return Imp::getCpuAffinity(cpus);
+}
+
+inline
+int ThreadUtil::getNumaNodeCpus(bsl::vector<int> *cpus, int numaNode)
+{
+    BSLS_ASSERT(cpus);
+
+    return Imp::getNumaNodeCpus(cpus, numaNode);
+}
+
+inline
+int ThreadUtil::numNumaNodes()
+{
+    return Imp::numNumaNodes();
+}
+
+inline
+int ThreadUtil::setCpuAffinity(const bsl::vector<int>& cpus)
+{
+    return Imp::setCpuAffinity(cpus);
+}
+
 inline
 unsigned int ThreadUtil::hardwareConcurrency()
 {
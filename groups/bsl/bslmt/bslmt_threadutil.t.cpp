@@ -41,6 +41,7 @@
 #include <bsl_iostream.h>
 #include <bsl_map.h>
 #include <bsl_set.h>
+#include <bsl_vector.h>
 
 #include <errno.h>
 
@@ -448,6 +449,28 @@ class Mutex {
 }  // close namespace u
 }  // close unnamed namespace
 
+//-----------------------------------------------------------------------------
+//                              Processor Affinity
+//-----------------------------------------------------------------------------
+
+namespace BSLMT_THREADUTIL_PROCESSOR_AFFINITY_TEST {
+
+/// This `struct` records, when invoked, the processor affinity of the
+/// thread invoking it.
+struct AffinityRecorder {
+    // DATA
+    bsl::vector<int> *d_cpus_p;  // recorded affinity (held, not owned)
+    int              *d_rc_p;    // status of `getCpuAffinity`
+
+    // ACCESSORS
+    void operator()() const
+    {
+        *d_rc_p = bslmt::ThreadUtil::getCpuAffinity(d_cpus_p);
+    }
+};
+
+}  // close namespace BSLMT_THREADUTIL_PROCESSOR_AFFINITY_TEST
+
 //-----------------------------------------------------------------------------
 //                               All Create Test
 //-----------------------------------------------------------------------------
@@ -1645,6 +1668,170 @@ int main(int argc, char *argv[])
 #endif
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 22: {
+        // --------------------------------------------------------------------
+        // PROCESSOR AFFINITY
+        //
+        // Concerns:
+        // 1. `numNumaNodes` returns a positive value, and node 0 has at least
+        //    one processor, all of which the process may execute on unless
+        //    restricted externally.
+        //
+        // 2. `getNumaNodeCpus` fails for nodes out of range.
+        //
+        // 3. On platforms supporting affinity, `setCpuAffinity` restricts the
+        //    calling thread to the specified processors, as reported by
+        //    `getCpuAffinity`, and fails if no processor is valid.
+        //
+        // 4. On platforms supporting affinity, a thread created with the
+        //    `cpuAffinity` attribute set executes on the specified processors
+        //    only, and a thread created with the `numaNode` attribute set
+        //    executes only on processors of that node.
+        //
+        // 5. `getCpuAffinity` taking thread attributes reports the
+        //    `cpuAffinity` attribute if set, otherwise the processors of the
+        //    `numaNode` attribute if set, and otherwise the affinity of the
+        //    calling thread, and fails for an invalid node.
+        //
+        // Plan:
+        // 1. Call `numNumaNodes` and `getNumaNodeCpus` for node 0 and for
+        //    invalid nodes.  (C-1..2)
+        //
+        // 2. Restrict the calling thread to its first allowed processor,
+        //    verify the result using `getCpuAffinity`, then restore the
+        //    original affinity.  (C-3)
+        //
+        // 3. Create threads having the affinity attributes set, and record
+        //    the affinity observed by each thread.  (C-4)
+        //
+        // 4. Call `getCpuAffinity` with attributes having no affinity
+        //    attribute set, each one of them set, and an invalid node.  (C-5)
+        //
+        // Testing:
+        //   int getCpuAffinity(bsl::vector<int> *cpus);
+        //   int getCpuAffinity(bsl::vector<int> *, const ThreadAttributes&);
+        //   int getNumaNodeCpus(bsl::vector<int> *cpus, int numaNode);
+        //   int numNumaNodes();
+        //   int setCpuAffinity(const bsl::vector<int>& cpus);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PROCESSOR AFFINITY\n"
+                             "==================\n";
+
+        namespace TC = BSLMT_THREADUTIL_PROCESSOR_AFFINITY_TEST;
+
+        const int numNodes = Obj::numNumaNodes();
+        ASSERTV(numNodes, 1 <= numNodes);
+
+        bsl::vector<int> nodeCpus;
+        int              rc = Obj::getNumaNodeCpus(&nodeCpus, 0);
+        ASSERTV(rc, 0 == rc);
+        ASSERT(!nodeCpus.empty());
+        ASSERT(bsl::is_sorted(nodeCpus.begin(), nodeCpus.end()));
+
+        if (veryVerbose) {
+            P_(numNodes);  P(nodeCpus.size());
+        }
+
+        bsl::vector<int> invalid(1, 42);
+        ASSERT(0 != Obj::getNumaNodeCpus(&invalid, -1));
+        ASSERT(0 != Obj::getNumaNodeCpus(&invalid, numNodes));
+        ASSERT(1 == invalid.size() && 42 == invalid[0]);
+
+        bsl::vector<int> original;
+        if (0 != Obj::getCpuAffinity(&original)) {
+            if (verbose) cout << "Affinity not supported." << endl;
+            break;
+        }
+
+        ASSERT(!original.empty());
+        ASSERT(bsl::is_sorted(original.begin(), original.end()));
+
+        if (verbose) cout << "\nTesting `setCpuAffinity`." << endl;
+        {
+            bsl::vector<int> first(1, original.front());
+            bsl::vector<int> cpus;
+
+            ASSERT(0 == Obj::setCpuAffinity(first));
+            ASSERT(0 == Obj::getCpuAffinity(&cpus));
+            ASSERT(first == cpus);
+
+            ASSERT(0 != Obj::setCpuAffinity(bsl::vector<int>()));
+            ASSERT(0 != Obj::setCpuAffinity(bsl::vector<int>(1, -1)));
+
+            ASSERT(0 == Obj::setCpuAffinity(original));
+            ASSERT(0 == Obj::getCpuAffinity(&cpus));
+            ASSERT(original == cpus);
+        }
+
+        if (verbose) cout << "\nTesting the `cpuAffinity` attribute." << endl;
+        {
+            bsl::vector<int> last(1, original.back());
+
+            bslmt::ThreadAttributes attributes;
+            attributes.setCpuAffinity(last);
+
+            bsl::vector<int>     cpus;
+            int                  threadRc = -1;
+            TC::AffinityRecorder recorder = { &cpus, &threadRc };
+
+            Obj::Handle handle;
+            ASSERT(0 == Obj::create(&handle, attributes, recorder));
+            ASSERT(0 == Obj::join(handle));
+
+            ASSERT(0 == threadRc);
+            ASSERT(last == cpus);
+        }
+
+        if (verbose) cout << "\nTesting the `numaNode` attribute." << endl;
+        {
+            bslmt::ThreadAttributes attributes;
+            attributes.setNumaNode(0);
+
+            bsl::vector<int>     cpus;
+            int                  threadRc = -1;
+            TC::AffinityRecorder recorder = { &cpus, &threadRc };
+
+            Obj::Handle handle;
+            ASSERT(0 == Obj::create(&handle, attributes, recorder));
+            ASSERT(0 == Obj::join(handle));
+
+            // The affinity of the thread may be further restricted, e.g., by
+            // the cpuset of the process.
+
+            ASSERT(0 == threadRc);
+            ASSERT(!cpus.empty());
+            ASSERT(bsl::includes(nodeCpus.begin(),
+                                 nodeCpus.end(),
+                                 cpus.begin(),
+                                 cpus.end()));
+        }
+
+        if (verbose) cout << "\nTesting `getCpuAffinity` with attributes."
+                          << endl;
+        {
+            bslmt::ThreadAttributes attributes;
+            bsl::vector<int>        cpus;
+
+            ASSERT(0 == Obj::getCpuAffinity(&cpus, attributes));
+            ASSERT(original == cpus);
+
+            attributes.setNumaNode(0);
+            ASSERT(0 == Obj::getCpuAffinity(&cpus, attributes));
+            ASSERT(nodeCpus == cpus);
+
+            bsl::vector<int> last(1, original.back());
+
+            attributes.setCpuAffinity(last);
+            ASSERT(0 == Obj::getCpuAffinity(&cpus, attributes));
+            ASSERT(last == cpus);
+
+            attributes.setCpuAffinity(bsl::vector<int>());
+            attributes.setNumaNode(numNodes);
+            ASSERT(0 != Obj::getCpuAffinity(&cpus, attributes));
+            ASSERT(last == cpus);
+        }
+      } break;
       case 21: {
         // --------------------------------------------------------------------
         // THREAD LIBRARY CONSISTENCY
@@ -18,10 +18,12 @@ BSLS_IDENT_RCSID(bslmt_threadutilimpl_pthread_cpp,"$Id$ $CSID$")
 
 
 #include <bsl_algorithm.h>   // 'bsl::min'
+#include <bsl_cstdio.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_ctime.h>
 #include <bsl_c_limits.h>
+#include <bsl_vector.h>
 
 #include <pthread.h>
 #include <unistd.h>        // sysconf, geteuid
@@ -35,6 +37,7 @@ BSLS_IDENT_RCSID(bslmt_threadutilimpl_pthread_cpp,"$Id$ $CSID$")
 #elif defined(BSLS_PLATFORM_OS_SOLARIS)
 # include <sys/utsname.h>
 #elif defined(BSLS_PLATFORM_OS_LINUX)
+# include <sched.h>        // cpu_set_t
 # include <sys/prctl.h>
 #endif
 
@@ -85,6 +88,92 @@ int localPthreadsPolicy(int policy)
     return SCHED_OTHER;
 }
 
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+/// Load into the specified `cpus` the processor indices described by the
+/// specified `list`, in the format of the Linux `cpulist` files (e.g.,
+/// "0-3,8,10-11"), in increasing order.  Return 0 on success, and a non-zero
+/// value if `list` is not well-formed or describes no processor.
+static int parseCpuList(bsl::vector<int> *cpus, const char *list)
+{
+    bsl::vector<int> result;
+
+    const char *p = list;
+    while (*p && '\n' != *p) {
+        char *end;
+        long  first = bsl::strtol(p, &end, 10);
+        if (end == p || first < 0) {
+            return -1;                                                // RETURN
+        }
+        long last = first;
+        p = end;
+        if ('-' == *p) {
+            ++p;
+            last = bsl::strtol(p, &end, 10);
+            if (end == p || last < first) {
+                return -1;                                            // RETURN
+            }
+            p = end;
+        }
+        for (long cpu = first; cpu <= last; ++cpu) {
+            result.push_back(static_cast<int>(cpu));
+        }
+        if (',' == *p) {
+            ++p;
+        }
+        else if (*p && '\n' != *p) {
+            return -1;                                                // RETURN
+        }
+    }
+
+    if (result.empty()) {
+        return -1;                                                    // RETURN
+    }
+
+    bsl::sort(result.begin(), result.end());
+    result.erase(bsl::unique(result.begin(), result.end()), result.end());
+    cpus->swap(result);
+    return 0;
+}
+
+/// Load into the specified `cpus` the processor indices listed in the file
+/// having the specified `path`, in the format of the Linux `cpulist` files.
+/// Return 0 on success, and a non-zero value otherwise.
+static int readCpuList(bsl::vector<int> *cpus, const char *path)
+{
+    bsl::FILE *file = bsl::fopen(path, "r");
+    if (!file) {
+        return -1;                                                    // RETURN
+    }
+
+    char              buffer[4096];
+    const bsl::size_t length = bsl::fread(buffer, 1, sizeof buffer - 1, file);
+    bsl::fclose(file);
+
+    buffer[length] = '\0';
+    return parseCpuList(cpus, buffer);
+}
+
+/// Load into the specified `set` the processors having the specified `cpus`
+/// indices.  Return 0 on success, and a non-zero value if no element of
+/// `cpus` is a valid index for a `cpu_set_t`.
+static int makeCpuSet(cpu_set_t *set, const bsl::vector<int>& cpus)
+{
+    CPU_ZERO(set);
+
+    bool any = false;
+    for (bsl::size_t i = 0; i < cpus.size(); ++i) {
+        if (0 <= cpus[i] && cpus[i] < CPU_SETSIZE) {
+            CPU_SET(cpus[i], set);
+            any = true;
+        }
+    }
+
+    return any ? 0 : -1;
+}
+
+#endif  // defined(BSLS_PLATFORM_OS_LINUX)
+
 /// Initialize the specified pthreads attribute type `destination`,
 /// configuring it with information from the specified thread attributes
 /// object `src`.  Note that it is assumed that `destination` is
@@ -170,6 +259,23 @@ static int initPthreadAttribute(pthread_attr_t                 *destination,
         rc |= pthread_attr_setstacksize(destination, stackSize);
     }
 
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    if (!src.cpuAffinity().empty()
+     || Attr::e_UNSET_NUMA_NODE != src.numaNode()) {
+        bsl::vector<int> nodeCpus;
+        if (src.cpuAffinity().empty()) {
+            rc |= bslmt::ThreadUtilImpl<bslmt::Platform::PosixThreads>::
+                                    getNumaNodeCpus(&nodeCpus, src.numaNode());
+        }
+
+        cpu_set_t cpuSet;
+        rc |= makeCpuSet(&cpuSet,
+                         src.cpuAffinity().empty() ? nodeCpus
+                                                   : src.cpuAffinity());
+        rc |= pthread_attr_setaffinity_np(destination, sizeof cpuSet, &cpuSet);
+    }
+#endif
+
     return rc;
 }
 
@@ -569,6 +675,103 @@ bslmt::ThreadUtilImpl<bslmt::Platform::PosixThreads>::hardwareConcurrency()
     return 0 > result ? 0 : static_cast<unsigned int>(result);
 }
 
+                        // *** Processor Affinity ***
+
+int bslmt::ThreadUtilImpl<bslmt::Platform::PosixThreads>::getCpuAffinity(
+                                                        bsl::vector<int> *cpus)
+{
+    BSLS_ASSERT(cpus);
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+
+    if (0 != pthread_getaffinity_np(pthread_self(), sizeof cpuSet, &cpuSet)) {
+        return -1;                                                    // RETURN
+    }
+
+    bsl::vector<int> result;
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &cpuSet)) {
+            result.push_back(cpu);
+        }
+    }
+    cpus->swap(result);
+    return 0;
+#else
+    (void)cpus;
+    return -1;
+#endif
+}
+
+int bslmt::ThreadUtilImpl<bslmt::Platform::PosixThreads>::getNumaNodeCpus(
+                                                    bsl::vector<int> *cpus,
+                                                    int               numaNode)
+{
+    BSLS_ASSERT(cpus);
+
+    if (numaNode < 0 || numaNode >= numNumaNodes()) {
+        return -1;                                                    // RETURN
+    }
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    char path[64];
+    bsl::snprintf(path,
+                  sizeof path,
+                  "/sys/devices/system/node/node%d/cpulist",
+                  numaNode);
+
+    if (0 == u::readCpuList(cpus, path)) {
+        return 0;                                                     // RETURN
+    }
+    if (0 != numaNode) {
+        return -1;                                                    // RETURN
+    }
+#endif
+
+    // The NUMA topology is not exposed: all the processors belong to node 0.
+
+    const int numCpus = static_cast<int>(hardwareConcurrency());
+    if (0 == numCpus) {
+        return -1;                                                    // RETURN
+    }
+
+    bsl::vector<int> result(numCpus);
+    for (int cpu = 0; cpu < numCpus; ++cpu) {
+        result[cpu] = cpu;
+    }
+    cpus->swap(result);
+    return 0;
+}
+
+int bslmt::ThreadUtilImpl<bslmt::Platform::PosixThreads>::numNumaNodes()
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    bsl::vector<int> nodes;
+    if (0 == u::readCpuList(&nodes, "/sys/devices/system/node/online")) {
+        return nodes.back() + 1;                                      // RETURN
+    }
+#endif
+
+    return 1;
+}
+
+int bslmt::ThreadUtilImpl<bslmt::Platform::PosixThreads>::setCpuAffinity(
+                                                  const bsl::vector<int>& cpus)
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    cpu_set_t cpuSet;
+    if (0 != u::makeCpuSet(&cpuSet, cpus)) {
+        return -1;                                                    // RETURN
+    }
+
+    return pthread_setaffinity_np(pthread_self(), sizeof cpuSet, &cpuSet);
+#else
+    (void)cpus;
+    return -1;
+#endif
+}
+
 }  // close enterprise namespace
 
 #endif
@@ -59,6 +59,7 @@ BSLS_IDENT("$Id: $")
 #include <bsls_types.h>
 
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #include <pthread.h>
 
@@ -356,6 +357,32 @@ struct ThreadUtilImpl<Platform::PosixThreads> {
     /// elaborate on what `value` represents
     static int setSpecific(const Key& key, const void *value);
 
+                        // *** Processor Affinity ***
+
+    /// Load into the specified `cpus` the indices, in increasing order, of
+    /// the processors on which the current thread may execute.  Return 0 on
+    /// success, and a non-zero value (with no effect on `cpus`) otherwise,
+    /// in particular on platforms other than Linux.
+    static int getCpuAffinity(bsl::vector<int> *cpus);
+
+    /// Load into the specified `cpus` the indices, in increasing order, of
+    /// the processors of the specified `numaNode`.  Return 0 on success,
+    /// and a non-zero value (with no effect on `cpus`) if `numaNode` is not
+    /// a valid node or the processors of `numaNode` cannot be determined.
+    /// On platforms not exposing the NUMA topology, all the processors are
+    /// considered to belong to node 0.
+    static int getNumaNodeCpus(bsl::vector<int> *cpus, int numaNode);
+
+    /// Return the number of NUMA nodes of this system, or 1 if it cannot be
+    /// determined.
+    static int numNumaNodes();
+
+    /// Restrict the current thread to execute on the processors having the
+    /// specified `cpus` indices.  Return 0 on success, and a non-zero value
+    /// otherwise, in particular if `cpus` is empty or contains no valid
+    /// processor index, and on platforms other than Linux.
+    static int setCpuAffinity(const bsl::vector<int>& cpus);
+
     /// Return the number of concurrent threads supported by the
     /// implementation on success, and 0 otherwise.
     static unsigned int hardwareConcurrency();
@@ -19,6 +19,7 @@ BSLS_IDENT_RCSID(bslmt_threadutilimpl_win32_cpp,"$Id$ $CSID$")
 #include <bsls_types.h>
 
 #include <bsl_cstring.h>  // 'memcpy'
+#include <bsl_vector.h>
 
 #include <process.h>      // '_begintthreadex', '_endthreadex'
 #include <windows.h>
@@ -482,6 +483,37 @@ static unsigned _stdcall ThreadEntry(void *arg)
     return (unsigned)(bsls::Types::IntPtr)ret;
 }
 
+static DWORD_PTR makeAffinityMask(const bsl::vector<int>& cpus)
+    // Return the affinity mask of the processors having the specified 'cpus'
+    // indices, ignoring the indices that are not valid in the current
+    // processor group.
+{
+    const int numBits = static_cast<int>(sizeof(DWORD_PTR) * 8);
+
+    DWORD_PTR mask = 0;
+    for (bsl::size_t i = 0; i < cpus.size(); ++i) {
+        if (0 <= cpus[i] && cpus[i] < numBits) {
+            mask |= static_cast<DWORD_PTR>(1) << cpus[i];
+        }
+    }
+    return mask;
+}
+
+static void loadAffinityCpus(bsl::vector<int> *cpus, DWORD_PTR mask)
+    // Load into the specified 'cpus' the indices, in increasing order, of the
+    // processors in the specified affinity 'mask'.
+{
+    const int numBits = static_cast<int>(sizeof(DWORD_PTR) * 8);
+
+    bsl::vector<int> result;
+    for (int cpu = 0; cpu < numBits; ++cpu) {
+        if (mask & (static_cast<DWORD_PTR>(1) << cpu)) {
+            result.push_back(cpu);
+        }
+    }
+    cpus->swap(result);
+}
+
 }  // close namespace u
 }  // close unnamed namespace
 
@@ -526,19 +558,55 @@ int bslmt::ThreadUtilImpl<bslmt::Platform::Win32Threads>::create(
                                         // but allow it just in case anyone was
                                         // depending on it.
 
+    // The thread is created suspended if its affinity is to be set, so that
+    // it executes (and first touches its memory) only on the processors of
+    // that affinity.
+
+    const bool hasAffinity =
+                   !attribute.cpuAffinity().empty()
+                || ThreadAttributes::e_UNSET_NUMA_NODE != attribute.numaNode();
+
+    DWORD_PTR mask = 0;
+    if (hasAffinity) {
+        bsl::vector<int> nodeCpus;
+        if (attribute.cpuAffinity().empty()) {
+            getNumaNodeCpus(&nodeCpus, attribute.numaNode());
+        }
+
+        mask = u::makeAffinityMask(attribute.cpuAffinity().empty()
+                                   ? nodeCpus
+                                   : attribute.cpuAffinity());
+        if (0 == mask) {
+            u::freeStartupInfo(startInfo);
+            return 1;                                                 // RETURN
+        }
+    }
+
     startInfo->d_threadArg = userData;
     startInfo->d_function  = function;
     handle->d_handle = (HANDLE)_beginthreadex(
-                                             0,
-                                             stackSize,
-                                             u::ThreadEntry,
-                                             startInfo,
-                                             STACK_SIZE_PARAM_IS_A_RESERVATION,
-                                             (unsigned int *)&handle->d_id);
+                          0,
+                          stackSize,
+                          u::ThreadEntry,
+                          startInfo,
+                          STACK_SIZE_PARAM_IS_A_RESERVATION
+                                           | (hasAffinity ? CREATE_SUSPENDED
+                                                          : 0),
+                          (unsigned int *)&handle->d_id);
     if ((HANDLE)0 == handle->d_handle) {
         u::freeStartupInfo(startInfo);
         return 1;                                                     // RETURN
     }
+    if (hasAffinity && 0 == SetThreadAffinityMask(handle->d_handle, mask)) {
+        // The thread has not started executing: 'startInfo' is still owned
+        // by this function.
+
+        TerminateThread(handle->d_handle, 1);
+        CloseHandle(handle->d_handle);
+        handle->d_handle = 0;
+        u::freeStartupInfo(startInfo);
+        return 1;                                                     // RETURN
+    }
     if (ThreadAttributes::e_CREATE_DETACHED ==
                                                    attribute.detachedState()) {
         HANDLE tmpHandle = handle->d_handle;
@@ -779,6 +847,76 @@ int bslmt::ThreadUtilImpl<bslmt::Platform::Win32Threads>::sleepUntil(
     return 0;
 }
 
+                        // *** Processor Affinity ***
+
+int bslmt::ThreadUtilImpl<bslmt::Platform::Win32Threads>::getCpuAffinity(
+                                                        bsl::vector<int> *cpus)
+{
+    BSLS_ASSERT(cpus);
+
+    // There is no 'GetThreadAffinityMask': obtain the mask of the current
+    // thread by setting it to the process mask, then restore it.
+
+    DWORD_PTR processMask;
+    DWORD_PTR systemMask;
+    if (!GetProcessAffinityMask(GetCurrentProcess(),
+                                &processMask,
+                                &systemMask)) {
+        return -1;                                                    // RETURN
+    }
+
+    const DWORD_PTR threadMask = SetThreadAffinityMask(GetCurrentThread(),
+                                                       processMask);
+    if (0 == threadMask) {
+        return -1;                                                    // RETURN
+    }
+    SetThreadAffinityMask(GetCurrentThread(), threadMask);
+
+    u::loadAffinityCpus(cpus, threadMask);
+    return 0;
+}
+
+int bslmt::ThreadUtilImpl<bslmt::Platform::Win32Threads>::getNumaNodeCpus(
+                                                    bsl::vector<int> *cpus,
+                                                    int               numaNode)
+{
+    BSLS_ASSERT(cpus);
+
+    if (numaNode < 0 || numaNode >= numNumaNodes()) {
+        return -1;                                                    // RETURN
+    }
+
+    ULONGLONG mask;
+    if (!GetNumaNodeProcessorMask(static_cast<UCHAR>(numaNode), &mask)
+     || 0 == mask) {
+        return -1;                                                    // RETURN
+    }
+
+    u::loadAffinityCpus(cpus, static_cast<DWORD_PTR>(mask));
+    return 0;
+}
+
+int bslmt::ThreadUtilImpl<bslmt::Platform::Win32Threads>::numNumaNodes()
+{
+    ULONG highestNode;
+    if (!GetNumaHighestNodeNumber(&highestNode)) {
+        return 1;                                                     // RETURN
+    }
+
+    return static_cast<int>(highestNode) + 1;
+}
+
+int bslmt::ThreadUtilImpl<bslmt::Platform::Win32Threads>::setCpuAffinity(
+                                                  const bsl::vector<int>& cpus)
+{
+    const DWORD_PTR mask = u::makeAffinityMask(cpus);
+    if (0 == mask) {
+        return -1;                                                    // RETURN
+    }
+
+    return 0 == SetThreadAffinityMask(GetCurrentThread(), mask) ? -1 : 0;
+}
+
 unsigned int
 bslmt::ThreadUtilImpl<bslmt::Platform::Win32Threads>::hardwareConcurrency()
 {
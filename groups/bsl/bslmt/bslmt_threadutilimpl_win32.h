@@ -60,6 +60,7 @@ BSLS_IDENT("$Id: $")
 #include <bsls_types.h>
 
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 typedef unsigned long DWORD;
 typedef int BOOL;
@@ -350,6 +351,31 @@ struct ThreadUtilImpl<Platform::Win32Threads> {
     /// `key`.  Return 0 on success, and a non-zero value otherwise.
     static int setSpecific(const Key& key, const void *value);
 
+                        // *** Processor Affinity ***
+
+    /// Load into the specified `cpus` the indices, in increasing order, of
+    /// the processors on which the current thread may execute.  Return 0 on
+    /// success, and a non-zero value (with no effect on `cpus`) otherwise.
+    /// Note that only the processors of the current processor group (i.e.,
+    /// indices less than 64) are reported.
+    static int getCpuAffinity(bsl::vector<int> *cpus);
+
+    /// Load into the specified `cpus` the indices, in increasing order, of
+    /// the processors of the specified `numaNode`.  Return 0 on success,
+    /// and a non-zero value (with no effect on `cpus`) if `numaNode` is not
+    /// a valid node or the processors of `numaNode` cannot be determined.
+    static int getNumaNodeCpus(bsl::vector<int> *cpus, int numaNode);
+
+    /// Return the number of NUMA nodes of this system, or 1 if it cannot be
+    /// determined.
+    static int numNumaNodes();
+
+    /// Restrict the current thread to execute on the processors having the
+    /// specified `cpus` indices.  Return 0 on success, and a non-zero value
+    /// otherwise, in particular if `cpus` contains no valid processor index
+    /// of the current processor group (i.e., less than 64).
+    static int setCpuAffinity(const bsl::vector<int>& cpus);
+
     /// Return the number of concurrent threads supported by the
     /// implementation on success, and 0 otherwise.
     static unsigned int hardwareConcurrency();